@@ -256,6 +256,30 @@ int msg_try_send(msg_t *m, kernel_pid_t target_pid);
  */
 int msg_send_to_self(msg_t *m);
 
+/**
+ * @brief Send multiple messages to a thread in one go.
+ *
+ * All messages are handed over to @p target_pid within a single critical
+ * section: If the target is waiting in @ref msg_receive, the first message
+ * is copied directly, all others are put into the target's message queue.
+ * The target is woken up at most once, regardless of @p num.
+ *
+ * This function never blocks. Messages that do not fit into the target's
+ * message queue are not sent, the caller can retry sending the remaining
+ * messages at `&m[retval]`. It can be called from both thread and interrupt
+ * context.
+ *
+ * @param[in] m             Array of @p num preallocated messages, must not
+ *                          be NULL.
+ * @param[in] num           Number of messages in @p m
+ * @param[in] target_pid    PID of target thread
+ *
+ * @return number of messages delivered (directly or to the queue), counting
+ *         from the start of @p m
+ * @return -1, on error (invalid PID)
+ */
+int msg_send_batch(msg_t *m, unsigned num, kernel_pid_t target_pid);
+
 /**
  * Value of msg_t::sender_pid if the sender was an interrupt service routine.
  */
@@ -318,6 +342,26 @@ int msg_receive(msg_t *m);
  */
 int msg_try_receive(msg_t *m);
 
+/**
+ * @brief Receive multiple messages in one go.
+ *
+ * This function blocks until at least one message was received. Afterwards,
+ * up to @p num - 1 additional messages already present in the thread's
+ * message queue are fetched as well, without blocking and within a single
+ * critical section.
+ *
+ * @note    If threads are blocked waiting to send to the calling thread,
+ *          only a single message is received, so that the waiting senders
+ *          are woken up in order.
+ *
+ * @param[out] m    Array of @p num preallocated ``msg_t`` structures, must
+ *                  not be NULL.
+ * @param[in] num   Number of elements in @p m, must be at least 1
+ *
+ * @return  number of messages received (always at least 1)
+ */
+int msg_receive_batch(msg_t *m, unsigned num);
+
 /**
  * @brief Send a message, block until reply received.
  *
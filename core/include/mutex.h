@@ -18,6 +18,18 @@
  *              module `core_mutex_priority_inheritance` to employ
  *              priority inheritance as mitigation.
  *
+ * Priority Inheritance
+ * ====================
+ *
+ * With module `core_mutex_priority_inheritance`, the owner of a mutex is
+ * boosted to the priority of the highest priority thread blocked on it.
+ * The boost is propagated along chains of owners blocked on other mutexes.
+ * When a mutex is unlocked, the priority of the (former) owner is lowered to
+ * the highest priority still required by waiters of the mutexes it continues
+ * to hold, or to its original priority if no such waiter exists. Hence,
+ * nested locking (also in non-LIFO order) is supported. The thread obtaining
+ * the mutex during unlock becomes the new owner.
+ *
  * Mutex Implementation Basics
  * ===========================
  *
@@ -98,6 +110,20 @@
  *     - The scheduler is run, so that if the unblocked waiting thread can
  *       run now, in case it has a higher priority than the running thread.
  *
+ * Lock-free fast path
+ * -------------------
+ *
+ * On platforms with a native compare-and-swap instruction for pointers (e.g.
+ * LDREX/STREX on ARMv7-M or the RISC-V A extension), locking an unlocked mutex
+ * and unlocking a mutex without waiters is done with a single
+ * compare-and-swap, without disabling interrupts. Only if that fails, the
+ * regular path described above is taken. This also speeds up the uncontended
+ * case of locks built on top of mutexes, such as @ref rmutex_t and the pthread
+ * rwlock. The fast path is not used together with the modules
+ * `core_mutex_priority_inheritance` and `core_mutex_debug`, which need to
+ * track the owner, and can be disabled with
+ * @ref CONFIG_CORE_MUTEX_CAS_FAST_PATH.
+ *
  * Debugging deadlocks
  * -------------------
  *
@@ -140,6 +166,16 @@
 extern "C" {
 #endif
 
+/**
+ * @brief   Enable the lock-free fast path for uncontended mutexes
+ *
+ * Only has an effect on platforms with a native pointer sized
+ * compare-and-swap, see @ref core_sync_mutex.
+ */
+#ifndef CONFIG_CORE_MUTEX_CAS_FAST_PATH
+#define CONFIG_CORE_MUTEX_CAS_FAST_PATH     1
+#endif
+
 /**
  * @brief Mutex structure. Must never be modified by the user.
  */
@@ -180,6 +216,12 @@ typedef struct {
      *          is used.
      */
     uint8_t owner_original_priority;
+    /**
+     * @brief   Entry in the list of mutexes held by the owner
+     * @note    Only available if module core_mutex_priority_inheritance
+     *          is used.
+     */
+    list_node_t owner_held;
 #endif
 } mutex_t;
 
@@ -440,6 +482,28 @@ void mutex_unlock_and_sleep(mutex_t *mutex);
  */
 void mutex_cancel(mutex_cancel_t *mc);
 
+/**
+ * @brief   Makes a sleeping thread wait for a mutex without waking it up
+ *
+ * This allows condition variables to implement wait morphing: instead of
+ * waking up all threads on a broadcast, only for them to immediately block on
+ * the mutex again, they are moved to the wait queue of the mutex. If @p mutex
+ * is unlocked, @p thread becomes its owner and is woken up. Either way,
+ * @p thread holds @p mutex once it runs again.
+ *
+ * @note    This function is considered internal, see @ref mutex_cancel.
+ *
+ * @param[in,out]   mutex   Mutex @p thread has to acquire
+ * @param[in,out]   thread  Thread to make wait for @p mutex
+ *
+ * @pre     Interrupts are disabled and @p thread is in `STATUS_SLEEPING`
+ *
+ * @retval  true    @p thread holds or waits for @p mutex now
+ * @retval  false   Not supported with the used modules (e.g. `lockstats`),
+ *                  the caller has to wake up @p thread instead
+ */
+bool mutex_requeue(mutex_t *mutex, thread_t *thread);
+
 #ifdef __cplusplus
 }
 #endif
@@ -194,6 +194,21 @@ typedef enum {
 #define SCHED_PRIO_LEVELS 16
 #endif
 
+#if IS_USED(MODULE_SCHED_EDF) || defined(DOXYGEN)
+/**
+ * @def CONFIG_SCHED_EDF_PRIO
+ * @brief   Priority level scheduled by earliest deadline first
+ *
+ * Threads at this priority level are not scheduled round-robin, but ordered
+ * by their absolute deadline (see @ref sched_set_deadline). All other
+ * priority levels are unaffected. Defaults to one level above
+ * @ref THREAD_PRIORITY_MAIN.
+ */
+#ifndef CONFIG_SCHED_EDF_PRIO
+#define CONFIG_SCHED_EDF_PRIO ((SCHED_PRIO_LEVELS - 1) - (SCHED_PRIO_LEVELS / 2) - 1)
+#endif
+#endif
+
 /**
  * @brief   Triggers the scheduler to schedule the next thread
  *
@@ -305,13 +320,34 @@ typedef void (*sched_callback_t)(kernel_pid_t active, kernel_pid_t next);
 void sched_register_cb(sched_callback_t callback);
 #endif /* MODULE_SCHED_CB */
 
+#if IS_USED(MODULE_SCHED_EDF) || defined(DOXYGEN)
+/**
+ * @brief   Set the absolute deadline of a thread
+ *
+ * Threads running at @ref CONFIG_SCHED_EDF_PRIO are kept in their runqueue
+ * ordered by deadline, the thread with the earliest deadline is run first.
+ * Threads with equal deadlines are run in FIFO order. Deadlines are compared
+ * wrap-around safe, so they must lie less than 2^31 ticks apart.
+ *
+ * If @p thread is pending, it is moved to its new position and a context
+ * switch is triggered if that changes the scheduling decision.
+ *
+ * @pre     (thread != NULL)
+ *
+ * @param[in,out] thread    target thread
+ * @param[in]     deadline  absolute deadline, e.g. in ticks of a ztimer clock
+ */
+void sched_set_deadline(thread_t *thread, uint32_t deadline);
+#endif /* MODULE_SCHED_EDF */
+
 /**
  * @brief   Advance a runqueue
  *
  *  Advances the runqueue of that priority by one step to the next thread in
  *  that priority.
  *  Next time that priority is scheduled the now first thread will get activated.
- *  Calling this will not start the scheduler.
+ *  Calling this will not start the scheduler. With module `sched_edf`, this
+ *  is a no-op for @ref CONFIG_SCHED_EDF_PRIO.
  *
  * @warning This API is not intended for out of tree users.
  *          Breaking API changes will be done without notice and
@@ -322,6 +358,12 @@ void sched_register_cb(sched_callback_t callback);
  */
 static inline void sched_runq_advance(uint8_t prio)
 {
+#if IS_USED(MODULE_SCHED_EDF)
+    /* the deadline order must not be rotated */
+    if (prio == CONFIG_SCHED_EDF_PRIO) {
+        return;
+    }
+#endif
     clist_lpoprpush(&sched_runqueues[prio]);
 }
 
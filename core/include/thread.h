@@ -192,6 +192,17 @@ struct _thread {
     msg_t *msg_array;               /**< memory holding messages sent
                                          to this thread's message queue */
 #endif
+#if defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) || defined(DOXYGEN)
+    list_node_t mutexes_held;       /**< mutexes currently held by this
+                                         thread, most recently locked
+                                         first                          */
+    void *mutex_blocked_on;         /**< mutex this thread is blocked on,
+                                         if any                         */
+#endif
+#if defined(MODULE_SCHED_EDF) || defined(DOXYGEN)
+    uint32_t deadline;              /**< absolute deadline, only used for
+                                         threads at @ref CONFIG_SCHED_EDF_PRIO */
+#endif
 #if defined(DEVELHELP) || IS_ACTIVE(SCHED_TEST_STACK) \
     || defined(MODULE_MPU_STACK_GUARD) || defined(DOXYGEN)
     char *stack_start;              /**< thread's stack start address   */
@@ -476,6 +487,18 @@ static inline const char *thread_getname(kernel_pid_t pid)
  */
 uintptr_t measure_stack_free_internal(const char *stack, size_t size);
 
+/**
+ * @brief       Estimates the stack usage of a stack by checking only every
+ *              @ref CONFIG_THREAD_STACKTEST_FAST_STRIDE -th canary
+ * @internal    Should not be used externally
+ *
+ * @param[in] stack     the stack you want to measure
+ * @param[in] size      size of @p stack in bytes
+ *
+ * @return              a lower bound of the unused space of the stack
+ */
+uintptr_t measure_stack_free_fast_internal(const char *stack, size_t size);
+
 /**
  * @brief   Get the number of bytes used on the ISR stack
  */
@@ -655,6 +678,52 @@ static inline uintptr_t thread_measure_stack_free(const thread_t *thread)
                                        thread_get_stacksize(thread));
 }
 
+/**
+ * @brief       Estimates the stack usage of a stack quickly
+ *
+ * Like @ref thread_measure_stack_free, but only checks every
+ * @ref CONFIG_THREAD_STACKTEST_FAST_STRIDE -th word. The result may
+ * underestimate the free stack by up to
+ * `CONFIG_THREAD_STACKTEST_FAST_STRIDE - 1` words, but never overestimates
+ * it compared to @ref thread_measure_stack_free.
+ *
+ * @pre         Only works if the thread was created with the flag
+ *              `THREAD_CREATE_STACKTEST`.
+ *
+ * @param[in] thread    The thread to measure the stack of
+ *
+ * @return              a lower bound of the unused space of the thread's stack
+ */
+static inline uintptr_t thread_measure_stack_free_fast(const thread_t *thread)
+{
+    return measure_stack_free_fast_internal((const char *)thread_get_stackstart(thread),
+                                            thread_get_stacksize(thread));
+}
+
+#if defined(DEVELHELP) || defined(DOXYGEN)
+/**
+ * @brief       Hand the unused part of a thread's stack over to the caller
+ *
+ * The stack grows downwards, so the memory never used so far lies at the
+ * start of the stack. This function shrinks the stack of @p thread to its
+ * measured usage plus @p reserve bytes and returns the memory cut off.
+ *
+ * @warning     This is a debugging aid to find the right stack sizes. If the
+ *              thread uses more stack than it did up to this call (plus
+ *              @p reserve), it will overwrite the returned memory.
+ *
+ * @pre         The thread was created with the flag `THREAD_CREATE_STACKTEST`.
+ *
+ * @param[in,out] thread    The thread to take the stack memory from
+ * @param[in]     reserve   Number of unused bytes to keep on the stack
+ * @param[out]    size      Size of the returned memory in bytes
+ *
+ * @return              start of the reclaimed memory
+ * @return              NULL if there is no memory to reclaim
+ */
+void *thread_stack_reclaim(thread_t *thread, size_t reserve, size_t *size);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
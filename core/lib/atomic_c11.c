@@ -27,6 +27,11 @@
  *
  * @note This implementation completely ignores the memory model parameter
  *
+ * If the compiler provides lock-free 32 bit atomics, but not 8 and 16 bit
+ * ones (e.g. RISC-V with the A extension), the 8 and 16 bit operations are
+ * implemented lock-free using compare-and-swap on the aligned 32 bit word
+ * containing the object, so they remain atomic without disabling IRQs.
+ *
  * @see https://gcc.gnu.org/wiki/Atomic/GCCMM/LIbrary
  * @see https://gcc.gnu.org/onlinedocs/gcc/_005f_005fatomic-Builtins.html
  *
@@ -176,84 +181,289 @@ typedef uint64_t I8;
         return tmp;                                            \
     }
 
-/* Template instantiations below */
+#if (__GCC_ATOMIC_INT_LOCK_FREE == 2) && (__SIZEOF_INT__ == 4)
+/**
+ * @brief   Implement 8 and 16 bit atomics using 32 bit compare-and-swap,
+ *          which the compiler provides lock-free
+ */
+#define ATOMIC_SUBWORD_CAS  1
+#else
+#define ATOMIC_SUBWORD_CAS  0
+#endif
+
+#if ATOMIC_SUBWORD_CAS
+/**
+ * @brief Get the aligned word containing the @p n byte object at @p ptr
+ *
+ * @param[in]  ptr       address of the object
+ * @param[in]  n         width of the object, in bytes
+ * @param[out] shift     position of the object in the word, in bits
+ *
+ * @return the address of the word
+ */
+static inline volatile I4 *_subword(volatile void *ptr, unsigned n,
+                                    unsigned *shift)
+{
+    uintptr_t addr = (uintptr_t)ptr;
+    unsigned offset = addr & (sizeof(I4) - 1);
+
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    (void)n;
+    *shift = offset * 8;
+#else
+    *shift = (sizeof(I4) - n - offset) * 8;
+#endif
+    return (volatile I4 *)(addr - offset);
+}
+
+/**
+ * @brief Atomically replace the @p n byte object at @p ptr by @p newval,
+ *        evaluated with its current value in @p old, using 32 bit CAS
+ */
+#define SUBWORD_RMW(n, ptr, old, newval) \
+    unsigned shift; \
+    volatile I4 *word = _subword(ptr, n, &shift); \
+    const I4 wmask = (I4)((1ULL << (8 * n)) - 1) << shift; \
+    I4 cur = *word; \
+    I##n old; \
+    do { \
+        old = (I##n)((cur & wmask) >> shift); \
+    } while (!__atomic_compare_exchange_n(word, &cur, \
+                 (cur & ~wmask) | (((I4)(I##n)(newval) << shift) & wmask), \
+                 true, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+
+/**
+ * @brief Lock-free version of @ref TEMPLATE_ATOMIC_LOAD_N for 8 and 16 bit
+ *
+ * Aligned loads of up to 32 bit are atomic, only ordering is needed.
+ */
+#define TEMPLATE_ATOMIC_LOAD_SUBWORD_N(n) \
+    I##n __atomic_load_##n (const volatile void *ptr, int memorder) \
+    { \
+        (void) memorder;                           \
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);   \
+        I##n val = *(const volatile I##n *)ptr;    \
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);   \
+        return val;                                \
+    }
+
+/**
+ * @brief Lock-free version of @ref TEMPLATE_ATOMIC_STORE_N for 8 and 16 bit
+ */
+#define TEMPLATE_ATOMIC_STORE_SUBWORD_N(n) \
+    void __atomic_store_##n (volatile void *ptr, I##n val, int memorder) \
+    { \
+        (void) memorder;                           \
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);   \
+        *(volatile I##n *)ptr = val;               \
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);   \
+    }
+
+/**
+ * @brief Lock-free version of @ref TEMPLATE_ATOMIC_EXCHANGE_N for 8 and 16 bit
+ */
+#define TEMPLATE_ATOMIC_EXCHANGE_SUBWORD_N(n) \
+    I##n __atomic_exchange_##n (volatile void *ptr, I##n desired, int memorder) \
+    { \
+        (void) memorder;                           \
+        SUBWORD_RMW(n, ptr, old, desired);         \
+        return old;                                \
+    }
+
+/**
+ * @brief Lock-free version of @ref TEMPLATE_ATOMIC_COMPARE_EXCHANGE_N for 8
+ *        and 16 bit
+ */
+#define TEMPLATE_ATOMIC_COMPARE_EXCHANGE_SUBWORD_N(n) \
+    bool __atomic_compare_exchange_##n (volatile void *ptr, void *expected, I##n desired, \
+        bool weak, int success_memorder, int failure_memorder) \
+    { \
+        (void) weak;                               \
+        (void) success_memorder;                   \
+        (void) failure_memorder;                   \
+        unsigned shift;                            \
+        volatile I4 *word = _subword(ptr, n, &shift); \
+        const I4 wmask = (I4)((1ULL << (8 * n)) - 1) << shift; \
+        I4 cur = *word;                            \
+        do {                                       \
+            I##n old = (I##n)((cur & wmask) >> shift); \
+            if (old != *(I##n *)expected) {        \
+                *(I##n *)expected = old;           \
+                return false;                      \
+            }                                      \
+        } while (!__atomic_compare_exchange_n(word, &cur, \
+                     (cur & ~wmask) | ((I4)desired << shift), \
+                     true, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)); \
+        return true;                               \
+    }
+
+/**
+ * @brief Lock-free version of @ref TEMPLATE_ATOMIC_FETCH_OP_N for 8 and 16 bit
+ */
+#define TEMPLATE_ATOMIC_FETCH_OP_SUBWORD_N(opname, op, n, prefixop) \
+    I##n __atomic_fetch_##opname##_##n(volatile void *ptr, I##n val, int memmodel) \
+    { \
+        (void)memmodel;                                \
+        SUBWORD_RMW(n, ptr, old, prefixop(old op val)); \
+        return old;                                    \
+    }
+
+/**
+ * @brief Lock-free version of @ref TEMPLATE_ATOMIC_OP_FETCH_N for 8 and 16 bit
+ */
+#define TEMPLATE_ATOMIC_OP_FETCH_SUBWORD_N(opname, op, n, prefixop) \
+    I##n __atomic_##opname##_fetch_##n(volatile void *ptr, I##n val, int memmodel) \
+    { \
+        (void)memmodel;                                \
+        SUBWORD_RMW(n, ptr, old, prefixop(old op val)); \
+        return (I##n)prefixop(old op val);             \
+    }
+
+/* Template instantiations below, 8 and 16 bit lock-free */
+TEMPLATE_ATOMIC_LOAD_SUBWORD_N(1)                 /* __atomic_load_1 */
+TEMPLATE_ATOMIC_LOAD_SUBWORD_N(2)                 /* __atomic_load_2 */
+TEMPLATE_ATOMIC_STORE_SUBWORD_N(1)                /* __atomic_store_1 */
+TEMPLATE_ATOMIC_STORE_SUBWORD_N(2)                /* __atomic_store_2 */
+TEMPLATE_ATOMIC_EXCHANGE_SUBWORD_N(1)             /* __atomic_exchange_1 */
+TEMPLATE_ATOMIC_EXCHANGE_SUBWORD_N(2)             /* __atomic_exchange_2 */
+TEMPLATE_ATOMIC_COMPARE_EXCHANGE_SUBWORD_N(1)     /* __atomic_compare_exchange_1 */
+TEMPLATE_ATOMIC_COMPARE_EXCHANGE_SUBWORD_N(2)     /* __atomic_compare_exchange_2 */
+TEMPLATE_ATOMIC_FETCH_OP_SUBWORD_N( add, +, 1,  ) /* __atomic_fetch_add_1 */
+TEMPLATE_ATOMIC_FETCH_OP_SUBWORD_N( add, +, 2,  ) /* __atomic_fetch_add_2 */
+TEMPLATE_ATOMIC_FETCH_OP_SUBWORD_N( sub, -, 1,  ) /* __atomic_fetch_sub_1 */
+TEMPLATE_ATOMIC_FETCH_OP_SUBWORD_N( sub, -, 2,  ) /* __atomic_fetch_sub_2 */
+TEMPLATE_ATOMIC_FETCH_OP_SUBWORD_N( and, &, 1,  ) /* __atomic_fetch_and_1 */
+TEMPLATE_ATOMIC_FETCH_OP_SUBWORD_N( and, &, 2,  ) /* __atomic_fetch_and_2 */
+TEMPLATE_ATOMIC_FETCH_OP_SUBWORD_N(  or, |, 1,  ) /* __atomic_fetch_or_1 */
+TEMPLATE_ATOMIC_FETCH_OP_SUBWORD_N(  or, |, 2,  ) /* __atomic_fetch_or_2 */
+TEMPLATE_ATOMIC_FETCH_OP_SUBWORD_N( xor, ^, 1,  ) /* __atomic_fetch_xor_1 */
+TEMPLATE_ATOMIC_FETCH_OP_SUBWORD_N( xor, ^, 2,  ) /* __atomic_fetch_xor_2 */
+TEMPLATE_ATOMIC_FETCH_OP_SUBWORD_N(nand, &, 1, ~) /* __atomic_fetch_nand_1 */
+TEMPLATE_ATOMIC_FETCH_OP_SUBWORD_N(nand, &, 2, ~) /* __atomic_fetch_nand_2 */
+TEMPLATE_ATOMIC_OP_FETCH_SUBWORD_N( add, +, 1,  ) /* __atomic_add_fetch_1 */
+TEMPLATE_ATOMIC_OP_FETCH_SUBWORD_N( add, +, 2,  ) /* __atomic_add_fetch_2 */
+TEMPLATE_ATOMIC_OP_FETCH_SUBWORD_N( sub, -, 1,  ) /* __atomic_sub_fetch_1 */
+TEMPLATE_ATOMIC_OP_FETCH_SUBWORD_N( sub, -, 2,  ) /* __atomic_sub_fetch_2 */
+TEMPLATE_ATOMIC_OP_FETCH_SUBWORD_N( and, &, 1,  ) /* __atomic_and_fetch_1 */
+TEMPLATE_ATOMIC_OP_FETCH_SUBWORD_N( and, &, 2,  ) /* __atomic_and_fetch_2 */
+TEMPLATE_ATOMIC_OP_FETCH_SUBWORD_N(  or, |, 1,  ) /* __atomic_or_fetch_1 */
+TEMPLATE_ATOMIC_OP_FETCH_SUBWORD_N(  or, |, 2,  ) /* __atomic_or_fetch_2 */
+TEMPLATE_ATOMIC_OP_FETCH_SUBWORD_N( xor, ^, 1,  ) /* __atomic_xor_fetch_1 */
+TEMPLATE_ATOMIC_OP_FETCH_SUBWORD_N( xor, ^, 2,  ) /* __atomic_xor_fetch_2 */
+TEMPLATE_ATOMIC_OP_FETCH_SUBWORD_N(nand, &, 1, ~) /* __atomic_nand_fetch_1 */
+TEMPLATE_ATOMIC_OP_FETCH_SUBWORD_N(nand, &, 2, ~) /* __atomic_nand_fetch_2 */
+#endif /* ATOMIC_SUBWORD_CAS */
+
+/* Template instantiations below, 8 and 16 bit ones only if not lock-free */
+#if !ATOMIC_SUBWORD_CAS
 TEMPLATE_ATOMIC_LOAD_N(1)                 /* __atomic_load_1 */
 TEMPLATE_ATOMIC_LOAD_N(2)                 /* __atomic_load_2 */
+#endif
 TEMPLATE_ATOMIC_LOAD_N(4)                 /* __atomic_load_4 */
 TEMPLATE_ATOMIC_LOAD_N(8)                 /* __atomic_load_8 */
 
+#if !ATOMIC_SUBWORD_CAS
 TEMPLATE_ATOMIC_STORE_N(1)                /* __atomic_store_1 */
 TEMPLATE_ATOMIC_STORE_N(2)                /* __atomic_store_2 */
+#endif
 TEMPLATE_ATOMIC_STORE_N(4)                /* __atomic_store_4 */
 TEMPLATE_ATOMIC_STORE_N(8)                /* __atomic_store_8 */
 
+#if !ATOMIC_SUBWORD_CAS
 TEMPLATE_ATOMIC_EXCHANGE_N(1)             /* __atomic_exchange_1 */
 TEMPLATE_ATOMIC_EXCHANGE_N(2)             /* __atomic_exchange_2 */
+#endif
 TEMPLATE_ATOMIC_EXCHANGE_N(4)             /* __atomic_exchange_4 */
 TEMPLATE_ATOMIC_EXCHANGE_N(8)             /* __atomic_exchange_8 */
 
+#if !ATOMIC_SUBWORD_CAS
 TEMPLATE_ATOMIC_COMPARE_EXCHANGE_N(1)     /* __atomic_compare_exchange_1 */
 TEMPLATE_ATOMIC_COMPARE_EXCHANGE_N(2)     /* __atomic_compare_exchange_2 */
+#endif
 TEMPLATE_ATOMIC_COMPARE_EXCHANGE_N(4)     /* __atomic_compare_exchange_4 */
 TEMPLATE_ATOMIC_COMPARE_EXCHANGE_N(8)     /* __atomic_compare_exchange_8 */
 
+#if !ATOMIC_SUBWORD_CAS
 TEMPLATE_ATOMIC_FETCH_OP_N( add, +, 1,  ) /* __atomic_fetch_add_1 */
 TEMPLATE_ATOMIC_FETCH_OP_N( add, +, 2,  ) /* __atomic_fetch_add_2 */
+#endif
 TEMPLATE_ATOMIC_FETCH_OP_N( add, +, 4,  ) /* __atomic_fetch_add_4 */
 TEMPLATE_ATOMIC_FETCH_OP_N( add, +, 8,  ) /* __atomic_fetch_add_8 */
 
+#if !ATOMIC_SUBWORD_CAS
 TEMPLATE_ATOMIC_FETCH_OP_N( sub, -, 1,  ) /* __atomic_fetch_sub_1 */
 TEMPLATE_ATOMIC_FETCH_OP_N( sub, -, 2,  ) /* __atomic_fetch_sub_2 */
+#endif
 TEMPLATE_ATOMIC_FETCH_OP_N( sub, -, 4,  ) /* __atomic_fetch_sub_4 */
 TEMPLATE_ATOMIC_FETCH_OP_N( sub, -, 8,  ) /* __atomic_fetch_sub_8 */
 
+#if !ATOMIC_SUBWORD_CAS
 TEMPLATE_ATOMIC_FETCH_OP_N( and, &, 1,  ) /* __atomic_fetch_and_1 */
 TEMPLATE_ATOMIC_FETCH_OP_N( and, &, 2,  ) /* __atomic_fetch_and_2 */
+#endif
 TEMPLATE_ATOMIC_FETCH_OP_N( and, &, 4,  ) /* __atomic_fetch_and_4 */
 TEMPLATE_ATOMIC_FETCH_OP_N( and, &, 8,  ) /* __atomic_fetch_and_8 */
 
+#if !ATOMIC_SUBWORD_CAS
 TEMPLATE_ATOMIC_FETCH_OP_N(  or, |, 1,  ) /* __atomic_fetch_or_1 */
 TEMPLATE_ATOMIC_FETCH_OP_N(  or, |, 2,  ) /* __atomic_fetch_or_2 */
+#endif
 TEMPLATE_ATOMIC_FETCH_OP_N(  or, |, 4,  ) /* __atomic_fetch_or_4 */
 TEMPLATE_ATOMIC_FETCH_OP_N(  or, |, 8,  ) /* __atomic_fetch_or_8 */
 
+#if !ATOMIC_SUBWORD_CAS
 TEMPLATE_ATOMIC_FETCH_OP_N( xor, ^, 1,  ) /* __atomic_fetch_xor_1 */
 TEMPLATE_ATOMIC_FETCH_OP_N( xor, ^, 2,  ) /* __atomic_fetch_xor_2 */
+#endif
 TEMPLATE_ATOMIC_FETCH_OP_N( xor, ^, 4,  ) /* __atomic_fetch_xor_4 */
 TEMPLATE_ATOMIC_FETCH_OP_N( xor, ^, 8,  ) /* __atomic_fetch_xor_8 */
 
+#if !ATOMIC_SUBWORD_CAS
 TEMPLATE_ATOMIC_FETCH_OP_N(nand, &, 1, ~) /* __atomic_fetch_nand_1 */
 TEMPLATE_ATOMIC_FETCH_OP_N(nand, &, 2, ~) /* __atomic_fetch_nand_2 */
+#endif
 TEMPLATE_ATOMIC_FETCH_OP_N(nand, &, 4, ~) /* __atomic_fetch_nand_4 */
 TEMPLATE_ATOMIC_FETCH_OP_N(nand, &, 8, ~) /* __atomic_fetch_nand_8 */
 
+#if !ATOMIC_SUBWORD_CAS
 TEMPLATE_ATOMIC_OP_FETCH_N( add, +, 1,  ) /* __atomic_add_fetch_1 */
 TEMPLATE_ATOMIC_OP_FETCH_N( add, +, 2,  ) /* __atomic_add_fetch_2 */
+#endif
 TEMPLATE_ATOMIC_OP_FETCH_N( add, +, 4,  ) /* __atomic_add_fetch_4 */
 TEMPLATE_ATOMIC_OP_FETCH_N( add, +, 8,  ) /* __atomic_add_fetch_8 */
 
+#if !ATOMIC_SUBWORD_CAS
 TEMPLATE_ATOMIC_OP_FETCH_N( sub, -, 1,  ) /* __atomic_sub_fetch_1 */
 TEMPLATE_ATOMIC_OP_FETCH_N( sub, -, 2,  ) /* __atomic_sub_fetch_2 */
+#endif
 TEMPLATE_ATOMIC_OP_FETCH_N( sub, -, 4,  ) /* __atomic_sub_fetch_4 */
 TEMPLATE_ATOMIC_OP_FETCH_N( sub, -, 8,  ) /* __atomic_sub_fetch_8 */
 
+#if !ATOMIC_SUBWORD_CAS
 TEMPLATE_ATOMIC_OP_FETCH_N( and, &, 1,  ) /* __atomic_and_fetch_1 */
 TEMPLATE_ATOMIC_OP_FETCH_N( and, &, 2,  ) /* __atomic_and_fetch_2 */
+#endif
 TEMPLATE_ATOMIC_OP_FETCH_N( and, &, 4,  ) /* __atomic_and_fetch_4 */
 TEMPLATE_ATOMIC_OP_FETCH_N( and, &, 8,  ) /* __atomic_and_fetch_8 */
 
+#if !ATOMIC_SUBWORD_CAS
 TEMPLATE_ATOMIC_OP_FETCH_N(  or, |, 1,  ) /* __atomic_or_fetch_1 */
 TEMPLATE_ATOMIC_OP_FETCH_N(  or, |, 2,  ) /* __atomic_or_fetch_2 */
+#endif
 TEMPLATE_ATOMIC_OP_FETCH_N(  or, |, 4,  ) /* __atomic_or_fetch_4 */
 TEMPLATE_ATOMIC_OP_FETCH_N(  or, |, 8,  ) /* __atomic_or_fetch_8 */
 
+#if !ATOMIC_SUBWORD_CAS
 TEMPLATE_ATOMIC_OP_FETCH_N( xor, ^, 1,  ) /* __atomic_xor_fetch_1 */
 TEMPLATE_ATOMIC_OP_FETCH_N( xor, ^, 2,  ) /* __atomic_xor_fetch_2 */
+#endif
 TEMPLATE_ATOMIC_OP_FETCH_N( xor, ^, 4,  ) /* __atomic_xor_fetch_4 */
 TEMPLATE_ATOMIC_OP_FETCH_N( xor, ^, 8,  ) /* __atomic_xor_fetch_8 */
 
+#if !ATOMIC_SUBWORD_CAS
 TEMPLATE_ATOMIC_OP_FETCH_N(nand, &, 1, ~) /* __atomic_nand_fetch_1 */
 TEMPLATE_ATOMIC_OP_FETCH_N(nand, &, 2, ~) /* __atomic_nand_fetch_2 */
+#endif
 TEMPLATE_ATOMIC_OP_FETCH_N(nand, &, 4, ~) /* __atomic_nand_fetch_4 */
 TEMPLATE_ATOMIC_OP_FETCH_N(nand, &, 8, ~) /* __atomic_nand_fetch_8 */
 
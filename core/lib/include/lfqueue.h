@@ -0,0 +1,176 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     core_util
+ * @{
+ *
+ * @file
+ * @brief       Lock-free single/multi-producer single-consumer queue
+ *
+ * @details     A bounded FIFO of fixed size elements that can be filled from
+ *              ISRs and drained by a thread (or vice versa) without disabling
+ *              interrupts.
+ *
+ * The queue comes in two flavors that share the same API:
+ *
+ * - **SPSC** (single producer, single consumer), created with
+ *   @ref LFQUEUE_INIT: Producer and consumer only use atomic loads and stores
+ *   of the 32 bit positions, so neither side ever masks interrupts on
+ *   platforms with lock-free 32 bit loads and stores.
+ * - **MPSC** (multiple producers, single consumer), created with
+ *   @ref LFQUEUE_MP_INIT: Producers reserve slots with an atomic
+ *   compare-and-swap and publish each slot with a per-slot sequence number.
+ *   The consumer only sees fully written elements in FIFO order. On platforms
+ *   without a compare-and-swap instruction, the compiler falls back to the
+ *   implementation in `atomic_c11.c`, which disables interrupts for the
+ *   duration of the swap only.
+ *
+ * Producers and the consumer can run in any context. A producer preempted
+ * between reservation and publication of a slot delays the consumer until it
+ * resumes, so the consumer should not busy-wait on a queue that may be filled
+ * from lower priority contexts.
+ *
+ * The element size is determined from the buffer type at compile time:
+ *
+ * ```c
+ * static adc_sample_t samples_buf[64];
+ * static lfqueue_t samples = LFQUEUE_INIT(samples_buf);
+ *
+ * void adc_isr(void) {
+ *     adc_sample_t s = read_sample();
+ *     lfqueue_put(&samples, &s, 1);
+ * }
+ *
+ * void *worker(void *arg) {
+ *     adc_sample_t batch[16];
+ *     unsigned n = lfqueue_get(&samples, batch, ARRAY_SIZE(batch));
+ *     ...
+ * }
+ * ```
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ */
+
+#ifndef LFQUEUE_H
+#define LFQUEUE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "container.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Lock-free queue
+ */
+typedef struct {
+    uint8_t *buf;           /**< element storage */
+    uint32_t *seq;          /**< per-slot sequence numbers, NULL for SPSC */
+    uint16_t elem_size;     /**< size of a single element in bytes */
+    uint16_t mask;          /**< number of slots - 1 */
+    uint32_t head;          /**< position of the next element to write */
+    uint32_t tail;          /**< position of the next element to read */
+} lfqueue_t;
+
+/**
+ * @brief   Static initializer for a single producer queue
+ *
+ * @param[in]   BUF     array of elements used as storage, the number of
+ *                      elements must be a power of two and at most 2^15
+ */
+#define LFQUEUE_INIT(BUF) \
+    { (uint8_t *)(BUF), NULL, sizeof((BUF)[0]), ARRAY_SIZE(BUF) - 1, 0, 0 }
+
+/**
+ * @brief   Static initializer for a multi producer queue
+ *
+ * @param[in]   BUF     array of elements used as storage, the number of
+ *                      elements must be a power of two and at most 2^15
+ * @param[in]   SEQ     zero initialized `uint32_t` array with one entry per
+ *                      element of @p BUF
+ */
+#define LFQUEUE_MP_INIT(BUF, SEQ) \
+    { (uint8_t *)(BUF), (SEQ), sizeof((BUF)[0]), ARRAY_SIZE(BUF) - 1, 0, 0 }
+
+/**
+ * @brief   Initialize a queue
+ *
+ * @pre     @p capacity is a power of two and at most 2^15
+ *
+ * @param[out]  q           queue to initialize
+ * @param[in]   buf         storage for @p capacity elements
+ * @param[in]   seq         zero initialized array of @p capacity sequence
+ *                          numbers for a multi producer queue, or NULL for a
+ *                          single producer queue
+ * @param[in]   elem_size   size of a single element in bytes
+ * @param[in]   capacity    number of elements @p buf can hold
+ */
+void lfqueue_init(lfqueue_t *q, void *buf, uint32_t *seq, size_t elem_size,
+                  unsigned capacity);
+
+/**
+ * @brief   Append up to @p n elements to the queue
+ *
+ * Only as many elements are added as there are free slots. A batch is
+ * appended contiguously, elements of other producers are not interleaved.
+ *
+ * @param[in,out]   q       queue to operate on
+ * @param[in]       elems   array of @p n elements to add
+ * @param[in]       n       number of elements to add
+ *
+ * @return  number of elements added
+ */
+unsigned lfqueue_put(lfqueue_t *q, const void *elems, unsigned n);
+
+/**
+ * @brief   Remove up to @p n elements from the queue
+ *
+ * Must only be called from a single consumer context.
+ *
+ * @param[in,out]   q       queue to operate on
+ * @param[out]      elems   array with room for @p n elements
+ * @param[in]       n       maximum number of elements to remove
+ *
+ * @return  number of elements removed
+ */
+unsigned lfqueue_get(lfqueue_t *q, void *elems, unsigned n);
+
+/**
+ * @brief   Get the number of elements that have been added but not removed
+ *
+ * For a multi producer queue this includes elements that are still being
+ * written. The value may be outdated by the time it is returned.
+ *
+ * @param[in]   q       queue to operate on
+ *
+ * @return  number of queued elements
+ */
+unsigned lfqueue_avail(const lfqueue_t *q);
+
+/**
+ * @brief   Get the number of slots of a queue
+ *
+ * @param[in]   q       queue to operate on
+ *
+ * @return  capacity of the queue in elements
+ */
+static inline unsigned lfqueue_capacity(const lfqueue_t *q)
+{
+    return q->mask + 1U;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LFQUEUE_H */
+/** @} */
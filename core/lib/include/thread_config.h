@@ -115,6 +115,29 @@ extern "C" {
 #define THREAD_STACKSIZE_MINIMUM  (sizeof(thread_t))
 #endif
 
+/**
+ * @brief   Distance between stack usage markers in words
+ *
+ * When stack usage measurement is enabled, thread_create() writes a marker
+ * into every `CONFIG_THREAD_STACKTEST_STRIDE`-th word of the stack. Values
+ * greater than 1 reduce the cost of creating threads with big stacks, but
+ * thread_measure_stack_free() then underestimates the free stack by up to
+ * `CONFIG_THREAD_STACKTEST_STRIDE - 1` words.
+ */
+#ifndef CONFIG_THREAD_STACKTEST_STRIDE
+#define CONFIG_THREAD_STACKTEST_STRIDE  1
+#endif
+
+/**
+ * @brief   Distance between the markers checked by
+ *          thread_measure_stack_free_fast() in words
+ *
+ * Must be a multiple of @ref CONFIG_THREAD_STACKTEST_STRIDE.
+ */
+#ifndef CONFIG_THREAD_STACKTEST_FAST_STRIDE
+#define CONFIG_THREAD_STACKTEST_FAST_STRIDE (8 * CONFIG_THREAD_STACKTEST_STRIDE)
+#endif
+
 /**
  * @def THREAD_PRIORITY_MIN
  * @brief Least priority a thread can have
@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     core_util
+ * @{
+ *
+ * @file
+ * @brief       Lock-free single/multi-producer single-consumer queue
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "assert.h"
+#include "atomic_utils.h"
+#include "lfqueue.h"
+
+void lfqueue_init(lfqueue_t *q, void *buf, uint32_t *seq, size_t elem_size,
+                  unsigned capacity)
+{
+    /* check if capacity is a power of 2 by comparing it to its complement */
+    assert(capacity && (capacity <= 0x8000) && !(capacity & (capacity - 1)));
+    assert(elem_size && (elem_size <= UINT16_MAX));
+
+    q->buf = buf;
+    q->seq = seq;
+    q->elem_size = elem_size;
+    q->mask = capacity - 1;
+    q->head = 0;
+    q->tail = 0;
+}
+
+static void _copy_in(lfqueue_t *q, uint32_t pos, const void *elems, unsigned n)
+{
+    const uint8_t *src = elems;
+
+    for (unsigned i = 0; i < n; i++) {
+        memcpy(&q->buf[((pos + i) & q->mask) * q->elem_size],
+               &src[i * q->elem_size], q->elem_size);
+    }
+}
+
+static void _copy_out(lfqueue_t *q, uint32_t pos, void *elems, unsigned n)
+{
+    uint8_t *dst = elems;
+
+    for (unsigned i = 0; i < n; i++) {
+        memcpy(&dst[i * q->elem_size],
+               &q->buf[((pos + i) & q->mask) * q->elem_size], q->elem_size);
+    }
+}
+
+static unsigned _free_slots(lfqueue_t *q, uint32_t head, unsigned n)
+{
+    unsigned free = lfqueue_capacity(q) - (head - atomic_load_u32(&q->tail));
+
+    return (n < free) ? n : free;
+}
+
+unsigned lfqueue_put(lfqueue_t *q, const void *elems, unsigned n)
+{
+    uint32_t head = atomic_load_u32(&q->head);
+
+    if (!q->seq) {
+        /* single producer: nobody else writes head */
+        n = _free_slots(q, head, n);
+        _copy_in(q, head, elems, n);
+        atomic_store_u32(&q->head, head + n);
+        return n;
+    }
+
+    /* multiple producers: reserve n slots by advancing head. A stale head
+     * (or tail) makes the compare-and-swap fail, so the free slot count is
+     * always checked against the head that is actually replaced. */
+    do {
+        n = _free_slots(q, head, n);
+        if (n == 0) {
+            return 0;
+        }
+    } while (!__atomic_compare_exchange_n(&q->head, &head, head + n, true,
+                                          __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST));
+
+    _copy_in(q, head, elems, n);
+
+    /* publish the slots: a slot at position pos is readable once its sequence
+     * number is pos + 1 */
+    for (unsigned i = 0; i < n; i++) {
+        atomic_store_u32(&q->seq[(head + i) & q->mask], head + i + 1);
+    }
+
+    return n;
+}
+
+unsigned lfqueue_get(lfqueue_t *q, void *elems, unsigned n)
+{
+    uint32_t tail = q->tail;
+    unsigned avail;
+
+    if (!q->seq) {
+        avail = atomic_load_u32(&q->head) - tail;
+    }
+    else {
+        /* only hand out elements that have been published, in order */
+        avail = 0;
+        while ((avail < n) &&
+               (atomic_load_u32(&q->seq[(tail + avail) & q->mask])
+                == tail + avail + 1)) {
+            avail++;
+        }
+    }
+
+    if (n > avail) {
+        n = avail;
+    }
+
+    _copy_out(q, tail, elems, n);
+    /* the slots are free for the producers only after they have been read */
+    atomic_store_u32(&q->tail, tail + n);
+
+    return n;
+}
+
+unsigned lfqueue_avail(const lfqueue_t *q)
+{
+    uint32_t tail = atomic_load_u32(&q->tail);
+
+    return atomic_load_u32(&q->head) - tail;
+}
@@ -36,6 +36,15 @@ static int _lock(rmutex_t *rmutex, int trylock)
 {
     kernel_pid_t owner;
 
+    /* Fast path for relocking: Only the current thread ever sets the owner
+     * to its own pid, so if it reads its pid here, it holds the mutex and
+     * can increment the refcount without touching the mutex. */
+    if (atomic_load_kernel_pid(&rmutex->owner) == thread_getpid()) {
+        DEBUG("rmutex %" PRIi16 " : relock\n", thread_getpid());
+        rmutex->refcount++;
+        return 1;
+    }
+
     /* try to lock the mutex */
     DEBUG("rmutex %" PRIi16 " : trylock\n", thread_getpid());
     if (mutex_trylock(&rmutex->mutex) == 0) {
@@ -33,10 +33,20 @@
 #endif
 #include "irq.h"
 #include "cib.h"
+#include "trace.h"
+#if IS_USED(MODULE_LOCKSTATS)
+#include "lockstats.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+static inline void _trace(trace_event_t event, const msg_t *m,
+                          kernel_pid_t pid)
+{
+    trace_event(event, ((uint32_t)m->type << 8) | (uint8_t)pid);
+}
+
 static int _msg_receive(msg_t *m, int block);
 static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block,
                      unsigned state);
@@ -48,6 +58,12 @@ static int queue_msg(thread_t *target, const msg_t *m)
     if (n < 0) {
         DEBUG("queue_msg(): message queue of thread %" PRIkernel_pid
               " is full (or there is none)\n", target->pid);
+        if (thread_has_msg_queue(target)) {
+            _trace(TRACE_EVENT_MSG_QUEUE_FULL, m, target->pid);
+#if IS_USED(MODULE_LOCKSTATS)
+            lockstats_msg_queue_full(target);
+#endif
+        }
         return 0;
     }
 
@@ -55,6 +71,9 @@ static int queue_msg(thread_t *target, const msg_t *m)
     msg_t *dest = &target->msg_array[n];
 
     *dest = *m;
+#if IS_USED(MODULE_LOCKSTATS)
+    lockstats_msg_queued(target);
+#endif
 #if MODULE_CORE_THREAD_FLAGS
     target->flags |= THREAD_FLAG_MSG_WAITING;
     thread_flags_wake(target);
@@ -103,6 +122,8 @@ static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block,
         return -1;
     }
 
+    _trace(TRACE_EVENT_MSG_SEND, m, target_pid);
+
     thread_t *me = thread_get_active();
 
     DEBUG("msg_send() %s:%i: Sending from %" PRIkernel_pid " to %" PRIkernel_pid
@@ -207,6 +228,8 @@ static int _msg_send_oneway(msg_t *m, kernel_pid_t target_pid)
         return -1;
     }
 
+    _trace(TRACE_EVENT_MSG_SEND, m, target_pid);
+
     if (target->status == STATUS_RECEIVE_BLOCKED) {
         DEBUG("%s: Direct msg copy from %" PRIkernel_pid " to %"
               PRIkernel_pid ".\n", __func__, thread_getpid(), target_pid);
@@ -272,6 +295,64 @@ int msg_send_bus(msg_t *m, msg_bus_t *bus)
     return count;
 }
 
+int msg_send_batch(msg_t *m, unsigned num, kernel_pid_t target_pid)
+{
+    const bool in_irq = irq_is_in();
+    const kernel_pid_t sender_pid = in_irq ? KERNEL_PID_ISR : thread_getpid();
+    unsigned n = 0;
+    bool woken = false;
+
+    unsigned state = irq_disable();
+    thread_t *target = thread_get_unchecked(target_pid);
+
+    if (target == NULL) {
+        DEBUG("%s: target thread %d does not exist\n", __func__, target_pid);
+        irq_restore(state);
+        return -1;
+    }
+
+    if ((num > 0) && (target->status == STATUS_RECEIVE_BLOCKED)) {
+        DEBUG("%s: Direct msg copy from %" PRIkernel_pid " to %"
+              PRIkernel_pid ".\n", __func__, sender_pid, target_pid);
+        m[0].sender_pid = sender_pid;
+        *((msg_t *)target->wait_data) = m[0];
+        sched_set_status(target, STATUS_PENDING);
+        woken = true;
+        n = 1;
+    }
+
+    const unsigned direct = n;
+    int idx;
+
+    while ((n < num) && ((idx = cib_put(&target->msg_queue)) >= 0)) {
+        m[n].sender_pid = sender_pid;
+        target->msg_array[idx] = m[n];
+        n++;
+    }
+
+    DEBUG("%s: queued %u of %u messages for %" PRIkernel_pid "\n", __func__,
+          n - direct, num, target_pid);
+
+#if MODULE_CORE_THREAD_FLAGS
+    if (n > direct) {
+        target->flags |= THREAD_FLAG_MSG_WAITING;
+        woken |= thread_flags_wake(target);
+    }
+#endif
+
+    if (woken && in_irq) {
+        sched_context_switch_request = 1;
+    }
+
+    irq_restore(state);
+
+    if (woken && !in_irq) {
+        thread_yield_higher();
+    }
+
+    return n;
+}
+
 int msg_send_receive(msg_t *m, msg_t *reply, kernel_pid_t target_pid)
 {
     assert(thread_getpid() != target_pid);
@@ -343,12 +424,60 @@ int msg_reply_int(msg_t *m, msg_t *reply)
 
 int msg_try_receive(msg_t *m)
 {
-    return _msg_receive(m, 0);
+    int res = _msg_receive(m, 0);
+
+    if (res > 0) {
+        _trace(TRACE_EVENT_MSG_RECV, m, m->sender_pid);
+    }
+    return res;
 }
 
 int msg_receive(msg_t *m)
 {
-    return _msg_receive(m, 1);
+    int res = _msg_receive(m, 1);
+
+    _trace(TRACE_EVENT_MSG_RECV, m, m->sender_pid);
+    return res;
+}
+
+static unsigned _msg_receive_queued(thread_t *me, msg_t *m, unsigned num)
+{
+    unsigned n = 0;
+    int idx;
+
+    /* leave it to _msg_receive() to refill the queue from blocked senders */
+    if (me->msg_waiters.next) {
+        return 0;
+    }
+
+    while ((n < num) && ((idx = cib_get(&me->msg_queue)) >= 0)) {
+        m[n++] = me->msg_array[idx];
+    }
+
+    return n;
+}
+
+int msg_receive_batch(msg_t *m, unsigned num)
+{
+    assert(num > 0);
+
+    thread_t *me = thread_get_active();
+    unsigned state = irq_disable();
+    unsigned n = _msg_receive_queued(me, m, num);
+
+    irq_restore(state);
+
+    if (n == 0) {
+        _msg_receive(m, 1);
+        state = irq_disable();
+        n = 1 + _msg_receive_queued(me, &m[1], num - 1);
+        irq_restore(state);
+    }
+
+    DEBUG("msg_receive_batch: %" PRIkernel_pid ": got %u messages\n",
+          me->pid, n);
+
+    return n;
 }
 
 static int _msg_receive(msg_t *m, int block)
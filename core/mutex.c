@@ -30,12 +30,150 @@
 #include "sched.h"
 #include "irq.h"
 #include "list.h"
+#include "trace.h"
+#if IS_USED(MODULE_LOCKSTATS)
+#include "lockstats.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
 #if MAXTHREADS > 1
 
+/* The fast path cannot update the owner, so it is not used when one is
+ * tracked. Without a native compare-and-swap, the compiler would emit a
+ * library call that disables IRQs anyway. */
+#if CONFIG_CORE_MUTEX_CAS_FAST_PATH && (__GCC_ATOMIC_POINTER_LOCK_FREE == 2) \
+    && !IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) \
+    && !IS_USED(MODULE_CORE_MUTEX_DEBUG) && !IS_USED(MODULE_LOCKSTATS)
+#define MUTEX_CAS_FAST_PATH
+
+/**
+ * @brief   Atomically replace the state of @p mutex with @p desired, if it
+ *          is @p expected
+ */
+static inline bool _mutex_cas(mutex_t *mutex, list_node_t *expected,
+                              list_node_t *desired)
+{
+    return __atomic_compare_exchange_n(&mutex->queue.next, &expected, desired,
+                                       false, __ATOMIC_SEQ_CST,
+                                       __ATOMIC_SEQ_CST);
+}
+#endif
+
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+/**
+ * @brief   Record @p owner as the new owner of @p mutex
+ * @pre     IRQs are disabled
+ */
+static inline void _pi_acquire(mutex_t *mutex, thread_t *owner)
+{
+    mutex->owner = owner->pid;
+    mutex->owner_original_priority = owner->priority;
+    list_add(&owner->mutexes_held, &mutex->owner_held);
+}
+
+/**
+ * @brief   Get the priority @p owner had before locking any mutex
+ * @pre     IRQs are disabled
+ */
+static uint8_t _pi_base_priority(thread_t *owner)
+{
+    list_node_t *node = owner->mutexes_held.next;
+
+    if (node == NULL) {
+        return owner->priority;
+    }
+
+    /* the mutex locked first is the last in the list */
+    while (node->next) {
+        node = node->next;
+    }
+
+    return container_of(node, mutex_t, owner_held)->owner_original_priority;
+}
+
+/**
+ * @brief   Lower the priority of @p owner to the highest priority of all
+ *          threads blocked on mutexes it still holds, or to @p base
+ * @pre     IRQs are disabled
+ */
+static void _pi_restore(thread_t *owner, uint8_t base)
+{
+    uint8_t prio = base;
+
+    for (list_node_t *n = owner->mutexes_held.next; n; n = n->next) {
+        mutex_t *held = container_of(n, mutex_t, owner_held);
+
+        if ((held->queue.next != NULL) && (held->queue.next != MUTEX_LOCKED)) {
+            /* wait queue is sorted, the head has the highest priority */
+            thread_t *waiter = container_of((clist_node_t *)held->queue.next,
+                                            thread_t, rq_entry);
+            if (waiter->priority < prio) {
+                prio = waiter->priority;
+            }
+        }
+    }
+
+    if (owner->priority != prio) {
+        DEBUG("PID[%" PRIkernel_pid "] prio %u --> %u\n",
+              owner->pid, (unsigned)owner->priority, (unsigned)prio);
+        sched_change_priority(owner, prio);
+    }
+}
+
+/**
+ * @brief   Drop ownership of @p mutex and pass it on to @p next, if any
+ * @pre     IRQs are disabled
+ */
+static void _pi_release(mutex_t *mutex, thread_t *next)
+{
+    thread_t *owner = thread_get(mutex->owner);
+
+    if (owner) {
+        uint8_t base = _pi_base_priority(owner);
+        list_remove(&owner->mutexes_held, &mutex->owner_held);
+        _pi_restore(owner, base);
+    }
+
+    if (next) {
+        next->mutex_blocked_on = NULL;
+        _pi_acquire(mutex, next);
+    }
+    else {
+        mutex->owner = KERNEL_PID_UNDEF;
+    }
+}
+
+/**
+ * @brief   Boost the owner of @p mutex to @p prio, following the chain of
+ *          owners blocked on other mutexes
+ * @pre     IRQs are disabled
+ */
+static void _pi_boost(mutex_t *mutex, uint8_t prio)
+{
+    thread_t *owner;
+
+    while ((owner = thread_get(mutex->owner)) && (owner->priority > prio)) {
+        DEBUG("PID[%" PRIkernel_pid "] prio of %" PRIkernel_pid
+              ": %u --> %u\n",
+              thread_getpid(), owner->pid,
+              (unsigned)owner->priority, (unsigned)prio);
+        sched_change_priority(owner, prio);
+
+        if ((owner->status != STATUS_MUTEX_BLOCKED)
+            || (owner->mutex_blocked_on == NULL)) {
+            break;
+        }
+
+        /* keep the wait queue of the next mutex in the chain sorted */
+        mutex = owner->mutex_blocked_on;
+        list_remove(&mutex->queue, (list_node_t *)&owner->rq_entry);
+        thread_add_to_list(&mutex->queue, owner);
+    }
+}
+#endif
+
 /**
  * @brief   Block waiting for a locked mutex
  * @pre     IRQs are disabled
@@ -62,6 +200,8 @@ void _block(mutex_t *mutex,
 #endif
     thread_t *me = thread_get_active();
 
+    trace_event(TRACE_EVENT_MUTEX_WAIT, (uintptr_t)mutex);
+
     /* Fail visibly even if a blocking action is called from somewhere where
      * it's subtly not allowed, eg. board_init */
     assert(me != NULL);
@@ -76,15 +216,9 @@ void _block(mutex_t *mutex,
         thread_add_to_list(&mutex->queue, me);
     }
 
-#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
-    thread_t *owner = thread_get(mutex->owner);
-    if ((owner) && (owner->priority > me->priority)) {
-        DEBUG("PID[%" PRIkernel_pid "] prio of %" PRIkernel_pid
-              ": %u --> %u\n",
-              thread_getpid(), mutex->owner,
-              (unsigned)owner->priority, (unsigned)me->priority);
-        sched_change_priority(owner, me->priority);
-    }
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+    me->mutex_blocked_on = mutex;
+    _pi_boost(mutex, me->priority);
 #endif
 
     irq_restore(irq_state);
@@ -97,6 +231,12 @@ void _block(mutex_t *mutex,
 
 bool mutex_lock_internal(mutex_t *mutex, bool block)
 {
+#ifdef MUTEX_CAS_FAST_PATH
+    if (_mutex_cas(mutex, NULL, MUTEX_LOCKED)) {
+        return true;
+    }
+#endif
+
     uinttxtptr_t pc = 0;
 #if IS_USED(MODULE_CORE_MUTEX_DEBUG)
     pc = cpu_get_caller_pc();
@@ -118,10 +258,13 @@ bool mutex_lock_internal(mutex_t *mutex, bool block)
         mutex->owner_calling_pc = pc;
 #endif
 #if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
-        mutex->owner_original_priority = me->priority;
+        _pi_acquire(mutex, me);
 #endif
         DEBUG("PID[%" PRIkernel_pid "] mutex_lock(): early out.\n",
               thread_getpid());
+#if IS_USED(MODULE_LOCKSTATS)
+        lockstats_mutex_locked(mutex);
+#endif
         irq_restore(irq_state);
     }
     else {
@@ -129,7 +272,14 @@ bool mutex_lock_internal(mutex_t *mutex, bool block)
             irq_restore(irq_state);
             return false;
         }
+#if IS_USED(MODULE_LOCKSTATS)
+        uint32_t since = lockstats_mutex_block(mutex);
+#endif
         _block(mutex, irq_state, pc);
+        trace_event(TRACE_EVENT_MUTEX_ACQUIRE, (uintptr_t)mutex);
+#if IS_USED(MODULE_LOCKSTATS)
+        lockstats_mutex_waited(mutex, since);
+#endif
     }
 
     return true;
@@ -167,25 +317,43 @@ int mutex_lock_cancelable(mutex_cancel_t *mc)
         mutex->owner_calling_pc = pc;
 #endif
 #if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
-        mutex->owner_original_priority = me->priority;
+        _pi_acquire(mutex, me);
 #endif
         DEBUG("PID[%" PRIkernel_pid "] mutex_lock_cancelable() early out.\n",
               thread_getpid());
+#if IS_USED(MODULE_LOCKSTATS)
+        lockstats_mutex_locked(mutex);
+#endif
         irq_restore(irq_state);
         return 0;
     }
     else {
+#if IS_USED(MODULE_LOCKSTATS)
+        uint32_t since = lockstats_mutex_block(mutex);
+#endif
         _block(mutex, irq_state, pc);
         if (mc->cancelled) {
             DEBUG("PID[%" PRIkernel_pid "] mutex_lock_cancelable() "
                   "cancelled.\n", thread_getpid());
+            return -ECANCELED;
         }
-        return (mc->cancelled) ? -ECANCELED : 0;
+        trace_event(TRACE_EVENT_MUTEX_ACQUIRE, (uintptr_t)mutex);
+#if IS_USED(MODULE_LOCKSTATS)
+        lockstats_mutex_waited(mutex, since);
+#endif
+        return 0;
     }
 }
 
 void mutex_unlock(mutex_t *mutex)
 {
+#ifdef MUTEX_CAS_FAST_PATH
+    if (_mutex_cas(mutex, MUTEX_LOCKED, NULL)) {
+        /* the mutex was locked and no thread was waiting for it */
+        return;
+    }
+#endif
+
     unsigned irqstate = irq_disable();
 
     DEBUG("PID[%" PRIkernel_pid "] mutex_unlock(): queue.next: %p\n",
@@ -197,8 +365,15 @@ void mutex_unlock(mutex_t *mutex)
         return;
     }
 
+#if IS_USED(MODULE_LOCKSTATS)
+    lockstats_mutex_unlocked(mutex);
+#endif
+
     if (mutex->queue.next == MUTEX_LOCKED) {
         mutex->queue.next = NULL;
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+        _pi_release(mutex, NULL);
+#endif
         /* the mutex was locked and no thread was waiting for it */
         irq_restore(irqstate);
         return;
@@ -219,13 +394,7 @@ void mutex_unlock(mutex_t *mutex)
     uint16_t process_priority = process->priority;
 
 #if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
-    thread_t *owner = thread_get(mutex->owner);
-    if ((owner) && (owner->priority != mutex->owner_original_priority)) {
-        DEBUG("PID[%" PRIkernel_pid "] prio %u --> %u\n",
-              owner->pid, (unsigned)owner->priority,
-              (unsigned)mutex->owner_original_priority);
-        sched_change_priority(owner, mutex->owner_original_priority);
-    }
+    _pi_release(mutex, process);
 #endif
 #if IS_USED(MODULE_CORE_MUTEX_DEBUG)
     mutex->owner_calling_pc = 0;
@@ -242,13 +411,18 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
     unsigned irqstate = irq_disable();
 
     if (mutex->queue.next) {
+        thread_t *process = NULL;
+
+#if IS_USED(MODULE_LOCKSTATS)
+        lockstats_mutex_unlocked(mutex);
+#endif
+
         if (mutex->queue.next == MUTEX_LOCKED) {
             mutex->queue.next = NULL;
         }
         else {
             list_node_t *next = list_remove_head(&mutex->queue);
-            thread_t *process = container_of((clist_node_t *)next, thread_t,
-                                             rq_entry);
+            process = container_of((clist_node_t *)next, thread_t, rq_entry);
             DEBUG("PID[%" PRIkernel_pid "] mutex_unlock_and_sleep(): waking up "
                   "waiter.\n", process->pid);
             sched_set_status(process, STATUS_PENDING);
@@ -256,6 +430,11 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
                 mutex->queue.next = MUTEX_LOCKED;
             }
         }
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+        _pi_release(mutex, process);
+#else
+        (void)process;
+#endif
     }
 
     DEBUG("PID[%" PRIkernel_pid "] mutex_unlock_and_sleep(): going to sleep.\n",
@@ -288,6 +467,14 @@ void mutex_cancel(mutex_cancel_t *mc)
         if (mutex->queue.next == NULL) {
             mutex->queue.next = MUTEX_LOCKED;
         }
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+        /* the owner may no longer need the priority of the cancelled thread */
+        thread->mutex_blocked_on = NULL;
+        thread_t *owner = thread_get(mutex->owner);
+        if (owner) {
+            _pi_restore(owner, _pi_base_priority(owner));
+        }
+#endif
         sched_set_status(thread, STATUS_PENDING);
         irq_restore(irq_state);
         sched_switch(thread->priority);
@@ -297,6 +484,52 @@ void mutex_cancel(mutex_cancel_t *mc)
     irq_restore(irq_state);
 }
 
+bool mutex_requeue(mutex_t *mutex, thread_t *thread)
+{
+#if IS_USED(MODULE_LOCKSTATS)
+    /* the waiter would never report the time it waited and holds the mutex */
+    (void)mutex;
+    (void)thread;
+    return false;
+#else
+    assert(irq_is_enabled() == false);
+    assert(thread->status == STATUS_SLEEPING);
+
+    if (mutex->queue.next == NULL) {
+        /* mutex is unlocked, hand it over right away */
+        mutex->queue.next = MUTEX_LOCKED;
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) \
+        || IS_USED(MODULE_CORE_MUTEX_DEBUG)
+        mutex->owner = thread->pid;
+#endif
+#if IS_USED(MODULE_CORE_MUTEX_DEBUG)
+        mutex->owner_calling_pc = 0;
+#endif
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+        _pi_acquire(mutex, thread);
+#endif
+        sched_set_status(thread, STATUS_PENDING);
+        return true;
+    }
+
+    DEBUG("PID[%" PRIkernel_pid "] mutex_requeue(): adding %" PRIkernel_pid
+          " to mutex queue\n", thread_getpid(), thread->pid);
+    sched_set_status(thread, STATUS_MUTEX_BLOCKED);
+    if (mutex->queue.next == MUTEX_LOCKED) {
+        mutex->queue.next = (list_node_t *)&thread->rq_entry;
+        mutex->queue.next->next = NULL;
+    }
+    else {
+        thread_add_to_list(&mutex->queue, thread);
+    }
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+    thread->mutex_blocked_on = mutex;
+    _pi_boost(mutex, thread->priority);
+#endif
+    return true;
+#endif
+}
+
 #else /* MAXTHREADS < 2 */
 typedef int dont_be_pedantic;
 #endif
@@ -31,8 +31,9 @@
 #include "sched.h"
 #include "thread.h"
 #include "panic.h"
+#include "trace.h"
 
-#ifdef MODULE_MPU_STACK_GUARD
+#if defined(MODULE_MPU_STACK_GUARD) || defined(MODULE_MPU_THREAD_REGIONS)
 #include "mpu.h"
 #endif
 
@@ -201,6 +202,8 @@ thread_t *__attribute__((used)) sched_run(void)
         sched_active_pid = next_thread->pid;
         sched_active_thread = next_thread;
 
+        trace_event(TRACE_EVENT_SCHED, next_thread->pid);
+
 #ifdef MODULE_SCHED_CB
         if (sched_cb) {
             sched_cb(KERNEL_PID_UNDEF, next_thread->pid);
@@ -217,6 +220,9 @@ thread_t *__attribute__((used)) sched_run(void)
             (uintptr_t)next_thread->stack_start + 31,       /* Base Address (rounded up) */
             MPU_ATTR(1, AP_RO_RO, 0, 1, 0, 1, MPU_SIZE_32B) /* Attributes and Size */
             );
+#endif
+#ifdef MODULE_MPU_THREAD_REGIONS
+        mpu_thread_regions_apply(next_thread->pid);
 #endif
         DEBUG("sched_run: done, changed sched_active_thread.\n");
     }
@@ -224,6 +230,35 @@ thread_t *__attribute__((used)) sched_run(void)
     return next_thread;
 }
 
+#ifdef MODULE_SCHED_EDF
+/* Insert thread into the runqueue sorted by deadline, behind all threads with
+ * an earlier or equal deadline. rq->next points to the tail of the list. */
+static void _edf_insert(clist_node_t *rq, thread_t *thread)
+{
+    clist_node_t *tail = rq->next;
+
+    if (tail) {
+        clist_node_t *prev = tail;
+        do {
+            thread_t *cur = container_of(prev->next, thread_t, rq_entry);
+            if ((int32_t)(thread->deadline - cur->deadline) < 0) {
+                thread->rq_entry.next = prev->next;
+                prev->next = &thread->rq_entry;
+                return;
+            }
+            prev = prev->next;
+        } while (prev != tail);
+    }
+
+    clist_rpush(rq, &thread->rq_entry);
+}
+
+static inline int _edf_is_head(thread_t *thread)
+{
+    return sched_runqueues[thread->priority].next->next == &thread->rq_entry;
+}
+#endif
+
 /* Note: Forcing the compiler to inline this function will reduce .text for applications
  *       not linking in sched_change_priority(), which benefits the vast majority of apps.
  */
@@ -231,6 +266,12 @@ static inline __attribute__((always_inline)) void _runqueue_push(thread_t *threa
 {
     DEBUG("sched_set_status: adding thread %" PRIkernel_pid " to runqueue %" PRIu8 ".\n",
           thread->pid, priority);
+#ifdef MODULE_SCHED_EDF
+    if (priority == CONFIG_SCHED_EDF_PRIO) {
+        _edf_insert(&sched_runqueues[priority], thread);
+    }
+    else
+#endif
     clist_rpush(&sched_runqueues[priority], &(thread->rq_entry));
     _set_runqueue_bit(priority);
 
@@ -252,6 +293,14 @@ static inline __attribute__((always_inline)) void _runqueue_pop(thread_t *thread
 {
     DEBUG("sched_set_status: removing thread %" PRIkernel_pid " from runqueue %" PRIu8 ".\n",
           thread->pid, thread->priority);
+#ifdef MODULE_SCHED_EDF
+    /* a thread preempted by an earlier deadline is not the head of its
+     * runqueue anymore */
+    if (thread->priority == CONFIG_SCHED_EDF_PRIO) {
+        clist_remove(&sched_runqueues[thread->priority], &thread->rq_entry);
+    }
+    else
+#endif
     clist_lpop(&sched_runqueues[thread->priority]);
 
     if (!sched_runqueues[thread->priority].next) {
@@ -289,7 +338,17 @@ void sched_switch(uint16_t other_prio)
           active_thread->pid, current_prio, on_runqueue,
           other_prio);
 
-    if (!on_runqueue || (current_prio > other_prio)) {
+    int preempt = !on_runqueue || (current_prio > other_prio);
+
+#ifdef MODULE_SCHED_EDF
+    /* a thread with an earlier deadline entered the EDF runqueue */
+    if (on_runqueue && (current_prio == CONFIG_SCHED_EDF_PRIO)
+        && !_edf_is_head(active_thread)) {
+        preempt = 1;
+    }
+#endif
+
+    if (preempt) {
         if (irq_is_in()) {
             DEBUG("sched_switch: setting sched_context_switch_request.\n");
             sched_context_switch_request = 1;
@@ -316,6 +375,10 @@ NORETURN void sched_task_exit(void)
 #endif
 
     (void)irq_disable();
+#ifdef MODULE_PM_LAYERED_THREAD
+    void pm_thread_exit(kernel_pid_t pid);
+    pm_thread_exit(thread_getpid());
+#endif
     sched_threads[thread_getpid()] = NULL;
     sched_num_threads--;
 
@@ -332,6 +395,32 @@ void sched_register_cb(void (*callback)(kernel_pid_t, kernel_pid_t))
 }
 #endif
 
+#ifdef MODULE_SCHED_EDF
+void sched_set_deadline(thread_t *thread, uint32_t deadline)
+{
+    assert(thread);
+
+    unsigned irq_state = irq_disable();
+    int on_runqueue = (thread->status >= STATUS_ON_RUNQUEUE);
+
+    if (on_runqueue && (thread->priority == CONFIG_SCHED_EDF_PRIO)) {
+        clist_node_t *rq = &sched_runqueues[thread->priority];
+        clist_remove(rq, &thread->rq_entry);
+        thread->deadline = deadline;
+        _edf_insert(rq, thread);
+    }
+    else {
+        thread->deadline = deadline;
+    }
+
+    irq_restore(irq_state);
+
+    if (on_runqueue && thread_get_active()) {
+        sched_switch(thread->priority);
+    }
+}
+#endif
+
 void sched_change_priority(thread_t *thread, uint8_t priority)
 {
     assert(thread && (priority < SCHED_PRIO_LEVELS));
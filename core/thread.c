@@ -180,12 +180,20 @@ void thread_add_to_list(list_node_t *list, thread_t *thread)
     list->next = new_node;
 }
 
-uintptr_t measure_stack_free_internal(const char *stack, size_t size)
+static_assert((CONFIG_THREAD_STACKTEST_STRIDE > 0) &&
+              (CONFIG_THREAD_STACKTEST_FAST_STRIDE %
+               CONFIG_THREAD_STACKTEST_STRIDE == 0),
+              "CONFIG_THREAD_STACKTEST_FAST_STRIDE must be a multiple of "
+              "CONFIG_THREAD_STACKTEST_STRIDE");
+
+static uintptr_t _measure_stack_free(const char *stack, size_t size,
+                                     unsigned stride)
 {
     /* Alignment of stack has been fixed (if needed) by thread_create(), so
      * we can silence -Wcast-align here */
     uintptr_t *stackp = (uintptr_t *)(uintptr_t)stack;
     uintptr_t end = (uintptr_t)stack + size;
+    uintptr_t *last_intact = NULL;
 
     /* HACK: This will affect native/native64 only.
      *
@@ -197,18 +205,70 @@ uintptr_t measure_stack_free_internal(const char *stack, size_t size)
      * value has gone out of scope. */
     VALGRIND_DISABLE_ERROR_REPORTING;
 
-    /* assume that the stack grows "downwards" */
+    /* assume that the stack grows "downwards". Only every stride-th word is
+     * checked, so only the word of the last intact marker is known to be
+     * unused. With a stride of 1, this is the word before the first used. */
     while (((uintptr_t)stackp < end) && (*stackp == (uintptr_t)stackp)) {
-        stackp++;
+        last_intact = stackp;
+        stackp += stride;
     }
 
     VALGRIND_ENABLE_ERROR_REPORTING;
 
-    uintptr_t space_free = (uintptr_t)stackp - (uintptr_t)stack;
+    if (!last_intact) {
+        return 0;
+    }
+
+    uintptr_t space_free = (uintptr_t)(last_intact + 1) - (uintptr_t)stack;
 
     return space_free;
 }
 
+uintptr_t measure_stack_free_internal(const char *stack, size_t size)
+{
+    return _measure_stack_free(stack, size, CONFIG_THREAD_STACKTEST_STRIDE);
+}
+
+uintptr_t measure_stack_free_fast_internal(const char *stack, size_t size)
+{
+    return _measure_stack_free(stack, size,
+                               CONFIG_THREAD_STACKTEST_FAST_STRIDE);
+}
+
+#ifdef DEVELHELP
+void *thread_stack_reclaim(thread_t *thread, size_t reserve, size_t *size)
+{
+    assert(thread && size);
+
+    /* keep the markers at the same offsets relative to the stack start */
+    const size_t unit = CONFIG_THREAD_STACKTEST_STRIDE * sizeof(uintptr_t);
+    unsigned state = irq_disable();
+    size_t free = thread_measure_stack_free(thread);
+
+    size_t reclaim = (free > reserve + unit) ? free - reserve - unit : 0;
+    reclaim -= reclaim % unit;
+
+    if (reclaim == 0) {
+        irq_restore(state);
+        *size = 0;
+        return NULL;
+    }
+
+    char *mem = thread->stack_start;
+    thread->stack_start += reclaim;
+    thread->stack_size -= reclaim;
+    /* renew the stack guard at the new stack start */
+    *(uintptr_t *)(uintptr_t)thread->stack_start =
+        (uintptr_t)thread->stack_start;
+    irq_restore(state);
+
+    DEBUG("thread_stack_reclaim: reclaimed %u bytes from pid %"
+          PRIkernel_pid "\n", (unsigned)reclaim, thread->pid);
+    *size = reclaim;
+    return mem;
+}
+#endif
+
 kernel_pid_t thread_create(char *stack, int stacksize, uint8_t priority,
                            int flags, thread_task_func_t function, void *arg,
                            const char *name)
@@ -278,7 +338,7 @@ kernel_pid_t thread_create(char *stack, int stacksize, uint8_t priority,
 
         while (stackp < stackmax) {
             *stackp = (uintptr_t)stackp;
-            stackp++;
+            stackp += CONFIG_THREAD_STACKTEST_STRIDE;
         }
     }
 #endif
@@ -329,6 +389,15 @@ kernel_pid_t thread_create(char *stack, int stacksize, uint8_t priority,
     thread->msg_array = NULL;
 #endif
 
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    thread->mutexes_held.next = NULL;
+    thread->mutex_blocked_on = NULL;
+#endif
+
+#ifdef MODULE_SCHED_EDF
+    thread->deadline = 0;
+#endif
+
     sched_num_threads++;
 
     DEBUG("Created thread %s. PID: %" PRIkernel_pid ". Priority: %u.\n", name,
@@ -142,7 +142,8 @@ void bootloader(void)
     /* cpu specific setup of clocks, peripherals */
     cpu_init();
 
-#if defined(MODULE_NEWLIB) || defined(MODULE_PICOLIBC)
+#if (defined(MODULE_NEWLIB) || defined(MODULE_PICOLIBC)) \
+    && !defined(MODULE_AUTO_INIT_STATIC_CTORS)
     extern void __libc_init_array(void);
     __libc_init_array();
 #endif
@@ -71,6 +71,7 @@ static uart_isr_ctx_t uart_ctx[UART_NUMOF];
 
 #ifdef MODULE_PERIPH_UART_NONBLOCKING
 
+#include "macros/utils.h"
 #include "tsrb.h"
 /**
  * @brief   Allocate for tx ring buffers
@@ -283,6 +284,24 @@ void uart_write(uart_t uart, const uint8_t *data, size_t len)
 #endif
 }
 
+#ifdef MODULE_PERIPH_UART_NONBLOCKING
+size_t uart_write_async(uart_t uart, const uint8_t *data, size_t len)
+{
+    /* uart_write() does not wait while the ring buffer has room */
+    len = MIN(len, tsrb_free(&uart_tx_rb[uart]));
+    uart_write(uart, data, len);
+    return len;
+}
+
+void uart_flush(uart_t uart)
+{
+    assert(!irq_is_in() && !__get_PRIMASK());
+
+    while (!tsrb_empty(&uart_tx_rb[uart])) {}
+    while (uart_config[uart].dev->cc2538_uart_fr.FRbits.BUSY) {}
+}
+#endif
+
 void uart_poweron(uart_t uart)
 {
     assert(uart < UART_NUMOF);
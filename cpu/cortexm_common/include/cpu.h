@@ -138,6 +138,30 @@ static inline uintptr_t cpu_get_caller_pc(void)
     return lr_ptr;
 }
 
+/**
+ * @brief   Returns the program counter of the thread interrupted by the
+ *          current ISR
+ *
+ * @pre     Called in interrupt context
+ *
+ * @return  address of the interrupted instruction
+ * @return  0 if the current ISR preempted another ISR or no thread was
+ *          running
+ */
+static inline uintptr_t cpu_get_interrupted_pc(void)
+{
+#ifdef SCB_ICSR_RETTOBASE_Msk
+    if (!(SCB->ICSR & SCB_ICSR_RETTOBASE_Msk)) {
+        return 0;
+    }
+#endif
+    /* threads run on the process stack, where the hardware stacked
+     * r0-r3, r12, lr, pc and xpsr on exception entry */
+    const uint32_t *frame = (const uint32_t *)__get_PSP();
+
+    return frame ? frame[6] : 0;
+}
+
 /**
  * @brief   Put the CPU into the 'wait for event' sleep mode
  *
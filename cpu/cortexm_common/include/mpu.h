@@ -156,6 +156,113 @@ bool mpu_enabled(void);
  */
 int mpu_configure(uint_fast8_t region, uintptr_t base, uint_fast32_t attr);
 
+#if defined(MODULE_MPU_THREAD_REGIONS) || defined(DOXYGEN)
+/**
+ * @name    Per-thread MPU regions
+ *
+ * With module `mpu_thread_regions`, the last @ref CONFIG_MPU_THREAD_REGIONS_NUMOF
+ * MPU regions belong to the running thread. The register values of each
+ * thread's regions are kept in a table and written to the MPU by the
+ * scheduler on every context switch, which costs two stores per region.
+ *
+ * As threads run privileged, a region can only restrict access beyond the
+ * default memory map. To keep the private data of threads apart, place it in
+ * a pool and cover the pool with a region denying all access, e.g.
+ * `MPU_ATTR(1, AP_NO_NO, 0, 1, 0, 0, size)`, configured with a number below
+ * @ref MPU_THREAD_REGIONS_FIRST. Each thread then gets a thread region
+ * allowing access to its own part of the pool, which takes precedence as it
+ * has a higher region number.
+ *
+ * Thread regions must not cover thread stacks, the ISR stack or kernel data:
+ * the kernel accesses those on behalf of other threads, e.g. when copying a
+ * message. The regions of a thread are cleared when it exits.
+ *
+ * Only available on ARMv6-M and ARMv7-M.
+ * @{
+ */
+#include "cpu.h"
+#include "sched.h"
+
+/**
+ * @brief   Number of MPU regions configured per thread
+ */
+#ifndef CONFIG_MPU_THREAD_REGIONS_NUMOF
+#define CONFIG_MPU_THREAD_REGIONS_NUMOF     (2U)
+#endif
+
+/**
+ * @brief   First MPU region configured per thread
+ */
+#ifndef MPU_THREAD_REGIONS_FIRST
+#define MPU_THREAD_REGIONS_FIRST            (8U - CONFIG_MPU_THREAD_REGIONS_NUMOF)
+#endif
+
+/**
+ * @brief   Register values of an MPU region
+ */
+typedef struct {
+    uint32_t rbar;      /**< value of the RBAR register */
+    uint32_t rasr;      /**< value of the RASR register */
+} mpu_region_t;
+
+/**
+ * @brief   MPU regions of all threads, indexed by PID
+ */
+extern mpu_region_t mpu_thread_regions[KERNEL_PID_LAST + 1][CONFIG_MPU_THREAD_REGIONS_NUMOF];
+
+/**
+ * @brief   Configure an MPU region of a thread
+ *
+ * Takes effect the next time @p pid is scheduled, so when configuring the
+ * running thread call thread_yield_higher() afterwards.
+ *
+ * @param[in]   pid     thread to configure the region for
+ * @param[in]   idx     index of the thread region,
+ *                      0 <= @p idx < CONFIG_MPU_THREAD_REGIONS_NUMOF
+ * @param[in]   base    base address (aligned to the size specified in @p attr)
+ * @param[in]   attr    attribute word generated by MPU_ATTR(), 0 disables
+ *                      the region
+ *
+ * @return 0 on success
+ * @return <0 on invalid arguments or no MPU present
+ */
+int mpu_thread_region_set(kernel_pid_t pid, unsigned idx, uintptr_t base,
+                          uint32_t attr);
+
+/**
+ * @brief   Clear all MPU regions of a thread
+ *
+ * @param[in]   pid     thread to clear the regions of
+ */
+void mpu_thread_regions_clear(kernel_pid_t pid);
+
+/**
+ * @brief   Clear the MPU regions of all threads
+ *
+ * Called once during startup.
+ */
+void mpu_thread_regions_init(void);
+
+/**
+ * @brief   Write the MPU regions of a thread to the MPU
+ *
+ * Called by the scheduler with interrupts disabled.
+ *
+ * @param[in]   pid     thread that is scheduled next
+ */
+static inline void mpu_thread_regions_apply(kernel_pid_t pid)
+{
+    const mpu_region_t *region = mpu_thread_regions[pid];
+
+    for (unsigned i = 0; i < CONFIG_MPU_THREAD_REGIONS_NUMOF; i++) {
+        /* the valid bit in RBAR selects the region, so RNR is left alone */
+        MPU->RBAR = region[i].rbar;
+        MPU->RASR = region[i].rasr;
+    }
+}
+/** @} */
+#endif /* MODULE_MPU_THREAD_REGIONS */
+
 #ifdef __cplusplus
 }
 #endif
@@ -19,6 +19,7 @@
  */
 
 #include "cpu.h"
+#include "irq.h"
 #include "mpu.h"
 
 int mpu_disable(void) {
@@ -71,3 +72,39 @@ int mpu_configure(uint_fast8_t region, uintptr_t base, uint_fast32_t attr) {
     return -1;
 #endif
 }
+
+#ifdef MODULE_MPU_THREAD_REGIONS
+#if defined(__ARM_ARCH_8M_MAIN__) || defined(__ARM_ARCH_8M_BASE__)
+#error "mpu_thread_regions is not supported on ARMv8-M"
+#endif
+
+mpu_region_t mpu_thread_regions[KERNEL_PID_LAST + 1][CONFIG_MPU_THREAD_REGIONS_NUMOF];
+
+int mpu_thread_region_set(kernel_pid_t pid, unsigned idx, uintptr_t base,
+                          uint32_t attr) {
+    if (!pid_is_valid(pid) || (idx >= CONFIG_MPU_THREAD_REGIONS_NUMOF)) {
+        return -1;
+    }
+
+    mpu_region_t *region = &mpu_thread_regions[pid][idx];
+    unsigned state = irq_disable();
+    region->rbar = (base & MPU_RBAR_ADDR_Msk) | MPU_RBAR_VALID_Msk
+                 | (MPU_THREAD_REGIONS_FIRST + idx);
+    region->rasr = attr ? (attr | MPU_RASR_ENABLE_Msk) : 0;
+    irq_restore(state);
+
+    return 0;
+}
+
+void mpu_thread_regions_clear(kernel_pid_t pid) {
+    for (unsigned i = 0; i < CONFIG_MPU_THREAD_REGIONS_NUMOF; i++) {
+        mpu_thread_region_set(pid, i, 0, 0);
+    }
+}
+
+void mpu_thread_regions_init(void) {
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        mpu_thread_regions_clear(pid);
+    }
+}
+#endif /* MODULE_MPU_THREAD_REGIONS */
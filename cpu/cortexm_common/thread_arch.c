@@ -96,6 +96,9 @@
 #include "thread.h"
 #include "irq.h"
 #include "cpu.h"
+#ifdef MODULE_MPU_THREAD_REGIONS
+#include "mpu.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -288,6 +291,10 @@ void NORETURN cpu_switch_context_exit(void)
     __set_FPSCR(0);
     __set_CONTROL(__get_CONTROL() & (~(CONTROL_FPCA_Msk)));
 #endif
+#ifdef MODULE_MPU_THREAD_REGIONS
+    /* the PID may be reused by a thread that must not inherit the regions */
+    mpu_thread_regions_clear(thread_getpid());
+#endif
 
     /* enable IRQs to make sure the PENDSV interrupt is reachable */
     irq_enable();
@@ -313,37 +320,34 @@ void __attribute__((naked)) __attribute__((used)) isr_pendsv(void) {
     ".thumb_func                      \n"
     ".syntax unified                  \n"
 
+    /* The context is saved before calling sched_run, so nothing needs to be
+     * kept on the exception stack across the call. PendSV is normally only
+     * triggered when another thread is due, in the rare case the same thread
+     * is selected again its context is simply restored. */
+
     /* skip context saving if sched_active_thread == NULL */
     "ldr    r1, =sched_active_thread  \n" /* r1 = &sched_active_thread  */
-    "push   {r4, lr}                  \n" /* push r4 and exception return code */
-    "ldr    r4, [r1]                  \n" /* r4 = sched_active_thread   */
-
-    "cpsid  i                         \n" /* Disable IRQs during sched_run */
-    "bl     sched_run                 \n" /* perform scheduling */
-    "cpsie  i                         \n" /* Re-enable interrupts */
-
-    "cmp    r0, r4                    \n" /* if r0 == r1: (new thread == old
-                                               thread, no switch required) */
-    "it     eq                        \n"
-    "popeq  {r4, pc}                  \n" /* Pop exception to pc to return */
-
-    "mov    r1, r4                    \n" /* save sched_active_thread in r1 */
-    "pop    {r4, lr}                  \n" /* Pop exception from the exception stack */
-
-    "cbz    r1, restore_context       \n" /* goto restore_context if r1 == 0 */
+    "ldr    r1, [r1]                  \n" /* r1 = sched_active_thread   */
+    "cbz    r1, select_thread         \n" /* goto select_thread if r1 == 0 */
 
     "mrs    r2, psp                   \n" /* get stack pointer from user mode */
 
 #ifdef MODULE_CORTEXM_FPU
+    /* bit 4 of the exception return code is only cleared for threads which
+     * have used the FPU, all others skip saving and restoring its state */
     "tst    lr, #0x10                 \n"
     "it     eq                        \n"
     "vstmdbeq r2!, {s16-s31}          \n" /* save FPU registers if FPU is used */
 #endif
     "stmdb  r2!,{r4-r11,lr}           \n" /* save regs, including lr */
-    "str    r2, [r1]                  \n" /* write r0 to thread->sp */
+    "str    r2, [r1]                  \n" /* write r2 to thread->sp */
 
     /* current thread context is now saved */
-    "restore_context:                 \n" /* Label to skip thread state saving */
+    "select_thread:                   \n"
+    "cpsid  i                         \n" /* Disable IRQs during sched_run */
+    "bl     sched_run                 \n" /* perform scheduling */
+    "cpsie  i                         \n" /* Re-enable interrupts */
+
 #ifdef MODULE_CORTEXM_STACK_LIMIT
     "mov    r4, r0                    \n" /* Save content of R0 into R4*/
     "bl _get_new_stacksize            \n" /* Get the new lower limit stack in R0 */
@@ -187,7 +187,12 @@ void reset_handler_default(void)
     }
 #endif
 
-#if defined(MODULE_MPU_STACK_GUARD) || defined(MODULE_MPU_NOEXEC_RAM)
+#ifdef MODULE_MPU_THREAD_REGIONS
+    mpu_thread_regions_init();
+#endif
+
+#if defined(MODULE_MPU_STACK_GUARD) || defined(MODULE_MPU_NOEXEC_RAM) \
+    || defined(MODULE_MPU_THREAD_REGIONS)
     mpu_enable();
 #endif
 
@@ -204,7 +209,7 @@ void reset_handler_default(void)
     /* initialize the board (which also initiates CPU initialization) */
     board_init();
 
-#if MODULE_NEWLIB || MODULE_PICOLIBC
+#if (MODULE_NEWLIB || MODULE_PICOLIBC) && !MODULE_AUTO_INIT_STATIC_CTORS
     /* initialize std-c library (this must be done after board_init) */
     extern void __libc_init_array(void);
     __libc_init_array();
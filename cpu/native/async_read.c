@@ -132,14 +132,16 @@ void native_async_read_add_int_handler(int fd, void *arg, native_async_read_call
 
     _add_handler(fd, arg, handler);
 
-    _sigio_child(_next_index);
+    /* the child may signal right away if data is pending, so the fd must
+     * already be polled by _async_io_isr() */
     _next_index++;
+    _sigio_child(_next_index - 1);
 }
 
 static void _sigio_child(int index)
 {
     struct pollfd fds = _fds[index];
-    async_read_t *poll = &pollers[_next_index];
+    async_read_t *poll = &pollers[index];
     pid_t parent = _native_pid;
     pid_t child;
     if ((child = real_fork()) == -1) {
@@ -27,9 +27,12 @@ extern "C" {
 
 /**
  * @brief   Maximum number of file descriptors
+ *
+ * `--vtime` uses one for the time server and, like `--time-warp`, one for
+ * stdin.
  */
 #ifndef ASYNC_READ_NUMOF
-#define ASYNC_READ_NUMOF 2
+#define ASYNC_READ_NUMOF 4
 #endif
 
 /**
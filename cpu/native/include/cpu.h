@@ -45,6 +45,14 @@ __attribute__((always_inline)) static inline uintptr_t cpu_get_caller_pc(void)
     return (uintptr_t)__builtin_return_address(0);
 }
 
+/**
+ * @brief   Returns the program counter of the thread interrupted by the
+ *          current ISR
+ *
+ * @pre     Called in interrupt context
+ */
+uintptr_t cpu_get_interrupted_pc(void);
+
 #ifdef __cplusplus
 }
 #endif
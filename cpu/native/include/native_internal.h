@@ -183,6 +183,8 @@ extern pid_t _native_pid;
 extern pid_t _native_id;
 extern unsigned _native_rng_seed;
 extern int _native_rng_mode; /**< 0 = /dev/random, 1 = random(3) */
+extern int _native_time_warp; /**< skip idle periods, see `--time-warp` */
+extern char *_native_vtime_server; /**< time server, see `--vtime` */
 extern const char *_native_unix_socket_path;
 
 ssize_t _native_read(int fd, void *buf, size_t count);
@@ -193,6 +195,12 @@ ssize_t _native_writev(int fildes, const struct iovec *iov, int iovcnt);
  * @endcond
  */
 
+/**
+ * Wait for the next signal, skipping idle time if `--time-warp` or `--vtime`
+ * is given. Returns 0 without waiting if idle time is not skipped.
+ */
+int native_timer_idle(void);
+
 /**
  * register interrupt handler handler for interrupt sig
  */
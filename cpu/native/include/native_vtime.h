@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/**
+ * @ingroup     cpu_native
+ * @{
+ *
+ * @file
+ * @brief       Protocol for virtual time shared between native instances
+ *
+ * Instances started with `--vtime=<addr>:<port>` report to a time server
+ * (`dist/tools/vtime_server`) whenever they become idle or busy. Once all
+ * instances are idle, the server advances the shared clock to the earliest
+ * timer deadline, so multi-node scenarios skip idle periods together.
+ *
+ * All instances and the server must run on the same host, as the shared clock
+ * is `CLOCK_MONOTONIC` plus the offset distributed by the server.
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ */
+
+#ifndef NATIVE_VTIME_H
+#define NATIVE_VTIME_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Default port of the time server
+ */
+#define NATIVE_VTIME_PORT_DEFAULT   "17760"
+
+/**
+ * @brief   Deadline reported by an instance without a pending timer
+ */
+#define NATIVE_VTIME_NONE           UINT64_MAX
+
+/**
+ * @brief   Message types
+ */
+enum {
+    NATIVE_VTIME_HELLO, /**< instance → server: register, answered with WARP */
+    NATIVE_VTIME_IDLE,  /**< instance → server: idle until `value` */
+    NATIVE_VTIME_BUSY,  /**< instance → server: running */
+    NATIVE_VTIME_WARP,  /**< server → instance: clock offset is now `value` */
+};
+
+/**
+ * @brief   Time server message, in host byte order
+ */
+typedef struct __attribute__((packed)) {
+    uint8_t type;       /**< message type */
+    uint64_t value;     /**< deadline or clock offset in µs */
+} native_vtime_msg_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NATIVE_VTIME_H */
+/** @} */
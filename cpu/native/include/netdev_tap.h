@@ -32,6 +32,14 @@ extern "C" {
 
 #include "net/if.h"
 
+/**
+ * @brief   Number of buckets of the multicast hash filter
+ *
+ * Like the hash filters of Ethernet MACs, a multicast frame is received if
+ * any address joined with @ref NETOPT_L2_GROUP hashes to the same bucket.
+ */
+#define NETDEV_TAP_MCAST_FILTER_SIZE    (64U)
+
 /**
  * @brief tap interface state
  */
@@ -42,6 +50,15 @@ typedef struct netdev_tap {
     uint8_t addr[ETHERNET_ADDR_LEN];    /**< The MAC address of the TAP */
     bool promiscuous;                   /**< Flag for promiscuous mode */
     bool wired;                         /**< Flag for wired mode */
+    /**
+     * @brief   Flag for multicast filtering, set when the first group is
+     *          joined, until then all multicast frames are received
+     */
+    bool mcast_filtered;
+    /**
+     * @brief   Number of joined groups per bucket of the multicast hash filter
+     */
+    uint8_t mcast_filter[NETDEV_TAP_MCAST_FILTER_SIZE];
 } netdev_tap_t;
 
 /**
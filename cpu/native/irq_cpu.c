@@ -72,6 +72,11 @@ void *thread_isr_stack_start(void)
     return __isr_stack;
 }
 
+uintptr_t cpu_get_interrupted_pc(void)
+{
+    return _native_saved_eip;
+}
+
 void print_thread_sigmask(ucontext_t *cp)
 {
     sigset_t *p = &cp->uc_sigmask;
@@ -89,6 +89,34 @@ static inline int _set_promiscuous(netdev_t *netdev, int value)
     return value;
 }
 
+static inline unsigned _mcast_bucket(const uint8_t *addr)
+{
+    return (addr[2] ^ addr[3] ^ addr[4] ^ addr[5]) % NETDEV_TAP_MCAST_FILTER_SIZE;
+}
+
+static int _set_mcast_filter(netdev_t *netdev, const uint8_t *addr,
+                             size_t addr_len, bool join)
+{
+    netdev_tap_t *dev = container_of(netdev, netdev_tap_t, netdev);
+    uint8_t *cnt;
+
+    if ((addr_len != ETHERNET_ADDR_LEN) || !(addr[0] & 0x01)) {
+        return -EINVAL;
+    }
+    cnt = &dev->mcast_filter[_mcast_bucket(addr)];
+    if (join) {
+        dev->mcast_filtered = true;
+        /* a saturated bucket just stays open */
+        if (*cnt < UINT8_MAX) {
+            (*cnt)++;
+        }
+    }
+    else if ((*cnt > 0) && (*cnt < UINT8_MAX)) {
+        (*cnt)--;
+    }
+    return ETHERNET_ADDR_LEN;
+}
+
 static inline int _get_wired(netdev_t *netdev)
 {
     netdev_tap_t *dev = container_of(netdev, netdev_tap_t, netdev);
@@ -158,6 +186,11 @@ static int _set(netdev_t *dev, netopt_t opt, const void *value, size_t value_len
             _set_promiscuous(dev, ((const bool *)value)[0]);
             res = sizeof(netopt_enable_t);
             break;
+        case NETOPT_L2_GROUP:
+        case NETOPT_L2_GROUP_LEAVE:
+            res = _set_mcast_filter(dev, value, value_len,
+                                    opt == NETOPT_L2_GROUP);
+            break;
         default:
             res = netdev_eth_set(dev, opt, value, value_len);
             break;
@@ -188,6 +221,12 @@ static inline bool _is_addr_multicast(uint8_t *addr)
     return (addr[0] & 0x01);
 }
 
+static inline bool _is_addr_mcast_filtered(netdev_tap_t *dev, uint8_t *addr)
+{
+    return dev->mcast_filtered && !_is_addr_broadcast(addr) &&
+           (dev->mcast_filter[_mcast_bucket(addr)] == 0);
+}
+
 static void _continue_reading(netdev_tap_t *dev)
 {
     /* work around lost signals */
@@ -262,6 +301,14 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
 
             return 0;
         }
+        if (!(dev->promiscuous) && _is_addr_multicast(hdr->dst) &&
+            _is_addr_mcast_filtered(dev, hdr->dst)) {
+            DEBUG("netdev_tap: multicast group not joined => Dropped\n");
+
+            native_async_read_continue(dev->tap_fd);
+
+            return 0;
+        }
 
         _continue_reading(dev);
 
@@ -344,6 +391,8 @@ static int _init(netdev_t *netdev)
 #endif
     /* initialize device descriptor */
     dev->promiscuous = 0;
+    dev->mcast_filtered = false;
+    memset(dev->mcast_filter, 0, sizeof(dev->mcast_filter));
     /* implicitly create the tap interface */
     if ((dev->tap_fd = real_open(clonedev, O_RDWR | O_NONBLOCK)) == -1) {
         err(EXIT_FAILURE, "open(%s)", clonedev);
@@ -41,7 +41,12 @@ unsigned _native_retval = EXIT_SUCCESS;
 static void _native_sleep(void)
 {
     _native_in_syscall++; /* no switching here */
-    real_pause();
+#ifdef MODULE_PERIPH_TIMER
+    if (!native_timer_idle())
+#endif
+    {
+        real_pause();
+    }
     _native_in_syscall--;
 
     if (_native_sigpend > 0) {
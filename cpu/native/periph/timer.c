@@ -28,16 +28,21 @@
  * @}
  */
 
+#include <err.h>
+#include <netdb.h>
 #include <signal.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/socket.h>
 #include <sys/time.h>
 #include <time.h>
 
+#include "async_read.h"
 #include "cpu.h"
 #include "cpu_conf.h"
 #include "native_internal.h"
+#include "native_vtime.h"
 #include "panic.h"
 #include "periph/timer.h"
 #include "time_units.h"
@@ -49,6 +54,16 @@
 
 static unsigned long time_null;
 
+/* idle time skipped by native_timer_idle() */
+static unsigned long time_warped;
+
+/* connection to the time server, see native_vtime.h */
+static int _vtime_fd = -1;
+/* offset of the shared clock to CLOCK_MONOTONIC in us */
+static uint64_t _vtime_offset;
+
+static void _vtime_connect(char *server);
+
 static timer_cb_t _callback;
 static void *_cb_arg;
 
@@ -116,6 +131,10 @@ int timer_init(tim_t dev, uint32_t freq, timer_cb_t cb, void *arg)
     _callback = cb;
     _cb_arg = arg;
 
+    if (_native_vtime_server && (_vtime_fd < 0)) {
+        _vtime_connect(_native_vtime_server);
+    }
+
     if (timer_create(CLOCK_MONOTONIC, NULL, &itimer_monotonic) != 0) {
         DEBUG_PUTS("Failed to create a monotonic itimer");
         return -1;
@@ -243,5 +262,168 @@ unsigned int timer_read(tim_t dev)
 
     _native_syscall_leave();
 
-    return ts2ticks(&t) - time_null;
+    return ts2ticks(&t) - time_null + time_warped;
+}
+
+/* remaining ticks of the pending timer, 0 if it is not armed */
+static unsigned long _timer_left(void)
+{
+    struct itimerspec left;
+
+    if ((timer_gettime(itimer_monotonic, &left) == -1) ||
+        (!left.it_value.tv_sec && !left.it_value.tv_nsec)) {
+        return 0;
+    }
+
+    unsigned long ticks = ts2ticks(&left.it_value);
+    return ticks ? ticks : 1;
+}
+
+/* advance the virtual time by ticks, pulling in the pending timer */
+static void _timer_shift(unsigned long ticks)
+{
+    struct itimerspec left;
+
+    time_warped += ticks;
+
+    if (!_callback || (timer_gettime(itimer_monotonic, &left) == -1) ||
+        (!left.it_value.tv_sec && !left.it_value.tv_nsec)) {
+        return;
+    }
+
+    unsigned long remaining = ts2ticks(&left.it_value);
+    if (remaining > ticks) {
+        remaining -= ticks;
+        left.it_value.tv_sec = remaining / NATIVE_TIMER_SPEED;
+        left.it_value.tv_nsec = (remaining % NATIVE_TIMER_SPEED)
+                              * (NS_PER_SEC / NATIVE_TIMER_SPEED);
+    }
+    else {
+        /* expire right away, a periodic timer keeps its interval */
+        left.it_value.tv_sec = 0;
+        left.it_value.tv_nsec = 1;
+    }
+
+    DEBUG("timer: skipping %lu us\n", ticks);
+
+    if (timer_settime(itimer_monotonic, 0, &left, NULL) == -1) {
+        core_panic(PANIC_GENERAL_ERROR, "Failed to set monotonic timer");
+    }
+}
+
+static uint64_t _vtime_now(void)
+{
+    struct timespec t;
+
+    clock_gettime(CLOCK_MONOTONIC, &t);
+
+    return (uint64_t)t.tv_sec * US_PER_SEC + t.tv_nsec / NS_PER_US + _vtime_offset;
+}
+
+static void _vtime_send(uint8_t type, uint64_t value)
+{
+    native_vtime_msg_t msg = { .type = type, .value = value };
+
+    if (real_send(_vtime_fd, &msg, sizeof(msg), 0) != sizeof(msg)) {
+        DEBUG("timer: failed to reach time server\n");
+    }
+}
+
+static void _vtime_isr(int fd, void *arg)
+{
+    (void)arg;
+    native_vtime_msg_t msg;
+
+    while (real_recv(fd, &msg, sizeof(msg), 0) == sizeof(msg)) {
+        if ((msg.type == NATIVE_VTIME_WARP) && (msg.value > _vtime_offset)) {
+            _timer_shift(msg.value - _vtime_offset);
+            _vtime_offset = msg.value;
+        }
+    }
+}
+
+static void _vtime_connect(char *server)
+{
+    struct addrinfo hints = { .ai_family = AF_UNSPEC, .ai_socktype = SOCK_DGRAM };
+    struct addrinfo *ai, *res;
+    const char *port = NATIVE_VTIME_PORT_DEFAULT;
+    char *sep = strrchr(server, ':');
+
+    /* <addr>[:<port>], IPv6 addresses with a port need brackets */
+    if (sep && ((server[0] == '[') || (strchr(server, ':') == sep))) {
+        *sep = '\0';
+        port = sep + 1;
+    }
+    if ((server[0] == '[') && (server[strlen(server) - 1] == ']')) {
+        server[strlen(server) - 1] = '\0';
+        server++;
+    }
+
+    if (real_getaddrinfo(server, port, &hints, &ai) != 0) {
+        errx(EXIT_FAILURE, "vtime: unable to resolve %s", server);
+    }
+    for (res = ai; res != NULL; res = res->ai_next) {
+        _vtime_fd = real_socket(res->ai_family, res->ai_socktype, res->ai_protocol);
+        if ((_vtime_fd >= 0) &&
+            (real_connect(_vtime_fd, res->ai_addr, res->ai_addrlen) == 0)) {
+            break;
+        }
+        if (_vtime_fd >= 0) {
+            real_close(_vtime_fd);
+        }
+        _vtime_fd = -1;
+    }
+    real_freeaddrinfo(ai);
+    if (_vtime_fd < 0) {
+        err(EXIT_FAILURE, "vtime: unable to connect to %s", server);
+    }
+
+    /* the server answers with the current offset of the shared clock */
+    native_vtime_msg_t msg = { .type = NATIVE_VTIME_HELLO };
+    struct pollfd pfd = { .fd = _vtime_fd, .events = POLLIN };
+    if ((real_send(_vtime_fd, &msg, sizeof(msg), 0) != sizeof(msg)) ||
+        (real_poll(&pfd, 1, 1000) != 1) ||
+        (real_recv(_vtime_fd, &msg, sizeof(msg), 0) != sizeof(msg)) ||
+        (msg.type != NATIVE_VTIME_WARP)) {
+        errx(EXIT_FAILURE, "vtime: no answer from time server %s:%s", server, port);
+    }
+    _vtime_offset = msg.value;
+
+    native_async_read_setup();
+    native_async_read_add_handler(_vtime_fd, NULL, _vtime_isr);
+}
+
+int native_timer_idle(void)
+{
+    sigset_t sigmask, oldmask;
+    unsigned long left;
+
+    if ((_vtime_fd < 0) && !_native_time_warp) {
+        return 0;
+    }
+
+    /* keep signals pending until we wait for them, so none can get lost */
+    sigemptyset(&sigmask);
+    sigaddset(&sigmask, SIGALRM);
+    sigaddset(&sigmask, SIGIO);
+    sigprocmask(SIG_BLOCK, &sigmask, &oldmask);
+
+    left = _timer_left();
+    if (_vtime_fd >= 0) {
+        /* the time server warps once all instances are idle */
+        _vtime_send(NATIVE_VTIME_IDLE, left ? _vtime_now() + left : NATIVE_VTIME_NONE);
+    }
+    else if (left) {
+        _timer_shift(left);
+    }
+
+    sigsuspend(&oldmask);
+
+    if (_vtime_fd >= 0) {
+        _vtime_send(NATIVE_VTIME_BUSY, 0);
+    }
+
+    sigprocmask(SIG_SETMASK, &oldmask, NULL);
+
+    return 1;
 }
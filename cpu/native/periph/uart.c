@@ -67,6 +67,24 @@ static void io_signal_handler(int fd, void *arg)
 
     int is_first = 1;
 
+#ifdef MODULE_PERIPH_UART_RX_BULK
+    if (uart_config[uart].rx_bulk_cb) {
+        /* hand over whatever the host has buffered in one go */
+        uint8_t buf[64];
+        int status;
+        while ((status = real_read(fd, buf, sizeof(buf))) > 0) {
+            DEBUG("read %d bytes from serial port\n", status);
+            uart_config[uart].rx_bulk_cb(uart_config[uart].arg, buf, status);
+        }
+        if (status == -1 && errno != EAGAIN) {
+            DEBUG("error: cannot read from serial port\n");
+            uart_config[uart].rx_bulk_cb = NULL;
+        }
+        native_async_read_continue(fd);
+        return;
+    }
+#endif
+
     while (1) {
         char c;
         int status = real_read(fd, &c, 1);
@@ -98,7 +116,8 @@ static void io_signal_handler(int fd, void *arg)
     native_async_read_continue(fd);
 }
 
-int uart_init(uart_t uart, uint32_t baudrate, uart_rx_cb_t rx_cb, void *arg)
+static int _init(uart_t uart, uint32_t baudrate, uart_rx_cb_t rx_cb,
+                 uart_rx_bulk_cb_t rx_bulk_cb, void *arg)
 {
     if (uart >= UART_NUMOF) {
         return UART_NODEV;
@@ -165,6 +184,11 @@ int uart_init(uart_t uart, uint32_t baudrate, uart_rx_cb_t rx_cb, void *arg)
     tcsetattr(tty_fds[uart], TCSANOW, &termios);
 
     uart_config[uart].rx_cb = rx_cb;
+#ifdef MODULE_PERIPH_UART_RX_BULK
+    uart_config[uart].rx_bulk_cb = rx_bulk_cb;
+#else
+    (void)rx_bulk_cb;
+#endif
     uart_config[uart].arg = arg;
 
     native_async_read_setup();
@@ -173,6 +197,19 @@ int uart_init(uart_t uart, uint32_t baudrate, uart_rx_cb_t rx_cb, void *arg)
     return UART_OK;
 }
 
+int uart_init(uart_t uart, uint32_t baudrate, uart_rx_cb_t rx_cb, void *arg)
+{
+    return _init(uart, baudrate, rx_cb, NULL, arg);
+}
+
+#ifdef MODULE_PERIPH_UART_RX_BULK
+int uart_init_rx_bulk(uart_t uart, uint32_t baudrate, uart_rx_bulk_cb_t rx_cb,
+                      void *arg)
+{
+    return _init(uart, baudrate, NULL, rx_cb, arg);
+}
+#endif
+
 void uart_write(uart_t uart, const uint8_t *data, size_t len)
 {
     DEBUG("writing to serial port ");
@@ -62,6 +62,8 @@ pid_t _native_pid;
 pid_t _native_id;
 unsigned _native_rng_seed = 0;
 int _native_rng_mode = 0;
+int _native_time_warp = 0;
+char *_native_vtime_server = NULL;
 const char *_native_unix_socket_path = NULL;
 
 #ifdef MODULE_NETDEV_TAP
@@ -95,7 +97,7 @@ socket_zep_params_t socket_zep_params[SOCKET_ZEP_MAX];
 extern char eeprom_file[EEPROM_FILEPATH_MAX_LEN];
 #endif
 
-static const char short_opts[] = ":hi:s:deEoc:"
+static const char short_opts[] = ":hi:s:deEoc:TV:"
 #ifdef MODULE_PERIPH_GPIO_LINUX
     "g:"
 #endif
@@ -134,6 +136,8 @@ static const struct option long_opts[] = {
     { "stderr-noredirect", no_argument, NULL, 'E' },
     { "stdout-pipe", no_argument, NULL, 'o' },
     { "uart-tty", required_argument, NULL, 'c' },
+    { "time-warp", no_argument, NULL, 'T' },
+    { "vtime", required_argument, NULL, 'V' },
 #ifdef MODULE_PERIPH_GPIO_LINUX
     { "gpio", required_argument, NULL, 'g' },
 #endif
@@ -284,7 +288,7 @@ void usage_exit(int status)
         real_printf(" <tap interface %d>", i + 1);
     }
 #endif
-    real_printf(" [-i <id>] [-d] [-e|-E] [-o] [-c <tty>]");
+    real_printf(" [-i <id>] [-d] [-e|-E] [-o] [-c <tty>] [-T|-V <addr>[:<port>]]");
 #ifdef MODULE_PERIPH_GPIO_LINUX
     real_printf(" [-g <gpiochip>]");
 #endif
@@ -329,6 +333,13 @@ void usage_exit(int status)
 "    -c <tty>, --uart-tty=<tty>\n"
 "        specify TTY device for UART. This argument can be used multiple\n"
 "        times (up to UART_NUMOF)\n"
+"    -T, --time-warp\n"
+"        skip idle periods: when all threads sleep, advance the timer to the\n"
+"        next deadline instead of waiting for it in real time\n"
+"    -V <addr>[:<port>], --vtime=<addr>[:<port>]\n"
+"        share a virtual clock with other instances through a time server\n"
+"        (dist/tools/vtime_server), idle periods are skipped once all\n"
+"        instances are idle\n"
 #ifdef MODULE_PERIPH_GPIO_LINUX
 "    -g <gpio>, --gpio=<gpio>\n"
 "        specify gpiochip device for GPIO access.\n"
@@ -579,6 +590,12 @@ __attribute__((constructor)) static void startup(int argc, char **argv, char **e
             case 'c':
                 tty_uart_setup(uart++, optarg);
                 break;
+            case 'T':
+                _native_time_warp = 1;
+                break;
+            case 'V':
+                _native_vtime_server = optarg;
+                break;
 #ifdef MODULE_MTD_NATIVE
             case 'm':
                 ((mtd_native_dev_t *)mtd_dev_get(0))->fname = strndup(optarg, PATH_MAX - 1);
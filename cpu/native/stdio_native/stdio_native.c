@@ -13,17 +13,54 @@
  * @author  Martine S. Lenders <m.lenders@fu-berlin.de>
  */
 
+#include "async_read.h"
+#include "isrpipe.h"
 #include "kernel_defines.h"
 #include "native_internal.h"
 
 #include "stdio_base.h"
 
+static uint8_t _rx_buf_mem[STDIO_RX_BUFSIZE];
+static isrpipe_t _rx = ISRPIPE_INIT(_rx_buf_mem);
+static bool _rx_async;
+
+static void _stdin_isr(int fd, void *arg)
+{
+    (void)arg;
+    uint8_t buf[64];
+
+    ssize_t res = real_read(fd, buf, sizeof(buf));
+    if (res <= 0) {
+        /* end of input, stop watching stdin */
+        return;
+    }
+
+    for (ssize_t i = 0; i < res; i++) {
+        isrpipe_write_one(&_rx, buf[i]);
+    }
+
+    native_async_read_continue(fd);
+}
+
 void stdio_init(void)
 {
 }
 
 ssize_t stdio_read(void* buffer, size_t max_len)
 {
+    /* When idle time is skipped, a thread waiting for input must not block
+     * the whole process in read() but leave the CPU to the idle thread.
+     * The command line is only parsed after stdio_init(), so set this up
+     * on first use. */
+    if (_native_time_warp || _native_vtime_server) {
+        if (!_rx_async) {
+            _rx_async = true;
+            native_async_read_setup();
+            native_async_read_add_int_handler(STDIN_FILENO, NULL, _stdin_isr);
+        }
+        return isrpipe_read(&_rx, buffer, max_len);
+    }
+
     return real_read(STDIN_FILENO, buffer, max_len);
 }
 
@@ -73,6 +73,8 @@ static uint8_t rx_buf[UART_NUMOF];
 
 #ifdef MODULE_PERIPH_UART_NONBLOCKING
 
+#include "assert.h"
+#include "macros/utils.h"
 #include "tsrb.h"
 /**
  * @brief   Allocate for tx ring buffers
@@ -421,6 +423,24 @@ static void irq_handler(uart_t uart)
     cortexm_isr_end();
 }
 
+#ifdef MODULE_PERIPH_UART_NONBLOCKING
+size_t uart_write_async(uart_t uart, const uint8_t *data, size_t len)
+{
+    /* uart_write() does not wait while the ring buffer has room */
+    len = MIN(len, tsrb_free(&uart_tx_rb[uart]));
+    uart_write(uart, data, len);
+    return len;
+}
+
+void uart_flush(uart_t uart)
+{
+    assert(!irq_is_in() && !__get_PRIMASK());
+
+    /* the ISR clears TXSTARTED once the last byte is out */
+    while (!tsrb_empty(&uart_tx_rb[uart]) || uart_config[uart].dev->EVENTS_TXSTARTED) {}
+}
+#endif
+
 #else /* UART without EasyDMA*/
 
 void uart_write(uart_t uart, const uint8_t *data, size_t len)
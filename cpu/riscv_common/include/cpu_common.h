@@ -57,6 +57,18 @@ static inline uintptr_t cpu_get_caller_pc(void)
     return 0;
 }
 
+/**
+ * @brief   Returns the program counter of the code interrupted by the
+ *          current ISR
+ *
+ * @pre     Called in interrupt context
+ */
+static inline uintptr_t cpu_get_interrupted_pc(void)
+{
+    /* interrupts do not nest, so mepc always points into the thread */
+    return read_csr(mepc);
+}
+
 /**
  * @brief   Convenience function to set bit flags in a register
  *
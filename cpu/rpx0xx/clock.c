@@ -19,14 +19,20 @@
  */
 
 #include <assert.h>
+#include <errno.h>
 #include <stdbool.h>
 #include <stdint.h>
 
 #include "vendor/RP2040.h"
 #include "vendor/system_RP2040.h"
 #include "io_reg.h"
+#include "irq.h"
 #include "periph_cpu.h"
 
+/* frequency of clk_sys, as configured by the last call to one of the
+ * clock_sys_*() functions */
+static uint32_t _clk_sys_freq = MHZ(12);
+
 static void _clk_sys_set_source(CLOCKS_CLK_SYS_CTRL_SRC_Enum source)
 {
     io_reg_write_dont_corrupt(&CLOCKS->CLK_SYS_CTRL, source << CLOCKS_CLK_SYS_CTRL_SRC_Pos,
@@ -69,6 +75,7 @@ void clock_sys_configure_source(uint32_t f_in, uint32_t f_out, CLOCKS_CLK_SYS_CT
     CLOCKS->CLK_SYS_DIV = div;
     /* poll SELECTED until the switch is completed */
     while (!(CLOCKS->CLK_SYS_SELECTED & (1U << source))) { }
+    _clk_sys_freq = f_out;
 }
 
 void clock_sys_configure_aux_source(uint32_t f_in, uint32_t f_out,
@@ -88,6 +95,39 @@ void clock_sys_configure_aux_source(uint32_t f_in, uint32_t f_out,
     _clk_sys_set_source(CLOCKS_CLK_SYS_CTRL_SRC_clksrc_clk_sys_aux);
     /* poll SELECTED until the switch is completed */
     while (!(CLOCKS->CLK_SYS_SELECTED & (1U << CLOCKS_CLK_SYS_CTRL_SRC_clksrc_clk_sys_aux))) { }
+    _clk_sys_freq = f_out;
+}
+
+int clock_sys_set_freq(uint32_t f_hz)
+{
+    if ((f_hz == 0) || (f_hz > CLOCK_CORECLOCK)) {
+        return -EINVAL;
+    }
+    uint64_t div = (((uint64_t)CLOCK_CORECLOCK) << CLOCKS_CLK_SYS_DIV_INT_Pos) / f_hz;
+    if (div > CLOCKS_CLK_SYS_DIV_INT_Msk) {
+        return -EINVAL;
+    }
+
+    bool periph_follows = CLOCK_PERIPH_SOURCE == CLOCKS_CLK_PERI_CTRL_AUXSRC_clk_sys;
+    unsigned state = irq_disable();
+    if (periph_follows && IS_USED(MODULE_PERIPH_UART)) {
+        uart_clock_change_prepare();
+    }
+    /* the divider of clk_sys is glitchless and may be changed while the
+     * clock is running, so neither the PLL nor the mux need to be touched */
+    CLOCKS->CLK_SYS_DIV = div;
+    _clk_sys_freq = ((uint64_t)CLOCK_CORECLOCK << CLOCKS_CLK_SYS_DIV_INT_Pos) / div;
+    if (periph_follows && IS_USED(MODULE_PERIPH_UART)) {
+        uart_clock_change_done();
+    }
+    irq_restore(state);
+
+    return 0;
+}
+
+uint32_t clock_sys_get_freq(void)
+{
+    return _clk_sys_freq;
 }
 
 void clock_ref_configure_source(uint32_t f_in, uint32_t f_out, CLOCKS_CLK_REF_CTRL_SRC_Enum source)
@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     cpu_rpx0xx
+ * @{
+ *
+ * @file
+ * @brief       Second core and inter-core FIFOs
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <stdint.h>
+
+#include "cpu.h"
+#include "io_reg.h"
+#include "periph_cpu.h"
+#include "vendor/RP2040.h"
+
+static void (*_entry)(void *arg);
+static void *_arg;
+static core_fifo_cb_t _fifo_cb;
+static void *_fifo_arg;
+
+static void _core1_main(void)
+{
+    _entry(_arg);
+
+    while (1) {
+        __WFE();
+    }
+}
+
+void core1_stop(void)
+{
+    io_reg_atomic_set(&PSM->FRCE_OFF, PSM_FRCE_OFF_proc1_Msk);
+    while (!(PSM->FRCE_OFF & PSM_FRCE_OFF_proc1_Msk)) { }
+}
+
+void core1_start(void (*entry)(void *arg), void *arg,
+                 void *stack, size_t stack_size)
+{
+    assert(core_id() == 0);
+
+    core1_stop();
+    /* the echoes of the boot ROM must not end up in the callback */
+    NVIC_DisableIRQ(SIO_IRQ_PROC0_IRQn);
+    _entry = entry;
+    _arg = arg;
+    /* the boot ROM of core 1 waits for this sequence to be echoed on the
+     * FIFOs, see section 2.8.2 of the RP2040 data sheet */
+    const uint32_t cmds[] = {
+        0, 0, 1,
+        SCB->VTOR,
+        ((uintptr_t)stack + stack_size) & ~(uintptr_t)7,
+        (uintptr_t)_core1_main,
+    };
+    io_reg_atomic_clear(&PSM->FRCE_OFF, PSM_FRCE_OFF_proc1_Msk);
+
+    unsigned i = 0;
+    while (i < ARRAY_SIZE(cmds)) {
+        if (cmds[i] == 0) {
+            /* drain stale values, the other core may be waiting for us */
+            uint32_t stale;
+            while (core_fifo_try_pop(&stale)) { }
+            __SEV();
+        }
+        core_fifo_push(cmds[i]);
+        /* restart the sequence if the echo does not match */
+        i = (core_fifo_pop() == cmds[i]) ? i + 1 : 0;
+    }
+
+    if (_fifo_cb) {
+        NVIC_EnableIRQ(SIO_IRQ_PROC0_IRQn);
+    }
+}
+
+void core_fifo_set_cb(core_fifo_cb_t cb, void *arg)
+{
+    assert(core_id() == 0);
+
+    NVIC_DisableIRQ(SIO_IRQ_PROC0_IRQn);
+    _fifo_cb = cb;
+    _fifo_arg = arg;
+    if (cb) {
+        NVIC_EnableIRQ(SIO_IRQ_PROC0_IRQn);
+    }
+}
+
+void isr_sio_proc0(void)
+{
+    /* clear the sticky overflow and underflow flags */
+    SIO->FIFO_ST = 0xff;
+    _fifo_cb(_fifo_arg);
+    cortexm_isr_end();
+}
@@ -20,6 +20,11 @@
 #ifndef PERIPH_CPU_H
 #define PERIPH_CPU_H
 
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
 #include "cpu.h"
 #include "vendor/RP2040.h"
 #include "io_reg.h"
@@ -587,6 +592,67 @@ void clock_sys_configure_source(uint32_t f_in, uint32_t f_out,
 void clock_sys_configure_aux_source(uint32_t f_in, uint32_t f_out,
                                     CLOCKS_CLK_SYS_CTRL_AUXSRC_Enum aux);
 
+/**
+ * @brief   Change the frequency of the system clock at run time
+ *
+ * The system clock keeps running from the PLL configured at boot, only its
+ * divider is changed. This is glitchless and quick, so it can be used to run
+ * e.g. a crypto operation at @ref CLOCK_CORECLOCK and to slow down again
+ * afterwards to save power. The divider has a fractional part, but integer
+ * fractions of @ref CLOCK_CORECLOCK give a clock without jitter.
+ *
+ * If the peripheral clock is sourced from the system clock (the default,
+ * see @ref CLOCK_PERIPH_SOURCE), the baud rates of all UARTs are adjusted
+ * and SPI buses use the new clock on the next call to spi_acquire(). Do not
+ * change the clock while an SPI bus is acquired. PWM and PIO state machines
+ * (including the PIO I2C) that are already running are not adjusted and
+ * scale with the system clock, configure them again to restore their rate.
+ * ztimer is not affected, the timer is fed from the reference clock.
+ *
+ * @param   f_hz        New frequency of the system clock, at most
+ *                      @ref CLOCK_CORECLOCK
+ *
+ * @retval  0           on success
+ * @retval  -EINVAL     @p f_hz is out of range
+ */
+int clock_sys_set_freq(uint32_t f_hz);
+
+/**
+ * @brief   Get the current frequency of the system clock
+ *
+ * @return  Frequency of the system clock in Hz, which is
+ *          @ref CLOCK_CORECLOCK unless changed by clock_sys_set_freq()
+ */
+uint32_t clock_sys_get_freq(void);
+
+/**
+ * @brief   Get the current frequency of the peripheral clock
+ *
+ * @return  Frequency of the peripheral clock in Hz
+ */
+static inline uint32_t clock_periph_get_freq(void)
+{
+    if (CLOCK_PERIPH_SOURCE == CLOCKS_CLK_PERI_CTRL_AUXSRC_clk_sys) {
+        return clock_sys_get_freq();
+    }
+    return CLOCK_PERIPH;
+}
+
+/**
+ * @brief   Wait for all UARTs to become idle before the peripheral clock
+ *          changes
+ *
+ * @note    Called by clock_sys_set_freq() with interrupts disabled
+ */
+void uart_clock_change_prepare(void);
+
+/**
+ * @brief   Adjust the baud rates of all UARTs to a new peripheral clock
+ *
+ * @note    Called by clock_sys_set_freq() with interrupts disabled
+ */
+void uart_clock_change_done(void);
+
 /**
  * @brief   Configure the reference clock to run from a clock source,
  *          which is either the ROSC or the XOSC
@@ -779,6 +845,148 @@ void rosc_stop(void);
 
 /** @} */
 
+/**
+ * @name    RP2040 second core
+ *
+ * RIOT runs on core 0 only. Core 1 can be started to run a single function,
+ * e.g. a signal processing loop, outside of the RIOT scheduler. That
+ * function must not call into the kernel (no threads, mutexes, msg or
+ * ztimer) and must not enable interrupts in the NVIC of core 1, as it shares
+ * the vector table with core 0. Use the inter-core FIFOs and the hardware
+ * spinlocks to exchange data with RIOT.
+ *
+ * The FIFOs carry up to 8 words per direction. For larger amounts of data, a
+ * @ref tsrb_t in RAM with one producer and one consumer can be shared between
+ * the cores, with a word pushed to the FIFO as doorbell: as each side only
+ * updates its own counter and the Cortex-M0+ does not reorder memory
+ * accesses, no lock is needed. On core 0, core_fifo_set_cb() turns the
+ * doorbell into an interrupt, e.g. to wake a thread.
+ * @{
+ */
+
+/**
+ * @brief   Hardware spinlocks reserved for use by the application
+ *
+ * All 32 hardware spinlocks are free, RIOT uses none of them.
+ */
+#define SIO_SPINLOCK_NUMOF      (32U)
+
+/**
+ * @brief   Reset core 1 and let it run @p entry on the given stack
+ *
+ * @param   entry       Function to run on core 1, core 1 sleeps if it returns
+ * @param   arg         Argument passed to @p entry
+ * @param   stack       Stack for core 1
+ * @param   stack_size  Size of @p stack in bytes
+ *
+ * @pre     Must be called from core 0, the inter-core FIFOs are not in use
+ */
+void core1_start(void (*entry)(void *arg), void *arg,
+                 void *stack, size_t stack_size);
+
+/**
+ * @brief   Keep core 1 in reset
+ */
+void core1_stop(void);
+
+/**
+ * @brief   Callback run in interrupt context on core 0 when core 1 wrote to
+ *          the FIFO
+ */
+typedef void (*core_fifo_cb_t)(void *arg);
+
+/**
+ * @brief   Set the callback run on core 0 when the FIFO from core 1 is not
+ *          empty
+ *
+ * The callback must read all values with core_fifo_try_pop(), as it is
+ * called again as long as the FIFO is not empty.
+ *
+ * @param   cb      Callback to run, `NULL` to disable the interrupt
+ * @param   arg     Argument passed to @p cb
+ *
+ * @pre     Must be called from core 0
+ */
+void core_fifo_set_cb(core_fifo_cb_t cb, void *arg);
+
+/**
+ * @brief   Get the number of the core calling this function
+ */
+static inline unsigned core_id(void)
+{
+    return SIO->CPUID;
+}
+
+/**
+ * @brief   Write @p value to the FIFO to the other core, block while it is
+ *          full
+ */
+static inline void core_fifo_push(uint32_t value)
+{
+    while (!(SIO->FIFO_ST & SIO_FIFO_ST_RDY_Msk)) { }
+    SIO->FIFO_WR = value;
+    /* wake the other core in case it waits in core_fifo_pop() */
+    __SEV();
+}
+
+/**
+ * @brief   Read a value from the FIFO from the other core, sleep while it is
+ *          empty
+ *
+ * @warning Do not call from a thread on core 0 while other threads should
+ *          run, as this sleeps without giving the CPU to the scheduler.
+ */
+static inline uint32_t core_fifo_pop(void)
+{
+    while (!(SIO->FIFO_ST & SIO_FIFO_ST_VLD_Msk)) {
+        __WFE();
+    }
+    return SIO->FIFO_RD;
+}
+
+/**
+ * @brief   Read a value from the FIFO from the other core, if any
+ *
+ * @param[out]  value   The value read
+ *
+ * @retval  true    @p value was read
+ * @retval  false   The FIFO is empty
+ */
+static inline bool core_fifo_try_pop(uint32_t *value)
+{
+    if (!(SIO->FIFO_ST & SIO_FIFO_ST_VLD_Msk)) {
+        return false;
+    }
+    *value = SIO->FIFO_RD;
+    return true;
+}
+
+/**
+ * @brief   Spin until hardware spinlock @p num is taken
+ *
+ * @note    Disable interrupts on core 0 around the critical section if it is
+ *          shared with an ISR.
+ */
+static inline void sio_spinlock_lock(unsigned num)
+{
+    assert(num < SIO_SPINLOCK_NUMOF);
+    /* reading returns non-zero if the lock was acquired */
+    while (!(&SIO->SPINLOCK0)[num]) { }
+    __DMB();
+}
+
+/**
+ * @brief   Release hardware spinlock @p num
+ */
+static inline void sio_spinlock_unlock(unsigned num)
+{
+    assert(num < SIO_SPINLOCK_NUMOF);
+    __DMB();
+    (&SIO->SPINLOCK0)[num] = 0;
+}
+
+/** @} */
+
 /**
  * @brief   Override SPI clock speed values
  * @{
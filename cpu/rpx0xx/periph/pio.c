@@ -424,8 +424,9 @@ void pio_sm_set_sideset_target(pio_t pio, pio_sm_t sm, bool pindir)
 
 pio_sm_clkdiv_t pio_sm_clkdiv(uint32_t f_hz)
 {
-    uint32_t div = CLOCK_CORECLOCK / f_hz;
-    uint32_t frac = (((uint64_t)100 * CLOCK_CORECLOCK) / f_hz) - (100 * div);
+    uint32_t f_sys = clock_sys_get_freq();
+    uint32_t div = f_sys / f_hz;
+    uint32_t frac = (((uint64_t)100 * f_sys) / f_hz) - (100 * div);
 
     assert(div > 0);
     assert((div < PIO_SM_CLKDIV_MAX) || (div == PIO_SM_CLKDIV_MAX && frac == 0));
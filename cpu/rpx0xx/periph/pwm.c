@@ -53,7 +53,7 @@ static inline pwm_slice_reg_t *pwm_slice(unsigned slice_idx)
     return &PWM_REG->slices[slice_idx];
 }
 
-/* PWM block is feed by RP2040 sysclk (CLOCK_CORECLOCK) */
+/* PWM block is feed by RP2040 sysclk, see clock_sys_get_freq() */
 uint32_t pwm_init(pwm_t pwm, pwm_mode_t mode, uint32_t freq, uint16_t res)
 {
     uint8_t div_int;
@@ -61,6 +61,7 @@ uint32_t pwm_init(pwm_t pwm, pwm_mode_t mode, uint32_t freq, uint16_t res)
     uint32_t val;
     uint32_t ret;
     uint8_t slice = pwm_config[pwm].pwm_slice;
+    uint32_t f_sys = clock_sys_get_freq();
 
     (void)mode;
 
@@ -78,7 +79,7 @@ uint32_t pwm_init(pwm_t pwm, pwm_mode_t mode, uint32_t freq, uint16_t res)
 
     /* Compute DIV register value to get closest match for
        freq and res variables */
-    val = (((uint32_t)CLOCK_CORECLOCK) << 4) / (freq * res);
+    val = (f_sys << 4) / (freq * res);
     /* If the value is above 4095, we will not be able to reach the desired
        frequency so set the divisor value to maximum to get to the closest
        possible value for the PWM frequency */
@@ -90,7 +91,7 @@ uint32_t pwm_init(pwm_t pwm, pwm_mode_t mode, uint32_t freq, uint16_t res)
         div_int = val / 16;
     }
     /* Compute the real frequency we will get */
-    ret = CLOCK_CORECLOCK / (res * (div_int + (div_frac / 16)));
+    ret = f_sys / (res * (div_int + (div_frac / 16)));
 
     DEBUG("[pwm]: div_int:%d, div_frac:%d\n", div_int, div_frac);
     /* Set the slice divider to reach the desired frequency */
@@ -120,6 +121,7 @@ void pwm_set(pwm_t pwm, uint8_t channel, uint16_t value)
 {
     assert((pwm < PWM_NUMOF) && (channel < PWM_CHANNEL_NUMOF));
     uint8_t slice = pwm_config[pwm].pwm_slice;
+    uint32_t f_sys = clock_sys_get_freq();
 
     /* Set channel compare value */
     if (channel) {
@@ -138,6 +140,7 @@ void pwm_poweron(pwm_t pwm)
 {
     assert(pwm < PWM_NUMOF);
     uint8_t slice = pwm_config[pwm].pwm_slice;
+    uint32_t f_sys = clock_sys_get_freq();
     io_reg_atomic_set(&PWM->EN, 1 << slice);
 }
 
@@ -145,5 +148,6 @@ void pwm_poweroff(pwm_t pwm)
 {
     assert(pwm < PWM_NUMOF);
     uint8_t slice = pwm_config[pwm].pwm_slice;
+    uint32_t f_sys = clock_sys_get_freq();
     io_reg_atomic_clear(&PWM->EN, 1 << slice);
 }
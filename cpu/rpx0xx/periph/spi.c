@@ -38,6 +38,7 @@ static mutex_t locks[SPI_NUMOF];
  */
 typedef struct {
     spi_clk_t clk;
+    uint32_t f_periph;  /**< peripheral clock the prescalers are valid for */
     uint8_t cpsdvsr;
     uint8_t scr;
 } _pl022_clk_t;
@@ -215,9 +216,10 @@ static inline void _check_best_clk_result(uint16_t target_dvsr,
     }
 }
 
-static void _calc_pl022_clk(_pl022_clk_t *pl022_clk, spi_clk_t clk)
+static void _calc_pl022_clk(_pl022_clk_t *pl022_clk, spi_clk_t clk,
+                            uint32_t f_periph)
 {
-    uint16_t dvsr = CLOCK_PERIPH / clk;
+    uint16_t dvsr = f_periph / clk;
     /* The divisor must be split into two 8-bit divisors, cpsdvsr and scr,
      * dvsr = cpsdvsr*scr. cpsdvsr must be an even number greater than 0. */
     uint8_t cpsdvsr = 2, best_cpsdvsr = 2;
@@ -243,9 +245,10 @@ static void _calc_pl022_clk(_pl022_clk_t *pl022_clk, spi_clk_t clk)
                                    &best_scr, &best_cpsdvsr);
         }
     }
-    uint32_t resulting_clk_hz = CLOCK_PERIPH / (best_cpsdvsr * best_scr);
+    uint32_t resulting_clk_hz = f_periph / (best_cpsdvsr * best_scr);
 
     pl022_clk->clk = clk;
+    pl022_clk->f_periph = f_periph;
     pl022_clk->cpsdvsr = best_cpsdvsr;
     /* For scr, +1 is added internally. */
     pl022_clk->scr = (best_scr - 1);
@@ -298,8 +301,9 @@ void spi_acquire(spi_t spi, spi_cs_t cs, spi_mode_t mode, spi_clk_t clk)
     }
 
     /* set clock speed */
-    if (clk != pl022_clk[spi].clk) {
-        _calc_pl022_clk(&pl022_clk[spi], clk);
+    uint32_t f_periph = clock_periph_get_freq();
+    if ((clk != pl022_clk[spi].clk) || (f_periph != pl022_clk[spi].f_periph)) {
+        _calc_pl022_clk(&pl022_clk[spi], clk, f_periph);
     }
     io_reg_write_dont_corrupt(&dev->SSPCPSR,
                               pl022_clk[spi].cpsdvsr << SPI0_SSPCPSR_CPSDVSR_Pos,
@@ -39,9 +39,10 @@
 
 static uart_isr_ctx_t ctx[UART_NUMOF];
 
+/* symbol rates, to recompute the dividers when the peripheral clock changes */
+static uint32_t _baud[UART_NUMOF];
+
 /* back up values of registers used during uart_poweroff() / uart_poweron() */
-static uint32_t uartibrd;
-static uint32_t uartfbrd;
 static uint32_t uartlcr_h;
 static uint32_t uartcr;
 
@@ -56,7 +57,7 @@ void _set_symbolrate(uart_t uart, uint32_t baud)
 {
     assert(baud != 0);
     UART0_Type *dev = uart_config[uart].dev;
-    uint32_t baud_rate_div = (8 * CLOCK_PERIPH / baud);
+    uint32_t baud_rate_div = (8 * clock_periph_get_freq() / baud);
     uint32_t baud_ibrd = baud_rate_div >> 7;
     uint32_t baud_fbrd;
 
@@ -74,6 +75,7 @@ void _set_symbolrate(uart_t uart, uint32_t baud)
 
     dev->UARTIBRD = baud_ibrd;
     dev->UARTFBRD = baud_fbrd;
+    _baud[uart] = baud;
 }
 
 int uart_mode(uart_t uart, uart_data_bits_t data_bits, uart_parity_t uart_parity,
@@ -166,9 +168,11 @@ void uart_poweron(uart_t uart)
     assert((unsigned)uart < UART_NUMOF);
     _poweron(uart);
     UART0_Type *dev = uart_config[uart].dev;
-    /* restore configuration registers */
-    dev->UARTIBRD = uartibrd;
-    dev->UARTFBRD = uartfbrd;
+    /* restore configuration registers, the peripheral clock may have changed
+     * while powered off */
+    if (_baud[uart]) {
+        _set_symbolrate(uart, _baud[uart]);
+    }
     dev->UARTLCR_H = uartlcr_h;
     dev->UARTCR = uartcr;
     /* restore IRQs, if needed */
@@ -183,8 +187,6 @@ void uart_poweroff(uart_t uart)
     assert((unsigned)uart < UART_NUMOF);
     UART0_Type *dev = uart_config[uart].dev;
     /* backup configuration registers */
-    uartibrd = dev->UARTIBRD;
-    uartfbrd = dev->UARTFBRD;
     uartlcr_h = dev->UARTLCR_H;
     uartcr = dev->UARTCR;
     /* disconnect GPIOs and power off peripheral */
@@ -226,6 +228,38 @@ int uart_init(uart_t uart, uint32_t baud, uart_rx_cb_t rx_cb, void *arg)
     return UART_OK;
 }
 
+static bool _is_powered(uart_t uart)
+{
+    uint32_t reset_bit_mask = (uart) ? RESETS_RESET_uart1_Msk : RESETS_RESET_uart0_Msk;
+    return (_baud[uart] != 0) && !(RESETS->RESET & reset_bit_mask);
+}
+
+void uart_clock_change_prepare(void)
+{
+    for (uart_t uart = 0; uart < UART_NUMOF; uart++) {
+        if (_is_powered(uart)) {
+            UART0_Type *dev = uart_config[uart].dev;
+            /* let the last char leave with the old symbol rate */
+            while (dev->UARTFR & UART0_UARTFR_BUSY_Msk) { }
+        }
+    }
+}
+
+void uart_clock_change_done(void)
+{
+    for (uart_t uart = 0; uart < UART_NUMOF; uart++) {
+        if (_is_powered(uart)) {
+            UART0_Type *dev = uart_config[uart].dev;
+            uint32_t cr = dev->UARTCR;
+            io_reg_atomic_clear(&dev->UARTCR, UART0_UARTCR_UARTEN_Msk);
+            _set_symbolrate(uart, _baud[uart]);
+            /* the new dividers only take effect after writing UARTLCR_H */
+            dev->UARTLCR_H = dev->UARTLCR_H;
+            dev->UARTCR = cr;
+        }
+    }
+}
+
 void uart_write(uart_t uart, const uint8_t *data, size_t len)
 {
     assert((unsigned)uart < UART_NUMOF);
@@ -954,6 +954,17 @@ typedef enum {
 #define ETH_TX_BUFFER_COUNT (2)
 #endif
 
+/**
+ * @brief   Number of TX DMA descriptors
+ *
+ * Frames are sent straight from the caller's buffers with one descriptor per
+ * chunk. Frames with as many chunks as descriptors or more are copied into one
+ * of the @ref ETH_TX_BUFFER_COUNT bounce buffers instead.
+ */
+#ifndef ETH_TX_DESCRIPTOR_COUNT
+#define ETH_TX_DESCRIPTOR_COUNT (8)
+#endif
+
 #ifndef ETH_RX_BUFFER_SIZE
 #define ETH_RX_BUFFER_SIZE (1536)
 #endif
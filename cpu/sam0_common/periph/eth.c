@@ -23,6 +23,7 @@
 #include "net/eui48.h"
 #include "net/ethernet.h"
 #include "net/netdev/eth.h"
+#include "net/netstats.h"
 
 #include "periph/gpio.h"
 
@@ -79,7 +80,7 @@ struct eth_buf_desc {
 #define GMAC_DESC_ALIGNMENT 8
 #define GMAC_BUF_ALIGNMENT  32
 static struct eth_buf_desc rx_desc[ETH_RX_BUFFER_COUNT] __attribute__((aligned(GMAC_DESC_ALIGNMENT)));
-static struct eth_buf_desc tx_desc[ETH_TX_BUFFER_COUNT] __attribute__((aligned(GMAC_DESC_ALIGNMENT)));
+static struct eth_buf_desc tx_desc[ETH_TX_DESCRIPTOR_COUNT] __attribute__((aligned(GMAC_DESC_ALIGNMENT)));
 
 static struct eth_buf_desc *rx_curr;
 static struct eth_buf_desc *tx_curr;
@@ -88,6 +89,13 @@ static struct eth_buf_desc *tx_curr;
    GMAC IP have its own indexes on its side */
 static uint8_t  tx_idx;
 static uint8_t  rx_idx;
+/* TX bounce buffer used for frames with too many chunks */
+static uint8_t  tx_buf_idx;
+/* Length of the last frame sent */
+static unsigned tx_len_last;
+/* Ring occupancy, reported via NETOPT_STATS */
+static uint16_t tx_ring_max;
+static uint16_t rx_ring_max;
 
 static uint8_t  rx_buf[ETH_RX_BUFFER_COUNT][ETH_RX_BUFFER_SIZE] __attribute__((aligned(GMAC_BUF_ALIGNMENT)));
 static uint8_t  tx_buf[ETH_TX_BUFFER_COUNT][ETH_TX_BUFFER_SIZE] __attribute__((aligned(GMAC_BUF_ALIGNMENT)));
@@ -182,9 +190,9 @@ static void _init_desc_buf(void)
     /* Set WRAP flag to indicate last buffer */
     rx_desc[i-1].address |= DESC_RX_ADDR_WRAP;
     rx_curr = &rx_desc[0];
-    /* Initialize TX buffer descriptors */
-    for (i=0; i < ETH_TX_BUFFER_COUNT; i++) {
-        tx_desc[i].address = (uint32_t) tx_buf[i];
+    /* Initialize TX buffer descriptors, buffers are assigned on send */
+    for (i=0; i < ETH_TX_DESCRIPTOR_COUNT; i++) {
+        tx_desc[i].status = DESC_TX_STATUS_USED;
     }
     /* Set WRAP flag to indicate last buffer */
     tx_desc[i-1].status |= DESC_TX_STATUS_WRAP;
@@ -192,6 +200,7 @@ static void _init_desc_buf(void)
     /* Setup buffers index */
     rx_idx = 0;
     tx_idx = 0;
+    tx_buf_idx = 0;
     /* Store RX buffer descriptor list */
     GMAC->RBQB.reg = (uint32_t) rx_desc;
     /* Store TX buffer descriptor list */
@@ -215,53 +224,114 @@ void sam0_eth_get_mac(eui48_t *out)
     out->uint8[0] = (GMAC->Sa[0].SAB.reg);
 }
 
+static void _tx_desc_set(unsigned idx, const void *buf, unsigned len,
+                         uint32_t flags)
+{
+    tx_desc[idx].address = (uint32_t)buf;
+    tx_desc[idx].status = (len & DESC_TX_STATUS_LEN_MASK) | flags
+                        | ((idx == ETH_TX_DESCRIPTOR_COUNT - 1)
+                           ? DESC_TX_STATUS_WRAP : 0);
+}
+
 int sam0_eth_send(const struct iolist *iolist)
 {
     unsigned len = iolist_size(iolist);
-    unsigned tx_len = 0;
-    tx_curr = &tx_desc[tx_idx];
+    unsigned chunks = 0;
+    unsigned first = tx_idx;
 
     if (_is_sleeping) {
         return -ENOTSUP;
     }
 
-    /* load packet data into TX buffer */
+    if (len > ETHERNET_MAX_LEN) {
+        return -EBUSY;
+    }
+
     for (const iolist_t *iol = iolist; iol; iol = iol->iol_next) {
-        if (tx_len + iol->iol_len > ETHERNET_MAX_LEN) {
-            return -EBUSY;
-        }
         if (iol->iol_len) {
-            memcpy ((uint32_t*)(tx_curr->address + tx_len), iol->iol_base, iol->iol_len);
-            tx_len += iol->iol_len;
+            chunks++;
         }
     }
-    if (len == tx_len) {
-        /* Clear and set the frame size */
-        tx_curr->status = (len & DESC_TX_STATUS_LEN_MASK)
-        /* Indicate this is the last buffer and the frame is ready */
-                        | DESC_TX_STATUS_LAST_BUF;
-        /* Prepare next buffer index */
-        if (++tx_idx == ETH_TX_BUFFER_COUNT) {
-            /* Set WRAP flag to indicate last buffer */
-            tx_curr->status |= DESC_TX_STATUS_WRAP;
-            tx_idx = 0;
+
+    /* one descriptor must stay owned by software to stop the DMA at the end
+     * of the frame */
+    if (chunks < ETH_TX_DESCRIPTOR_COUNT) {
+        /* point the descriptors directly at the chunks, the caller keeps
+         * them alive until confirm_send() */
+        unsigned n = 0;
+        for (const iolist_t *iol = iolist; iol; iol = iol->iol_next) {
+            if (!iol->iol_len) {
+                continue;
+            }
+            uint32_t flags = (++n == chunks) ? DESC_TX_STATUS_LAST_BUF : 0;
+            /* the first descriptor is handed over last */
+            if (tx_idx == first) {
+                flags |= DESC_TX_STATUS_USED;
+            }
+            _tx_desc_set(tx_idx, iol->iol_base, iol->iol_len, flags);
+            tx_idx = (tx_idx + 1) % ETH_TX_DESCRIPTOR_COUNT;
         }
-        __DMB();
-        /* Start transmission */
-        GMAC->NCR.reg |= GMAC_NCR_TSTART;
-        /* Set the next buffer */
-        tx_curr = &tx_desc[tx_idx];
     }
     else {
-        DEBUG("Mismatch TX len, abort send\n");
+        /* too fragmented, gather into a bounce buffer */
+        uint8_t *buf = tx_buf[tx_buf_idx];
+        unsigned tx_len = 0;
+        for (const iolist_t *iol = iolist; iol; iol = iol->iol_next) {
+            memcpy(&buf[tx_len], iol->iol_base, iol->iol_len);
+            tx_len += iol->iol_len;
+        }
+        tx_buf_idx = (tx_buf_idx + 1) % ETH_TX_BUFFER_COUNT;
+        _tx_desc_set(tx_idx, buf, len,
+                     DESC_TX_STATUS_LAST_BUF | DESC_TX_STATUS_USED);
+        tx_idx = (tx_idx + 1) % ETH_TX_DESCRIPTOR_COUNT;
+        chunks = 1;
+    }
+
+    if (chunks > tx_ring_max) {
+        tx_ring_max = chunks;
     }
+    tx_len_last = len;
+
+    /* stop the DMA after this frame */
+    tx_desc[tx_idx].status |= DESC_TX_STATUS_USED;
+    __DMB();
+    /* the frame is complete, hand it over to the GMAC */
+    tx_desc[first].status &= ~DESC_TX_STATUS_USED;
+    __DMB();
+    /* Start transmission */
+    GMAC->NCR.reg |= GMAC_NCR_TSTART;
+    /* Set the next buffer */
+    tx_curr = &tx_desc[tx_idx];
+
     return len;
 }
 
 unsigned _sam0_eth_get_last_len(void)
 {
-    unsigned idx = tx_idx ? tx_idx - 1 : ETH_TX_BUFFER_COUNT - 1;
-    return tx_desc[idx].status & DESC_TX_STATUS_LEN_MASK;
+    return tx_len_last;
+}
+
+void sam0_eth_get_ring_stats(netstats_t *stats)
+{
+    stats->tx_ring_max = tx_ring_max;
+    stats->rx_ring_max = rx_ring_max;
+}
+
+void sam0_eth_reset_ring_stats(void)
+{
+    tx_ring_max = 0;
+    rx_ring_max = 0;
+}
+
+static unsigned _rx_ring_fill(void)
+{
+    unsigned filled = 0;
+    for (unsigned i = 0; i < ETH_RX_BUFFER_COUNT; i++) {
+        if (rx_desc[i].address & DESC_RX_ADDR_OWNSHP) {
+            filled++;
+        }
+    }
+    return filled;
 }
 
 static int _try_receive(char* data, unsigned max_len, int block)
@@ -292,6 +362,13 @@ static int _try_receive(char* data, unsigned max_len, int block)
         return -ENOBUFS;
     }
 
+    if (max_len) {
+        unsigned filled = _rx_ring_fill();
+        if (filled > rx_ring_max) {
+            rx_ring_max = filled;
+        }
+    }
+
     for (unsigned cpt=0; cpt < ETH_RX_BUFFER_COUNT; cpt++) {
         /* Get the length of the received frame */
         unsigned len = (rx_curr->status & DESC_RX_STATUS_FRAME_LEN_MASK);
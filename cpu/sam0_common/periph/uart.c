@@ -59,6 +59,7 @@
  * @brief   Allocate memory to store the callback functions & buffers
  */
 #ifdef MODULE_PERIPH_UART_NONBLOCKING
+#include "macros/utils.h"
 #include "tsrb.h"
 static tsrb_t uart_tx_rb[UART_NUMOF];
 static uint8_t uart_tx_rb_buf[UART_NUMOF][UART_TXBUF_SIZE];
@@ -404,6 +405,26 @@ void uart_write(uart_t uart, const uint8_t *data, size_t len)
 #endif
 }
 
+#ifdef MODULE_PERIPH_UART_NONBLOCKING
+size_t uart_write_async(uart_t uart, const uint8_t *data, size_t len)
+{
+    /* uart_write() does not wait while the ring buffer has room */
+    len = MIN(len, tsrb_free(&uart_tx_rb[uart]));
+    uart_write(uart, data, len);
+    return len;
+}
+
+void uart_flush(uart_t uart)
+{
+    assert(!irq_is_in() && !__get_PRIMASK());
+
+    while (!tsrb_empty(&uart_tx_rb[uart])) {}
+    if (dev(uart)->CTRLA.reg & SERCOM_USART_CTRLA_ENABLE) {
+        while (!(dev(uart)->INTFLAG.reg & SERCOM_USART_INTFLAG_TXC)) {}
+    }
+}
+#endif
+
 void uart_poweron(uart_t uart)
 {
     sercom_clk_en(dev(uart));
@@ -683,6 +683,17 @@ static int _usbdev_ep_get(usbdev_ep_t *ep, usbopt_ep_t opt,
         *(size_t *)value = _ep_get_available(ep);
         res = sizeof(size_t);
         break;
+    case USBOPT_EP_MAX_XFER_SIZE:
+        if (ep->dir != USB_EP_DIR_IN) {
+            break;
+        }
+        assert(max_len == sizeof(size_t));
+        /* the peripheral sends BYTE_COUNT bytes in packets of the endpoint
+         * size on its own */
+        *(size_t *)value = USB_DEVICE_PCKSIZE_BYTE_COUNT_Msk
+                           >> USB_DEVICE_PCKSIZE_BYTE_COUNT_Pos;
+        res = sizeof(size_t);
+        break;
     default:
         DEBUG("sam_usb: Unhandled get call: 0x%x\n", opt);
         break;
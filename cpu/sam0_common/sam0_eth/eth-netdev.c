@@ -26,6 +26,7 @@
 #include "net/ethernet.h"
 #include "net/netdev/eth.h"
 #include "net/eui_provider.h"
+#include "net/netstats.h"
 
 #include "periph/gpio.h"
 #include "ztimer.h"
@@ -53,6 +54,8 @@ extern bool sam0_eth_has_queued_pkt(void);
 extern void sam0_eth_set_mac(const eui48_t *mac);
 extern void sam0_eth_get_mac(char *out);
 extern void sam0_clear_rx_buffers(void);
+extern void sam0_eth_get_ring_stats(netstats_t *stats);
+extern void sam0_eth_reset_ring_stats(void);
 extern unsigned sam0_read_phy(uint8_t phy, uint8_t addr);
 extern void sam0_write_phy(uint8_t phy, uint8_t addr, uint16_t data);
 static void _restart_an(void *ctx);
@@ -250,6 +253,11 @@ static int _sam0_eth_get(netdev_t *netdev, netopt_t opt, void *val, size_t max_l
             *(netopt_enable_t *)val = _get_link_status();
             res = sizeof(netopt_enable_t);
             break;
+        case NETOPT_STATS:
+            assert(max_len == sizeof(netstats_t));
+            sam0_eth_get_ring_stats(val);
+            res = sizeof(netstats_t);
+            break;
         default:
             res = netdev_eth_get(netdev, opt, val, max_len);
             break;
@@ -293,6 +301,10 @@ static int _sam0_eth_set(netdev_t *netdev, netopt_t opt, const void *val, size_t
         case NETOPT_STATE:
             assert(max_len <= sizeof(netopt_state_t));
             return _set_state(*((const netopt_state_t *)val));
+        case NETOPT_STATS:
+            sam0_eth_reset_ring_stats();
+            res = 0;
+            break;
         default:
             res = netdev_eth_set(netdev, opt, val, max_len);
             break;
@@ -19,6 +19,7 @@
  * @}
  */
 
+#include "assert.h"
 #include "compiler_hints.h"
 #include "cpu.h"
 #include "irq.h"
@@ -156,3 +157,37 @@ int32_t adc_sample(adc_t line, adc_res_t res)
 
     return sample;
 }
+
+static adc_res_t _continuous_res;
+
+void adc_continuous_begin(adc_res_t res)
+{
+    assert(!(res & 0xff));
+
+    _continuous_res = res;
+    /* lock and power on all devices, lines are mapped to them on sampling */
+    for (unsigned i = 0; i < ADC_DEVS; i++) {
+        mutex_lock(&locks[i]);
+        periph_clk_en(APB2, (RCC_APB2ENR_ADC1EN << i));
+    }
+}
+
+int32_t adc_continuous_sample(adc_t line)
+{
+    assert(line < ADC_NUMOF);
+
+    dev(line)->CR1 = _continuous_res;
+    dev(line)->SQR3 = adc_config[line].chan;
+    dev(line)->CR2 |= ADC_CR2_SWSTART;
+    while (!(dev(line)->SR & ADC_SR_EOC)) {}
+
+    return (int32_t)dev(line)->DR;
+}
+
+void adc_continuous_stop(void)
+{
+    for (unsigned i = 0; i < ADC_DEVS; i++) {
+        periph_clk_dis(APB2, (RCC_APB2ENR_ADC1EN << i));
+        mutex_unlock(&locks[i]);
+    }
+}
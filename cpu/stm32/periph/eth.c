@@ -25,6 +25,7 @@
 #include <string.h>
 
 #include "board.h"
+#include "checksum/crc32.h"
 #include "iolist.h"
 #include "macros/utils.h"
 #include "mii.h"
@@ -32,6 +33,7 @@
 #include "net/ethernet.h"
 #include "net/eui_provider.h"
 #include "net/netdev/eth.h"
+#include "net/netstats.h"
 #include "periph/gpio_ll.h"
 #include "time_units.h"
 
@@ -151,12 +153,19 @@ static edma_desc_t *tx_curr;
 /* RX Buffers */
 static char rx_buffer[ETH_RX_DESCRIPTOR_COUNT][ETH_RX_BUFFER_SIZE];
 
+/* Ring occupancy, reported via NETOPT_STATS */
+static uint16_t _tx_ring_max;
+static uint16_t _rx_ring_max;
+
 /* Netdev used in RIOT's API to upper layer */
 netdev_t *stm32_eth_netdev;
 
 /* Used for checking the link status */
 static uint8_t _link_state = LINK_STATE_DOWN;
 
+/* Number of joined multicast groups per bit of the 64 bit hash table */
+static uint8_t _mcast_hash_cnt[64];
+
 static void _debug_tx_descriptor_info(unsigned line)
 {
     if (IS_ACTIVE(ENABLE_DEBUG) && IS_ACTIVE(ENABLE_DEBUG_VERBOSE)) {
@@ -295,6 +304,50 @@ static void stm32_eth_set_addr(const uint8_t *addr)
     ETH->MACA0LR = (addr[3] << 24) | (addr[2] << 16) | (addr[1] << 8) | addr[0];
 }
 
+static unsigned _mcast_hash_bit(const uint8_t *addr)
+{
+    /* the hash table is indexed by the upper 6 bits of the bit-reversed
+     * CRC32 of the destination address */
+    uint32_t crc = crc32(addr, ETHERNET_ADDR_LEN);
+    unsigned bit = 0;
+
+    for (unsigned i = 0; i < 6; i++) {
+        bit = (bit << 1) | ((crc >> i) & 1);
+    }
+    return bit;
+}
+
+static int _set_mcast_filter(const uint8_t *addr, size_t addr_len, bool join)
+{
+    if ((addr_len != ETHERNET_ADDR_LEN) || !(addr[0] & 0x01)) {
+        return -EINVAL;
+    }
+
+    unsigned bit = _mcast_hash_bit(addr);
+    uint8_t *cnt = &_mcast_hash_cnt[bit];
+    volatile uint32_t *reg = (bit < 32) ? &ETH->MACHTLR : &ETH->MACHTHR;
+
+    if (join) {
+        /* a saturated bit just stays set */
+        if (*cnt < UINT8_MAX) {
+            (*cnt)++;
+        }
+        /* a stack joining groups is expected to join all groups it listens
+         * to, so stop passing all multicast frames */
+        ETH->MACFFR = (ETH->MACFFR & ~ETH_MACFFR_PAM) | ETH_MACFFR_HM;
+    }
+    else if ((*cnt > 0) && (*cnt < UINT8_MAX)) {
+        (*cnt)--;
+    }
+    if (*cnt) {
+        *reg |= 1UL << (bit % 32);
+    }
+    else {
+        *reg &= ~(1UL << (bit % 32));
+    }
+    return ETHERNET_ADDR_LEN;
+}
+
 static void _init_dma_descriptors(void)
 {
     size_t i;
@@ -344,6 +397,15 @@ static int stm32_eth_set(netdev_t *dev, netopt_t opt,
         stm32_eth_set_addr(value);
         res = ETHERNET_ADDR_LEN;
         break;
+    case NETOPT_L2_GROUP:
+    case NETOPT_L2_GROUP_LEAVE:
+        res = _set_mcast_filter(value, max_len, opt == NETOPT_L2_GROUP);
+        break;
+    case NETOPT_STATS:
+        _tx_ring_max = 0;
+        _rx_ring_max = 0;
+        res = 0;
+        break;
     default:
         res = netdev_eth_set(dev, opt, value, max_len);
         break;
@@ -371,6 +433,12 @@ static int stm32_eth_get(netdev_t *dev, netopt_t opt,
         }
         res = sizeof(netopt_enable_t);
         break;
+    case NETOPT_STATS:
+        assert(max_len == sizeof(netstats_t));
+        ((netstats_t *)value)->tx_ring_max = _tx_ring_max;
+        ((netstats_t *)value)->rx_ring_max = _rx_ring_max;
+        res = sizeof(netstats_t);
+        break;
     default:
         res = netdev_eth_get(dev, opt, value, max_len);
         break;
@@ -511,8 +579,12 @@ static int stm32_eth_init(netdev_t *netdev)
 
     /* pass all */
     //ETH->MACFFR |= ETH_MACFFR_RA;
-    /* pass on perfect filter match and pass all multicast address matches */
-    ETH->MACFFR |= ETH_MACFFR_PAM;
+    /* pass on perfect filter match and pass all multicast address matches,
+     * until the first group is joined with NETOPT_L2_GROUP */
+    ETH->MACFFR = (ETH->MACFFR & ~ETH_MACFFR_HM) | ETH_MACFFR_PAM;
+    ETH->MACHTHR = 0;
+    ETH->MACHTLR = 0;
+    memset(_mcast_hash_cnt, 0, sizeof(_mcast_hash_cnt));
 
     /* store forward */
     ETH->DMAOMR |= (ETH_DMAOMR_RSF | ETH_DMAOMR_TSF | ETH_DMAOMR_OSF);
@@ -560,6 +632,11 @@ static int stm32_eth_send(netdev_t *netdev, const struct iolist *iolist)
     assert(iolist_count(iolist) <= ETH_TX_DESCRIPTOR_COUNT);
 
     _debug_tx_descriptor_info(__LINE__);
+    /* the iolist segments are handed to the DMA as they are, no copy */
+    unsigned chunks = iolist_count(iolist);
+    if (chunks > _tx_ring_max) {
+        _tx_ring_max = chunks;
+    }
     edma_desc_t *dma_iter = tx_curr;
     for (unsigned i = 0; iolist; iolist = iolist->iol_next, i++) {
         dma_iter->control = iolist->iol_len;
@@ -708,6 +785,18 @@ static void handle_lost_rx_irqs(void)
     }
 }
 
+static unsigned _rx_ring_fill(void)
+{
+    unsigned filled = 0;
+    edma_desc_t *iter = rx_curr;
+    while (!(iter->status & RX_DESC_STAT_OWN)
+           && (filled < ETH_RX_DESCRIPTOR_COUNT)) {
+        filled++;
+        iter = iter->desc_next;
+    }
+    return filled;
+}
+
 static int stm32_eth_recv(netdev_t *netdev, void *_buf, size_t max_len,
                           void *_info)
 {
@@ -740,6 +829,11 @@ static int stm32_eth_recv(netdev_t *netdev, void *_buf, size_t max_len,
         return -ENOBUFS;
     }
 
+    unsigned filled = _rx_ring_fill();
+    if (filled > _rx_ring_max) {
+        _rx_ring_max = filled;
+    }
+
     /* Fetch payload, collect RX timestamp from last descriptor if module periph_ptp is used, and
      * hand DMA descriptors back to the DMA */
     size_t remain = size;
@@ -72,6 +72,7 @@
 
 #ifdef MODULE_PERIPH_UART_NONBLOCKING
 
+#include "macros/utils.h"
 #include "tsrb.h"
 /**
  * @brief   Allocate for tx ring buffers
@@ -454,6 +455,24 @@ void uart_write(uart_t uart, const uint8_t *data, size_t len)
 #endif
 }
 
+#ifdef MODULE_PERIPH_UART_NONBLOCKING
+size_t uart_write_async(uart_t uart, const uint8_t *data, size_t len)
+{
+    /* uart_write() does not wait while the ring buffer has room */
+    len = MIN(len, tsrb_free(&uart_tx_rb[uart]));
+    uart_write(uart, data, len);
+    return len;
+}
+
+void uart_flush(uart_t uart)
+{
+    assert(!irq_is_in() && !__get_PRIMASK());
+
+    while (!tsrb_empty(&uart_tx_rb[uart])) {}
+    while (!(dev(uart)->ISR_REG & ISR_TC)) {}
+}
+#endif
+
 void uart_poweron(uart_t uart)
 {
     assert(uart < UART_NUMOF);
@@ -0,0 +1,168 @@
+#! /usr/bin/env python3
+#
+# Copyright (C) 2024 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser General
+# Public License v2.1. See the file LICENSE in the top level directory for more
+# details.
+
+"""
+Collect the results of benchmark applications built with the `benchmark_result`
+module and compare them against a stored baseline.
+
+Results are stored as JSON of the form
+
+    {"<board>": {"<application>": {"<benchmark>": {"unit": "ns", "min": ...}}}}
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+import time
+
+RIOTBASE = os.environ.get(
+    "RIOTBASE",
+    os.path.abspath(os.path.join(os.path.dirname(__file__), "..", "..", "..")),
+)
+RESULT_PREFIX = '[{"benchmark"'
+DONE_MARKERS = ("[SUCCESS]", "[FAILED]")
+SYNC_PROMPT = "Press s to start"
+
+
+def parse_output(lines):
+    """Extract the benchmark results from the output of an application"""
+    results = {}
+    for line in lines:
+        line = line.strip()
+        if not line.startswith(RESULT_PREFIX):
+            continue
+        try:
+            entry = json.loads(line)[0]
+        except (ValueError, IndexError):
+            continue
+        name = entry.pop("benchmark")
+        results[name] = entry
+    return results
+
+
+def run_app(app, board, timeout, modules):
+    """Flash @p app to @p board, and return the lines printed by it"""
+    env = dict(os.environ, BOARD=board)
+    env["USEMODULE"] = " ".join([env.get("USEMODULE", "")] + modules).strip()
+    subprocess.run(["make", "-C", app, "all", "flash"], env=env, check=True,
+                   stdout=subprocess.DEVNULL)
+    proc = subprocess.Popen(["make", "-C", app, "term"], env=env,
+                            stdin=subprocess.PIPE, stdout=subprocess.PIPE,
+                            stderr=subprocess.STDOUT, text=True)
+    lines = []
+    deadline = time.monotonic() + timeout
+    try:
+        for line in proc.stdout:
+            lines.append(line)
+            if SYNC_PROMPT in line:
+                # test_utils_interactive_sync waits for the test runner
+                proc.stdin.write("s\n")
+                proc.stdin.flush()
+            if any(marker in line for marker in DONE_MARKERS):
+                break
+            if time.monotonic() > deadline:
+                print(f"{app}: timeout on {board}", file=sys.stderr)
+                break
+    finally:
+        proc.terminate()
+        proc.wait()
+    return lines
+
+
+def collect(args):
+    results = {}
+    if args.output and os.path.exists(args.output):
+        with open(args.output) as f:
+            results = json.load(f)
+    modules = ["benchmark_result"]
+    if args.cycles:
+        modules.append("benchmark_cycles")
+    for board in args.boards:
+        for app in args.apps:
+            path = app if os.path.isdir(app) else \
+                os.path.join(RIOTBASE, "tests", "bench", app)
+            name = os.path.basename(os.path.normpath(path))
+            lines = run_app(path, board, args.timeout, modules)
+            found = parse_output(lines)
+            if not found:
+                print(f"{name}: no results on {board}", file=sys.stderr)
+            results.setdefault(board, {})[name] = found
+    out = open(args.output, "w") if args.output else sys.stdout
+    json.dump(results, out, indent=2, sort_keys=True)
+    out.write("\n")
+    return 0
+
+
+def compare(args):
+    with open(args.baseline) as f:
+        baseline = json.load(f)
+    with open(args.results) as f:
+        results = json.load(f)
+
+    regressions = 0
+    for board, apps in sorted(results.items()):
+        for app, benchmarks in sorted(apps.items()):
+            for name, new in sorted(benchmarks.items()):
+                old = baseline.get(board, {}).get(app, {}).get(name)
+                if old is None or old.get("unit") != new.get("unit"):
+                    print(f"{board:16} {app}/{name}: no baseline")
+                    continue
+                old_val = old[args.metric]
+                new_val = new[args.metric]
+                change = ((new_val - old_val) * 100.0 / old_val) if old_val \
+                    else 0.0
+                mark = ""
+                if change > args.threshold:
+                    mark = "  REGRESSION"
+                    regressions += 1
+                print(f"{board:16} {app}/{name}: {old_val} -> {new_val} "
+                      f"{new['unit']} ({change:+.1f}%){mark}")
+
+    if regressions:
+        print(f"{regressions} benchmark(s) slower than {args.threshold}%",
+              file=sys.stderr)
+        return 1
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    sub = parser.add_subparsers(dest="command", required=True)
+
+    p_collect = sub.add_parser("collect", help="run benchmarks and store results")
+    p_collect.add_argument("-b", "--boards", nargs="+", default=["native64"],
+                           help="boards to run on")
+    p_collect.add_argument("-o", "--output",
+                           help="JSON file to merge the results into")
+    p_collect.add_argument("-t", "--timeout", type=int, default=120,
+                           help="seconds to wait for one application")
+    p_collect.add_argument("--cycles", action="store_true",
+                           help="measure in CPU cycles (benchmark_cycles)")
+    p_collect.add_argument("apps", nargs="+",
+                           help="applications in tests/bench or paths")
+    p_collect.set_defaults(func=collect)
+
+    p_compare = sub.add_parser("compare", help="compare results to a baseline")
+    p_compare.add_argument("baseline", help="JSON file with baseline results")
+    p_compare.add_argument("results", help="JSON file with new results")
+    p_compare.add_argument("-m", "--metric", default="median",
+                           choices=["min", "median", "p99", "max"],
+                           help="value to compare")
+    p_compare.add_argument("-T", "--threshold", type=float, default=5.0,
+                           help="allowed slowdown in percent")
+    p_compare.set_defaults(func=compare)
+
+    args = parser.parse_args()
+    return args.func(args)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
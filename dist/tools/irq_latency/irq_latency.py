@@ -0,0 +1,128 @@
+#! /usr/bin/env python3
+#
+# Copyright (C) 2024 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser General
+# Public License v2.1. See the file LICENSE in the top level directory for more
+# details.
+
+"""
+Summarize the output of tests/bench/irq_latency of one or more boards.
+
+Every input file is the terminal output of a run of the benchmark. The result
+lines are picked from it, so the files can contain other output as well. All
+latencies are converted from timer ticks to nanoseconds.
+
+By default, the histogram of every scenario of every board is printed, followed
+by a table comparing the worst-case latencies of all boards. With --csv, all
+histogram buckets are written as CSV instead.
+"""
+
+import argparse
+import csv
+import json
+import sys
+
+SCENARIOS = ("isr", "thread_flags", "msg", "event")
+BAR_WIDTH = 50
+
+
+def read(paths):
+    """Return {board: {scenario: result}} of all result lines in the files"""
+    results = {}
+    for path in paths:
+        with open(path, errors="replace") as f:
+            for line in f:
+                start = line.find("{ \"scenario\"")
+                if start < 0:
+                    continue
+                try:
+                    res = json.loads(line[start:])
+                except ValueError:
+                    print("{}: ignoring malformed line".format(path), file=sys.stderr)
+                    continue
+                results.setdefault(res["board"], {})[res["scenario"]] = res
+    return results
+
+
+def ns(res, ticks):
+    return ticks * 1e9 / res["freq"]
+
+
+def buckets(res):
+    """Yield (lower bound in ns, upper bound in ns or None, count)"""
+    width = res["width"]
+    last = len(res["hist"]) - 1
+    for i, count in enumerate(res["hist"]):
+        upper = ns(res, (i + 1) * width) if i < last else None
+        yield ns(res, i * width), upper, count
+
+
+def print_histogram(board, res):
+    print("{} {}: min {:.0f} ns, avg {:.0f} ns, max {:.0f} ns ({} rounds)".format(
+        board, res["scenario"], ns(res, res["min"]), ns(res, res["avg"]),
+        ns(res, res["max"]), res["rounds"]))
+    peak = max(res["hist"]) or 1
+    # skip the empty buckets below the minimum
+    rows = list(buckets(res))
+    first = next((i for i, r in enumerate(rows) if r[2]), len(rows))
+    for lower, upper, count in rows[first:]:
+        label = ">= {:.0f}".format(lower) if upper is None else \
+            "{:.0f}-{:.0f}".format(lower, upper)
+        print("  {:>16} {:>7} {}".format(label, count,
+                                         "#" * round(count * BAR_WIDTH / peak)))
+    print()
+
+
+def print_comparison(results):
+    scenarios = [s for s in SCENARIOS
+                 if any(s in r for r in results.values())]
+    print("worst-case latency [ns]")
+    print("{:<24}".format("board") + "".join("{:>14}".format(s) for s in scenarios))
+    for board in sorted(results):
+        row = "{:<24}".format(board)
+        for s in scenarios:
+            res = results[board].get(s)
+            row += "{:>14}".format("-" if res is None else
+                                   "{:.0f}".format(ns(res, res["max"])))
+        print(row)
+
+
+def write_csv(results, out):
+    writer = csv.writer(out)
+    writer.writerow(["board", "scenario", "lower_ns", "upper_ns", "count"])
+    for board in sorted(results):
+        for scenario, res in sorted(results[board].items()):
+            for lower, upper, count in buckets(res):
+                writer.writerow([board, scenario, "{:.0f}".format(lower),
+                                 "" if upper is None else "{:.0f}".format(upper),
+                                 count])
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("logs", nargs="+", help="terminal output of the benchmark")
+    parser.add_argument("--csv", action="store_true",
+                        help="write all histograms as CSV to stdout")
+    args = parser.parse_args()
+
+    results = read(args.logs)
+    if not results:
+        print("no results found", file=sys.stderr)
+        return 1
+
+    if args.csv:
+        write_csv(results, sys.stdout)
+        return 0
+
+    for board in sorted(results):
+        for scenario in SCENARIOS:
+            if scenario in results[board]:
+                print_histogram(board, results[board][scenario])
+    print_comparison(results)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
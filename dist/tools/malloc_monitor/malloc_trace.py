@@ -0,0 +1,206 @@
+#! /usr/bin/env python3
+#
+# Copyright (C) 2024 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+#
+# @author   RIOT developers <devel@riot-os.org>
+
+"""
+Script to analyze the output of the `malloc_monitor trace` command (provided by
+the `shell_cmd_malloc_monitor` pseudo-module) and of `malloc_monitor_trace_dump()`.
+"""
+
+import argparse
+import collections
+import re
+import subprocess
+import sys
+
+TRACE_RE = re.compile(
+    r"mmt\s+(?P<time>\d+)\s+(?P<op>[a-z])\s+(?P<pid>-?\d+)\s+"
+    r"(?P<pc>0x[0-9a-fA-F]+)\s+(?P<addr>\S+)\s+(?P<size>\d+)"
+)
+LIVE_RE = re.compile(
+    r"mml\s+(?P<addr>\S+)\s+(?P<size>\d+)\s+(?P<pid>-?\d+)"
+)
+OPS = {
+    "m": "malloc",
+    "c": "calloc",
+    "r": "realloc",
+    "f": "free",
+}
+
+Record = collections.namedtuple("Record", "time op pid pc addr size")
+Block = collections.namedtuple("Block", "addr size pid")
+
+
+def parse_addr(addr):
+    if addr in ("(nil)", "0", "NULL"):
+        return 0
+    return int(addr, 16)
+
+
+def parse(lines):
+    trace = []
+    live = []
+    for line in lines:
+        match = TRACE_RE.search(line)
+        if match:
+            trace.append(Record(
+                time=int(match["time"]), op=match["op"], pid=int(match["pid"]),
+                pc=int(match["pc"], 16), addr=parse_addr(match["addr"]),
+                size=int(match["size"]),
+            ))
+            continue
+        match = LIVE_RE.search(line)
+        if match:
+            live.append(Block(
+                addr=parse_addr(match["addr"]), size=int(match["size"]),
+                pid=int(match["pid"]),
+            ))
+    return trace, live
+
+
+class Symbolizer:
+    def __init__(self, elf=None, addr2line="addr2line"):
+        self.elf = elf
+        self.addr2line = addr2line
+        self.cache = {}
+
+    def __call__(self, pc):
+        if pc not in self.cache:
+            self.cache[pc] = self._lookup(pc)
+        return self.cache[pc]
+
+    def _lookup(self, pc):
+        if self.elf is None:
+            return ""
+        try:
+            out = subprocess.check_output(
+                [self.addr2line, "-f", "-s", "-e", self.elf, hex(pc)],
+                stderr=subprocess.DEVNULL,
+            ).decode()
+        except (OSError, subprocess.CalledProcessError):
+            return ""
+        func, _, loc = out.strip().partition("\n")
+        return "{} ({})".format(func, loc) if func != "??" else ""
+
+
+def top_allocators(trace, symbolize, limit):
+    stats = collections.defaultdict(lambda: [0, 0])
+    for rec in trace:
+        if rec.op != "f":
+            stats[rec.pc][0] += rec.size
+            stats[rec.pc][1] += 1
+
+    for title, key in (("bytes", 0), ("calls", 1)):
+        print("Top allocators by {}:".format(title))
+        print("  {:>10} {:>8}  {:<12} {}".format("bytes", "calls", "pc", "symbol"))
+        ranked = sorted(stats.items(), key=lambda item: item[1][key], reverse=True)
+        for pc, (size, calls) in ranked[:limit]:
+            print("  {:>10} {:>8}  0x{:<10x} {}".format(
+                size, calls, pc, symbolize(pc)).rstrip())
+        print()
+
+
+def not_freed(trace, symbolize):
+    # the last allocation of every address that is not followed by a free
+    pending = collections.OrderedDict()
+    for rec in trace:
+        if rec.op == "f":
+            pending.pop(rec.addr, None)
+        elif rec.addr != 0:
+            pending[rec.addr] = rec
+
+    print("Allocated but not freed during the trace:")
+    if not pending:
+        print("  none")
+    total = 0
+    for rec in pending.values():
+        total += rec.size
+        print("  {:>10} ms {:<7} pid {:<3} 0x{:08x} {:>8} bytes  0x{:x} {}".format(
+            rec.time, OPS.get(rec.op, rec.op), rec.pid, rec.addr, rec.size,
+            rec.pc, symbolize(rec.pc)).rstrip())
+    if pending:
+        print("  {} blocks, {} bytes".format(len(pending), total))
+    print()
+
+
+def fragmentation(live, heap_start, heap_size, width):
+    blocks = sorted(b for b in live if b.addr != 0)
+    if not blocks:
+        print("No allocated blocks")
+        return
+
+    start = heap_start if heap_start is not None else blocks[0].addr
+    end = start + heap_size if heap_size is not None \
+        else blocks[-1].addr + blocks[-1].size
+    span = max(end - start, 1)
+
+    # free ranges between allocated blocks, allocator headers count as used
+    holes = []
+    pos = start
+    for block in blocks:
+        if block.addr > pos:
+            holes.append(block.addr - pos)
+        pos = max(pos, block.addr + block.size)
+    if end > pos:
+        holes.append(end - pos)
+
+    free = sum(holes)
+    used = sum(b.size for b in blocks)
+    largest = max(holes) if holes else 0
+    frag = 100.0 * (1 - largest / free) if free else 0.0
+
+    cells = ["."] * width
+    for block in blocks:
+        first = (block.addr - start) * width // span
+        last = (block.addr + block.size - 1 - start) * width // span
+        for i in range(max(first, 0), min(last, width - 1) + 1):
+            cells[i] = "#"
+
+    print("Heap map 0x{:x} - 0x{:x} ({} bytes, '#' used, '.' free):".format(
+        start, end, end - start))
+    for i in range(0, width, 64):
+        print("  " + "".join(cells[i:i + 64]))
+    print()
+    print("Allocated: {} blocks, {} bytes".format(len(blocks), used))
+    print("Free:      {} ranges, {} bytes, largest {} bytes".format(
+        len(holes), free, largest))
+    print("Fragmentation: {:.1f} %".format(frag))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("dump", nargs="?", type=argparse.FileType("r"),
+                        default=sys.stdin,
+                        help="File with the trace, read from STDIN if omitted")
+    parser.add_argument("-e", "--elf", help="ELF file to resolve PCs with")
+    parser.add_argument("--addr2line", default="addr2line",
+                        help="addr2line binary for the target (default: %(default)s)")
+    parser.add_argument("-n", "--top", type=int, default=10,
+                        help="Number of top allocators to show (default: %(default)s)")
+    parser.add_argument("--heap-start", type=lambda x: int(x, 0),
+                        help="Start address of the heap for the map")
+    parser.add_argument("--heap-size", type=lambda x: int(x, 0),
+                        help="Size of the heap for the map")
+    parser.add_argument("--width", type=int, default=256,
+                        help="Number of cells of the heap map (default: %(default)s)")
+    args = parser.parse_args()
+
+    trace, live = parse(args.dump)
+    if not trace and not live:
+        print("No malloc_monitor trace found", file=sys.stderr)
+        sys.exit(1)
+
+    symbolize = Symbolizer(args.elf, args.addr2line)
+    top_allocators(trace, symbolize, args.top)
+    not_freed(trace, symbolize)
+    fragmentation(live, args.heap_start, args.heap_size, args.width)
+
+
+if __name__ == "__main__":
+    main()
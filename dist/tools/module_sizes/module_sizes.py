@@ -0,0 +1,280 @@
+#! /usr/bin/env python3
+#
+# Copyright (C) 2024 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser General
+# Public License v2.1. See the file LICENSE in the top level directory for more
+# details.
+
+"""
+Break down the memory footprint of a RIOT application by module and compare
+such breakdowns.
+
+`collect` attributes every input section the linker kept (according to the map
+file) to the module it was compiled in, in the same way `make cosy` does, and
+classifies it as text, data or bss using the flags of the output section in the
+ELF file. Statically allocated thread stacks are listed separately. The result
+is written as JSON:
+
+    {"application": ..., "board": ...,
+     "total":   {"text": ..., "data": ..., "bss": ...},
+     "modules": {"<module>": {"text": ..., "data": ..., "bss": ...}, ...},
+     "stacks":  {"<symbol>": <size>, ...}}
+
+`diff` compares two such files and exits with a non-zero status if the flash
+(text + data) or RAM (data + bss) usage grew by more than the given thresholds.
+"""
+
+import argparse
+import json
+import os
+import re
+import struct
+import sys
+
+SHT_NOBITS = 8
+SHT_SYMTAB = 2
+SHF_WRITE = 0x1
+SHF_ALLOC = 0x2
+STT_OBJECT = 1
+
+# sections not originating from any module
+FILL = "[fill]"
+OTHER = "[other]"
+
+# "stack" as separate word in the symbol name, e.g. main_stack, _stack_netif
+STACK_RE = re.compile(r"(^|_)stack($|_|\d)", re.IGNORECASE)
+
+
+def read_elf(path):
+    """Return (sections, symbols) of an ELF file
+
+    sections maps the name to (kind, size), with kind being one of text, data
+    or bss, for all sections that occupy memory at runtime. symbols is a list
+    of (name, size, section name) of all data objects.
+    """
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:4] != b"\x7fELF":
+        raise ValueError("{} is not an ELF file".format(path))
+
+    is64 = data[4] == 2
+    end = "<" if data[5] == 1 else ">"
+    if is64:
+        shoff, = struct.unpack_from(end + "Q", data, 0x28)
+        shentsize, shnum, shstrndx = struct.unpack_from(end + "HHH", data, 0x3a)
+        shdr = end + "IIQQQQIIQQ"
+    else:
+        shoff, = struct.unpack_from(end + "I", data, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from(end + "HHH", data, 0x2e)
+        shdr = end + "IIIIIIIIII"
+
+    headers = [struct.unpack_from(shdr, data, shoff + i * shentsize)
+               for i in range(shnum)]
+    # name, type, flags, addr, offset, size, link, info, align, entsize
+    strtab_off = headers[shstrndx][4]
+
+    def _str(off, base):
+        return data[base + off:data.index(b"\0", base + off)].decode()
+
+    names = [_str(h[0], strtab_off) for h in headers]
+
+    sections = {}
+    for name, h in zip(names, headers):
+        if not h[2] & SHF_ALLOC or h[5] == 0:
+            continue
+        if h[1] == SHT_NOBITS:
+            kind = "bss"
+        elif h[2] & SHF_WRITE:
+            kind = "data"
+        else:
+            kind = "text"
+        sections[name] = (kind, h[5])
+
+    symbols = []
+    for h in headers:
+        if h[1] != SHT_SYMTAB:
+            continue
+        str_off = headers[h[6]][4]
+        sym = end + ("IBBHQQ" if is64 else "IIIBBH")
+        for off in range(h[4], h[4] + h[5], h[9]):
+            if is64:
+                st_name, info, _, shndx, _, size = struct.unpack_from(sym, data, off)
+            else:
+                st_name, _, size, info, _, shndx = struct.unpack_from(sym, data, off)
+            if (info & 0xf) != STT_OBJECT or size == 0 or shndx >= shnum:
+                continue
+            symbols.append((_str(st_name, str_off), size, names[shndx]))
+
+    return sections, symbols
+
+
+def _module(path, bindir):
+    """Name of the module the object file or archive at path belongs to"""
+    archive = re.match(r"(.*)\((.*)\)$", path)
+    if archive:
+        path = archive.group(1)
+    rel = os.path.relpath(os.path.abspath(path), bindir)
+    if not rel.startswith(".."):
+        parts = rel.split(os.sep)
+        if len(parts) > 1:
+            return parts[0]
+        return os.path.splitext(parts[0])[0]
+    # toolchain libraries and startup files
+    return "[{}]".format(os.path.basename(path))
+
+
+def read_map(path, bindir, sections):
+    """Sum up the input sections of the map file per module"""
+    modules = {}
+    output = None
+    pending = None
+
+    with open(path) as f:
+        lines = iter(f)
+        for line in lines:
+            if line.startswith("Linker script and memory map"):
+                break
+        for line in lines:
+            line = line.rstrip("\n")
+            if not line.strip():
+                continue
+            if not line[0].isspace():
+                output = line.split()[0]
+                continue
+            fields = line.split()
+            if pending is not None:
+                # long input section names continue on the next line
+                fields = [pending] + fields
+                pending = None
+            if len(fields) == 1 and fields[0].startswith("."):
+                pending = fields[0]
+                continue
+            if output not in sections or len(fields) < 3:
+                continue
+            if fields[0] == "*fill*":
+                module = FILL
+            elif len(fields) >= 4 and fields[1].startswith("0x") \
+                    and fields[2].startswith("0x"):
+                module = _module(" ".join(fields[3:]), bindir)
+            else:
+                continue
+            size = int(fields[2], 16)
+            kind = sections[output][0]
+            entry = modules.setdefault(module, {"text": 0, "data": 0, "bss": 0})
+            entry[kind] += size
+
+    return modules
+
+
+def collect(args):
+    sections, symbols = read_elf(args.elf)
+    total = {"text": 0, "data": 0, "bss": 0}
+    for kind, size in sections.values():
+        total[kind] += size
+
+    modules = read_map(args.map, os.path.abspath(args.bindir), sections)
+
+    # whatever the linker script reserved itself (stack, heap, ...)
+    other = {k: total[k] - sum(m[k] for m in modules.values()) for k in total}
+    if any(other.values()):
+        modules[OTHER] = other
+
+    stacks = {name: size for name, size, section in symbols
+              if STACK_RE.search(name) and section in sections
+              and sections[section][0] != "text"}
+
+    result = {
+        "application": args.application,
+        "board": args.board,
+        "total": total,
+        "modules": dict(sorted(modules.items())),
+        "stacks": dict(sorted(stacks.items())),
+    }
+    with (open(args.output, "w") if args.output else sys.stdout) as f:
+        json.dump(result, f, indent=2)
+        f.write("\n")
+
+
+def _flash(e):
+    return e.get("text", 0) + e.get("data", 0)
+
+
+def _ram(e):
+    return e.get("data", 0) + e.get("bss", 0)
+
+
+def diff(args):
+    with open(args.old) as f:
+        old = json.load(f)
+    with open(args.new) as f:
+        new = json.load(f)
+
+    zero = {"text": 0, "data": 0, "bss": 0}
+    rows = []
+    for name in sorted(set(old["modules"]) | set(new["modules"])):
+        o = old["modules"].get(name, zero)
+        n = new["modules"].get(name, zero)
+        delta = {k: n.get(k, 0) - o.get(k, 0) for k in zero}
+        if any(delta.values()) or args.all:
+            rows.append((name, n, delta))
+
+    print("{:<32} {:>8} {:>8} {:>8}".format("module", "text", "data", "bss"))
+    for name, n, delta in sorted(rows, key=lambda r: -sum(r[2].values())):
+        print("{:<32} {:>+8} {:>+8} {:>+8}".format(
+            name, delta["text"], delta["data"], delta["bss"]))
+    o, n = old["total"], new["total"]
+    print("{:<32} {:>+8} {:>+8} {:>+8}".format(
+        "total", n["text"] - o["text"], n["data"] - o["data"], n["bss"] - o["bss"]))
+
+    for name in sorted(set(old["stacks"]) | set(new["stacks"])):
+        o_size = old["stacks"].get(name, 0)
+        n_size = new["stacks"].get(name, 0)
+        if o_size != n_size:
+            print("stack {:<26} {:>+8}".format(name, n_size - o_size))
+
+    failed = False
+    flash = _flash(new["total"]) - _flash(old["total"])
+    ram = _ram(new["total"]) - _ram(old["total"])
+    if args.flash_threshold is not None and flash > args.flash_threshold:
+        print("flash usage grew by {} bytes".format(flash))
+        failed = True
+    if args.ram_threshold is not None and ram > args.ram_threshold:
+        print("RAM usage grew by {} bytes".format(ram))
+        failed = True
+    return 1 if failed else 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    sub = parser.add_subparsers(dest="command", required=True)
+
+    p = sub.add_parser("collect", help="write the per-module breakdown as JSON")
+    p.add_argument("elf", help="ELF file of the application")
+    p.add_argument("map", help="map file of the application")
+    p.add_argument("--bindir", required=True,
+                   help="BINDIR of the build, holding one directory per module")
+    p.add_argument("--application", default="")
+    p.add_argument("--board", default="")
+    p.add_argument("-o", "--output", help="output file (default: stdout)")
+
+    p = sub.add_parser("diff", help="compare two breakdowns")
+    p.add_argument("old")
+    p.add_argument("new")
+    p.add_argument("-a", "--all", action="store_true",
+                   help="also list modules that did not change")
+    p.add_argument("--flash-threshold", type=int, metavar="BYTES",
+                   help="fail if text + data grew by more than BYTES")
+    p.add_argument("--ram-threshold", type=int, metavar="BYTES",
+                   help="fail if data + bss grew by more than BYTES")
+
+    args = parser.parse_args()
+    if args.command == "collect":
+        collect(args)
+        return 0
+    return diff(args)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,99 @@
+#! /usr/bin/env python3
+#
+# Copyright (C) 2024 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser General
+# Public License v2.1. See the file LICENSE in the top level directory for more
+# details.
+
+"""
+Symbolize the output of `profiler_dump()` (module `profiler`) and print it in
+the folded stack format, one line per stack:
+
+    <thread>;<function>;<inlined function> <samples>
+
+which can be rendered by flamegraph.pl, inferno-flamegraph or speedscope.
+
+The input may contain arbitrary other output around the dump, e.g. a complete
+capture of the serial console. If it contains several dumps, the last one is
+used.
+"""
+
+import argparse
+import collections
+import subprocess
+import sys
+
+
+def parse(lines):
+    """Return the samples of the last dump as list of (pc, count, thread)"""
+    samples = None
+    for line in lines:
+        line = line.strip()
+        if line.startswith("prof-begin"):
+            samples = []
+        elif line.startswith("prof ") and samples is not None:
+            _, pc, count, pid, name = line.split(" ", 4)
+            samples.append((int(pc, 16), int(count), name if name != "-" else "pid " + pid))
+    if samples is None:
+        raise ValueError("no profiler dump found")
+    return samples
+
+
+def symbolize(addr2line, elf, pcs):
+    """Map each pc to its list of frames, outermost first"""
+    cmd = [addr2line, "-e", elf, "-f", "-i", "-C", "-a"]
+    out = subprocess.run(cmd, input="\n".join(hex(pc) for pc in pcs),
+                         capture_output=True, text=True, check=True).stdout
+
+    frames = {}
+    pc = None
+    lines = out.splitlines()
+    # -a prints the address before the (function, location) pairs of each pc
+    i = 0
+    while i < len(lines):
+        if lines[i].startswith("0x"):
+            pc = int(lines[i], 16)
+            frames[pc] = []
+            i += 1
+            continue
+        frames[pc].append(lines[i])
+        i += 2
+    # code outside of the ELF file (e.g. libc on native) stays an address
+    return {pc: [fn for fn in reversed(f) if fn != "??"] or [hex(pc)]
+            for pc, f in frames.items()}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("elf", help="ELF file of the profiled application")
+    parser.add_argument("input", nargs="?", type=argparse.FileType("r"),
+                        default=sys.stdin, help="captured output of profiler_dump()")
+    parser.add_argument("--addr2line", default="addr2line",
+                        help="addr2line of the target toolchain, e.g. "
+                             "arm-none-eabi-addr2line (default: addr2line)")
+    parser.add_argument("--no-thread", action="store_true",
+                        help="do not split stacks by thread")
+    args = parser.parse_args()
+
+    try:
+        samples = parse(args.input)
+    except ValueError as e:
+        sys.exit("error: {}".format(e))
+
+    pcs = sorted({pc for pc, _, _ in samples if pc})
+    frames = symbolize(args.addr2line, args.elf, pcs) if pcs else {}
+    frames[0] = ["[interrupt]"]
+
+    folded = collections.Counter()
+    for pc, count, thread in samples:
+        stack = frames[pc] if args.no_thread else [thread] + frames[pc]
+        folded[";".join(stack)] += count
+
+    for stack, count in sorted(folded.items()):
+        print("{} {}".format(stack, count))
+
+
+if __name__ == "__main__":
+    main()
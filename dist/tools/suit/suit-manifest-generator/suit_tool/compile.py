@@ -272,6 +272,8 @@ def compile_manifest(options, m):
             }
             if any(['compression-info' in c and not c.get('decompress-on-load', False) for c in choices]):
                 InstParams['compression-info'] = lambda cid, data: data.get('compression-info')
+            if any(['unpack-info' in c for c in choices]):
+                InstParams['unpack-info'] = lambda cid, data: ('unpack-info', data['unpack-info'])
             InstCmds = {
                 'offset': lambda cid, data: mkCommand(
                     cid, 'condition-component-offset', None)
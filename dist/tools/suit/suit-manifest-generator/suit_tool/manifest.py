@@ -439,6 +439,7 @@ class SUITDigest(SUITManifestNamedList):
 
 class SUITCompressionInfo(SUITKeyMap):
     rkeymap, keymap = SUITKeyMap.mkKeyMaps({
+        'heatshrink' : -1,
         'gzip' : 1,
         'bzip2' : 2,
         'deflate' : 3,
@@ -446,6 +447,15 @@ class SUITCompressionInfo(SUITKeyMap):
         'lzma' : 7
     })
 
+class SUITUnpackInfo(SUITKeyMap):
+    rkeymap, keymap = SUITKeyMap.mkKeyMaps({
+        'vcdiff' : -1,
+        'hex' : 1,
+        'elf' : 2,
+        'coff' : 3,
+        'srec' : 4
+    })
+
 class SUITParameters(SUITManifestDict):
     fields = SUITManifestDict.mkfields({
         'vendor-id' : ('vendor-id', 1, SUITUUID),
@@ -455,6 +465,7 @@ class SUITParameters(SUITManifestDict):
         'uri' : ('uri', 21, SUITTStr),
         'src' : ('source-component', 22, SUITComponentIndex),
         'compress' : ('compression-info', 19, SUITCompressionInfo),
+        'unpack' : ('unpack-info', 20, SUITUnpackInfo),
         'offset' : ('offset', 5, SUITPosInt)
     })
     def from_json(self, j):
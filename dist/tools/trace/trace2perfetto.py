@@ -0,0 +1,153 @@
+#! /usr/bin/env python3
+#
+# Copyright (C) 2024 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser General
+# Public License v2.1. See the file LICENSE in the top level directory for more
+# details.
+
+"""
+Convert the output of `trace_dump_bin()` (module `trace_events`) into the JSON
+trace event format, which can be opened with https://ui.perfetto.dev or
+chrome://tracing.
+
+The input may contain arbitrary other output before the dump, e.g. a complete
+capture of the serial console.
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+MAGIC = b"RTRC"
+VERSION = 1
+
+EVENTS = [
+    "user",
+    "sched",
+    "msg_send",
+    "msg_recv",
+    "mutex_wait",
+    "netif_rx",
+    "netif_tx",
+    "pktbuf_alloc",
+    "pktbuf_free",
+    "mutex_acquire",
+    "msg_queue_full",
+]
+
+# pid used for records that happen before the first context switch
+TID_UNKNOWN = 0
+
+
+def parse(data):
+    """Return the records and thread names of the first dump in data"""
+    start = data.find(MAGIC)
+    if start < 0:
+        raise ValueError("no trace dump found")
+
+    version, rec_size, count = struct.unpack_from("<BBH", data, start + 4)
+    if version != VERSION:
+        raise ValueError("unsupported format version {}".format(version))
+    if rec_size != 8:
+        raise ValueError("unsupported record size {}".format(rec_size))
+
+    pos = start + 8
+    records = []
+    for _ in range(count):
+        time, val = struct.unpack_from("<II", data, pos)
+        records.append((time, val >> 24, val & 0xffffff))
+        pos += rec_size
+
+    names = {}
+    if pos < len(data):
+        (numof,) = struct.unpack_from("<B", data, pos)
+        pos += 1
+        for _ in range(numof):
+            pid, length = struct.unpack_from("<BB", data, pos)
+            pos += 2
+            names[pid] = data[pos:pos + length].decode(errors="replace")
+            pos += length
+
+    return records, names
+
+
+def _unwrap(records):
+    """Make the 32 bit microsecond timestamps monotonic"""
+    offset = 0
+    last = None
+    for time, event, arg in records:
+        if last is not None and time < last:
+            offset += 1 << 32
+        last = time
+        yield time + offset, event, arg
+
+
+def _args(event, arg):
+    name = EVENTS[event] if event < len(EVENTS) else "event_{}".format(event)
+    if name in ("msg_send", "msg_recv", "msg_queue_full"):
+        return name, {"type": "0x{:04x}".format(arg >> 8), "pid": arg & 0xff}
+    if name in ("netif_rx", "netif_tx"):
+        return name, {"length": arg >> 8, "netif": arg & 0xff}
+    if name in ("mutex_wait", "mutex_acquire"):
+        return name, {"mutex": "0x{:06x}".format(arg)}
+    if name in ("pktbuf_alloc", "pktbuf_free"):
+        return name, {"size": arg}
+    return name, {"value": "0x{:06x}".format(arg)}
+
+
+def convert(records, names):
+    """Translate records into a list of trace events"""
+    out = [{"ph": "M", "pid": 0, "name": "process_name",
+            "args": {"name": "RIOT"}}]
+    for pid, name in sorted(names.items()):
+        out.append({"ph": "M", "pid": 0, "tid": pid, "name": "thread_name",
+                    "args": {"name": name}})
+
+    current = TID_UNKNOWN
+    since = None
+    pktbuf = 0
+    for ts, event, arg in _unwrap(records):
+        if event == EVENTS.index("sched"):
+            if since is not None:
+                out.append({"ph": "X", "pid": 0, "tid": current,
+                            "name": names.get(current, "running"),
+                            "ts": since, "dur": ts - since})
+            current = arg
+            since = ts
+            continue
+
+        name, args = _args(event, arg)
+        out.append({"ph": "i", "s": "t", "pid": 0, "tid": current,
+                    "name": name, "ts": ts, "args": args})
+
+        if name in ("pktbuf_alloc", "pktbuf_free"):
+            # relative to the start of the trace, the dump has no absolute usage
+            pktbuf += arg if name == "pktbuf_alloc" else -arg
+            out.append({"ph": "C", "pid": 0, "name": "pktbuf",
+                        "ts": ts, "args": {"used": pktbuf}})
+
+    return out
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", type=argparse.FileType("rb"),
+                        help="captured output of trace_dump_bin()")
+    parser.add_argument("-o", "--output", type=argparse.FileType("w"),
+                        default=sys.stdout, help="output file (default: stdout)")
+    args = parser.parse_args()
+
+    try:
+        records, names = parse(args.input.read())
+    except (ValueError, struct.error) as e:
+        sys.exit("error: {}".format(e))
+
+    json.dump({"traceEvents": convert(records, names)}, args.output)
+    args.output.write("\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,354 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/*
+ * Time server for native instances started with --vtime.
+ *
+ * Every instance reports when it goes idle (along with its next timer
+ * deadline) and when it becomes busy again. Once all instances have been idle
+ * for the quiet period, the shared clock is advanced to the earliest deadline.
+ */
+
+#define _GNU_SOURCE
+
+#include <inttypes.h>
+#include <netdb.h>
+#include <poll.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <sys/socket.h>
+
+#include "native_vtime.h"
+
+#ifndef VTIME_NODES_MAX
+#define VTIME_NODES_MAX     1024
+#endif
+
+/* instances whose deadline passed this long ago are considered gone */
+#define VTIME_STALE_US      (100U * 1000)
+/* instances busy for this long without a message are considered gone */
+#define VTIME_BUSY_US       (1000U * 1000)
+
+typedef struct {
+    struct sockaddr_storage addr;
+    socklen_t addr_len;
+    uint64_t deadline;
+    uint64_t last_seen;
+    bool idle;
+} vtime_node_t;
+
+static vtime_node_t _nodes[VTIME_NODES_MAX];
+static unsigned _nodes_numof;
+
+/* offset of the shared clock to CLOCK_MONOTONIC */
+static uint64_t _offset;
+/* shared time at which the last instance went idle */
+static uint64_t _idle_since;
+
+static bool _verbose;
+
+static uint64_t _now(void)
+{
+    struct timespec t;
+
+    clock_gettime(CLOCK_MONOTONIC, &t);
+
+    return (uint64_t)t.tv_sec * 1000000 + t.tv_nsec / 1000 + _offset;
+}
+
+static bool _all_idle(void)
+{
+    for (unsigned i = 0; i < _nodes_numof; i++) {
+        if (!_nodes[i].idle) {
+            return false;
+        }
+    }
+
+    return _nodes_numof > 0;
+}
+
+static uint64_t _min_deadline(void)
+{
+    uint64_t deadline = NATIVE_VTIME_NONE;
+
+    for (unsigned i = 0; i < _nodes_numof; i++) {
+        if (_nodes[i].deadline < deadline) {
+            deadline = _nodes[i].deadline;
+        }
+    }
+
+    return deadline;
+}
+
+/* oldest message of a busy instance, NATIVE_VTIME_NONE if all are idle */
+static uint64_t _busy_since(void)
+{
+    uint64_t since = NATIVE_VTIME_NONE;
+
+    for (unsigned i = 0; i < _nodes_numof; i++) {
+        if (!_nodes[i].idle && (_nodes[i].last_seen < since)) {
+            since = _nodes[i].last_seen;
+        }
+    }
+
+    return since;
+}
+
+static void _remove(unsigned i, const char *reason)
+{
+    printf("removing node %u (%s)\n", i, reason);
+    _nodes[i] = _nodes[--_nodes_numof];
+}
+
+static int _send(int sock, const vtime_node_t *node, uint8_t type, uint64_t value)
+{
+    native_vtime_msg_t msg = { .type = type, .value = value };
+
+    return sendto(sock, &msg, sizeof(msg), 0,
+                  (const struct sockaddr *)&node->addr, node->addr_len);
+}
+
+static vtime_node_t *_find(int sock, const struct sockaddr_storage *addr,
+                           socklen_t addr_len)
+{
+    for (unsigned i = 0; i < _nodes_numof; i++) {
+        if ((_nodes[i].addr_len == addr_len) &&
+            (memcmp(&_nodes[i].addr, addr, addr_len) == 0)) {
+            return &_nodes[i];
+        }
+    }
+
+    if (_nodes_numof == VTIME_NODES_MAX) {
+        fprintf(stderr, "too many nodes\n");
+        return NULL;
+    }
+
+    vtime_node_t *node = &_nodes[_nodes_numof];
+    memcpy(&node->addr, addr, addr_len);
+    node->addr_len = addr_len;
+    node->idle = false;
+    node->deadline = NATIVE_VTIME_NONE;
+    printf("adding node %u\n", _nodes_numof++);
+
+    /* a node that was removed while busy may have missed warps */
+    _send(sock, node, NATIVE_VTIME_WARP, _offset);
+
+    return node;
+}
+
+static void _warp(int sock, uint64_t delta)
+{
+    _offset += delta;
+
+    if (_verbose) {
+        printf("warp %" PRIu64 " us to %" PRIu64 " us\n", delta, _now());
+    }
+
+    for (unsigned i = 0; i < _nodes_numof; i++) {
+        if (_send(sock, &_nodes[i], NATIVE_VTIME_WARP, _offset) < 0) {
+            _remove(i--, "unreachable");
+            continue;
+        }
+        /* every instance wakes up to adjust its timer */
+        _nodes[i].idle = false;
+        _nodes[i].last_seen = _now();
+    }
+}
+
+static void _drop_overdue(uint64_t now)
+{
+    for (unsigned i = 0; i < _nodes_numof; i++) {
+        if ((_nodes[i].deadline != NATIVE_VTIME_NONE) &&
+            (_nodes[i].deadline + VTIME_STALE_US < now)) {
+            _remove(i--, "missed deadline");
+        }
+    }
+}
+
+static void _drop_silent(uint64_t now)
+{
+    for (unsigned i = 0; i < _nodes_numof; i++) {
+        if (!_nodes[i].idle && (_nodes[i].last_seen + VTIME_BUSY_US < now)) {
+            _remove(i--, "silent");
+        }
+    }
+}
+
+static void _receive(int sock)
+{
+    native_vtime_msg_t msg;
+    struct sockaddr_storage addr;
+    socklen_t addr_len = sizeof(addr);
+
+    if (recvfrom(sock, &msg, sizeof(msg), 0,
+                 (struct sockaddr *)&addr, &addr_len) != sizeof(msg)) {
+        return;
+    }
+
+    vtime_node_t *node = _find(sock, &addr, addr_len);
+    if (node == NULL) {
+        return;
+    }
+
+    node->last_seen = _now();
+
+    switch (msg.type) {
+    case NATIVE_VTIME_HELLO:
+        node->idle = false;
+        _send(sock, node, NATIVE_VTIME_WARP, _offset);
+        break;
+    case NATIVE_VTIME_IDLE:
+        node->idle = true;
+        node->deadline = msg.value;
+        if (_all_idle()) {
+            _idle_since = _now();
+        }
+        break;
+    case NATIVE_VTIME_BUSY:
+        node->idle = false;
+        break;
+    }
+}
+
+static void _loop(int sock, uint64_t quiet)
+{
+    struct pollfd pfd = { .fd = sock, .events = POLLIN };
+
+    while (1) {
+        struct timespec ts, *timeout = NULL;
+        uint64_t now = _now();
+        uint64_t due = 0;
+        uint64_t busy_since = _busy_since();
+
+        if (busy_since != NATIVE_VTIME_NONE) {
+            /* a killed instance would otherwise block all others forever */
+            due = busy_since + VTIME_BUSY_US;
+            if (due <= now) {
+                _drop_silent(now);
+                continue;
+            }
+        }
+        else if (_all_idle()) {
+            due = _idle_since + quiet;
+
+            if (due <= now) {
+                uint64_t deadline = _min_deadline();
+
+                if (deadline == NATIVE_VTIME_NONE) {
+                    /* nothing to wait for */
+                    due = 0;
+                }
+                else if (deadline > now) {
+                    _warp(sock, deadline - now);
+                    continue;
+                }
+                else if (deadline + VTIME_STALE_US < now) {
+                    _drop_overdue(now);
+                    continue;
+                }
+                else {
+                    /* timer fires in real time, give the node a moment */
+                    due = deadline + VTIME_STALE_US;
+                }
+            }
+        }
+
+        if (due > now) {
+            ts.tv_sec = (due - now) / 1000000;
+            ts.tv_nsec = ((due - now) % 1000000) * 1000;
+            timeout = &ts;
+        }
+
+        if (ppoll(&pfd, 1, timeout, NULL) > 0) {
+            _receive(sock);
+        }
+    }
+}
+
+static void _print_help(const char *progname)
+{
+    fprintf(stderr, "usage: %s [-q quiet_us] [-v] <address> <port>\n", progname);
+
+    fprintf(stderr, "\npositional arguments:\n");
+    fprintf(stderr, "\taddress\t\tlocal address to bind to\n");
+    fprintf(stderr, "\tport\t\tlocal port to bind to\n");
+
+    fprintf(stderr, "\noptional arguments:\n");
+    fprintf(stderr, "\t-q <us>\t\tTime all nodes must be idle before the clock "
+                    "is advanced (default: 1000)\n");
+    fprintf(stderr, "\t-v\t\tPrint every warp\n");
+}
+
+int main(int argc, char **argv)
+{
+    int c;
+    uint64_t quiet = 1000;
+    const char *progname = argv[0];
+
+    const struct addrinfo hint = {
+        .ai_family   = AF_UNSPEC,
+        .ai_socktype = SOCK_DGRAM,
+        .ai_protocol = IPPROTO_UDP,
+        .ai_flags    = AI_NUMERICHOST,
+    };
+
+    while ((c = getopt(argc, argv, "q:v")) != -1) {
+        switch (c) {
+        case 'q':
+            quiet = strtoull(optarg, NULL, 0);
+            break;
+        case 'v':
+            _verbose = true;
+            break;
+        default:
+            _print_help(progname);
+            exit(1);
+        }
+    }
+
+    argc -= optind;
+    argv += optind;
+
+    if (argc != 2) {
+        _print_help(progname);
+        exit(1);
+    }
+
+    setvbuf(stdout, NULL, _IOLBF, 0);
+
+    struct addrinfo *server_addr;
+    if (getaddrinfo(argv[0], argv[1], &hint, &server_addr) != 0) {
+        perror("getaddrinfo()");
+        exit(1);
+    }
+
+    int sock = socket(server_addr->ai_family, server_addr->ai_socktype,
+                      server_addr->ai_protocol);
+    if (sock < 0) {
+        perror("socket() failed");
+        exit(1);
+    }
+
+    if (bind(sock, server_addr->ai_addr, server_addr->ai_addrlen) < 0) {
+        perror("bind() failed");
+        exit(1);
+    }
+
+    freeaddrinfo(server_addr);
+
+    _loop(sock, quiet);
+
+    close(sock);
+
+    return 0;
+}
@@ -32,8 +32,15 @@
 #define SPIDEV          (dev->params.spi)
 #define CSPIN           (dev->params.cs_pin)
 
+#if IS_USED(MODULE_AT86RF2XX_SPI_STATS)
+uint32_t at86rf2xx_spi_acquisitions;
+#endif
+
 static inline void getbus(const at86rf2xx_t *dev)
 {
+#if IS_USED(MODULE_AT86RF2XX_SPI_STATS)
+    at86rf2xx_spi_acquisitions++;
+#endif
     spi_acquire(SPIDEV, CSPIN, SPI_MODE_0, dev->params.spi_clk);
 }
 
@@ -58,6 +65,17 @@ uint8_t at86rf2xx_reg_read(const at86rf2xx_t *dev, uint8_t addr)
     return value;
 }
 
+void at86rf2xx_reg_read_multi(const at86rf2xx_t *dev, const uint8_t *addrs,
+                              uint8_t *values, size_t n)
+{
+    getbus(dev);
+    for (size_t i = 0; i < n; i++) {
+        uint8_t reg = (AT86RF2XX_ACCESS_REG | AT86RF2XX_ACCESS_READ | addrs[i]);
+        values[i] = spi_transfer_reg(SPIDEV, CSPIN, reg, 0);
+    }
+    spi_release(SPIDEV);
+}
+
 void at86rf2xx_sram_read(const at86rf2xx_t *dev, uint8_t offset,
                          uint8_t *data, size_t len)
 {
@@ -31,6 +31,7 @@
 #include <errno.h>
 
 #include "architecture.h"
+#include "container.h"
 #include "iolist.h"
 
 #include "net/eui64.h"
@@ -285,12 +286,6 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
     /* copy payload */
     at86rf2xx_fb_read(dev, (uint8_t *)buf, pkt_len);
 
-    /* Ignore FCS but advance fb read - we must give a temporary buffer here,
-     * as we are not allowed to issue SPI transfers without any buffer */
-    uint8_t tmp[2];
-    at86rf2xx_fb_read(dev, tmp, 2);
-    (void)tmp;
-
     /* AT86RF212B RSSI_BASE_VAL + 1.03 * ED, base varies for diff. modulation and datarates
      * AT86RF232  RSSI_BASE_VAL + ED, base -91dBm
      * AT86RF233  RSSI_BASE_VAL + ED, base -94dBm
@@ -308,19 +303,24 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
      * life.
      */
     if (info != NULL) {
-        uint8_t ed = 0;
+        uint8_t ed;
         netdev_ieee802154_rx_info_t *radio_info = info;
-        at86rf2xx_fb_read(dev, &(radio_info->lqi), 1);
 
 #if AT86RF2XX_HAVE_ED_REGISTER
         /* AT86RF231 does not provide ED at the end of the frame buffer, read
          * from separate register instead */
+        uint8_t trailer[3];     /* FCS, LQI */
+        at86rf2xx_fb_read(dev, trailer, sizeof(trailer));
         at86rf2xx_fb_stop(dev);
         ed = at86rf2xx_reg_read(dev, AT86RF2XX_REG__PHY_ED_LEVEL);
 #else
-        at86rf2xx_fb_read(dev, &ed, 1);
+        /* the FCS is ignored, but read along with LQI and ED to save transfers */
+        uint8_t trailer[4];     /* FCS, LQI, ED */
+        at86rf2xx_fb_read(dev, trailer, sizeof(trailer));
         at86rf2xx_fb_stop(dev);
+        ed = trailer[3];
 #endif
+        radio_info->lqi = trailer[2];
         radio_info->rssi = RSSI_BASE_VAL + ed;
         DEBUG("[at86rf2xx] LQI:%d high is good, RSSI:%d high is either good or "
               "too much interference.\n", radio_info->lqi, radio_info->rssi);
@@ -885,16 +885,30 @@ static void _isr(netdev_t *netdev)
     /* If transceiver is sleeping register access is impossible and frames are
      * lost anyway, so return immediately.
      */
-    state = at86rf2xx_get_status(dev);
-    if (state == AT86RF2XX_STATE_SLEEP) {
+    if (dev->state == AT86RF2XX_STATE_SLEEP) {
         return;
     }
 
+#if AT86RF2XX_IS_PERIPH
+    state = at86rf2xx_get_status(dev);
     /* read (consume) device status */
     irq_mask = at86rf2xx_get_irq_flags(dev);
-
-    trac_status = at86rf2xx_reg_read(dev, AT86RF2XX_REG__TRX_STATE)
-                  & AT86RF2XX_TRX_STATE_MASK__TRAC;
+    trac_status = at86rf2xx_reg_read(dev, AT86RF2XX_REG__TRX_STATE);
+#else
+    /* read the state, (consume) the device status and the TX result with a
+     * single bus acquisition */
+    static const uint8_t regs[] = {
+        AT86RF2XX_REG__TRX_STATUS,
+        AT86RF2XX_REG__IRQ_STATUS,
+        AT86RF2XX_REG__TRX_STATE,
+    };
+    uint8_t values[ARRAY_SIZE(regs)];
+    at86rf2xx_reg_read_multi(dev, regs, values, ARRAY_SIZE(regs));
+    state = values[0] & AT86RF2XX_TRX_STATUS_MASK__TRX_STATUS;
+    irq_mask = values[1];
+    trac_status = values[2];
+#endif
+    trac_status &= AT86RF2XX_TRX_STATE_MASK__TRAC;
 
     if (irq_mask & AT86RF2XX_IRQ_STATUS_MASK__RX_START) {
         netdev->event_callback(netdev, NETDEV_EVENT_RX_STARTED);
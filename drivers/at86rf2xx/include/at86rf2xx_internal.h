@@ -94,6 +94,29 @@ static inline uint8_t at86rf2xx_reg_read(const at86rf2xx_t *dev, volatile uint8_
 }
 #else
 uint8_t at86rf2xx_reg_read(const at86rf2xx_t *dev, uint8_t addr);
+
+/**
+ * @brief   Read several registers while holding the bus once
+ *
+ * The transceiver has no register auto-increment, so each register is still
+ * read in its own chip select frame, but the bus is acquired only once.
+ *
+ * @param[in]  dev      device to read from
+ * @param[in]  addrs    addresses of the registers to read, in order
+ * @param[out] values   values of the registers in @p addrs
+ * @param[in]  n        number of registers to read
+ */
+void at86rf2xx_reg_read_multi(const at86rf2xx_t *dev, const uint8_t *addrs,
+                              uint8_t *values, size_t n);
+
+#if IS_USED(MODULE_AT86RF2XX_SPI_STATS) || defined(DOXYGEN)
+/**
+ * @brief   Number of SPI bus acquisitions by all at86rf2xx devices
+ *
+ * @note    Only available with the `at86rf2xx_spi_stats` module
+ */
+extern uint32_t at86rf2xx_spi_acquisitions;
+#endif
 #endif
 
 /**
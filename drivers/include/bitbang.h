@@ -0,0 +1,152 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/**
+ * @defgroup    drivers_bitbang Bit-banging helpers
+ * @ingroup     drivers_misc
+ * @brief       Fast pin access for software implementations of bus protocols
+ *
+ * Software buses such as @ref drivers_soft_spi and @ref drivers_soft_uart
+ * toggle the same few pins millions of times. With `periph_gpio_ll` the port
+ * and pin mask of each pin are resolved once and every access is a single
+ * register write. Without it, the helpers fall back to @ref drivers_periph_gpio.
+ *
+ * The pins still have to be configured using @ref gpio_init before use.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Bit-banging helpers
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ */
+
+#ifndef BITBANG_H
+#define BITBANG_H
+
+#include <stdbool.h>
+
+#include "kernel_defines.h"
+#include "periph/gpio.h"
+#if IS_USED(MODULE_PERIPH_GPIO_LL)
+#include "periph/gpio_ll.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   A pin prepared for bit-banging
+ */
+typedef struct {
+#if IS_USED(MODULE_PERIPH_GPIO_LL) || DOXYGEN
+    gpio_port_t port;   /**< port of the pin */
+    uword_t mask;       /**< pin mask, 0 if the pin is not used */
+#else
+    gpio_t pin;         /**< the pin */
+#endif
+} bitbang_pin_t;
+
+/**
+ * @brief   Prepare @p pin for bit-banging
+ *
+ * @param[out] bb       pin to prepare
+ * @param[in]  pin      GPIO pin, may be GPIO_UNDEF
+ * @param[in]  fallback a valid pin on the same port used if @p pin is
+ *                      GPIO_UNDEF, accesses to @p bb then have no effect
+ */
+static inline void bitbang_pin_init(bitbang_pin_t *bb, gpio_t pin,
+                                    gpio_t fallback)
+{
+#if IS_USED(MODULE_PERIPH_GPIO_LL)
+    if (gpio_is_valid(pin)) {
+        bb->port = gpio_get_port(pin);
+        bb->mask = 1UL << gpio_get_pin_num(pin);
+    }
+    else {
+        bb->port = gpio_get_port(fallback);
+        bb->mask = 0;
+    }
+#else
+    (void)fallback;
+    bb->pin = pin;
+#endif
+}
+
+/**
+ * @brief   Drive @p bb high
+ */
+static inline void bitbang_set(const bitbang_pin_t *bb)
+{
+#if IS_USED(MODULE_PERIPH_GPIO_LL)
+    gpio_ll_set(bb->port, bb->mask);
+#else
+    gpio_set(bb->pin);
+#endif
+}
+
+/**
+ * @brief   Drive @p bb low
+ */
+static inline void bitbang_clear(const bitbang_pin_t *bb)
+{
+#if IS_USED(MODULE_PERIPH_GPIO_LL)
+    gpio_ll_clear(bb->port, bb->mask);
+#else
+    gpio_clear(bb->pin);
+#endif
+}
+
+/**
+ * @brief   Drive @p bb to @p value
+ */
+static inline void bitbang_write(const bitbang_pin_t *bb, bool value)
+{
+#if IS_USED(MODULE_PERIPH_GPIO_LL)
+    if (value) {
+        gpio_ll_set(bb->port, bb->mask);
+    }
+    else {
+        gpio_ll_clear(bb->port, bb->mask);
+    }
+#else
+    gpio_write(bb->pin, value);
+#endif
+}
+
+/**
+ * @brief   Toggle the output of @p bb
+ */
+static inline void bitbang_toggle(const bitbang_pin_t *bb)
+{
+#if IS_USED(MODULE_PERIPH_GPIO_LL)
+    gpio_ll_toggle(bb->port, bb->mask);
+#else
+    gpio_toggle(bb->pin);
+#endif
+}
+
+/**
+ * @brief   Read the input level of @p bb
+ */
+static inline bool bitbang_read(const bitbang_pin_t *bb)
+{
+#if IS_USED(MODULE_PERIPH_GPIO_LL)
+    return gpio_ll_read(bb->port) & bb->mask;
+#else
+    return gpio_read(bb->pin);
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BITBANG_H */
+/** @} */
@@ -70,6 +70,17 @@ extern "C" {
 #define CONFIG_LCD_LE_MODE
 #endif
 
+/**
+ * @brief   Number of pixels converted and sent per bus transfer
+ *
+ * @ref lcd_fill and @ref lcd_pixmap in little endian mode prepare the pixel
+ * data in a buffer of this size on the stack. Larger values mean fewer bus
+ * transfers per area.
+ */
+#ifndef CONFIG_LCD_PIXEL_CHUNK
+#define CONFIG_LCD_PIXEL_CHUNK  (32U)
+#endif
+
 /**
  * @name Memory access control bits
  * @{
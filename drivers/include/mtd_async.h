@@ -0,0 +1,177 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    drivers_mtd_async Asynchronous MTD requests
+ * @ingroup     drivers_mtd
+ * @{
+ * @brief       Queue MTD operations and get notified on completion
+ *
+ * Writing or erasing external flash takes milliseconds, during which the
+ * @ref drivers_mtd "MTD" functions block the calling thread while the driver
+ * polls the device status. This module executes MTD requests in a worker
+ * thread instead, so that the submitting thread can continue e.g. processing
+ * network traffic or logging while the flash is busy.
+ *
+ * Requests are executed one after the other in the order they were submitted,
+ * also across devices. A request, including its data buffer, is owned by the
+ * worker until its completion callback was called. The callback runs in the
+ * worker thread, to continue in a different thread post an event from it.
+ *
+ * @code {.c}
+ * static void _written(mtd_async_req_t *req, void *arg)
+ * {
+ *     (void)req;
+ *     event_post(EVENT_PRIO_MEDIUM, arg);
+ * }
+ *
+ * mtd_async_write_page_raw(&req, mtd0, buf, page, 0, sizeof(buf), _written, &ev_written);
+ * @endcode
+ *
+ * The worker sleeps while the device is busy, given the driver waits using
+ * ztimer (as e.g. @ref drivers_mtd_spi_nor does with `ztimer_usec` or
+ * `ztimer_msec`). Page transfers use DMA where the SPI peripheral driver of the
+ * platform does (e.g. with `periph_dma` on SAM0).
+ *
+ * @note    The synchronous MTD API must not be used on a device concurrently to
+ *          pending asynchronous requests.
+ *
+ * @file
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ */
+
+#ifndef MTD_ASYNC_H
+#define MTD_ASYNC_H
+
+#include <stdint.h>
+
+#include "event.h"
+#include "mtd.h"
+#include "thread.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Stack size of the worker thread
+ */
+#ifndef CONFIG_MTD_ASYNC_STACKSIZE
+#define CONFIG_MTD_ASYNC_STACKSIZE  (THREAD_STACKSIZE_DEFAULT)
+#endif
+
+/**
+ * @brief   Priority of the worker thread
+ *
+ * Defaults to a priority below the main thread, flash operations are meant to
+ * run in the background.
+ */
+#ifndef CONFIG_MTD_ASYNC_PRIO
+#define CONFIG_MTD_ASYNC_PRIO       (THREAD_PRIORITY_MAIN + 1)
+#endif
+
+/**
+ * @brief   Operations that can be executed asynchronously
+ */
+typedef enum {
+    MTD_ASYNC_READ_PAGE,        /**< @ref mtd_read_page */
+    MTD_ASYNC_WRITE_PAGE_RAW,   /**< @ref mtd_write_page_raw */
+    MTD_ASYNC_ERASE_SECTOR,     /**< @ref mtd_erase_sector */
+} mtd_async_op_t;
+
+/**
+ * @brief   Forward declaration of a request
+ */
+typedef struct mtd_async_req mtd_async_req_t;
+
+/**
+ * @brief   Completion callback of a request
+ *
+ * Called in the context of the worker thread. The result is stored in
+ * mtd_async_req_t::res, the request may be reused from within the callback.
+ *
+ * @param[in]   req     The completed request
+ * @param[in]   arg     Argument given on submission
+ */
+typedef void (*mtd_async_cb_t)(mtd_async_req_t *req, void *arg);
+
+/**
+ * @brief   An asynchronous MTD request
+ *
+ * All members are private except for mtd_async_req_t::res, which is valid
+ * once the completion callback was called.
+ */
+struct mtd_async_req {
+    event_t super;              /**< event handled by the worker */
+    mtd_async_cb_t cb;          /**< completion callback */
+    void *arg;                  /**< argument of the callback */
+    mtd_dev_t *mtd;             /**< device to access */
+    mtd_async_op_t op;          /**< operation to execute */
+    union {
+        void *dst;              /**< destination of read requests */
+        const void *src;        /**< source of write requests */
+    } buf;                      /**< data buffer */
+    uint32_t first;             /**< first page or sector */
+    uint32_t offset;            /**< byte offset into the first page */
+    uint32_t count;             /**< number of bytes or sectors */
+    int res;                    /**< result of the operation */
+};
+
+/**
+ * @brief   Queue a @ref mtd_read_page operation
+ *
+ * @param[out]  req     Request to fill and queue
+ * @param[in]   mtd     Device to read from
+ * @param[out]  dest    Buffer for the data
+ * @param[in]   page    Page to start reading from
+ * @param[in]   offset  Byte offset from the start of the page
+ * @param[in]   size    Number of bytes to read
+ * @param[in]   cb      Completion callback, must not be NULL
+ * @param[in]   arg     Argument passed to @p cb
+ */
+void mtd_async_read_page(mtd_async_req_t *req, mtd_dev_t *mtd, void *dest,
+                         uint32_t page, uint32_t offset, uint32_t size,
+                         mtd_async_cb_t cb, void *arg);
+
+/**
+ * @brief   Queue a @ref mtd_write_page_raw operation
+ *
+ * @param[out]  req     Request to fill and queue
+ * @param[in]   mtd     Device to write to
+ * @param[in]   src     Data to write
+ * @param[in]   page    Page to start writing to
+ * @param[in]   offset  Byte offset from the start of the page
+ * @param[in]   size    Number of bytes to write
+ * @param[in]   cb      Completion callback, must not be NULL
+ * @param[in]   arg     Argument passed to @p cb
+ */
+void mtd_async_write_page_raw(mtd_async_req_t *req, mtd_dev_t *mtd, const void *src,
+                              uint32_t page, uint32_t offset, uint32_t size,
+                              mtd_async_cb_t cb, void *arg);
+
+/**
+ * @brief   Queue a @ref mtd_erase_sector operation
+ *
+ * @param[out]  req     Request to fill and queue
+ * @param[in]   mtd     Device to erase
+ * @param[in]   sector  First sector to erase
+ * @param[in]   num     Number of sectors to erase
+ * @param[in]   cb      Completion callback, must not be NULL
+ * @param[in]   arg     Argument passed to @p cb
+ */
+void mtd_async_erase_sector(mtd_async_req_t *req, mtd_dev_t *mtd,
+                            uint32_t sector, uint32_t num,
+                            mtd_async_cb_t cb, void *arg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MTD_ASYNC_H */
+/** @} */
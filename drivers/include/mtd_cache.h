@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    drivers_mtd_cache  MTD write-back page cache
+ * @ingroup     drivers_storage
+ * @brief       Page cache stacked on top of another MTD device
+ *
+ * This MTD module keeps recently used pages of a backing MTD device in RAM.
+ * Reads of cached pages are served without accessing the device, small writes
+ * to the same page are collected and written back as one transfer once the
+ * page is evicted or the cache is flushed. Pages are replaced in least
+ * recently used order.
+ *
+ * Like @ref drivers_mtd_mapper, the cache is a MTD device itself, so it can be
+ * placed below any file system or raw MTD user.
+ *
+ * ## Usage
+ *
+ * To use this module include it in your makefile:
+ * ```
+ * USEMODULE += mtd_cache
+ * ```
+ * Then define a cache with 4 pages of up to 256 bytes on top of `mtd0`:
+ * ```
+ * MTD_CACHE_DEV(cache, MTD_0, 4, 256);
+ * mtd_dev_t *dev = &cache.base;
+ * ```
+ *
+ * Devices with @ref MTD_DRIVER_FLAG_DIRECT_WRITE (e.g. SD cards) get whole
+ * pages written back. On other devices, only the written range of a page is
+ * written back, as bytes must not be programmed twice. Writes to the same page
+ * that are not adjacent to the pending ones write back the pending ones first.
+ *
+ * Pending writes are lost on power loss. Call @ref mtd_cache_flush where a
+ * file system syncs, @ref mtd_power with @ref MTD_POWER_DOWN flushes as well.
+ *
+ * @{
+ * @file
+ * @brief       Interface definitions for the MTD page cache
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ */
+
+#ifndef MTD_CACHE_H
+#define MTD_CACHE_H
+
+#include <stdint.h>
+
+#include "mtd.h"
+#include "mutex.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Value of mtd_cache_line_t::page for unused lines
+ */
+#define MTD_CACHE_PAGE_NONE     (UINT32_MAX)
+
+/**
+ * @brief   Define a MTD page cache
+ *
+ * @param   name        name of the resulting @ref mtd_cache_t
+ * @param   parent_dev  pointer to the backing MTD device
+ * @param   numof       number of pages to cache
+ * @param   size        maximum page size of @p parent_dev in bytes
+ */
+#define MTD_CACHE_DEV(name, parent_dev, numof, size)                \
+    static mtd_cache_line_t name ## _lines[numof];                  \
+    static uint8_t name ## _buf[(numof) * (size)];                  \
+    mtd_cache_t name = {                                            \
+        .base = {                                                   \
+            .driver = &mtd_cache_driver,                            \
+        },                                                          \
+        .parent = parent_dev,                                       \
+        .lock = MUTEX_INIT,                                         \
+        .lines = name ## _lines,                                    \
+        .buf = name ## _buf,                                        \
+        .lines_numof = numof,                                       \
+        .line_size = size,                                          \
+    }
+
+/**
+ * @brief   A cached page
+ */
+typedef struct {
+    uint32_t page;          /**< page of the backing device */
+    uint32_t last_use;      /**< value of the use counter at the last access */
+    uint32_t dirty_start;   /**< first byte not yet written back */
+    uint32_t dirty_end;     /**< end of the bytes not yet written back */
+} mtd_cache_line_t;
+
+/**
+ * @brief   MTD page cache
+ */
+typedef struct {
+    mtd_dev_t base;             /**< MTD context */
+    mtd_desc_t driver;          /**< driver with the flags of @p parent */
+    mtd_dev_t *parent;          /**< backing MTD device */
+    mutex_t lock;               /**< guards the cache */
+    mtd_cache_line_t *lines;    /**< cached pages */
+    uint8_t *buf;               /**< page data, @p line_size per line */
+    uint32_t line_size;         /**< maximum page size */
+    uint32_t use_counter;       /**< counts page accesses for LRU */
+    uint8_t lines_numof;        /**< number of cached pages */
+} mtd_cache_t;
+
+/**
+ * @brief   Page cache MTD device operations table
+ */
+extern const mtd_desc_t mtd_cache_driver;
+
+/**
+ * @brief   Write back all pending writes
+ *
+ * @param[in]   cache   Page cache
+ *
+ * @retval  0 on success
+ * @retval  <0 error of the backing device
+ */
+int mtd_cache_flush(mtd_cache_t *cache);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MTD_CACHE_H */
+/** @} */
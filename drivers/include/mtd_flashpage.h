@@ -15,6 +15,21 @@
  * accessible flash page memory. To expose merely an area of that as a single
  * MTD partition, the @ref drivers_mtd_mapper can be used.
  *
+ * Deferred erase
+ * --------------
+ *
+ * Erasing a flash page stalls the CPU, and on many MCUs all interrupts, for
+ * several milliseconds. With the `mtd_flashpage_deferred_erase` module, an
+ * erase only marks the pages as erased: reads of such a page return the erase
+ * state and the pages are erased by a thread running at the lowest priority,
+ * i.e. whenever the system would otherwise be idle. Pages that are already
+ * blank are not erased again. Only a write to a page that was not erased yet
+ * has to erase it first.
+ *
+ * @warning An erase does not persist before it was done in the background.
+ *          Call @ref mtd_flashpage_flush before a reset or a power down if
+ *          the erased data must not reappear.
+ *
  * @{
  *
  * @file
@@ -28,6 +43,9 @@
 
 #include "mtd.h"
 #include "periph/flashpage.h"
+#ifdef MODULE_MTD_FLASHPAGE_DEFERRED_ERASE
+#include "thread.h"
+#endif
 
 #ifdef __cplusplus
 extern "C"
@@ -91,6 +109,42 @@ extern mtd_flashpage_t mtd_flash_aux_slot;
 extern mtd_dev_t *mtd_aux;
 #endif
 
+#if MODULE_MTD_FLASHPAGE_DEFERRED_ERASE || DOXYGEN
+/**
+ * @brief   Stack size of the background erase thread
+ */
+#ifndef CONFIG_MTD_FLASHPAGE_ERASE_STACKSIZE
+#define CONFIG_MTD_FLASHPAGE_ERASE_STACKSIZE    (THREAD_STACKSIZE_SMALL)
+#endif
+
+/**
+ * @brief   Count the erases of each flash page since boot
+ *
+ * Costs two bytes of RAM per flash page.
+ */
+#ifndef CONFIG_MTD_FLASHPAGE_ERASE_COUNT
+#define CONFIG_MTD_FLASHPAGE_ERASE_COUNT        (0)
+#endif
+
+/**
+ * @brief   Erase all pages that have a deferred erase pending
+ *
+ * Blocks until the flash is in the state the erase operations left it in.
+ */
+void mtd_flashpage_flush(void);
+
+/**
+ * @brief   Get the number of times a flash page was erased since boot
+ *
+ * Only available with @ref CONFIG_MTD_FLASHPAGE_ERASE_COUNT enabled.
+ *
+ * @param[in]  page     Flash page
+ *
+ * @return  erase count of @p page, saturating at UINT16_MAX
+ */
+uint16_t mtd_flashpage_erase_count(unsigned page);
+#endif
+
 /**
  * @brief   Size of the auxiliary slot on the internal flash
  *          Must align with the flash page size.
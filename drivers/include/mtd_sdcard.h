@@ -32,6 +32,18 @@ extern "C"
 {
 #endif
 
+/**
+ * @brief   Maximum number of blocks to read ahead on sequential reads
+ *
+ * The read-ahead window starts at one block once two reads are found to be
+ * sequential and doubles with every further sequential read up to this
+ * number. Each block costs 512 bytes of RAM per device, 0 disables
+ * read-ahead.
+ */
+#ifndef CONFIG_MTD_SDCARD_READAHEAD
+#define CONFIG_MTD_SDCARD_READAHEAD     0
+#endif
+
 /**
  * @brief   Device descriptor for mtd_sdcard device
  *
@@ -41,6 +53,16 @@ typedef struct {
     mtd_dev_t base;                    /**< inherit from mtd_dev_t object */
     sdcard_spi_t *sd_card;             /**< sdcard_spi dev descriptor */
     const sdcard_spi_params_t *params; /**< params for sdcard_spi init */
+#if CONFIG_MTD_SDCARD_READAHEAD || DOXYGEN
+    uint32_t ra_page;                  /**< first block in the read-ahead buffer */
+    uint32_t ra_next;                  /**< block a sequential read continues at */
+    uint16_t ra_count;                 /**< blocks in the read-ahead buffer */
+    uint16_t ra_window;                /**< current read-ahead window in blocks */
+    /**
+     * @brief   read-ahead buffer
+     */
+    uint8_t ra_buf[CONFIG_MTD_SDCARD_READAHEAD * SD_HC_BLOCK_SIZE];
+#endif
 } mtd_sdcard_t;
 
 /**
@@ -34,6 +34,18 @@ extern "C"
 {
 #endif
 
+/**
+ * @brief   Maximum number of blocks to read ahead on sequential reads
+ *
+ * The read-ahead window starts at one block once two reads are found to be
+ * sequential and doubles with every further sequential read up to this
+ * number. Each block costs 512 bytes of RAM per device, 0 disables
+ * read-ahead.
+ */
+#ifndef CONFIG_MTD_SDMMC_READAHEAD
+#define CONFIG_MTD_SDMMC_READAHEAD      0
+#endif
+
 /**
  * @brief   Device descriptor for a mtd_sdmmc device
  *
@@ -43,6 +55,16 @@ typedef struct {
     mtd_dev_t base;                    /**< inherit mtd_dev_t object */
     sdmmc_dev_t *sdmmc;                /**< SD/MMC device descriptor */
     uint8_t sdmmc_idx;                 /**< SD/MMC peripheral index  */
+#if CONFIG_MTD_SDMMC_READAHEAD || DOXYGEN
+    uint32_t ra_page;                  /**< first block in the read-ahead buffer */
+    uint32_t ra_next;                  /**< block a sequential read continues at */
+    uint16_t ra_count;                 /**< blocks in the read-ahead buffer */
+    uint16_t ra_window;                /**< current read-ahead window in blocks */
+    /**
+     * @brief   read-ahead buffer
+     */
+    uint8_t ra_buf[CONFIG_MTD_SDMMC_READAHEAD * SDMMC_SDHC_BLOCK_SIZE];
+#endif
 } mtd_sdmmc_t;
 
 /**
@@ -41,8 +41,12 @@
  * active thread to sleep for a certain amount of time, the implementation
  * might need to block certain power states.
  *
+ * # Continuous Sampling
  *
- * @todo        Extend interface for continuous mode?
+ * With the `periph_adc_continuous` feature, the ADC can be kept powered
+ * between conversions using adc_continuous_begin(). On top of this, the
+ * `periph_adc_stream` module samples a line at a fixed rate into a ping-pong
+ * buffer, see adc_stream_start().
  *
  * @{
  *
@@ -56,10 +60,14 @@
 #define PERIPH_ADC_H
 
 #include <limits.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #include "periph_cpu.h"
 #include "periph_conf.h"
+#if defined(MODULE_PERIPH_ADC_STREAM) || DOXYGEN
+#include "periph/timer.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -155,6 +163,89 @@ int32_t adc_continuous_sample(adc_t line);
  */
 void adc_continuous_stop(void);
 
+#if defined(MODULE_PERIPH_ADC_STREAM) || DOXYGEN
+/**
+ * @name    Timer triggered sampling into a ping-pong buffer
+ *
+ * A periodic timer samples a single ADC line at a fixed rate. The samples are
+ * stored in a buffer that is split in two halves: once a half is full, the
+ * callback is invoked with it while the other half is being filled. The
+ * callback must hand the samples off (e.g. into a @ref tsrb_t or a signal
+ * processing pipeline woken up by a thread flag) before the other half is
+ * full.
+ *
+ * The ADC is kept powered for the whole stream, so only one stream can run at
+ * a time and adc_sample() must not be used meanwhile.
+ *
+ * @note    requires the `periph_adc_stream` module, which is built on
+ *          `periph_adc_continuous` and `periph_timer_periodic`
+ * @{
+ */
+/**
+ * @brief   Frequency of the timer driving the stream
+ */
+#ifndef CONFIG_ADC_STREAM_TIMER_FREQ
+#define CONFIG_ADC_STREAM_TIMER_FREQ    (1000000LU)
+#endif
+
+/**
+ * @brief   Signature of the callback for a filled half of the buffer
+ *
+ * @note    Called in interrupt context
+ *
+ * @param[in] arg       argument passed to adc_stream_start()
+ * @param[in] samples   the filled half of the buffer, oldest sample first
+ * @param[in] len       number of samples in @p samples
+ */
+typedef void (*adc_stream_cb_t)(void *arg, const uint16_t *samples, size_t len);
+
+/**
+ * @brief   State of a running stream
+ *
+ * @note    The contents of this structure are private
+ */
+typedef struct {
+    uint16_t *buf;              /**< sample buffer */
+    size_t len;                 /**< number of samples in buf */
+    size_t pos;                 /**< index of the next sample */
+    adc_stream_cb_t cb;         /**< callback for a filled half */
+    void *arg;                  /**< argument of cb */
+    adc_t line;                 /**< sampled line */
+    tim_t tim;                  /**< timer triggering the conversions */
+} adc_stream_t;
+
+/**
+ * @brief   Start sampling @p line at @p rate_hz
+ *
+ * @param[out] stream   stream state, must be kept until adc_stream_stop()
+ * @param[in]  line     line to sample, must be initialized with adc_init()
+ * @param[in]  res      resolution to use for conversion
+ * @param[in]  tim      timer to use, it must not be used otherwise
+ * @param[in]  rate_hz  sample rate
+ * @param[out] buf      buffer for the samples
+ * @param[in]  len      number of samples in @p buf, must be even
+ * @param[in]  cb       callback for each filled half of @p buf
+ * @param[in]  arg      argument of @p cb
+ *
+ * @retval  0           on success
+ * @retval  -EINVAL     invalid @p len or @p rate_hz
+ * @retval  -ENODEV     @p tim could not be initialized
+ */
+int adc_stream_start(adc_stream_t *stream, adc_t line, adc_res_t res,
+                     tim_t tim, uint32_t rate_hz, uint16_t *buf, size_t len,
+                     adc_stream_cb_t cb, void *arg);
+
+/**
+ * @brief   Stop a stream started with adc_stream_start()
+ *
+ * Samples in a half that is not completely filled are discarded.
+ *
+ * @param[in] stream    stream to stop
+ */
+void adc_stream_stop(adc_stream_t *stream);
+/** @} */
+#endif /* MODULE_PERIPH_ADC_STREAM */
+
 #ifdef __cplusplus
 }
 #endif
@@ -114,6 +114,7 @@
 #ifndef PERIPH_I2C_H
 #define PERIPH_I2C_H
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <stddef.h>
 #include <limits.h>
@@ -492,6 +493,89 @@ int i2c_write_reg(i2c_t dev, uint16_t addr, uint16_t reg,
 int i2c_write_regs(i2c_t dev, uint16_t addr, uint16_t reg,
                   const void *data, size_t len, uint8_t flags);
 
+#if defined(MODULE_PERIPH_I2C_ASYNC) || DOXYGEN
+/**
+ * @name    Queued transactions
+ *
+ * A transaction is a list of register accesses, possibly to several devices
+ * on the same bus. Transactions are queued and run in order by a worker
+ * thread that acquires the bus, so the caller neither blocks nor holds the
+ * bus lock while the devices are accessed.
+ *
+ * @{
+ */
+#ifndef CONFIG_I2C_ASYNC_PRIO
+/**
+ * @brief   Priority of the thread running queued transactions
+ */
+#define CONFIG_I2C_ASYNC_PRIO           (THREAD_PRIORITY_MAIN - 1)
+#endif
+
+#ifndef CONFIG_I2C_ASYNC_STACKSIZE
+/**
+ * @brief   Stack size of the thread running queued transactions
+ *
+ * The completion callbacks run on this stack.
+ */
+#define CONFIG_I2C_ASYNC_STACKSIZE      (THREAD_STACKSIZE_DEFAULT)
+#endif
+
+/**
+ * @brief   A single register access of a queued transaction
+ */
+typedef struct i2c_op {
+    struct i2c_op *next;    /**< next access, NULL for the last one */
+    void *data;             /**< buffer to read into or write from */
+    size_t len;             /**< number of bytes to transfer */
+    uint16_t addr;          /**< 7-bit or 10-bit device address */
+    uint16_t reg;           /**< register address */
+    uint8_t flags;          /**< optional flags (see @ref i2c_flags_t) */
+    bool write;             /**< write @p data instead of reading */
+    int res;                /**< result, set when the transaction is done */
+} i2c_op_t;
+
+/**
+ * @brief   Completion callback of a queued transaction
+ *
+ * Called in thread context after all accesses were run and the bus was
+ * released. Post an event from here to continue in an event loop.
+ *
+ * @param[in]   arg     argument given to @ref i2c_queue
+ */
+typedef void (*i2c_async_cb_t)(void *arg);
+
+/**
+ * @brief   Queued transaction, to be treated as opaque
+ */
+typedef struct i2c_async {
+    struct i2c_async *next;     /**< next queued transaction */
+    i2c_op_t *ops;              /**< accesses to run */
+    i2c_async_cb_t cb;          /**< completion callback */
+    void *arg;                  /**< argument of @ref i2c_async_t::cb */
+    i2c_t dev;                  /**< I2C device */
+} i2c_async_t;
+
+/**
+ * @brief   Queue a transaction on the given I2C bus
+ *
+ * The bus must not be acquired by the caller. An access failing does not
+ * stop the transaction, check @ref i2c_op_t::res of each access. Do not
+ * touch @p trans, @p ops or their buffers until @p cb was called.
+ *
+ * @param[out]  trans   transaction state, must stay valid until completion
+ * @param[in]   dev     I2C peripheral device
+ * @param[in]   ops     accesses to run in order
+ * @param[in]   cb      called when the transaction is done, may be NULL
+ * @param[in]   arg     argument passed to @p cb
+ *
+ * @return      0 on success
+ * @return      -ENOMEM if the worker thread could not be started
+ */
+int i2c_queue(i2c_async_t *trans, i2c_t dev, i2c_op_t *ops,
+              i2c_async_cb_t cb, void *arg);
+/** @} */
+#endif /* MODULE_PERIPH_I2C_ASYNC */
+
 #ifdef __cplusplus
 }
 #endif
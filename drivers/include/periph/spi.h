@@ -449,6 +449,90 @@ static inline uint16_t spi_transfer_u16_be(spi_t bus, spi_cs_t cs, bool cont, ui
     return be16toh(receive);
 }
 
+#if defined(MODULE_PERIPH_SPI_ASYNC) || DOXYGEN
+/**
+ * @name    Asynchronous transfers
+ *
+ * A transaction is a list of transfers during which the chip select line
+ * stays asserted. It is run by a worker thread with the blocking transfer
+ * functions, the caller continues immediately. Ports that wait for DMA or
+ * interrupts in @ref spi_transfer_bytes (e.g. stm32 and sam0 with DMA
+ * configured, nrf52) free the CPU for other threads during the transfer.
+ *
+ * @{
+ */
+#ifndef CONFIG_SPI_ASYNC_PRIO
+/**
+ * @brief   Priority of the thread running asynchronous transfers
+ */
+#define CONFIG_SPI_ASYNC_PRIO           (THREAD_PRIORITY_MAIN - 1)
+#endif
+
+#ifndef CONFIG_SPI_ASYNC_STACKSIZE
+/**
+ * @brief   Stack size of the thread running asynchronous transfers
+ *
+ * The completion callbacks run on this stack.
+ */
+#define CONFIG_SPI_ASYNC_STACKSIZE      (THREAD_STACKSIZE_DEFAULT)
+#endif
+
+/**
+ * @brief   A single transfer of an asynchronous transaction
+ */
+typedef struct spi_xfer {
+    struct spi_xfer *next;  /**< next transfer, NULL for the last one */
+    const void *out;        /**< buffer to send data from, may be NULL */
+    void *in;               /**< buffer to read into, may be NULL */
+    size_t len;             /**< number of bytes to transfer */
+} spi_xfer_t;
+
+/**
+ * @brief   Completion callback of an asynchronous transaction
+ *
+ * Called in thread context. Post an event from here to continue in an
+ * event loop.
+ *
+ * @param[in]   arg     argument given to @ref spi_transfer_async
+ */
+typedef void (*spi_async_cb_t)(void *arg);
+
+/**
+ * @brief   Asynchronous transaction, to be treated as opaque
+ */
+typedef struct spi_async {
+    struct spi_async *next;     /**< next queued transaction */
+    const spi_xfer_t *xfers;    /**< transfers to run */
+    spi_async_cb_t cb;          /**< completion callback */
+    void *arg;                  /**< argument of @ref spi_async_t::cb */
+    spi_cs_t cs;                /**< chip select line */
+    spi_t bus;                  /**< SPI device */
+} spi_async_t;
+
+/**
+ * @brief   Queue a transaction on the given SPI bus
+ *
+ * The bus must be acquired with @ref spi_acquire and stays acquired after
+ * the transaction. Do not use the bus, @p trans or the transfers in
+ * @p xfers until @p cb was called.
+ *
+ * @param[out]  trans   transaction state, must stay valid until completion
+ * @param[in]   bus     SPI device to use
+ * @param[in]   cs      chip select pin/line to use, set to SPI_CS_UNDEF if chip
+ *                      select should not be handled by the SPI driver
+ * @param[in]   xfers   transfers to run, the device stays selected until the
+ *                      last one is done
+ * @param[in]   cb      called when the transaction is done, may be NULL
+ * @param[in]   arg     argument passed to @p cb
+ *
+ * @return      0 on success
+ * @return      -ENOMEM if the worker thread could not be started
+ */
+int spi_transfer_async(spi_async_t *trans, spi_t bus, spi_cs_t cs,
+                       const spi_xfer_t *xfers, spi_async_cb_t cb, void *arg);
+/** @} */
+#endif /* MODULE_PERIPH_SPI_ASYNC */
+
 #ifdef __cplusplus
 }
 #endif
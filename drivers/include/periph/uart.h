@@ -114,6 +114,16 @@ typedef void(*uart_rx_cb_t)(void *arg, uint8_t data);
  */
 typedef void(*uart_rxstart_cb_t)(void *arg);
 
+/**
+ * @brief   Signature for bulk receive callback
+ *
+ * @param[in] arg           context to the callback (optional)
+ * @param[in] data          the bytes that were received, only valid during
+ *                          the callback
+ * @param[in] len           number of bytes in @p data
+ */
+typedef void(*uart_rx_bulk_cb_t)(void *arg, const uint8_t *data, size_t len);
+
 /**
  * @brief   Interrupt context for a UART device
  */
@@ -125,6 +135,9 @@ typedef struct {
     uart_rxstart_cb_t rxs_cb;   /**< start condition received interrupt callback */
     void *rxs_arg;          /**< argument to start condition received callback */
 #endif
+#ifdef MODULE_PERIPH_UART_RX_BULK
+    uart_rx_bulk_cb_t rx_bulk_cb;   /**< bulk receive callback */
+#endif
 } uart_isr_ctx_t;
 #endif
 
@@ -202,6 +215,34 @@ typedef enum {
  */
 int uart_init(uart_t uart, uint32_t baud, uart_rx_cb_t rx_cb, void *arg);
 
+#if defined(MODULE_PERIPH_UART_RX_BULK) || DOXYGEN
+/**
+ * @brief   Initialize a given UART device to receive data in chunks
+ *
+ * Same as @ref uart_init, but received data is handed to @p rx_cb in
+ * contiguous chunks instead of byte by byte. A chunk is passed on once the
+ * driver's receive buffer fills up or the line went idle, so the callback
+ * may see anything from a single byte to a whole frame. At high symbol rates
+ * this avoids an interrupt per byte.
+ *
+ * @note    You have to add the module `periph_uart_rx_bulk` to your project
+ *          to enable this function
+ *
+ * @param[in] uart          UART device to initialize
+ * @param[in] baud          desired symbol rate in baud
+ * @param[in] rx_cb         receive callback, executed in interrupt context
+ *                          for every received chunk
+ * @param[in] arg           optional context passed to the callback function
+ *
+ * @retval  0               Success
+ * @retval  -ENODEV         Invalid UART device
+ * @retval  -ENOTSUP        Unsupported symbol rate
+ * @retval  <0              On other errors
+ */
+int uart_init_rx_bulk(uart_t uart, uint32_t baud, uart_rx_bulk_cb_t rx_cb,
+                      void *arg);
+#endif
+
 #if defined(MODULE_PERIPH_UART_RECONFIGURE) || DOXYGEN
 /**
  * @brief   Change the pins of the given UART back to plain GPIO functionality
@@ -400,6 +441,33 @@ int uart_mode(uart_t uart, uart_data_bits_t data_bits, uart_parity_t parity,
  */
 void uart_write(uart_t uart, const uint8_t *data, size_t len);
 
+#if defined(MODULE_PERIPH_UART_NONBLOCKING) || DOXYGEN
+/**
+ * @brief   Queue data for transmission without waiting
+ *
+ * With `periph_uart_nonblocking` the data is copied to a TX ring buffer of
+ * `UART_TXBUF_SIZE` bytes that is drained by interrupt. Unlike
+ * @ref uart_write this never waits for space in the buffer, the caller
+ * retries with the remaining data or drops it.
+ *
+ * @param[in] uart          UART device to use for transmission
+ * @param[in] data          data buffer to send
+ * @param[in] len           number of bytes to send
+ *
+ * @return  number of bytes queued, less than @p len if the buffer is full
+ */
+size_t uart_write_async(uart_t uart, const uint8_t *data, size_t len);
+
+/**
+ * @brief   Wait until all queued data was sent
+ *
+ * @pre     Interrupts are enabled and this is not called from an ISR
+ *
+ * @param[in] uart          UART device to flush
+ */
+void uart_flush(uart_t uart);
+#endif
+
 /**
  * @brief   Power on the given UART device
  *
@@ -49,6 +49,7 @@
 #define SAUL_H
 
 #include <errno.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <sys/types.h>
 
@@ -278,6 +279,25 @@ typedef int(*saul_read_t)(const void *dev, phydat_t *res);
  */
 typedef int(*saul_write_t)(const void *dev, const phydat_t *data);
 
+/**
+ * @brief   Read a batch of buffered samples from a device
+ *
+ * Sensors with a hardware sample FIFO can implement this to drain several
+ * samples with a single bus transaction. Samples are stored oldest first,
+ * @p period_us is set to the time between two consecutive samples so the
+ * caller can reconstruct their timestamps.
+ *
+ * @param[in]  dev          device descriptor of the target device
+ * @param[out] res          array of @p count results
+ * @param[in]  count        maximum number of samples to read
+ * @param[out] period_us    sample period in microseconds
+ *
+ * @return  number of samples read [1-count]
+ * @return  -ECANCELED on error
+ */
+typedef int(*saul_read_batch_t)(const void *dev, phydat_t *res, size_t count,
+                                uint32_t *period_us);
+
 /**
  * @brief   Definition of the RIOT actuator/sensor interface
  */
@@ -285,6 +305,8 @@ typedef struct {
     saul_read_t read;       /**< read function pointer */
     saul_write_t write;     /**< write function pointer */
     uint8_t type;           /**< device class the device belongs to */
+    saul_read_batch_t read_batch;   /**< batch read function pointer, may
+                                         be NULL */
 } saul_driver_t;
 
 /**
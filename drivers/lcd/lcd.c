@@ -25,8 +25,10 @@
 #include <assert.h>
 #include <string.h>
 #include "byteorder.h"
+#include "container.h"
 #include "kernel_defines.h"
 #include "log.h"
+#include "macros/utils.h"
 #include "ztimer.h"
 
 #if IS_USED(MODULE_LCD_SPI)
@@ -415,10 +417,16 @@ void lcd_fill(lcd_t *dev, uint16_t x1, uint16_t x2, uint16_t y1,
         color = htons(color);
     }
 
-    for (int i = 0; i < (num_pix - 1); i++) {
-        lcd_ll_write_bytes(dev, true, (uint8_t *)&color, sizeof(color));
+    uint16_t chunk[CONFIG_LCD_PIXEL_CHUNK];
+    for (unsigned i = 0; i < ARRAY_SIZE(chunk); i++) {
+        chunk[i] = color;
+    }
+
+    while (num_pix > 0) {
+        size_t n = MIN((size_t)num_pix, ARRAY_SIZE(chunk));
+        num_pix -= n;
+        lcd_ll_write_bytes(dev, num_pix > 0, chunk, n * sizeof(uint16_t));
     }
-    lcd_ll_write_bytes(dev, false, (uint8_t *)&color, sizeof(color));
     lcd_ll_release(dev);
 }
 
@@ -440,12 +448,16 @@ void lcd_pixmap(lcd_t *dev, uint16_t x1, uint16_t x2,
     lcd_ll_cmd_start(dev, LCD_CMD_RAMWR, true);
 
     if (IS_ACTIVE(CONFIG_LCD_LE_MODE)) {
-        for (size_t i = 0; i < num_pix - 1; i++) {
-            uint16_t ncolor = htons(*(color + i));
-            lcd_ll_write_bytes(dev, true, &ncolor, sizeof(uint16_t));
+        uint16_t chunk[CONFIG_LCD_PIXEL_CHUNK];
+        while (num_pix > 0) {
+            size_t n = MIN(num_pix, ARRAY_SIZE(chunk));
+            for (size_t i = 0; i < n; i++) {
+                chunk[i] = htons(color[i]);
+            }
+            color += n;
+            num_pix -= n;
+            lcd_ll_write_bytes(dev, num_pix > 0, chunk, n * sizeof(uint16_t));
         }
-        uint16_t ncolor = htons(*(color + num_pix - 1));
-        lcd_ll_write_bytes(dev, false, &ncolor, sizeof(uint16_t));
     }
     else {
         lcd_ll_write_bytes(dev, false, (const uint8_t *)color, num_pix * 2);
@@ -18,9 +18,18 @@
  * @}
  */
 
+#include <string.h>
+
+#include "macros/utils.h"
 #include "saul.h"
+#include "time_units.h"
 #include "lis2dh12.h"
 
+/* samples drained from the FIFO per driver call */
+#define FIFO_CHUNK      (8U)
+/* depth of the hardware FIFO */
+#define FIFO_DEPTH      (32U)
+
 static int read_accelerometer(const void *dev, phydat_t *res)
 {
     if (lis2dh12_read(dev, (lis2dh12_fifo_data_t*)res->val) != LIS2DH12_OK) {
@@ -31,6 +40,39 @@ static int read_accelerometer(const void *dev, phydat_t *res)
     return 3;
 }
 
+static int read_accelerometer_batch(const void *dev, phydat_t *res,
+                                    size_t count, uint32_t *period_us)
+{
+    lis2dh12_fifo_data_t buf[FIFO_CHUNK];
+    size_t n = 0;
+
+    count = MIN(count, FIFO_DEPTH);
+    while (n < count) {
+        uint8_t want = MIN(count - n, FIFO_CHUNK);
+        uint8_t got = lis2dh12_read_fifo_data(dev, buf, want);
+        for (uint8_t i = 0; i < got; i++, n++) {
+            memcpy(res[n].val, buf[i].data, sizeof(buf[i].data));
+            res[n].unit = UNIT_G_FORCE;
+            res[n].scale = -3;
+        }
+        if (got < want) {
+            break;
+        }
+    }
+
+    /* FIFO in bypass mode or empty, return the current sample */
+    if (n == 0) {
+        if (read_accelerometer(dev, res) <= 0) {
+            return -ECANCELED;
+        }
+        n = 1;
+    }
+
+    uint16_t rate = lis2dh12_get_datarate(dev);
+    *period_us = rate ? US_PER_SEC / rate : 0;
+    return n;
+}
+
 static int read_temperature(const void *dev, phydat_t *res)
 {
     if (lis2dh12_read_temperature(dev, &res->val[0])) {
@@ -46,6 +88,7 @@ const saul_driver_t lis2dh12_saul_driver = {
     .read = read_accelerometer,
     .write = saul_write_notsup,
     .type = SAUL_SENSE_ACCEL,
+    .read_batch = read_accelerometer_batch,
 };
 
 const saul_driver_t lis2dh12_saul_temp_driver = {
@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     drivers_mtd_async
+ * @{
+ *
+ * @file
+ * @brief       Asynchronous MTD request queue
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+
+#include "container.h"
+#include "mtd_async.h"
+#include "mutex.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static event_queue_t _queue;
+static char _stack[CONFIG_MTD_ASYNC_STACKSIZE];
+static kernel_pid_t _pid = KERNEL_PID_UNDEF;
+static mutex_t _lock = MUTEX_INIT;
+
+static void *_worker(void *arg)
+{
+    (void)arg;
+
+    event_queue_claim(&_queue);
+    event_loop(&_queue);
+
+    return NULL;
+}
+
+static void _run(event_t *event)
+{
+    mtd_async_req_t *req = container_of(event, mtd_async_req_t, super);
+
+    switch (req->op) {
+    case MTD_ASYNC_READ_PAGE:
+        req->res = mtd_read_page(req->mtd, req->buf.dst, req->first, req->offset,
+                                 req->count);
+        break;
+    case MTD_ASYNC_WRITE_PAGE_RAW:
+        req->res = mtd_write_page_raw(req->mtd, req->buf.src, req->first, req->offset,
+                                      req->count);
+        break;
+    case MTD_ASYNC_ERASE_SECTOR:
+        req->res = mtd_erase_sector(req->mtd, req->first, req->count);
+        break;
+    default:
+        req->res = -ENOTSUP;
+        break;
+    }
+
+    DEBUG("mtd_async: request %p done: %d\n", (void *)req, req->res);
+    req->cb(req, req->arg);
+}
+
+/* the worker is only started once there is something to do */
+static void _start(void)
+{
+    mutex_lock(&_lock);
+    if (_pid == KERNEL_PID_UNDEF) {
+        event_queue_init_detached(&_queue);
+        _pid = thread_create(_stack, sizeof(_stack), CONFIG_MTD_ASYNC_PRIO,
+                             THREAD_CREATE_STACKTEST, _worker, NULL, "mtd_async");
+    }
+    mutex_unlock(&_lock);
+}
+
+static void _submit(mtd_async_req_t *req, mtd_dev_t *mtd, mtd_async_op_t op,
+                    uint32_t first, uint32_t offset, uint32_t count,
+                    mtd_async_cb_t cb, void *arg)
+{
+    assert(cb);
+
+    _start();
+
+    req->super.handler = _run;
+    req->cb = cb;
+    req->arg = arg;
+    req->mtd = mtd;
+    req->op = op;
+    req->first = first;
+    req->offset = offset;
+    req->count = count;
+    req->res = -EINPROGRESS;
+
+    event_post(&_queue, &req->super);
+}
+
+void mtd_async_read_page(mtd_async_req_t *req, mtd_dev_t *mtd, void *dest,
+                         uint32_t page, uint32_t offset, uint32_t size,
+                         mtd_async_cb_t cb, void *arg)
+{
+    req->buf.dst = dest;
+    _submit(req, mtd, MTD_ASYNC_READ_PAGE, page, offset, size, cb, arg);
+}
+
+void mtd_async_write_page_raw(mtd_async_req_t *req, mtd_dev_t *mtd, const void *src,
+                              uint32_t page, uint32_t offset, uint32_t size,
+                              mtd_async_cb_t cb, void *arg)
+{
+    req->buf.src = src;
+    _submit(req, mtd, MTD_ASYNC_WRITE_PAGE_RAW, page, offset, size, cb, arg);
+}
+
+void mtd_async_erase_sector(mtd_async_req_t *req, mtd_dev_t *mtd,
+                            uint32_t sector, uint32_t num,
+                            mtd_async_cb_t cb, void *arg)
+{
+    _submit(req, mtd, MTD_ASYNC_ERASE_SECTOR, sector, 0, num, cb, arg);
+}
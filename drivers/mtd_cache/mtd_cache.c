@@ -0,0 +1,296 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     drivers_mtd_cache
+ * @{
+ *
+ * @file
+ * @brief       Write-back page cache for MTD devices
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "container.h"
+#include "macros/utils.h"
+#include "mtd_cache.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static inline mtd_cache_t *_get_cache(mtd_dev_t *mtd)
+{
+    return container_of(mtd, mtd_cache_t, base);
+}
+
+static inline uint8_t *_data(mtd_cache_t *cache, mtd_cache_line_t *line)
+{
+    return &cache->buf[(line - cache->lines) * cache->line_size];
+}
+
+static inline bool _is_dirty(const mtd_cache_line_t *line)
+{
+    return line->dirty_end > line->dirty_start;
+}
+
+static int _write_back(mtd_cache_t *cache, mtd_cache_line_t *line)
+{
+    if (!_is_dirty(line)) {
+        return 0;
+    }
+
+    uint32_t start = line->dirty_start;
+    uint32_t end = line->dirty_end;
+
+    /* devices that can overwrite take the whole page, saving them a
+     * read-modify-write of the untouched part */
+    if (cache->driver.flags & MTD_DRIVER_FLAG_DIRECT_WRITE) {
+        start = 0;
+        end = cache->base.page_size;
+    }
+
+    DEBUG("mtd_cache: write back page %" PRIu32 " [%" PRIu32 ", %" PRIu32 ")\n",
+          line->page, start, end);
+
+    int res = mtd_write_page_raw(cache->parent, _data(cache, line) + start,
+                                 line->page, start, end - start);
+    if (res < 0) {
+        return res;
+    }
+
+    line->dirty_start = 0;
+    line->dirty_end = 0;
+    return 0;
+}
+
+static int _flush(mtd_cache_t *cache)
+{
+    for (unsigned i = 0; i < cache->lines_numof; i++) {
+        int res = _write_back(cache, &cache->lines[i]);
+        if (res < 0) {
+            return res;
+        }
+    }
+    return 0;
+}
+
+static mtd_cache_line_t *_find(mtd_cache_t *cache, uint32_t page)
+{
+    for (unsigned i = 0; i < cache->lines_numof; i++) {
+        if (cache->lines[i].page == page) {
+            cache->lines[i].last_use = ++cache->use_counter;
+            return &cache->lines[i];
+        }
+    }
+    return NULL;
+}
+
+/* get a line for @p page, evicting the least recently used one */
+static int _alloc(mtd_cache_t *cache, uint32_t page, bool fill, mtd_cache_line_t **out)
+{
+    mtd_cache_line_t *line = &cache->lines[0];
+
+    for (unsigned i = 0; i < cache->lines_numof; i++) {
+        mtd_cache_line_t *l = &cache->lines[i];
+
+        if (l->page == MTD_CACHE_PAGE_NONE) {
+            line = l;
+            break;
+        }
+        /* wrap-around safe comparison */
+        if ((int32_t)(l->last_use - line->last_use) < 0) {
+            line = l;
+        }
+    }
+
+    int res = _write_back(cache, line);
+    if (res < 0) {
+        return res;
+    }
+    line->page = MTD_CACHE_PAGE_NONE;
+
+    if (fill) {
+        res = mtd_read_page(cache->parent, _data(cache, line), page, 0,
+                            cache->base.page_size);
+        if (res < 0) {
+            return res;
+        }
+    }
+
+    line->page = page;
+    line->last_use = ++cache->use_counter;
+    *out = line;
+    return 0;
+}
+
+static int _init(mtd_dev_t *mtd)
+{
+    mtd_cache_t *cache = _get_cache(mtd);
+    mtd_dev_t *parent = cache->parent;
+
+    int res = mtd_init(parent);
+    if (res < 0) {
+        return res;
+    }
+
+    /* inherit physical properties */
+    mtd->sector_count = parent->sector_count;
+    mtd->pages_per_sector = parent->pages_per_sector;
+    mtd->page_size = parent->page_size;
+    mtd->write_size = parent->write_size;
+
+    assert(parent->page_size <= cache->line_size);
+
+    /* take over the properties of the backing device, mtd_init() reads them
+     * after calling us */
+    cache->driver = mtd_cache_driver;
+    cache->driver.flags = parent->driver->flags;
+    mtd->driver = &cache->driver;
+
+    for (unsigned i = 0; i < cache->lines_numof; i++) {
+        cache->lines[i] = (mtd_cache_line_t) { .page = MTD_CACHE_PAGE_NONE };
+    }
+
+    return 0;
+}
+
+static int _read_page(mtd_dev_t *mtd, void *dest, uint32_t page,
+                      uint32_t offset, uint32_t count)
+{
+    mtd_cache_t *cache = _get_cache(mtd);
+    int res = 0;
+
+    count = MIN(count, mtd->page_size - offset);
+
+    mutex_lock(&cache->lock);
+
+    mtd_cache_line_t *line = _find(cache, page);
+    if (line == NULL) {
+        if (count == mtd->page_size) {
+            /* do not let whole page reads push out the working set */
+            res = mtd_read_page(cache->parent, dest, page, 0, count);
+            goto out;
+        }
+        res = _alloc(cache, page, true, &line);
+    }
+    if (res == 0) {
+        memcpy(dest, _data(cache, line) + offset, count);
+    }
+
+out:
+
+    mutex_unlock(&cache->lock);
+
+    return res < 0 ? res : (int)count;
+}
+
+static int _write_page(mtd_dev_t *mtd, const void *src, uint32_t page,
+                       uint32_t offset, uint32_t count)
+{
+    mtd_cache_t *cache = _get_cache(mtd);
+    int res = 0;
+
+    count = MIN(count, mtd->page_size - offset);
+
+    mutex_lock(&cache->lock);
+
+    mtd_cache_line_t *line = _find(cache, page);
+    if (line == NULL) {
+        res = _alloc(cache, page, count != mtd->page_size, &line);
+    }
+    else if (_is_dirty(line) &&
+             !(cache->driver.flags & MTD_DRIVER_FLAG_DIRECT_WRITE) &&
+             (offset > line->dirty_end || offset + count < line->dirty_start)) {
+        /* only a contiguous range can be written back */
+        res = _write_back(cache, line);
+    }
+
+    if (res == 0) {
+        memcpy(_data(cache, line) + offset, src, count);
+
+        if (_is_dirty(line)) {
+            line->dirty_start = MIN(line->dirty_start, offset);
+            line->dirty_end = MAX(line->dirty_end, offset + count);
+        }
+        else {
+            line->dirty_start = offset;
+            line->dirty_end = offset + count;
+        }
+    }
+
+    mutex_unlock(&cache->lock);
+
+    return res < 0 ? res : (int)count;
+}
+
+static int _erase_sector(mtd_dev_t *mtd, uint32_t sector, uint32_t count)
+{
+    mtd_cache_t *cache = _get_cache(mtd);
+    uint32_t first = sector * mtd->pages_per_sector;
+    uint32_t last = first + count * mtd->pages_per_sector;
+
+    mutex_lock(&cache->lock);
+
+    /* pending writes to the erased pages are void */
+    for (unsigned i = 0; i < cache->lines_numof; i++) {
+        mtd_cache_line_t *line = &cache->lines[i];
+
+        if (line->page >= first && line->page < last) {
+            *line = (mtd_cache_line_t) { .page = MTD_CACHE_PAGE_NONE };
+        }
+    }
+
+    int res = mtd_erase_sector(cache->parent, sector, count);
+
+    mutex_unlock(&cache->lock);
+
+    return res;
+}
+
+static int _power(mtd_dev_t *mtd, enum mtd_power_state power)
+{
+    mtd_cache_t *cache = _get_cache(mtd);
+    int res = 0;
+
+    mutex_lock(&cache->lock);
+
+    if (power == MTD_POWER_DOWN) {
+        res = _flush(cache);
+    }
+    if (res == 0) {
+        res = mtd_power(cache->parent, power);
+    }
+
+    mutex_unlock(&cache->lock);
+
+    return res;
+}
+
+int mtd_cache_flush(mtd_cache_t *cache)
+{
+    mutex_lock(&cache->lock);
+    int res = _flush(cache);
+    mutex_unlock(&cache->lock);
+
+    return res;
+}
+
+const mtd_desc_t mtd_cache_driver = {
+    .init = _init,
+    .read_page = _read_page,
+    .write_page = _write_page,
+    .erase_sector = _erase_sector,
+    .power = _power,
+};
@@ -28,15 +28,115 @@
 #include "architecture.h"
 #include "cpu.h"
 #include "cpu_conf.h"
+#include "kernel_defines.h"
 #include "macros/utils.h"
 #include "mtd_flashpage.h"
 #include "periph/flashpage.h"
 
+#if IS_USED(MODULE_MTD_FLASHPAGE_DEFERRED_ERASE)
+#include "bitfield.h"
+#include "mutex.h"
+#include "thread.h"
+#endif
+
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
 #define MTD_FLASHPAGE_END_ADDR     ((uintptr_t) CPU_FLASH_BASE + (FLASHPAGE_NUMOF * FLASHPAGE_SIZE))
 
+#if IS_USED(MODULE_MTD_FLASHPAGE_DEFERRED_ERASE)
+/* pages that read as erased, but were not erased on the flash yet */
+static BITFIELD(_pending, FLASHPAGE_NUMOF);
+/* held while a pending page is erased */
+static mutex_t _lock = MUTEX_INIT;
+/* unlocked to wake up the erase thread */
+static mutex_t _work = MUTEX_INIT_LOCKED;
+static kernel_pid_t _erase_pid = KERNEL_PID_UNDEF;
+static char _erase_stack[CONFIG_MTD_FLASHPAGE_ERASE_STACKSIZE];
+#if CONFIG_MTD_FLASHPAGE_ERASE_COUNT
+static uint16_t _erase_count[FLASHPAGE_NUMOF];
+#endif
+
+static bool _is_blank(unsigned page)
+{
+    const uint8_t *addr = flashpage_addr(page);
+
+    for (size_t i = 0; i < flashpage_size(page); i++) {
+        if (addr[i] != FLASHPAGE_ERASE_STATE) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* must be called with _lock held */
+static void _erase_pending(unsigned page)
+{
+    if (!_is_blank(page)) {
+        DEBUG("flashpage: erase page %u\n", page);
+        flashpage_erase(page);
+#if CONFIG_MTD_FLASHPAGE_ERASE_COUNT
+        if (_erase_count[page] < UINT16_MAX) {
+            _erase_count[page]++;
+        }
+#endif
+    }
+    bf_unset(_pending, page);
+}
+
+static void *_erase_thread(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        mutex_lock(&_work);
+
+        /* one page at a time, so writes wait for at most one erase */
+        int page;
+        do {
+            mutex_lock(&_lock);
+            page = bf_find_first_set(_pending, FLASHPAGE_NUMOF);
+            if (page >= 0) {
+                _erase_pending(page);
+            }
+            mutex_unlock(&_lock);
+        } while (page >= 0);
+    }
+
+    return NULL;
+}
+
+static void _erase_thread_init(void)
+{
+    mutex_lock(&_lock);
+    if (_erase_pid == KERNEL_PID_UNDEF) {
+        _erase_pid = thread_create(_erase_stack, sizeof(_erase_stack),
+                                   THREAD_PRIORITY_MIN - 1, THREAD_CREATE_STACKTEST,
+                                   _erase_thread, NULL, "flashpage_erase");
+    }
+    mutex_unlock(&_lock);
+}
+
+void mtd_flashpage_flush(void)
+{
+    int page;
+
+    mutex_lock(&_lock);
+    while ((page = bf_find_first_set(_pending, FLASHPAGE_NUMOF)) >= 0) {
+        _erase_pending(page);
+    }
+    mutex_unlock(&_lock);
+}
+
+#if CONFIG_MTD_FLASHPAGE_ERASE_COUNT
+uint16_t mtd_flashpage_erase_count(unsigned page)
+{
+    assert(page < FLASHPAGE_NUMOF);
+    return _erase_count[page];
+}
+#endif
+#endif /* MODULE_MTD_FLASHPAGE_DEFERRED_ERASE */
+
 static int _init(mtd_dev_t *dev)
 {
     mtd_flashpage_t *super = container_of(dev, mtd_flashpage_t, base);
@@ -53,6 +153,10 @@ static int _init(mtd_dev_t *dev)
            + dev->pages_per_sector * dev->page_size * dev->sector_count <= MTD_FLASHPAGE_END_ADDR);
     assert((uintptr_t)flashpage_addr(super->offset / dev->pages_per_sector)
            + dev->pages_per_sector * dev->page_size * dev->sector_count > cpu_flash_base);
+
+#if IS_USED(MODULE_MTD_FLASHPAGE_DEFERRED_ERASE)
+    _erase_thread_init();
+#endif
     return 0;
 }
 
@@ -69,6 +173,14 @@ static int _read_page(mtd_dev_t *dev, void *buf, uint32_t page,
     offset += (page % dev->pages_per_sector) * dev->page_size;
     uintptr_t addr = (uintptr_t)flashpage_addr(fpage);
 
+#if IS_USED(MODULE_MTD_FLASHPAGE_DEFERRED_ERASE)
+    if (bf_isset(_pending, fpage)) {
+        size = MIN(flashpage_size(fpage) - offset, size);
+        memset(buf, FLASHPAGE_ERASE_STATE, size);
+        return size;
+    }
+#endif
+
     addr += offset;
 
     DEBUG("flashpage: read %"PRIu32" bytes from %p to %p\n", size, (void *)addr, buf);
@@ -106,6 +218,15 @@ static int _write_page(mtd_dev_t *dev, const void *buf, uint32_t page, uint32_t
     offset += (page % dev->pages_per_sector) * dev->page_size;
     uintptr_t addr = (uintptr_t)flashpage_addr(fpage);
 
+#if IS_USED(MODULE_MTD_FLASHPAGE_DEFERRED_ERASE)
+    /* the erase thread did not get to this page yet */
+    mutex_lock(&_lock);
+    if (bf_isset(_pending, fpage)) {
+        _erase_pending(fpage);
+    }
+    mutex_unlock(&_lock);
+#endif
+
     addr += offset;
 
     DEBUG("flashpage: write %"PRIu32" bytes from %p to %p\n", size, buf, (void *)addr);
@@ -146,10 +267,20 @@ static int _erase_sector(mtd_dev_t *dev, uint32_t sector, uint32_t count)
     }
     sector += (super->offset / dev->pages_per_sector);
 
+#if IS_USED(MODULE_MTD_FLASHPAGE_DEFERRED_ERASE)
+    mutex_lock(&_lock);
+    while (count--) {
+        DEBUG("flashpage: defer erase of sector %"PRIu32"\n", sector);
+        bf_set(_pending, sector++);
+    }
+    mutex_unlock(&_lock);
+    mutex_unlock(&_work);
+#else
     while (count--) {
         DEBUG("flashpage: erase sector %"PRIu32"\n", sector);
         flashpage_erase(sector++);
     }
+#endif
 
     return 0;
 }
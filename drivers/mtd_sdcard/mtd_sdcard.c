@@ -50,26 +50,85 @@ static int mtd_sdcard_init(mtd_dev_t *dev)
     return -EIO;
 }
 
+/* read whole blocks, through the read-ahead buffer while reads are sequential */
+static int _read_blocks(mtd_sdcard_t *mtd_sd, uint32_t page, void *buff,
+                        uint16_t nblocks)
+{
+    sd_rw_response_t err;
+
+#if CONFIG_MTD_SDCARD_READAHEAD
+    if (page >= mtd_sd->ra_page &&
+        page + nblocks <= mtd_sd->ra_page + mtd_sd->ra_count) {
+        memcpy(buff, &mtd_sd->ra_buf[(page - mtd_sd->ra_page) * SD_HC_BLOCK_SIZE],
+               nblocks * SD_HC_BLOCK_SIZE);
+        mtd_sd->ra_next = page + nblocks;
+        return 0;
+    }
+
+    /* the window grows while reads are sequential */
+    if (page == mtd_sd->ra_next) {
+        mtd_sd->ra_window = MIN(MAX(2 * mtd_sd->ra_window, 1),
+                                CONFIG_MTD_SDCARD_READAHEAD);
+    }
+    else {
+        mtd_sd->ra_window = 0;
+    }
+    mtd_sd->ra_next = page + nblocks;
+
+    if (mtd_sd->ra_window && nblocks < CONFIG_MTD_SDCARD_READAHEAD) {
+        uint16_t count = MIN(nblocks + mtd_sd->ra_window, CONFIG_MTD_SDCARD_READAHEAD);
+        count = MIN(count, mtd_sd->base.sector_count - page);
+
+        mtd_sd->ra_count = 0;
+        sdcard_spi_read_blocks(mtd_sd->sd_card, page, mtd_sd->ra_buf,
+                               SD_HC_BLOCK_SIZE, count, &err);
+        if (err != SD_RW_OK) {
+            return -EIO;
+        }
+        mtd_sd->ra_page = page;
+        mtd_sd->ra_count = count;
+
+        memcpy(buff, mtd_sd->ra_buf, nblocks * SD_HC_BLOCK_SIZE);
+        return 0;
+    }
+#endif
+
+    sdcard_spi_read_blocks(mtd_sd->sd_card, page, buff, SD_HC_BLOCK_SIZE,
+                           nblocks, &err);
+    return (err == SD_RW_OK) ? 0 : -EIO;
+}
+
+/* drop read-ahead data that is about to be overwritten */
+static void _invalidate(mtd_sdcard_t *mtd_sd, uint32_t page, uint32_t nblocks)
+{
+#if CONFIG_MTD_SDCARD_READAHEAD
+    if (page < mtd_sd->ra_page + mtd_sd->ra_count &&
+        page + nblocks > mtd_sd->ra_page) {
+        mtd_sd->ra_count = 0;
+    }
+#else
+    (void)mtd_sd;
+    (void)page;
+    (void)nblocks;
+#endif
+}
+
 static int mtd_sdcard_read_page(mtd_dev_t *dev, void *buff, uint32_t page,
                                 uint32_t offset, uint32_t size)
 {
-    sd_rw_response_t err;
     mtd_sdcard_t *mtd_sd = (mtd_sdcard_t*)dev;
 
     DEBUG("mtd_sdcard_read_page: page:%" PRIu32 " offset:%" PRIu32 " size:%" PRIu32 "\n",
           page, offset, size);
 
-    if (offset || size % SD_HC_BLOCK_SIZE) {
+    if (offset || size < SD_HC_BLOCK_SIZE) {
 #if IS_USED(MODULE_MTD_WRITE_PAGE)
         if (dev->work_area == NULL) {
             DEBUG("mtd_sdcard_read_page: no work area\n");
             return -ENOTSUP;
         }
 
-        sdcard_spi_read_blocks(mtd_sd->sd_card, page,
-                               dev->work_area, SD_HC_BLOCK_SIZE,
-                               1, &err);
-        if (err != SD_RW_OK) {
+        if (_read_blocks(mtd_sd, page, dev->work_area, 1)) {
             return -EIO;
         }
 
@@ -83,13 +142,14 @@ static int mtd_sdcard_read_page(mtd_dev_t *dev, void *buff, uint32_t page,
 #endif
     }
 
-    sdcard_spi_read_blocks(mtd_sd->sd_card, page,
-                           buff, SD_HC_BLOCK_SIZE,
-                           size / SD_HC_BLOCK_SIZE, &err);
-    if (err != SD_RW_OK) {
+    /* all whole blocks in one multi-block transfer, a remainder is read by
+     * the next call */
+    uint16_t nblocks = MIN(size / SD_HC_BLOCK_SIZE, UINT16_MAX);
+
+    if (_read_blocks(mtd_sd, page, buff, nblocks)) {
         return -EIO;
     }
-    return size;
+    return nblocks * SD_HC_BLOCK_SIZE;
 }
 
 static int mtd_sdcard_write_page(mtd_dev_t *dev, const void *buff, uint32_t page,
@@ -101,19 +161,17 @@ static int mtd_sdcard_write_page(mtd_dev_t *dev, const void *buff, uint32_t page
     DEBUG("mtd_sdcard_write_page: page:%" PRIu32 " offset:%" PRIu32 " size:%" PRIu32 "\n",
           page, offset, size);
 
-    if (offset || size % SD_HC_BLOCK_SIZE) {
+    if (offset || size < SD_HC_BLOCK_SIZE) {
 #if IS_USED(MODULE_MTD_WRITE_PAGE)
         if (dev->work_area == NULL) {
             DEBUG("mtd_sdcard_write_page: no work area\n");
             return -ENOTSUP;
         }
 
-        sdcard_spi_read_blocks(mtd_sd->sd_card, page,
-                               dev->work_area, SD_HC_BLOCK_SIZE,
-                               1, &err);
-        if (err != SD_RW_OK) {
+        if (_read_blocks(mtd_sd, page, dev->work_area, 1)) {
             return -EIO;
         }
+        _invalidate(mtd_sd, page, 1);
 
         size = MIN(size, SD_HC_BLOCK_SIZE - offset);
         DEBUG("mtd_sdcard_write_page: write %" PRIu32 " bytes at offset %" PRIu32 "\n",
@@ -126,9 +184,15 @@ static int mtd_sdcard_write_page(mtd_dev_t *dev, const void *buff, uint32_t page
         return -ENOTSUP;
 #endif
     } else {
+        /* all whole blocks in one multi-block transfer, a remainder is
+         * written by the next call */
+        uint16_t nblocks = MIN(size / SD_HC_BLOCK_SIZE, UINT16_MAX);
+
+        _invalidate(mtd_sd, page, nblocks);
         sdcard_spi_write_blocks(mtd_sd->sd_card, page,
                                 buff, SD_HC_BLOCK_SIZE,
-                                size / SD_HC_BLOCK_SIZE, &err);
+                                nblocks, &err);
+        size = nblocks * SD_HC_BLOCK_SIZE;
     }
 
     if (err != SD_RW_OK) {
@@ -151,6 +215,7 @@ static int mtd_sdcard_erase_sector(mtd_dev_t *dev, uint32_t sector, uint32_t cou
         return -ENOTSUP;
     }
     memset(dev->work_area, 0, SD_HC_BLOCK_SIZE);
+    _invalidate(mtd_sd, sector, count);
     while (count) {
         sd_rw_response_t err;
         sdcard_spi_write_blocks(mtd_sd->sd_card, sector,
@@ -187,15 +252,19 @@ static int mtd_sdcard_power(mtd_dev_t *dev, enum mtd_power_state power)
 static int mtd_sdcard_read(mtd_dev_t *dev, void *buff, uint32_t addr,
                            uint32_t size)
 {
-    int res = mtd_sdcard_read_page(dev, buff, addr / SD_HC_BLOCK_SIZE,
-                                   addr % SD_HC_BLOCK_SIZE, size);
-    if (res < 0) {
-        return res;
-    }
-    if (res == (int)size) {
-        return 0;
+    uint8_t *dst = buff;
+
+    while (size) {
+        int res = mtd_sdcard_read_page(dev, dst, addr / SD_HC_BLOCK_SIZE,
+                                       addr % SD_HC_BLOCK_SIZE, size);
+        if (res < 0) {
+            return res;
+        }
+        dst += res;
+        addr += res;
+        size -= res;
     }
-    return -EOVERFLOW;
+    return 0;
 }
 
 const mtd_desc_t mtd_sdcard_driver = {
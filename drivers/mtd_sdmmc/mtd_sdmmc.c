@@ -58,6 +58,70 @@ static int mtd_sdmmc_init(mtd_dev_t *dev)
     return -EIO;
 }
 
+/* read whole blocks, through the read-ahead buffer while reads are sequential */
+static int _read_blocks(mtd_sdmmc_t *mtd_sd, uint32_t page, void *buff,
+                        uint16_t nblocks)
+{
+#if CONFIG_MTD_SDMMC_READAHEAD
+    if (page >= mtd_sd->ra_page &&
+        page + nblocks <= mtd_sd->ra_page + mtd_sd->ra_count) {
+        memcpy(buff, &mtd_sd->ra_buf[(page - mtd_sd->ra_page) * SDMMC_SDHC_BLOCK_SIZE],
+               nblocks * SDMMC_SDHC_BLOCK_SIZE);
+        mtd_sd->ra_next = page + nblocks;
+        return 0;
+    }
+
+    /* the window grows while reads are sequential */
+    if (page == mtd_sd->ra_next) {
+        mtd_sd->ra_window = MIN(MAX(2 * mtd_sd->ra_window, 1),
+                                CONFIG_MTD_SDMMC_READAHEAD);
+    }
+    else {
+        mtd_sd->ra_window = 0;
+    }
+    mtd_sd->ra_next = page + nblocks;
+
+    if (mtd_sd->ra_window && nblocks < CONFIG_MTD_SDMMC_READAHEAD) {
+        uint16_t count = MIN(nblocks + mtd_sd->ra_window, CONFIG_MTD_SDMMC_READAHEAD);
+        count = MIN(count, mtd_sd->base.sector_count - page);
+
+        mtd_sd->ra_count = 0;
+        if (sdmmc_read_blocks(mtd_sd->sdmmc, page, SDMMC_SDHC_BLOCK_SIZE,
+                              count, mtd_sd->ra_buf, NULL)) {
+            return -EIO;
+        }
+        mtd_sd->ra_page = page;
+        mtd_sd->ra_count = count;
+
+        memcpy(buff, mtd_sd->ra_buf, nblocks * SDMMC_SDHC_BLOCK_SIZE);
+        return 0;
+    }
+#endif
+
+    int err = sdmmc_read_blocks(mtd_sd->sdmmc, page, SDMMC_SDHC_BLOCK_SIZE,
+                                nblocks, buff, NULL);
+    if (err) {
+        DEBUG("mtd_sdmmc: read error %d\n", err);
+        return -EIO;
+    }
+    return 0;
+}
+
+/* drop read-ahead data that is about to be overwritten */
+static void _invalidate(mtd_sdmmc_t *mtd_sd, uint32_t page, uint32_t nblocks)
+{
+#if CONFIG_MTD_SDMMC_READAHEAD
+    if (page < mtd_sd->ra_page + mtd_sd->ra_count &&
+        page + nblocks > mtd_sd->ra_page) {
+        mtd_sd->ra_count = 0;
+    }
+#else
+    (void)mtd_sd;
+    (void)page;
+    (void)nblocks;
+#endif
+}
+
 static int mtd_sdmmc_read_page(mtd_dev_t *dev, void *buff, uint32_t page,
                                 uint32_t offset, uint32_t size)
 {
@@ -66,15 +130,14 @@ static int mtd_sdmmc_read_page(mtd_dev_t *dev, void *buff, uint32_t page,
     DEBUG("mtd_sdmmc_read_page: page:%" PRIu32 " offset:%" PRIu32 " size:%" PRIu32 "\n",
           page, offset, size);
 
-    if (offset || size % SDMMC_SDHC_BLOCK_SIZE) {
+    if (offset || size < SDMMC_SDHC_BLOCK_SIZE) {
 #if IS_USED(MODULE_MTD_WRITE_PAGE)
         if (dev->work_area == NULL) {
             DEBUG("mtd_sdmmc_read_page: no work area\n");
             return -ENOTSUP;
         }
 
-        if (sdmmc_read_blocks(mtd_sd->sdmmc, page, SDMMC_SDHC_BLOCK_SIZE,
-                              1, dev->work_area, NULL)) {
+        if (_read_blocks(mtd_sd, page, dev->work_area, 1)) {
             return -EIO;
         }
         size = MIN(size, SDMMC_SDHC_BLOCK_SIZE - offset);
@@ -87,13 +150,14 @@ static int mtd_sdmmc_read_page(mtd_dev_t *dev, void *buff, uint32_t page,
 #endif
     }
 
-    int err = sdmmc_read_blocks(mtd_sd->sdmmc, page, SDMMC_SDHC_BLOCK_SIZE,
-                                size / SDMMC_SDHC_BLOCK_SIZE, buff, NULL);
-    if (err) {
-        DEBUG("mtd_sdmmc_read_page: error %d\n", err);
+    /* all whole blocks in one multi-block transfer, a remainder is read by
+     * the next call */
+    uint16_t nblocks = MIN(size / SDMMC_SDHC_BLOCK_SIZE, UINT16_MAX);
+
+    if (_read_blocks(mtd_sd, page, buff, nblocks)) {
         return -EIO;
     }
-    return size;
+    return nblocks * SDMMC_SDHC_BLOCK_SIZE;
 }
 
 static int mtd_sdmmc_write_page(mtd_dev_t *dev, const void *buff, uint32_t page,
@@ -104,17 +168,17 @@ static int mtd_sdmmc_write_page(mtd_dev_t *dev, const void *buff, uint32_t page,
     DEBUG("mtd_sdmmc_write_page: page:%" PRIu32 " offset:%" PRIu32 " size:%" PRIu32 "\n",
           page, offset, size);
 
-    if (offset || size % SDMMC_SDHC_BLOCK_SIZE) {
+    if (offset || size < SDMMC_SDHC_BLOCK_SIZE) {
 #if IS_USED(MODULE_MTD_WRITE_PAGE)
         if (dev->work_area == NULL) {
             DEBUG("mtd_sdmmc_write_page: no work area\n");
             return -ENOTSUP;
         }
 
-        if (sdmmc_read_blocks(mtd_sd->sdmmc, page, SDMMC_SDHC_BLOCK_SIZE,
-                              1, dev->work_area, NULL)) {
+        if (_read_blocks(mtd_sd, page, dev->work_area, 1)) {
             return -EIO;
         }
+        _invalidate(mtd_sd, page, 1);
 
         size = MIN(size, SDMMC_SDHC_BLOCK_SIZE - offset);
         DEBUG("mtd_sdmmc_write_page: write %" PRIu32 " bytes at offset %" PRIu32 "\n",
@@ -129,12 +193,18 @@ static int mtd_sdmmc_write_page(mtd_dev_t *dev, const void *buff, uint32_t page,
 #endif
     }
     else {
+        /* all whole blocks in one multi-block transfer, a remainder is
+         * written by the next call */
+        uint16_t nblocks = MIN(size / SDMMC_SDHC_BLOCK_SIZE, UINT16_MAX);
+
+        _invalidate(mtd_sd, page, nblocks);
         int err = sdmmc_write_blocks(mtd_sd->sdmmc, page, SDMMC_SDHC_BLOCK_SIZE,
-                                     size / SDMMC_SDHC_BLOCK_SIZE, buff, NULL);
+                                     nblocks, buff, NULL);
         if (err) {
             DEBUG("mtd_sdmmc_write_page: error %d\n", err);
             return -EIO;
         }
+        size = nblocks * SDMMC_SDHC_BLOCK_SIZE;
     }
     return size;
 }
@@ -142,6 +212,8 @@ static int mtd_sdmmc_write_page(mtd_dev_t *dev, const void *buff, uint32_t page,
 static int mtd_sdmmc_erase_sector(mtd_dev_t *dev, uint32_t sector, uint32_t count)
 {
     mtd_sdmmc_t *mtd_sd = (mtd_sdmmc_t*)dev;
+
+    _invalidate(mtd_sd, sector, count);
     return sdmmc_erase_blocks(mtd_sd->sdmmc, sector, count);
 }
 
@@ -158,15 +230,19 @@ static int mtd_sdmmc_power(mtd_dev_t *dev, enum mtd_power_state power)
 static int mtd_sdmmc_read(mtd_dev_t *dev, void *buff, uint32_t addr,
                            uint32_t size)
 {
-    int res = mtd_sdmmc_read_page(dev, buff, addr / SDMMC_SDHC_BLOCK_SIZE,
-                                   addr % SDMMC_SDHC_BLOCK_SIZE, size);
-    if (res < 0) {
-        return res;
-    }
-    if (res == (int)size) {
-        return 0;
+    uint8_t *dst = buff;
+
+    while (size) {
+        int res = mtd_sdmmc_read_page(dev, dst, addr / SDMMC_SDHC_BLOCK_SIZE,
+                                      addr % SDMMC_SDHC_BLOCK_SIZE, size);
+        if (res < 0) {
+            return res;
+        }
+        dst += res;
+        addr += res;
+        size -= res;
     }
-    return -EOVERFLOW;
+    return 0;
 }
 
 const mtd_desc_t mtd_sdmmc_driver = {
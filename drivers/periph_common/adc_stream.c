@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/**
+ * @ingroup     drivers_periph_adc
+ * @{
+ *
+ * @file
+ * @brief       Timer triggered ADC sampling into a ping-pong buffer
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <errno.h>
+
+#include "assert.h"
+#include "periph/adc.h"
+#include "periph/timer.h"
+
+static void _sample(void *arg, int chan)
+{
+    adc_stream_t *stream = arg;
+    size_t half = stream->len / 2;
+
+    (void)chan;
+
+    stream->buf[stream->pos++] = (uint16_t)adc_continuous_sample(stream->line);
+
+    if (stream->pos == half) {
+        stream->cb(stream->arg, stream->buf, half);
+    }
+    else if (stream->pos == stream->len) {
+        stream->pos = 0;
+        stream->cb(stream->arg, &stream->buf[half], half);
+    }
+}
+
+int adc_stream_start(adc_stream_t *stream, adc_t line, adc_res_t res,
+                     tim_t tim, uint32_t rate_hz, uint16_t *buf, size_t len,
+                     adc_stream_cb_t cb, void *arg)
+{
+    assert(stream && buf && cb);
+
+    if ((len < 2) || (len & 1) ||
+        (rate_hz == 0) || (rate_hz > CONFIG_ADC_STREAM_TIMER_FREQ)) {
+        return -EINVAL;
+    }
+
+    stream->buf = buf;
+    stream->len = len;
+    stream->pos = 0;
+    stream->cb = cb;
+    stream->arg = arg;
+    stream->line = line;
+    stream->tim = tim;
+
+    if (timer_init(tim, CONFIG_ADC_STREAM_TIMER_FREQ, _sample, stream) < 0) {
+        return -ENODEV;
+    }
+    timer_stop(tim);
+
+    adc_continuous_begin(res);
+
+    timer_set_periodic(tim, 0, CONFIG_ADC_STREAM_TIMER_FREQ / rate_hz,
+                       TIM_FLAG_RESET_ON_MATCH | TIM_FLAG_RESET_ON_SET);
+    timer_start(tim);
+
+    return 0;
+}
+
+void adc_stream_stop(adc_stream_t *stream)
+{
+    assert(stream);
+
+    timer_stop(stream->tim);
+    timer_clear(stream->tim, 0);
+    adc_continuous_stop();
+}
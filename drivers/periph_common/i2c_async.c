@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/**
+ * @ingroup     drivers_periph_i2c
+ * @{
+ *
+ * @file
+ * @brief       Queued I2C transactions on top of the blocking API
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <errno.h>
+
+#include "assert.h"
+#include "irq.h"
+#include "mutex.h"
+#include "periph/i2c.h"
+#include "thread.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static char _stack[CONFIG_I2C_ASYNC_STACKSIZE];
+static kernel_pid_t _pid = KERNEL_PID_UNDEF;
+
+/* pending transactions, in order */
+static i2c_async_t *_head;
+static i2c_async_t *_tail;
+
+/* used as a semaphore to wake up the worker */
+static mutex_t _work = MUTEX_INIT_LOCKED;
+
+static i2c_async_t *_pop(void)
+{
+    unsigned state = irq_disable();
+    i2c_async_t *trans = _head;
+    if (trans) {
+        _head = trans->next;
+        if (_head == NULL) {
+            _tail = NULL;
+        }
+    }
+    irq_restore(state);
+    return trans;
+}
+
+static void _run(i2c_async_t *trans)
+{
+    i2c_acquire(trans->dev);
+    for (i2c_op_t *op = trans->ops; op; op = op->next) {
+        if (op->write) {
+            op->res = i2c_write_regs(trans->dev, op->addr, op->reg,
+                                     op->data, op->len, op->flags);
+        }
+        else {
+            op->res = i2c_read_regs(trans->dev, op->addr, op->reg,
+                                    op->data, op->len, op->flags);
+        }
+        DEBUG("i2c_async: 0x%02x/0x%02x: %d\n", op->addr, op->reg, op->res);
+    }
+    i2c_release(trans->dev);
+}
+
+static void *_worker(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        mutex_lock(&_work);
+
+        i2c_async_t *trans;
+        while ((trans = _pop())) {
+            /* the callback may reuse trans */
+            i2c_async_cb_t cb = trans->cb;
+            void *cb_arg = trans->arg;
+            _run(trans);
+            if (cb) {
+                cb(cb_arg);
+            }
+        }
+    }
+
+    return NULL;
+}
+
+static int _start_worker(void)
+{
+    unsigned state = irq_disable();
+    if (_pid == KERNEL_PID_UNDEF) {
+        _pid = thread_create(_stack, sizeof(_stack), CONFIG_I2C_ASYNC_PRIO,
+                             THREAD_CREATE_STACKTEST, _worker, NULL, "i2c_async");
+    }
+    irq_restore(state);
+
+    return pid_is_valid(_pid) ? 0 : -ENOMEM;
+}
+
+int i2c_queue(i2c_async_t *trans, i2c_t dev, i2c_op_t *ops,
+              i2c_async_cb_t cb, void *arg)
+{
+    assert(trans && ops);
+
+    int res = _start_worker();
+    if (res < 0) {
+        return res;
+    }
+
+    trans->next = NULL;
+    trans->ops = ops;
+    trans->cb = cb;
+    trans->arg = arg;
+    trans->dev = dev;
+
+    unsigned state = irq_disable();
+    if (_tail) {
+        _tail->next = trans;
+    }
+    else {
+        _head = trans;
+    }
+    _tail = trans;
+    irq_restore(state);
+
+    mutex_unlock(&_work);
+    return 0;
+}
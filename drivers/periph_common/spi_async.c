@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/**
+ * @ingroup     drivers_periph_spi
+ * @{
+ *
+ * @file
+ * @brief       Asynchronous SPI transactions on top of the blocking API
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <errno.h>
+
+#include "assert.h"
+#include "irq.h"
+#include "mutex.h"
+#include "periph/spi.h"
+#include "thread.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static char _stack[CONFIG_SPI_ASYNC_STACKSIZE];
+static kernel_pid_t _pid = KERNEL_PID_UNDEF;
+
+/* pending transactions, in order */
+static spi_async_t *_head;
+static spi_async_t *_tail;
+
+/* used as a semaphore to wake up the worker */
+static mutex_t _work = MUTEX_INIT_LOCKED;
+
+static spi_async_t *_pop(void)
+{
+    unsigned state = irq_disable();
+    spi_async_t *trans = _head;
+    if (trans) {
+        _head = trans->next;
+        if (_head == NULL) {
+            _tail = NULL;
+        }
+    }
+    irq_restore(state);
+    return trans;
+}
+
+static void _run(spi_async_t *trans)
+{
+    for (const spi_xfer_t *xfer = trans->xfers; xfer; xfer = xfer->next) {
+        spi_transfer_bytes(trans->bus, trans->cs, xfer->next != NULL,
+                           xfer->out, xfer->in, xfer->len);
+    }
+}
+
+static void *_worker(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        mutex_lock(&_work);
+
+        spi_async_t *trans;
+        while ((trans = _pop())) {
+            DEBUG("spi_async: running %p on bus %u\n", (void *)trans, (unsigned)trans->bus);
+            /* the callback may reuse trans */
+            spi_async_cb_t cb = trans->cb;
+            void *cb_arg = trans->arg;
+            _run(trans);
+            if (cb) {
+                cb(cb_arg);
+            }
+        }
+    }
+
+    return NULL;
+}
+
+static int _start_worker(void)
+{
+    unsigned state = irq_disable();
+    if (_pid == KERNEL_PID_UNDEF) {
+        _pid = thread_create(_stack, sizeof(_stack), CONFIG_SPI_ASYNC_PRIO,
+                             THREAD_CREATE_STACKTEST, _worker, NULL, "spi_async");
+    }
+    irq_restore(state);
+
+    return pid_is_valid(_pid) ? 0 : -ENOMEM;
+}
+
+int spi_transfer_async(spi_async_t *trans, spi_t bus, spi_cs_t cs,
+                       const spi_xfer_t *xfers, spi_async_cb_t cb, void *arg)
+{
+    assert(trans && xfers);
+
+    int res = _start_worker();
+    if (res < 0) {
+        return res;
+    }
+
+    trans->next = NULL;
+    trans->xfers = xfers;
+    trans->cb = cb;
+    trans->arg = arg;
+    trans->cs = cs;
+    trans->bus = bus;
+
+    unsigned state = irq_disable();
+    if (_tail) {
+        _tail->next = trans;
+    }
+    else {
+        _head = trans;
+    }
+    _tail = trans;
+    irq_restore(state);
+
+    mutex_unlock(&_work);
+    return 0;
+}
@@ -138,6 +138,64 @@ static void _slip_rx_cb(void *arg, uint8_t byte)
     }
 }
 
+#if IS_USED(MODULE_PERIPH_UART_RX_BULK)
+static size_t _plain_len(const uint8_t *data, size_t len)
+{
+    size_t n = 0;
+    while ((n < len) && (data[n] != SLIPDEV_END) && (data[n] != SLIPDEV_ESC)) {
+        n++;
+    }
+    return n;
+}
+
+static void _slip_rx_bulk_cb(void *arg, const uint8_t *data, size_t len)
+{
+    slipdev_t *dev = arg;
+
+    while (len) {
+        /* copy runs of unescaped payload at once, leave the rest to the
+         * byte-wise state machine */
+        size_t n = 0;
+        switch (dev->state) {
+#if IS_USED(MODULE_SLIPDEV_STDIO)
+        case SLIPDEV_STATE_STDIN:
+            n = _plain_len(data, len);
+            isrpipe_write(&stdin_isrpipe, data, n);
+            break;
+#endif
+        case SLIPDEV_STATE_NET:
+            n = _plain_len(data, len);
+            if (n && !crb_add_bytes(&dev->rb, data, n)) {
+                DEBUG("slipdev: rx buffer full, drop frame\n");
+                crb_end_chunk(&dev->rb, false);
+                dev->state = SLIPDEV_STATE_NONE;
+            }
+            break;
+        default:
+            break;
+        }
+
+        if (n == 0) {
+            _slip_rx_cb(dev, *data);
+            n = 1;
+        }
+        data += n;
+        len -= n;
+    }
+}
+
+static int _uart_init(slipdev_t *dev)
+{
+    return uart_init_rx_bulk(dev->config.uart, dev->config.baudrate,
+                             _slip_rx_bulk_cb, dev);
+}
+#else
+static int _uart_init(slipdev_t *dev)
+{
+    return uart_init(dev->config.uart, dev->config.baudrate, _slip_rx_cb, dev);
+}
+#endif
+
 static void _poweron(slipdev_t *dev)
 {
     if ((dev->state != SLIPDEV_STATE_STANDBY) &&
@@ -146,7 +204,7 @@ static void _poweron(slipdev_t *dev)
     }
 
     dev->state = 0;
-    uart_init(dev->config.uart, dev->config.baudrate, _slip_rx_cb, dev);
+    _uart_init(dev);
 }
 
 static inline void _poweroff(slipdev_t *dev, uint8_t state)
@@ -163,8 +221,7 @@ static int _init(netdev_t *netdev)
           (void *)dev, dev->config.uart, dev->config.baudrate);
     /* initialize buffers */
     crb_init(&dev->rb, dev->rxmem, sizeof(dev->rxmem));
-    if (uart_init(dev->config.uart, dev->config.baudrate, _slip_rx_cb,
-                  dev) != UART_OK) {
+    if (_uart_init(dev) != UART_OK) {
         LOG_ERROR("slipdev: error initializing UART %i with baudrate %" PRIu32 "\n",
                   dev->config.uart, dev->config.baudrate);
         return -ENODEV;
@@ -178,21 +235,23 @@ static int _init(netdev_t *netdev)
 
 void slipdev_write_bytes(uart_t uart, const uint8_t *data, size_t len)
 {
-    for (unsigned j = 0; j < len; j++, data++) {
-        switch (*data) {
-            case SLIPDEV_END:
-                /* escaping END byte*/
-                slipdev_write_byte(uart, SLIPDEV_ESC);
-                slipdev_write_byte(uart, SLIPDEV_END_ESC);
-                break;
-            case SLIPDEV_ESC:
-                /* escaping ESC byte*/
-                slipdev_write_byte(uart, SLIPDEV_ESC);
-                slipdev_write_byte(uart, SLIPDEV_ESC_ESC);
-                break;
-            default:
-                slipdev_write_byte(uart, *data);
+    static const uint8_t esc_end[] = { SLIPDEV_ESC, SLIPDEV_END_ESC };
+    static const uint8_t esc_esc[] = { SLIPDEV_ESC, SLIPDEV_ESC_ESC };
+    const uint8_t *run = data;
+
+    /* write the bytes between two bytes to escape with a single call */
+    for (const uint8_t *end = data + len; data < end; data++) {
+        if ((*data != SLIPDEV_END) && (*data != SLIPDEV_ESC)) {
+            continue;
+        }
+        if (data > run) {
+            uart_write(uart, run, data - run);
         }
+        uart_write(uart, (*data == SLIPDEV_END) ? esc_end : esc_esc, 2);
+        run = data + 1;
+    }
+    if (data > run) {
+        uart_write(uart, run, data - run);
     }
 }
 
@@ -20,6 +20,7 @@
 #include <stdio.h>
 #include <assert.h>
 
+#include "bitbang.h"
 #include "mutex.h"
 #include "periph/gpio.h"
 #include "xtimer.h"
@@ -36,6 +37,15 @@
  */
 static mutex_t locks[SOFT_SPI_NUMOF];
 
+/**
+ * @brief   Pins of each SPI device, prepared for bit-banging
+ */
+static struct {
+    bitbang_pin_t mosi;
+    bitbang_pin_t miso;
+    bitbang_pin_t clk;
+} pins[SOFT_SPI_NUMOF];
+
 static inline bool soft_spi_bus_is_valid(soft_spi_t bus)
 {
     unsigned int soft_spi_num = (unsigned int) bus;
@@ -82,6 +92,13 @@ void soft_spi_init_pins(soft_spi_t bus)
     if (gpio_is_valid(soft_spi_config[bus].miso_pin)) {
         gpio_init(soft_spi_config[bus].miso_pin, GPIO_IN);
     }
+
+    bitbang_pin_init(&pins[bus].clk, soft_spi_config[bus].clk_pin,
+                     soft_spi_config[bus].clk_pin);
+    bitbang_pin_init(&pins[bus].mosi, soft_spi_config[bus].mosi_pin,
+                     soft_spi_config[bus].clk_pin);
+    bitbang_pin_init(&pins[bus].miso, soft_spi_config[bus].miso_pin,
+                     soft_spi_config[bus].clk_pin);
 }
 
 int soft_spi_init_cs(soft_spi_t bus, soft_spi_cs_t cs)
@@ -141,39 +158,49 @@ void soft_spi_release(soft_spi_t bus)
     mutex_unlock(&locks[bus]);
 }
 
+static inline void _half_clock(soft_spi_clk_t clk)
+{
+    /* sleeping for 0 us still costs a timer round trip */
+    if (clk != SOFT_SPI_CLK_DEFAULT) {
+        xtimer_usleep(clk);
+    }
+}
+
 static inline uint8_t _transfer_one_byte(soft_spi_t bus, uint8_t out)
 {
+    const bitbang_pin_t *mosi = &pins[bus].mosi;
+    const bitbang_pin_t *miso = &pins[bus].miso;
+    const bitbang_pin_t *clk_pin = &pins[bus].clk;
+    soft_spi_clk_t clk = soft_spi_config[bus].soft_spi_clk;
     uint8_t i = 8;
+
     if (SOFT_SPI_MODE_1 == soft_spi_config[bus].soft_spi_mode ||
         SOFT_SPI_MODE_3 == soft_spi_config[bus].soft_spi_mode) {
         /* CPHA = 1*/
-        gpio_toggle(soft_spi_config[bus].clk_pin);
+        bitbang_toggle(clk_pin);
     }
 
     do {
-        uint8_t bit = out >> 7;
-        gpio_write(soft_spi_config[bus].mosi_pin, bit);
+        bitbang_write(mosi, out >> 7);
 
-        xtimer_usleep(soft_spi_config[bus].soft_spi_clk);
-        gpio_toggle(soft_spi_config[bus].clk_pin);
+        _half_clock(clk);
+        bitbang_toggle(clk_pin);
 
         out <<= 1; /*shift transfer register*/
+        out |= bitbang_read(miso); /*set bit 0*/
 
-        bit = gpio_read(soft_spi_config[bus].miso_pin);
-        out = bit ? (out | 0x01) : (out & 0xfe); /*set or delete bit 0*/
-
-        xtimer_usleep(soft_spi_config[bus].soft_spi_clk);
+        _half_clock(clk);
         --i;
         if (i > 0) {
-            gpio_toggle(soft_spi_config[bus].clk_pin);
+            bitbang_toggle(clk_pin);
         }
     } while (i > 0);
 
     if (SOFT_SPI_MODE_0 == soft_spi_config[bus].soft_spi_mode ||
         SOFT_SPI_MODE_2 == soft_spi_config[bus].soft_spi_mode) {
         /* CPHA = 0 */
-        xtimer_usleep(soft_spi_config[bus].soft_spi_clk);
-        gpio_toggle(soft_spi_config[bus].clk_pin);
+        _half_clock(clk);
+        bitbang_toggle(clk_pin);
     }
 
     return out;
@@ -18,6 +18,7 @@
 
 #include <stdio.h>
 
+#include "bitbang.h"
 #include "mutex.h"
 #include "soft_uart.h"
 #include "soft_uart_params.h"
@@ -41,6 +42,7 @@ struct uart_ctx {
     mutex_t sync;       /**< TX byte done signal */
     uart_rx_cb_t rx_cb; /**< RX callback         */
     void* rx_cb_arg;    /**< RX callback arg     */
+    bitbang_pin_t tx;   /**< TX pin              */
     uint32_t bit_time;  /**< timer ticks per bit */
     uint16_t byte_tx;   /**< current TX byte     */
     uint16_t byte_rx;   /**< current RX byte     */
@@ -70,7 +72,7 @@ static void _tx_timer_cb(void *arg, int chan)
     const soft_uart_conf_t *cfg = &soft_uart_config[uart];
     struct uart_ctx *ctx = &soft_uart_ctx[uart];
 
-    gpio_write(cfg->tx_pin, ctx->byte_tx & 1);
+    bitbang_write(&ctx->tx, ctx->byte_tx & 1);
     ctx->byte_tx >>= 1;
 
     if (--ctx->bits_tx == 0) {
@@ -169,6 +171,7 @@ int soft_uart_init(soft_uart_t uart, uint32_t baudrate, uart_rx_cb_t rx_cb, void
         timer_init(cfg->tx_timer, cfg->timer_freq, _tx_timer_cb, (void *)(uintptr_t)uart);
         gpio_write(cfg->tx_pin, !(cfg->flags & SOFT_UART_FLAG_INVERT_TX));
         gpio_init(cfg->tx_pin, GPIO_OUT);
+        bitbang_pin_init(&ctx->tx, cfg->tx_pin, cfg->tx_pin);
     }
 
     if (rx_cb) {
@@ -1314,6 +1314,21 @@ static int _usbdev_ep_get(usbdev_ep_t *ep, usbopt_ep_t opt,
             *(size_t *)value = _get_available(ep);
             res = sizeof(size_t);
             break;
+        case USBOPT_EP_MAX_XFER_SIZE:
+            /* Without DMA the whole transfer is written into the TX FIFO
+             * at once, which only has room for a single packet */
+            if ((ep->dir != USB_EP_DIR_IN) ||
+                !_uses_dma(((dwc2_usb_otg_fshs_t *)ep->dev)->config)) {
+                break;
+            }
+            assert(max_len == sizeof(size_t));
+            *(size_t *)value = ep->len * (USB_OTG_DIEPTSIZ_PKTCNT_Msk >>
+                                          USB_OTG_DIEPTSIZ_PKTCNT_Pos);
+            if (*(size_t *)value > USB_OTG_DIEPTSIZ_XFRSIZ_Msk) {
+                *(size_t *)value = USB_OTG_DIEPTSIZ_XFRSIZ_Msk;
+            }
+            res = sizeof(size_t);
+            break;
         default:
             DEBUG("usbdev: Unhandled endpoint get call: 0x%x\n", opt);
             break;
@@ -1445,9 +1460,11 @@ static int _usbdev_ep_xmit(usbdev_ep_t *ep, uint8_t *buf, size_t len)
          * controller in the peripheral
          */
 
-        /* PKTCNT has to be set for all IN EPs to use the XFRC interrupt */
+        /* PKTCNT has to be set for all IN EPs to use the XFRC interrupt,
+         * a zero length packet counts as one packet */
+        uint32_t pktcnt = (len > ep->len) ? (len + ep->len - 1) / ep->len : 1;
         _in_regs(conf, ep->num)->DIEPTSIZ = (len & USB_OTG_DIEPTSIZ_XFRSIZ_Msk) |
-                                            (1 << USB_OTG_DIEPTSIZ_PKTCNT_Pos);
+                                            (pktcnt << USB_OTG_DIEPTSIZ_PKTCNT_Pos);
 
         /* Intentionally enabling this before the FIFO is filled, unmasking the
          * interrupts after the FIFO is filled doesn't always trigger the ISR */
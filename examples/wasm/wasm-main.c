@@ -15,6 +15,12 @@
 #include "blob/test.wasm.h"
 #include "blob/hello.wasm.h"
 
+#ifdef WASM_BENCH
+#include "blob/bench.wasm.h"
+#include "blob/bench.aot.h"
+#include "wamr_natives.h"
+#endif
+
 bool iwasm_runtime_init(void);
 void iwasm_runtime_destroy(void);
 
@@ -39,6 +45,19 @@ int main(void)
     ret = wamr_run_cp(hello_wasm, hello_wasm_len, app_argc, app_argv);
     printf("ret = %d\n", ret);
 
+#ifdef WASM_BENCH
+    printf("natives registered: %s\n", telltruth(wamr_natives_register()));
+
+    puts("interpreter:");
+    wamr_run_cp(bench_wasm, bench_wasm_len, 0, NULL);
+
+    /* AOT code compiled with --xip runs in place, so unlike the bytecode
+     * above the BLOB is not copied to RAM */
+    puts("AOT:");
+    char *bench_argv[] = { "bench" };
+    wamr_run((void *)bench_aot, bench_aot_len, 1, bench_argv);
+#endif
+
     iwasm_runtime_destroy();
 
 }
@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/* CPU bound workload to compare the interpreter with AOT compiled code,
+ * riot_ztimer_now_usec() is provided by the module wamr_natives */
+
+#include <stdint.h>
+
+extern int printf(const char *, ...);
+extern uint32_t riot_ztimer_now_usec(void);
+
+#define WASM_EXPORT __attribute__((visibility("default")))
+
+static uint8_t _buf[1024];
+
+static uint32_t _crc32(const uint8_t *buf, unsigned len, uint32_t crc)
+{
+    crc = ~crc;
+    while (len--) {
+        crc ^= *buf++;
+        for (unsigned i = 0; i < 8; i++) {
+            crc = (crc >> 1) ^ (0xedb88320 & -(crc & 1));
+        }
+    }
+    return ~crc;
+}
+
+WASM_EXPORT int main(int argc, char **argv)
+{
+    (void)argc;
+    (void)argv;
+
+    for (unsigned i = 0; i < sizeof(_buf); i++) {
+        _buf[i] = i;
+    }
+
+    uint32_t start = riot_ztimer_now_usec();
+    uint32_t crc = 0;
+    for (unsigned i = 0; i < 16; i++) {
+        crc = _crc32(_buf, sizeof(_buf), crc);
+    }
+    uint32_t time = riot_ztimer_now_usec() - start;
+
+    printf("crc32 of 16 KiB: 0x%08x in %u us\n", (unsigned)crc, (unsigned)time);
+    return 0;
+}
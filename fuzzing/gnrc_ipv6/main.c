@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#include <err.h>
+#include <stdlib.h>
+
+#include "fuzzing.h"
+
+#include "net/gnrc/netif.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/ipv6/addr.h"
+
+#define ADDR        "2001:db8::1"
+#define PREFIX_LEN  (64)
+
+static gnrc_netif_t *netif;
+
+static int receive(const uint8_t *data, size_t size)
+{
+    gnrc_pktsnip_t *hdr, *pkt;
+
+    if (!(hdr = gnrc_netif_hdr_build(NULL, 0, NULL, 0))) {
+        errx(EXIT_FAILURE, "gnrc_netif_hdr_build failed");
+    }
+    gnrc_netif_hdr_set_netif(hdr->data, netif);
+
+    if (!(pkt = gnrc_pktbuf_add(hdr, NULL, 0, GNRC_NETTYPE_IPV6))) {
+        errx(EXIT_FAILURE, "gnrc_pktbuf_add failed");
+    }
+    if (fuzzing_dispatch(pkt, GNRC_NETTYPE_IPV6, GNRC_NETREG_DEMUX_CTX_ALL,
+                         data, size)) {
+        errx(EXIT_FAILURE, "fuzzing_dispatch failed");
+    }
+
+    return 0;
+}
+
+int main(void)
+{
+    ipv6_addr_t addr;
+
+    if (ipv6_addr_from_str(&addr, ADDR) == NULL) {
+        errx(EXIT_FAILURE, "ipv6_addr_from_str failed");
+    }
+    if (fuzzing_init(&addr, PREFIX_LEN)) {
+        errx(EXIT_FAILURE, "fuzzing_init failed");
+    }
+    netif = gnrc_netif_iter(NULL);
+
+    if (fuzzing_run(receive)) {
+        errx(EXIT_FAILURE, "fuzzing_run failed");
+    }
+
+    exit(EXIT_SUCCESS);
+    return EXIT_SUCCESS;
+}
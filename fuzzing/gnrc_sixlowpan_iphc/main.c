@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#include <assert.h>
+#include <err.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "fuzzing.h"
+
+#include "net/gnrc/netif.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/netif/ieee802154.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/netdev_test.h"
+
+static const uint8_t local_eui64[] = {
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01
+};
+static const uint8_t remote_eui64[] = {
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02
+};
+
+static char netif_stack[THREAD_STACKSIZE_DEFAULT];
+static gnrc_netif_t netif;
+static netdev_test_t dev;
+
+/* IPHC address decompression needs a 6LoWPAN interface to derive addresses
+ * from, so the dummy interface of fuzzing_init() can't be used */
+static int _dev_send(netdev_t *netdev, const iolist_t *iolist)
+{
+    int len = 0;
+
+    (void)netdev;
+    for (; iolist; iolist = iolist->iol_next) {
+        len += iolist->iol_len;
+    }
+    return len;
+}
+
+static int _dev_get_device_type(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    (void)max_len;
+    assert(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_IEEE802154;
+    return sizeof(uint16_t);
+}
+
+static int _dev_get_proto(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    (void)max_len;
+    assert(max_len == sizeof(gnrc_nettype_t));
+    *((gnrc_nettype_t *)value) = GNRC_NETTYPE_SIXLOWPAN;
+    return sizeof(gnrc_nettype_t);
+}
+
+static int _dev_get_max_pdu_size(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    (void)max_len;
+    assert(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = 102;
+    return sizeof(uint16_t);
+}
+
+static int _dev_get_src_len(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    (void)max_len;
+    assert(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = sizeof(local_eui64);
+    return sizeof(uint16_t);
+}
+
+static int _dev_get_addr_long(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    (void)max_len;
+    assert(max_len >= sizeof(local_eui64));
+    memcpy(value, local_eui64, sizeof(local_eui64));
+    return sizeof(local_eui64);
+}
+
+static void initialize(void)
+{
+    netdev_test_setup(&dev, NULL);
+    netdev_test_set_send_cb(&dev, _dev_send);
+    netdev_test_set_get_cb(&dev, NETOPT_DEVICE_TYPE, _dev_get_device_type);
+    netdev_test_set_get_cb(&dev, NETOPT_PROTO, _dev_get_proto);
+    netdev_test_set_get_cb(&dev, NETOPT_MAX_PDU_SIZE, _dev_get_max_pdu_size);
+    netdev_test_set_get_cb(&dev, NETOPT_SRC_LEN, _dev_get_src_len);
+    netdev_test_set_get_cb(&dev, NETOPT_ADDRESS_LONG, _dev_get_addr_long);
+
+    if (gnrc_netif_ieee802154_create(&netif, netif_stack, sizeof(netif_stack),
+                                     GNRC_NETIF_PRIO, "dummy_netif",
+                                     &dev.netdev.netdev)) {
+        errx(EXIT_FAILURE, "gnrc_netif_ieee802154_create failed");
+    }
+}
+
+static int receive(const uint8_t *data, size_t size)
+{
+    gnrc_pktsnip_t *hdr, *pkt;
+
+    if (!(hdr = gnrc_netif_hdr_build(remote_eui64, sizeof(remote_eui64),
+                                     local_eui64, sizeof(local_eui64)))) {
+        errx(EXIT_FAILURE, "gnrc_netif_hdr_build failed");
+    }
+    gnrc_netif_hdr_set_netif(hdr->data, &netif);
+
+    if (!(pkt = gnrc_pktbuf_add(hdr, NULL, 0, GNRC_NETTYPE_SIXLOWPAN))) {
+        errx(EXIT_FAILURE, "gnrc_pktbuf_add failed");
+    }
+    if (fuzzing_dispatch(pkt, GNRC_NETTYPE_SIXLOWPAN, GNRC_NETREG_DEMUX_CTX_ALL,
+                         data, size)) {
+        errx(EXIT_FAILURE, "fuzzing_dispatch failed");
+    }
+
+    return 0;
+}
+
+int main(void)
+{
+    initialize();
+
+    if (fuzzing_run(receive)) {
+        errx(EXIT_FAILURE, "fuzzing_run failed");
+    }
+
+    exit(EXIT_SUCCESS);
+    return EXIT_SUCCESS;
+}
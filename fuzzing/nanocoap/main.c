@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#include <err.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "fuzzing.h"
+#include "net/nanocoap.h"
+
+/* a CoAP message fits into the IPv6 minimum MTU */
+#define BUF_SIZE    (1280)
+
+/* coap_parse() works in place */
+static uint8_t buf[BUF_SIZE];
+
+static int parse(const uint8_t *data, size_t size)
+{
+    coap_pkt_t pkt;
+    coap_optpos_t opt;
+    uint8_t *value;
+    uint8_t uri[CONFIG_NANOCOAP_URI_MAX];
+
+    if (size > sizeof(buf)) {
+        return 0;
+    }
+    memcpy(buf, data, size);
+
+    if (coap_parse(&pkt, buf, size) < 0) {
+        return 0;
+    }
+
+    for (bool first = true; coap_opt_get_next(&pkt, &opt, &value, first) >= 0;
+         first = false) {}
+    coap_get_uri_path(&pkt, uri);
+
+    return 0;
+}
+
+int main(void)
+{
+    if (fuzzing_run(parse)) {
+        errx(EXIT_FAILURE, "fuzzing_run failed");
+    }
+
+    exit(EXIT_SUCCESS);
+    return EXIT_SUCCESS;
+}
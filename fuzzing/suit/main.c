@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#include <err.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "fuzzing.h"
+#include "nanocbor/nanocbor.h"
+#include "suit.h"
+#include "suit/handlers.h"
+#include "suit/storage.h"
+
+#define URLBUF_SIZE (128)
+
+/* The fuzzer can't produce signed envelopes, so inputs are processed as the
+ * manifest wrapped by an already authenticated envelope. */
+static int parse(const uint8_t *data, size_t size)
+{
+    char url[URLBUF_SIZE];
+    suit_manifest_t manifest;
+    nanocbor_value_t it;
+
+    memset(&manifest, 0, sizeof(manifest));
+    manifest.buf = data;
+    manifest.len = size;
+    manifest.urlbuf = url;
+    manifest.urlbuf_len = sizeof(url);
+    manifest.state = SUIT_STATE_COSE_AUTHENTICATED |
+                     SUIT_STATE_FULLY_AUTHENTICATED;
+
+    nanocbor_decoder_init(&it, data, size);
+    suit_handle_manifest_structure(&manifest, &it, suit_global_handlers,
+                                   suit_global_handlers_len);
+
+    /* accept the same sequence numbers again with the next input */
+    suit_storage_set_seq_no_all(0);
+
+    return 0;
+}
+
+int main(void)
+{
+    suit_storage_init_all();
+    suit_storage_set_seq_no_all(0);
+
+    if (fuzzing_run(parse)) {
+        errx(EXIT_FAILURE, "fuzzing_run failed");
+    }
+
+    exit(EXIT_SUCCESS);
+    return EXIT_SUCCESS;
+}
@@ -12,18 +12,20 @@
 #include "uri_parser.h"
 #include "fuzzing.h"
 
-int main(void)
+static int parse(const uint8_t *data, size_t size)
 {
-    size_t input_len;
-    char *input_buf = (char *)fuzzing_read_bytes(STDIN_FILENO, &input_len);
+    uri_parser_result_t uri_res;
 
-    if (input_buf == NULL) {
-        errx(EXIT_FAILURE, "fuzzing_read_bytes failed");
-    }
+    uri_parser_process(&uri_res, (const char *)data, size);
 
-    uri_parser_result_t uri_res;
+    return 0;
+}
 
-    uri_parser_process(&uri_res, input_buf, input_len);
+int main(void)
+{
+    if (fuzzing_run(parse)) {
+        errx(EXIT_FAILURE, "fuzzing_run failed");
+    }
 
     exit(EXIT_SUCCESS);
     return EXIT_SUCCESS;
@@ -35,6 +35,11 @@ endif
 ifeq ($(NATIVE_ARCH_BIT),64)
   CFLAGS += -m64
   LINKFLAGS += -m64
+  ifneq (llvm,$(TOOLCHAIN))
+    # GCC aligns objects of 32 bytes and more to 32 bytes on x86_64, which
+    # puts padding into cross-file arrays (XFA) of such objects
+    CFLAGS += -malign-data=abi
+  endif
 else ifeq ($(NATIVE_ARCH_BIT),32)
   CFLAGS += -m32
   LINKFLAGS += -m32
@@ -241,6 +241,7 @@ FEATURES_EXISTING := \
     periph_uart_modecfg \
     periph_uart_nonblocking \
     periph_uart_reconfigure \
+    periph_uart_rx_bulk \
     periph_uart_rxstart_irq \
     periph_uart_tx_ondemand \
     periph_usbdev \
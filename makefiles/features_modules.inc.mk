@@ -11,6 +11,7 @@ USEMODULE += $(PERIPH_FEATURES)
 
 # Add all USED periph_% init modules unless they are blacklisted
 PERIPH_IGNORE_MODULES := \
+  periph_adc_stream \
   periph_cipher_aes_128_cbc \
   periph_clic \
   periph_common \
@@ -37,6 +38,7 @@ PERIPH_IGNORE_MODULES := \
   periph_hash_sha_512_224 \
   periph_hash_sha_512_256 \
   periph_hmac_sha_256 \
+  periph_i2c_async \
   periph_i2c_hw \
   periph_i2c_sw \
   periph_init% \
@@ -48,10 +50,12 @@ PERIPH_IGNORE_MODULES := \
   periph_rtc_rtt \
   periph_rtt_hw_rtc \
   periph_rtt_hw_sys \
+  periph_spi_async \
   periph_spi_on_qspi \
   periph_timer_poll \
   periph_timer_query_freqs \
   periph_uart_collision \
+  periph_uart_rx_bulk \
   periph_uart_rxstart_irq \
   periph_wdog \
   periph_wdt_auto_start \
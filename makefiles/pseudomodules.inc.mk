@@ -22,6 +22,8 @@
 
 PSEUDOMODULES += atomic_utils
 PSEUDOMODULES += base64url
+PSEUDOMODULES += benchmark_cycles
+PSEUDOMODULES += benchmark_result
 
 ## @defgroup pseudomodule_board_software_reset board_software_reset
 ## @brief Use any software-only reset button on the board to reboot
@@ -54,12 +56,17 @@ PSEUDOMODULES += cc2538_rf_obs_sig
 PSEUDOMODULES += conn_can_isotp_multi
 PSEUDOMODULES += cord_ep_standalone
 PSEUDOMODULES += core_%
+PSEUDOMODULES += cpp_coro
+PSEUDOMODULES += cpp_function
+PSEUDOMODULES += cpp_net
+PSEUDOMODULES += cpp_periph
 PSEUDOMODULES += cortexm_fpu
 PSEUDOMODULES += cortexm_svc
 PSEUDOMODULES += cpp
 PSEUDOMODULES += cpu_check_address
 PSEUDOMODULES += crc16_fast
 PSEUDOMODULES += crc32_fast
+PSEUDOMODULES += crc32_slice8
 PSEUDOMODULES += credman_load
 PSEUDOMODULES += dbgpin
 PSEUDOMODULES += devfs_%
@@ -74,8 +81,23 @@ PSEUDOMODULES += dns_msg
 PSEUDOMODULES += ecc_%
 PSEUDOMODULES += ethos_stdio
 PSEUDOMODULES += event_%
+## @defgroup pseudomodule_event_dlist event_dlist
+## @ingroup sys_event
+## @brief Link queued events in both directions and queue them by priority
+##
+## Makes event_cancel() O(1) instead of O(n) and honours event_t::priority,
+## at the cost of a pointer and a byte per event.
+PSEUDOMODULES += event_dlist
 PSEUDOMODULES += event_timeout
 PSEUDOMODULES += event_timeout_ztimer
+## @defgroup pseudomodule_evtimer_heap evtimer_heap
+## @ingroup sys_evtimer
+## @brief Store the pending events of evtimers in a pairing heap
+##
+## Makes evtimer_add() O(1) and evtimer_del() O(log n) amortized instead of
+## O(n), at the cost of two more pointers per event. Useful with many pending
+## events, e.g. for the NIB of a border router with many neighbors.
+PSEUDOMODULES += evtimer_heap
 PSEUDOMODULES += evtimer_mbox
 PSEUDOMODULES += fatfs_vfs_format
 PSEUDOMODULES += fmt_%
@@ -83,6 +105,27 @@ PSEUDOMODULES += gcoap_forward_proxy
 PSEUDOMODULES += gcoap_forward_proxy_thread
 PSEUDOMODULES += gcoap_fileserver
 PSEUDOMODULES += gcoap_dtls
+## @defgroup pseudomodule_gcoap_obs_fanout gcoap_obs_fanout
+## @{
+## @brief Allow several observers per resource in @ref net_gcoap
+##
+## A notification is encoded once and sent to every observer of the resource,
+## only its header is rebuilt per observer.
+PSEUDOMODULES += gcoap_obs_fanout
+## @}
+## @defgroup pseudomodule_gcoap_tcp gcoap_tcp
+## @{
+## @brief CoAP over TCP (RFC 8323) transport for @ref net_gcoap
+PSEUDOMODULES += gcoap_tcp
+## @}
+## @defgroup pseudomodule_gcoap_workers gcoap_workers
+## @{
+## @brief Run slow request handlers of @ref net_gcoap in worker threads
+##
+## Handlers of resources with @ref COAP_HANDLER_SLOW are run by a pool of
+## CONFIG_GCOAP_WORKERS_NUMOF threads, so they do not delay other requests.
+PSEUDOMODULES += gcoap_workers
+## @}
 ## @addtogroup net_gcoap_dns
 ## @{
 ## Enable @ref net_gcoap_dns
@@ -111,6 +154,7 @@ PSEUDOMODULES += gnrc_ipv6_auto_subnets_simple
 PSEUDOMODULES += gnrc_ipv6_classic
 PSEUDOMODULES += gnrc_ipv6_default
 PSEUDOMODULES += gnrc_ipv6_ext_frag_stats
+PSEUDOMODULES += gnrc_ipv6_inline
 PSEUDOMODULES += gnrc_ipv6_router
 PSEUDOMODULES += gnrc_ipv6_router_default
 PSEUDOMODULES += gnrc_ipv6_nib_6lbr
@@ -122,6 +166,15 @@ PSEUDOMODULES += gnrc_ipv6_nib_router
 PSEUDOMODULES += gnrc_ipv6_nib_rtr_adv_pio_cb
 PSEUDOMODULES += gnrc_lorawan_1_1
 PSEUDOMODULES += gnrc_neterr
+
+## @defgroup net_gnrc_netreg_hash gnrc_netreg_hash: Hashed transport layer registry
+## @ingroup net_gnrc_netreg
+## @{
+## Keeps the registry entries of UDP and TCP in
+## @ref CONFIG_GNRC_NETREG_HASH_BUCKETS buckets by port, so dispatching a
+## datagram does not walk the entries of all sockets.
+PSEUDOMODULES += gnrc_netreg_hash
+## @}
 PSEUDOMODULES += gnrc_netapi_callbacks
 PSEUDOMODULES += gnrc_netapi_mbox
 PSEUDOMODULES += gnrc_netif_bus
@@ -130,8 +183,45 @@ PSEUDOMODULES += gnrc_netif_6lo
 PSEUDOMODULES += gnrc_netif_ipv6
 PSEUDOMODULES += gnrc_netif_mac
 PSEUDOMODULES += gnrc_netif_single
+PSEUDOMODULES += gnrc_netif_rx_poll
+PSEUDOMODULES += gnrc_netif_shared
 PSEUDOMODULES += gnrc_netif_dedup
 
+## @defgroup net_gnrc_pkt_ext gnrc_pkt_ext: Packet snips referencing external memory
+## @ingroup net_gnrc_pkt
+## @{
+## Lets packet snips reference memory outside of the packet buffer, see
+## @ref gnrc_pktbuf_add_ext(). `gnrc_sock_udp` then sends large elements of
+## the iolist given to @ref sock_udp_sendv() without copying them (see
+## @ref CONFIG_GNRC_SOCK_UDP_TX_EXT_MIN) and returns once the interface
+## released them.
+## Costs a pointer per packet snip.
+PSEUDOMODULES += gnrc_pkt_ext
+## @}
+
+## @defgroup net_gnrc_pkt_headroom gnrc_pkt_headroom: Packet snips with headroom
+## @ingroup net_gnrc_pkt
+## @{
+## Lets packet snips own bytes in front of their data. Removing headers with
+## @ref gnrc_pktbuf_pull() and marking them with @ref gnrc_pktbuf_mark() then
+## copy the header at most, never the payload, and decompressed headers are
+## written in front of the payload with @ref gnrc_pktbuf_push(). IEEE 802.15.4
+## interfaces reserve @ref CONFIG_GNRC_NETIF_RX_HEADROOM bytes for this.
+## Costs 2 bytes (plus padding) per packet snip.
+PSEUDOMODULES += gnrc_pkt_headroom
+## @}
+
+## @defgroup net_gnrc_pkt_quota gnrc_pkt_quota: Packet buffer quotas
+## @ingroup net_gnrc_pktbuf
+## @{
+## Limits the bytes of received packets each @ref net_gnrc_netif may have in
+## the packet buffer to @ref CONFIG_GNRC_NETIF_PKTBUF_QUOTA. Frames received
+## beyond that are dropped right away, so a flood on one interface does not
+## starve the others. The usage is printed by @ref gnrc_pktbuf_stats().
+## Costs a pointer and 2 bytes (plus padding) per packet snip.
+PSEUDOMODULES += gnrc_pkt_quota
+## @}
+
 
 ## @addtogroup 	net_gnrc_nettype
 ## @{
@@ -208,6 +298,15 @@ PSEUDOMODULES += gnrc_nettype_udp
 ## @}
 
 
+## @defgroup net_gnrc_rpl_mrhof gnrc_rpl_mrhof: MRHOF
+## @ingroup net_gnrc_rpl
+## @brief  Minimum Rank with Hysteresis Objective Function (RFC 6719) for RPL
+##
+## Selects parents by the ETX of the link as measured by `netstats_neighbor_etx` and makes
+## MRHOF the default objective function of new DODAGs.
+## @{
+PSEUDOMODULES += gnrc_rpl_mrhof
+## @}
 PSEUDOMODULES += gnrc_sixloenc
 PSEUDOMODULES += gnrc_sixlowpan_border_router_default
 PSEUDOMODULES += gnrc_sixlowpan_default
@@ -216,6 +315,16 @@ PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_ecn
 PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_ecn_if_in
 PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_ecn_if_out
 PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_ecn_fqueue
+## @defgroup net_gnrc_sixlowpan_frag_sfr_pacing gnrc_sixlowpan_frag_sfr_pacing: SFR pacing by measured TX time
+## @ingroup net_gnrc_sixlowpan_frag_sfr
+## @brief  Paces SFR fragments by the measured TX time to the next hop and estimates the RTT per next hop
+##
+## The inter-frame gap is raised to the average TX time to the next hop as measured by
+## `netstats_neighbor_tx_time` times @ref CONFIG_GNRC_SIXLOWPAN_SFR_PACING_TX_TIME_FACTOR. The
+## RFRAG-ACK timeout is derived from the round-trip time measured for the next hop.
+## @{
+PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_pacing
+## @}
 PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_stats
 ##
 ## @addtogroup net_gnrc_sixlowpan_frag_sfr_congure
@@ -252,7 +361,21 @@ PSEUDOMODULES += gnrc_sixlowpan_nd_border_router
 PSEUDOMODULES += gnrc_sixlowpan_router_default
 PSEUDOMODULES += gnrc_sock_async
 PSEUDOMODULES += gnrc_sock_check_reuse
+
+## @defgroup net_gnrc_sock_udp_reuse_port gnrc_sock_udp_reuse_port: Load-balanced UDP socks
+## @ingroup net_gnrc_sock
+## @{
+## UDP socks created with @ref SOCK_FLAGS_REUSE_PORT on the same end point
+## form a group. Each datagram received for that end point is only put into
+## the mailbox of one member, chosen by a hash of its source address and
+## port, so several threads can each serve their own sock. Connected socks
+## (see @ref SOCK_FLAGS_CONNECT_REMOTE) do not take part.
+## While the group changes, a datagram may reach no or two members.
+PSEUDOMODULES += gnrc_sock_udp_reuse_port
+## @}
+
 PSEUDOMODULES += gnrc_txtsnd
+PSEUDOMODULES += gnrc_udp_inline
 PSEUDOMODULES += ieee802154_security
 PSEUDOMODULES += ieee802154_submac
 PSEUDOMODULES += ipv4
@@ -281,6 +404,13 @@ PSEUDOMODULES += libc_gettimeofday
 PSEUDOMODULES += malloc_tracing
 ## @}
 
+## @defgroup pseudomodule_malloc_monitor_trace malloc_monitor_trace
+## @ingroup sys_malloc_monitor
+## @brief Record the last calls to malloc(), calloc(), realloc() and free()
+##
+## See @ref malloc_monitor_trace_dump().
+PSEUDOMODULES += malloc_monitor_trace
+
 ## @defgroup pseudomodule_mpu_stack_guard mpu_stack_guard
 ## @brief MPU based stack guard
 ##
@@ -297,6 +427,15 @@ PSEUDOMODULES += mpu_stack_guard
 PSEUDOMODULES += mpu_noexec_ram
 ## @}
 
+## @defgroup pseudomodule_mpu_thread_regions mpu_thread_regions
+## @{
+## @brief Per-thread MPU regions
+##
+## Reserve the last MPU regions for the running thread. They are swapped on
+## every context switch, see @ref mpu_thread_region_set().
+PSEUDOMODULES += mpu_thread_regions
+## @}
+
 ## @defgroup pseudomodule_pmp_noexec_ram pmp_noexec_ram
 ## @{
 ## @brief Mark RAM as non-executable using the PMP
@@ -306,11 +445,28 @@ PSEUDOMODULES += mpu_noexec_ram
 PSEUDOMODULES += pmp_noexec_ram
 ## @}
 
+PSEUDOMODULES += mtd_flashpage_deferred_erase
 PSEUDOMODULES += mtd_write_page
 PSEUDOMODULES += nanocoap_%
+
+## @defgroup pseudomodule_nanocoap_cache_siphash nanocoap_cache_siphash
+## @{
+## @brief Use a keyed SipHash instead of SHA-256 for nanocoap cache keys
+##
+## See @ref net_nanocoap_cache.
+PSEUDOMODULES += nanocoap_cache_siphash
+## @}
+
 PSEUDOMODULES += nanocoap_fileserver_callback
 PSEUDOMODULES += nanocoap_fileserver_delete
 PSEUDOMODULES += nanocoap_fileserver_put
+## @defgroup pseudomodule_nanocoap_fileserver_readahead nanocoap_fileserver_readahead
+## @{
+## @brief Read files served by the CoAP file server ahead, per client
+##
+## See @ref net_nanocoap_fileserver.
+PSEUDOMODULES += nanocoap_fileserver_readahead
+## @}
 PSEUDOMODULES += netdev_default
 PSEUDOMODULES += netdev_ieee802154_%
 PSEUDOMODULES += netdev_ieee802154_rx_timestamp
@@ -322,6 +478,7 @@ PSEUDOMODULES += netdev_new_api
 PSEUDOMODULES += netdev_register
 PSEUDOMODULES += netstats
 PSEUDOMODULES += netstats_l2
+PSEUDOMODULES += netstats_latency
 PSEUDOMODULES += netstats_neighbor_etx
 PSEUDOMODULES += netstats_neighbor_count
 PSEUDOMODULES += netstats_neighbor_rssi
@@ -348,6 +505,8 @@ PSEUDOMODULES += openthread
 PSEUDOMODULES += picolibc
 PSEUDOMODULES += picolibc_stdout_buffered
 PSEUDOMODULES += pktqueue
+PSEUDOMODULES += pm_layered_thread
+PSEUDOMODULES += pm_layered_tickless
 PSEUDOMODULES += posix_headers
 PSEUDOMODULES += printf_float
 PSEUDOMODULES += prng
@@ -380,7 +539,9 @@ PSEUDOMODULES += saul_nrf_vddh
 PSEUDOMODULES += saul_pwm
 PSEUDOMODULES += scanf_float
 PSEUDOMODULES += sched_cb
+PSEUDOMODULES += sched_edf
 PSEUDOMODULES += sched_runq_callback
+PSEUDOMODULES += schedstatistics_cycles
 ## @defgroup pseudomodule_sema_deprecated sema_deprecated
 ## @ingroup sys_sema
 ## @{
@@ -389,6 +550,7 @@ PSEUDOMODULES += sema_deprecated
 ## @}
 PSEUDOMODULES += semtech_loramac_rx
 PSEUDOMODULES += senml_cbor
+PSEUDOMODULES += senml_coap
 PSEUDOMODULES += senml_phydat
 PSEUDOMODULES += senml_saul
 ## @defgroup drivers_servo_pwm PWM based servo driver
@@ -435,7 +597,9 @@ PSEUDOMODULES += shell_cmd_gnrc_udp
 PSEUDOMODULES += shell_cmd_heap
 PSEUDOMODULES += shell_cmd_i2c_scan
 PSEUDOMODULES += shell_cmd_iw
+PSEUDOMODULES += shell_cmd_lockstats
 PSEUDOMODULES += shell_cmd_lwip_netif
+PSEUDOMODULES += shell_cmd_malloc_monitor
 PSEUDOMODULES += shell_cmd_mci
 PSEUDOMODULES += shell_cmd_md5sum
 PSEUDOMODULES += shell_cmd_nanocoap_vfs
@@ -443,9 +607,11 @@ PSEUDOMODULES += shell_cmd_netstats_neighbor
 PSEUDOMODULES += shell_cmd_nice
 PSEUDOMODULES += shell_cmd_nimble_netif
 PSEUDOMODULES += shell_cmd_nimble_statconn
+PSEUDOMODULES += shell_cmd_objcache
 PSEUDOMODULES += shell_cmd_opendsme
 PSEUDOMODULES += shell_cmd_openwsn
 PSEUDOMODULES += shell_cmd_pm
+PSEUDOMODULES += shell_cmd_profiler
 PSEUDOMODULES += shell_cmd_ps
 PSEUDOMODULES += shell_cmd_random
 PSEUDOMODULES += shell_cmd_rtc
@@ -460,6 +626,7 @@ PSEUDOMODULES += shell_cmd_suit
 PSEUDOMODULES += shell_cmd_sys
 PSEUDOMODULES += shell_cmd_udptty
 PSEUDOMODULES += shell_cmd_vfs
+PSEUDOMODULES += shell_cmd_ztimer
 PSEUDOMODULES += shell_cmds_default
 PSEUDOMODULES += shell_hooks
 PSEUDOMODULES += shell_lock_auto_locking
@@ -493,17 +660,34 @@ PSEUDOMODULES += stdio_telnet
 ## of UNIX style line endings (`\n`) via STDIO over UART.
 PSEUDOMODULES += stdio_uart_onlcr
 ## @}
+## @defgroup sys_stdio_uart_nonblocking   Buffered output for STDIO-UART
+## @ingroup sys_stdio_uart
+## @{
+## Enable this (pseudo-) module to queue output in the TX ring buffer of the
+## UART driver instead of waiting for it to be sent.
+PSEUDOMODULES += stdio_uart_nonblocking
+## @}
 PSEUDOMODULES += stdio_uart_rx
 PSEUDOMODULES += stm32_eth
 PSEUDOMODULES += stm32_eth_auto
 PSEUDOMODULES += stm32_eth_link_up
 PSEUDOMODULES += stm32_eth_tracing
 PSEUDOMODULES += stm32mp1_eng_mode
+PSEUDOMODULES += suit_payload_heatshrink
+PSEUDOMODULES += suit_payload_vcdiff
 PSEUDOMODULES += suit_transport_%
 PSEUDOMODULES += suit_storage_%
 PSEUDOMODULES += sys_bus_%
 PSEUDOMODULES += tiny_strerror_as_strerror
 PSEUDOMODULES += tiny_strerror_minimal
+
+## @defgroup pseudomodule_trace_events trace_events
+## @ingroup sys_trace
+## @brief Record scheduler, msg, mutex, netif and pktbuf events in the trace buffer
+##
+## See @ref trace_event() and @ref trace_dump_bin().
+PSEUDOMODULES += trace_events
+
 PSEUDOMODULES += usbus_urb
 PSEUDOMODULES += vdd_lc_filter_%
 ## @defgroup pseudomodule_vfs_auto_format vfs_auto_format
@@ -549,6 +733,12 @@ PSEUDOMODULES += ztimer
 PSEUDOMODULES += ztimer_%
 PSEUDOMODULES += ztimer64_%
 
+## @defgroup pseudomodule_ztimer_auto ztimer_auto
+## @brief Microsecond timeouts that wait on low power clocks
+##
+## See @ref sys_ztimer_auto.
+PSEUDOMODULES += ztimer_auto
+
 ## @defgroup pseudomodule_ztimer_auto_adjust ztimer_auto_adjust
 ## @brief A module to set on init ztimer->adjust_sleep/adjust_set values
 ##
@@ -563,6 +753,53 @@ PSEUDOMODULES += ztimer64_%
 ## configuration header board.h. These can be found out by running tests/sys/ztimer_overhead
 PSEUDOMODULES += ztimer_auto_adjust
 
+## @defgroup pseudomodule_ztimer_auto_adjust_rtc_mem ztimer_auto_adjust_rtc_mem
+## @brief Keep the values measured by ztimer_auto_adjust in RTC memory
+##
+## The adjust_set/adjust_sleep values measured on the first boot are stored
+## at CONFIG_ZTIMER_AUTO_ADJUST_RTC_MEM_OFFSET in the memory of the RTC and
+## reused on later boots, skipping the measurement and the settle time. Clear
+## the record to measure again, e.g. after changing the hardware.
+PSEUDOMODULES += ztimer_auto_adjust_rtc_mem
+
+## @defgroup pseudomodule_ztimer_heap ztimer_heap
+## @brief Store the timers of ztimer clocks in a pairing heap
+##
+## Replaces the sorted list of each clock by a pairing heap, making
+## ztimer_set() O(1) and ztimer_remove() O(log n) amortized at the cost of
+## two more pointers per ztimer_t. Useful for applications with many
+## concurrently active timers.
+PSEUDOMODULES += ztimer_heap
+
+## @defgroup pseudomodule_ztimer_now64 ztimer_now64
+## @brief Track the time of ztimer clocks with 64 bit
+##
+## Adds ztimer_now64(), extending the time of every clock once in the same
+## place that extends narrower hardware timers. ztimer64 clocks then read the
+## time from their base clock instead of checkpointing it themselves.
+PSEUDOMODULES += ztimer_now64
+
+## @defgroup pseudomodule_ztimer_periodic_jitter ztimer_periodic_jitter
+## @brief Keep a histogram of the trigger latency of periodic ztimers
+##
+## See ztimer_periodic_jitter_t. Costs one more ztimer_now() per trigger.
+PSEUDOMODULES += ztimer_periodic_jitter
+
+## @defgroup pseudomodule_ztimer_slack ztimer_slack
+## @brief Coalesce timers set with ztimer_set_slack()
+##
+## Arms the clock as late as the slack of all timers due next allows, so
+## that they are handled in a single interrupt. Has no effect together with
+## `ztimer_heap`.
+PSEUDOMODULES += ztimer_slack
+
+## @defgroup pseudomodule_ztimer_stats ztimer_stats
+## @brief Count the interrupts of ztimer clocks and measure their duration
+##
+## See ztimer_stats_get(). With the shell, this adds the `ztimer` command that
+## prints the statistics of ZTIMER_USEC, ZTIMER_MSEC and ZTIMER_SEC.
+PSEUDOMODULES += ztimer_stats
+
 # core_lib is not a submodule
 NO_PSEUDOMODULES += core_lib
 
@@ -593,6 +830,8 @@ PSEUDOMODULES += skald_eddystone
 PSEUDOMODULES += crypto_aes_128
 PSEUDOMODULES += crypto_aes_192
 PSEUDOMODULES += crypto_aes_256
+# Constant-time bitsliced AES instead of the T tables
+PSEUDOMODULES += crypto_aes_ct
 # By using this pseudomodule, T tables will be precalculated.
 PSEUDOMODULES += crypto_aes_precalculated
 # This pseudomodule causes a loop in AES to be unrolled (more flash, less CPU)
@@ -76,11 +76,17 @@ ifneq (,$(filter stdin,$(USEMODULE)))
 endif
 
 ifneq (,$(filter stdio_uart_rx,$(USEMODULE)))
+  FEATURES_OPTIONAL += periph_uart_rx_bulk
   USEMODULE += isrpipe
   USEMODULE += stdio_uart
   USEMODULE += stdio_available
 endif
 
+ifneq (,$(filter stdio_uart_nonblocking,$(USEMODULE)))
+  USEMODULE += stdio_uart
+  FEATURES_REQUIRED += periph_uart_nonblocking
+endif
+
 ifneq (,$(filter stdio_uart,$(USEMODULE)))
   FEATURES_REQUIRED_ANY += periph_uart|periph_lpuart
 endif
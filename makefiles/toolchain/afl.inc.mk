@@ -1,6 +1,10 @@
 include $(RIOTMAKE)/toolchain/gnu.inc.mk
 
-CC     = $(PREFIX)afl-gcc
-CXX    = $(PREFIX)afl-g++
-LINK   = $(PREFIX)afl-gcc
-LINKXX = $(PREFIX)afl-g++
+# AFL++'s afl-gcc-fast or afl-clang-fast are needed for persistent mode
+AFL_CC  ?= afl-gcc
+AFL_CXX ?= afl-g++
+
+CC     = $(PREFIX)$(AFL_CC)
+CXX    = $(PREFIX)$(AFL_CXX)
+LINK   = $(PREFIX)$(AFL_CC)
+LINKXX = $(PREFIX)$(AFL_CXX)
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup pkg_etl_riot
+ * @{
+ *
+ * @file
+ * @brief   Events calling an `etl::delegate`
+ *
+ * Requires module `event`.
+ *
+ * @author  RIOT developers <devel@riot-os.org>
+ */
+
+#ifndef RIOT_ETL_EVENT_HPP
+#define RIOT_ETL_EVENT_HPP
+
+#include "etl/delegate.h"
+#include "event.h"
+
+namespace riot {
+namespace etl {
+
+/**
+ * @brief An `event_t` that calls a delegate when handled
+ *
+ * The event can be posted to any event queue, C code sees a plain `event_t`.
+ *
+ * @code{.cpp}
+ * class sensor {
+ * public:
+ *   void read();
+ *   riot::etl::event read_event{
+ *     riot::etl::event::callback_type::create<sensor, &sensor::read>(*this)};
+ * };
+ * @endcode
+ */
+class event : public event_t {
+public:
+  /**
+   * @brief The callback type.
+   */
+  using callback_type = ::etl::delegate<void()>;
+
+  /**
+   * @brief Create an event calling @p cb.
+   */
+  explicit event(callback_type cb) noexcept : event_t{}, m_callback{cb} {
+    handler = _handler;
+  }
+  event(const event&) = delete;
+  event& operator=(const event&) = delete;
+
+  /**
+   * @brief Post the event to @p queue, see event_post().
+   */
+  void post(event_queue_t* queue) noexcept { event_post(queue, this); }
+  /**
+   * @brief Remove the event from @p queue, see event_cancel().
+   */
+  void cancel(event_queue_t* queue) noexcept { event_cancel(queue, this); }
+  /**
+   * @brief Replace the callback.
+   * @pre The event is not queued.
+   */
+  void set_callback(callback_type cb) noexcept { m_callback = cb; }
+
+private:
+  static void _handler(event_t* ev) {
+    static_cast<event*>(ev)->_call();
+  }
+
+  void _call() {
+    if (m_callback.is_valid()) {
+      m_callback();
+    }
+  }
+
+  callback_type m_callback;
+};
+
+} // namespace etl
+} // namespace riot
+
+#endif // RIOT_ETL_EVENT_HPP
+/** @} */
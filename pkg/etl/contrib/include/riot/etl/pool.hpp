@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup pkg_etl_riot
+ * @{
+ *
+ * @file
+ * @brief   Typed object pool with the interface of `etl::pool` on top of
+ *          @ref sys_memarray
+ *
+ * @author  RIOT developers <devel@riot-os.org>
+ */
+
+#ifndef RIOT_ETL_POOL_HPP
+#define RIOT_ETL_POOL_HPP
+
+#include <cstddef>
+#include <new>
+#include <utility>
+
+#include "irq.h"
+#include "memarray.h"
+
+namespace riot {
+namespace etl {
+
+/**
+ * @brief Pool of @p N objects of type @p T
+ *
+ * Offers the member functions of `etl::pool` that are typically used, but the
+ * free list is a `memarray_t`, so the same pool can be handed to C code via
+ * native_handle(). Allocation and release disable interrupts for the few
+ * instructions needed to update the free list, so both may be used from
+ * interrupt context, e.g. for `event_t` or `ztimer_t` objects.
+ *
+ * @tparam T    Type of the pooled objects
+ * @tparam N    Number of objects in the pool
+ */
+template <typename T, std::size_t N>
+class pool {
+  static constexpr std::size_t align
+    = alignof(T) > alignof(void*) ? alignof(T) : alignof(void*);
+  static constexpr std::size_t raw_size
+    = sizeof(T) > sizeof(void*) ? sizeof(T) : sizeof(void*);
+  static_assert(N > 0, "pool must not be empty");
+
+public:
+  /**
+   * @brief Size of an element in the pool, including padding
+   */
+  static constexpr std::size_t element_size
+    = (raw_size + align - 1) / align * align;
+
+  pool() noexcept { memarray_init(&m_mem, m_storage, element_size, N); }
+  pool(const pool&) = delete;
+  pool& operator=(const pool&) = delete;
+
+  /**
+   * @brief Get uninitialized storage for a @p T.
+   * @return The storage or `nullptr` if the pool is exhausted.
+   */
+  T* allocate() noexcept {
+    unsigned state = irq_disable();
+    void* ptr = memarray_alloc(&m_mem);
+    if (ptr) {
+      m_size++;
+    }
+    irq_restore(state);
+    return static_cast<T*>(ptr);
+  }
+  /**
+   * @brief Return storage obtained by allocate() to the pool.
+   */
+  void release(const T* ptr) noexcept {
+    unsigned state = irq_disable();
+    memarray_free(&m_mem, const_cast<T*>(ptr));
+    m_size--;
+    irq_restore(state);
+  }
+  /**
+   * @brief Allocate and construct a @p T from @p args.
+   * @return The object or `nullptr` if the pool is exhausted.
+   */
+  template <typename... Args>
+  T* create(Args&&... args) {
+    T* ptr = allocate();
+    if (ptr) {
+      ::new (ptr) T(std::forward<Args>(args)...);
+    }
+    return ptr;
+  }
+  /**
+   * @brief Destruct an object obtained by create() and release it.
+   */
+  void destroy(const T* ptr) noexcept {
+    ptr->~T();
+    release(ptr);
+  }
+
+  /**
+   * @brief Number of objects that can still be allocated.
+   */
+  std::size_t available() const noexcept { return N - m_size; }
+  /**
+   * @brief Number of allocated objects.
+   */
+  std::size_t size() const noexcept { return m_size; }
+  /**
+   * @brief Total number of objects in the pool.
+   */
+  static constexpr std::size_t max_size() noexcept { return N; }
+  /**
+   * @brief Check if no object is allocated.
+   */
+  bool empty() const noexcept { return m_size == 0; }
+  /**
+   * @brief Check if all objects are allocated.
+   */
+  bool full() const noexcept { return m_size == N; }
+
+  /**
+   * @brief Provides access to the underlying memarray.
+   *
+   * Use the pool only via the handle or only via the member functions,
+   * otherwise size() and available() are wrong.
+   */
+  memarray_t* native_handle() noexcept { return &m_mem; }
+
+private:
+  alignas(align) unsigned char m_storage[N * element_size];
+  memarray_t m_mem;
+  std::size_t m_size = 0;
+};
+
+} // namespace etl
+} // namespace riot
+
+#endif // RIOT_ETL_POOL_HPP
+/** @} */
@@ -0,0 +1,194 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup pkg_etl_riot
+ * @{
+ *
+ * @file
+ * @brief   Blocking fixed-capacity queue backed by `etl::queue`
+ *
+ * @author  RIOT developers <devel@riot-os.org>
+ */
+
+#ifndef RIOT_ETL_QUEUE_HPP
+#define RIOT_ETL_QUEUE_HPP
+
+#include <cstddef>
+#include <utility>
+
+#include "etl/queue.h"
+#include "irq.h"
+#include "mutex.h"
+#include "thread.h"
+#include "thread_flags.h"
+
+/**
+ * @brief   Thread flag used to wake up threads blocked on a riot::etl::queue
+ */
+#ifndef CONFIG_ETL_RIOT_THREAD_FLAG
+#define CONFIG_ETL_RIOT_THREAD_FLAG (1u << 13)
+#endif
+
+namespace riot {
+namespace etl {
+
+/**
+ * @brief Fixed-capacity FIFO of @p T for passing data between threads and
+ *        from interrupts to threads
+ *
+ * Elements are stored in an `etl::queue<T, N>` that is accessed with
+ * interrupts disabled, so @p T should be cheap to copy or move. The try_*()
+ * functions never block and can be used from interrupt context.
+ *
+ * Any number of threads may block in push() or pop(). They are serialized by
+ * a mutex per direction, so that only one of them waits for a change of the
+ * queue using @ref CONFIG_ETL_RIOT_THREAD_FLAG at a time.
+ *
+ * @tparam T    Element type
+ * @tparam N    Capacity of the queue
+ */
+template <typename T, std::size_t N>
+class queue {
+public:
+  queue() noexcept = default;
+  queue(const queue&) = delete;
+  queue& operator=(const queue&) = delete;
+
+  /**
+   * @brief Construct an element in place if the queue is not full.
+   * @return `true` on success, `false` if the queue is full.
+   */
+  template <typename... Args>
+  bool try_emplace(Args&&... args) {
+    unsigned state = irq_disable();
+    if (m_queue.full()) {
+      irq_restore(state);
+      return false;
+    }
+    _emplace(state, std::forward<Args>(args)...);
+    return true;
+  }
+  /**
+   * @brief Append @p value if the queue is not full.
+   * @return `true` on success, `false` if the queue is full.
+   */
+  bool try_push(const T& value) { return try_emplace(value); }
+  /**
+   * @copydoc try_push(const T&)
+   */
+  bool try_push(T&& value) { return try_emplace(std::move(value)); }
+
+  /**
+   * @brief Append @p value, blocking while the queue is full.
+   * @pre Must be called from thread context.
+   */
+  void push(const T& value) { emplace(value); }
+  /**
+   * @copydoc push(const T&)
+   */
+  void push(T&& value) { emplace(std::move(value)); }
+  /**
+   * @brief Construct an element in place, blocking while the queue is full.
+   * @pre Must be called from thread context.
+   */
+  template <typename... Args>
+  void emplace(Args&&... args) {
+    mutex_lock(&m_producers);
+    unsigned state = irq_disable();
+    while (m_queue.full()) {
+      m_producer = thread_get_active();
+      irq_restore(state);
+      thread_flags_wait_any(CONFIG_ETL_RIOT_THREAD_FLAG);
+      state = irq_disable();
+    }
+    _emplace(state, std::forward<Args>(args)...);
+    mutex_unlock(&m_producers);
+  }
+
+  /**
+   * @brief Remove the oldest element if there is one.
+   * @param[out] value  Destination of the removed element.
+   * @return `true` on success, `false` if the queue is empty.
+   */
+  bool try_pop(T& value) {
+    unsigned state = irq_disable();
+    if (m_queue.empty()) {
+      irq_restore(state);
+      return false;
+    }
+    value = _pop(state);
+    return true;
+  }
+  /**
+   * @brief Remove the oldest element, blocking while the queue is empty.
+   * @pre Must be called from thread context.
+   */
+  T pop() {
+    mutex_lock(&m_consumers);
+    unsigned state = irq_disable();
+    while (m_queue.empty()) {
+      m_consumer = thread_get_active();
+      irq_restore(state);
+      thread_flags_wait_any(CONFIG_ETL_RIOT_THREAD_FLAG);
+      state = irq_disable();
+    }
+    T value = _pop(state);
+    mutex_unlock(&m_consumers);
+    return value;
+  }
+
+  /**
+   * @brief Number of queued elements.
+   */
+  std::size_t size() const noexcept { return m_queue.size(); }
+  /**
+   * @brief Capacity of the queue.
+   */
+  static constexpr std::size_t capacity() noexcept { return N; }
+  /**
+   * @brief Check if the queue is empty.
+   */
+  bool empty() const noexcept { return m_queue.empty(); }
+  /**
+   * @brief Check if the queue is full.
+   */
+  bool full() const noexcept { return m_queue.full(); }
+
+private:
+  /* the following expect interrupts disabled and restore @p state */
+  template <typename... Args>
+  void _emplace(unsigned state, Args&&... args) {
+    m_queue.emplace(std::forward<Args>(args)...);
+    _wake(std::exchange(m_consumer, nullptr), state);
+  }
+  T _pop(unsigned state) {
+    T value{std::move(m_queue.front())};
+    m_queue.pop();
+    _wake(std::exchange(m_producer, nullptr), state);
+    return value;
+  }
+  static void _wake(thread_t* waiter, unsigned state) {
+    irq_restore(state);
+    if (waiter) {
+      thread_flags_set(waiter, CONFIG_ETL_RIOT_THREAD_FLAG);
+    }
+  }
+
+  ::etl::queue<T, N> m_queue;
+  mutex_t m_producers = MUTEX_INIT;
+  mutex_t m_consumers = MUTEX_INIT;
+  thread_t* m_producer = nullptr;
+  thread_t* m_consumer = nullptr;
+};
+
+} // namespace etl
+} // namespace riot
+
+#endif // RIOT_ETL_QUEUE_HPP
+/** @} */
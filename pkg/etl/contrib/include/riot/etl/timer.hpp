@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup pkg_etl_riot
+ * @{
+ *
+ * @file
+ * @brief   Timers calling an `etl::delegate`
+ *
+ * Requires module `ztimer`.
+ *
+ * @author  RIOT developers <devel@riot-os.org>
+ */
+
+#ifndef RIOT_ETL_TIMER_HPP
+#define RIOT_ETL_TIMER_HPP
+
+#include <cstdint>
+
+#include "etl/delegate.h"
+#include "ztimer.h"
+
+namespace riot {
+namespace etl {
+
+/**
+ * @brief A `ztimer_t` that calls a delegate from interrupt context when it
+ *        expires
+ */
+class timer : public ztimer_t {
+public:
+  /**
+   * @brief The callback type.
+   */
+  using callback_type = ::etl::delegate<void()>;
+
+  /**
+   * @brief Create a timer calling @p cb.
+   */
+  explicit timer(callback_type cb) noexcept : ztimer_t{}, m_callback{cb} {
+    callback = _callback;
+    arg = this;
+  }
+  timer(const timer&) = delete;
+  timer& operator=(const timer&) = delete;
+
+  /**
+   * @brief Set the timer to expire @p val ticks of @p clock from now, see
+   *        ztimer_set().
+   */
+  void set(ztimer_clock_t* clock, uint32_t val) noexcept {
+    ztimer_set(clock, this, val);
+  }
+  /**
+   * @brief Stop the timer, see ztimer_remove().
+   * @return `true` if the timer was still running.
+   */
+  bool remove(ztimer_clock_t* clock) noexcept {
+    return ztimer_remove(clock, this);
+  }
+  /**
+   * @brief Replace the callback.
+   * @pre The timer is not running.
+   */
+  void set_callback(callback_type cb) noexcept { m_callback = cb; }
+
+private:
+  static void _callback(void* arg) {
+    static_cast<timer*>(arg)->_call();
+  }
+
+  void _call() {
+    if (m_callback.is_valid()) {
+      m_callback();
+    }
+  }
+
+  callback_type m_callback;
+};
+
+} // namespace etl
+} // namespace riot
+
+#endif // RIOT_ETL_TIMER_HPP
+/** @} */
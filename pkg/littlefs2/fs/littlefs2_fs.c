@@ -25,6 +25,7 @@
 #include <string.h>
 
 #include "fs/littlefs2_fs.h"
+#include "macros/utils.h"
 
 #define ENABLE_DEBUG 0
 #include <debug.h>
@@ -347,36 +348,71 @@ static int _close(vfs_file_t *filp)
     return littlefs_err_to_errno(ret);
 }
 
+static size_t _chunk_size(const littlefs2_desc_t *fs)
+{
+    return CONFIG_LITTLEFS2_IO_CHUNK_SIZE ? CONFIG_LITTLEFS2_IO_CHUNK_SIZE
+                                          : fs->config.block_size;
+}
+
 static ssize_t _write(vfs_file_t *filp, const void *src, size_t nbytes)
 {
     littlefs2_desc_t *fs = filp->mp->private_data;
     lfs_file_t *fp = _get_lfs_file(filp);
-
-    mutex_lock(&fs->lock);
+    const uint8_t *pos = src;
+    size_t done = 0;
 
     DEBUG("littlefs: write: filp=%p, fp=%p, src=%p, nbytes=%" PRIuSIZE "\n",
           (void *)filp, (void *)fp, (void *)src, nbytes);
 
-    ssize_t ret = lfs_file_write(&fs->fs, fp, src, nbytes);
-    mutex_unlock(&fs->lock);
-
-    return littlefs_err_to_errno(ret);
+    /* the lock is released between chunks, so a long write does not block
+     * the other users of the file system until it is done */
+    do {
+        size_t chunk = MIN(nbytes - done, _chunk_size(fs));
+
+        mutex_lock(&fs->lock);
+        ssize_t ret = lfs_file_write(&fs->fs, fp, &pos[done], chunk);
+        mutex_unlock(&fs->lock);
+
+        if (ret < 0) {
+            return done ? (ssize_t)done : littlefs_err_to_errno(ret);
+        }
+        done += ret;
+        if ((size_t)ret < chunk) {
+            break;
+        }
+    } while (done < nbytes);
+
+    return done;
 }
 
 static ssize_t _read(vfs_file_t *filp, void *dest, size_t nbytes)
 {
     littlefs2_desc_t *fs = filp->mp->private_data;
     lfs_file_t *fp = _get_lfs_file(filp);
-
-    mutex_lock(&fs->lock);
+    uint8_t *pos = dest;
+    size_t done = 0;
 
     DEBUG("littlefs: read: filp=%p, fp=%p, dest=%p, nbytes=%" PRIuSIZE "\n",
           (void *)filp, (void *)fp, (void *)dest, nbytes);
 
-    ssize_t ret = lfs_file_read(&fs->fs, fp, dest, nbytes);
-    mutex_unlock(&fs->lock);
+    do {
+        size_t chunk = MIN(nbytes - done, _chunk_size(fs));
 
-    return littlefs_err_to_errno(ret);
+        mutex_lock(&fs->lock);
+        ssize_t ret = lfs_file_read(&fs->fs, fp, &pos[done], chunk);
+        mutex_unlock(&fs->lock);
+
+        if (ret < 0) {
+            return done ? (ssize_t)done : littlefs_err_to_errno(ret);
+        }
+        done += ret;
+        if ((size_t)ret < chunk) {
+            /* end of file */
+            break;
+        }
+    } while (done < nbytes);
+
+    return done;
 }
 
 static off_t _lseek(vfs_file_t *filp, off_t off, int whence)
@@ -411,6 +447,20 @@ static int _fsync(vfs_file_t *filp)
     return littlefs_err_to_errno(ret);
 }
 
+static void _info_to_stat(const struct lfs_info *info, struct stat *buf)
+{
+    /* info.name */
+    buf->st_size = info->size;
+    switch (info->type) {
+    case LFS_TYPE_REG:
+        buf->st_mode = S_IFREG;
+        break;
+    case LFS_TYPE_DIR:
+        buf->st_mode = S_IFDIR;
+        break;
+    }
+}
+
 static int _stat(vfs_mount_t *mountp, const char *restrict path, struct stat *restrict buf)
 {
     littlefs2_desc_t *fs = mountp->private_data;
@@ -423,16 +473,7 @@ static int _stat(vfs_mount_t *mountp, const char *restrict path, struct stat *re
     struct lfs_info info;
     int ret = lfs_stat(&fs->fs, path, &info);
     mutex_unlock(&fs->lock);
-    /* info.name */
-    buf->st_size = info.size;
-    switch (info.type) {
-    case LFS_TYPE_REG:
-        buf->st_mode = S_IFREG;
-        break;
-    case LFS_TYPE_DIR:
-        buf->st_mode = S_IFDIR;
-        break;
-    }
+    _info_to_stat(&info, buf);
 
     return littlefs_err_to_errno(ret);
 }
@@ -497,7 +538,7 @@ static int _opendir(vfs_DIR *dirp, const char *dirname)
     return littlefs_err_to_errno(ret);
 }
 
-static int _readdir(vfs_DIR *dirp, vfs_dirent_t *entry)
+static int _readdir_info(vfs_DIR *dirp, vfs_dirent_t *entry, struct lfs_info *info)
 {
     littlefs2_desc_t *fs = dirp->mp->private_data;
     lfs_dir_t *dir = _get_lfs_dir(dirp);
@@ -507,11 +548,10 @@ static int _readdir(vfs_DIR *dirp, vfs_dirent_t *entry)
     DEBUG("littlefs: readdir: dirp=%p, entry=%p\n",
           (void *)dirp, (void *)entry);
 
-    struct lfs_info info;
-    int ret = lfs_dir_read(&fs->fs, dir, &info);
+    int ret = lfs_dir_read(&fs->fs, dir, info);
     if (ret >= 0) {
-        entry->d_ino = info.type;
-        strncpy(entry->d_name, info.name, VFS_NAME_MAX - 1);
+        entry->d_ino = info->type;
+        strncpy(entry->d_name, info->name, VFS_NAME_MAX - 1);
     }
 
     mutex_unlock(&fs->lock);
@@ -519,6 +559,22 @@ static int _readdir(vfs_DIR *dirp, vfs_dirent_t *entry)
     return littlefs_err_to_errno(ret);
 }
 
+static int _readdir(vfs_DIR *dirp, vfs_dirent_t *entry)
+{
+    struct lfs_info info;
+    return _readdir_info(dirp, entry, &info);
+}
+
+static int _readdir_stat(vfs_DIR *dirp, vfs_dirent_t *entry, struct stat *buf)
+{
+    struct lfs_info info;
+    int ret = _readdir_info(dirp, entry, &info);
+    if (ret > 0) {
+        _info_to_stat(&info, buf);
+    }
+    return ret;
+}
+
 static int _closedir(vfs_DIR *dirp)
 {
     littlefs2_desc_t *fs = dirp->mp->private_data;
@@ -558,6 +614,7 @@ static const vfs_file_ops_t littlefs_file_ops = {
 static const vfs_dir_ops_t littlefs_dir_ops = {
     .opendir = _opendir,
     .readdir = _readdir,
+    .readdir_stat = _readdir_stat,
     .closedir = _closedir,
 };
 
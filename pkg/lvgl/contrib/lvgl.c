@@ -20,6 +20,7 @@
 #include <assert.h>
 
 #include "kernel_defines.h"
+#include "mutex.h"
 #include "thread.h"
 
 #include "timex.h"
@@ -54,6 +55,14 @@
 #define LVGL_THREAD_FLAG                    (1 << 7)
 #endif
 
+#ifndef LVGL_FLUSH_THREAD_PRIO
+#define LVGL_FLUSH_THREAD_PRIO              (THREAD_PRIORITY_MAIN - 2)
+#endif
+
+#ifndef LVGL_FLUSH_THREAD_STACKSIZE
+#define LVGL_FLUSH_THREAD_STACKSIZE         (THREAD_STACKSIZE_DEFAULT)
+#endif
+
 #if IS_USED(MODULE_LV_DRIVERS_SDL)
 
 #ifndef LCD_SCREEN_WIDTH
@@ -70,6 +79,10 @@ static kernel_pid_t _task_thread_pid;
 
 static lv_disp_draw_buf_t disp_buf;
 static lv_color_t draw_buf[LVGL_COLOR_BUF_SIZE];
+#if IS_USED(MODULE_LVGL_CONTRIB_ASYNC_FLUSH)
+/* LVGL renders into one buffer while the other one is flushed */
+static lv_color_t draw_buf2[LVGL_COLOR_BUF_SIZE];
+#endif
 
 static lv_disp_drv_t disp_drv;
 #if IS_USED(MODULE_TOUCH_DEV)
@@ -78,16 +91,10 @@ static lv_indev_drv_t indev_drv;
 
 #if !IS_USED(MODULE_LV_DRIVERS_SDL)
 static screen_dev_t *_screen_dev = NULL;
-static void _disp_map(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p)
-{
-    if (!_screen_dev->display) {
-        return;
-    }
-
-    if (!area) {
-        return;
-    }
 
+static void _flush(lv_disp_drv_t *drv, const lv_area_t *area,
+                   const lv_color_t *color_p)
+{
     const disp_dev_area_t disp_area = {
         area->x1, area->x2, area->y1, area->y2
     };
@@ -98,6 +105,51 @@ static void _disp_map(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *col
 
     lv_disp_flush_ready(drv);
 }
+
+#if IS_USED(MODULE_LVGL_CONTRIB_ASYNC_FLUSH)
+static char _flush_stack[LVGL_FLUSH_THREAD_STACKSIZE];
+static mutex_t _flush_pending = MUTEX_INIT_LOCKED;
+
+/* LVGL waits for lv_disp_flush_ready() before handing over the next area,
+ * so a single slot is enough */
+static struct {
+    lv_disp_drv_t *drv;
+    lv_area_t area;
+    const lv_color_t *color_p;
+} _flush_job;
+
+static void *_flush_thread(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        mutex_lock(&_flush_pending);
+        _flush(_flush_job.drv, &_flush_job.area, _flush_job.color_p);
+    }
+
+    return NULL;
+}
+#endif
+
+static void _disp_map(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p)
+{
+    if (!_screen_dev->display) {
+        return;
+    }
+
+    if (!area) {
+        return;
+    }
+
+#if IS_USED(MODULE_LVGL_CONTRIB_ASYNC_FLUSH)
+    _flush_job.drv = drv;
+    _flush_job.area = *area;
+    _flush_job.color_p = color_p;
+    mutex_unlock(&_flush_pending);
+#else
+    _flush(drv, area, color_p);
+#endif
+}
 #endif
 
 #if IS_USED(MODULE_TOUCH_DEV) && !IS_USED(MODULE_LV_DRIVERS_SDL)
@@ -145,7 +197,11 @@ void lvgl_init(screen_dev_t *screen_dev)
     (void)screen_dev;
 #endif
 
+#if IS_USED(MODULE_LVGL_CONTRIB_ASYNC_FLUSH)
+    lv_disp_draw_buf_init(&disp_buf, draw_buf, draw_buf2, LVGL_COLOR_BUF_SIZE);
+#else
     lv_disp_draw_buf_init(&disp_buf, draw_buf, NULL, LVGL_COLOR_BUF_SIZE);
+#endif
 
     lv_disp_drv_init(&disp_drv);
     disp_drv.draw_buf = &disp_buf;
@@ -157,6 +213,10 @@ void lvgl_init(screen_dev_t *screen_dev)
     disp_drv.hor_res = LCD_SCREEN_WIDTH;
     disp_drv.ver_res = LCD_SCREEN_HEIGHT;
 #else
+#if IS_USED(MODULE_LVGL_CONTRIB_ASYNC_FLUSH)
+    thread_create(_flush_stack, sizeof(_flush_stack), LVGL_FLUSH_THREAD_PRIO,
+                  THREAD_CREATE_STACKTEST, _flush_thread, NULL, "lvgl_flush");
+#endif
     disp_drv.flush_cb = _disp_map;
     /* Configure horizontal and vertical resolutions based on the
        underlying display device parameters */
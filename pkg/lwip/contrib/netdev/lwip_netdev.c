@@ -39,12 +39,23 @@
 #include "thread_flags.h"
 #include "utlist.h"
 
+#if IS_USED(MODULE_LWIP_CORE_LOCKING_INPUT) && IS_USED(MODULE_NETDEV_NEW_API)
+/* a reply sent while processing a received packet would wait for the TX
+ * completion event, which is only ever handled by this very thread */
+#error "lwip_core_locking_input does not work with drivers using netdev_new_api"
+#endif
+
 #define ENABLE_DEBUG                0
 #include "debug.h"
 
 #define LWIP_NETDEV_NAME            "lwip_netdev_mux"
 #define LWIP_NETDEV_PRIO            (THREAD_PRIORITY_MAIN - 4)
+#if IS_USED(MODULE_LWIP_CORE_LOCKING_INPUT)
+/* received packets are processed by the whole stack in this thread */
+#define LWIP_NETDEV_STACKSIZE       (TCPIP_THREAD_STACKSIZE)
+#else
 #define LWIP_NETDEV_STACKSIZE       (THREAD_STACKSIZE_DEFAULT)
+#endif
 #define LWIP_NETDEV_MSG_TYPE_EVENT  0x1235
 
 #define ETHERNET_IFNAME1 'E'
@@ -408,22 +419,44 @@ static struct pbuf *_get_recv_pkt(netdev_t *dev)
 {
     lwip_netif_t *compat_netif = dev->context;
     struct netif *netif = &compat_netif->lwip_netif;
+    struct pbuf *p = NULL;
+
     lwip_netif_dev_acquire(netif);
-    int len = dev->driver->recv(dev, _tmp_buf, sizeof(_tmp_buf), NULL);
+    int len = dev->driver->recv(dev, NULL, 0, NULL);
+
+    if (len > 0) {
+        assert(((unsigned)len) <= UINT16_MAX);
+        p = pbuf_alloc(PBUF_RAW, (u16_t)len, PBUF_POOL);
+        if (p == NULL) {
+            DEBUG("lwip_netdev: can not allocate in pbuf\n");
+            /* drop the frame */
+            dev->driver->recv(dev, NULL, len, NULL);
+        }
+        else if (p->next == NULL) {
+            /* frame fits into a single pool buffer, so the driver can write
+             * into it directly */
+            len = dev->driver->recv(dev, p->payload, p->len, NULL);
+        }
+        else {
+            len = dev->driver->recv(dev, _tmp_buf, sizeof(_tmp_buf), NULL);
+            if (len >= 0) {
+                pbuf_take(p, _tmp_buf, len);
+            }
+        }
+    }
     lwip_netif_dev_release(netif);
 
-    if (len < 0) {
+    if ((len <= 0) || (p == NULL)) {
         DEBUG("lwip_netdev: an error occurred while reading the packet\n");
+        if (p != NULL) {
+            pbuf_free(p);
+        }
         return NULL;
     }
-    assert(((unsigned)len) <= UINT16_MAX);
-    struct pbuf *p = pbuf_alloc(PBUF_RAW, (u16_t)len, PBUF_POOL);
-
-    if (p == NULL) {
-        DEBUG("lwip_netdev: can not allocate in pbuf\n");
-        return NULL;
+    if (len < p->tot_len) {
+        /* size reported by the driver was only an upper bound */
+        pbuf_realloc(p, (u16_t)len);
     }
-    pbuf_take(p, _tmp_buf, len);
     return p;
 }
 
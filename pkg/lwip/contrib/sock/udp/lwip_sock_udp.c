@@ -174,6 +174,17 @@ ssize_t sock_udp_recv_buf_aux(sock_udp_t *sock, void **data, void **ctx,
     return (ssize_t)buf->ptr->len;
 }
 
+void sock_udp_buf_release(sock_udp_t *sock, void *buf_ctx)
+{
+    (void)sock;
+    assert(sock != NULL);
+    if (buf_ctx != NULL) {
+        /* drops the reference to the pbuf chain the payload was handed out
+         * from */
+        netbuf_delete(buf_ctx);
+    }
+}
+
 ssize_t sock_udp_sendv_aux(sock_udp_t *sock, const iolist_t *snips,
                            const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
 {
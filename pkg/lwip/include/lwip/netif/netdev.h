@@ -33,6 +33,13 @@ extern "C" {
 
 /**
  * @brief   Length of the temporary copying buffer for receival.
+ *
+ * Received frames that fit into a single buffer of lwIP's `PBUF_POOL` are
+ * written directly into that buffer by the device driver. Only larger frames
+ * are received into this buffer and copied into a chain of pool buffers.
+ * Set `PBUF_POOL_BUFSIZE` to at least the maximum frame length of your
+ * devices to avoid that copy.
+ *
  * @note    It should be as long as the maximum packet length of all the netdev you use.
  */
 #ifndef LWIP_NETDEV_BUFLEN
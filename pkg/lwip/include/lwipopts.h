@@ -143,6 +143,16 @@ extern "C" {
 #define LWIP_NETCONN            0
 #endif /* MODULE_LWIP_SOCK */
 
+/* sock calls run in the calling thread with the core lock held instead of
+ * being passed to the tcpip thread */
+#define LWIP_TCPIP_CORE_LOCKING 1
+
+#ifdef MODULE_LWIP_CORE_LOCKING_INPUT
+#define LWIP_TCPIP_CORE_LOCKING_INPUT   1
+#else
+#define LWIP_TCPIP_CORE_LOCKING_INPUT   0
+#endif /* MODULE_LWIP_CORE_LOCKING_INPUT */
+
 #ifdef MODULE_SHELL_CMD_LWIP_NETIF
 #define LWIP_DEBUG              1
 #endif
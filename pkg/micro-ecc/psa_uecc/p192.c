@@ -101,7 +101,7 @@ psa_status_t psa_ecc_p192r1_verify_hash(const psa_key_attributes_t *attributes,
     /* Micro-ECC expects uncompressed public key without 0x04 prefix */
     ret = uECC_verify(key_buffer+1, hash, hash_length, signature, curve);
     if (!ret) {
-        return PSA_ERROR_GENERIC_ERROR;
+        return PSA_ERROR_INVALID_SIGNATURE;
     }
 
     (void)alg;
@@ -291,6 +291,13 @@ static void _on_data(nimble_netif_conn_t *conn, struct ble_l2cap_event *event)
     struct os_mbuf *rxb = event->receive.sdu_rx;
     size_t rx_len = (size_t)OS_MBUF_PKTLEN(rxb);
 
+    /* hand a new mbuf to NimBLE before copying the received data, so the peer
+     * gets its credits back and can continue sending in the meantime */
+    struct os_mbuf *next = os_msys_get_pkthdr(MYNEWT_VAL_BLE_L2CAP_COC_MPS, 0);
+    /* due to buffer provisioning, there should always be enough space */
+    assert(next != NULL);
+    ble_l2cap_recv_ready(event->receive.chan, next);
+
     /* allocate netif header */
     gnrc_pktsnip_t *if_snip = gnrc_netif_hdr_build(conn->addr, BLE_ADDR_LEN,
                                                    _netif.l2addr,
@@ -323,12 +330,7 @@ static void _on_data(nimble_netif_conn_t *conn, struct ble_l2cap_event *event)
     }
 
 end:
-    /* free the mbuf and allocate a new one for receiving new data */
     os_mbuf_free_chain(rxb);
-    rxb = os_msys_get_pkthdr(MYNEWT_VAL_BLE_L2CAP_COC_MPS, 0);
-    /* due to buffer provisioning, there should always be enough space */
-    assert(rxb != NULL);
-    ble_l2cap_recv_ready(event->receive.chan, rxb);
 }
 
 static int _on_l2cap_client_evt(struct ble_l2cap_event *event, void *arg)
@@ -501,6 +501,15 @@ ssize_t sock_udp_recv_buf_aux(sock_udp_t *sock, void **data, void **buf_ctx,
 }
 
 #ifdef SOCK_HAS_ASYNC
+void sock_udp_buf_release(sock_udp_t *sock, void *buf_ctx)
+{
+    (void)sock;
+    assert(sock != NULL);
+    if (buf_ctx != NULL) {
+        openqueue_freePacketBuffer(buf_ctx);
+    }
+}
+
 void sock_udp_set_cb(sock_udp_t *sock, sock_udp_cb_t cb, void *cb_arg)
 {
     sock->async_cb = cb;
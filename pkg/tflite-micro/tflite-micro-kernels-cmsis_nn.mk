@@ -0,0 +1,5 @@
+MODULE = tflite-micro-kernels-cmsis_nn
+
+SRCXXEXT = cc
+
+include $(RIOTBASE)/Makefile.base
@@ -3,4 +3,9 @@ MODULE = tflite-micro-kernels
 SRCXXEXT = cc
 SRCXXEXCLUDE = $(wildcard *_test.$(SRCXXEXT))
 
+# the optimized kernels replace the reference ones of the same name
+ifneq (,$(filter tflite-micro-kernels-cmsis_nn,$(USEMODULE)))
+  SRCXXEXCLUDE += $(notdir $(wildcard cmsis_nn/*.$(SRCXXEXT)))
+endif
+
 include $(RIOTBASE)/Makefile.base
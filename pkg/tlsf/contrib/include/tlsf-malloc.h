@@ -23,6 +23,8 @@
  * control block should be initialized as the first thing before the stdlib is
  * used. Boards should use tlsf_add_global_pool() at startup to add all the memory
  * regions they want to make available for dynamic allocation via malloc().
+ * @ref sys_malloc_tlsf does this automatically for the heap regions of the
+ * linker script.
  *
  * @{
  * @file
@@ -82,6 +84,18 @@ void tlsf_size_walker(void* ptr, size_t size, int used, void* user);
  */
 int tlsf_add_global_pool(void *mem, size_t bytes);
 
+/**
+ * Add the default memory areas to the global allocator pool.
+ *
+ * This is called on the first allocation, if no area has been added with
+ * tlsf_add_global_pool() before. The default implementation does nothing,
+ * @ref sys_malloc_tlsf overrides it to add the heap regions of the linker
+ * script.
+ *
+ * @note    Called with interrupts disabled.
+ */
+void tlsf_malloc_init_pools(void);
+
 /**
  * Get a pointer to the global tlsf_control block.
  *
@@ -55,7 +55,7 @@ extern tlsf_t tlsf_malloc_gheap;
 ATTR_MALLOC void *malloc(size_t bytes)
 {
     unsigned old_state = irq_disable();
-    void *result = tlsf_malloc(tlsf_malloc_gheap, bytes);
+    void *result = tlsf_malloc(tlsf_malloc_heap(), bytes);
 
     if (result == NULL) {
         errno = ENOMEM;
@@ -84,7 +84,7 @@ ATTR_CALLOC void *calloc(size_t count, size_t bytes)
 ATTR_MALIGN void *memalign(size_t align, size_t bytes)
 {
     unsigned old_state = irq_disable();
-    void *result = tlsf_memalign(tlsf_malloc_gheap, align, bytes);
+    void *result = tlsf_memalign(tlsf_malloc_heap(), align, bytes);
 
     if (result == NULL) {
         errno = ENOMEM;
@@ -100,7 +100,7 @@ ATTR_MALIGN void *memalign(size_t align, size_t bytes)
 ATTR_REALLOC void *realloc(void *ptr, size_t size)
 {
     unsigned old_state = irq_disable();
-    void *result = tlsf_realloc(tlsf_malloc_gheap, ptr, size);
+    void *result = tlsf_realloc(tlsf_malloc_heap(), ptr, size);
 
     if (result == NULL) {
         errno = ENOMEM;
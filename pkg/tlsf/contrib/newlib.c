@@ -55,7 +55,7 @@
 ATTR_MALLOCR void *_malloc_r(struct _reent *reent_ptr, size_t bytes)
 {
     unsigned old_state = irq_disable();
-    void *result = tlsf_malloc(tlsf_malloc_gheap, bytes);
+    void *result = tlsf_malloc(tlsf_malloc_heap(), bytes);
 
     if (result == NULL) {
         reent_ptr->_errno = ENOMEM;
@@ -88,7 +88,7 @@ ATTR_CALLOCR void *_calloc_r(struct _reent *reent_ptr, size_t count, size_t byte
 ATTR_MALIGNR void *_memalign_r(struct _reent *reent_ptr, size_t align, size_t bytes)
 {
     unsigned old_state = irq_disable();
-    void *result = tlsf_memalign(tlsf_malloc_gheap, align, bytes);
+    void *result = tlsf_memalign(tlsf_malloc_heap(), align, bytes);
 
     if (result == NULL) {
         reent_ptr->_errno = ENOMEM;
@@ -104,7 +104,7 @@ ATTR_MALIGNR void *_memalign_r(struct _reent *reent_ptr, size_t align, size_t by
 ATTR_REALLOCR void *_realloc_r(struct _reent *reent_ptr, void *ptr, size_t size)
 {
     unsigned old_state = irq_disable();
-    void *result = tlsf_realloc(tlsf_malloc_gheap, ptr, size);
+    void *result = tlsf_realloc(tlsf_malloc_heap(), ptr, size);
 
     if (result == NULL) {
         reent_ptr->_errno = ENOMEM;
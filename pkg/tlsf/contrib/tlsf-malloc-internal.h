@@ -20,6 +20,7 @@
 #define TLSF_MALLOC_INTERNAL_H
 
 #include "tlsf.h"
+#include "tlsf-malloc.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -27,6 +28,19 @@ extern "C" {
 
 extern tlsf_t tlsf_malloc_gheap;
 
+/**
+ * Get the global heap, adding the default pools on first use.
+ *
+ * Must be called with interrupts disabled.
+ */
+static inline tlsf_t tlsf_malloc_heap(void)
+{
+    if (tlsf_malloc_gheap == NULL) {
+        tlsf_malloc_init_pools();
+    }
+    return tlsf_malloc_gheap;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -19,6 +19,7 @@
 
 #include <stdio.h>
 
+#include "architecture.h"
 #include "tlsf.h"
 #include "tlsf-malloc.h"
 #include "tlsf-malloc-internal.h"
@@ -39,6 +40,10 @@ int tlsf_add_global_pool(void *mem, size_t bytes)
     }
 }
 
+__attribute__((weak)) void tlsf_malloc_init_pools(void)
+{
+}
+
 tlsf_t _tlsf_get_global_control(void)
 {
     return tlsf_malloc_gheap;
@@ -0,0 +1,200 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     pkg_wamr_natives
+ * @{
+ *
+ * @file
+ * @brief       RIOT native functions for WAMR
+ *
+ * The signatures tell WAMR how to translate the arguments: `i` is a 32 bit
+ * integer, `*~` a pointer into the linear memory of the module followed by
+ * the length of the buffer, which WAMR checks and converts to a native
+ * pointer before the call.
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "container.h"
+#include "wasm_export.h"
+#include "wamr_natives.h"
+#include "ztimer.h"
+
+#if IS_USED(MODULE_SAUL_REG)
+#include "saul_reg.h"
+#endif
+#if IS_USED(MODULE_SOCK_UDP)
+#include "net/sock/udp.h"
+#endif
+
+static uint32_t _ztimer_now_msec(wasm_exec_env_t env)
+{
+    (void)env;
+    return ztimer_now(ZTIMER_MSEC);
+}
+
+static uint32_t _ztimer_now_usec(wasm_exec_env_t env)
+{
+    (void)env;
+    return ztimer_now(ZTIMER_USEC);
+}
+
+static void _ztimer_sleep_msec(wasm_exec_env_t env, uint32_t msec)
+{
+    (void)env;
+    ztimer_sleep(ZTIMER_MSEC, msec);
+}
+
+#if IS_USED(MODULE_SAUL_REG)
+/* the module sees the same layout when built for wasm32 */
+static_assert(sizeof(phydat_t) == 8, "unexpected layout of phydat_t");
+
+static int32_t _saul_type(wasm_exec_env_t env, int32_t pos)
+{
+    (void)env;
+    saul_reg_t *dev = saul_reg_find_nth(pos);
+    return dev ? dev->driver->type : -ENODEV;
+}
+
+static int32_t _saul_read(wasm_exec_env_t env, int32_t pos,
+                          void *res, uint32_t res_len)
+{
+    (void)env;
+    saul_reg_t *dev = saul_reg_find_nth(pos);
+    if (dev == NULL) {
+        return -ENODEV;
+    }
+    if (res_len < sizeof(phydat_t)) {
+        return -EINVAL;
+    }
+    return saul_reg_read(dev, res);
+}
+
+static int32_t _saul_write(wasm_exec_env_t env, int32_t pos,
+                           void *data, uint32_t data_len)
+{
+    (void)env;
+    saul_reg_t *dev = saul_reg_find_nth(pos);
+    if (dev == NULL) {
+        return -ENODEV;
+    }
+    if (data_len < sizeof(phydat_t)) {
+        return -EINVAL;
+    }
+    return saul_reg_write(dev, data);
+}
+#endif /* MODULE_SAUL_REG */
+
+#if IS_USED(MODULE_SOCK_UDP)
+static sock_udp_t _socks[CONFIG_WAMR_NATIVES_SOCK_NUMOF];
+static bool _socks_used[CONFIG_WAMR_NATIVES_SOCK_NUMOF];
+
+static sock_udp_t *_get_sock(int32_t sock)
+{
+    if ((sock < 0) || ((unsigned)sock >= ARRAY_SIZE(_socks)) ||
+        !_socks_used[sock]) {
+        return NULL;
+    }
+    return &_socks[sock];
+}
+
+static int32_t _sock_udp_open(wasm_exec_env_t env, uint32_t port)
+{
+    (void)env;
+    sock_udp_ep_t local = { .family = AF_INET6, .port = port };
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_socks); i++) {
+        if (!_socks_used[i]) {
+            int res = sock_udp_create(&_socks[i], &local, NULL, 0);
+            if (res < 0) {
+                return res;
+            }
+            _socks_used[i] = true;
+            return i;
+        }
+    }
+    return -ENOMEM;
+}
+
+static int32_t _sock_udp_close(wasm_exec_env_t env, int32_t sock)
+{
+    (void)env;
+    sock_udp_t *s = _get_sock(sock);
+    if (s == NULL) {
+        return -EBADF;
+    }
+    sock_udp_close(s);
+    _socks_used[sock] = false;
+    return 0;
+}
+
+static int32_t _sock_udp_send(wasm_exec_env_t env, int32_t sock,
+                              void *data, uint32_t len,
+                              void *addr, uint32_t addr_len, uint32_t port)
+{
+    (void)env;
+    sock_udp_t *s = _get_sock(sock);
+    sock_udp_ep_t remote = { .family = AF_INET6, .port = port };
+
+    if (s == NULL) {
+        return -EBADF;
+    }
+    if (addr_len != sizeof(remote.addr.ipv6)) {
+        return -EINVAL;
+    }
+    memcpy(remote.addr.ipv6, addr, sizeof(remote.addr.ipv6));
+    return sock_udp_send(s, data, len, &remote);
+}
+
+static int32_t _sock_udp_recv(wasm_exec_env_t env, int32_t sock,
+                              void *buf, uint32_t max_len,
+                              uint32_t timeout_msec)
+{
+    (void)env;
+    sock_udp_t *s = _get_sock(sock);
+    uint32_t timeout = SOCK_NO_TIMEOUT;
+
+    if (s == NULL) {
+        return -EBADF;
+    }
+    if (timeout_msec < (UINT32_MAX / US_PER_MS)) {
+        timeout = timeout_msec * US_PER_MS;
+    }
+    return sock_udp_recv(s, buf, max_len, timeout, NULL);
+}
+#endif /* MODULE_SOCK_UDP */
+
+static NativeSymbol _natives[] = {
+    { "riot_ztimer_now_msec", (void *)_ztimer_now_msec, "()i", NULL },
+    { "riot_ztimer_now_usec", (void *)_ztimer_now_usec, "()i", NULL },
+    { "riot_ztimer_sleep_msec", (void *)_ztimer_sleep_msec, "(i)", NULL },
+#if IS_USED(MODULE_SAUL_REG)
+    { "riot_saul_type", (void *)_saul_type, "(i)i", NULL },
+    { "riot_saul_read", (void *)_saul_read, "(i*~)i", NULL },
+    { "riot_saul_write", (void *)_saul_write, "(i*~)i", NULL },
+#endif
+#if IS_USED(MODULE_SOCK_UDP)
+    { "riot_sock_udp_open", (void *)_sock_udp_open, "(i)i", NULL },
+    { "riot_sock_udp_close", (void *)_sock_udp_close, "(i)i", NULL },
+    { "riot_sock_udp_send", (void *)_sock_udp_send, "(i*~*~i)i", NULL },
+    { "riot_sock_udp_recv", (void *)_sock_udp_recv, "(i*~i)i", NULL },
+#endif
+};
+
+bool wamr_natives_register(void)
+{
+    return wasm_runtime_register_natives("env", _natives, ARRAY_SIZE(_natives));
+}
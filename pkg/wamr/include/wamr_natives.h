@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    pkg_wamr_natives RIOT native functions for WAMR
+ * @ingroup     pkg_wamr
+ * @brief       Lets WebAssembly modules use ztimer, SAUL and UDP sockets
+ *
+ * After wamr_natives_register() the following functions can be imported by
+ * WebAssembly modules from the default `env` module, so a module built from
+ * C just declares them `extern` and links with `--allow-undefined`:
+ *
+ * @code{.c}
+ * uint32_t riot_ztimer_now_msec(void);
+ * uint32_t riot_ztimer_now_usec(void);
+ * void riot_ztimer_sleep_msec(uint32_t msec);
+ *
+ * // with module saul_reg
+ * int riot_saul_type(int pos);
+ * int riot_saul_read(int pos, phydat_t *res, size_t res_len);
+ * int riot_saul_write(int pos, const phydat_t *data, size_t data_len);
+ *
+ * // with module sock_udp, IPv6 only
+ * int riot_sock_udp_open(uint16_t port);
+ * int riot_sock_udp_close(int sock);
+ * int riot_sock_udp_send(int sock, const void *data, size_t len,
+ *                        const uint8_t *addr, size_t addr_len, uint16_t port);
+ * int riot_sock_udp_recv(int sock, void *buf, size_t max_len,
+ *                        uint32_t timeout_msec);
+ * @endcode
+ *
+ * The SAUL functions address the devices by their position in the registry
+ * (see @ref saul_reg_find_nth()), `phydat_t` has the same layout in the
+ * module as in RIOT. Sockets are referred to by a small handle, at most
+ * @ref CONFIG_WAMR_NATIVES_SOCK_NUMOF can be open at the same time. A
+ * timeout of `UINT32_MAX` lets riot_sock_udp_recv() wait forever.
+ *
+ * Buffers are passed as pointers into the linear memory of the module. WAMR
+ * checks that they lie within the memory of the module before the call, the
+ * functions then access them directly without copying.
+ *
+ * All functions return negative errno codes on error.
+ *
+ * @{
+ *
+ * @file
+ * @brief       RIOT native functions for WAMR
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ */
+
+#ifndef WAMR_NATIVES_H
+#define WAMR_NATIVES_H
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of UDP sockets WebAssembly modules can have open
+ */
+#ifndef CONFIG_WAMR_NATIVES_SOCK_NUMOF
+#define CONFIG_WAMR_NATIVES_SOCK_NUMOF  (2U)
+#endif
+
+/**
+ * @brief   Register the native functions with the WAMR runtime
+ *
+ * Must be called after the runtime is initialized and before a module using
+ * them is loaded.
+ *
+ * @retval  true    on success
+ * @retval  false   if the runtime failed to register the functions
+ */
+bool wamr_natives_register(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* WAMR_NATIVES_H */
+/** @} */
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_arena
+ * @{
+ *
+ * @file
+ * @brief       Arena allocator implementation
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "arena.h"
+
+void arena_init(arena_t *arena, void *buf, size_t size)
+{
+    assert((arena != NULL) && ((buf != NULL) || (size == 0)));
+
+    arena->buf = buf;
+    arena->size = size;
+    arena->used = 0;
+    arena->used_max = 0;
+}
+
+void *arena_alloc_aligned(arena_t *arena, size_t size, size_t align)
+{
+    assert((align != 0) && ((align & (align - 1)) == 0));
+
+    /* align the address, not the offset, the buffer may be unaligned */
+    uintptr_t start = (uintptr_t)arena->buf + arena->used;
+    size_t pad = (align - (start & (align - 1))) & (align - 1);
+
+    if ((pad > arena_available(arena)) ||
+        (size > arena_available(arena) - pad)) {
+        return NULL;
+    }
+
+    void *res = arena->buf + arena->used + pad;
+    arena->used += pad + size;
+    if (arena->used > arena->used_max) {
+        arena->used_max = arena->used;
+    }
+    return res;
+}
+
+void *arena_calloc(arena_t *arena, size_t nmemb, size_t size)
+{
+    size_t total;
+
+    if (__builtin_mul_overflow(nmemb, size, &total)) {
+        return NULL;
+    }
+
+    void *res = arena_alloc(arena, total);
+    if (res) {
+        memset(res, 0, total);
+    }
+    return res;
+}
@@ -19,6 +19,8 @@
  * @author  Martine S. Lenders <m.lenders@fu-berlin.de>
  * @}
  */
+#include <inttypes.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 #include "sched.h"
@@ -26,6 +28,14 @@
 #include "auto_init_utils.h"
 #include "auto_init_priorities.h"
 #include "kernel_defines.h"
+#if IS_ACTIVE(CONFIG_AUTO_INIT_ENABLE_TIMING)
+#include "ztimer.h"
+#endif
+
+#if IS_ACTIVE(CONFIG_AUTO_INIT_ENABLE_TIMING) && \
+    !(IS_USED(MODULE_ZTIMER_USEC) && IS_USED(MODULE_AUTO_INIT_ZTIMER))
+#error "CONFIG_AUTO_INIT_ENABLE_TIMING requires ztimer_usec and auto_init_ztimer"
+#endif
 
 #define ENABLE_DEBUG CONFIG_AUTO_INIT_ENABLE_DEBUG
 #include "debug.h"
@@ -40,6 +50,22 @@ static inline void _auto_init_module(const volatile auto_init_module_t *module)
     module->init();
 }
 
+#if IS_ACTIVE(CONFIG_AUTO_INIT_ENABLE_TIMING)
+static uint32_t _auto_init_module_timed(const volatile auto_init_module_t *module)
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    _auto_init_module(module);
+    uint32_t duration = ztimer_now(ZTIMER_USEC) - start;
+    printf("auto_init: %-32s %10" PRIu32 " us\n", module->name, duration);
+    return duration;
+}
+#endif
+
+#if IS_USED(MODULE_AUTO_INIT_STATIC_CTORS)
+extern void __libc_init_array(void);
+AUTO_INIT(__libc_init_array,
+          AUTO_INIT_PRIO_MOD_STATIC_CTORS);
+#endif
 #if IS_USED(MODULE_AUTO_INIT_ZTIMER)
 extern void ztimer_init(void);
 AUTO_INIT(ztimer_init,
@@ -50,6 +76,11 @@ extern void ztimer64_init(void);
 AUTO_INIT(ztimer64_init,
           AUTO_INIT_PRIO_MOD_ZTIMER64);
 #endif
+#if IS_USED(MODULE_AUTO_INIT_WALLCLOCK)
+extern void auto_init_wallclock(void);
+AUTO_INIT(auto_init_wallclock,
+          AUTO_INIT_PRIO_MOD_WALLCLOCK);
+#endif
 #if IS_USED(MODULE_AUTO_INIT_XTIMER) && !IS_USED(MODULE_ZTIMER_XTIMER_COMPAT)
 extern void xtimer_init(void);
 AUTO_INIT(xtimer_init,
@@ -60,6 +91,16 @@ extern void auto_init_random(void);
 AUTO_INIT(auto_init_random,
           AUTO_INIT_PRIO_MOD_RANDOM);
 #endif
+#if IS_USED(MODULE_TRACE_EVENTS)
+extern void auto_init_trace_events(void);
+AUTO_INIT(auto_init_trace_events,
+          AUTO_INIT_PRIO_MOD_TRACE_EVENTS);
+#endif
+#if IS_USED(MODULE_LOCKSTATS)
+extern void auto_init_lockstats(void);
+AUTO_INIT(auto_init_lockstats,
+          AUTO_INIT_PRIO_MOD_LOCKSTATS);
+#endif
 #if IS_USED(MODULE_SCHEDSTATISTICS)
 extern void init_schedstatistics(void);
 AUTO_INIT(init_schedstatistics,
@@ -75,6 +116,11 @@ extern void dummy_thread_create(void);
 AUTO_INIT(dummy_thread_create,
           AUTO_INIT_PRIO_MOD_DUMMY_THREAD);
 #endif
+#if IS_USED(MODULE_LOG_DEFERRED)
+extern void log_deferred_init(void);
+AUTO_INIT(log_deferred_init,
+          AUTO_INIT_PRIO_MOD_LOG_DEFERRED);
+#endif
 #if IS_USED(MODULE_EVENT_THREAD)
 extern void auto_init_event_thread(void);
 AUTO_INIT(auto_init_event_thread,
@@ -347,7 +393,30 @@ AUTO_INIT(auto_init_gnrc_ipv6_static_addr,
 
 void auto_init(void)
 {
+#if IS_ACTIVE(CONFIG_AUTO_INIT_ENABLE_TIMING)
+    uint32_t total = 0;
+    bool timing = false;
+#endif
+
     for (unsigned i = 0; i < XFA_LEN(auto_init_module_t, auto_init_xfa); i++) {
+#if IS_ACTIVE(CONFIG_AUTO_INIT_ENABLE_TIMING)
+        /* ZTIMER_USEC can be used once ztimer is initialized */
+        if (!timing && (auto_init_xfa[i].prio > AUTO_INIT_PRIO_MOD_ZTIMER)) {
+            ztimer_acquire(ZTIMER_USEC);
+            timing = true;
+        }
+        if (timing) {
+            total += _auto_init_module_timed(&auto_init_xfa[i]);
+            continue;
+        }
+#endif
         _auto_init_module(&auto_init_xfa[i]);
     }
+
+#if IS_ACTIVE(CONFIG_AUTO_INIT_ENABLE_TIMING)
+    if (timing) {
+        ztimer_release(ZTIMER_USEC);
+        printf("auto_init: %-32s %10" PRIu32 " us\n", "total", total);
+    }
+#endif
 }
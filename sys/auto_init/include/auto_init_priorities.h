@@ -23,6 +23,12 @@
 extern "C" {
 #endif
 
+#ifndef AUTO_INIT_PRIO_MOD_STATIC_CTORS
+/**
+ * @brief   static constructors priority (module `auto_init_static_ctors`)
+ */
+#define AUTO_INIT_PRIO_MOD_STATIC_CTORS                 1005
+#endif
 #ifndef AUTO_INIT_PRIO_MOD_ZTIMER
 /**
  * @brief   ztimer priority
@@ -35,6 +41,12 @@ extern "C" {
  */
 #define AUTO_INIT_PRIO_MOD_ZTIMER64                     1020
 #endif
+#ifndef AUTO_INIT_PRIO_MOD_WALLCLOCK
+/**
+ * @brief   wall clock priority
+ */
+#define AUTO_INIT_PRIO_MOD_WALLCLOCK                    1025
+#endif
 #ifndef AUTO_INIT_PRIO_MOD_XTIMER
 /**
  * @brief   xtimer priority
@@ -53,6 +65,18 @@ extern "C" {
  */
 #define AUTO_INIT_PRIO_MOD_RANDOM                       1040
 #endif
+#ifndef AUTO_INIT_PRIO_MOD_TRACE_EVENTS
+/**
+ * @brief   event tracing priority
+ */
+#define AUTO_INIT_PRIO_MOD_TRACE_EVENTS                 1045
+#endif
+#ifndef AUTO_INIT_PRIO_MOD_LOCKSTATS
+/**
+ * @brief   lock contention statistics priority
+ */
+#define AUTO_INIT_PRIO_MOD_LOCKSTATS                    1047
+#endif
 #ifndef AUTO_INIT_PRIO_MOD_SCHEDSTATISTICS
 /**
  * @brief   scheduling statistics priority
@@ -71,6 +95,12 @@ extern "C" {
  */
 #define AUTO_INIT_PRIO_MOD_DUMMY_THREAD                 1070
 #endif
+#ifndef AUTO_INIT_PRIO_MOD_LOG_DEFERRED
+/**
+ * @brief   deferred logging thread priority
+ */
+#define AUTO_INIT_PRIO_MOD_LOG_DEFERRED                 1075
+#endif
 #ifndef AUTO_INIT_PRIO_MOD_EVENT_THREAD
 /**
  * @brief   event thread priority
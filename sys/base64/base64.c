@@ -24,75 +24,99 @@
 #include <stdint.h>
 
 #include "base64.h"
+#include "container.h"
 #include "kernel_defines.h"
 
-#define BASE64_CAPITAL_UPPER_BOUND     (25)     /**< base64 'Z'           */
-#define BASE64_SMALL_UPPER_BOUND       (51)     /**< base64 'z'           */
-#define BASE64_NUMBER_UPPER_BOUND      (61)     /**< base64 '9'           */
-#define BASE64_PLUS                    (62)     /**< base64 '+'           */
-#define BASE64_MINUS                   (62)     /**< base64 '-'           */
-#define BASE64_SLASH                   (63)     /**< base64 '/'           */
-#define BASE64_UNDERLINE               (63)     /**< base64 '_'           */
 #define BASE64_EQUALS                  (0xFE)   /**< no base64 symbol '=' */
 #define BASE64_NOT_DEFINED             (0xFF)   /**< no base64 symbol     */
 
+static const char _alphabet[64] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+#if IS_ACTIVE(MODULE_BASE64URL)
+static const char _alphabet_url[64] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+#endif
+
 /*
- * returns the corresponding ascii symbol value for the given base64 code
+ * base64 code of each ASCII symbol, both alphabets are accepted. Symbols
+ * that are not base64 (such as inserted newlines) are BASE64_NOT_DEFINED
+ * and ignored by the decoder.
  */
-static char getsymbol(uint8_t code, bool urlsafe)
+static const uint8_t _codes[128] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3f,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b,
+    0x3c, 0x3d, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
+    0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+    0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e,
+    0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+    0x17, 0x18, 0x19, 0xff, 0xff, 0xff, 0xff, 0x3f,
+    0xff, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20,
+    0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+    0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30,
+    0x31, 0x32, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const char *_get_alphabet(bool urlsafe)
 {
-    if (!IS_ACTIVE(MODULE_BASE64URL)) {
-        urlsafe = false;
-    }
-
-    if (urlsafe && code == BASE64_UNDERLINE) {
-        return '_';
-    }
-
-    if (urlsafe && code == BASE64_MINUS) {
-        return '-';
-    }
-
-    if (!urlsafe && code == BASE64_SLASH) {
-        return '/';
+#if IS_ACTIVE(MODULE_BASE64URL)
+    if (urlsafe) {
+        return _alphabet_url;
     }
+#else
+    (void)urlsafe;
+#endif
+    return _alphabet;
+}
 
-    if (!urlsafe && code == BASE64_PLUS) {
-        return '+';
+/*
+ * encodes len (a multiple of 3) bytes, a group of three bytes at a time
+ */
+static uint8_t *_encode_groups(uint8_t *out, const uint8_t *in, size_t len,
+                               const char *alphabet)
+{
+    for (const uint8_t *end = in + len; in < end; in += 3) {
+        uint32_t w = ((uint32_t)in[0] << 16) | ((uint32_t)in[1] << 8) | in[2];
+        out[0] = alphabet[w >> 18];
+        out[1] = alphabet[(w >> 12) & 0x3f];
+        out[2] = alphabet[(w >> 6) & 0x3f];
+        out[3] = alphabet[w & 0x3f];
+        out += 4;
     }
+    return out;
+}
 
-    if (code <= BASE64_CAPITAL_UPPER_BOUND) {
-        return (code + 'A');
-    }
+/*
+ * encodes the final one or two bytes, returns the number of symbols written
+ */
+static size_t _encode_tail(uint8_t *out, const uint8_t *in, size_t len,
+                           const char *alphabet, bool urlsafe)
+{
+    uint8_t last[3] = { in[0], (len > 1) ? in[1] : 0, 0 };
 
-    if (code <= BASE64_SMALL_UPPER_BOUND) {
-        return (code + ('z' - BASE64_SMALL_UPPER_BOUND));
+    _encode_groups(out, last, sizeof(last), alphabet);
+    /* padding is not required for urlsafe application */
+    if (urlsafe) {
+        return len + 1;
     }
-
-    if (code <= BASE64_NUMBER_UPPER_BOUND) {
-        return (code + ('9' - BASE64_NUMBER_UPPER_BOUND));
+    /* replace the symbols of the missing input bytes with "=" */
+    out[3] = '=';
+    if (len == 1) {
+        out[2] = '=';
     }
-
-    return (char)BASE64_NOT_DEFINED;
-}
-
-static void encode_three_bytes(uint8_t *dest,
-                               uint8_t b1, uint8_t b2, uint8_t b3,
-                               bool urlsafe)
-{
-    dest[0] = getsymbol(b1 >> 2, urlsafe);
-    dest[1] = getsymbol(((b1 & 0x03) << 4) | (b2 >> 4), urlsafe);
-    dest[2] = getsymbol(((b2 & 0x0f) << 2) | (b3 >> 6), urlsafe);
-    dest[3] = getsymbol(b3 & 0x3f, urlsafe);
+    return 4;
 }
 
 static int base64_encode_base(const void *data_in, size_t data_in_size,
                               void *base64_out, size_t *base64_out_size,
                               bool urlsafe)
 {
-    const uint8_t padding = urlsafe ? 0 : '=';
     const uint8_t *in = data_in;
-    const uint8_t *end = in + data_in_size;
     uint8_t *out = base64_out;
     size_t required_size = base64_estimate_encode_size(data_in_size);
 
@@ -114,41 +138,14 @@ static int base64_encode_base(const void *data_in, size_t data_in_size,
         return BASE64_ERROR_BUFFER_OUT;
     }
 
-    *base64_out_size = required_size;
+    const char *alphabet = _get_alphabet(urlsafe);
+    size_t tail = data_in_size % 3;
 
-    while (in < end - 2) {
-        encode_three_bytes(out, in[0], in[1], in[2], urlsafe);
-        out += 4;
-        in += 3;
-    }
-
-    if (in == end) {
-        /* data_in_size is multiple of 3, we're done */
-        return BASE64_SUCCESS;
-    }
-
-    if (in + 1 == end) {
-        /* One byte still left to decode, set other two input bytes to zero */
-        encode_three_bytes(out, in[0], 0, 0, urlsafe);
-        /* Replace last two bytes with "=" to signal corresponding input bytes
-         * didn't exist */
-        out[2] = out[3] = padding;
-
-        /* padding is not required for urlsafe application */
-        if (urlsafe) {
-            *base64_out_size -= 2;
-        }
-        return BASE64_SUCCESS;
-    }
-
-    /* Final case: 2 bytes remain for encoding, use zero as third input */
-    encode_three_bytes(out, in[0], in[1], 0, urlsafe);
-    /* Replace last output with "=" to signal corresponding input byte didn't exit */
-    out[3] = padding;
-
-    /* padding is not required for urlsafe application */
-    if (urlsafe) {
-        *base64_out_size -= 1;
+    out = _encode_groups(out, in, data_in_size - tail, alphabet);
+    *base64_out_size = out - (uint8_t *)base64_out;
+    if (tail) {
+        *base64_out_size += _encode_tail(out, in + data_in_size - tail, tail,
+                                         alphabet, urlsafe);
     }
 
     return BASE64_SUCCESS;
@@ -168,51 +165,66 @@ int base64url_encode(const void *data_in, size_t data_in_size,
 }
 #endif
 
-/*
- *  returns the corresponding base64 code for the given ascii symbol
- */
-static uint8_t getcode(char symbol)
+void base64_encoder_init(base64_encoder_t *enc)
 {
-    if (symbol == '/') {
-        return BASE64_SLASH;
-    }
-
-    if (symbol == '_') {
-        return BASE64_UNDERLINE;
-    }
+    enc->pending_len = 0;
+    enc->urlsafe = false;
+}
 
-    if (symbol == '+') {
-        return BASE64_PLUS;
-    }
+#if IS_ACTIVE(MODULE_BASE64URL)
+void base64url_encoder_init(base64_encoder_t *enc)
+{
+    enc->pending_len = 0;
+    enc->urlsafe = true;
+}
+#endif
 
-    if (symbol == '-') {
-        return BASE64_MINUS;
+size_t base64_encoder_update(base64_encoder_t *enc, const void *data,
+                             size_t len, void *out)
+{
+    const char *alphabet = _get_alphabet(enc->urlsafe);
+    const uint8_t *in = data;
+    uint8_t *pos = out;
+
+    /* complete the group left over from the previous call */
+    while (enc->pending_len && len) {
+        enc->pending[enc->pending_len++] = *in++;
+        len--;
+        if (enc->pending_len == sizeof(enc->pending)) {
+            pos = _encode_groups(pos, enc->pending, sizeof(enc->pending),
+                                 alphabet);
+            enc->pending_len = 0;
+        }
     }
 
-    if (symbol == '=') {
-        /* indicates a padded base64 end */
-        return BASE64_EQUALS;
+    size_t tail = len % 3;
+    pos = _encode_groups(pos, in, len - tail, alphabet);
+    for (size_t i = 0; i < tail; i++) {
+        enc->pending[enc->pending_len++] = in[len - tail + i];
     }
 
-    if (symbol < '0') {
-        /* indicates that the given symbol is not base64 and should be ignored */
-        return BASE64_NOT_DEFINED;
-    }
+    return pos - (uint8_t *)out;
+}
 
-    if (symbol <= '9' && symbol >= '0') {
-        return (symbol + (BASE64_NUMBER_UPPER_BOUND - '9'));
-    }
+size_t base64_encoder_finish(base64_encoder_t *enc, void *out)
+{
+    size_t len = 0;
 
-    if (symbol <= 'Z' && symbol >= 'A') {
-        return (symbol - 'A');
+    if (enc->pending_len) {
+        len = _encode_tail(out, enc->pending, enc->pending_len,
+                           _get_alphabet(enc->urlsafe), enc->urlsafe);
+        enc->pending_len = 0;
     }
 
-    if (symbol <= 'z' && symbol >= 'a') {
-        return (symbol + (BASE64_SMALL_UPPER_BOUND - 'z'));
-    }
+    return len;
+}
 
-    /* indicates that the given symbol is not base64 and should be ignored */
-    return BASE64_NOT_DEFINED;
+/*
+ *  returns the corresponding base64 code for the given ascii symbol
+ */
+static inline uint8_t getcode(uint8_t symbol)
+{
+    return (symbol < ARRAY_SIZE(_codes)) ? _codes[symbol] : BASE64_NOT_DEFINED;
 }
 
 static void decode_four_codes(uint8_t *out, const uint8_t *src)
@@ -246,6 +258,21 @@ int base64_decode(const void *base64_in, size_t base64_in_size,
     uint8_t decode_buf[4];
 
     while (1) {
+        /* fast path: the next four symbols are all base64 codes */
+        if (end - in >= 4) {
+            decode_buf[0] = getcode(in[0]);
+            decode_buf[1] = getcode(in[1]);
+            decode_buf[2] = getcode(in[2]);
+            decode_buf[3] = getcode(in[3]);
+            if (!((decode_buf[0] | decode_buf[1] |
+                   decode_buf[2] | decode_buf[3]) & 0xc0)) {
+                decode_four_codes(out, decode_buf);
+                out += 3;
+                in += 4;
+                continue;
+            }
+        }
+
         size_t decode_buf_fill = 0;
         /* Try to load 4 codes into the decode buffer, skipping invalid symbols
          * (such as inserted newlines commonly used to improve readability) */
@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/**
+ * @ingroup     sys_benchmark
+ * @{
+ *
+ * @file
+ * @brief       Repetition statistics and JSON output for benchmarks
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <stdint.h>
+
+#include "benchmark.h"
+#include "test_utils/result_output.h"
+
+#if IS_USED(MODULE_BENCHMARK_CYCLES)
+#include "cpu.h"
+#  if defined(__riscv)
+#  include "vendor/riscv_csr.h"
+#  elif !defined(DWT_CTRL_CYCCNTENA_Msk)
+#  error "benchmark_cycles: no cycle counter available on this CPU"
+#  endif
+#else
+#include "ztimer.h"
+#endif
+
+uint32_t benchmark_now(void)
+{
+#if IS_USED(MODULE_BENCHMARK_CYCLES)
+#  if defined(__riscv)
+    return read_csr(mcycle);
+#  else
+    if (!(DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk)) {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CYCCNT = 0;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+    return DWT->CYCCNT;
+#  endif
+#else
+    return ztimer_now(ZTIMER_USEC);
+#endif
+}
+
+static void _sort(uint32_t *samples, unsigned reps)
+{
+    for (unsigned i = 1; i < reps; i++) {
+        uint32_t val = samples[i];
+        unsigned j = i;
+        for (; j > 0 && samples[j - 1] > val; j--) {
+            samples[j] = samples[j - 1];
+        }
+        samples[j] = val;
+    }
+}
+
+static uint32_t _per_call(uint32_t time, unsigned long runs)
+{
+    if (IS_USED(MODULE_BENCHMARK_CYCLES)) {
+        return time / runs;
+    }
+    /* microseconds per repetition to nanoseconds per call */
+    return (uint32_t)(((uint64_t)time * 1000) / runs);
+}
+
+static void _dict_u32(turo_t *ctx, const char *key, uint32_t val)
+{
+    turo_dict_key(ctx, key);
+    turo_u32(ctx, val);
+}
+
+void benchmark_print_result(const char *name, uint32_t *samples,
+                            unsigned reps, unsigned long runs)
+{
+    turo_t ctx;
+
+    assert(reps > 0);
+
+    _sort(samples, reps);
+    /* nearest rank */
+    unsigned p99 = (reps * 99 + 99) / 100 - 1;
+
+    turo_init(&ctx);
+    turo_container_open(&ctx);
+    turo_dict_open(&ctx);
+    turo_dict_key(&ctx, "benchmark");
+    turo_string(&ctx, name);
+    turo_dict_key(&ctx, "unit");
+    turo_string(&ctx, IS_USED(MODULE_BENCHMARK_CYCLES) ? "cycles" : "ns");
+    _dict_u32(&ctx, "runs", runs);
+    _dict_u32(&ctx, "reps", reps);
+    _dict_u32(&ctx, "min", _per_call(samples[0], runs));
+    _dict_u32(&ctx, "median", _per_call(samples[reps / 2], runs));
+    _dict_u32(&ctx, "p99", _per_call(samples[p99], runs));
+    _dict_u32(&ctx, "max", _per_call(samples[reps - 1], runs));
+    turo_dict_close(&ctx);
+    turo_container_close(&ctx, 0);
+}
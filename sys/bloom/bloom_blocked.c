@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_bloom
+ * @{
+ *
+ * @file
+ * @brief       Blocked and counting Bloom filters
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include "bitfield.h"
+#include "bloom.h"
+
+/* positions of the k bits of an element within its block */
+typedef struct {
+    unsigned pos;
+    unsigned step;
+} _probe_t;
+
+/* maps the hash onto the first bit of a block without a division */
+static size_t _block(uint32_t hash, size_t numof)
+{
+    return (((uint64_t)hash * numof) >> 32) * BLOOM_BLOCKED_BLOCK_BITS;
+}
+
+/* the first bit and the (odd, hence all k bits are distinct) distance
+ * between the bits are taken from a scrambled copy of the hash, whose upper
+ * bits already selected the block */
+static _probe_t _probe(uint32_t hash)
+{
+    uint32_t h = hash * 0x9e3779b1;
+
+    return (_probe_t){
+        .pos = h >> 23,
+        .step = ((h >> 14) & (BLOOM_BLOCKED_BLOCK_BITS - 1)) | 1,
+    };
+}
+
+static unsigned _next(_probe_t *probe)
+{
+    unsigned pos = probe->pos;
+
+    probe->pos = (pos + probe->step) & (BLOOM_BLOCKED_BLOCK_BITS - 1);
+    return pos;
+}
+
+void bloom_blocked_init(bloom_blocked_t *bloom, uint8_t *bitfield,
+                        size_t blocks_numof, hashfp_t hash, unsigned k)
+{
+    assert((k > 0) && (k <= BLOOM_BLOCKED_K_MAX));
+
+    memset(bitfield, 0, blocks_numof * BLOOM_BLOCKED_BLOCK_SIZE);
+    bloom->a = bitfield;
+    bloom->blocks_numof = blocks_numof;
+    bloom->hash = hash;
+    bloom->k = k;
+}
+
+void bloom_blocked_add(bloom_blocked_t *bloom, const uint8_t *buf, size_t len)
+{
+    uint32_t hash = bloom->hash(buf, len);
+    size_t block = _block(hash, bloom->blocks_numof);
+    _probe_t probe = _probe(hash);
+
+    for (unsigned n = 0; n < bloom->k; n++) {
+        bf_set(bloom->a, block + _next(&probe));
+    }
+}
+
+bool bloom_blocked_check(const bloom_blocked_t *bloom, const uint8_t *buf,
+                         size_t len)
+{
+    uint32_t hash = bloom->hash(buf, len);
+    size_t block = _block(hash, bloom->blocks_numof);
+    _probe_t probe = _probe(hash);
+
+    for (unsigned n = 0; n < bloom->k; n++) {
+        if (!bf_isset(bloom->a, block + _next(&probe))) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void bloom_counting_init(bloom_counting_t *bloom, uint8_t *counters,
+                         size_t blocks_numof, hashfp_t hash, unsigned k)
+{
+    assert((k > 0) && (k <= BLOOM_BLOCKED_K_MAX));
+
+    memset(counters, 0, blocks_numof * BLOOM_COUNTING_BLOCK_SIZE);
+    bloom->counters = counters;
+    bloom->blocks_numof = blocks_numof;
+    bloom->hash = hash;
+    bloom->k = k;
+}
+
+static unsigned _count(const uint8_t *counters, size_t idx)
+{
+    return (counters[idx / 2] >> ((idx & 1) * 4)) & 0xf;
+}
+
+void bloom_counting_add(bloom_counting_t *bloom, const uint8_t *buf,
+                        size_t len)
+{
+    uint32_t hash = bloom->hash(buf, len);
+    size_t block = _block(hash, bloom->blocks_numof);
+    _probe_t probe = _probe(hash);
+
+    for (unsigned n = 0; n < bloom->k; n++) {
+        size_t idx = block + _next(&probe);
+        if (_count(bloom->counters, idx) != 0xf) {
+            bloom->counters[idx / 2] += 1 << ((idx & 1) * 4);
+        }
+    }
+}
+
+void bloom_counting_remove(bloom_counting_t *bloom, const uint8_t *buf,
+                           size_t len)
+{
+    uint32_t hash = bloom->hash(buf, len);
+    size_t block = _block(hash, bloom->blocks_numof);
+    _probe_t probe = _probe(hash);
+
+    for (unsigned n = 0; n < bloom->k; n++) {
+        size_t idx = block + _next(&probe);
+        unsigned count = _count(bloom->counters, idx);
+        /* saturated counters no longer know how often they were added */
+        if ((count != 0) && (count != 0xf)) {
+            bloom->counters[idx / 2] -= 1 << ((idx & 1) * 4);
+        }
+    }
+}
+
+bool bloom_counting_check(const bloom_counting_t *bloom, const uint8_t *buf,
+                          size_t len)
+{
+    uint32_t hash = bloom->hash(buf, len);
+    size_t block = _block(hash, bloom->blocks_numof);
+    _probe_t probe = _probe(hash);
+
+    for (unsigned n = 0; n < bloom->k; n++) {
+        if (!_count(bloom->counters, block + _next(&probe))) {
+            return false;
+        }
+    }
+
+    return true;
+}
@@ -76,6 +76,18 @@ bool crb_add_chunk(chunk_ringbuf_t *rb, const void *data, size_t len)
     return crb_end_chunk(rb ,keep);
 }
 
+bool crb_add_chunk_irqsafe(chunk_ringbuf_t *rb, const void *data, size_t len)
+{
+    unsigned state = irq_disable();
+
+    /* don't interleave with a chunk that is written byte by byte */
+    bool res = (rb->cur_start == NULL) && crb_add_chunk(rb, data, len);
+
+    irq_restore(state);
+
+    return res;
+}
+
 static unsigned _get_cur_len(chunk_ringbuf_t *rb)
 {
     if (rb->cur > rb->cur_start) {
@@ -159,27 +171,43 @@ bool crb_peek_bytes(chunk_ringbuf_t *rb, void *dst, size_t offset, size_t len)
     return true;
 }
 
-bool crb_chunk_foreach(chunk_ringbuf_t *rb, crb_foreach_callback_t func, void *ctx)
+unsigned crb_get_chunk(chunk_ringbuf_t *rb, crb_span_t span[2])
 {
-    size_t len;
     int idx = _get_complete_chunk(rb);
     if (idx < 0) {
-        return false;
+        return 0;
     }
 
-    len = rb->chunk_len[idx];
+    size_t len = rb->chunk_len[idx];
+    size_t len_0 = 1 + rb->buffer_end - rb->chunk_start[idx];
 
-    if (rb->chunk_start[idx] + len <= rb->buffer_end) {
+    span[0].data = rb->chunk_start[idx];
+
+    if (len <= len_0) {
         /* chunk is continuous */
-        func(ctx, rb->chunk_start[idx], len);
-    } else {
-        /* chunk wraps around */
-        size_t len_0 = 1 + rb->buffer_end - rb->chunk_start[idx];
-        func(ctx, rb->chunk_start[idx], len_0);
-        func(ctx, rb->buffer, len - len_0);
+        span[0].len = len;
+        span[1].data = NULL;
+        span[1].len = 0;
+        return 1;
     }
 
-    return true;
+    /* chunk wraps around */
+    span[0].len = len_0;
+    span[1].data = rb->buffer;
+    span[1].len = len - len_0;
+    return 2;
+}
+
+bool crb_chunk_foreach(chunk_ringbuf_t *rb, crb_foreach_callback_t func, void *ctx)
+{
+    crb_span_t span[2];
+    unsigned parts = crb_get_chunk(rb, span);
+
+    for (unsigned i = 0; i < parts; ++i) {
+        func(ctx, span[i].data, span[i].len);
+    }
+
+    return parts > 0;
 }
 
 bool crb_consume_chunk(chunk_ringbuf_t *rb, void *dst, size_t len)
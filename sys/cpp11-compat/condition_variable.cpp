@@ -34,6 +34,108 @@ using namespace std::chrono;
 
 namespace riot {
 
+namespace {
+
+/* node data once the waiter was handed the mutex (wait morphing) */
+constexpr uintptr_t DATA_MORPHED = PRIORITY_QUEUE_DATA_SIGNALING - 1;
+/* node data once the timeout of the waiter expired */
+constexpr uintptr_t DATA_TIMEOUT = PRIORITY_QUEUE_DATA_SIGNALING - 2;
+
+struct waiter {
+  priority_queue_node_t node;
+  priority_queue_t* queue;
+  mutex_t* mutex;
+};
+
+inline bool queued(const waiter* w) {
+  return w->node.data < DATA_TIMEOUT;
+}
+
+/* Hands the mutex to the thread of a dequeued waiter or puts it on the wait
+ * queue of the mutex, so it does not wake up just to block on the mutex again.
+ * Returns the priority of the thread if it became runnable, -1 otherwise. */
+int signal(priority_queue_node_t* node) {
+  waiter* w = container_of(node, waiter, node);
+  thread_t* thread = thread_get(node->data);
+  if (!thread) {
+    node->data = PRIORITY_QUEUE_DATA_SIGNALING;
+    return -1;
+  }
+  if ((thread->status == STATUS_SLEEPING)
+      && mutex_requeue(w->mutex, thread)) {
+    node->data = DATA_MORPHED;
+    return (thread->status == STATUS_PENDING) ? thread->priority : -1;
+  }
+  sched_set_status(thread, STATUS_PENDING);
+  node->data = PRIORITY_QUEUE_DATA_SIGNALING;
+  return thread->priority;
+}
+
+void timeout_cb(void* arg) {
+  waiter* w = static_cast<waiter*>(arg);
+  unsigned old_state = irq_disable();
+  if (!queued(w)) {
+    /* notified first */
+    irq_restore(old_state);
+    return;
+  }
+  priority_queue_remove(w->queue, &w->node);
+  thread_t* thread = thread_get(w->node.data);
+  w->node.data = DATA_TIMEOUT;
+  if (thread && (thread->status == STATUS_SLEEPING)) {
+    sched_set_status(thread, STATUS_PENDING);
+    irq_restore(old_state);
+    sched_switch(thread->priority);
+    return;
+  }
+  irq_restore(old_state);
+}
+
+cv_status wait_on(priority_queue_t* queue, mutex_t* mutex,
+                  const uint64_t* deadline) {
+  thread_t* me = thread_get_active();
+  waiter w;
+  w.node.priority = me->priority;
+  w.node.data = me->pid;
+  w.node.next = NULL;
+  w.queue = queue;
+  w.mutex = mutex;
+  ztimer64_t timer = {};
+  timer.callback = timeout_cb;
+  timer.arg = &w;
+  // the signaling thread may not hold the mutex, the queue is not thread safe
+  unsigned old_state = irq_disable();
+  priority_queue_add(queue, &w.node);
+  if (deadline) {
+    ztimer64_set_at(ZTIMER64_USEC, &timer, *deadline);
+  }
+  if (queued(&w)) {
+    // go to sleep before releasing the mutex: a notification or timeout
+    // happening in between wakes us up or requeues us onto the mutex
+    sched_set_status(me, STATUS_SLEEPING);
+    irq_restore(old_state);
+    mutex_unlock(mutex);
+    thread_yield_higher();
+    old_state = irq_disable();
+  }
+  if (queued(&w)) {
+    // spurious wakeup
+    priority_queue_remove(queue, &w.node);
+    w.node.data = PRIORITY_QUEUE_DATA_SIGNALING;
+  }
+  irq_restore(old_state);
+  if (deadline) {
+    ztimer64_remove(ZTIMER64_USEC, &timer);
+  }
+  if (w.node.data != DATA_MORPHED) {
+    mutex_lock(mutex);
+  }
+  return (w.node.data == DATA_TIMEOUT) ? cv_status::timeout
+                                        : cv_status::no_timeout;
+}
+
+} // namespace
+
 condition_variable::~condition_variable() { m_queue.first = NULL; }
 
 void condition_variable::notify_one() noexcept {
@@ -41,12 +143,7 @@ void condition_variable::notify_one() noexcept {
   priority_queue_node_t* head = priority_queue_remove_head(&m_queue);
   int other_prio = -1;
   if (head != NULL) {
-    thread_t* other_thread = (thread_t*)sched_threads[head->data];
-    if (other_thread) {
-      other_prio = other_thread->priority;
-      sched_set_status(other_thread, STATUS_PENDING);
-    }
-    head->data = PRIORITY_QUEUE_DATA_SIGNALING;
+    other_prio = signal(head);
   }
   irq_restore(old_state);
   if (other_prio >= 0) {
@@ -62,14 +159,10 @@ void condition_variable::notify_all() noexcept {
     if (head == NULL) {
       break;
     }
-    thread_t* other_thread = (thread_t*)sched_threads[head->data];
-    if (other_thread) {
-      auto max_prio
-        = [](int a, int b) { return (a < 0) ? b : ((a < b) ? a : b); };
-      other_prio = max_prio(other_prio, other_thread->priority);
-      sched_set_status(other_thread, STATUS_PENDING);
+    int prio = signal(head);
+    if ((prio >= 0) && ((other_prio < 0) || (prio < other_prio))) {
+      other_prio = prio;
     }
-    head->data = PRIORITY_QUEUE_DATA_SIGNALING;
   }
   irq_restore(old_state);
   if (other_prio >= 0) {
@@ -78,40 +171,19 @@ void condition_variable::notify_all() noexcept {
 }
 
 void condition_variable::wait(unique_lock<mutex>& lock) noexcept {
-  priority_queue_node_t n;
-  n.priority = thread_get_active()->priority;
-  n.data = thread_getpid();
-  n.next = NULL;
-  // the signaling thread may not hold the mutex, the queue is not thread safe
-  unsigned old_state = irq_disable();
-  priority_queue_add(&m_queue, &n);
-  irq_restore(old_state);
-  mutex_unlock_and_sleep(lock.mutex()->native_handle());
-  if (n.data != PRIORITY_QUEUE_DATA_SIGNALING) {
-    // on signaling n.data is set to PRIORITY_QUEUE_DATA_SIGNALING
-    // if it isn't set, then the wakeup is either spurious or a timer wakeup
-    old_state = irq_disable();
-    priority_queue_remove(&m_queue, &n);
-    irq_restore(old_state);
-  }
-  mutex_lock(lock.mutex()->native_handle());
+  wait_on(&m_queue, lock.mutex()->native_handle(), nullptr);
 }
 
 cv_status condition_variable::wait_until(unique_lock<mutex>& lock,
                                          const time_point& timeout_time) {
-  ztimer64_t timer;
-  uint64_t total_timeout_time_us = timeout_time.microseconds();
-  total_timeout_time_us += timeout_time.seconds() * US_PER_SEC;
-
-  ztimer64_set_wakeup_at(ZTIMER64_USEC, &timer, total_timeout_time_us,
-                         thread_getpid());
-  wait(lock);
-  if (ztimer64_now(ZTIMER64_USEC) >= total_timeout_time_us) {
-    ztimer64_remove(ZTIMER64_USEC, &timer);
-    return cv_status::timeout;
-  }
-  ztimer64_remove(ZTIMER64_USEC, &timer);
-  return cv_status::no_timeout;
+  uint64_t deadline = timeout_time.microseconds();
+  deadline += timeout_time.seconds() * US_PER_SEC;
+  return wait_until_us(lock, deadline);
+}
+
+cv_status condition_variable::wait_until_us(unique_lock<mutex>& lock,
+                                            uint64_t deadline) {
+  return wait_on(&m_queue, lock.mutex()->native_handle(), &deadline);
 }
 
 } // namespace riot
@@ -140,6 +140,8 @@ private:
   condition_variable(const condition_variable&);
   condition_variable& operator=(const condition_variable&);
 
+  cv_status wait_until_us(unique_lock<mutex>& lock, uint64_t deadline);
+
   priority_queue_t m_queue;
 };
 
@@ -171,18 +173,8 @@ cv_status condition_variable::wait_for(unique_lock<mutex>& lock,
   if (timeout_duration <= timeout_duration.zero()) {
     return cv_status::timeout;
   }
-  uint64_t timeout, before, after;
-  timeout = (duration_cast<microseconds>(timeout_duration)).count();
-  before = ztimer64_now(ZTIMER64_USEC);
-  ztimer64_t timer;
-  ztimer64_set_wakeup(ZTIMER64_USEC, &timer, timeout, thread_getpid());
-  wait(lock);
-  after = ztimer64_now(ZTIMER64_USEC);
-  ztimer64_remove(ZTIMER64_USEC, &timer);
-  if (after - before >= timeout) {
-    return cv_status::timeout;
-  }
-  return cv_status::no_timeout;
+  uint64_t timeout = duration_cast<microseconds>(timeout_duration).count();
+  return wait_until_us(lock, ztimer64_now(ZTIMER64_USEC) + timeout);
 }
 
 template <class Rep, class Period, class Predicate>
@@ -25,7 +25,9 @@
 #define RIOT_MUTEX_HPP
 
 #include "mutex.h"
+#include "riot/chrono.hpp"
 
+#include <chrono>
 #include <utility>
 #include <stdexcept>
 #include <system_error>
@@ -59,6 +61,17 @@ public:
    * @return `true` if the mutex was locked, `false` otherwise.
    */
   bool try_lock() noexcept;
+  /**
+   * @brief Try to lock the mutex, blocking for at most @p timeout_duration.
+   * @return `true` if the mutex was locked, `false` on timeout.
+   */
+  template <class Rep, class Period>
+  bool try_lock_for(const std::chrono::duration<Rep, Period>& timeout_duration);
+  /**
+   * @brief Try to lock the mutex, blocking until @p timeout_time at most.
+   * @return `true` if the mutex was locked, `false` on timeout.
+   */
+  bool try_lock_until(const time_point& timeout_time);
   /**
    * @brief Unlock the mutex.
    */
@@ -74,9 +87,22 @@ private:
   mutex(const mutex&);
   mutex& operator=(const mutex&);
 
+  bool try_lock_until_us(uint64_t deadline);
+
   mutex_t m_mtx;
 };
 
+template <class Rep, class Period>
+bool mutex::try_lock_for(const std::chrono::duration<Rep, Period>&
+                         timeout_duration) {
+  using namespace std::chrono;
+  if (timeout_duration <= timeout_duration.zero()) {
+    return try_lock();
+  }
+  uint64_t timeout = duration_cast<microseconds>(timeout_duration).count();
+  return try_lock_until_us(ztimer64_now(ZTIMER64_USEC) + timeout);
+}
+
 /**
  * @brief Tag type for defer lock strategy.
  */
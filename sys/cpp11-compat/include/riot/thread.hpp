@@ -24,11 +24,14 @@
 #ifndef RIOT_THREAD_HPP
 #define RIOT_THREAD_HPP
 
+#include "irq.h"
 #include "time.h"
 #include "thread.h"
 
-#include <array>
+#include <new>
 #include <tuple>
+#include <cstddef>
+#include <cstdint>
 #include <atomic>
 #include <memory>
 #include <utility>
@@ -47,15 +50,19 @@ namespace riot {
 
 /**
  * @brief Holds context data for the thread.
+ *
+ * The context data is placed at the top of the stack of the thread, so
+ * creating a thread requires at most one allocation for the stack.
  */
 struct thread_data {
-  thread_data() : ref_count{2}, joining_thread{KERNEL_PID_UNDEF} {
+  explicit thread_data(char* heap_stack = nullptr)
+    : ref_count{2}, joining_thread{KERNEL_PID_UNDEF}, heap_stack{heap_stack} {
     // nop
   }
   /** @cond INTERNAL */
   std::atomic<unsigned> ref_count;
   kernel_pid_t joining_thread;
-  std::array<char, THREAD_STACKSIZE_MAIN> stack;
+  char* heap_stack;
   /** @endcond */
 };
 
@@ -70,11 +77,103 @@ struct thread_data_deleter {
    */
   void operator()(thread_data* ptr) {
     if (--ptr->ref_count == 0) {
-      delete ptr;
+      // the thread data lives on the stack, which may be owned by the thread
+      char* heap_stack = ptr->heap_stack;
+      ptr->~thread_data();
+      delete[] heap_stack;
     }
   }
 };
 
+/**
+ * @brief Statically allocatable stack for a thread.
+ *
+ * Use as static or member variable and pass it to @ref thread_attributes to
+ * create a thread without any heap allocation.
+ *
+ * @tparam StackSize    Size of the stack in bytes, including the space needed
+ *                      for the functor, its arguments and the thread context.
+ */
+template <std::size_t StackSize>
+struct thread_stack {
+  /** @cond INTERNAL */
+  alignas(std::max_align_t) char data[StackSize];
+  /** @endcond */
+};
+
+/**
+ * @brief Attributes of a thread created by @ref thread, which are not covered
+ *        by the std::thread interface.
+ *
+ * Per default, a stack of `THREAD_STACKSIZE_MAIN` bytes is allocated on the
+ * heap and the thread runs at `THREAD_PRIORITY_MAIN - 1`, just like a thread
+ * constructed without attributes.
+ *
+ * A caller-provided stack must stay valid until the thread was joined or, for
+ * detached threads, until the thread terminated and the @ref thread object was
+ * destroyed. Afterwards, it can be reused for another thread.
+ *
+ * @code{.cpp}
+ * static riot::thread_stack<1024> worker_stack;
+ *
+ * riot::thread t{riot::thread_attributes{worker_stack}.priority(5).name("worker"),
+ *                [] { ... }};
+ * @endcode
+ */
+class thread_attributes {
+  friend class thread;
+
+public:
+  /**
+   * @brief Use a heap allocated stack of `THREAD_STACKSIZE_MAIN` bytes.
+   */
+  thread_attributes() noexcept = default;
+  /**
+   * @brief Use caller-provided memory as stack.
+   * @param[in] stack       Start of the stack.
+   * @param[in] stack_size  Size of the stack in bytes.
+   */
+  thread_attributes(char* stack, std::size_t stack_size) noexcept
+    : m_stack{stack}, m_stack_size{stack_size} {}
+  /**
+   * @brief Use a @ref thread_stack as stack.
+   * @param[in] stack       Stack to use.
+   */
+  template <std::size_t StackSize>
+  thread_attributes(thread_stack<StackSize>& stack) noexcept
+    : m_stack{stack.data}, m_stack_size{StackSize} {}
+
+  /**
+   * @brief Set the priority of the thread.
+   */
+  thread_attributes& priority(uint8_t priority) noexcept {
+    m_priority = priority;
+    return *this;
+  }
+  /**
+   * @brief Set flags passed to thread_create(), e.g. `THREAD_CREATE_STACKTEST`.
+   */
+  thread_attributes& flags(int flags) noexcept {
+    m_flags = flags;
+    return *this;
+  }
+  /**
+   * @brief Set the name of the thread, the string must stay valid as long as
+   *        the thread exists.
+   */
+  thread_attributes& name(const char* name) noexcept {
+    m_name = name;
+    return *this;
+  }
+
+private:
+  char* m_stack = nullptr;
+  std::size_t m_stack_size = THREAD_STACKSIZE_MAIN;
+  uint8_t m_priority = THREAD_PRIORITY_MAIN - 1;
+  int m_flags = 0;
+  const char* m_name = "riot_cpp_thread";
+};
+
 /**
  * @brief implementation of thread::id
  * @see   <a href="http://en.cppreference.com/w/cpp/thread/thread/id">
@@ -231,8 +330,25 @@ public:
    * @param[in] f     Functor to run as a thread.
    * @param[in] args  Arguments passed to the functor.
    */
+  template <class F, class... Args,
+            class = typename std::enable_if<!std::is_same<
+              typename std::decay<F>::type, thread_attributes>::value>::type>
+  explicit thread(F&& f, Args&&... args)
+    : thread{thread_attributes{}, std::forward<F>(f),
+             std::forward<Args>(args)...} {}
+  /**
+   * @brief Create a thread with the given stack, priority and name from a
+   *        functor and arguments for it.
+   * @param[in] attr  Attributes of the thread.
+   * @param[in] f     Functor to run as a thread.
+   * @param[in] args  Arguments passed to the functor.
+   * @throws std::system_error  with `std::errc::invalid_argument` if the stack
+   *                            is too small or
+   *                            `std::errc::resource_unavailable_try_again` if
+   *                            the thread could not be created.
+   */
   template <class F, class... Args>
-  explicit thread(F&& f, Args&&... args);
+  thread(const thread_attributes& attr, F&& f, Args&&... args);
 
   /**
    * @brief Disallow copy constructor.
@@ -317,20 +433,31 @@ void swap(thread& lhs, thread& rhs) noexcept;
 /** @cond INTERNAL */
 template <class Tuple>
 void* thread_proxy(void* vp) {
-  { // without this scope, the objects here are not cleaned up correctly
-    std::unique_ptr<Tuple> p(static_cast<Tuple*>(vp));
-    auto tmp = std::get<0>(*p);
-    std::unique_ptr<thread_data, thread_data_deleter> data{tmp};
-    // create indices for the arguments, 0 is thread_data and 1 is the function
-    auto indices = detail::get_indices<std::tuple_size<Tuple>::value, 2>();
-    try {
-      detail::apply_args(std::get<1>(*p), indices, *p);
-    }
-    catch (...) {
-      // nop
-    }
-    if (data->joining_thread != KERNEL_PID_UNDEF) {
-      thread_wakeup(data->joining_thread);
+  auto p = static_cast<Tuple*>(vp);
+  thread_data* data = std::get<0>(*p);
+  // create indices for the arguments, 0 is thread_data and 1 is the function
+  auto indices = detail::get_indices<std::tuple_size<Tuple>::value, 2>();
+  try {
+    detail::apply_args(std::get<1>(*p), indices, *p);
+  }
+  catch (...) {
+    // nop
+  }
+  // the tuple was placed on the stack of this thread by the constructor
+  p->~Tuple();
+  // The joining thread must not run before this thread is gone, as it may
+  // reuse the stack. Waking it up with IRQs disabled defers the context switch
+  // to sched_task_exit().
+  irq_disable();
+  kernel_pid_t joining_thread = data->joining_thread;
+  if (data->ref_count == 1) {
+    // the thread object is gone, nobody can join anymore
+    irq_enable();
+    thread_data_deleter{}(data);
+  } else {
+    --data->ref_count;
+    if (joining_thread != KERNEL_PID_UNDEF) {
+      thread_wakeup(joining_thread);
     }
   }
   // some riot cleanup code
@@ -340,18 +467,37 @@ void* thread_proxy(void* vp) {
 /** @endcond */
 
 template <class F, class... Args>
-thread::thread(F&& f, Args&&... args) : m_data{new thread_data} {
+thread::thread(const thread_attributes& attr, F&& f, Args&&... args) {
   using namespace std;
   using func_and_args = tuple
     <thread_data*, typename decay<F>::type, typename decay<Args>::type...>;
-  unique_ptr<func_and_args> p(
-    new func_and_args(m_data.get(), std::forward<F>(f), std::forward<Args>(args)...));
-  m_handle = thread_create(
-    m_data->stack.data(), m_data->stack.size(), THREAD_PRIORITY_MAIN - 1, 0,
-    &thread_proxy<func_and_args>, p.get(), "riot_cpp_thread");
-  if (m_handle >= 0) {
-    p.release();
-  } else {
+  char* heap_stack = nullptr;
+  char* stack = attr.m_stack;
+  if (!stack) {
+    stack = heap_stack = new char[attr.m_stack_size];
+  }
+  // place the thread data and the functor with its arguments at the top of
+  // the stack, below the thread control block thread_create() puts there
+  uintptr_t top = reinterpret_cast<uintptr_t>(stack) + attr.m_stack_size;
+  top = (top - sizeof(func_and_args)) & ~(alignof(func_and_args) - 1);
+  auto p = reinterpret_cast<func_and_args*>(top);
+  top = (top - sizeof(thread_data)) & ~(alignof(thread_data) - 1);
+  auto data = reinterpret_cast<thread_data*>(top);
+  uintptr_t stack_size = top - reinterpret_cast<uintptr_t>(stack);
+  if (top < reinterpret_cast<uintptr_t>(stack)
+      || stack_size < THREAD_STACKSIZE_MINIMUM) {
+    delete[] heap_stack;
+    throw std::system_error(std::make_error_code(std::errc::invalid_argument),
+                            "Stack too small for thread.");
+  }
+  m_data.reset(new (data) thread_data{heap_stack});
+  new (p) func_and_args(data, std::forward<F>(f), std::forward<Args>(args)...);
+  m_handle = thread_create(stack, stack_size, attr.m_priority, attr.m_flags,
+                           &thread_proxy<func_and_args>, p, attr.m_name);
+  if (m_handle < 0) {
+    p->~func_and_args();
+    // the thread will never release its reference
+    --m_data->ref_count;
     throw std::system_error(
       std::make_error_code(std::errc::resource_unavailable_try_again),
         "Failed to create thread.");
@@ -18,6 +18,9 @@
  * @}
  */
 
+#include "time_units.h"
+#include "ztimer64.h"
+
 #include "riot/mutex.hpp"
 
 namespace riot {
@@ -30,6 +33,28 @@ void mutex::lock() { mutex_lock(&m_mtx); }
 
 bool mutex::try_lock() noexcept { return (1 == mutex_trylock(&m_mtx)); }
 
+bool mutex::try_lock_until(const time_point& timeout_time) {
+  uint64_t deadline = timeout_time.microseconds();
+  deadline += timeout_time.seconds() * US_PER_SEC;
+  return try_lock_until_us(deadline);
+}
+
+bool mutex::try_lock_until_us(uint64_t deadline) {
+  // same as ztimer_mutex_lock_timeout(), but with an absolute 64 bit deadline
+  mutex_cancel_t mc = mutex_cancel_init(&m_mtx);
+  ztimer64_t timer = {};
+  timer.callback = [](void* arg) {
+    mutex_cancel(static_cast<mutex_cancel_t*>(arg));
+  };
+  timer.arg = &mc;
+  ztimer64_set_at(ZTIMER64_USEC, &timer, deadline);
+  if (mutex_lock_cancelable(&mc)) {
+    return false;
+  }
+  ztimer64_remove(ZTIMER64_USEC, &timer);
+  return true;
+}
+
 void mutex::unlock() noexcept { mutex_unlock(&m_mtx); }
 
 } // namespace riot
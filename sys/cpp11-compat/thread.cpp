@@ -20,6 +20,8 @@
 #include <cerrno>
 #include <system_error>
 
+#include "irq.h"
+#include "sched.h"
 #include "ztimer64.h"
 #include "riot/thread.hpp"
 
@@ -39,12 +41,21 @@ void thread::join() {
                        "Joining this leads to a deadlock.");
   }
   if (joinable()) {
+    // the thread must not terminate between checking its status and going
+    // to sleep, or there is nobody to wake us up
+    unsigned state = irq_disable();
     auto status = thread_getstatus(m_handle);
     if (status != STATUS_NOT_FOUND && status != STATUS_STOPPED) {
       m_data->joining_thread = thread_getpid();
-      thread_sleep();
+      sched_set_status(thread_get_active(), STATUS_SLEEPING);
+      irq_restore(state);
+      thread_yield_higher();
+    } else {
+      irq_restore(state);
     }
     m_handle = KERNEL_PID_UNDEF;
+    // the thread is gone, allow reusing a caller-provided stack
+    m_data.reset();
   } else {
     throw system_error(make_error_code(errc::invalid_argument),
                        "Can not join an unjoinable thread.");
@@ -0,0 +1,624 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup cpp_coro
+ * @{
+ *
+ * @file
+ * @brief   C++20 coroutine tasks executed by an event queue
+ *
+ * @author  RIOT developers <devel@riot-os.org>
+ */
+
+#ifndef RIOT_CORO_HPP
+#define RIOT_CORO_HPP
+
+#include <cassert>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "event.h"
+#include "irq.h"
+#include "memarray.h"
+#include "ztimer.h"
+
+/**
+ * @brief Size of a block for a coroutine frame in bytes
+ *
+ * The frame holds the parameters and all local variables of a coroutine that
+ * live across a suspension point, including the awaitables.
+ */
+#ifndef CONFIG_CPP_CORO_FRAME_SIZE
+#define CONFIG_CPP_CORO_FRAME_SIZE  (256)
+#endif
+
+/**
+ * @brief Number of coroutine frames that can exist at the same time
+ *
+ * Each task awaiting another task needs one frame for each.
+ */
+#ifndef CONFIG_CPP_CORO_FRAME_NUMOF
+#define CONFIG_CPP_CORO_FRAME_NUMOF (8)
+#endif
+
+namespace riot::coro {
+
+/** @cond INTERNAL */
+namespace detail {
+
+/**
+ * @brief Fixed size memory pool for the frames of all coroutines
+ */
+class frame_pool {
+public:
+  frame_pool() noexcept {
+    memarray_init(&m_pool, m_frames, sizeof(frame),
+                  CONFIG_CPP_CORO_FRAME_NUMOF);
+  }
+
+  void* alloc(std::size_t size) noexcept {
+    if (size > sizeof(frame)) {
+      return nullptr;
+    }
+    unsigned state = irq_disable();
+    void* ptr = memarray_alloc(&m_pool);
+    irq_restore(state);
+    return ptr;
+  }
+
+  void free(void* ptr) noexcept {
+    unsigned state = irq_disable();
+    memarray_free(&m_pool, ptr);
+    irq_restore(state);
+  }
+
+  std::size_t available() noexcept {
+    unsigned state = irq_disable();
+    std::size_t n = memarray_available(&m_pool);
+    irq_restore(state);
+    return n;
+  }
+
+private:
+  struct frame {
+    alignas(__STDCPP_DEFAULT_NEW_ALIGNMENT__)
+      unsigned char data[CONFIG_CPP_CORO_FRAME_SIZE];
+  };
+  memarray_t m_pool;
+  frame m_frames[CONFIG_CPP_CORO_FRAME_NUMOF];
+};
+
+inline frame_pool frames;
+
+/**
+ * @brief Event resuming a coroutine from the thread running the queue
+ */
+struct resume_event : event_t {
+  resume_event() noexcept : event_t{} {
+    handler = [](event_t* ev) {
+      static_cast<resume_event*>(ev)->handle.resume();
+    };
+  }
+  std::coroutine_handle<> handle;
+};
+
+} // namespace detail
+/** @endcond */
+
+/**
+ * @brief Number of coroutine frames that are currently available
+ */
+inline std::size_t frames_available() noexcept {
+  return detail::frames.available();
+}
+
+template <class T>
+class task;
+
+template <class T>
+bool spawn(event_queue_t* queue, task<T>&& t) noexcept;
+
+/**
+ * @brief Part of the promise of all tasks used by the awaitables
+ */
+class promise_base {
+  template <class T>
+  friend class task;
+  template <class T>
+  friend bool spawn(event_queue_t* queue, task<T>&& t) noexcept;
+
+public:
+  /**
+   * @brief Allocate a coroutine frame from the pool.
+   * @return  `nullptr` if the pool is exhausted or the frame is too large.
+   */
+  static void* operator new(std::size_t size) noexcept {
+    return detail::frames.alloc(size);
+  }
+  /**
+   * @brief Return a coroutine frame to the pool.
+   */
+  static void operator delete(void* ptr) noexcept {
+    detail::frames.free(ptr);
+  }
+
+  /**
+   * @brief Tasks start when spawned or awaited.
+   */
+  std::suspend_always initial_suspend() noexcept { return {}; }
+  /**
+   * @brief Exceptions must not leave a task.
+   */
+  void unhandled_exception() noexcept { std::terminate(); }
+
+  /**
+   * @brief Resume the task from the thread running its queue.
+   *
+   * @note  This can be called from ISR context, but only once per suspension.
+   */
+  void resume_later() noexcept { event_post(m_queue, &m_event); }
+  /**
+   * @brief The queue the task runs on.
+   */
+  event_queue_t* queue() const noexcept { return m_queue; }
+
+protected:
+  /** @cond INTERNAL */
+  detail::resume_event m_event;
+  event_queue_t* m_queue = nullptr;
+  std::coroutine_handle<> m_continuation;
+  /** @endcond */
+};
+
+/** @cond INTERNAL */
+namespace detail {
+
+template <class T>
+class promise_result {
+public:
+  template <class U>
+  void return_value(U&& value) {
+    if (m_result) {
+      m_result->emplace(std::forward<U>(value));
+    }
+  }
+
+protected:
+  std::optional<T>* m_result = nullptr;
+};
+
+template <>
+class promise_result<void> {
+public:
+  void return_void() noexcept {}
+};
+
+template <class Promise>
+struct final_awaiter {
+  bool await_ready() noexcept { return false; }
+  std::coroutine_handle<>
+  await_suspend(std::coroutine_handle<Promise> h) noexcept {
+    std::coroutine_handle<> continuation = h.promise().m_continuation;
+    h.destroy();
+    if (continuation) {
+      return continuation;
+    }
+    return std::noop_coroutine();
+  }
+  void await_resume() noexcept {}
+};
+
+} // namespace detail
+/** @endcond */
+
+/**
+ * @brief   Coroutine running on an event queue
+ *
+ * A task is either passed to spawn() to run independently or awaited by
+ * another task, which then continues with the result once the awaited task
+ * returned. Its frame is released as soon as the coroutine returns.
+ *
+ * @tparam T    Type of the value returned by `co_return`
+ */
+template <class T = void>
+class task {
+public:
+  /**
+   * @brief Promise type of the coroutine.
+   */
+  class promise_type : public promise_base,
+                       public detail::promise_result<T> {
+    friend class task;
+    friend struct detail::final_awaiter<promise_type>;
+
+  public:
+    /**
+     * @brief Called if the frame could not be allocated.
+     */
+    static task get_return_object_on_allocation_failure() noexcept {
+      return task{nullptr};
+    }
+    /**
+     * @brief Create the task object returned to the caller.
+     */
+    task get_return_object() noexcept {
+      auto h = std::coroutine_handle<promise_type>::from_promise(*this);
+      m_event.handle = h;
+      return task{h};
+    }
+    /**
+     * @brief Release the frame and continue with the awaiting task, if any.
+     */
+    detail::final_awaiter<promise_type> final_suspend() noexcept {
+      return {};
+    }
+  };
+
+  task(task&& other) noexcept
+    : m_handle{std::exchange(other.m_handle, nullptr)} {}
+  task& operator=(task&& other) noexcept {
+    std::swap(m_handle, other.m_handle);
+    return *this;
+  }
+  task(const task&) = delete;
+  task& operator=(const task&) = delete;
+
+  /**
+   * @brief Destroy the task, if it was neither spawned nor awaited.
+   */
+  ~task() {
+    if (m_handle) {
+      m_handle.destroy();
+    }
+  }
+
+  /**
+   * @brief Check if the frame of the coroutine could be allocated.
+   */
+  explicit operator bool() const noexcept { return bool(m_handle); }
+
+  /**
+   * @brief Awaiter running a task to completion.
+   */
+  class awaiter {
+  public:
+    /** @cond INTERNAL */
+    explicit awaiter(std::coroutine_handle<promise_type> h) noexcept
+      : m_handle{h} {
+      // awaiting a task whose frame could not be allocated is fatal
+      assert(bool(m_handle));
+    }
+    /** @endcond */
+
+    bool await_ready() const noexcept { return false; }
+
+    template <class P>
+    std::coroutine_handle<>
+    await_suspend(std::coroutine_handle<P> parent) noexcept {
+      promise_type& p = m_handle.promise();
+      p.m_queue = parent.promise().queue();
+      p.m_continuation = parent;
+      if constexpr (!std::is_void_v<T>) {
+        p.m_result = &m_result;
+      }
+      return m_handle;
+    }
+
+    T await_resume() {
+      if constexpr (!std::is_void_v<T>) {
+        return std::move(*m_result);
+      }
+    }
+
+  private:
+    std::coroutine_handle<promise_type> m_handle;
+    struct empty {};
+    [[no_unique_address]] std::conditional_t<std::is_void_v<T>, empty,
+                                             std::optional<T>> m_result;
+  };
+
+  /**
+   * @brief Run the task as part of the awaiting task.
+   */
+  awaiter operator co_await() && noexcept {
+    return awaiter{std::exchange(m_handle, nullptr)};
+  }
+
+private:
+  template <class U>
+  friend bool spawn(event_queue_t* queue, task<U>&& t) noexcept;
+
+  explicit task(std::coroutine_handle<promise_type> h) noexcept
+    : m_handle{h} {}
+
+  std::coroutine_handle<promise_type> m_handle;
+};
+
+/**
+ * @brief Run a task independently on an event queue.
+ *
+ * The task starts once the thread running @p queue processes its next event.
+ * The value returned by the task, if any, is discarded.
+ *
+ * @param[in] queue     Queue to run the task on.
+ * @param[in] t         Task to run.
+ *
+ * @retval  true        The task was started.
+ * @retval  false       The frame of the task could not be allocated.
+ */
+template <class T>
+bool spawn(event_queue_t* queue, task<T>&& t) noexcept {
+  if (!t.m_handle) {
+    return false;
+  }
+  auto h = std::exchange(t.m_handle, nullptr);
+  h.promise().m_queue = queue;
+  h.promise().resume_later();
+  return true;
+}
+
+/**
+ * @brief Let other events of the queue run before continuing.
+ *
+ * @code{.cpp}
+ * co_await riot::coro::yield();
+ * @endcode
+ */
+class yield {
+public:
+  /** @cond INTERNAL */
+  bool await_ready() const noexcept { return false; }
+  template <class P>
+  void await_suspend(std::coroutine_handle<P> h) noexcept {
+    h.promise().resume_later();
+  }
+  void await_resume() const noexcept {}
+  /** @endcond */
+};
+
+/**
+ * @brief Suspend the task for the given duration.
+ *
+ * @code{.cpp}
+ * co_await riot::coro::sleep(ZTIMER_MSEC, 100);
+ * @endcode
+ */
+class sleep {
+public:
+  /**
+   * @brief Sleep for @p duration ticks of @p clock.
+   */
+  sleep(ztimer_clock_t* clock, uint32_t duration) noexcept
+    : m_clock{clock}, m_duration{duration} {}
+
+  /** @cond INTERNAL */
+  bool await_ready() const noexcept { return m_duration == 0; }
+  template <class P>
+  void await_suspend(std::coroutine_handle<P> h) noexcept {
+    m_timer.callback = [](void* arg) {
+      static_cast<promise_base*>(arg)->resume_later();
+    };
+    m_timer.arg = static_cast<promise_base*>(&h.promise());
+    ztimer_set(m_clock, &m_timer, m_duration);
+  }
+  void await_resume() const noexcept {}
+  /** @endcond */
+
+private:
+  ztimer_clock_t* m_clock;
+  uint32_t m_duration;
+  ztimer_t m_timer{};
+};
+
+/**
+ * @brief Mutual exclusion between tasks
+ *
+ * Waiting for the mutex suspends the task instead of blocking the thread.
+ * Tasks are granted the mutex in the order they started waiting.
+ *
+ * @note    This cannot be used to synchronize with threads, as there is no way
+ *          to get notified when a `mutex_t` is unlocked.
+ */
+class mutex {
+public:
+  /**
+   * @brief Awaiter for acquiring the mutex.
+   */
+  class lock_awaiter {
+    friend class mutex;
+
+  public:
+    /** @cond INTERNAL */
+    explicit lock_awaiter(mutex& m) noexcept : m_mutex{m} {}
+    bool await_ready() noexcept { return m_mutex.try_lock(); }
+    template <class P>
+    bool await_suspend(std::coroutine_handle<P> h) noexcept {
+      m_promise = &h.promise();
+      return m_mutex._enqueue(this);
+    }
+    void await_resume() const noexcept {}
+    /** @endcond */
+
+  private:
+    mutex& m_mutex;
+    promise_base* m_promise = nullptr;
+    lock_awaiter* m_next = nullptr;
+  };
+
+  mutex() noexcept = default;
+  mutex(const mutex&) = delete;
+  mutex& operator=(const mutex&) = delete;
+
+  /**
+   * @brief Wait until the mutex is acquired.
+   *
+   * @code{.cpp}
+   * co_await m.lock();
+   * ...
+   * m.unlock();
+   * @endcode
+   */
+  lock_awaiter lock() noexcept { return lock_awaiter{*this}; }
+
+  /**
+   * @brief Acquire the mutex, if it is unlocked.
+   * @return  `true` if the mutex was acquired.
+   */
+  bool try_lock() noexcept {
+    unsigned state = irq_disable();
+    bool acquired = !m_locked;
+    m_locked = true;
+    irq_restore(state);
+    return acquired;
+  }
+
+  /**
+   * @brief Unlock the mutex and pass it on to the next waiting task.
+   */
+  void unlock() noexcept {
+    unsigned state = irq_disable();
+    assert(m_locked);
+    lock_awaiter* next = m_head;
+    if (next) {
+      m_head = next->m_next;
+      if (!m_head) {
+        m_tail = nullptr;
+      }
+      // the mutex stays locked and is owned by the resumed task
+      next->m_promise->resume_later();
+    } else {
+      m_locked = false;
+    }
+    irq_restore(state);
+  }
+
+private:
+  bool _enqueue(lock_awaiter* waiter) noexcept {
+    unsigned state = irq_disable();
+    if (!m_locked) {
+      // unlocked in the meantime
+      m_locked = true;
+      irq_restore(state);
+      return false;
+    }
+    if (m_tail) {
+      m_tail->m_next = waiter;
+    } else {
+      m_head = waiter;
+    }
+    m_tail = waiter;
+    irq_restore(state);
+    return true;
+  }
+
+  bool m_locked = false;
+  lock_awaiter* m_head = nullptr;
+  lock_awaiter* m_tail = nullptr;
+};
+
+/**
+ * @brief Flags to signal a task, resembling thread flags
+ *
+ * Flags can be set from any context, including ISRs. At most one task may wait
+ * on a flags object at a time.
+ */
+class flags {
+public:
+  /**
+   * @brief Type of the flags, same as `thread_flags_t`.
+   */
+  using flags_t = uint16_t;
+
+  /**
+   * @brief Awaiter for any of the given flags to be set.
+   */
+  class wait_awaiter {
+  public:
+    /** @cond INTERNAL */
+    wait_awaiter(flags& f, flags_t mask) noexcept : m_flags{f}, m_mask{mask} {}
+    bool await_ready() const noexcept {
+      return (m_flags.m_flags & m_mask) != 0;
+    }
+    template <class P>
+    bool await_suspend(std::coroutine_handle<P> h) noexcept {
+      unsigned state = irq_disable();
+      bool suspend = (m_flags.m_flags & m_mask) == 0;
+      if (suspend) {
+        assert(!m_flags.m_waiter);
+        m_flags.m_waiter = &h.promise();
+        m_flags.m_waiting = m_mask;
+      }
+      irq_restore(state);
+      return suspend;
+    }
+    flags_t await_resume() noexcept {
+      unsigned state = irq_disable();
+      flags_t result = m_flags.m_flags & m_mask;
+      m_flags.m_flags &= ~result;
+      irq_restore(state);
+      return result;
+    }
+    /** @endcond */
+
+  private:
+    flags& m_flags;
+    flags_t m_mask;
+  };
+
+  flags() noexcept = default;
+  flags(const flags&) = delete;
+  flags& operator=(const flags&) = delete;
+
+  /**
+   * @brief Set flags and resume the waiting task, if it waits for one of them.
+   */
+  void set(flags_t mask) noexcept {
+    unsigned state = irq_disable();
+    m_flags |= mask;
+    if (m_waiter && (m_flags & m_waiting)) {
+      std::exchange(m_waiter, nullptr)->resume_later();
+    }
+    irq_restore(state);
+  }
+
+  /**
+   * @brief Clear flags.
+   * @return  The flags of @p mask that were set.
+   */
+  flags_t clear(flags_t mask) noexcept {
+    unsigned state = irq_disable();
+    flags_t result = m_flags & mask;
+    m_flags &= ~mask;
+    irq_restore(state);
+    return result;
+  }
+
+  /**
+   * @brief Wait until any of the flags in @p mask is set.
+   *
+   * The awaiter evaluates to the flags of @p mask that were set, which are
+   * cleared.
+   */
+  wait_awaiter wait_any(flags_t mask) noexcept { return {*this, mask}; }
+
+private:
+  flags_t m_flags = 0;
+  flags_t m_waiting = 0;
+  promise_base* m_waiter = nullptr;
+};
+
+} // namespace riot::coro
+
+#endif // RIOT_CORO_HPP
+/** @} */
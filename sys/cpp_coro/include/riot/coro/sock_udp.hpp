@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup cpp_coro
+ * @{
+ *
+ * @file
+ * @brief   Awaitable UDP sock based on `sock_async_event`
+ *
+ * @author  RIOT developers <devel@riot-os.org>
+ */
+
+#ifndef RIOT_CORO_SOCK_UDP_HPP
+#define RIOT_CORO_SOCK_UDP_HPP
+
+#include <cerrno>
+#include <cstddef>
+#include <sys/types.h>
+
+#include "net/sock/udp.h"
+#include "net/sock/async/event.h"
+#include "riot/coro.hpp"
+
+namespace riot::coro {
+
+/**
+ * @brief Wrapper around a `sock_udp_t` to receive from tasks
+ *
+ * At most one task may wait for data at a time. The tasks using the sock must
+ * run on the queue passed to the constructor.
+ */
+class udp_sock {
+public:
+  /**
+   * @brief Awaiter for data on the sock.
+   */
+  class recv_awaiter {
+  public:
+    /** @cond INTERNAL */
+    recv_awaiter(udp_sock& sock, void* data, std::size_t max_len,
+                 sock_udp_ep_t* remote) noexcept
+      : m_sock{sock}, m_data{data}, m_max_len{max_len}, m_remote{remote} {}
+    bool await_ready() noexcept {
+      m_res = _recv();
+      return m_res != -EAGAIN;
+    }
+    template <class P>
+    void await_suspend(std::coroutine_handle<P> h) noexcept {
+      m_sock.m_waiter = &h.promise();
+    }
+    ssize_t await_resume() noexcept {
+      if (m_res == -EAGAIN) {
+        m_res = _recv();
+      }
+      return m_res;
+    }
+    /** @endcond */
+
+  private:
+    ssize_t _recv() noexcept {
+      return sock_udp_recv(m_sock.m_sock, m_data, m_max_len, 0, m_remote);
+    }
+
+    udp_sock& m_sock;
+    void* m_data;
+    std::size_t m_max_len;
+    sock_udp_ep_t* m_remote;
+    ssize_t m_res = 0;
+  };
+
+  /**
+   * @brief Receive asynchronous events of @p sock on @p queue.
+   * @param[in] sock    A created UDP sock.
+   * @param[in] queue   Queue of the tasks using the sock.
+   */
+  udp_sock(sock_udp_t* sock, event_queue_t* queue) noexcept : m_sock{sock} {
+    sock_udp_event_init(sock, queue, _cb, this);
+  }
+  udp_sock(const udp_sock&) = delete;
+  udp_sock& operator=(const udp_sock&) = delete;
+
+  /**
+   * @brief Wait for a datagram.
+   *
+   * The awaiter evaluates to the result of sock_udp_recv().
+   *
+   * @code{.cpp}
+   * ssize_t res = co_await sock.recv(buf, sizeof(buf), &remote);
+   * @endcode
+   */
+  recv_awaiter recv(void* data, std::size_t max_len,
+                    sock_udp_ep_t* remote = nullptr) noexcept {
+    return {*this, data, max_len, remote};
+  }
+
+  /**
+   * @brief Send a datagram, see sock_udp_send().
+   */
+  ssize_t send(const void* data, std::size_t len,
+               const sock_udp_ep_t* remote = nullptr) noexcept {
+    return sock_udp_send(m_sock, data, len, remote);
+  }
+
+private:
+  static void _cb(sock_udp_t*, sock_async_flags_t type, void* arg) {
+    auto self = static_cast<udp_sock*>(arg);
+    if ((type & SOCK_ASYNC_MSG_RECV) && self->m_waiter) {
+      std::exchange(self->m_waiter, nullptr)->resume_later();
+    }
+  }
+
+  sock_udp_t* m_sock;
+  promise_base* m_waiter = nullptr;
+};
+
+} // namespace riot::coro
+
+#endif // RIOT_CORO_SOCK_UDP_HPP
+/** @} */
@@ -0,0 +1,270 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup cpp_function
+ * @{
+ *
+ * @file
+ * @brief   Allocation-free replacement for `std::function`
+ *
+ * @author  RIOT developers <devel@riot-os.org>
+ */
+
+#ifndef RIOT_INPLACE_FUNCTION_HPP
+#define RIOT_INPLACE_FUNCTION_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Default capacity of a riot::inplace_function in bytes
+ *
+ * Enough for a lambda capturing three pointers or references.
+ */
+#ifndef CONFIG_CPP_FUNCTION_CAPACITY
+#define CONFIG_CPP_FUNCTION_CAPACITY (3 * sizeof(void*))
+#endif
+
+namespace riot {
+
+template <typename Signature,
+          std::size_t Capacity = CONFIG_CPP_FUNCTION_CAPACITY>
+class inplace_function;
+
+/** @cond INTERNAL */
+namespace detail {
+
+template <typename R, typename... Args>
+struct function_ops {
+  R (*invoke)(void* obj, Args&&... args);
+  void (*copy)(void* dst, const void* src);
+  void (*move)(void* dst, void* src);
+  void (*destroy)(void* obj);
+};
+
+template <typename F, typename R, typename... Args>
+struct function_impl {
+  static R invoke(void* obj, Args&&... args) {
+    return (*static_cast<F*>(obj))(std::forward<Args>(args)...);
+  }
+  static void copy(void* dst, const void* src) {
+    ::new (dst) F(*static_cast<const F*>(src));
+  }
+  static void move(void* dst, void* src) {
+    ::new (dst) F(std::move(*static_cast<F*>(src)));
+    static_cast<F*>(src)->~F();
+  }
+  static void destroy(void* obj) { static_cast<F*>(obj)->~F(); }
+
+  static constexpr function_ops<R, Args...> ops{invoke, copy, move, destroy};
+};
+
+template <typename F, typename R, typename... Args>
+constexpr function_ops<R, Args...> function_impl<F, R, Args...>::ops;
+
+template <typename F, typename R, typename = void, typename... Args>
+struct is_invocable_r : std::false_type {};
+
+template <typename F, typename R, typename... Args>
+struct is_invocable_r<
+  F, R,
+  decltype(void(std::declval<F&>()(std::declval<Args>()...))), Args...>
+  : std::integral_constant<
+      bool, std::is_void<R>::value
+              || std::is_convertible<
+                   decltype(std::declval<F&>()(std::declval<Args>()...)),
+                   R>::value> {};
+
+template <typename T>
+struct is_inplace_function : std::false_type {};
+
+template <typename Signature, std::size_t Capacity>
+struct is_inplace_function<inplace_function<Signature, Capacity>>
+  : std::true_type {};
+
+} // namespace detail
+/** @endcond */
+
+/**
+ * @brief Polymorphic function wrapper that stores the callable in place
+ *
+ * Like `std::function`, but the callable is stored in a buffer of
+ * @p Capacity bytes inside the object. A callable that does not fit is
+ * rejected at compile time, so there is no heap allocation and no
+ * exception. Calling an empty inplace_function is a bug caught by assert().
+ *
+ * @tparam R        Return type
+ * @tparam Args     Argument types
+ * @tparam Capacity Size of the buffer for the callable in bytes
+ */
+template <typename R, typename... Args, std::size_t Capacity>
+class inplace_function<R(Args...), Capacity> {
+public:
+  /**
+   * @brief Creates an empty function.
+   */
+  inplace_function() noexcept = default;
+  /**
+   * @brief Creates an empty function.
+   */
+  inplace_function(std::nullptr_t) noexcept {}
+  /**
+   * @brief Stores a copy of the callable @p f.
+   */
+  template <typename F, typename D = typename std::decay<F>::type,
+            typename = typename std::enable_if<
+              !detail::is_inplace_function<D>::value
+              && detail::is_invocable_r<D, R, void, Args...>::value>::type>
+  inplace_function(F&& f) {
+    static_assert(sizeof(D) <= Capacity,
+                  "callable too large, increase the capacity");
+    static_assert(alignof(std::max_align_t) % alignof(D) == 0,
+                  "callable is over-aligned");
+    ::new (static_cast<void*>(m_storage)) D(std::forward<F>(f));
+    m_ops = &detail::function_impl<D, R, Args...>::ops;
+  }
+  /**
+   * @brief Copy constructor.
+   */
+  inplace_function(const inplace_function& other) {
+    if (other.m_ops) {
+      other.m_ops->copy(m_storage, other.m_storage);
+      m_ops = other.m_ops;
+    }
+  }
+  /**
+   * @brief Move constructor, leaves @p other empty.
+   */
+  inplace_function(inplace_function&& other) noexcept {
+    if (other.m_ops) {
+      other.m_ops->move(m_storage, other.m_storage);
+      m_ops = std::exchange(other.m_ops, nullptr);
+    }
+  }
+  ~inplace_function() { reset(); }
+
+  /**
+   * @brief Copy assignment.
+   */
+  inplace_function& operator=(const inplace_function& other) {
+    if (this != &other) {
+      reset();
+      if (other.m_ops) {
+        other.m_ops->copy(m_storage, other.m_storage);
+        m_ops = other.m_ops;
+      }
+    }
+    return *this;
+  }
+  /**
+   * @brief Move assignment, leaves @p other empty.
+   */
+  inplace_function& operator=(inplace_function&& other) noexcept {
+    if (this != &other) {
+      reset();
+      if (other.m_ops) {
+        other.m_ops->move(m_storage, other.m_storage);
+        m_ops = other.m_ops;
+        other.m_ops = nullptr;
+      }
+    }
+    return *this;
+  }
+  /**
+   * @brief Destroys the stored callable.
+   */
+  inplace_function& operator=(std::nullptr_t) noexcept {
+    reset();
+    return *this;
+  }
+
+  /**
+   * @brief Check if a callable is stored.
+   */
+  explicit operator bool() const noexcept { return m_ops != nullptr; }
+
+  /**
+   * @brief Invoke the stored callable.
+   * @pre A callable is stored.
+   */
+  R operator()(Args... args) const {
+    assert(m_ops);
+    return m_ops->invoke(const_cast<unsigned char*>(m_storage),
+                         std::forward<Args>(args)...);
+  }
+
+  /**
+   * @brief Callback for C APIs passing the context pointer first
+   *
+   * Invokes the inplace_function @p self points to, e.g. for the
+   * `void (*)(void *)` callbacks of ztimer or event_callback:
+   *
+   * @code{.cpp}
+   * riot::inplace_function<void()> fn = [&] { ... };
+   * ztimer_t timer = {};
+   * timer.callback = fn.trampoline;
+   * timer.arg = &fn;
+   * @endcode
+   */
+  static R trampoline(void* self, Args... args) {
+    return (*static_cast<const inplace_function*>(self))(
+      std::forward<Args>(args)...);
+  }
+  /**
+   * @brief Callback for C APIs passing the context pointer last
+   *
+   * E.g. for `sock_udp_cb_t`:
+   *
+   * @code{.cpp}
+   * riot::inplace_function<void(sock_udp_t*, sock_async_flags_t)> fn = ...;
+   * sock_udp_set_cb(&sock, fn.trampoline_last, &fn);
+   * @endcode
+   */
+  static R trampoline_last(Args... args, void* self) {
+    return (*static_cast<const inplace_function*>(self))(
+      std::forward<Args>(args)...);
+  }
+
+private:
+  void reset() noexcept {
+    if (m_ops) {
+      m_ops->destroy(m_storage);
+      m_ops = nullptr;
+    }
+  }
+
+  alignas(std::max_align_t) unsigned char m_storage[Capacity];
+  const detail::function_ops<R, Args...>* m_ops = nullptr;
+};
+
+/**
+ * @brief Check if @p f is empty.
+ */
+template <typename Signature, std::size_t Capacity>
+bool operator==(const inplace_function<Signature, Capacity>& f,
+                std::nullptr_t) noexcept {
+  return !f;
+}
+
+/**
+ * @brief Check if @p f is not empty.
+ */
+template <typename Signature, std::size_t Capacity>
+bool operator!=(const inplace_function<Signature, Capacity>& f,
+                std::nullptr_t) noexcept {
+  return static_cast<bool>(f);
+}
+
+} // namespace riot
+
+#endif // RIOT_INPLACE_FUNCTION_HPP
+/** @} */
@@ -0,0 +1,193 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup cpp_net
+ * @{
+ *
+ * @file
+ * @brief   RAII handle for GNRC packets
+ *
+ * @author  RIOT developers <devel@riot-os.org>
+ */
+
+#ifndef RIOT_PKT_HPP
+#define RIOT_PKT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+
+#include "iolist.h"
+#include "net/gnrc/pkt.h"
+#include "net/gnrc/pktbuf.h"
+
+namespace riot {
+
+/**
+ * @brief   Owning reference to a packet in the packet buffer
+ *
+ * The reference is released when the handle is destroyed. Use release() to
+ * hand it over to a function of the C API that takes ownership of the packet,
+ * e.g. gnrc_netapi_dispatch_send().
+ */
+class pkt {
+public:
+  /**
+   * @brief Create an empty handle.
+   */
+  constexpr pkt() noexcept = default;
+  /**
+   * @brief Take over a reference to @p snip.
+   */
+  explicit constexpr pkt(gnrc_pktsnip_t* snip) noexcept : m_snip{snip} {}
+
+  pkt(pkt&& other) noexcept : m_snip{std::exchange(other.m_snip, nullptr)} {}
+  pkt& operator=(pkt&& other) noexcept {
+    std::swap(m_snip, other.m_snip);
+    return *this;
+  }
+  pkt(const pkt&) = delete;
+  pkt& operator=(const pkt&) = delete;
+
+  ~pkt() {
+    if (m_snip) {
+      gnrc_pktbuf_release(m_snip);
+    }
+  }
+
+  /**
+   * @brief Allocate a new snip in front of @p next, see gnrc_pktbuf_add().
+   *
+   * @param[in] data    Data to copy into the snip.
+   * @param[in] type    Type of the snip.
+   * @param[in] next    Rest of the packet, which is only consumed on success.
+   *
+   * @return  Handle to the new packet, empty if the packet buffer is full.
+   */
+  static pkt add(std::span<const uint8_t> data, gnrc_nettype_t type,
+                 pkt&& next) noexcept {
+    pkt res{gnrc_pktbuf_add(next.m_snip, data.data(), data.size(), type)};
+    if (res) {
+      next.m_snip = nullptr;
+    }
+    return res;
+  }
+  /**
+   * @brief Allocate a new packet, see gnrc_pktbuf_add().
+   */
+  static pkt add(std::span<const uint8_t> data, gnrc_nettype_t type) noexcept {
+    return pkt{gnrc_pktbuf_add(nullptr, data.data(), data.size(), type)};
+  }
+  /**
+   * @brief Allocate a new snip of @p size uninitialized bytes in front of
+   *        @p next, which is only consumed on success.
+   */
+  static pkt add(std::size_t size, gnrc_nettype_t type, pkt&& next) noexcept {
+    pkt res{gnrc_pktbuf_add(next.m_snip, nullptr, size, type)};
+    if (res) {
+      next.m_snip = nullptr;
+    }
+    return res;
+  }
+  /**
+   * @brief Allocate a new packet of @p size uninitialized bytes.
+   */
+  static pkt add(std::size_t size, gnrc_nettype_t type) noexcept {
+    return pkt{gnrc_pktbuf_add(nullptr, nullptr, size, type)};
+  }
+
+  /**
+   * @brief Take another reference to the packet, see gnrc_pktbuf_hold().
+   */
+  pkt share() const noexcept {
+    if (m_snip) {
+      gnrc_pktbuf_hold(m_snip, 1);
+    }
+    return pkt{m_snip};
+  }
+
+  /**
+   * @brief Release the reference with an error reported to the subscribers,
+   *        see gnrc_pktbuf_release_error().
+   */
+  void release_error(uint32_t err) noexcept {
+    if (m_snip) {
+      gnrc_pktbuf_release_error(std::exchange(m_snip, nullptr), err);
+    }
+  }
+
+  /**
+   * @brief Give up ownership of the reference without releasing it.
+   */
+  [[nodiscard]] gnrc_pktsnip_t* release() noexcept {
+    return std::exchange(m_snip, nullptr);
+  }
+
+  /**
+   * @brief Make the first snip writable, see gnrc_pktbuf_start_write().
+   * @return  `false` if the snip would need to be duplicated, but the packet
+   *          buffer is full. The handle is unchanged in this case.
+   */
+  [[nodiscard]] bool start_write() noexcept {
+    gnrc_pktsnip_t* snip = gnrc_pktbuf_start_write(m_snip);
+    if (!snip) {
+      return false;
+    }
+    m_snip = snip;
+    return true;
+  }
+
+  /**
+   * @brief Access the first snip.
+   */
+  gnrc_pktsnip_t* get() const noexcept { return m_snip; }
+  /**
+   * @brief Access the first snip.
+   */
+  gnrc_pktsnip_t* operator->() const noexcept { return m_snip; }
+  /**
+   * @brief Check if the handle holds a packet.
+   */
+  explicit operator bool() const noexcept { return m_snip != nullptr; }
+
+  /**
+   * @brief Data of the first snip.
+   */
+  std::span<uint8_t> data() const noexcept {
+    return {static_cast<uint8_t*>(m_snip->data), m_snip->size};
+  }
+  /**
+   * @brief Length of the whole packet, see gnrc_pkt_len().
+   */
+  std::size_t size() const noexcept { return gnrc_pkt_len(m_snip); }
+  /**
+   * @brief Find the first snip of @p type, see gnrc_pktsnip_search_type().
+   */
+  gnrc_pktsnip_t* search_type(gnrc_nettype_t type) const noexcept {
+    return gnrc_pktsnip_search_type(m_snip, type);
+  }
+
+  /**
+   * @brief View the packet as iolist for scatter-gather output.
+   */
+  const iolist_t* iolist() const noexcept {
+    return reinterpret_cast<const iolist_t*>(m_snip);
+  }
+
+private:
+  gnrc_pktsnip_t* m_snip = nullptr;
+};
+
+static_assert(sizeof(pkt) == sizeof(gnrc_pktsnip_t*));
+
+} // namespace riot
+
+#endif // RIOT_PKT_HPP
+/** @} */
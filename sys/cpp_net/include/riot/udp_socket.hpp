@@ -0,0 +1,232 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup cpp_net
+ * @{
+ *
+ * @file
+ * @brief   RAII wrapper for UDP socks
+ *
+ * @author  RIOT developers <devel@riot-os.org>
+ */
+
+#ifndef RIOT_UDP_SOCKET_HPP
+#define RIOT_UDP_SOCKET_HPP
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <span>
+#include <sys/types.h>
+#include <utility>
+
+#include "iolist.h"
+#include "net/sock/udp.h"
+
+#if IS_USED(MODULE_GNRC_PKTBUF) || defined(DOXYGEN)
+#include "riot/pkt.hpp"
+#endif
+
+/**
+ * @brief Maximum number of spans sent by riot::udp_socket::send() at once
+ */
+#ifndef CONFIG_CPP_NET_SEND_SPANS_MAX
+#define CONFIG_CPP_NET_SEND_SPANS_MAX   (4)
+#endif
+
+namespace riot {
+
+/**
+ * @brief   UDP sock that is closed when destroyed
+ *
+ * The sock cannot be moved, as the network stack keeps references to it.
+ */
+class udp_socket {
+public:
+  /**
+   * @brief   Data received without copying, see sock_udp_recv_buf()
+   *
+   * The buffer context of the network stack is released when the buffer is
+   * destroyed.
+   */
+  class buffer {
+    friend class udp_socket;
+
+  public:
+    buffer(buffer&& other) noexcept
+      : m_sock{other.m_sock}, m_data{other.m_data},
+        m_ctx{std::exchange(other.m_ctx, nullptr)}, m_res{other.m_res} {}
+    buffer& operator=(buffer&& other) noexcept {
+      std::swap(m_sock, other.m_sock);
+      std::swap(m_data, other.m_data);
+      std::swap(m_ctx, other.m_ctx);
+      std::swap(m_res, other.m_res);
+      return *this;
+    }
+    buffer(const buffer&) = delete;
+    buffer& operator=(const buffer&) = delete;
+
+    ~buffer() {
+      void* data;
+      // a call returning 0 releases the context
+      while (m_ctx &&
+             sock_udp_recv_buf(m_sock, &data, &m_ctx, 0, nullptr) > 0) {}
+    }
+
+    /**
+     * @brief Check if data was received.
+     */
+    explicit operator bool() const noexcept { return m_res > 0; }
+    /**
+     * @brief Result of sock_udp_recv_buf(), the length of the data or a
+     *        negative errno.
+     */
+    ssize_t result() const noexcept { return m_res; }
+    /**
+     * @brief The received data, empty on error.
+     */
+    std::span<const uint8_t> data() const noexcept {
+      if (m_res <= 0) {
+        return {};
+      }
+      return {static_cast<const uint8_t*>(m_data),
+              static_cast<std::size_t>(m_res)};
+    }
+
+  private:
+    buffer(sock_udp_t* sock, void* data, void* ctx, ssize_t res) noexcept
+      : m_sock{sock}, m_data{data}, m_ctx{ctx}, m_res{res} {}
+
+    sock_udp_t* m_sock;
+    void* m_data;
+    void* m_ctx;
+    ssize_t m_res;
+  };
+
+  udp_socket() noexcept = default;
+  udp_socket(const udp_socket&) = delete;
+  udp_socket& operator=(const udp_socket&) = delete;
+
+  ~udp_socket() { close(); }
+
+  /**
+   * @brief Create the sock, see sock_udp_create().
+   * @return  0 on success or a negative errno.
+   */
+  [[nodiscard]] int create(const sock_udp_ep_t* local,
+                           const sock_udp_ep_t* remote = nullptr,
+                           uint16_t flags = 0) noexcept {
+    close();
+    int res = sock_udp_create(&m_sock, local, remote, flags);
+    m_open = (res == 0);
+    return res;
+  }
+
+  /**
+   * @brief Close the sock, if it was created.
+   */
+  void close() noexcept {
+    if (m_open) {
+      sock_udp_close(&m_sock);
+      m_open = false;
+    }
+  }
+
+  /**
+   * @brief Receive a datagram into @p data, see sock_udp_recv().
+   */
+  ssize_t recv(std::span<uint8_t> data, uint32_t timeout = SOCK_NO_TIMEOUT,
+               sock_udp_ep_t* remote = nullptr) noexcept {
+    return sock_udp_recv(&m_sock, data.data(), data.size(), timeout, remote);
+  }
+
+  /**
+   * @brief Receive a datagram without copying it.
+   *
+   * @return  The data in the buffer of the network stack, valid until the
+   *          returned object is destroyed.
+   */
+  buffer recv_buf(uint32_t timeout = SOCK_NO_TIMEOUT,
+                  sock_udp_ep_t* remote = nullptr) noexcept {
+    void* data = nullptr;
+    void* ctx = nullptr;
+    ssize_t res = sock_udp_recv_buf(&m_sock, &data, &ctx, timeout, remote);
+    return buffer{&m_sock, data, ctx, res};
+  }
+
+  /**
+   * @brief Send a datagram, see sock_udp_send().
+   */
+  ssize_t send(std::span<const uint8_t> data,
+               const sock_udp_ep_t* remote = nullptr) noexcept {
+    return sock_udp_send(&m_sock, data.data(), data.size(), remote);
+  }
+
+  /**
+   * @brief Send the concatenation of @p parts as one datagram without
+   *        copying them first.
+   *
+   * At most @ref CONFIG_CPP_NET_SEND_SPANS_MAX parts are supported.
+   */
+  ssize_t send(std::initializer_list<std::span<const uint8_t>> parts,
+               const sock_udp_ep_t* remote = nullptr) noexcept {
+    iolist_t iol[CONFIG_CPP_NET_SEND_SPANS_MAX];
+    iolist_t* next = nullptr;
+    if (parts.size() > CONFIG_CPP_NET_SEND_SPANS_MAX) {
+      return -ENOBUFS;
+    }
+    // build the list back to front
+    std::size_t i = parts.size();
+    for (auto part = std::rbegin(parts); part != std::rend(parts); ++part) {
+      --i;
+      iol[i] = { next, const_cast<uint8_t*>(part->data()), part->size() };
+      next = &iol[i];
+    }
+    return sock_udp_sendv(&m_sock, next, remote);
+  }
+
+  /**
+   * @brief Send an iolist as one datagram, see sock_udp_sendv().
+   */
+  ssize_t send(const iolist_t* snips,
+               const sock_udp_ep_t* remote = nullptr) noexcept {
+    return sock_udp_sendv(&m_sock, snips, remote);
+  }
+
+#if IS_USED(MODULE_GNRC_PKTBUF) || defined(DOXYGEN)
+  /**
+   * @brief Send the payload of all snips of @p p as one datagram.
+   *
+   * The packet is not consumed.
+   */
+  ssize_t send(const pkt& p, const sock_udp_ep_t* remote = nullptr) noexcept {
+    return sock_udp_sendv(&m_sock, p.iolist(), remote);
+  }
+#endif
+
+  /**
+   * @brief Access the wrapped sock.
+   */
+  sock_udp_t* get() noexcept { return &m_sock; }
+  /**
+   * @brief Check if the sock was created.
+   */
+  explicit operator bool() const noexcept { return m_open; }
+
+private:
+  sock_udp_t m_sock;
+  bool m_open = false;
+};
+
+} // namespace riot
+
+#endif // RIOT_UDP_SOCKET_HPP
+/** @} */
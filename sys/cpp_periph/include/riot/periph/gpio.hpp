@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup cpp_periph
+ * @{
+ *
+ * @file
+ * @brief   GPIO pins known at compile time
+ *
+ * @author  RIOT developers <devel@riot-os.org>
+ */
+
+#ifndef RIOT_PERIPH_GPIO_HPP
+#define RIOT_PERIPH_GPIO_HPP
+
+#include "periph/gpio_ll.h"
+
+namespace riot {
+namespace periph {
+
+/**
+ * @brief   GPIO pin at a fixed port and position
+ *
+ * @tparam PortNum  Number of the port, as passed to `GPIO_PORT()`
+ * @tparam PinNum   Number of the pin within the port
+ */
+template <unsigned PortNum, unsigned PinNum>
+class gpio_ll_pin {
+  static_assert(PinNum < sizeof(uword_t) * 8, "pin number out of range");
+
+public:
+  /**
+   * @brief Number of the port.
+   */
+  static constexpr unsigned port_num = PortNum;
+  /**
+   * @brief Number of the pin within the port.
+   */
+  static constexpr unsigned pin_num = PinNum;
+  /**
+   * @brief Bitmask of the pin within the port.
+   */
+  static constexpr uword_t mask = (uword_t)1 << PinNum;
+
+  gpio_ll_pin() = delete;
+
+  /**
+   * @brief The port of the pin.
+   */
+  static gpio_port_t port() noexcept { return GPIO_PORT(PortNum); }
+
+  /**
+   * @brief Configure the pin, see gpio_ll_init().
+   */
+  static int init(gpio_conf_t conf) noexcept {
+    return gpio_ll_init(port(), PinNum, conf);
+  }
+  /**
+   * @brief Drive the pin high.
+   */
+  static void set() noexcept { gpio_ll_set(port(), mask); }
+  /**
+   * @brief Drive the pin low.
+   */
+  static void clear() noexcept { gpio_ll_clear(port(), mask); }
+  /**
+   * @brief Toggle the pin.
+   */
+  static void toggle() noexcept { gpio_ll_toggle(port(), mask); }
+  /**
+   * @brief Drive the pin to @p value.
+   */
+  static void write(bool value) noexcept {
+    if (value) {
+      set();
+    } else {
+      clear();
+    }
+  }
+  /**
+   * @brief Read the input level of the pin.
+   */
+  static bool read() noexcept { return gpio_ll_read(port()) & mask; }
+};
+
+/** @cond INTERNAL */
+namespace detail {
+
+constexpr uword_t gpio_ll_mask() { return 0; }
+
+template <class... Masks>
+constexpr uword_t gpio_ll_mask(uword_t first, Masks... rest) {
+  return first | gpio_ll_mask(rest...);
+}
+
+constexpr bool gpio_ll_same_port(unsigned) { return true; }
+
+template <class... Ports>
+constexpr bool gpio_ll_same_port(unsigned first, unsigned second,
+                                 Ports... rest) {
+  return (first == second) && gpio_ll_same_port(second, rest...);
+}
+
+} // namespace detail
+/** @endcond */
+
+/**
+ * @brief   Group of @ref gpio_ll_pin of the same port, accessed at once
+ *
+ * @code{.cpp}
+ * using d0 = riot::periph::gpio_ll_pin<1, 0>;
+ * using d1 = riot::periph::gpio_ll_pin<1, 1>;
+ * using data = riot::periph::gpio_ll_pins<d0, d1>;
+ *
+ * data::set();
+ * @endcode
+ */
+template <class First, class... Rest>
+class gpio_ll_pins {
+  static_assert(detail::gpio_ll_same_port(First::port_num, Rest::port_num...),
+                "all pins must be on the same port");
+
+public:
+  /**
+   * @brief Bitmask of all pins within the port.
+   */
+  static constexpr uword_t mask =
+    detail::gpio_ll_mask(First::mask, Rest::mask...);
+
+  gpio_ll_pins() = delete;
+
+  /**
+   * @brief The port of the pins.
+   */
+  static gpio_port_t port() noexcept { return First::port(); }
+
+  /**
+   * @brief Drive all pins high.
+   */
+  static void set() noexcept { gpio_ll_set(port(), mask); }
+  /**
+   * @brief Drive all pins low.
+   */
+  static void clear() noexcept { gpio_ll_clear(port(), mask); }
+  /**
+   * @brief Toggle all pins.
+   */
+  static void toggle() noexcept { gpio_ll_toggle(port(), mask); }
+  /**
+   * @brief Drive the pins to the bits of @p value at their position in the
+   *        port, see gpio_ll_prepare_write().
+   *
+   * @note  This must not race with other accesses to the same port.
+   */
+  static void write(uword_t value) noexcept {
+    gpio_ll_write(port(), gpio_ll_prepare_write(port(), mask, value & mask));
+  }
+  /**
+   * @brief Read the input levels of all pins, at their position in the port.
+   */
+  static uword_t read() noexcept { return gpio_ll_read(port()) & mask; }
+};
+
+} // namespace periph
+} // namespace riot
+
+#endif // RIOT_PERIPH_GPIO_HPP
+/** @} */
@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup cpp_periph
+ * @{
+ *
+ * @file
+ * @brief   SPI buses known at compile time
+ *
+ * @author  RIOT developers <devel@riot-os.org>
+ */
+
+#ifndef RIOT_PERIPH_SPI_HPP
+#define RIOT_PERIPH_SPI_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "periph/spi.h"
+
+namespace riot {
+namespace periph {
+
+/**
+ * @brief   SPI bus with a fixed device number
+ *
+ * @tparam Dev  Number of the bus, as passed to `SPI_DEV()`
+ */
+template <unsigned Dev>
+class spi_bus {
+public:
+  /**
+   * @brief Number of the bus.
+   */
+  static constexpr unsigned dev_num = Dev;
+
+  spi_bus() = delete;
+
+  /**
+   * @brief The bus.
+   */
+  static spi_t dev() noexcept { return SPI_DEV(Dev); }
+
+  /**
+   * @brief Initialize a chip select pin, see spi_init_cs().
+   */
+  static int init_cs(spi_cs_t cs) noexcept { return spi_init_cs(dev(), cs); }
+
+  /**
+   * @brief   Exclusive access to the bus, released on destruction
+   *
+   * @code{.cpp}
+   * using bus = riot::periph::spi_bus<0>;
+   *
+   * {
+   *     bus::transaction t{cs, SPI_MODE_0, SPI_CLK_1MHZ};
+   *     t.transfer_reg(REG_CTRL, 0x01);
+   * }
+   * @endcode
+   */
+  class transaction {
+  public:
+    /**
+     * @brief Acquire the bus, see spi_acquire().
+     */
+    transaction(spi_cs_t cs, spi_mode_t mode, spi_clk_t clk) noexcept
+      : m_cs{cs} {
+      spi_acquire(dev(), cs, mode, clk);
+    }
+    transaction(const transaction&) = delete;
+    transaction& operator=(const transaction&) = delete;
+
+    /**
+     * @brief Release the bus, see spi_release().
+     */
+    ~transaction() { spi_release(dev()); }
+
+    /**
+     * @brief Transfer one byte, see spi_transfer_byte().
+     */
+    uint8_t transfer_byte(uint8_t out, bool cont = false) noexcept {
+      return spi_transfer_byte(dev(), m_cs, cont, out);
+    }
+    /**
+     * @brief Transfer @p len bytes, see spi_transfer_bytes().
+     */
+    void transfer_bytes(const void* out, void* in, size_t len,
+                        bool cont = false) noexcept {
+      spi_transfer_bytes(dev(), m_cs, cont, out, in, len);
+    }
+    /**
+     * @brief Transfer one byte to or from a register, see
+     *        spi_transfer_reg().
+     */
+    uint8_t transfer_reg(uint8_t reg, uint8_t out) noexcept {
+      return spi_transfer_reg(dev(), m_cs, reg, out);
+    }
+    /**
+     * @brief Transfer @p len bytes to or from registers, see
+     *        spi_transfer_regs().
+     */
+    void transfer_regs(uint8_t reg, const void* out, void* in,
+                       size_t len) noexcept {
+      spi_transfer_regs(dev(), m_cs, reg, out, in, len);
+    }
+
+  private:
+    spi_cs_t m_cs;
+  };
+};
+
+} // namespace periph
+} // namespace riot
+
+#endif // RIOT_PERIPH_SPI_HPP
+/** @} */
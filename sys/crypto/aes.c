@@ -74,14 +74,19 @@ typedef struct {
  * Interface to the aes cipher
  */
 static const cipher_interface_t aes_interface = {
-    AES_BLOCK_SIZE,
-    aes_init,
-    aes_encrypt,
-    aes_decrypt
+    .block_size = AES_BLOCK_SIZE,
+    .init = aes_init,
+    .encrypt = aes_encrypt,
+    .decrypt = aes_decrypt,
+    .encrypt_blocks = aes_encrypt_blocks,
+    .decrypt_blocks = aes_decrypt_blocks,
+    .encrypt_cbc = aes_encrypt_cbc,
 };
 
 const cipher_id_t CIPHER_AES = &aes_interface;
 
+/* the table based implementation, crypto_aes_ct replaces it with aes_ct.c */
+#if !IS_USED(MODULE_CRYPTO_AES_CT)
 static const u32 Te0[256] = {
     0xc66363a5U, 0xf87c7c84U, 0xee777799U, 0xf67b7b8dU,
     0xfff2f20dU, 0xd66b6bbdU, 0xde6f6fb1U, 0x91c5c554U,
@@ -824,6 +829,7 @@ static const u32 rcon[] = {
     0x10000000, 0x20000000, 0x40000000, 0x80000000,
     0x1B000000, 0x36000000,
 };
+#endif /* !MODULE_CRYPTO_AES_CT */
 
 int aes_init(cipher_context_t *context, const uint8_t *key, uint8_t keySize)
 {
@@ -864,6 +870,7 @@ int aes_init(cipher_context_t *context, const uint8_t *key, uint8_t keySize)
     return CIPHER_INIT_SUCCESS;
 }
 
+#if !IS_USED(MODULE_CRYPTO_AES_CT)
 /**
  * Expand the cipher key into the encryption key schedule.
  */
@@ -1062,23 +1069,12 @@ static int aes_set_decrypt_key(const unsigned char *userKey, const int bits,
 
 #ifndef AES_ASM
 /*
- * Encrypt a single block
+ * Encrypt a single block with an expanded key
  * in and out can overlap
  */
-int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
-                uint8_t *cipherBlock)
+static int _aes_encrypt_block(const aes_key_t *key, const uint8_t *plainBlock,
+                              uint8_t *cipherBlock)
 {
-    /* setup AES_KEY */
-    int res;
-    aes_key_t aeskey;
-    const aes_key_t *key = &aeskey;
-
-    res = aes_set_encrypt_key((unsigned char *)context->context,
-                              AES_KEY_SIZE(context) * 8, &aeskey);
-    if (res < 0) {
-        return res;
-    }
-
     const u32 *rk;
     u32 s0, s1, s2, s3, t0, t1, t2, t3;
 
@@ -1331,24 +1327,30 @@ int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
 }
 
 /*
- * Decrypt a single block
+ * Encrypt a single block
  * in and out can overlap
  */
-int aes_decrypt(const cipher_context_t *context, const uint8_t *cipherBlock,
-                uint8_t *plainBlock)
+int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
+                uint8_t *cipherBlock)
 {
     /* setup AES_KEY */
-    int res;
     aes_key_t aeskey;
-    const aes_key_t *key = &aeskey;
-
-    res = aes_set_decrypt_key((unsigned char *)context->context,
-                              AES_KEY_SIZE(context) * 8, &aeskey);
+    int res = aes_set_encrypt_key((unsigned char *)context->context,
+                                  AES_KEY_SIZE(context) * 8, &aeskey);
 
     if (res < 0) {
         return res;
     }
+    return _aes_encrypt_block(&aeskey, plainBlock, cipherBlock);
+}
 
+/*
+ * Decrypt a single block with an expanded key
+ * in and out can overlap
+ */
+static int _aes_decrypt_block(const aes_key_t *key, const uint8_t *cipherBlock,
+                              uint8_t *plainBlock)
+{
     const u32 *rk;
     u32 s0, s1, s2, s3, t0, t1, t2, t3;
 
@@ -1592,4 +1594,81 @@ int aes_decrypt(const cipher_context_t *context, const uint8_t *cipherBlock,
     return 1;
 }
 
+/*
+ * Decrypt a single block
+ * in and out can overlap
+ */
+int aes_decrypt(const cipher_context_t *context, const uint8_t *cipherBlock,
+                uint8_t *plainBlock)
+{
+    /* setup AES_KEY */
+    aes_key_t aeskey;
+    int res = aes_set_decrypt_key((unsigned char *)context->context,
+                                  AES_KEY_SIZE(context) * 8, &aeskey);
+
+    if (res < 0) {
+        return res;
+    }
+    return _aes_decrypt_block(&aeskey, cipherBlock, plainBlock);
+}
+
+/*
+ * The multi-block operations expand the key only once for all blocks
+ */
+int aes_encrypt_blocks(const cipher_context_t *context, const uint8_t *input,
+                       uint8_t *output, size_t num)
+{
+    aes_key_t aeskey;
+    int res = aes_set_encrypt_key((unsigned char *)context->context,
+                                  AES_KEY_SIZE(context) * 8, &aeskey);
+
+    if (res < 0) {
+        return res;
+    }
+    for (; num > 0; num--, input += AES_BLOCK_SIZE, output += AES_BLOCK_SIZE) {
+        _aes_encrypt_block(&aeskey, input, output);
+    }
+    return 1;
+}
+
+int aes_decrypt_blocks(const cipher_context_t *context, const uint8_t *input,
+                       uint8_t *output, size_t num)
+{
+    aes_key_t aeskey;
+    int res = aes_set_decrypt_key((unsigned char *)context->context,
+                                  AES_KEY_SIZE(context) * 8, &aeskey);
+
+    if (res < 0) {
+        return res;
+    }
+    for (; num > 0; num--, input += AES_BLOCK_SIZE, output += AES_BLOCK_SIZE) {
+        _aes_decrypt_block(&aeskey, input, output);
+    }
+    return 1;
+}
+
+int aes_encrypt_cbc(const cipher_context_t *context, uint8_t *iv,
+                    const uint8_t *input, uint8_t *output, size_t num)
+{
+    aes_key_t aeskey;
+    int res = aes_set_encrypt_key((unsigned char *)context->context,
+                                  AES_KEY_SIZE(context) * 8, &aeskey);
+
+    if (res < 0) {
+        return res;
+    }
+    for (; num > 0; num--, input += AES_BLOCK_SIZE) {
+        for (unsigned i = 0; i < AES_BLOCK_SIZE; i++) {
+            iv[i] ^= input[i];
+        }
+        _aes_encrypt_block(&aeskey, iv, iv);
+        if (output) {
+            memcpy(output, iv, AES_BLOCK_SIZE);
+            output += AES_BLOCK_SIZE;
+        }
+    }
+    return 1;
+}
+
 #endif /* AES_ASM */
+#endif /* !MODULE_CRYPTO_AES_CT */
@@ -0,0 +1,519 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_crypto
+ * @{
+ *
+ * @file
+ * @brief       Constant-time, bitsliced implementation of the AES block
+ *              functions
+ *
+ * Two blocks are processed at once in eight 32 bit words, with one bit of
+ * every byte of the state per word. The S-box is computed with the circuit
+ * of Boyar and Peralta, so there are no table lookups and no branches that
+ * depend on the key or the data. This follows the design of BearSSL's
+ * aes_ct by Thomas Pornin.
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "crypto/aes.h"
+#include "crypto/ciphers.h"
+
+/* bitsliced S-box, q[0] holds the least significant bit of every byte */
+static void _sbox(uint32_t *q)
+{
+    uint32_t x0, x1, x2, x3, x4, x5, x6, x7;
+    uint32_t y1, y2, y3, y4, y5, y6, y7, y8, y9;
+    uint32_t y10, y11, y12, y13, y14, y15, y16, y17, y18, y19;
+    uint32_t y20, y21;
+    uint32_t z0, z1, z2, z3, z4, z5, z6, z7, z8, z9;
+    uint32_t z10, z11, z12, z13, z14, z15, z16, z17;
+    uint32_t t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+    uint32_t t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+    uint32_t t20, t21, t22, t23, t24, t25, t26, t27, t28, t29;
+    uint32_t t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+    uint32_t t40, t41, t42, t43, t44, t45, t46, t47, t48, t49;
+    uint32_t t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+    uint32_t t60, t61, t62, t63, t64, t65, t66, t67;
+    uint32_t s0, s1, s2, s3, s4, s5, s6, s7;
+
+    x0 = q[7];
+    x1 = q[6];
+    x2 = q[5];
+    x3 = q[4];
+    x4 = q[3];
+    x5 = q[2];
+    x6 = q[1];
+    x7 = q[0];
+
+    /* top linear transformation */
+    y14 = x3 ^ x5;
+    y13 = x0 ^ x6;
+    y9 = x0 ^ x3;
+    y8 = x0 ^ x5;
+    t0 = x1 ^ x2;
+    y1 = t0 ^ x7;
+    y4 = y1 ^ x3;
+    y12 = y13 ^ y14;
+    y2 = y1 ^ x0;
+    y5 = y1 ^ x6;
+    y3 = y5 ^ y8;
+    t1 = x4 ^ y12;
+    y15 = t1 ^ x5;
+    y20 = t1 ^ x1;
+    y6 = y15 ^ x7;
+    y10 = y15 ^ t0;
+    y11 = y20 ^ y9;
+    y7 = x7 ^ y11;
+    y17 = y10 ^ y11;
+    y19 = y10 ^ y8;
+    y16 = t0 ^ y11;
+    y21 = y13 ^ y16;
+    y18 = x0 ^ y16;
+
+    /* non-linear section */
+    t2 = y12 & y15;
+    t3 = y3 & y6;
+    t4 = t3 ^ t2;
+    t5 = y4 & x7;
+    t6 = t5 ^ t2;
+    t7 = y13 & y16;
+    t8 = y5 & y1;
+    t9 = t8 ^ t7;
+    t10 = y2 & y7;
+    t11 = t10 ^ t7;
+    t12 = y9 & y11;
+    t13 = y14 & y17;
+    t14 = t13 ^ t12;
+    t15 = y8 & y10;
+    t16 = t15 ^ t12;
+    t17 = t4 ^ t14;
+    t18 = t6 ^ t16;
+    t19 = t9 ^ t14;
+    t20 = t11 ^ t16;
+    t21 = t17 ^ y20;
+    t22 = t18 ^ y19;
+    t23 = t19 ^ y21;
+    t24 = t20 ^ y18;
+
+    t25 = t21 ^ t22;
+    t26 = t21 & t23;
+    t27 = t24 ^ t26;
+    t28 = t25 & t27;
+    t29 = t28 ^ t22;
+    t30 = t23 ^ t24;
+    t31 = t22 ^ t26;
+    t32 = t31 & t30;
+    t33 = t32 ^ t24;
+    t34 = t23 ^ t33;
+    t35 = t27 ^ t33;
+    t36 = t24 & t35;
+    t37 = t36 ^ t34;
+    t38 = t27 ^ t36;
+    t39 = t29 & t38;
+    t40 = t25 ^ t39;
+
+    t41 = t40 ^ t37;
+    t42 = t29 ^ t33;
+    t43 = t29 ^ t40;
+    t44 = t33 ^ t37;
+    t45 = t42 ^ t41;
+    z0 = t44 & y15;
+    z1 = t37 & y6;
+    z2 = t33 & x7;
+    z3 = t43 & y16;
+    z4 = t40 & y1;
+    z5 = t29 & y7;
+    z6 = t42 & y11;
+    z7 = t45 & y17;
+    z8 = t41 & y10;
+    z9 = t44 & y12;
+    z10 = t37 & y3;
+    z11 = t33 & y4;
+    z12 = t43 & y13;
+    z13 = t40 & y5;
+    z14 = t29 & y2;
+    z15 = t42 & y9;
+    z16 = t45 & y14;
+    z17 = t41 & y8;
+
+    /* bottom linear transformation */
+    t46 = z15 ^ z16;
+    t47 = z10 ^ z11;
+    t48 = z5 ^ z13;
+    t49 = z9 ^ z10;
+    t50 = z2 ^ z12;
+    t51 = z2 ^ z5;
+    t52 = z7 ^ z8;
+    t53 = z0 ^ z3;
+    t54 = z6 ^ z7;
+    t55 = z16 ^ z17;
+    t56 = z12 ^ t48;
+    t57 = t50 ^ t53;
+    t58 = z4 ^ t46;
+    t59 = z3 ^ t54;
+    t60 = t46 ^ t57;
+    t61 = z14 ^ t57;
+    t62 = t52 ^ t58;
+    t63 = t49 ^ t58;
+    t64 = z4 ^ t59;
+    t65 = t61 ^ t62;
+    t66 = z1 ^ t63;
+    s0 = t59 ^ t63;
+    s6 = t56 ^ ~t62;
+    s7 = t48 ^ ~t60;
+    t67 = t64 ^ t65;
+    s3 = t53 ^ t66;
+    s4 = t51 ^ t66;
+    s5 = t47 ^ t65;
+    s1 = t64 ^ ~s3;
+    s2 = t55 ^ ~t67;
+
+    q[7] = s0;
+    q[6] = s1;
+    q[5] = s2;
+    q[4] = s3;
+    q[3] = s4;
+    q[2] = s5;
+    q[1] = s6;
+    q[0] = s7;
+}
+
+/* affine part of the inverse S-box, applied before and after the S-box it
+ * turns the latter into its inverse */
+static void _inv_sbox_affine(uint32_t *q)
+{
+    uint32_t q0 = ~q[0], q1 = ~q[1], q2 = q[2], q3 = q[3];
+    uint32_t q4 = q[4], q5 = ~q[5], q6 = ~q[6], q7 = q[7];
+
+    q[7] = q1 ^ q4 ^ q6;
+    q[6] = q0 ^ q3 ^ q5;
+    q[5] = q7 ^ q2 ^ q4;
+    q[4] = q6 ^ q1 ^ q3;
+    q[3] = q5 ^ q0 ^ q2;
+    q[2] = q4 ^ q7 ^ q1;
+    q[1] = q3 ^ q6 ^ q0;
+    q[0] = q2 ^ q5 ^ q7;
+}
+
+static void _inv_sbox(uint32_t *q)
+{
+    _inv_sbox_affine(q);
+    _sbox(q);
+    _inv_sbox_affine(q);
+}
+
+#define SWAPN(cl, ch, s, x, y) \
+    do { \
+        uint32_t a = x, b = y; \
+        x = (a & (uint32_t)(cl)) | ((b & (uint32_t)(cl)) << (s)); \
+        y = ((a & (uint32_t)(ch)) >> (s)) | (b & (uint32_t)(ch)); \
+    } while (0)
+
+#define SWAP2(x, y)    SWAPN(0x55555555, 0xAAAAAAAA, 1, x, y)
+#define SWAP4(x, y)    SWAPN(0x33333333, 0xCCCCCCCC, 2, x, y)
+#define SWAP8(x, y)    SWAPN(0x0F0F0F0F, 0xF0F0F0F0, 4, x, y)
+
+/* converts between two blocks in eight words and the bitsliced layout */
+static void _ortho(uint32_t *q)
+{
+    SWAP2(q[0], q[1]);
+    SWAP2(q[2], q[3]);
+    SWAP2(q[4], q[5]);
+    SWAP2(q[6], q[7]);
+
+    SWAP4(q[0], q[2]);
+    SWAP4(q[1], q[3]);
+    SWAP4(q[4], q[6]);
+    SWAP4(q[5], q[7]);
+
+    SWAP8(q[0], q[4]);
+    SWAP8(q[1], q[5]);
+    SWAP8(q[2], q[6]);
+    SWAP8(q[3], q[7]);
+}
+
+static uint32_t _sub_word(uint32_t x)
+{
+    uint32_t q[8] = { x };
+
+    _ortho(q);
+    _sbox(q);
+    _ortho(q);
+    return q[0];
+}
+
+static const uint8_t _rcon[] = {
+    0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1B, 0x36
+};
+
+/* expands the key into the round keys for both slots, returns the number
+ * of rounds */
+static unsigned _keysched(uint32_t *skey, const uint8_t *key, size_t key_len)
+{
+    unsigned rounds = 6 + key_len / 4;
+    unsigned nk = key_len / 4;
+    unsigned nkf = (rounds + 1) * 4;
+    uint32_t tmp = 0;
+
+    for (unsigned i = 0; i < nk; i++) {
+        tmp = byteorder_lebuftohl(key + 4 * i);
+        skey[2 * i] = tmp;
+        skey[2 * i + 1] = tmp;
+    }
+    for (unsigned i = nk, j = 0, k = 0; i < nkf; i++) {
+        if (j == 0) {
+            tmp = (tmp << 24) | (tmp >> 8);
+            tmp = _sub_word(tmp) ^ _rcon[k];
+        }
+        else if (nk > 6 && j == 4) {
+            tmp = _sub_word(tmp);
+        }
+        tmp ^= skey[2 * (i - nk)];
+        skey[2 * i] = tmp;
+        skey[2 * i + 1] = tmp;
+        if (++j == nk) {
+            j = 0;
+            k++;
+        }
+    }
+    for (unsigned i = 0; i < nkf; i += 4) {
+        _ortho(skey + 2 * i);
+    }
+    for (unsigned i = 0; i < nkf; i++) {
+        skey[i] = (skey[2 * i] & 0x55555555) | (skey[2 * i + 1] & 0xAAAAAAAA);
+    }
+    for (unsigned i = nkf; i-- > 0;) {
+        uint32_t x = skey[i] & 0x55555555, y = skey[i] & 0xAAAAAAAA;
+        skey[2 * i] = x | (x << 1);
+        skey[2 * i + 1] = y | (y >> 1);
+    }
+    return rounds;
+}
+
+static inline void _add_round_key(uint32_t *q, const uint32_t *sk)
+{
+    for (unsigned i = 0; i < 8; i++) {
+        q[i] ^= sk[i];
+    }
+}
+
+static void _shift_rows(uint32_t *q)
+{
+    for (unsigned i = 0; i < 8; i++) {
+        uint32_t x = q[i];
+        q[i] = (x & 0x000000FF)
+             | ((x & 0x0000FC00) >> 2) | ((x & 0x00000300) << 6)
+             | ((x & 0x00F00000) >> 4) | ((x & 0x000F0000) << 4)
+             | ((x & 0xC0000000) >> 6) | ((x & 0x3F000000) << 2);
+    }
+}
+
+static void _inv_shift_rows(uint32_t *q)
+{
+    for (unsigned i = 0; i < 8; i++) {
+        uint32_t x = q[i];
+        q[i] = (x & 0x000000FF)
+             | ((x & 0x00003F00) << 2) | ((x & 0x0000C000) >> 6)
+             | ((x & 0x000F0000) << 4) | ((x & 0x00F00000) >> 4)
+             | ((x & 0x03000000) << 6) | ((x & 0xFC000000) >> 2);
+    }
+}
+
+static inline uint32_t _rotr16(uint32_t x)
+{
+    return (x << 16) | (x >> 16);
+}
+
+static void _mix_columns(uint32_t *q)
+{
+    uint32_t q0 = q[0], q1 = q[1], q2 = q[2], q3 = q[3];
+    uint32_t q4 = q[4], q5 = q[5], q6 = q[6], q7 = q[7];
+    uint32_t r0 = (q0 >> 8) | (q0 << 24), r1 = (q1 >> 8) | (q1 << 24);
+    uint32_t r2 = (q2 >> 8) | (q2 << 24), r3 = (q3 >> 8) | (q3 << 24);
+    uint32_t r4 = (q4 >> 8) | (q4 << 24), r5 = (q5 >> 8) | (q5 << 24);
+    uint32_t r6 = (q6 >> 8) | (q6 << 24), r7 = (q7 >> 8) | (q7 << 24);
+
+    q[0] = q7 ^ r7 ^ r0 ^ _rotr16(q0 ^ r0);
+    q[1] = q0 ^ r0 ^ q7 ^ r7 ^ r1 ^ _rotr16(q1 ^ r1);
+    q[2] = q1 ^ r1 ^ r2 ^ _rotr16(q2 ^ r2);
+    q[3] = q2 ^ r2 ^ q7 ^ r7 ^ r3 ^ _rotr16(q3 ^ r3);
+    q[4] = q3 ^ r3 ^ q7 ^ r7 ^ r4 ^ _rotr16(q4 ^ r4);
+    q[5] = q4 ^ r4 ^ r5 ^ _rotr16(q5 ^ r5);
+    q[6] = q5 ^ r5 ^ r6 ^ _rotr16(q6 ^ r6);
+    q[7] = q6 ^ r6 ^ r7 ^ _rotr16(q7 ^ r7);
+}
+
+static void _inv_mix_columns(uint32_t *q)
+{
+    uint32_t q0 = q[0], q1 = q[1], q2 = q[2], q3 = q[3];
+    uint32_t q4 = q[4], q5 = q[5], q6 = q[6], q7 = q[7];
+    uint32_t r0 = (q0 >> 8) | (q0 << 24), r1 = (q1 >> 8) | (q1 << 24);
+    uint32_t r2 = (q2 >> 8) | (q2 << 24), r3 = (q3 >> 8) | (q3 << 24);
+    uint32_t r4 = (q4 >> 8) | (q4 << 24), r5 = (q5 >> 8) | (q5 << 24);
+    uint32_t r6 = (q6 >> 8) | (q6 << 24), r7 = (q7 >> 8) | (q7 << 24);
+
+    q[0] = q5 ^ q6 ^ q7 ^ r0 ^ r5 ^ r7 ^ _rotr16(q0 ^ q5 ^ q6 ^ r0 ^ r5);
+    q[1] = q0 ^ q5 ^ r0 ^ r1 ^ r5 ^ r6 ^ r7 ^ _rotr16(q1 ^ q5 ^ q7 ^ r1 ^ r5 ^ r6);
+    q[2] = q0 ^ q1 ^ q6 ^ r1 ^ r2 ^ r6 ^ r7 ^ _rotr16(q0 ^ q2 ^ q6 ^ r2 ^ r6 ^ r7);
+    q[3] = q0 ^ q1 ^ q2 ^ q5 ^ q6 ^ r0 ^ r2 ^ r3 ^ r5
+         ^ _rotr16(q0 ^ q1 ^ q3 ^ q5 ^ q6 ^ q7 ^ r0 ^ r3 ^ r5 ^ r7);
+    q[4] = q1 ^ q2 ^ q3 ^ q5 ^ r1 ^ r3 ^ r4 ^ r5 ^ r6 ^ r7
+         ^ _rotr16(q1 ^ q2 ^ q4 ^ q5 ^ q7 ^ r1 ^ r4 ^ r5 ^ r6);
+    q[5] = q2 ^ q3 ^ q4 ^ q6 ^ r2 ^ r4 ^ r5 ^ r6 ^ r7
+         ^ _rotr16(q2 ^ q3 ^ q5 ^ q6 ^ r2 ^ r5 ^ r6 ^ r7);
+    q[6] = q3 ^ q4 ^ q5 ^ q7 ^ r3 ^ r5 ^ r6 ^ r7
+         ^ _rotr16(q3 ^ q4 ^ q6 ^ q7 ^ r3 ^ r6 ^ r7);
+    q[7] = q4 ^ q5 ^ q6 ^ r4 ^ r6 ^ r7 ^ _rotr16(q4 ^ q5 ^ q7 ^ r4 ^ r7);
+}
+
+/* loads one or two blocks into the bitsliced state */
+static void _load(uint32_t *q, const uint8_t *a, const uint8_t *b)
+{
+    for (unsigned i = 0; i < 4; i++) {
+        q[2 * i] = byteorder_lebuftohl(a + 4 * i);
+        q[2 * i + 1] = b ? byteorder_lebuftohl(b + 4 * i) : 0;
+    }
+    _ortho(q);
+}
+
+static void _store(uint32_t *q, uint8_t *a, uint8_t *b)
+{
+    _ortho(q);
+    for (unsigned i = 0; i < 4; i++) {
+        byteorder_htolebufl(a + 4 * i, q[2 * i]);
+        if (b) {
+            byteorder_htolebufl(b + 4 * i, q[2 * i + 1]);
+        }
+    }
+}
+
+static void _encrypt(const uint32_t *skey, unsigned rounds, uint32_t *q)
+{
+    _add_round_key(q, skey);
+    for (unsigned u = 1; u < rounds; u++) {
+        _sbox(q);
+        _shift_rows(q);
+        _mix_columns(q);
+        _add_round_key(q, skey + 8 * u);
+    }
+    _sbox(q);
+    _shift_rows(q);
+    _add_round_key(q, skey + 8 * rounds);
+}
+
+static void _decrypt(const uint32_t *skey, unsigned rounds, uint32_t *q)
+{
+    _add_round_key(q, skey + 8 * rounds);
+    for (unsigned u = rounds - 1; u > 0; u--) {
+        _inv_shift_rows(q);
+        _inv_sbox(q);
+        _add_round_key(q, skey + 8 * u);
+        _inv_mix_columns(q);
+    }
+    _inv_shift_rows(q);
+    _inv_sbox(q);
+    _add_round_key(q, skey);
+}
+
+/* expanded key schedule for two blocks in parallel */
+typedef struct {
+    uint32_t sk[8 * (AES_MAXNR + 1)];
+    unsigned rounds;
+} _aes_ct_key_t;
+
+static void _set_key(_aes_ct_key_t *key, const cipher_context_t *context)
+{
+    key->rounds = _keysched(key->sk, context->context, context->key_size);
+}
+
+int aes_encrypt(const cipher_context_t *context, const uint8_t *plain_block,
+                uint8_t *cipher_block)
+{
+    return aes_encrypt_blocks(context, plain_block, cipher_block, 1);
+}
+
+int aes_decrypt(const cipher_context_t *context, const uint8_t *cipher_block,
+                uint8_t *plain_block)
+{
+    return aes_decrypt_blocks(context, cipher_block, plain_block, 1);
+}
+
+int aes_encrypt_blocks(const cipher_context_t *context, const uint8_t *input,
+                       uint8_t *output, size_t num)
+{
+    _aes_ct_key_t key;
+    uint32_t q[8];
+
+    _set_key(&key, context);
+    while (num > 0) {
+        bool pair = num > 1;
+
+        _load(q, input, pair ? input + AES_BLOCK_SIZE : NULL);
+        _encrypt(key.sk, key.rounds, q);
+        _store(q, output, pair ? output + AES_BLOCK_SIZE : NULL);
+
+        input += (1 + pair) * AES_BLOCK_SIZE;
+        output += (1 + pair) * AES_BLOCK_SIZE;
+        num -= 1 + pair;
+    }
+    return 1;
+}
+
+int aes_decrypt_blocks(const cipher_context_t *context, const uint8_t *input,
+                       uint8_t *output, size_t num)
+{
+    _aes_ct_key_t key;
+    uint32_t q[8];
+
+    _set_key(&key, context);
+    while (num > 0) {
+        bool pair = num > 1;
+
+        _load(q, input, pair ? input + AES_BLOCK_SIZE : NULL);
+        _decrypt(key.sk, key.rounds, q);
+        _store(q, output, pair ? output + AES_BLOCK_SIZE : NULL);
+
+        input += (1 + pair) * AES_BLOCK_SIZE;
+        output += (1 + pair) * AES_BLOCK_SIZE;
+        num -= 1 + pair;
+    }
+    return 1;
+}
+
+int aes_encrypt_cbc(const cipher_context_t *context, uint8_t *iv,
+                    const uint8_t *input, uint8_t *output, size_t num)
+{
+    _aes_ct_key_t key;
+    uint32_t q[8];
+
+    /* CBC is sequential, only one of the two slots is used */
+    _set_key(&key, context);
+    for (; num > 0; num--, input += AES_BLOCK_SIZE) {
+        for (unsigned i = 0; i < AES_BLOCK_SIZE; i++) {
+            iv[i] ^= input[i];
+        }
+        _load(q, iv, NULL);
+        _encrypt(key.sk, key.rounds, q);
+        _store(q, iv, NULL);
+        if (output) {
+            memcpy(output, iv, AES_BLOCK_SIZE);
+            output += AES_BLOCK_SIZE;
+        }
+    }
+    return 1;
+}
@@ -43,49 +43,52 @@ static const uint32_t constant[] = {0x61707865,
 /* Padding to add to the poly1305 authentication tag */
 static const uint8_t padding[15] = {0};
 
-/* Single round */
-static void _r(uint32_t *a, uint32_t *b, uint32_t *d, unsigned c)
-{
-    *a += *b;
-    uint32_t tmp = *a ^ *d;
-    *d = (tmp << c) | (tmp >> (32 - c));
-}
+#define ROTL(x, n)  (((x) << (n)) | ((x) >> (32 - (n))))
 
-static void _add_initial(chacha20poly1305_ctx_t *ctx, const uint8_t *key,
-                         const uint8_t *nonce, uint32_t blk)
+/* Quarter round, on array elements with constant indices so that the
+ * compiler keeps the whole state in registers */
+#define QR(a, b, c, d) \
+    do { \
+        a += b; d = ROTL(d ^ a, 16); \
+        c += d; b = ROTL(b ^ c, 12); \
+        a += b; d = ROTL(d ^ a, 8); \
+        c += d; b = ROTL(b ^ c, 7); \
+    } while (0)
+
+static void _keystream(chacha20poly1305_ctx_t *ctx, const uint8_t *key,
+                       const uint8_t *nonce, uint32_t blk)
 {
+    uint32_t x[16];
+
+    /* Initialize block state */
     for (unsigned i = 0; i < 4; i++) {
-        ctx->state[i] += constant[i];
+        ctx->state[i] = constant[i];
     }
     for (unsigned i = 0; i < 8; i++) {
-        ctx->state[i+4] += unaligned_get_u32(key + 4*i);
+        ctx->state[i + 4] = unaligned_get_u32(key + 4 * i);
     }
-    ctx->state[12] += unaligned_get_u32((uint8_t*)&blk);
-    ctx->state[13] += unaligned_get_u32(nonce);
-    ctx->state[14] += unaligned_get_u32(nonce+4);
-    ctx->state[15] += unaligned_get_u32(nonce+8);
-}
+    ctx->state[12] = blk;
+    ctx->state[13] = unaligned_get_u32(nonce);
+    ctx->state[14] = unaligned_get_u32(nonce + 4);
+    ctx->state[15] = unaligned_get_u32(nonce + 8);
+    memcpy(x, ctx->state, sizeof(x));
 
-static void _keystream(chacha20poly1305_ctx_t *ctx, const uint8_t *key,
-                       const uint8_t *nonce, uint32_t blk)
-{
-    /* Initialize block state */
-    memset(ctx->state, 0, sizeof(ctx->state));
-    _add_initial(ctx, key, nonce, blk);
-
-    /* perform rounds */
-    for (unsigned i = 0; i < 80; ++i) {
-        uint32_t *a = &ctx->state[((i                    ) & 3)          ];
-        uint32_t *b = &ctx->state[((i + ((i & 4) ? 1 : 0)) & 3) + (4 * 1)];
-        uint32_t *c = &ctx->state[((i + ((i & 4) ? 2 : 0)) & 3) + (4 * 2)];
-        uint32_t *d = &ctx->state[((i + ((i & 4) ? 3 : 0)) & 3) + (4 * 3)];
-        _r(a, b, d, 16);
-        _r(c, d, b, 12);
-        _r(a, b, d, 8);
-        _r(c, d, b, 7);
+    /* perform 20 rounds, as column and diagonal double rounds */
+    for (unsigned i = 0; i < 10; i++) {
+        QR(x[0], x[4], x[8], x[12]);
+        QR(x[1], x[5], x[9], x[13]);
+        QR(x[2], x[6], x[10], x[14]);
+        QR(x[3], x[7], x[11], x[15]);
+        QR(x[0], x[5], x[10], x[15]);
+        QR(x[1], x[6], x[11], x[12]);
+        QR(x[2], x[7], x[8], x[13]);
+        QR(x[3], x[4], x[9], x[14]);
     }
     /* add initial state */
-    _add_initial(ctx, key, nonce, blk);
+    for (unsigned i = 0; i < 16; i++) {
+        ctx->state[i] += x[i];
+    }
+    crypto_secure_wipe(x, sizeof(x));
 }
 
 static void _xcrypt(chacha20poly1305_ctx_t *ctx, const uint8_t *key,
@@ -37,6 +37,73 @@ int cipher_decrypt(const cipher_t *cipher, const uint8_t *input,
     return cipher->interface->decrypt(&cipher->context, input, output);
 }
 
+int cipher_encrypt_blocks(const cipher_t *cipher, const uint8_t *input,
+                          uint8_t *output, size_t num)
+{
+    uint8_t block_size = cipher->interface->block_size;
+
+    if (cipher->interface->encrypt_blocks) {
+        return cipher->interface->encrypt_blocks(&cipher->context, input,
+                                                 output, num);
+    }
+
+    for (; num > 0; num--, input += block_size, output += block_size) {
+        int res = cipher_encrypt(cipher, input, output);
+        if (res != 1) {
+            return res;
+        }
+    }
+    return 1;
+}
+
+int cipher_decrypt_blocks(const cipher_t *cipher, const uint8_t *input,
+                          uint8_t *output, size_t num)
+{
+    uint8_t block_size = cipher->interface->block_size;
+
+    if (cipher->interface->decrypt_blocks) {
+        return cipher->interface->decrypt_blocks(&cipher->context, input,
+                                                 output, num);
+    }
+
+    for (; num > 0; num--, input += block_size, output += block_size) {
+        int res = cipher_decrypt(cipher, input, output);
+        if (res != 1) {
+            return res;
+        }
+    }
+    return 1;
+}
+
+int cipher_encrypt_cbc_blocks(const cipher_t *cipher, uint8_t *iv,
+                              const uint8_t *input, uint8_t *output, size_t num)
+{
+    uint8_t block_size = cipher->interface->block_size;
+
+    if (cipher->interface->encrypt_cbc) {
+        return cipher->interface->encrypt_cbc(&cipher->context, iv, input,
+                                              output, num);
+    }
+
+    for (; num > 0; num--, input += block_size) {
+        uint8_t block[CIPHER_MAX_BLOCK_SIZE];
+
+        for (unsigned i = 0; i < block_size; i++) {
+            block[i] = iv[i] ^ input[i];
+        }
+
+        int res = cipher_encrypt(cipher, block, iv);
+        if (res != 1) {
+            return res;
+        }
+        if (output) {
+            memcpy(output, iv, block_size);
+            output += block_size;
+        }
+    }
+    return 1;
+}
+
 int cipher_get_block_size(const cipher_t *cipher)
 {
     return cipher->interface->block_size;
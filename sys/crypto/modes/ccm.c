@@ -39,23 +39,22 @@ static int ccm_compute_cbc_mac(const cipher_t *cipher, const uint8_t iv[16],
                                const uint8_t *input, size_t length, uint8_t *mac)
 {
     uint8_t block_size, mac_enc[16] = { 0 };
-    uint32_t offset;
+    size_t full, offset;
 
     block_size = cipher_get_block_size(cipher);
     memmove(mac, iv, 16);
-    offset = 0;
 
-    /* no input message */
-    if(length == 0) {
-        return 0;
+    /* CBC-Mode over all complete blocks in one go */
+    full = length / block_size;
+    if ((full > 0) &&
+        (cipher_encrypt_cbc_blocks(cipher, mac, input, NULL, full) != 1)) {
+        return CIPHER_ERR_ENC_FAILED;
     }
+    offset = full * block_size;
 
-    do {
-        uint8_t block_size_input = (length - offset > block_size) ?
-                                   block_size : length - offset;
-
-        /* CBC-Mode: XOR plaintext with ciphertext of (n-1)-th block */
-        for (int i = 0; i < block_size_input; ++i) {
+    /* the last block is zero padded */
+    if (offset < length) {
+        for (unsigned i = 0; i < length - offset; ++i) {
             mac[i] ^= input[offset + i];
         }
 
@@ -64,8 +63,8 @@ static int ccm_compute_cbc_mac(const cipher_t *cipher, const uint8_t iv[16],
         }
 
         memcpy(mac, mac_enc, block_size);
-        offset += block_size_input;
-    } while (offset < length);
+        offset = length;
+    }
 
     return offset;
 }
@@ -103,13 +103,25 @@ static void _take_input(poly1305_ctx_t *ctx, uint8_t input)
 
 void poly1305_update(poly1305_ctx_t *ctx, const uint8_t *data, size_t len)
 {
-    for (size_t i = 0; i < len; i++) {
-        _take_input(ctx, data[i]);
+    /* complete a block left over from the last call */
+    for (; (ctx->c_idx != 0) && (len > 0); len--) {
+        _take_input(ctx, *data++);
         if (ctx->c_idx == 16) {
             poly1305_block(ctx, 1);
             _clear_c(ctx);
         }
     }
+    /* whole blocks are loaded word by word */
+    for (; len >= 16; data += 16, len -= 16) {
+        for (size_t i = 0; i < 4; i++) {
+            ctx->c[i] = u8to32(&data[4 * i]);
+        }
+        poly1305_block(ctx, 1);
+        _clear_c(ctx);
+    }
+    for (; len > 0; len--) {
+        _take_input(ctx, *data++);
+    }
 }
 
 void poly1305_init(poly1305_ctx_t *ctx, const uint8_t *key)
@@ -16,8 +16,13 @@
  * @author      Marian Buschsieweke <marian.buschsieweke@ovgu.de>
  */
 
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "cond.h"
+#include "mutex.h"
 #include "test_utils/expect.h"
-#include "rmutex.h"
+#include "thread.h"
 
 #ifdef CXX_CTOR_GUARDS_CUSTOM_TYPE
 /* Some architectures (such as ARM) have custom types for __guard in their
@@ -32,51 +37,101 @@ __extension__ typedef int __guard __attribute__((mode(__DI__)));
  * with the official type definition */
 #endif
 
-#define GUARD_DONE      0x01
-#define GUARD_PENDING   0x02
+/* The code emitted by the compiler only checks the first byte (or its lowest
+ * bit on ARM) to skip the call to __cxa_guard_acquire(), so it must only be
+ * set once the initialization is done. The state of a pending initialization
+ * is kept in the second byte and the thread running it in the next two. */
+typedef struct {
+    uint8_t done;
+    uint8_t state;
+    kernel_pid_t owner;
+} guard_t;
 
-/* A recursive mutex is needed, as the initialization of a static class could
- * require calling ctors of members of that class. With a regular mutex, this
- * would result in a deadlock.
- */
-static rmutex_t cxa_rmutex = RMUTEX_INIT;
+_Static_assert(sizeof(guard_t) <= sizeof(__guard), "__guard too small");
+
+#define GUARD_PENDING   0x01
+#define GUARD_WAITING   0x02
+
+/* Only threads waiting for an initialization running in a different thread
+ * need these. As each static has its own guard, initializing a static that
+ * requires initializing a different one (e.g. a member) needs no lock. */
+static mutex_t _lock = MUTEX_INIT;
+static cond_t _cond = COND_INIT;
+
+static bool _claim(guard_t *guard, uint8_t expected)
+{
+    if (__atomic_compare_exchange_n(&guard->state, &expected, GUARD_PENDING,
+                                    false, __ATOMIC_ACQUIRE,
+                                    __ATOMIC_RELAXED)) {
+        guard->owner = thread_getpid();
+        return true;
+    }
+    return false;
+}
+
+static void _finish(guard_t *guard)
+{
+    guard->owner = KERNEL_PID_UNDEF;
+    if (__atomic_exchange_n(&guard->state, 0, __ATOMIC_ACQ_REL)
+        & GUARD_WAITING) {
+        mutex_lock(&_lock);
+        cond_broadcast(&_cond);
+        mutex_unlock(&_lock);
+    }
+}
 
 int __cxa_guard_acquire(__guard *g)
 {
-    uint8_t *guard = (uint8_t *)g;
-    /* Optimize for the case that the instance is already initialized by
-     * doing a lock-free check. */
-    if (__atomic_load_1(guard, __ATOMIC_SEQ_CST) & GUARD_DONE) {
+    guard_t *guard = (guard_t *)g;
+
+    if (__atomic_load_n(&guard->done, __ATOMIC_ACQUIRE)) {
         return 0;
     }
 
-    rmutex_lock(&cxa_rmutex);
-    /* Check again (this time protected by the rmutex) for the instance being
-     * already initialized */
-    if (*guard & GUARD_DONE) {
-        rmutex_unlock(&cxa_rmutex);
-        return 0;
+    /* uncontended: a single CAS and no lock */
+    if (_claim(guard, 0)) {
+        return 1;
     }
 
-    if (*guard & GUARD_PENDING) {
+    mutex_lock(&_lock);
+    while (!__atomic_load_n(&guard->done, __ATOMIC_ACQUIRE)) {
+        uint8_t state = __atomic_load_n(&guard->state, __ATOMIC_RELAXED);
+
+        if (state == 0) {
+            /* the initialization was aborted, try again */
+            if (_claim(guard, 0)) {
+                mutex_unlock(&_lock);
+                return 1;
+            }
+            continue;
+        }
+
         /* Recursive initialization of the *same* instance --> bug */
-        expect(0);
+        expect(guard->owner != thread_getpid());
+
+        if (!(state & GUARD_WAITING)
+            && !__atomic_compare_exchange_n(&guard->state, &state,
+                                            state | GUARD_WAITING, false,
+                                            __ATOMIC_RELAXED,
+                                            __ATOMIC_RELAXED)) {
+            continue;
+        }
+        cond_wait(&_cond, &_lock);
     }
+    mutex_unlock(&_lock);
 
-    *guard = GUARD_PENDING;
-    return 1;
+    return 0;
 }
 
 void __cxa_guard_release(__guard *g)
 {
-    uint8_t *guard = (uint8_t *)g;
-    *guard = GUARD_DONE;
-    rmutex_unlock(&cxa_rmutex);
+    guard_t *guard = (guard_t *)g;
+
+    __atomic_store_n(&guard->done, 1, __ATOMIC_RELEASE);
+    _finish(guard);
 }
 
 void __cxa_guard_abort(__guard *g)
 {
-    uint8_t *guard = (uint8_t *)g;
-    *guard = 0;
-    rmutex_unlock(&cxa_rmutex);
+    _finish((guard_t *)g);
 }
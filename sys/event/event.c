@@ -32,14 +32,141 @@
 #if IS_USED(MODULE_XTIMER)
 #include "xtimer.h"
 #endif
+#if IS_USED(MODULE_EVENT_STATS)
+#include "ztimer.h"
+#endif
+
+#if IS_USED(MODULE_EVENT_DLIST)
+/* The queue is still a clist with event_list.next pointing to the last event,
+ * every event additionally points to the list entry of its predecessor. */
+static inline event_t *_event(clist_node_t *node)
+{
+    return container_of(node, event_t, list_node);
+}
+
+static void _enqueue(event_queue_t *queue, event_t *event)
+{
+    clist_node_t *last = queue->event_list.next;
+    clist_node_t *node = &event->list_node;
+
+    if (!last) {
+        node->next = node;
+        event->prev = node;
+        queue->event_list.next = node;
+        return;
+    }
+
+    /* insert behind the last event of at least the same priority */
+    clist_node_t *pred = last;
+    bool is_last = true;
+
+    while (_event(pred)->priority < event->priority) {
+        pred = _event(pred)->prev;
+        is_last = false;
+        if (pred == last) {
+            /* all events are of lower priority, insert as first */
+            break;
+        }
+    }
+
+    node->next = pred->next;
+    _event(node->next)->prev = node;
+    pred->next = node;
+    event->prev = pred;
+    if (is_last) {
+        queue->event_list.next = node;
+    }
+}
+
+static clist_node_t *_lpop(event_queue_t *queue)
+{
+    clist_node_t *last = queue->event_list.next;
+
+    if (!last) {
+        return NULL;
+    }
+
+    clist_node_t *first = last->next;
+
+    if (first == last) {
+        queue->event_list.next = NULL;
+    }
+    else {
+        last->next = first->next;
+        _event(first->next)->prev = last;
+    }
+    return first;
+}
+
+static void _remove(event_queue_t *queue, event_t *event)
+{
+    clist_node_t *node = &event->list_node;
+
+    if (!node->next) {
+        return;
+    }
+
+    if (event->prev == node) {
+        queue->event_list.next = NULL;
+    }
+    else {
+        event->prev->next = node->next;
+        _event(node->next)->prev = event->prev;
+        if (queue->event_list.next == node) {
+            queue->event_list.next = event->prev;
+        }
+    }
+}
+#else
+static inline void _enqueue(event_queue_t *queue, event_t *event)
+{
+    clist_rpush(&queue->event_list, &event->list_node);
+}
+
+static inline clist_node_t *_lpop(event_queue_t *queue)
+{
+    return clist_lpop(&queue->event_list);
+}
+
+static inline void _remove(event_queue_t *queue, event_t *event)
+{
+    clist_remove(&queue->event_list, &event->list_node);
+}
+#endif
+
+/* must be called with interrupts disabled */
+static event_t *_dequeue(event_queue_t *queue)
+{
+    event_t *result = container_of(_lpop(queue), event_t, list_node);
+
+#if IS_USED(MODULE_EVENT_STATS)
+    if (result) {
+        uint32_t latency = ztimer_now(ZTIMER_USEC) - result->posted_at;
+        queue->stats.dispatched++;
+        queue->stats.latency_sum += latency;
+        if (latency > queue->stats.latency_max) {
+            queue->stats.latency_max = latency;
+        }
+    }
+#endif
+
+    return result;
+}
 
 void event_post(event_queue_t *queue, event_t *event)
 {
     assert(queue && event);
 
+#if IS_USED(MODULE_EVENT_STATS)
+    uint32_t now = ztimer_now(ZTIMER_USEC);
+#endif
+
     unsigned state = irq_disable();
     if (!event->list_node.next) {
-        clist_rpush(&queue->event_list, &event->list_node);
+        _enqueue(queue, event);
+#if IS_USED(MODULE_EVENT_STATS)
+        event->posted_at = now;
+#endif
     }
     thread_t *waiter = queue->waiter;
     irq_restore(state);
@@ -55,7 +182,7 @@ void event_cancel(event_queue_t *queue, event_t *event)
     assert(event);
 
     unsigned state = irq_disable();
-    clist_remove(&queue->event_list, &event->list_node);
+    _remove(queue, event);
     event->list_node.next = NULL;
     irq_restore(state);
 }
@@ -74,7 +201,7 @@ bool event_is_queued(const event_queue_t *queue, const event_t *event)
 event_t *event_get(event_queue_t *queue)
 {
     unsigned state = irq_disable();
-    event_t *result = (event_t *) clist_lpop(&queue->event_list);
+    event_t *result = _dequeue(queue);
     irq_restore(state);
 
     if (result) {
@@ -83,17 +210,18 @@ event_t *event_get(event_queue_t *queue)
     return result;
 }
 
-event_t *event_wait_multi(event_queue_t *queues, size_t n_queues)
+static event_t *_wait_multi(event_queue_t *queues, size_t n_queues,
+                            size_t *index)
 {
     assert(queues && n_queues);
     event_t *result = NULL;
+    size_t i;
 
     do {
         unsigned state = irq_disable();
-        for (size_t i = 0; i < n_queues; i++) {
+        for (i = 0; i < n_queues; i++) {
             assert(queues[i].waiter);
-            result = container_of(clist_lpop(&queues[i].event_list),
-                                  event_t, list_node);
+            result = _dequeue(&queues[i]);
             if (result) {
                 break;
             }
@@ -105,9 +233,54 @@ event_t *event_wait_multi(event_queue_t *queues, size_t n_queues)
     } while (result == NULL);
 
     result->list_node.next = NULL;
+    *index = i;
     return result;
 }
 
+event_t *event_wait_multi(event_queue_t *queues, size_t n_queues)
+{
+    size_t index;
+
+    return _wait_multi(queues, n_queues, &index);
+}
+
+unsigned event_process_multi(event_queue_t *queues, size_t n_queues,
+                             unsigned max)
+{
+    assert(max);
+    size_t index;
+    unsigned handled = 0;
+    event_t *event = _wait_multi(queues, n_queues, &index);
+
+    do {
+        event->handler(event);
+        handled++;
+    } while ((handled < max) && (event = event_get(&queues[index])));
+
+    return handled;
+}
+
+#if IS_USED(MODULE_EVENT_STATS)
+void event_queue_get_stats(const event_queue_t *queue,
+                           event_queue_stats_t *stats)
+{
+    assert(queue && stats);
+
+    unsigned state = irq_disable();
+    *stats = queue->stats;
+    irq_restore(state);
+}
+
+void event_queue_reset_stats(event_queue_t *queue)
+{
+    assert(queue);
+
+    unsigned state = irq_disable();
+    memset(&queue->stats, 0, sizeof(queue->stats));
+    irq_restore(state);
+}
+#endif
+
 #if IS_USED(MODULE_XTIMER) || IS_USED(MODULE_ZTIMER)
 static event_t *_wait_timeout(event_queue_t *queue)
 {
@@ -47,3 +47,11 @@ void event_timeout_clear(event_timeout_t *event_timeout)
         ztimer_remove(event_timeout->clock, &event_timeout->timer);
     }
 }
+
+void event_timeout_cancel(event_timeout_t *event_timeout)
+{
+    event_timeout_clear(event_timeout);
+    if (event_timeout->queue) {
+        event_cancel(event_timeout->queue, event_timeout->event);
+    }
+}
@@ -30,6 +30,7 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+#if !IS_USED(MODULE_EVTIMER_HEAP)
 static void _add_event_to_list(evtimer_t *evtimer, evtimer_event_t *event)
 {
     DEBUG("evtimer: new event offset %" PRIu32 " ms\n", event->offset);
@@ -90,6 +91,11 @@ static void _del_event_from_list(evtimer_t *evtimer, evtimer_event_t *event)
     }
 }
 
+static inline evtimer_event_t *_first(const evtimer_t *evtimer)
+{
+    return evtimer->events;
+}
+
 static void _set_timer(evtimer_t *evtimer)
 {
     evtimer_event_t *next_event = evtimer->events;
@@ -98,16 +104,6 @@ static void _set_timer(evtimer_t *evtimer)
           evtimer->base, next_event->offset);
 }
 
-static void _update_timer(evtimer_t *evtimer)
-{
-    if (evtimer->events) {
-        _set_timer(evtimer);
-    }
-    else {
-        ztimer_remove(ZTIMER_MSEC, &evtimer->timer);
-    }
-}
-
 static void _update_head_offset(evtimer_t *evtimer)
 {
     if (evtimer->events) {
@@ -123,6 +119,230 @@ static void _update_head_offset(evtimer_t *evtimer)
     }
 }
 
+static void _expire_first(evtimer_t *evtimer)
+{
+    /* this function gets called directly by xtimer if the set xtimer expired.
+     * Thus the offset of the first event is down to zero. */
+    evtimer->events->offset = 0;
+}
+
+#else /* IS_USED(MODULE_EVTIMER_HEAP) */
+
+/* Events that are not yet due are kept in a pairing heap keyed by their
+ * absolute trigger time in offset, events that are due on the list of
+ * evtimer->events with an offset of 0. Events at the root of the heap and on
+ * the list have no parent, prev points to _no_parent instead. */
+static evtimer_event_t _no_parent;
+
+static inline uint32_t _key(const evtimer_t *evtimer,
+                            const evtimer_event_t *event)
+{
+    return event->offset - evtimer->base;
+}
+
+static inline evtimer_event_t *_first(const evtimer_t *evtimer)
+{
+    return evtimer->events ? evtimer->events : evtimer->heap;
+}
+
+static evtimer_event_t *_heap_meld(const evtimer_t *evtimer,
+                                   evtimer_event_t *a, evtimer_event_t *b)
+{
+    if (!a) {
+        return b;
+    }
+    if (!b) {
+        return a;
+    }
+    if (_key(evtimer, b) < _key(evtimer, a)) {
+        evtimer_event_t *tmp = a;
+        a = b;
+        b = tmp;
+    }
+
+    /* make b the first child of a */
+    b->next = a->child;
+    if (b->next) {
+        b->next->prev = b;
+    }
+    b->prev = a;
+    a->child = b;
+
+    return a;
+}
+
+/* meld a list of sibling heaps into one (two-pass pairing) */
+static evtimer_event_t *_heap_merge_pairs(const evtimer_t *evtimer,
+                                          evtimer_event_t *first)
+{
+    evtimer_event_t *pairs = NULL;
+    evtimer_event_t *root = NULL;
+
+    /* first pass: meld siblings pairwise from left to right, collecting the
+     * results on a stack linked through next */
+    while (first) {
+        evtimer_event_t *a = first;
+        evtimer_event_t *b = a->next;
+
+        first = b ? b->next : NULL;
+        a->next = NULL;
+        if (b) {
+            b->next = NULL;
+        }
+        a = _heap_meld(evtimer, a, b);
+        a->next = pairs;
+        pairs = a;
+    }
+
+    /* second pass: meld the pairs from right to left */
+    while (pairs) {
+        evtimer_event_t *a = pairs;
+
+        pairs = a->next;
+        a->next = NULL;
+        root = _heap_meld(evtimer, root, a);
+    }
+
+    return root;
+}
+
+static void _heap_set_root(evtimer_t *evtimer, evtimer_event_t *root)
+{
+    evtimer->heap = root;
+    if (root) {
+        root->prev = &_no_parent;
+    }
+}
+
+static void _heap_remove(evtimer_t *evtimer, evtimer_event_t *event)
+{
+    evtimer_event_t *children = _heap_merge_pairs(evtimer, event->child);
+
+    if (event == evtimer->heap) {
+        _heap_set_root(evtimer, children);
+    }
+    else {
+        /* unlink the event from its parent's list of children */
+        if (event->prev->child == event) {
+            event->prev->child = event->next;
+        }
+        else {
+            event->prev->next = event->next;
+        }
+        if (event->next) {
+            event->next->prev = event->prev;
+        }
+        _heap_set_root(evtimer, _heap_meld(evtimer, evtimer->heap, children));
+    }
+
+    event->next = NULL;
+    event->child = NULL;
+    event->prev = NULL;
+}
+
+static void _due_append(evtimer_t *evtimer, evtimer_event_t *event)
+{
+    evtimer_event_t **list = &evtimer->events;
+
+    while (*list) {
+        list = &(*list)->next;
+    }
+
+    event->offset = 0;
+    event->next = NULL;
+    event->child = NULL;
+    event->prev = &_no_parent;
+    *list = event;
+}
+
+static void _add_event_to_list(evtimer_t *evtimer, evtimer_event_t *event)
+{
+    DEBUG("evtimer: new event offset %" PRIu32 " ms\n", event->offset);
+
+    if (event->offset == 0) {
+        _due_append(evtimer, event);
+    }
+    else {
+        event->offset += evtimer->base;
+        event->next = NULL;
+        event->child = NULL;
+        _heap_set_root(evtimer, _heap_meld(evtimer, evtimer->heap, event));
+    }
+}
+
+static void _del_event_from_list(evtimer_t *evtimer, evtimer_event_t *event)
+{
+    if (!event->prev) {
+        /* not pending */
+        return;
+    }
+
+    if ((event->prev == &_no_parent) && (event != evtimer->heap)) {
+        evtimer_event_t **list = &evtimer->events;
+
+        while (*list != event) {
+            list = &(*list)->next;
+        }
+        *list = event->next;
+        event->next = NULL;
+        event->prev = NULL;
+    }
+    else {
+        _heap_remove(evtimer, event);
+    }
+}
+
+static void _set_timer(evtimer_t *evtimer)
+{
+    /* the keys of the heap are relative to base, so base is not updated to
+     * the time returned by ztimer_set() */
+    uint32_t offset = evtimer->events ? 0 : _key(evtimer, evtimer->heap);
+
+    ztimer_set(ZTIMER_MSEC, &evtimer->timer, offset);
+    DEBUG("evtimer: now=%" PRIu32 " ms setting ztimer to %" PRIu32 " ms\n",
+          evtimer->base, offset);
+}
+
+static void _update_head_offset(evtimer_t *evtimer)
+{
+    uint32_t now = ztimer_now(ZTIMER_MSEC);
+    uint32_t elapsed = now - evtimer->base;
+
+    /* move all events that are due to the list, in order of their trigger
+     * time, so that no key of the heap is older than base */
+    while (evtimer->heap && (_key(evtimer, evtimer->heap) <= elapsed)) {
+        evtimer_event_t *event = evtimer->heap;
+
+        _heap_remove(evtimer, event);
+        _due_append(evtimer, event);
+    }
+    evtimer->base = now;
+}
+
+static void _expire_first(evtimer_t *evtimer)
+{
+    _update_head_offset(evtimer);
+    /* the timer expired, so the first event is due even if the clock has
+     * not caught up yet */
+    if (!evtimer->events && evtimer->heap) {
+        evtimer_event_t *event = evtimer->heap;
+
+        _heap_remove(evtimer, event);
+        _due_append(evtimer, event);
+    }
+}
+#endif /* IS_USED(MODULE_EVTIMER_HEAP) */
+
+static void _update_timer(evtimer_t *evtimer)
+{
+    if (_first(evtimer)) {
+        _set_timer(evtimer);
+    }
+    else {
+        ztimer_remove(ZTIMER_MSEC, &evtimer->timer);
+    }
+}
+
 void evtimer_add(evtimer_t *evtimer, evtimer_event_t *event)
 {
     unsigned state = irq_disable();
@@ -131,7 +351,7 @@ void evtimer_add(evtimer_t *evtimer, evtimer_event_t *event)
 
     _update_head_offset(evtimer);
     _add_event_to_list(evtimer, event);
-    if (evtimer->events == event) {
+    if (_first(evtimer) == event) {
         _set_timer(evtimer);
     }
     irq_restore(state);
@@ -158,6 +378,10 @@ static evtimer_event_t *_get_next(evtimer_t *evtimer)
 
     if (event && (event->offset == 0)) {
         evtimer->events = event->next;
+#if IS_USED(MODULE_EVTIMER_HEAP)
+        event->next = NULL;
+        event->prev = NULL;
+#endif
         return event;
     }
     else {
@@ -170,17 +394,19 @@ static void _evtimer_handler(void *arg)
     DEBUG("_evtimer_handler()\n");
 
     evtimer_t *evtimer = (evtimer_t *)arg;
+    evtimer_event_t *event;
 
-    /* this function gets called directly by xtimer if the set xtimer expired.
-     * Thus the offset of the first event is down to zero. */
-    evtimer_event_t *event = evtimer->events;
-    event->offset = 0;
+    _expire_first(evtimer);
 
     /* iterate the event list */
     while ((event = _get_next(evtimer))) {
         evtimer->callback(event);
     }
 
+#if IS_USED(MODULE_EVTIMER_HEAP)
+    /* account for the time spent in the callbacks */
+    _update_head_offset(evtimer);
+#endif
     _update_timer(evtimer);
 }
 
@@ -190,10 +416,90 @@ void evtimer_init(evtimer_t *evtimer, evtimer_callback_t handler)
     evtimer->timer.callback = _evtimer_handler;
     evtimer->timer.arg = (void *)evtimer;
     evtimer->events = NULL;
+#if IS_USED(MODULE_EVTIMER_HEAP)
+    evtimer->heap = NULL;
+#endif
+}
+
+bool evtimer_is_pending(const evtimer_t *evtimer, const evtimer_event_t *event)
+{
+#if IS_USED(MODULE_EVTIMER_HEAP)
+    (void)evtimer;
+    return event->prev != NULL;
+#else
+    for (const evtimer_event_t *list = evtimer->events; list;
+         list = list->next) {
+        if (list == event) {
+            return true;
+        }
+    }
+    return false;
+#endif
+}
+
+evtimer_event_t *evtimer_iter(const evtimer_t *evtimer,
+                              const evtimer_event_t *event)
+{
+#if IS_USED(MODULE_EVTIMER_HEAP)
+    if (!event) {
+        return _first(evtimer);
+    }
+    if ((event->prev == &_no_parent) && (event != evtimer->heap)) {
+        /* on the due list, the heap follows */
+        return event->next ? event->next : evtimer->heap;
+    }
+
+    /* pre-order traversal of the heap */
+    if (event->child) {
+        return event->child;
+    }
+    while (event != evtimer->heap) {
+        if (event->next) {
+            return event->next;
+        }
+        /* climb up to the parent via the leftmost sibling */
+        while (event->prev->child != event) {
+            event = event->prev;
+        }
+        event = event->prev;
+    }
+    return NULL;
+#else
+    return event ? event->next : evtimer->events;
+#endif
+}
+
+uint32_t evtimer_event_offset(const evtimer_t *evtimer,
+                              const evtimer_event_t *event)
+{
+#if IS_USED(MODULE_EVTIMER_HEAP)
+    return event->offset ? _key(evtimer, event) : 0;
+#else
+    uint32_t offset = 0;
+
+    for (const evtimer_event_t *list = evtimer->events; list;
+         list = list->next) {
+        offset += list->offset;
+        if (list == event) {
+            break;
+        }
+    }
+    return offset;
+#endif
 }
 
 void evtimer_print(const evtimer_t *evtimer)
 {
+#if IS_USED(MODULE_EVTIMER_HEAP)
+    int nr = 0;
+
+    for (evtimer_event_t *event = evtimer_iter(evtimer, NULL); event;
+         event = evtimer_iter(evtimer, event)) {
+        nr++;
+        printf("ev #%d offset=%u\n", nr,
+               (unsigned)evtimer_event_offset(evtimer, event));
+    }
+#else
     evtimer_event_t *list = evtimer->events;
     int nr = 0;
 
@@ -202,4 +508,5 @@ void evtimer_print(const evtimer_t *evtimer)
         printf("ev #%d offset=%u\n", nr, (unsigned)list->offset);
         list = list->next;
     }
+#endif
 }
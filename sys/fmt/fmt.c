@@ -45,6 +45,31 @@ static const uint32_t _tenmap[] = {
 
 #define TENMAP_SIZE  ARRAY_SIZE(_tenmap)
 
+static const uint32_t _pow10[] = {
+    10LU,
+    100LU,
+    1000LU,
+    10000LU,
+    100000LU,
+    1000000LU,
+    10000000LU,
+    100000000LU,
+    1000000000LU,
+};
+
+static const char _digit_pairs[200] = {
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899"
+};
+
 static inline char _to_lower(char c)
 {
     return 'a' + (c - 'A');
@@ -193,11 +218,42 @@ size_t fmt_u64_hex(char *out, uint64_t val)
     return fmt_bytes_hex_reverse(out, (uint8_t *)&val, 8);
 }
 
+/* number of decimal digits of val, without any division */
+static size_t _dec_len(uint32_t val)
+{
+    size_t len = 1;
+
+    while ((len <= ARRAY_SIZE(_pow10)) && (val >= _pow10[len - 1])) {
+        len++;
+    }
+
+    return len;
+}
+
+/* write the lowest len (<= 4) digits of val (< 10000) to out, two at a time.
+ * (x * 5243) >> 19 equals x / 100 for x < 43699 and only needs a 32 bit
+ * multiplication, which is much cheaper than a software division on cores
+ * without a divider (e.g. Cortex-M0) */
+static void _fmt_dec4(char *out, uint32_t val, size_t len)
+{
+    char *ptr = out + len;
+
+    while (len >= 2) {
+        uint32_t q = (val * 5243) >> 19;
+        ptr -= 2;
+        memcpy(ptr, &_digit_pairs[2 * (val - q * 100)], 2);
+        val = q;
+        len -= 2;
+    }
+    if (len) {
+        *--ptr = '0' + val;
+    }
+}
+
 size_t fmt_u64_dec(char *out, uint64_t val)
 {
     uint32_t d[5];
     uint32_t q;
-    size_t len = 0;
 
     d[0] = val         & 0xFFFF;
     d[1] = (val >> 16) & 0xFFFF;
@@ -228,18 +284,14 @@ size_t fmt_u64_dec(char *out, uint64_t val)
         first--;
     }
 
-    len = fmt_u32_dec(out, d[first]);
-    int total_len = len + (first * 4);
+    size_t len = fmt_u32_dec(out, d[first]);
+    size_t total_len = len + (first * 4);
 
     if (out) {
         out += len;
-        memset(out, '0', total_len - len);
         while (first) {
             first--;
-            if (d[first]) {
-                size_t tmp = fmt_u32_dec(NULL, d[first]);
-                fmt_u32_dec(out + (4 - tmp), d[first]);
-            }
+            _fmt_dec4(out, d[first], 4);
             out += 4;
         }
     }
@@ -249,24 +301,20 @@ size_t fmt_u64_dec(char *out, uint64_t val)
 
 size_t fmt_u32_dec(char *out, uint32_t val)
 {
-    size_t len = 1;
-
-    /* count needed characters */
-    /* avoid multiply overflow: uint32_t max len = 10 digits */
-    if (val >= 1000000000ul) {
-        len = 10;
-    }
-    else {
-        for (uint32_t tmp = 10; tmp <= val; len++) {
-            tmp *= 10;
-        }
-    }
+    size_t len = _dec_len(val);
 
     if (out) {
         char *ptr = out + len;
-        do {
-            *--ptr = (val % 10) + '0';
-        } while ((val /= 10));
+        /* split off groups of four digits, the division by a constant is
+         * turned into a multiplication by the compiler where the core has a
+         * long multiply */
+        while (val >= 10000) {
+            uint32_t q = val / 10000;
+            ptr -= 4;
+            _fmt_dec4(ptr, val - q * 10000, 4);
+            val = q;
+        }
+        _fmt_dec4(out, val, ptr - out);
     }
 
     return len;
@@ -341,37 +389,30 @@ size_t fmt_s32_dfp(char *out, int32_t val, int scale)
         int negative = val < 0;
         uint32_t uval = negative ? -val : val;
         int len = fmt_u32_dec(buf, uval);
-        if (negative) {
-            if (out) {
-                out[pos] = '-';
+        int int_len = (len > scale) ? len - scale : 0;
+        int zeroes = (len < scale) ? scale - len : 0;
+        if (out) {
+            char *ptr = out;
+            if (negative) {
+                *ptr++ = '-';
             }
-            pos++;
-        }
-        if (len <= scale) {
-            int zeroes = scale - len + 1;
-            if (out) {
-                memset(&out[pos], '0', zeroes);
+            if (int_len) {
+                memcpy(ptr, buf, int_len);
+                ptr += int_len;
             }
-            pos += zeroes;
-        }
-        if (out) {
-            memcpy(&out[pos], buf, len);
-        }
-
-        pos += len;
-
-        if (out) {
-            unsigned dot_pos = pos - scale;
-            for (unsigned i = pos; i >= dot_pos; i--) {
-                out[i] = out[i - 1];
+            else {
+                *ptr++ = '0';
             }
-            out[dot_pos] = '.';
+            *ptr++ = '.';
+            memset(ptr, '0', zeroes);
+            memcpy(ptr + zeroes, &buf[int_len], len - int_len);
         }
-        pos += 1;
+        pos = negative + (int_len ? int_len : 1) + 1 + scale;
     }
 
     return pos;
 }
+
 /* this is very probably not the most efficient implementation, as it at least
  * pulls in floating point math.  But it works, and it's always nice to have
  * low hanging fruits when optimizing. (Kaspar)
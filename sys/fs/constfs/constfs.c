@@ -42,10 +42,12 @@ static int constfs_fstat(vfs_file_t *filp, struct stat *buf);
 static off_t constfs_lseek(vfs_file_t *filp, off_t off, int whence);
 static int constfs_open(vfs_file_t *filp, const char *name, int flags, mode_t mode);
 static ssize_t constfs_read(vfs_file_t *filp, void *dest, size_t nbytes);
+static int constfs_mmap(vfs_file_t *filp, off_t off, size_t len, const void **addr);
 
 /* Directory operations */
 static int constfs_opendir(vfs_DIR *dirp, const char *dirname);
 static int constfs_readdir(vfs_DIR *dirp, vfs_dirent_t *entry);
+static int constfs_readdir_stat(vfs_DIR *dirp, vfs_dirent_t *entry, struct stat *buf);
 
 static const vfs_file_system_ops_t constfs_fs_ops = {
     .statvfs = constfs_statvfs,
@@ -57,11 +59,13 @@ static const vfs_file_ops_t constfs_file_ops = {
     .lseek = constfs_lseek,
     .open  = constfs_open,
     .read  = constfs_read,
+    .mmap  = constfs_mmap,
 };
 
 static const vfs_dir_ops_t constfs_dir_ops = {
     .opendir = constfs_opendir,
     .readdir = constfs_readdir,
+    .readdir_stat = constfs_readdir_stat,
 };
 
 const vfs_file_system_t constfs_file_system = {
@@ -203,6 +207,18 @@ static ssize_t constfs_read(vfs_file_t *filp, void *dest, size_t nbytes)
     return nbytes;
 }
 
+static int constfs_mmap(vfs_file_t *filp, off_t off, size_t len, const void **addr)
+{
+    constfs_file_t *fp = filp->private_data.ptr;
+    DEBUG("constfs_mmap: %p, %ld, %" PRIuSIZE "\n", (void *)filp, (long)off, len);
+    if ((size_t)off > fp->size || len > fp->size - off) {
+        return -ENXIO;
+    }
+    /* the file data is stored as is, no copy needed */
+    *addr = (const uint8_t *)fp->data + off;
+    return 0;
+}
+
 static int constfs_opendir(vfs_DIR *dirp, const char *dirname)
 {
     DEBUG("constfs_opendir: %p, \"%s\"\n", (void *)dirp, dirname);
@@ -244,6 +260,16 @@ static int constfs_readdir(vfs_DIR *dirp, vfs_dirent_t *entry)
     return 1;
 }
 
+static int constfs_readdir_stat(vfs_DIR *dirp, vfs_dirent_t *entry, struct stat *buf)
+{
+    int res = constfs_readdir(dirp, entry);
+    if (res == 1) {
+        constfs_t *fs = dirp->mp->private_data;
+        _constfs_write_stat(&fs->files[entry->d_ino], buf);
+    }
+    return res;
+}
+
 static void _constfs_write_stat(const constfs_file_t *fp, struct stat *restrict buf)
 {
     /* buffer is cleared by vfs already */
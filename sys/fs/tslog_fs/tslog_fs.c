@@ -0,0 +1,208 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_fs_tslog
+ * @{
+ *
+ * @file
+ * @brief       tslog VFS view implementation
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "fs/tslog_fs.h"
+#include "macros/utils.h"
+#include "vfs.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define FILE_NAME   "log"
+
+static void _write_stat(const tslog_t *log, struct stat *buf)
+{
+    /* the size is not known without reading the whole log */
+    buf->st_nlink = 1;
+    buf->st_mode = S_IFREG | S_IRUSR | S_IRGRP | S_IROTH;
+    buf->st_blksize = log->mtd->page_size;
+}
+
+static int _stat(vfs_mount_t *mountp, const char *restrict name, struct stat *restrict buf)
+{
+    if (strcmp(name, "/" FILE_NAME) != 0) {
+        return -ENOENT;
+    }
+    _write_stat(mountp->private_data, buf);
+    return 0;
+}
+
+static int _statvfs(vfs_mount_t *mountp, const char *restrict path, struct statvfs *restrict buf)
+{
+    (void)path;
+    tslog_t *log = mountp->private_data;
+
+    buf->f_bsize = log->mtd->pages_per_sector * log->mtd->page_size;
+    buf->f_frsize = buf->f_bsize;
+    buf->f_blocks = log->sector_count;
+    buf->f_bfree = 0;
+    buf->f_bavail = 0;
+    buf->f_files = 1;
+    buf->f_ffree = 0;
+    buf->f_favail = 0;
+    buf->f_flag = (ST_RDONLY | ST_NOSUID);
+    buf->f_namemax = sizeof(FILE_NAME) - 1;
+    return 0;
+}
+
+static int _open(vfs_file_t *filp, const char *name, int flags, mode_t mode)
+{
+    (void)mode;
+    tslog_fs_file_t *file = (void *)filp->private_data.buffer;
+
+    if (strcmp(name, "/" FILE_NAME) != 0) {
+        return -ENOENT;
+    }
+    if ((flags & O_ACCMODE) != O_RDONLY) {
+        return -EROFS;
+    }
+
+    tslog_iter_init(filp->mp->private_data, &file->it);
+    file->offset = 0;
+    return 0;
+}
+
+static ssize_t _read(vfs_file_t *filp, void *dest, size_t nbytes)
+{
+    tslog_t *log = filp->mp->private_data;
+    tslog_fs_file_t *file = (void *)filp->private_data.buffer;
+    uint8_t entry[TSLOG_FS_ENTRY_HDR_SIZE + CONFIG_TSLOG_RECORD_MAX];
+    uint8_t *dst = dest;
+    size_t done = 0;
+
+    while (done < nbytes) {
+        tslog_iter_t next = file->it;
+        uint32_t timestamp;
+        ssize_t len = tslog_read(log, &next, &timestamp,
+                                 &entry[TSLOG_FS_ENTRY_HDR_SIZE], CONFIG_TSLOG_RECORD_MAX);
+
+        if (len == -ESTALE) {
+            /* the rest of the record was overwritten, continue with the oldest */
+            DEBUG("tslog_fs: skipped overwritten records\n");
+            file->it = next;
+            file->offset = 0;
+            continue;
+        }
+        if (len == -ENOENT) {
+            break;
+        }
+        if (len < 0) {
+            return done ? (ssize_t)done : len;
+        }
+
+        byteorder_htolebufl(entry, timestamp);
+        byteorder_htolebufs(&entry[4], len);
+
+        size_t size = TSLOG_FS_ENTRY_HDR_SIZE + len;
+        size_t n = MIN(nbytes - done, size - file->offset);
+        memcpy(&dst[done], &entry[file->offset], n);
+        done += n;
+
+        file->offset += n;
+        if (file->offset == size) {
+            file->it = next;
+            file->offset = 0;
+        }
+    }
+
+    filp->pos += done;
+    return done;
+}
+
+static off_t _lseek(vfs_file_t *filp, off_t off, int whence)
+{
+    tslog_fs_file_t *file = (void *)filp->private_data.buffer;
+
+    switch (whence) {
+    case SEEK_SET:
+        break;
+    case SEEK_CUR:
+        off += filp->pos;
+        break;
+    default:
+        return -EINVAL;
+    }
+
+    /* only rewinding and querying the position are supported */
+    if (off == 0) {
+        tslog_iter_init(filp->mp->private_data, &file->it);
+        file->offset = 0;
+    }
+    else if (off != filp->pos) {
+        return -EINVAL;
+    }
+
+    filp->pos = off;
+    return off;
+}
+
+static int _fstat(vfs_file_t *filp, struct stat *buf)
+{
+    _write_stat(filp->mp->private_data, buf);
+    return 0;
+}
+
+static int _opendir(vfs_DIR *dirp, const char *dirname)
+{
+    if (strcmp(dirname, "/") != 0) {
+        return -ENOENT;
+    }
+    dirp->private_data.value = 0;
+    return 0;
+}
+
+static int _readdir(vfs_DIR *dirp, vfs_dirent_t *entry)
+{
+    if (dirp->private_data.value) {
+        return 0;
+    }
+    strcpy(entry->d_name, FILE_NAME);
+    entry->d_ino = 0;
+    dirp->private_data.value = 1;
+    return 1;
+}
+
+static const vfs_file_system_ops_t _fs_ops = {
+    .statvfs = _statvfs,
+    .stat = _stat,
+};
+
+static const vfs_file_ops_t _file_ops = {
+    .fstat = _fstat,
+    .lseek = _lseek,
+    .open  = _open,
+    .read  = _read,
+};
+
+static const vfs_dir_ops_t _dir_ops = {
+    .opendir = _opendir,
+    .readdir = _readdir,
+};
+
+const vfs_file_system_t tslog_fs_file_system = {
+    .f_op = &_file_ops,
+    .fs_op = &_fs_ops,
+    .d_op = &_dir_ops,
+};
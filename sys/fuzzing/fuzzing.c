@@ -8,14 +8,20 @@
  */
 
 #include <errno.h>
+#include <stdbool.h>
 #include <unistd.h>
 #include <stdlib.h>
+#include <string.h>
 #include <sys/types.h>
 
 #include "assert.h"
 #include "fuzzing.h"
+#include "modules.h"
+#include "mutex.h"
 
 #include "net/ipv6/addr.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/netapi.h"
 #include "net/gnrc/netif.h"
 #include "net/gnrc/pktbuf.h"
 #include "net/gnrc/pkt.h"
@@ -30,6 +36,15 @@ extern void fuzzing_netdev_wait(void);
 /* used by gnrc_pktbuf_malloc to exit on free */
 gnrc_pktsnip_t *gnrc_pktbuf_fuzzptr = NULL;
 
+/* unlocked by fuzzing_done() in persistent mode */
+static mutex_t _done = MUTEX_INIT_LOCKED;
+static bool _looping;
+
+#ifdef __AFL_FUZZ_INIT
+/* pass inputs via shared memory instead of stdin */
+__AFL_FUZZ_INIT();
+#endif
+
 int
 fuzzing_init(ipv6_addr_t *addr, unsigned pfx_len)
 {
@@ -54,7 +69,7 @@ fuzzing_read_packet(int fd, gnrc_pktsnip_t *pkt)
 {
     size_t rsiz;
 
-    /* can only be called once currently */
+    /* the previous packet must have been processed */
     assert(gnrc_pktbuf_fuzzptr == NULL);
 
     uint8_t *input = fuzzing_read_bytes(fd, &rsiz);
@@ -110,3 +125,103 @@ fuzzing_read_bytes(int fd, size_t *size)
     *size = csiz;
     return buffer;
 }
+
+static int
+_run_stdin(fuzzing_target_t target)
+{
+    size_t size;
+    uint8_t *buf = fuzzing_read_bytes(STDIN_FILENO, &size);
+
+    if (buf == NULL) {
+        return -errno;
+    }
+
+    target(buf, size);
+    free(buf);
+    return 0;
+}
+
+int
+fuzzing_run(fuzzing_target_t target)
+{
+#if FUZZING_PERSISTENT
+#ifdef __AFL_FUZZ_TESTCASE_BUF
+    const uint8_t *buf = __AFL_FUZZ_TESTCASE_BUF;
+#endif
+
+    _looping = true;
+    while (__AFL_LOOP(CONFIG_FUZZING_PERSISTENT_ITERATIONS)) {
+#ifdef __AFL_FUZZ_TESTCASE_BUF
+        target(buf, __AFL_FUZZ_TESTCASE_LEN);
+#else
+        int res = _run_stdin(target);
+        if (res) {
+            _looping = false;
+            return res;
+        }
+#endif
+    }
+    _looping = false;
+
+    return 0;
+#else
+    return _run_stdin(target);
+#endif
+}
+
+static void
+_reset_state(void)
+{
+#if IS_USED(MODULE_GNRC_IPV6_NIB)
+    void *state = NULL;
+    gnrc_ipv6_nib_nc_t nce;
+
+    /* forget about routers and neighbors the previous input announced */
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_DEFAULT_ROUTER_NUMOF; i++) {
+        gnrc_ipv6_nib_ft_del(NULL, 0);
+    }
+    while (gnrc_ipv6_nib_nc_iter(0, &state, &nce)) {
+        gnrc_ipv6_nib_nc_del(&nce.ipv6, gnrc_ipv6_nib_nc_get_iface(&nce));
+    }
+#endif
+}
+
+int
+fuzzing_dispatch(gnrc_pktsnip_t *pkt, gnrc_nettype_t type, uint32_t demux,
+                 const uint8_t *data, size_t size)
+{
+    /* the previous packet must have been processed */
+    assert(gnrc_pktbuf_fuzzptr == NULL);
+
+    if (gnrc_pktbuf_realloc_data(pkt, size)) {
+        gnrc_pktbuf_release(pkt);
+        return -ENOMEM;
+    }
+    if (size > 0) {
+        memcpy(pkt->data, data, size);
+    }
+
+    gnrc_pktbuf_fuzzptr = pkt;
+    if (!gnrc_netapi_dispatch_receive(type, demux, pkt)) {
+        gnrc_pktbuf_fuzzptr = NULL;
+        gnrc_pktbuf_release(pkt);
+        return -ENOENT;
+    }
+
+    mutex_lock(&_done);
+    _reset_state();
+
+    return 0;
+}
+
+void
+fuzzing_done(void)
+{
+    /* applications not using fuzzing_run() only process a single input */
+    if (!_looping) {
+        exit(EXIT_SUCCESS);
+    }
+
+    gnrc_pktbuf_fuzzptr = NULL;
+    mutex_unlock(&_done);
+}
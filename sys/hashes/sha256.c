@@ -78,6 +78,34 @@ void sha256(const void *data, size_t len, void *digest)
     sha256_final(&c, digest);
 }
 
+void sha256_multi_init(sha256_multi_context_t *ctx, unsigned lanes)
+{
+    assert((lanes > 0) && (lanes <= SHA2XX_MULTI_LANES_MAX));
+
+    ctx->count[0] = ctx->count[1] = 0;
+    ctx->lanes = lanes;
+
+    for (unsigned l = 0; l < lanes; l++) {
+        ctx->state[l][0] = 0x6A09E667;
+        ctx->state[l][1] = 0xBB67AE85;
+        ctx->state[l][2] = 0x3C6EF372;
+        ctx->state[l][3] = 0xA54FF53A;
+        ctx->state[l][4] = 0x510E527F;
+        ctx->state[l][5] = 0x9B05688C;
+        ctx->state[l][6] = 0x1F83D9AB;
+        ctx->state[l][7] = 0x5BE0CD19;
+    }
+}
+
+void sha256_multi(const void *const data[], size_t len, void *const digest[], unsigned lanes)
+{
+    sha256_multi_context_t c;
+
+    sha256_multi_init(&c, lanes);
+    sha256_multi_update(&c, data, len);
+    sha256_multi_final(&c, digest);
+}
+
 void hmac_sha256_init(hmac_context_t *ctx, const void *key, size_t key_length)
 {
     unsigned char k[SHA256_INTERNAL_BLOCK_SIZE];
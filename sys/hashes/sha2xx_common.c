@@ -49,14 +49,12 @@
 #include <stdint.h>
 #include <assert.h>
 
+#include "byteorder.h"
 #include "hashes/sha2xx_common.h"
 
 #ifdef __BIG_ENDIAN__
 /* Copy a vector of big-endian uint32_t into a vector of bytes */
 #define be32enc_vect memcpy
-
-/* Copy a vector of bytes into a vector of big-endian uint32_t */
-#define be32dec_vect memcpy
 #else /* !__BIG_ENDIAN__ */
 
 /*
@@ -88,12 +86,6 @@ static void be32enc_vect(void *dst_, const void *src_, size_t len)
     }
 }
 
-/*
- * Decode a big-endian length len vector of (unsigned char) into a length
- * len/4 vector of (uint32_t).  Assumes len is a multiple of 4.
- */
-#define be32dec_vect be32enc_vect
-
 #endif /* __BYTE_ORDER__ != __ORDER_BIG_ENDIAN__ */
 
 /**
@@ -130,43 +122,164 @@ static const uint32_t K[64] = {
     0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
 };
 
+/**
+ * @brief   One round of SHA2XX, @p d and @p h are updated in place
+ *
+ * The callers rotate the names of the working variables instead of their
+ * values, so all of them can stay in registers.
+ */
+#define ROUND(a, b, c, d, e, f, g, h, w, k) \
+    do { \
+        uint32_t t0 = h + S1(e) + Ch(e, f, g) + (w) + (k); \
+        d += t0; \
+        h = t0 + S0(a) + Maj(a, b, c); \
+    } while (0)
+
+/* Message schedule entry i >= 16, kept in a rolling buffer of 16 words */
+#define W_NEXT(W, i) \
+    (W[(i) & 15] += s1(W[((i) - 2) & 15]) + W[((i) - 7) & 15] + s0(W[((i) - 15) & 15]))
+
 /*
  * SHA256 block compression function.  The 256-bit state is transformed via
  * the 512-bit input block to produce a new state.
  */
 static void sha2xx_transform(uint32_t *state, const unsigned char block[64])
 {
-    uint32_t W[64];
-    uint32_t S[8];
+    uint32_t W[16];
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
 
-    /* 1. Prepare message schedule W. */
-    be32dec_vect(W, block, 64);
-    for (int i = 16; i < 64; i++) {
-        W[i] = s1(W[i - 2]) + W[i - 7] + s0(W[i - 15]) + W[i - 16];
+    /* 1. Load the block, it may be unaligned. */
+    for (unsigned i = 0; i < 16; i++) {
+        W[i] = byteorder_bebuftohl(&block[4 * i]);
     }
 
-    /* 2. Initialize working variables. */
-    memcpy(S, state, 32);
+    /* 2. Mix, eight rounds per iteration so the variables are back in
+     *    place at the end of each. The first 16 rounds use the block as is,
+     *    the schedule of the later ones is computed on the fly. */
+    for (unsigned i = 0; i < 16; i += 8) {
+        ROUND(a, b, c, d, e, f, g, h, W[i + 0], K[i + 0]);
+        ROUND(h, a, b, c, d, e, f, g, W[i + 1], K[i + 1]);
+        ROUND(g, h, a, b, c, d, e, f, W[i + 2], K[i + 2]);
+        ROUND(f, g, h, a, b, c, d, e, W[i + 3], K[i + 3]);
+        ROUND(e, f, g, h, a, b, c, d, W[i + 4], K[i + 4]);
+        ROUND(d, e, f, g, h, a, b, c, W[i + 5], K[i + 5]);
+        ROUND(c, d, e, f, g, h, a, b, W[i + 6], K[i + 6]);
+        ROUND(b, c, d, e, f, g, h, a, W[i + 7], K[i + 7]);
+    }
+    for (unsigned i = 16; i < 64; i += 8) {
+        ROUND(a, b, c, d, e, f, g, h, W_NEXT(W, i + 0), K[i + 0]);
+        ROUND(h, a, b, c, d, e, f, g, W_NEXT(W, i + 1), K[i + 1]);
+        ROUND(g, h, a, b, c, d, e, f, W_NEXT(W, i + 2), K[i + 2]);
+        ROUND(f, g, h, a, b, c, d, e, W_NEXT(W, i + 3), K[i + 3]);
+        ROUND(e, f, g, h, a, b, c, d, W_NEXT(W, i + 4), K[i + 4]);
+        ROUND(d, e, f, g, h, a, b, c, W_NEXT(W, i + 5), K[i + 5]);
+        ROUND(c, d, e, f, g, h, a, b, W_NEXT(W, i + 6), K[i + 6]);
+        ROUND(b, c, d, e, f, g, h, a, W_NEXT(W, i + 7), K[i + 7]);
+    }
 
-    /* 3. Mix. */
-    for (int i = 0; i < 64; ++i) {
-        uint32_t e = S[(68 - i) % 8], f = S[(69 - i) % 8];
-        uint32_t g = S[(70 - i) % 8], h = S[(71 - i) % 8];
-        uint32_t t0 = h + S1(e) + Ch(e, f, g) + W[i] + K[i];
+    /* 3. Mix local working variables into global state */
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+}
 
-        uint32_t a = S[(64 - i) % 8], b = S[(65 - i) % 8];
-        uint32_t c = S[(66 - i) % 8], d = S[(67 - i) % 8];
-        uint32_t t1 = S0(a) + Maj(a, b, c);
+#if defined(__SSE2__) || defined(__ARM_NEON)
+/* With SIMD registers the lanes are hashed together, one lane per element.
+ * The GCC vector extension maps this to SSE2 or NEON instructions. */
+typedef uint32_t sha2xx_vec_t __attribute__((vector_size(4 * sizeof(uint32_t))));
 
-        S[(67 - i) % 8] = d + t0;
-        S[(71 - i) % 8] = t0 + t1;
+#define VROUND(a, b, c, d, e, f, g, h, w, k) \
+    do { \
+        sha2xx_vec_t t0 = h + S1(e) + Ch(e, f, g) + (w) + (k); \
+        d += t0; \
+        h = t0 + S0(a) + Maj(a, b, c); \
+    } while (0)
+
+/*
+ * SHA256 block compression function for up to SHA2XX_MULTI_LANES_MAX
+ * independent states, each with its own input block.
+ */
+static void sha2xx_transform_multi(uint32_t state[][8],
+                                   const unsigned char *const block[],
+                                   unsigned lanes)
+{
+    sha2xx_vec_t W[16];
+    sha2xx_vec_t v[8];
+    const unsigned char *in[SHA2XX_MULTI_LANES_MAX];
+
+    /* unused lanes process a copy of the first one */
+    for (unsigned l = 0; l < SHA2XX_MULTI_LANES_MAX; l++) {
+        in[l] = block[(l < lanes) ? l : 0];
     }
 
-    /* 4. Mix local working variables into global state */
-    for (int i = 0; i < 8; i++) {
-        state[i] += S[i];
+    for (unsigned i = 0; i < 16; i++) {
+        W[i] = (sha2xx_vec_t){ byteorder_bebuftohl(&in[0][4 * i]),
+                               byteorder_bebuftohl(&in[1][4 * i]),
+                               byteorder_bebuftohl(&in[2][4 * i]),
+                               byteorder_bebuftohl(&in[3][4 * i]) };
+    }
+    for (unsigned j = 0; j < 8; j++) {
+        v[j] = (sha2xx_vec_t){ state[0][j], state[(lanes > 1) ? 1 : 0][j],
+                               state[(lanes > 2) ? 2 : 0][j], state[(lanes > 3) ? 3 : 0][j] };
+    }
+
+    sha2xx_vec_t a = v[0], b = v[1], c = v[2], d = v[3];
+    sha2xx_vec_t e = v[4], f = v[5], g = v[6], h = v[7];
+
+    for (unsigned i = 0; i < 16; i += 8) {
+        VROUND(a, b, c, d, e, f, g, h, W[i + 0], K[i + 0]);
+        VROUND(h, a, b, c, d, e, f, g, W[i + 1], K[i + 1]);
+        VROUND(g, h, a, b, c, d, e, f, W[i + 2], K[i + 2]);
+        VROUND(f, g, h, a, b, c, d, e, W[i + 3], K[i + 3]);
+        VROUND(e, f, g, h, a, b, c, d, W[i + 4], K[i + 4]);
+        VROUND(d, e, f, g, h, a, b, c, W[i + 5], K[i + 5]);
+        VROUND(c, d, e, f, g, h, a, b, W[i + 6], K[i + 6]);
+        VROUND(b, c, d, e, f, g, h, a, W[i + 7], K[i + 7]);
+    }
+    for (unsigned i = 16; i < 64; i += 8) {
+        VROUND(a, b, c, d, e, f, g, h, W_NEXT(W, i + 0), K[i + 0]);
+        VROUND(h, a, b, c, d, e, f, g, W_NEXT(W, i + 1), K[i + 1]);
+        VROUND(g, h, a, b, c, d, e, f, W_NEXT(W, i + 2), K[i + 2]);
+        VROUND(f, g, h, a, b, c, d, e, W_NEXT(W, i + 3), K[i + 3]);
+        VROUND(e, f, g, h, a, b, c, d, W_NEXT(W, i + 4), K[i + 4]);
+        VROUND(d, e, f, g, h, a, b, c, W_NEXT(W, i + 5), K[i + 5]);
+        VROUND(c, d, e, f, g, h, a, b, W_NEXT(W, i + 6), K[i + 6]);
+        VROUND(b, c, d, e, f, g, h, a, W_NEXT(W, i + 7), K[i + 7]);
+    }
+
+    v[0] += a;
+    v[1] += b;
+    v[2] += c;
+    v[3] += d;
+    v[4] += e;
+    v[5] += f;
+    v[6] += g;
+    v[7] += h;
+
+    for (unsigned l = 0; l < lanes; l++) {
+        for (unsigned j = 0; j < 8; j++) {
+            state[l][j] = v[j][l];
+        }
+    }
+}
+#else
+/* Without SIMD registers, interleaving the lanes only adds register
+ * pressure, so they are compressed one after the other. */
+static void sha2xx_transform_multi(uint32_t state[][8],
+                                   const unsigned char *const block[],
+                                   unsigned lanes)
+{
+    for (unsigned l = 0; l < lanes; l++) {
+        sha2xx_transform(state[l], block[l]);
     }
 }
+#endif
 
 static const unsigned char PAD[64] = {
     0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -256,3 +369,82 @@ void sha2xx_final(sha2xx_context_t *ctx, void *dst, size_t dig_len)
     /* Clear the context state */
     memset((void *) ctx, 0, sizeof(*ctx));
 }
+
+/* Add the same number of bytes to every lane */
+void sha2xx_multi_update(sha2xx_multi_context_t *ctx, const void *const data[], size_t len)
+{
+    const unsigned char *src[SHA2XX_MULTI_LANES_MAX];
+    const unsigned char *blocks[SHA2XX_MULTI_LANES_MAX];
+    uint8_t r = (ctx->count[1] >> 3) & 0x3f;
+    uint8_t f = 64 - r;
+    uint32_t bitlen1 = ((uint32_t) len) << 3;
+    uint32_t bitlen0 = ((uint32_t) len) >> 29;
+
+    assert(ctx->lanes <= SHA2XX_MULTI_LANES_MAX);
+
+    if ((ctx->count[1] += bitlen1) < bitlen1) {
+        ctx->count[0]++;
+    }
+    ctx->count[0] += bitlen0;
+
+    if (len < f) {
+        for (unsigned l = 0; (len > 0) && (l < ctx->lanes); l++) {
+            memcpy(&ctx->buf[l][r], data[l], len);
+        }
+        return;
+    }
+
+    for (unsigned l = 0; l < ctx->lanes; l++) {
+        src[l] = data[l];
+        if (r) {
+            memcpy(&ctx->buf[l][r], src[l], f);
+            blocks[l] = ctx->buf[l];
+            src[l] += f;
+        }
+        else {
+            blocks[l] = src[l];
+            src[l] += 64;
+        }
+    }
+    sha2xx_transform_multi(ctx->state, blocks, ctx->lanes);
+    len -= r ? f : 64;
+
+    while (len >= 64) {
+        for (unsigned l = 0; l < ctx->lanes; l++) {
+            blocks[l] = src[l];
+            src[l] += 64;
+        }
+        sha2xx_transform_multi(ctx->state, blocks, ctx->lanes);
+        len -= 64;
+    }
+
+    for (unsigned l = 0; l < ctx->lanes; l++) {
+        memcpy(ctx->buf[l], src[l], len);
+    }
+}
+
+void sha2xx_multi_final(sha2xx_multi_context_t *ctx, void *const digest[], size_t dig_len)
+{
+    const void *pad[SHA2XX_MULTI_LANES_MAX];
+    const void *len[SHA2XX_MULTI_LANES_MAX];
+    unsigned char len_be[8];
+
+    /* all lanes have the same length, so they share their padding */
+    be32enc_vect(len_be, ctx->count, 8);
+
+    uint8_t r = (ctx->count[1] >> 3) & 0x3f;
+    uint8_t plen = (r < 56) ? (56 - r) : (120 - r);
+
+    for (unsigned l = 0; l < ctx->lanes; l++) {
+        pad[l] = PAD;
+        len[l] = len_be;
+    }
+    sha2xx_multi_update(ctx, pad, plen);
+    sha2xx_multi_update(ctx, len, 8);
+
+    for (unsigned l = 0; l < ctx->lanes; l++) {
+        be32enc_vect(digest[l], ctx->state[l], dig_len);
+    }
+
+    memset((void *) ctx, 0, sizeof(*ctx));
+}
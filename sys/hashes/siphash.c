@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_hashes_siphash
+ * @{
+ *
+ * @file
+ * @brief       Implementation of SipHash-2-4
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ */
+
+#include <stdint.h>
+
+#include "byteorder.h"
+#include "hashes/siphash.h"
+
+#define ROTL(x, b)  (uint64_t)(((x) << (b)) | ((x) >> (64 - (b))))
+
+static void _sipround(uint64_t *v)
+{
+    v[0] += v[1];
+    v[1] = ROTL(v[1], 13);
+    v[1] ^= v[0];
+    v[0] = ROTL(v[0], 32);
+    v[2] += v[3];
+    v[3] = ROTL(v[3], 16);
+    v[3] ^= v[2];
+    v[0] += v[3];
+    v[3] = ROTL(v[3], 21);
+    v[3] ^= v[0];
+    v[2] += v[1];
+    v[1] = ROTL(v[1], 17);
+    v[1] ^= v[2];
+    v[2] = ROTL(v[2], 32);
+}
+
+static void _compress(uint64_t *v, uint64_t m)
+{
+    v[3] ^= m;
+    _sipround(v);
+    _sipround(v);
+    v[0] ^= m;
+}
+
+void siphash_init(siphash_context_t *ctx, const uint8_t *key)
+{
+    uint64_t k0 = byteorder_lebuftohll(key);
+    uint64_t k1 = byteorder_lebuftohll(key + 8);
+
+    ctx->v[0] = k0 ^ 0x736f6d6570736575ULL;
+    ctx->v[1] = k1 ^ 0x646f72616e646f6dULL;
+    ctx->v[2] = k0 ^ 0x6c7967656e657261ULL;
+    ctx->v[3] = k1 ^ 0x7465646279746573ULL;
+    ctx->buf = 0;
+    ctx->buf_len = 0;
+    ctx->len = 0;
+}
+
+void siphash_update(siphash_context_t *ctx, const void *data, size_t len)
+{
+    const uint8_t *in = data;
+
+    ctx->len += len;
+    /* fill up the partial word of the last call */
+    while ((ctx->buf_len != 0) && (len > 0)) {
+        ctx->buf |= (uint64_t)*in++ << (8 * ctx->buf_len);
+        len--;
+        if (++ctx->buf_len == 8) {
+            _compress(ctx->v, ctx->buf);
+            ctx->buf = 0;
+            ctx->buf_len = 0;
+        }
+    }
+    for (; len >= 8; in += 8, len -= 8) {
+        _compress(ctx->v, byteorder_lebuftohll(in));
+    }
+    for (; len > 0; len--) {
+        ctx->buf |= (uint64_t)*in++ << (8 * ctx->buf_len++);
+    }
+}
+
+uint64_t siphash_final(siphash_context_t *ctx)
+{
+    uint64_t *v = ctx->v;
+
+    _compress(v, ctx->buf | ((uint64_t)ctx->len << 56));
+    v[2] ^= 0xff;
+    _sipround(v);
+    _sipround(v);
+    _sipround(v);
+    _sipround(v);
+    return v[0] ^ v[1] ^ v[2] ^ v[3];
+}
+
+uint64_t siphash(const uint8_t *key, const void *data, size_t len)
+{
+    siphash_context_t ctx;
+
+    siphash_init(&ctx, key);
+    siphash_update(&ctx, data, len);
+    return siphash_final(&ctx);
+}
+
+/** @} */
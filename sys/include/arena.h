@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_arena Arena allocator
+ * @ingroup     sys_memory_management
+ * @brief       Bump pointer allocator for memory with a common lifetime
+ *
+ * An arena hands out memory from a caller provided buffer by moving a
+ * pointer forward. Single allocations cannot be freed. Instead, all memory
+ * allocated after a mark (see @ref arena_mark()) is released at once with
+ * @ref arena_release(), and @ref arena_reset() releases everything. Marks
+ * can be nested, e.g. a handler can take a mark, allocate temporaries and
+ * release them, while the allocations of its caller stay valid.
+ *
+ * This fits allocations that all end with one request: allocation costs
+ * an alignment and a pointer increment, there is no per allocation
+ * overhead, and the buffer never fragments.
+ *
+ * An arena is not thread-safe. Use one arena per thread, or protect it
+ * with a mutex.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Arena allocator API
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ */
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <assert.h>
+#include <stdalign.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Alignment of memory returned by @ref arena_alloc()
+ */
+#define ARENA_ALIGN     (alignof(max_align_t))
+
+/**
+ * @brief   Arena
+ */
+typedef struct {
+    uint8_t *buf;       /**< start of the buffer */
+    size_t size;        /**< size of the buffer */
+    size_t used;        /**< offset of the next free byte */
+    size_t used_max;    /**< maximum of @p used since @ref arena_init() */
+} arena_t;
+
+/**
+ * @brief   Position in an arena to release to
+ */
+typedef size_t arena_mark_t;
+
+/**
+ * @brief   Initialize an arena
+ *
+ * @param[out]  arena   arena to initialize
+ * @param[in]   buf     buffer to allocate from
+ * @param[in]   size    size of @p buf in bytes
+ */
+void arena_init(arena_t *arena, void *buf, size_t size);
+
+/**
+ * @brief   Allocate memory with a given alignment
+ *
+ * @pre     @p align is a power of two
+ *
+ * @param[in,out]   arena   arena to allocate from
+ * @param[in]       size    number of bytes to allocate
+ * @param[in]       align   alignment of the memory
+ *
+ * @return  the memory, not cleared
+ * @retval  NULL if the arena has not enough space left
+ */
+void *arena_alloc_aligned(arena_t *arena, size_t size, size_t align);
+
+/**
+ * @brief   Allocate memory suitable for any type
+ *
+ * @param[in,out]   arena   arena to allocate from
+ * @param[in]       size    number of bytes to allocate
+ *
+ * @return  the memory aligned to @ref ARENA_ALIGN, not cleared
+ * @retval  NULL if the arena has not enough space left
+ */
+static inline void *arena_alloc(arena_t *arena, size_t size)
+{
+    return arena_alloc_aligned(arena, size, ARENA_ALIGN);
+}
+
+/**
+ * @brief   Allocate cleared memory for an array
+ *
+ * @param[in,out]   arena   arena to allocate from
+ * @param[in]       nmemb   number of elements
+ * @param[in]       size    size of an element in bytes
+ *
+ * @return  the memory aligned to @ref ARENA_ALIGN, filled with zeros
+ * @retval  NULL if the arena has not enough space left or
+ *          `nmemb * size` overflows
+ */
+void *arena_calloc(arena_t *arena, size_t nmemb, size_t size);
+
+/**
+ * @brief   Get the current position of an arena
+ *
+ * @param[in]   arena   the arena
+ *
+ * @return  a mark to pass to @ref arena_release()
+ */
+static inline arena_mark_t arena_mark(const arena_t *arena)
+{
+    return arena->used;
+}
+
+/**
+ * @brief   Release all memory allocated after @p mark
+ *
+ * Marks taken after @p mark become invalid.
+ *
+ * @param[in,out]   arena   the arena
+ * @param[in]       mark    mark obtained from @ref arena_mark()
+ */
+static inline void arena_release(arena_t *arena, arena_mark_t mark)
+{
+    assert(mark <= arena->used);
+    arena->used = mark;
+}
+
+/**
+ * @brief   Release all memory of an arena
+ *
+ * @param[in,out]   arena   the arena
+ */
+static inline void arena_reset(arena_t *arena)
+{
+    arena->used = 0;
+}
+
+/**
+ * @brief   Get the number of bytes left in an arena
+ *
+ * Alignment may make less memory usable.
+ *
+ * @param[in]   arena   the arena
+ *
+ * @return  bytes left
+ */
+static inline size_t arena_available(const arena_t *arena)
+{
+    return arena->size - arena->used;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ARENA_H */
+/** @} */
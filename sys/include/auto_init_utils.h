@@ -46,6 +46,18 @@ extern "C" {
 #define CONFIG_AUTO_INIT_ENABLE_DEBUG 0
 #endif
 
+#ifndef CONFIG_AUTO_INIT_ENABLE_TIMING
+/**
+ * @brief   Print how long the initialization of each module took
+ *
+ * The time spent in each auto-init function is measured with `ZTIMER_USEC`
+ * and printed, followed by the total, to find the modules that delay the
+ * start of `main()`. Modules initialized before ztimer are not measured.
+ * Requires the `ztimer_usec` module.
+ */
+#define CONFIG_AUTO_INIT_ENABLE_TIMING 0
+#endif
+
 /**
  * @brief   Auto-init function type
  */
@@ -61,13 +73,15 @@ typedef uint16_t auto_init_prio_t;
  */
 typedef struct {
     auto_init_fn_t init;    /**< Function to initialize the module */
-#if IS_ACTIVE(CONFIG_AUTO_INIT_ENABLE_DEBUG) || defined(DOXYGEN)
+#if IS_ACTIVE(CONFIG_AUTO_INIT_ENABLE_DEBUG) || \
+    IS_ACTIVE(CONFIG_AUTO_INIT_ENABLE_TIMING) || defined(DOXYGEN)
     auto_init_prio_t prio;  /**< Module priority */
     const char *name;       /**< Module auto-init function name */
 #endif
 } auto_init_module_t;
 
-#if IS_ACTIVE(CONFIG_AUTO_INIT_ENABLE_DEBUG) || defined(DOXYGEN)
+#if IS_ACTIVE(CONFIG_AUTO_INIT_ENABLE_DEBUG) || \
+    IS_ACTIVE(CONFIG_AUTO_INIT_ENABLE_TIMING) || defined(DOXYGEN)
 /**
  * @brief   Add a module to the auto-initialization array
  *
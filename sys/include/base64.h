@@ -20,7 +20,9 @@
 #ifndef BASE64_H
 #define BASE64_H
 
+#include <stdbool.h>
 #include <stddef.h> /* for size_t */
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -123,6 +125,79 @@ int base64url_encode(const void *data_in, size_t data_in_size,
 int base64_decode(const void *base64_in, size_t base64_in_size,
                   void *data_out, size_t *data_out_size);
 
+/**
+ * @brief   Context of an incremental base64 encoder
+ *
+ * Encodes data that arrives in chunks of arbitrary size, e.g. a certificate
+ * read from flash piece by piece, without buffering all of it. Only the
+ * up to two input bytes that do not yet form a group of three are kept.
+ */
+typedef struct {
+    uint8_t pending[3];     /**< input bytes not encoded yet */
+    uint8_t pending_len;    /**< number of bytes in @ref pending */
+    bool urlsafe;           /**< use the URL and Filename Safe Alphabet */
+} base64_encoder_t;
+
+/**
+ * @brief           Initialize an incremental base64 encoder
+ *
+ * @param[out]      enc     encoder to initialize
+ */
+void base64_encoder_init(base64_encoder_t *enc);
+
+/**
+ * @brief           Initialize an incremental base64 encoder that uses the
+ *                  URL and Filename Safe Alphabet and no padding
+ *
+ * @note            Requires the use of the `base64url` module.
+ *
+ * @param[out]      enc     encoder to initialize
+ */
+void base64url_encoder_init(base64_encoder_t *enc);
+
+/**
+ * @brief           Number of characters base64_encoder_update() writes at
+ *                  most for @p len bytes of input
+ *
+ * @param[in]       enc     encoder
+ * @param[in]       len     number of bytes to encode
+ *
+ * @return          required size of the output buffer
+ */
+static inline size_t base64_encoder_update_size(const base64_encoder_t *enc,
+                                                size_t len)
+{
+    return 4 * ((enc->pending_len + len) / 3);
+}
+
+/**
+ * @brief           Encode the next chunk of data
+ *
+ * Bytes that do not complete a group of three are kept in @p enc and
+ * encoded with the next call or by base64_encoder_finish().
+ *
+ * @param[in,out]   enc     encoder
+ * @param[in]       data    next chunk of data to encode
+ * @param[in]       len     size of @p data
+ * @param[out]      out     buffer for the encoded characters, must hold
+ *                          base64_encoder_update_size() characters
+ *
+ * @return          number of characters written to @p out
+ */
+size_t base64_encoder_update(base64_encoder_t *enc, const void *data,
+                             size_t len, void *out);
+
+/**
+ * @brief           Encode the remaining bytes and add the padding
+ *
+ * @param[in,out]   enc     encoder, can be reused afterwards
+ * @param[out]      out     buffer for the encoded characters, must hold
+ *                          4 characters
+ *
+ * @return          number of characters written to @p out
+ */
+size_t base64_encoder_finish(base64_encoder_t *enc, void *out);
+
 #ifdef __cplusplus
 }
 #endif
@@ -10,6 +10,25 @@
  * @defgroup    sys_benchmark Benchmark
  * @ingroup     sys
  * @brief       Framework for running simple runtime benchmarks
+ *
+ * @ref BENCHMARK_FUNC measures the total runtime of a number of calls and
+ * prints a human readable summary.
+ *
+ * With the module `benchmark_result`, the calls are split into
+ * @ref CONFIG_BENCHMARK_REPS repetitions after @ref CONFIG_BENCHMARK_WARMUP
+ * discarded ones, and the minimum, median, 99th percentile and maximum time
+ * per call is printed as one line of JSON (via @ref test_utils_result_output):
+ *
+ *     [{"benchmark": "mutex lock/unlock", "unit": "ns", "runs": 62500,
+ *       "reps": 16, "min": 91, "median": 93, "p99": 120, "max": 120},
+ *      {"exit_status": 0}]
+ *
+ * @ref BENCHMARK_FUNC then produces this format, too, so existing benchmarks
+ * need no changes. With the module `benchmark_cycles` the CPU cycle counter
+ * (`DWT->CYCCNT` on Cortex-M, `mcycle` on RISC-V) is used and the unit is
+ * `cycles`. `dist/tools/benchmark_compare` collects these lines from several
+ * applications and boards and compares them to a stored baseline.
+ *
  * @{
  *
  * @file
@@ -24,12 +43,85 @@
 #include <stdint.h>
 
 #include "irq.h"
+#include "kernel_defines.h"
 #include "ztimer/stopwatch.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @brief   Number of discarded warm-up repetitions with `benchmark_result`
+ */
+#ifndef CONFIG_BENCHMARK_WARMUP
+#define CONFIG_BENCHMARK_WARMUP     (1U)
+#endif
+
+/**
+ * @brief   Number of measured repetitions with `benchmark_result`
+ */
+#ifndef CONFIG_BENCHMARK_REPS
+#define CONFIG_BENCHMARK_REPS       (16U)
+#endif
+
+#if IS_USED(MODULE_BENCHMARK_RESULT) || DOXYGEN
+/**
+ * @brief   Run @p func @p runs times in repetitions and print statistics
+ *
+ * The calls are split into @ref CONFIG_BENCHMARK_WARMUP +
+ * @ref CONFIG_BENCHMARK_REPS repetitions of `runs / CONFIG_BENCHMARK_REPS`
+ * calls each, the warm-up repetitions are not part of the result.
+ *
+ * @param[in] name      name for labeling the output
+ * @param[in] runs      number of measured calls of @p func
+ * @param[in] func      function call to benchmark
+ */
+#define BENCHMARK_RUN(name, runs, func)                                 \
+    do {                                                                \
+        uint32_t _samples[CONFIG_BENCHMARK_REPS];                       \
+        unsigned long _per_rep = (runs) / CONFIG_BENCHMARK_REPS;        \
+        if (_per_rep == 0) {                                            \
+            _per_rep = 1;                                               \
+        }                                                               \
+        for (unsigned _rep = 0;                                         \
+             _rep < CONFIG_BENCHMARK_WARMUP + CONFIG_BENCHMARK_REPS;    \
+             _rep++) {                                                  \
+            uint32_t _start = benchmark_now();                          \
+            for (unsigned long i = 0; i < _per_rep; i++) {              \
+                func;                                                   \
+            }                                                           \
+            uint32_t _time = benchmark_now() - _start;                  \
+            if (_rep >= CONFIG_BENCHMARK_WARMUP) {                      \
+                _samples[_rep - CONFIG_BENCHMARK_WARMUP] = _time;       \
+            }                                                           \
+        }                                                               \
+        benchmark_print_result(name, _samples, CONFIG_BENCHMARK_REPS,   \
+                               _per_rep);                               \
+    } while (0)
+
+/**
+ * @brief   Read the time base used by @ref BENCHMARK_RUN
+ *
+ * @return  CPU cycles with `benchmark_cycles`, microseconds otherwise
+ */
+uint32_t benchmark_now(void);
+
+/**
+ * @brief   Print the statistics of a benchmark as JSON
+ *
+ * @param[in]     name      name to label the output
+ * @param[in,out] samples   time of each repetition in @ref benchmark_now
+ *                          ticks, sorted by this function
+ * @param[in]     reps      number of entries in @p samples
+ * @param[in]     runs      number of calls per repetition
+ */
+void benchmark_print_result(const char *name, uint32_t *samples,
+                            unsigned reps, unsigned long runs);
+#endif
+
+#if IS_USED(MODULE_BENCHMARK_RESULT) && !DOXYGEN
+#define BENCHMARK_FUNC(name, runs, func)    BENCHMARK_RUN(name, runs, func)
+#else
 /**
  * @brief   Measure the runtime of a given function call
  *
@@ -51,6 +143,7 @@ extern "C" {
         benchmark_print_time(ztimer_stopwatch_measure(&timer), runs, name); \
         ztimer_stopwatch_stop(&timer);                          \
     } while (0)
+#endif
 
 /**
  * @brief   Output the given time as well as the time per run on STDIO
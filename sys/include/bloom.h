@@ -228,6 +228,151 @@ void bloom_add(bloom_t *bloom, const uint8_t *buf, size_t len);
  */
 bool bloom_check(bloom_t *bloom, const uint8_t *buf, size_t len);
 
+/**
+ * @brief   Number of bits (or counters) of one block of the blocked filters
+ */
+#define BLOOM_BLOCKED_BLOCK_BITS    (512U)
+
+/**
+ * @brief   Number of bytes of one block of a blocked Bloom filter
+ */
+#define BLOOM_BLOCKED_BLOCK_SIZE    (BLOOM_BLOCKED_BLOCK_BITS / 8)
+
+/**
+ * @brief   Number of bytes of one block of a counting Bloom filter
+ */
+#define BLOOM_COUNTING_BLOCK_SIZE   (BLOOM_BLOCKED_BLOCK_BITS / 2)
+
+/**
+ * @brief   Maximum number of probes per element of the blocked filters
+ */
+#define BLOOM_BLOCKED_K_MAX         (16U)
+
+/**
+ * @brief   Blocked Bloom filter
+ *
+ * Variant of the Bloom filter that puts all k bits of an element into one
+ * block of @ref BLOOM_BLOCKED_BLOCK_BITS bits, the size of a cache line on
+ * larger CPUs. The block and the bits within it are all derived from a
+ * single hash of the element by double hashing, so adding or checking an
+ * element runs one hash function instead of k and stays within 64 bytes of
+ * memory.
+ *
+ * The price is a somewhat higher false positive rate than the classic
+ * filter of the same size, as the elements are less evenly distributed over
+ * the bits. Smaller blocks would make it much worse, which is why the bits
+ * of an element are not kept within a single word.
+ */
+typedef struct {
+    uint8_t *a;             /**< the bloom array */
+    size_t blocks_numof;    /**< number of blocks in @ref a */
+    hashfp_t hash;          /**< the hash function */
+    uint8_t k;              /**< number of bits set per element */
+} bloom_blocked_t;
+
+/**
+ * @brief   Counting blocked Bloom filter
+ *
+ * Same as @ref bloom_blocked_t, but with a 4 bit counter instead of every
+ * bit, so elements can be removed again. Counters that reached 15 stick, an
+ * element that shares such a counter may thus be reported as present after
+ * it was removed, but an element that is present is always found.
+ */
+typedef struct {
+    uint8_t *counters;      /**< the counters, two per byte */
+    size_t blocks_numof;    /**< number of blocks in @ref counters */
+    hashfp_t hash;          /**< the hash function */
+    uint8_t k;              /**< number of counters incremented per element */
+} bloom_counting_t;
+
+/**
+ * @brief   Initialize a blocked Bloom filter and clear it
+ *
+ * @param[out]  bloom           filter to initialize
+ * @param[in]   bitfield        memory of the filter, must hold
+ *                              @p blocks_numof * @ref BLOOM_BLOCKED_BLOCK_SIZE
+ *                              bytes
+ * @param[in]   blocks_numof    number of blocks
+ * @param[in]   hash            hash function applied to the elements
+ * @param[in]   k               number of bits per element,
+ *                              1 <= k <= @ref BLOOM_BLOCKED_K_MAX
+ */
+void bloom_blocked_init(bloom_blocked_t *bloom, uint8_t *bitfield,
+                        size_t blocks_numof, hashfp_t hash, unsigned k);
+
+/**
+ * @brief   Add an element to a blocked Bloom filter
+ *
+ * @param[in,out]   bloom   Bloom filter
+ * @param[in]       buf     element to add
+ * @param[in]       len     length of @p buf
+ */
+void bloom_blocked_add(bloom_blocked_t *bloom, const uint8_t *buf, size_t len);
+
+/**
+ * @brief   Determine if an element may be in a blocked Bloom filter
+ *
+ * @param[in]   bloom   Bloom filter
+ * @param[in]   buf     element to check
+ * @param[in]   len     length of @p buf
+ *
+ * @return      false if the element is not in the filter
+ * @return      true if the element may be in the filter
+ */
+bool bloom_blocked_check(const bloom_blocked_t *bloom, const uint8_t *buf,
+                         size_t len);
+
+/**
+ * @brief   Initialize a counting Bloom filter and clear it
+ *
+ * @param[out]  bloom           filter to initialize
+ * @param[in]   counters        memory of the filter, must hold
+ *                              @p blocks_numof * @ref BLOOM_COUNTING_BLOCK_SIZE
+ *                              bytes
+ * @param[in]   blocks_numof    number of blocks
+ * @param[in]   hash            hash function applied to the elements
+ * @param[in]   k               number of counters per element,
+ *                              1 <= k <= @ref BLOOM_BLOCKED_K_MAX
+ */
+void bloom_counting_init(bloom_counting_t *bloom, uint8_t *counters,
+                         size_t blocks_numof, hashfp_t hash, unsigned k);
+
+/**
+ * @brief   Add an element to a counting Bloom filter
+ *
+ * @param[in,out]   bloom   Bloom filter
+ * @param[in]       buf     element to add
+ * @param[in]       len     length of @p buf
+ */
+void bloom_counting_add(bloom_counting_t *bloom, const uint8_t *buf,
+                        size_t len);
+
+/**
+ * @brief   Remove an element from a counting Bloom filter
+ *
+ * @warning Only remove elements that were added before, removing any other
+ *          element makes the filter miss elements that are present.
+ *
+ * @param[in,out]   bloom   Bloom filter
+ * @param[in]       buf     element to remove
+ * @param[in]       len     length of @p buf
+ */
+void bloom_counting_remove(bloom_counting_t *bloom, const uint8_t *buf,
+                           size_t len);
+
+/**
+ * @brief   Determine if an element may be in a counting Bloom filter
+ *
+ * @param[in]   bloom   Bloom filter
+ * @param[in]   buf     element to check
+ * @param[in]   len     length of @p buf
+ *
+ * @return      false if the element is not in the filter
+ * @return      true if the element may be in the filter
+ */
+bool bloom_counting_check(const bloom_counting_t *bloom, const uint8_t *buf,
+                          size_t len);
+
 #ifdef __cplusplus
 }
 #endif
@@ -33,7 +33,8 @@ extern "C" {
  * Uses the `0xedb88320` polynomial
  *
  * @note enable the `crc32_fast` module for a look-up table based implementation
- *       that trades code size for speed.
+ *       that trades code size for speed, or `crc32_slice8` for one that
+ *       processes eight bytes per step with 8 KiB of tables.
  *
  * @param[in] buf   The data to checksum
  * @param[in] size  Length of the data in bytes
@@ -42,6 +43,22 @@ extern "C" {
  */
 uint32_t crc32(const void *buf, size_t size);
 
+/**
+ * @brief   Update a CRC-32 checksum with more data
+ *
+ * This allows to checksum data that is not contiguous in memory, e.g. a
+ * file read in chunks: `crc32_update(crc32(a, la), b, lb)` equals the
+ * checksum over @p a followed by @p b.
+ *
+ * @param[in] crc   The return value of a previous call to crc32() or
+ *                  crc32_update(), 0 to start a new checksum
+ * @param[in] buf   The data to checksum
+ * @param[in] size  Length of the data in bytes
+ *
+ * @return 32 bit sized hash over all data so far
+ */
+uint32_t crc32_update(uint32_t crc, const void *buf, size_t size);
+
 #ifdef __cplusplus
 }
 #endif
@@ -54,6 +54,14 @@ typedef struct {
     uint8_t chunk_cur;                      /**< Index of the first valid chunk */
 } chunk_ringbuf_t;
 
+/**
+ * @brief Contiguous part of a chunk, see @ref crb_get_chunk
+ */
+typedef struct {
+    uint8_t *data;          /**< start of the part */
+    size_t len;             /**< length of the part */
+} crb_span_t;
+
 /**
  * @brief Callback function for @ref crb_chunk_foreach
  *
@@ -183,6 +191,23 @@ bool crb_end_chunk(chunk_ringbuf_t *rb, bool valid);
  */
 bool crb_add_chunk(chunk_ringbuf_t *rb, const void *data, size_t len);
 
+/**
+ * @brief Add a complete chunk to the Ringbuffer from any context
+ *
+ * Same as @ref crb_add_chunk, but disables interrupts itself. This allows
+ * multiple producers, e.g. several ISRs that may preempt each other, to add
+ * chunks to the same Ringbuffer, as long as all of them use this function.
+ *
+ * @param[in] rb        The Ringbuffer to work on
+ * @param[in] data      The data to write
+ * @param[in] len       Size of data
+ *
+ * @return true         If the chunk could be added to the valid chunk array
+ * @return false        There was not enough space, or another chunk is
+ *                      currently being written byte by byte
+ */
+bool crb_add_chunk_irqsafe(chunk_ringbuf_t *rb, const void *data, size_t len);
+
 /**
  * @brief Get the size of the first valid chunk
  *
@@ -221,6 +246,35 @@ bool crb_peek_bytes(chunk_ringbuf_t *rb, void *dst, size_t offset, size_t len);
  */
 bool crb_consume_chunk(chunk_ringbuf_t *rb, void *dst, size_t len);
 
+/**
+ * @brief Get the first valid chunk in place, without copying or consuming it
+ *
+ * A chunk that wraps around the end of the Ringbuffer work area is returned
+ * as two parts. The data stays valid until the chunk is released with
+ * @ref crb_release_chunk.
+ *
+ * @param[in] rb        The Ringbuffer to work on
+ * @param[out] span     The parts of the chunk. If there is only one part,
+ *                      the second one is set to length 0.
+ *
+ * @return              Number of parts of the chunk (1 or 2)
+ * @return 0            If no valid chunk exists
+ */
+unsigned crb_get_chunk(chunk_ringbuf_t *rb, crb_span_t span[2]);
+
+/**
+ * @brief Release the first valid chunk after it was processed in place
+ *
+ * @param[in] rb        The Ringbuffer to work on
+ *
+ * @return true         If a chunk was released
+ * @return false        If no valid chunk did exist
+ */
+static inline bool crb_release_chunk(chunk_ringbuf_t *rb)
+{
+    return crb_consume_chunk(rb, NULL, 0);
+}
+
 /**
  * @brief Execute a callback for each byte in the first valid chunk
  *        The callback function may be called twice if the chunk is non-continuous.
@@ -125,6 +125,55 @@ int aes_encrypt(const cipher_context_t *context, const uint8_t *plain_block,
 int aes_decrypt(const cipher_context_t *context, const uint8_t *cipher_block,
                 uint8_t *plain_block);
 
+/**
+ * @brief   encrypts @p num consecutive blocks, expanding the key only once
+ *
+ * @param       context   the cipher_context_t-struct to use
+ * @param       input     @p num blocks of plaintext
+ * @param       output    memory for @p num blocks of ciphertext, may be
+ *                        the same as @p input
+ * @param       num       number of blocks
+ *
+ * @return  1 on success
+ * @return  A negative value if the cipher key cannot be expanded with the
+ *          AES key schedule
+ */
+int aes_encrypt_blocks(const cipher_context_t *context, const uint8_t *input,
+                       uint8_t *output, size_t num);
+
+/**
+ * @brief   decrypts @p num consecutive blocks, expanding the key only once
+ *
+ * @param       context   the cipher_context_t-struct to use
+ * @param       input     @p num blocks of ciphertext
+ * @param       output    memory for @p num blocks of plaintext, may be
+ *                        the same as @p input
+ * @param       num       number of blocks
+ *
+ * @return  1 on success
+ * @return  A negative value if the cipher key cannot be expanded with the
+ *          AES key schedule
+ */
+int aes_decrypt_blocks(const cipher_context_t *context, const uint8_t *input,
+                       uint8_t *output, size_t num);
+
+/**
+ * @brief   CBC encrypts @p num blocks, expanding the key only once
+ *
+ * @param       context   the cipher_context_t-struct to use
+ * @param       iv        initialization vector, holds the last ciphertext
+ *                        block afterwards
+ * @param       input     @p num blocks of plaintext
+ * @param       output    memory for @p num blocks of ciphertext, or NULL
+ * @param       num       number of blocks
+ *
+ * @return  1 on success
+ * @return  A negative value if the cipher key cannot be expanded with the
+ *          AES key schedule
+ */
+int aes_encrypt_cbc(const cipher_context_t *context, uint8_t *iv,
+                    const uint8_t *input, uint8_t *output, size_t num);
+
 #ifdef __cplusplus
 }
 #endif
@@ -22,6 +22,7 @@
 #ifndef CRYPTO_CIPHERS_H
 #define CRYPTO_CIPHERS_H
 
+#include <stddef.h>
 #include <stdint.h>
 #include "modules.h"
 
@@ -102,6 +103,30 @@ typedef struct cipher_interface_st {
     /** @brief the decrypt function */
     int (*decrypt)(const cipher_context_t *ctx, const uint8_t *cipher_block,
                    uint8_t *plain_block);
+
+    /**
+     * @brief   encrypt @p num consecutive blocks, optional
+     *
+     * Backends that can process several blocks at once (e.g. by DMA or
+     * by setting up the key schedule only once) implement this, the
+     * modes fall back to @ref cipher_interface_st::encrypt per block
+     * if it is NULL. Returns 1 on success like encrypt().
+     */
+    int (*encrypt_blocks)(const cipher_context_t *ctx, const uint8_t *input,
+                          uint8_t *output, size_t num);
+
+    /** @brief decrypt @p num consecutive blocks, optional, see encrypt_blocks */
+    int (*decrypt_blocks)(const cipher_context_t *ctx, const uint8_t *input,
+                          uint8_t *output, size_t num);
+
+    /**
+     * @brief   CBC encrypt @p num blocks, optional
+     *
+     * @p iv holds the ciphertext of the last block afterwards. @p output
+     * may be NULL if only that is needed, as for a CBC-MAC.
+     */
+    int (*encrypt_cbc)(const cipher_context_t *ctx, uint8_t *iv,
+                       const uint8_t *input, uint8_t *output, size_t num);
 } cipher_interface_t;
 
 /** Pointer type to BlockCipher-Interface for the Cipher-Algorithms */
@@ -173,6 +198,60 @@ int cipher_encrypt(const cipher_t *cipher, const uint8_t *input,
 int cipher_decrypt(const cipher_t *cipher, const uint8_t *input,
                    uint8_t *output);
 
+/**
+ * @brief Encrypt @p num consecutive blocks
+ *
+ * Uses the multi-block operation of the cipher backend if there is one.
+ *
+ * @param cipher     Already initialized cipher struct
+ * @param input      pointer to @p num blocks of input data
+ * @param output     pointer to allocated memory for @p num blocks, may be
+ *                   the same as @p input
+ * @param num        number of blocks
+ *
+ * @return           1 in case of success
+ * @return           A negative value for an error
+ */
+int cipher_encrypt_blocks(const cipher_t *cipher, const uint8_t *input,
+                          uint8_t *output, size_t num);
+
+/**
+ * @brief Decrypt @p num consecutive blocks
+ *
+ * Uses the multi-block operation of the cipher backend if there is one.
+ *
+ * @param cipher     Already initialized cipher struct
+ * @param input      pointer to @p num blocks of input data
+ * @param output     pointer to allocated memory for @p num blocks, may be
+ *                   the same as @p input
+ * @param num        number of blocks
+ *
+ * @return           1 in case of success
+ * @return           A negative value for an error
+ */
+int cipher_decrypt_blocks(const cipher_t *cipher, const uint8_t *input,
+                          uint8_t *output, size_t num);
+
+/**
+ * @brief Encrypt @p num blocks in CBC mode
+ *
+ * Each input block is XORed with the previous ciphertext block, starting
+ * with @p iv, before it is encrypted.
+ *
+ * @param cipher     Already initialized cipher struct
+ * @param iv         initialization vector, holds the last ciphertext block
+ *                   afterwards
+ * @param input      pointer to @p num blocks of input data
+ * @param output     pointer to allocated memory for @p num blocks, or NULL
+ *                   if only the last block (in @p iv) is needed
+ * @param num        number of blocks
+ *
+ * @return           1 in case of success
+ * @return           A negative value for an error
+ */
+int cipher_encrypt_cbc_blocks(const cipher_t *cipher, uint8_t *iv,
+                              const uint8_t *input, uint8_t *output, size_t num);
+
 /**
  * @brief Get block size of cipher
  * *
@@ -47,6 +47,21 @@
  * to be queued. Thus event queues can be used safely and efficiently in combination
  * with thread flags and msg queues.
  *
+ * Threads handling bursts of events can use event_process_multi() to handle
+ * several events of the same queue per wakeup, see
+ * @ref CONFIG_EVENT_LOOP_BATCH_SIZE.
+ *
+ * With module `event_stats`, every queue counts the events taken from it and
+ * tracks the latency between posting and taking an event, see
+ * @ref event_queue_stats_t.
+ *
+ * With module `event_dlist`, every event also links to its predecessor on the
+ * queue, so event_cancel() runs in O(1) instead of O(n). In addition, events
+ * are queued by their event_t::priority: an event is queued behind all events
+ * of the same or higher priority, but ahead of those of lower priority. As
+ * the priority defaults to 0, events are queued in FIFO order in O(1) unless
+ * priorities are used.
+ *
  * Examples:
  *
  * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
@@ -122,6 +137,17 @@ extern "C" {
 #define THREAD_FLAG_EVENT   (0x1)
 #endif
 
+/**
+ * @brief   Maximum number of events handled per wakeup by event_loop_multi()
+ *
+ * If greater than 1, event_loop_multi() and event_loop() handle up to this
+ * many events from the highest priority non-empty queue before looking at
+ * the other queues again, using event_process_multi().
+ */
+#ifndef CONFIG_EVENT_LOOP_BATCH_SIZE
+#define CONFIG_EVENT_LOOP_BATCH_SIZE    1
+#endif
+
 /**
  * @brief   event_queue_t static initializer
  */
@@ -148,14 +174,36 @@ typedef void (*event_handler_t)(event_t *);
 struct event {
     clist_node_t list_node;     /**< event queue list entry             */
     event_handler_t handler;    /**< pointer to event handler function  */
+#if IS_USED(MODULE_EVENT_DLIST) || defined(DOXYGEN)
+    clist_node_t *prev;         /**< list entry of the previous event,
+                                     only with module `event_dlist`     */
+    uint8_t priority;           /**< events of higher priority are
+                                     queued ahead of those of lower
+                                     priority, only with `event_dlist`  */
+#endif
+#if IS_USED(MODULE_EVENT_STATS) || defined(DOXYGEN)
+    uint32_t posted_at;         /**< ZTIMER_USEC time of posting        */
+#endif
 };
 
+/**
+ * @brief   Per-queue dispatch statistics, only with module `event_stats`
+ */
+typedef struct {
+    uint32_t dispatched;        /**< number of events taken from the queue */
+    uint32_t latency_max;       /**< maximum post to dispatch latency in us */
+    uint64_t latency_sum;       /**< sum of all latencies in us         */
+} event_queue_stats_t;
+
 /**
  * @brief   event queue structure
  */
 typedef struct PTRTAG {
     clist_node_t event_list;    /**< list of queued events              */
     thread_t *waiter;           /**< thread owning event queue          */
+#if IS_USED(MODULE_EVENT_STATS) || defined(DOXYGEN)
+    event_queue_stats_t stats;  /**< dispatch statistics                */
+#endif
 } event_queue_t;
 
 /**
@@ -270,7 +318,10 @@ void event_post(event_queue_t *queue, event_t *event);
  *
  * This will remove a queued event from an event queue.
  *
- * @note    Due to the underlying list implementation, this will run in O(n).
+ * @note    Due to the underlying list implementation, this will run in O(n),
+ *          or in O(1) with module `event_dlist`.
+ *
+ * @pre     @p event is not queued on any other queue than @p queue
  *
  * @param[in]   queue   event queue to remove event from
  * @param[in]   event   event to remove from queue
@@ -334,6 +385,52 @@ event_t *event_get(event_queue_t *queue);
  */
 event_t *event_wait_multi(event_queue_t *queues, size_t n_queues);
 
+/**
+ * @brief   Handle a batch of events from the given event queues, blocking
+ *
+ * This function will block until an event becomes available in any of
+ * @p queues. It then handles up to @p max events from the queue with the
+ * lowest index that contains an event, without checking the other queues or
+ * the thread flags in between. This saves the cost of waiting on the thread
+ * flags for each event when events arrive in bursts.
+ *
+ * @warning There can only be a single waiter on a queue!
+ * @note    Events posted to a higher priority queue while a batch is handled
+ *          are delayed until the batch is complete. Choose @p max such that
+ *          the resulting latency is acceptable.
+ *
+ * @pre     0 < @p n_queues (expect blowing `assert()` otherwise)
+ * @pre     0 < @p max
+ * @pre     The queue must have a waiter (i.e. it should have been claimed, or
+ *          initialized using @ref event_queue_init, @ref event_queues_init)
+ *
+ * @param[in]   queues      Array of event queues to get events from
+ * @param[in]   n_queues    Number of event queues passed in @p queues
+ * @param[in]   max         Maximum number of events to handle
+ *
+ * @returns     number of events handled, at least 1
+ */
+unsigned event_process_multi(event_queue_t *queues, size_t n_queues,
+                             unsigned max);
+
+#if IS_USED(MODULE_EVENT_STATS) || defined(DOXYGEN)
+/**
+ * @brief   Get the dispatch statistics of an event queue
+ *
+ * @param[in]   queue   event queue to get statistics of
+ * @param[out]  stats   statistics are written here
+ */
+void event_queue_get_stats(const event_queue_t *queue,
+                           event_queue_stats_t *stats);
+
+/**
+ * @brief   Reset the dispatch statistics of an event queue
+ *
+ * @param[in,out]   queue   event queue to reset statistics of
+ */
+void event_queue_reset_stats(event_queue_t *queue);
+#endif
+
 /**
  * @brief   Get next event from event queue, blocking
  *
@@ -424,6 +521,9 @@ event_t *event_wait_timeout_ztimer(event_queue_t *queue,
  *     }
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~
  *
+ * If @ref CONFIG_EVENT_LOOP_BATCH_SIZE is greater than 1, events are handled
+ * in batches using event_process_multi() instead.
+ *
  * @see event_wait_multi
  *
  * @pre     The queue must have a waiter (i.e. it should have been claimed, or
@@ -434,6 +534,12 @@ event_t *event_wait_timeout_ztimer(event_queue_t *queue,
  */
 static inline void event_loop_multi(event_queue_t *queues, size_t n_queues)
 {
+    if (CONFIG_EVENT_LOOP_BATCH_SIZE > 1) {
+        while (1) {
+            event_process_multi(queues, n_queues, CONFIG_EVENT_LOOP_BATCH_SIZE);
+        }
+    }
+
     event_t *event;
 
     while ((event = event_wait_multi(queues, n_queues))) {
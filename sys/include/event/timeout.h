@@ -107,6 +107,18 @@ void event_timeout_set(event_timeout_t *event_timeout, uint32_t timeout);
  */
 void event_timeout_clear(event_timeout_t *event_timeout);
 
+/**
+ * @brief   Clear a timeout event and remove its event from the queue
+ *
+ * Unlike @ref event_timeout_clear, this also removes the connected event from
+ * the event queue if the timer has already fired, so the event will not be
+ * handled after this returns (unless it is already being handled). This runs
+ * in O(1) with module `event_dlist`.
+ *
+ * @param[in]   event_timeout   event_timeout context object to use
+ */
+void event_timeout_cancel(event_timeout_t *event_timeout);
+
 /**
  * @brief   Check if a timeout event is scheduled to be executed in the future
  *
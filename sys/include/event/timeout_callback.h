@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_event
+ * @brief       Provides timer callbacks that are executed by an event thread
+ *
+ * A plain @ref ztimer_t executes its callback in the interrupt context of the
+ * clock. For callbacks that take longer, this increases interrupt latency for
+ * everything else. A timeout callback event defers the callback to an event
+ * queue instead: in interrupt context, only the timer is dequeued and the
+ * event is posted.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * static event_timeout_callback_t resp_timeout;
+ *
+ * event_timeout_callback_init(&resp_timeout, ZTIMER_MSEC, EVENT_PRIO_MEDIUM,
+ *                             on_resp_timeout, ctx);
+ * event_timeout_callback_set(&resp_timeout, 2000);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief       Event Timeout Callback API
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ */
+
+#ifndef EVENT_TIMEOUT_CALLBACK_H
+#define EVENT_TIMEOUT_CALLBACK_H
+
+#include <string.h>
+
+#include "event/callback.h"
+#include "event/timeout.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Timeout Callback Event structure
+ */
+typedef struct {
+    event_timeout_t timeout;    /**< timeout event portion */
+    event_callback_t event;     /**< callback event portion */
+} event_timeout_callback_t;
+
+/**
+ * @brief   Initialize a timeout callback event
+ *
+ * @param[out]  event           event_timeout_callback object to initialize
+ * @param[in]   clock           the clock to configure the timer on
+ * @param[in]   queue           queue that executes @p callback on timeout
+ * @param[in]   callback        callback to set up
+ * @param[in]   arg             callback argument to set up
+ */
+static inline void event_timeout_callback_init(event_timeout_callback_t *event,
+                                               ztimer_clock_t *clock,
+                                               event_queue_t *queue,
+                                               void (*callback)(void *),
+                                               void *arg)
+{
+    memset(&event->event, 0, sizeof(event->event));
+    event->event.super.handler = _event_callback_handler;
+    event->event.callback = callback;
+    event->event.arg = arg;
+
+    event_timeout_ztimer_init(&event->timeout, clock, queue, &event->event.super);
+}
+
+/**
+ * @brief   Set a timeout callback event
+ *
+ * After @p timeout ticks of the configured clock, the callback is executed by
+ * the thread serving the configured event queue. Setting an already set
+ * timeout callback event restarts it.
+ *
+ * @note: the used event_timeout_callback struct must stay valid until after
+ *        the callback has been executed!
+ *
+ * @param[in]   event           event_timeout_callback context object to use
+ * @param[in]   timeout         timeout in ticks of the configured clock
+ */
+static inline void event_timeout_callback_set(event_timeout_callback_t *event,
+                                              uint32_t timeout)
+{
+    event_timeout_set(&event->timeout, timeout);
+}
+
+/**
+ * @brief   Clear a timeout callback event
+ *
+ * If the timer has already fired, the callback event is also removed from the
+ * event queue, so the callback will not be executed after this returns
+ * (unless it is already running).
+ *
+ * @param[in]   event           event_timeout_callback context object to use
+ */
+static inline void event_timeout_callback_clear(event_timeout_callback_t *event)
+{
+    event_timeout_cancel(&event->timeout);
+}
+
+/**
+ * @brief   Check if a timeout callback event is pending
+ *
+ * @param[in]   event           event_timeout_callback context object to use
+ *
+ * @return      true if the callback has yet to be executed, false otherwise
+ */
+static inline bool event_timeout_callback_is_pending(const event_timeout_callback_t *event)
+{
+    return event_timeout_is_pending(&event->timeout);
+}
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* EVENT_TIMEOUT_CALLBACK_H */
+/** @} */
@@ -29,6 +29,14 @@
  * - when a number of timeouts with the same callback function need to be
  *   scheduled, evtimer is using less RAM (due to storing the callback function
  *   only once), while each ztimer has a function pointer for the callback.
+ *
+ * By default, the events of an evtimer are kept in a list sorted by their
+ * trigger time, so adding and removing an event takes O(n). With the
+ * `evtimer_heap` pseudomodule, pending events are kept in a pairing heap
+ * instead, making evtimer_add() O(1) and evtimer_del() O(log n) amortized at
+ * the cost of two more pointers per event. Use evtimer_iter() and
+ * evtimer_event_offset() instead of accessing the events directly to be
+ * independent of that choice.
  * @{
  *
  * @file
@@ -41,6 +49,7 @@
 #ifndef EVTIMER_H
 #define EVTIMER_H
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "modules.h"
 
@@ -56,6 +65,11 @@ extern "C" {
 typedef struct evtimer_event {
     struct evtimer_event *next; /**< the next event in the queue */
     uint32_t offset;            /**< offset in milliseconds from previous event */
+#if IS_USED(MODULE_EVTIMER_HEAP) || DOXYGEN
+    struct evtimer_event *child;    /**< first child in the heap */
+    struct evtimer_event *prev;     /**< parent or left sibling in the heap,
+                                         NULL if the event is not pending */
+#endif
 } evtimer_event_t;
 
 /**
@@ -72,6 +86,10 @@ typedef struct {
     evtimer_callback_t callback;    /**< Handler function for this evtimer's
                                          event type */
     evtimer_event_t *events;        /**< Event queue */
+#if IS_USED(MODULE_EVTIMER_HEAP) || DOXYGEN
+    evtimer_event_t *heap;          /**< root of the heap of events not yet
+                                         due */
+#endif
 } evtimer_t;
 
 /**
@@ -89,6 +107,9 @@ void evtimer_init(evtimer_t *evtimer, evtimer_callback_t handler);
 /**
  * @brief   Adds event to an event timer
  *
+ * With `evtimer_heap`, @p event must not be pending already and must have
+ * been zero initialized before its first use.
+ *
  * @param[in] evtimer       An event timer
  * @param[in] event         An event
  */
@@ -102,6 +123,44 @@ void evtimer_add(evtimer_t *evtimer, evtimer_event_t *event);
  */
 void evtimer_del(evtimer_t *evtimer, evtimer_event_t *event);
 
+/**
+ * @brief   Check if an event is pending on an event timer
+ *
+ * @param[in] evtimer   An event timer
+ * @param[in] event     An event
+ *
+ * @return  true if @p event is yet to be triggered by @p evtimer
+ */
+bool evtimer_is_pending(const evtimer_t *evtimer, const evtimer_event_t *event);
+
+/**
+ * @brief   Iterate over the pending events of an event timer
+ *
+ * The events are not visited in the order of their trigger time when using
+ * `evtimer_heap`. The event timer must not be modified while iterating.
+ *
+ * @param[in] evtimer   An event timer
+ * @param[in] event     The event visited last, or NULL to start
+ *
+ * @return  the next pending event, NULL after the last one
+ */
+evtimer_event_t *evtimer_iter(const evtimer_t *evtimer,
+                              const evtimer_event_t *event);
+
+/**
+ * @brief   Get the time until a pending event triggers
+ *
+ * @pre @p event is pending on @p evtimer
+ *
+ * @param[in] evtimer   An event timer
+ * @param[in] event     An event
+ *
+ * @return  offset of @p event in milliseconds relative to the time the
+ *          timer was last updated on, evtimer_t::base
+ */
+uint32_t evtimer_event_offset(const evtimer_t *evtimer,
+                              const evtimer_event_t *event);
+
 /**
  * @brief   Print overview of current state of an event timer
  *
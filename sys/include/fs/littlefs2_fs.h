@@ -77,6 +77,16 @@ extern "C" {
 #define CONFIG_LITTLEFS2_BLOCK_CYCLES       (512)
 #endif
 
+#ifndef CONFIG_LITTLEFS2_IO_CHUNK_SIZE
+/**
+ * Maximum number of bytes read or written while holding the file system lock.
+ *
+ * Longer reads and writes are split, so operations on other files and
+ * directories of the same mount get a chance to run in between. If 0, the
+ * block size is used. */
+#define CONFIG_LITTLEFS2_IO_CHUNK_SIZE      (0)
+#endif
+
 #ifndef CONFIG_LITTLEFS2_MIN_BLOCK_SIZE_EXP
 /**
  * The exponent of the minimum acceptable block size in bytes (2^n).
@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup  sys_fs_tslog tslog VFS view
+ * @ingroup   sys_fs
+ * @brief     Read-only VFS access to a @ref sys_tslog
+ *
+ * The mount point contains a single file `log` that streams all records of
+ * the log, oldest first. Each record is encoded as its timestamp (32 bit,
+ * little endian), its payload length (16 bit, little endian) and the payload.
+ *
+ * Records appended while the file is open are read as well. Records that are
+ * overwritten before they were read are silently skipped. The file can only be
+ * rewound to its start, it can not be seeked in.
+ *
+ * @code
+ * static tslog_t log;
+ * static vfs_mount_t mnt = {
+ *     .fs = &tslog_fs_file_system,
+ *     .mount_point = "/tslog",
+ *     .private_data = &log,
+ * };
+ * @endcode
+ *
+ * @{
+ * @file
+ * @brief   tslog VFS view
+ * @author  RIOT developers <devel@riot-os.org>
+ */
+
+#ifndef FS_TSLOG_FS_H
+#define FS_TSLOG_FS_H
+
+#include <stdint.h>
+
+#include "tslog.h"
+#include "vfs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Size of the encoding of a record without the payload
+ */
+#define TSLOG_FS_ENTRY_HDR_SIZE     (6U)
+
+/**
+ * @brief   State of an open file
+ */
+typedef struct {
+    tslog_iter_t it;        /**< record currently read */
+    uint32_t offset;        /**< bytes of that record already read */
+} tslog_fs_file_t;
+
+#if VFS_FILE_BUFFER_SIZE < 12
+#error VFS_FILE_BUFFER_SIZE is too small, at least 12 bytes is required
+#endif
+
+/**
+ * @brief   tslog VFS file system driver
+ *
+ * For use with vfs_mount, the private data of the mount is the @ref tslog_t
+ */
+extern const vfs_file_system_t tslog_fs_file_system;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FS_TSLOG_FS_H */
+
+/** @} */
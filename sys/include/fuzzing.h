@@ -13,6 +13,18 @@
  *
  * @brief       Various utilities for fuzzing network applications.
  *
+ * Fuzzing applications pass a fuzz target with the signature of libFuzzer's
+ * `LLVMFuzzerTestOneInput()` to fuzzing_run(). When compiled with AFL++
+ * (`afl-cc` defines `__AFL_LOOP`), fuzzing_run() calls the target in
+ * persistent mode: up to @ref CONFIG_FUZZING_PERSISTENT_ITERATIONS inputs are
+ * processed by the same process before AFL++ forks a fresh one, which avoids
+ * booting RIOT for every single input. Otherwise, the target is called once
+ * with the input read from standard input.
+ *
+ * Targets feeding packets to GNRC use fuzzing_dispatch(), which returns once
+ * the packet was consumed, so all state referencing the input is gone before
+ * the next iteration starts.
+ *
  * @{
  * @file
  *
@@ -26,11 +38,43 @@
 extern "C" {
 #endif
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include "net/ipv6/addr.h"
+#include "net/gnrc/nettype.h"
 #include "net/gnrc/pkt.h"
 
+/**
+ * @brief   Number of inputs processed by one process in persistent mode
+ */
+#ifndef CONFIG_FUZZING_PERSISTENT_ITERATIONS
+#define CONFIG_FUZZING_PERSISTENT_ITERATIONS    (10000)
+#endif
+
+/**
+ * @brief   Defined to 1 if fuzzing_run() uses AFL++'s persistent mode
+ */
+#if defined(__AFL_LOOP) || defined(DOXYGEN)
+#define FUZZING_PERSISTENT                      (1)
+#else
+#define FUZZING_PERSISTENT                      (0)
+#endif
+
+/**
+ * @brief   Fuzz target, called once for every input
+ *
+ * Same signature as libFuzzer's `LLVMFuzzerTestOneInput()`. The target must
+ * not keep any reference to @p data and must reset all state it modified
+ * before returning.
+ *
+ * @param[in] data  Input
+ * @param[in] size  Length of @p data
+ *
+ * @return 0, other values are reserved
+ */
+typedef int (*fuzzing_target_t)(const uint8_t *data, size_t size);
+
 /**
  * @brief Initialize dummy network interface with given address.
  *
@@ -62,6 +106,43 @@ int fuzzing_read_packet(int fd, gnrc_pktsnip_t *pkt);
  */
 uint8_t *fuzzing_read_bytes(int fd, size_t *size);
 
+/**
+ * @brief Call the fuzz target with the input(s) provided by the fuzzer.
+ *
+ * @param target Fuzz target.
+ *
+ * @return 0 once all inputs are processed, non-zero if reading the input
+ *         failed.
+ */
+int fuzzing_run(fuzzing_target_t target);
+
+/**
+ * @brief Dispatch data as packet to GNRC and wait until it is processed.
+ *
+ * The data is copied into @p pkt, which is then dispatched to all receivers
+ * of @p type and @p demux. The packet counts as processed once it is freed,
+ * or once the next packet is requested when using `gnrc_sock`.
+ *
+ * @param pkt Allocated packet to copy @p data to, will be resized
+ *            accordingly. Released on error.
+ * @param type Type to dispatch @p pkt to.
+ * @param demux Demultiplexing context to dispatch @p pkt to.
+ * @param data Packet data.
+ * @param size Length of @p data.
+ *
+ * @return 0 on success, non-zero otherwise.
+ */
+int fuzzing_dispatch(gnrc_pktsnip_t *pkt, gnrc_nettype_t type, uint32_t demux,
+                     const uint8_t *data, size_t size);
+
+/**
+ * @brief Signal that the fuzzing packet was processed.
+ *
+ * Terminates the application unless called while fuzzing_run() is running in
+ * persistent mode. Only to be called by the network stack.
+ */
+void fuzzing_done(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -71,6 +71,12 @@ extern "C" {
  */
 typedef sha2xx_context_t sha256_context_t;
 
+/**
+ * @brief Context hashing up to @ref SHA2XX_MULTI_LANES_MAX messages of the
+ *        same length at once
+ */
+typedef sha2xx_multi_context_t sha256_multi_context_t;
+
 /**
  * @brief Context for HMAC operations based on sha256
  */
@@ -133,6 +139,54 @@ static inline void sha256_final(sha256_context_t *ctx, void *digest)
  */
 void sha256(const void *data, size_t len, void *digest);
 
+/**
+ * @brief Multi-buffer SHA-256 initialization
+ *
+ * The blocks of all lanes are compressed together. Their rounds are
+ * independent of each other and can be executed in parallel by superscalar
+ * CPUs, which makes hashing several messages faster than hashing them one
+ * after the other.
+ *
+ * @param ctx   sha256_multi_context_t handle to init
+ * @param lanes Number of messages to hash, 1 to @ref SHA2XX_MULTI_LANES_MAX
+ */
+void sha256_multi_init(sha256_multi_context_t *ctx, unsigned lanes);
+
+/**
+ * @brief Add the same number of bytes to every message of a multi-buffer context
+ *
+ * @param ctx      sha256_multi_context_t handle to use
+ * @param[in] data Input data, one pointer per lane
+ * @param[in] len  Length of the input of each lane
+ */
+static inline void sha256_multi_update(sha256_multi_context_t *ctx,
+                                       const void *const data[], size_t len)
+{
+    sha2xx_multi_update(ctx, data, len);
+}
+
+/**
+ * @brief Multi-buffer SHA-256 finalization. Pads the input data, exports the
+ * hash values, and clears the context state.
+ *
+ * @param ctx    sha256_multi_context_t handle to use
+ * @param digest resulting digests, one pointer per lane
+ */
+static inline void sha256_multi_final(sha256_multi_context_t *ctx, void *const digest[])
+{
+    sha2xx_multi_final(ctx, digest, SHA256_DIGEST_LENGTH);
+}
+
+/**
+ * @brief Hash up to @ref SHA2XX_MULTI_LANES_MAX buffers of the same length
+ *
+ * @param[in] data   pointers to the buffers to generate the hashes from
+ * @param[in] len    length of each buffer
+ * @param[out] digest pointers to the results, each of SHA256_DIGEST_LENGTH
+ * @param[in] lanes  number of buffers
+ */
+void sha256_multi(const void *const data[], size_t len, void *const digest[], unsigned lanes);
+
 /**
  * @brief hmac_sha256_init HMAC SHA-256 calculation. Initiate calculation of a HMAC
  * @param[in] ctx hmac_context_t handle to use
@@ -68,6 +68,27 @@ typedef struct {
     unsigned char buf[64];
 } sha2xx_context_t;
 
+/**
+ * @brief   Maximum number of streams hashed together by a multi-buffer context
+ */
+#define SHA2XX_MULTI_LANES_MAX  (4)
+
+/**
+ * @brief    Structure to hold a multi-buffer SHA-2XX context.
+ *
+ * All streams (lanes) of a context have the same length.
+ */
+typedef struct {
+    /** global state of each lane */
+    uint32_t state[SHA2XX_MULTI_LANES_MAX][8];
+    /** processed bits counter, shared by all lanes */
+    uint32_t count[2];
+    /** data buffer of each lane */
+    unsigned char buf[SHA2XX_MULTI_LANES_MAX][64];
+    /** number of lanes in use */
+    uint8_t lanes;
+} sha2xx_multi_context_t;
+
 /**
  * @brief SHA-2XX initialization.  Begins a SHA-2XX operation.
  *
@@ -94,6 +115,24 @@ void sha2xx_update(sha2xx_context_t *ctx, const void *data, size_t len);
  */
 void sha2xx_final(sha2xx_context_t *ctx, void *digest, size_t dig_len);
 
+/**
+ * @brief Add the same number of bytes to every lane of a multi-buffer context
+ *
+ * @param ctx      sha2xx_multi_context_t handle to use
+ * @param[in] data Input data, one pointer per lane
+ * @param[in] len  Length of the input of each lane
+ */
+void sha2xx_multi_update(sha2xx_multi_context_t *ctx, const void *const data[], size_t len);
+
+/**
+ * @brief Finalize all lanes of a multi-buffer context and clear it
+ *
+ * @param ctx     sha2xx_multi_context_t handle to use
+ * @param digest  Resulting digests, one pointer per lane
+ * @param dig_len Length of the digests to export
+ */
+void sha2xx_multi_final(sha2xx_multi_context_t *ctx, void *const digest[], size_t dig_len);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_hashes_siphash SipHash
+ * @ingroup     sys_hashes_keyed
+ * @brief       Implementation of the SipHash-2-4 keyed hash function
+ *
+ * SipHash is a short-input pseudorandom function. It is a lot cheaper than
+ * e.g. HMAC-SHA-256, but its 64 bit output is only unpredictable as long as
+ * the key is secret. It is meant for hash tables whose keys are chosen by an
+ * attacker, not for message authentication with long-term security.
+ *
+ * See https://cr.yp.to/siphash/siphash-20120918.pdf
+ *
+ * @{
+ *
+ * @file
+ * @brief       SipHash-2-4 interface definition
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ */
+
+#ifndef HASHES_SIPHASH_H
+#define HASHES_SIPHASH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Length of SipHash keys in byte
+ */
+#define SIPHASH_KEY_LENGTH      (16)
+
+/**
+ * @brief   Length of SipHash digests in byte
+ */
+#define SIPHASH_DIGEST_LENGTH   (8)
+
+/**
+ * @brief   SipHash context
+ * @internal
+ */
+typedef struct {
+    uint64_t v[4];      /**< internal state */
+    uint64_t buf;       /**< message bytes not processed yet */
+    uint8_t buf_len;    /**< number of bytes in siphash_context_t::buf */
+    uint8_t len;        /**< message length modulo 256 */
+} siphash_context_t;
+
+/**
+ * @brief   Initializes a SipHash context
+ *
+ * @param[out] ctx  The context to initialize
+ * @param[in] key   Key of @ref SIPHASH_KEY_LENGTH bytes
+ */
+void siphash_init(siphash_context_t *ctx, const uint8_t *key);
+
+/**
+ * @brief   Adds a portion of the message to a SipHash context
+ *
+ * @param[in,out] ctx   The context
+ * @param[in] data      Input data
+ * @param[in] len       Length of @p data
+ */
+void siphash_update(siphash_context_t *ctx, const void *data, size_t len);
+
+/**
+ * @brief   Finalizes the SipHash calculation
+ *
+ * @param[in,out] ctx   The context, which is invalid afterwards
+ *
+ * @return  The 64 bit hash value
+ */
+uint64_t siphash_final(siphash_context_t *ctx);
+
+/**
+ * @brief   Calculates the SipHash-2-4 of a message
+ *
+ * @param[in] key   Key of @ref SIPHASH_KEY_LENGTH bytes
+ * @param[in] data  Input data
+ * @param[in] len   Length of @p data
+ *
+ * @return  The 64 bit hash value
+ */
+uint64_t siphash(const uint8_t *key, const void *data, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HASHES_SIPHASH_H */
+/** @} */
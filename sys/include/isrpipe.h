@@ -77,6 +77,32 @@ int isrpipe_write_one(isrpipe_t *isrpipe, uint8_t c);
  */
 int isrpipe_write(isrpipe_t *isrpipe, const uint8_t *buf, size_t n);
 
+/**
+ * @brief   Get contiguous free space in the isrpipe's buffer to write to
+ *          in place
+ *
+ * Meant for drivers that receive a block of bytes at once, e.g. by DMA.
+ * The bytes are passed to the reader with @ref isrpipe_commit().
+ *
+ * @param[in]   isrpipe     isrpipe object to operate on
+ * @param[out]  buf         start of the free space
+ *
+ * @returns     number of bytes that can be written to @p buf
+ */
+static inline size_t isrpipe_reserve_linear(isrpipe_t *isrpipe, uint8_t **buf)
+{
+    return tsrb_reserve_linear(&isrpipe->tsrb, buf);
+}
+
+/**
+ * @brief   Pass bytes written to space obtained by
+ *          @ref isrpipe_reserve_linear() to the reader
+ *
+ * @param[in]   isrpipe     isrpipe object to operate on
+ * @param[in]   n           number of bytes written
+ */
+void isrpipe_commit(isrpipe_t *isrpipe, size_t n);
+
 /**
  * @brief   Read data from isrpipe (blocking)
  *
@@ -0,0 +1,179 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_lockstats Lock contention statistics
+ * @ingroup     sys
+ * @brief       Wait and hold times of mutexes and message queue usage
+ *
+ * When this module is used, the kernel records
+ *
+ * - for mutexes: how often they were locked, how often a thread had to wait
+ *   for them, and the total and maximum time spent waiting and holding them,
+ * - for message queues: the highest number of messages queued at once per
+ *   thread and how often `queue_msg()` found the queue full. For blocking
+ *   sends the sender then waits for the receiver, messages sent with
+ *   msg_try_send() or from ISR context are dropped.
+ *
+ * Mutexes are keyed by their address. To keep the overhead of uncontended
+ * locks low, a mutex is only tracked after a thread had to wait for it for the
+ * first time, or after it has been given a name with lockstats_mutex_name().
+ * At most @ref CONFIG_LOCKSTATS_MUTEX_NUMOF mutexes are tracked, further
+ * contentions are only counted (see lockstats_untracked()).
+ *
+ * Times are measured in microseconds using `ZTIMER_USEC`, starting with
+ * auto_init. Hold times are measured from locking to unlocking, regardless of
+ * which thread (or ISR) unlocks the mutex.
+ *
+ * The statistics are printed by the `lockstats` shell command. With the
+ * module `trace_events`, the wait for a mutex (@ref TRACE_EVENT_MUTEX_WAIT,
+ * @ref TRACE_EVENT_MUTEX_ACQUIRE) and full message queues
+ * (@ref TRACE_EVENT_MSG_QUEUE_FULL) additionally show up in the trace.
+ *
+ * @warning This module adds overhead to every mutex and message operation and
+ *          disables the lock-free fast path of mutexes. It is meant for
+ *          profiling, not for production use.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Lock contention statistics API
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ */
+
+#ifndef LOCKSTATS_H
+#define LOCKSTATS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "mutex.h"
+#include "sched.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Maximum number of mutexes tracked
+ */
+#ifndef CONFIG_LOCKSTATS_MUTEX_NUMOF
+#define CONFIG_LOCKSTATS_MUTEX_NUMOF    (16)
+#endif
+
+/**
+ * @brief   Statistics of a single mutex
+ */
+typedef struct {
+    const mutex_t *mutex;       /**< tracked mutex, `NULL` if unused */
+    const char *name;           /**< name of the mutex or `NULL` */
+    uint32_t locks;             /**< number of times the mutex was locked */
+    uint32_t contentions;       /**< number of times a thread had to wait */
+    uint32_t wait_max;          /**< longest wait in us */
+    uint32_t hold_max;          /**< longest time the mutex was held in us */
+    uint64_t wait_total;        /**< sum of all waits in us */
+    uint64_t hold_total;        /**< sum of all hold times in us */
+    uint32_t locked_at;         /**< time of the last lock */
+    bool held;                  /**< mutex is held and locked_at is valid */
+} lockstats_mutex_t;
+
+/**
+ * @brief   Message queue statistics of a single thread
+ */
+typedef struct {
+    uint16_t high_watermark;    /**< most messages queued at once */
+    uint16_t full;              /**< number of times the queue was full */
+} lockstats_msg_queue_t;
+
+/**
+ * @brief   Track @p mutex and report it by @p name
+ *
+ * @param[in]   mutex   mutex to track
+ * @param[in]   name    name to report, must stay valid
+ *
+ * @retval  0 on success
+ * @retval  -ENOMEM if @ref CONFIG_LOCKSTATS_MUTEX_NUMOF mutexes are tracked
+ *          already
+ */
+int lockstats_mutex_name(const mutex_t *mutex, const char *name);
+
+/**
+ * @brief   Get a copy of the statistics in slot @p idx
+ *
+ * @param[in]   idx     slot, from 0 to @ref CONFIG_LOCKSTATS_MUTEX_NUMOF - 1
+ * @param[out]  stats   statistics of the mutex
+ *
+ * @return  true if a mutex is tracked in this slot
+ */
+bool lockstats_mutex_get(unsigned idx, lockstats_mutex_t *stats);
+
+/**
+ * @brief   Number of contentions on mutexes that could not be tracked
+ */
+uint32_t lockstats_untracked(void);
+
+/**
+ * @brief   Get the message queue statistics of thread @p pid
+ *
+ * @param[in]   pid     thread to query
+ * @param[out]  stats   statistics of the thread's message queue
+ */
+void lockstats_msg_queue_get(kernel_pid_t pid, lockstats_msg_queue_t *stats);
+
+/**
+ * @brief   Reset all statistics
+ *
+ * Tracked mutexes and their names are kept.
+ */
+void lockstats_reset(void);
+
+/**
+ * @name    Hooks called by the kernel
+ * @internal
+ * @{
+ */
+/**
+ * @brief   A thread is about to block on @p mutex
+ *
+ * @return  start time of the wait
+ */
+uint32_t lockstats_mutex_block(const mutex_t *mutex);
+
+/**
+ * @brief   @p mutex was locked without waiting
+ */
+void lockstats_mutex_locked(const mutex_t *mutex);
+
+/**
+ * @brief   @p mutex was handed over to a thread waiting since @p since
+ */
+void lockstats_mutex_waited(const mutex_t *mutex, uint32_t since);
+
+/**
+ * @brief   @p mutex is about to be unlocked
+ */
+void lockstats_mutex_unlocked(const mutex_t *mutex);
+
+/**
+ * @brief   A message was added to the queue of @p thread
+ */
+void lockstats_msg_queued(const thread_t *thread);
+
+/**
+ * @brief   The message queue of @p thread was full
+ */
+void lockstats_msg_queue_full(const thread_t *thread);
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOCKSTATS_H */
+/** @} */
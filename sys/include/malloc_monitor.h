@@ -19,6 +19,7 @@
 #include <string.h>
 
 #include "architecture.h"
+#include "sched.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -48,6 +49,54 @@ size_t malloc_monitor_get_usage_high_watermark(void);
  */
 void malloc_monitor_reset_high_watermark(void);
 
+/**
+ * @brief Obtain current heap memory usage of a thread.
+ *
+ * Memory is accounted to the thread that allocated it, even if another thread
+ * frees or reallocates it. Memory allocated before the scheduler started is
+ * accounted to @ref KERNEL_PID_UNDEF.
+ *
+ * @param[in]   pid     thread to get the usage of
+ *
+ * @return      heap memory currently allocated by @p pid in bytes
+ */
+size_t malloc_monitor_get_thread_usage_current(kernel_pid_t pid);
+
+/**
+ * @brief Obtain maximum heap memory usage of a thread since last call to
+ *        @ref malloc_monitor_reset_high_watermark().
+ *
+ * @param[in]   pid     thread to get the usage of
+ *
+ * @return      maximum heap memory allocated by @p pid in bytes
+ */
+size_t malloc_monitor_get_thread_usage_high_watermark(kernel_pid_t pid);
+
+#if defined(MODULE_MALLOC_MONITOR_TRACE) || defined(DOXYGEN)
+/**
+ * @brief Print the allocation trace and the currently allocated blocks.
+ *
+ * Prints one line per traced call, oldest first:
+ * `mmt <time in ms> <op> <pid> <caller pc> <address> <size>`, where `op` is
+ * one of `m` (malloc), `c` (calloc), `r` (realloc) or `f` (free). A realloc
+ * is traced as free of the old block followed by `r` for the new block.
+ * Then one line per block that is currently allocated:
+ * `mml <address> <size> <pid>`.
+ *
+ * The output can be analyzed with `dist/tools/malloc_monitor/malloc_trace.py`.
+ *
+ * @note Only available with the `malloc_monitor_trace` module.
+ */
+void malloc_monitor_trace_dump(void);
+
+/**
+ * @brief Clear the allocation trace.
+ *
+ * @note Only available with the `malloc_monitor_trace` module.
+ */
+void malloc_monitor_trace_reset(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_malloc_tlsf TLSF as system memory allocator
+ * @ingroup     sys_memory_management
+ * @brief       Use TLSF for malloc() and friends of the whole firmware
+ *
+ * This module replaces the allocator of the C library by the
+ * [TLSF](http://www.gii.upv.es/tlsf/) allocator of @ref pkg_tlsf_malloc.
+ * TLSF allocates and frees in O(1): the execution time of malloc(), free()
+ * and realloc() does not depend on the number or the size of the blocks on
+ * the heap. This makes dynamic memory usable from real-time threads.
+ * Since C++ `new` and `delete` (see @ref cpp_new_delete) are implemented on
+ * top of malloc() and free(), they are covered as well.
+ *
+ * Each call to TLSF runs with interrupts disabled for a bounded time, so no
+ * additional locking is needed. The wrappers of @ref sys_malloc_ts therefore
+ * skip their mutex, unless @ref sys_malloc_monitor is used. With
+ * @ref sys_malloc_monitor, the usage and high water mark of every thread can
+ * be obtained with @ref malloc_monitor_get_thread_usage_current() and
+ * @ref malloc_monitor_get_thread_usage_high_watermark().
+ *
+ * # Heap regions
+ *
+ * On the first allocation, all heap regions of the linker script
+ * (`_sheap`/`_eheap`, and `_sheap1`/`_eheap1` up to `_sheap3`/`_eheap3`,
+ * depending on `NUM_HEAPS`) are added to the heap. Allocations can be
+ * served from any of them. The first region also holds the TLSF control
+ * structure, a few hundred bytes up to a few KiB depending on the
+ * architecture. On `native`, a static array of
+ * @ref CONFIG_MALLOC_TLSF_NATIVE_HEAP_SIZE bytes is used instead.
+ *
+ * Further memory (e.g. an external RAM) can be added at run time with
+ * @ref malloc_tlsf_add_pool().
+ *
+ * # Usage
+ *
+ * Add `USEMODULE += malloc_tlsf` to the application's Makefile. This is
+ * supported on platforms using newlib and on `native`.
+ *
+ * @{
+ *
+ * @file
+ * @brief       TLSF system allocator API
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ */
+
+#ifndef MALLOC_TLSF_H
+#define MALLOC_TLSF_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Size of the heap on `native` in bytes
+ */
+#ifndef CONFIG_MALLOC_TLSF_NATIVE_HEAP_SIZE
+#define CONFIG_MALLOC_TLSF_NATIVE_HEAP_SIZE (256U * 1024U)
+#endif
+
+/**
+ * @brief   Number of pools that can be added with @ref malloc_tlsf_add_pool()
+ */
+#ifndef CONFIG_MALLOC_TLSF_EXTRA_POOLS_NUMOF
+#define CONFIG_MALLOC_TLSF_EXTRA_POOLS_NUMOF    (2U)
+#endif
+
+/**
+ * @brief   Heap statistics
+ */
+typedef struct {
+    size_t size;            /**< total size of all pools in bytes */
+    size_t used;            /**< size of all allocated blocks in bytes */
+    size_t free;            /**< size of all free blocks in bytes */
+    size_t largest_free;    /**< size of the largest free block in bytes */
+} malloc_tlsf_stats_t;
+
+/**
+ * @brief   Add a memory region to the heap
+ *
+ * @param[in]   mem     start of the region, aligned to `sizeof(void *)`
+ * @param[in]   bytes   size of the region in bytes
+ *
+ * @retval  0           success
+ * @retval  -ENOMEM     @ref CONFIG_MALLOC_TLSF_EXTRA_POOLS_NUMOF pools have
+ *                      already been added
+ * @retval  -EINVAL     the region is too small or too large for TLSF
+ */
+int malloc_tlsf_add_pool(void *mem, size_t bytes);
+
+/**
+ * @brief   Get statistics of the heap
+ *
+ * @warning This walks all blocks of the heap with interrupts disabled and
+ *          hence does not run in constant time. Use for diagnostics only.
+ *
+ * @param[out]  stats   the statistics are written here
+ */
+void malloc_tlsf_get_stats(malloc_tlsf_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MALLOC_TLSF_H */
+/** @} */
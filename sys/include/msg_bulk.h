@@ -0,0 +1,209 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_msg_bulk Zero-copy bulk messages
+ * @ingroup     sys
+ * @brief       Pass large payloads between threads by transferring ownership
+ *              of pooled buffers
+ *
+ * A @ref msg_t can only carry a single pointer or 32 bit value. This module
+ * provides a static pool of reference counted buffers of
+ * @ref CONFIG_MSG_BULK_BUF_SIZE bytes. A buffer is sent by storing its data
+ * pointer in @ref msg_t::content, which hands the callers reference over to
+ * the receiver. No payload is copied.
+ *
+ * The receiver releases the buffer with @ref msg_bulk_release() when it is
+ * done, or implicitly by replying with @ref msg_bulk_reply() when the buffer
+ * was sent with @ref msg_bulk_send_receive(). A buffer that is passed on to
+ * more than one consumer must be retained once per additional consumer with
+ * @ref msg_bulk_retain().
+ *
+ * ```c
+ * // producer
+ * uint8_t *frame = msg_bulk_alloc();
+ * fill_frame(frame);
+ * msg_bulk_set_len(frame, 512);
+ * msg_bulk_send(&m, frame, consumer_pid);
+ *
+ * // consumer
+ * msg_receive(&m);
+ * uint8_t *frame = msg_bulk_buf(&m);
+ * store_frame(frame, msg_bulk_len(frame));
+ * msg_bulk_release(frame);
+ * ```
+ *
+ * All functions can be called from thread and ISR context.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Zero-copy bulk message interface
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ */
+
+#ifndef MSG_BULK_H
+#define MSG_BULK_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "msg.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Size of a single bulk buffer in bytes
+ */
+#ifndef CONFIG_MSG_BULK_BUF_SIZE
+#define CONFIG_MSG_BULK_BUF_SIZE    (512U)
+#endif
+
+/**
+ * @brief   Number of bulk buffers in the pool
+ */
+#ifndef CONFIG_MSG_BULK_BUF_NUMOF
+#define CONFIG_MSG_BULK_BUF_NUMOF   (4U)
+#endif
+
+/**
+ * @brief   Buffer pool usage statistics
+ */
+typedef struct {
+    unsigned outstanding;       /**< buffers currently allocated */
+    unsigned max_outstanding;   /**< high water mark of allocated buffers */
+    unsigned allocs;            /**< number of successful allocations */
+    unsigned alloc_fails;       /**< number of allocations on an empty pool */
+} msg_bulk_stats_t;
+
+/**
+ * @brief   Allocate a buffer from the pool
+ *
+ * The caller holds the only reference to the returned buffer, its length is
+ * initialized to 0.
+ *
+ * @return  pointer to @ref CONFIG_MSG_BULK_BUF_SIZE bytes of word aligned
+ *          memory
+ * @return  NULL if the pool is exhausted
+ */
+void *msg_bulk_alloc(void);
+
+/**
+ * @brief   Take an additional reference to a buffer
+ *
+ * @param[in] buf   buffer obtained from @ref msg_bulk_alloc()
+ */
+void msg_bulk_retain(void *buf);
+
+/**
+ * @brief   Drop a reference to a buffer
+ *
+ * The buffer is returned to the pool when its last reference is dropped.
+ *
+ * @param[in] buf   buffer obtained from @ref msg_bulk_alloc()
+ */
+void msg_bulk_release(void *buf);
+
+/**
+ * @brief   Set the number of valid bytes in a buffer
+ *
+ * @pre     @p len <= @ref CONFIG_MSG_BULK_BUF_SIZE
+ *
+ * @param[in] buf   buffer obtained from @ref msg_bulk_alloc()
+ * @param[in] len   number of valid bytes
+ */
+void msg_bulk_set_len(void *buf, size_t len);
+
+/**
+ * @brief   Get the number of valid bytes in a buffer
+ *
+ * @param[in] buf   buffer obtained from @ref msg_bulk_alloc()
+ *
+ * @return  number of valid bytes as set with @ref msg_bulk_set_len()
+ */
+size_t msg_bulk_len(const void *buf);
+
+/**
+ * @brief   Get the buffer carried by a received message
+ *
+ * @param[in] m     message received from @ref msg_bulk_send() or
+ *                  @ref msg_bulk_send_receive()
+ *
+ * @return  the buffer carried by @p m
+ */
+static inline void *msg_bulk_buf(const msg_t *m)
+{
+    return m->content.ptr;
+}
+
+/**
+ * @brief   Send a buffer to a thread, transferring the callers reference
+ *
+ * Behaves like @ref msg_send(). Only if the message was delivered, the
+ * receiver owns the reference. Otherwise, the caller still owns it.
+ *
+ * @param[in,out] m         message to send, @ref msg_t::type must be set by
+ *                          the caller
+ * @param[in] buf           buffer obtained from @ref msg_bulk_alloc()
+ * @param[in] target_pid    PID of the receiving thread
+ *
+ * @return  return value of @ref msg_send()
+ */
+int msg_bulk_send(msg_t *m, void *buf, kernel_pid_t target_pid);
+
+/**
+ * @brief   Send a buffer to a thread and wait for the reply
+ *
+ * The callers reference is transferred to the receiver, which releases it
+ * when replying with @ref msg_bulk_reply().
+ *
+ * @param[in,out] m         message to send, @ref msg_t::type must be set by
+ *                          the caller
+ * @param[in] buf           buffer obtained from @ref msg_bulk_alloc()
+ * @param[out] reply        reply will be written here, can be identical to
+ *                          @p m
+ * @param[in] target_pid    PID of the receiving thread
+ *
+ * @return  return value of @ref msg_send_receive()
+ */
+int msg_bulk_send_receive(msg_t *m, void *buf, msg_t *reply,
+                          kernel_pid_t target_pid);
+
+/**
+ * @brief   Reply to a message carrying a buffer and release the buffer
+ *
+ * @param[in] m         message received from @ref msg_bulk_send_receive()
+ * @param[in] reply     reply to send
+ *
+ * @return  return value of @ref msg_reply()
+ */
+int msg_bulk_reply(msg_t *m, msg_t *reply);
+
+/**
+ * @brief   Get the number of buffers currently allocated
+ *
+ * @return  number of outstanding buffers
+ */
+unsigned msg_bulk_outstanding(void);
+
+/**
+ * @brief   Get the buffer pool usage statistics
+ *
+ * @param[out] stats    statistics are written here
+ */
+void msg_bulk_get_stats(msg_bulk_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSG_BULK_H */
+/** @} */
@@ -23,6 +23,8 @@
  * - Connecting to multiple gateways simultaneously
  * - Registration of topic names
  * - Publishing of data (QoS 0 and QoS 1)
+ * - Several QoS 1 PUBLISH messages in flight, see
+ *   @ref CONFIG_ASYMCUTE_INFLIGHT_MAX
  * - Subscription to topics
  * - Pre-defined topic IDs as well as short and normal topic names
  *
@@ -143,6 +145,26 @@ extern "C" {
 #ifndef CONFIG_ASYMCUTE_N_RETRY
 #define CONFIG_ASYMCUTE_N_RETRY         (3U)
 #endif
+
+/**
+ * @brief   Maximum number of QoS 1 PUBLISH messages in flight per connection
+ *
+ * Publishing does not wait for the PUBACK of the previous message until this
+ * many messages are unacknowledged, so the publish rate is not bound by the
+ * round trip time to the gateway. MQTT-SN Spec v1.2, section 6.13 allows only
+ * a single outstanding message, set this to 1 for gateways that enforce this.
+ */
+#ifndef CONFIG_ASYMCUTE_INFLIGHT_MAX
+#define CONFIG_ASYMCUTE_INFLIGHT_MAX    (4U)
+#endif
+
+/**
+ * @brief   Number of buckets the pending requests of a connection are hashed
+ *          into by their message ID, must be a power of 2
+ */
+#ifndef CONFIG_ASYMCUTE_PENDING_BUCKETS
+#define CONFIG_ASYMCUTE_PENDING_BUCKETS (4U)
+#endif
 /** @} */
 
 #ifndef ASYMCUTE_HANDLER_PRIO
@@ -171,6 +193,7 @@ enum {
     ASYMCUTE_REGERR     = -5,       /**< error: registration invalid */
     ASYMCUTE_SUBERR     = -6,       /**< error: subscription invalid */
     ASYMCUTE_SENDERR    = -7,       /**< error: unable to sent packet */
+    ASYMCUTE_WINDOW     = -8,       /**< error: too many messages in flight */
 };
 
 /**
@@ -270,13 +293,16 @@ struct asymcute_req {
 struct asymcute_con {
     mutex_t lock;                       /**< synchronization lock */
     sock_udp_t sock;                    /**< socket used by a connections */
-    asymcute_req_t *pending;            /**< list holding pending requests */
+    asymcute_req_t *pending[CONFIG_ASYMCUTE_PENDING_BUCKETS]; /**< pending
+                                         *   requests, hashed by message ID */
     asymcute_sub_t *subscriptions;      /**< list holding active subscriptions */
     asymcute_evt_cb_t user_cb;          /**< event callback provided by user */
     event_callback_t keepalive_evt;     /**< keep alive event */
     event_timeout_t keepalive_timer;    /**< keep alive timer */
     uint16_t last_id;                   /**< last used message ID for this
                                          *   connection */
+    uint8_t inflight;                   /**< number of QoS 1 PUBLISH messages
+                                         *   waiting for their PUBACK */
     uint8_t keepalive_retry_cnt;        /**< keep alive transmission counter */
     uint8_t state;                      /**< connection state */
     uint8_t rxbuf[CONFIG_ASYMCUTE_BUFSIZE];    /**< connection specific receive buf */
@@ -527,6 +553,8 @@ int asymcute_register(asymcute_con_t *con, asymcute_req_t *req,
  * @return  ASYMCUTE_REGERR if given topic is not registered
  * @return  ASYMCUTE_GWERR if not connected to a gateway
  * @return  ASYMCUTE_BUSY if the given request context is already in use
+ * @return  ASYMCUTE_WINDOW if @ref CONFIG_ASYMCUTE_INFLIGHT_MAX QoS 1
+ *          messages are waiting for their PUBACK already
  */
 int asymcute_publish(asymcute_con_t *con, asymcute_req_t *req,
                      const asymcute_topic_t *topic,
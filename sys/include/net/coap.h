@@ -237,6 +237,19 @@ typedef enum {
 #define COAP_CODE_PROXYING_NOT_SUPPORTED     ((5 << 5) | 5)
 /** @} */
 
+/**
+ * @name    Signaling message codes (CoAP over reliable transports)
+ * @see     [RFC 8323](https://datatracker.ietf.org/doc/html/rfc8323#section-5)
+ * @{
+ */
+#define COAP_CLASS_SIGNAL                     (7)
+#define COAP_CODE_SIGNAL_CSM                 ((7 << 5) | 1)
+#define COAP_CODE_SIGNAL_PING                ((7 << 5) | 2)
+#define COAP_CODE_SIGNAL_PONG                ((7 << 5) | 3)
+#define COAP_CODE_SIGNAL_RELEASE             ((7 << 5) | 4)
+#define COAP_CODE_SIGNAL_ABORT               ((7 << 5) | 5)
+/** @} */
+
 /**
  * @name    Content-Format option codes
  * @anchor  net_coap_format
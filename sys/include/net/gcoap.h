@@ -101,6 +101,23 @@
  * add parameters to provide more information about the resource, as described
  * in RFC 6690. See the gcoap example for use of a custom encoder function.
  *
+ * ### Slow handlers ###
+ *
+ * All handlers run in the gcoap thread, which also receives responses and
+ * retransmits requests. A handler that blocks, e.g. to read a file or a
+ * sensor, delays everything else. With the `gcoap_workers` module, resources
+ * with @ref COAP_HANDLER_SLOW in coap_resource_t::methods are handled by a
+ * pool of CONFIG_GCOAP_WORKERS_NUMOF threads instead. The gcoap thread still
+ * parses the request and handles an Observe registration, then copies the
+ * request to an idle worker, which calls the handler and sends the response.
+ * If all workers are busy, the request is answered with 5.03 (Service
+ * Unavailable). Retransmissions of a request a worker is busy with are
+ * dropped, its response is the piggybacked ACK.
+ *
+ * A handler run by a worker must not use state shared with other handlers
+ * without locking. Requests over DTLS are always handled by the gcoap
+ * thread.
+ *
  * ## Client Operation ##
  *
  * Client operation includes two phases: creating and sending a request, and
@@ -191,6 +208,21 @@
  * Finally, call gcoap_obs_send() for the resource, with the sum of the
  * metadata length and payload length for the representation.
  *
+ * ### Several observers per resource ###
+ *
+ * By default, a resource can be observed by a single endpoint only; further
+ * registrations for the resource are answered without the Observe option.
+ * With the `gcoap_obs_fanout` module, any number of endpoints may observe a
+ * resource, limited by CONFIG_GCOAP_OBS_REGISTRATIONS_MAX and
+ * CONFIG_GCOAP_OBS_CLIENTS_MAX. The steps above do not change: gcoap_obs_init()
+ * builds the notification for the first observer of the resource, and
+ * gcoap_obs_send() sends it to every observer. Options and payload are
+ * encoded once; only the header with the token of the observer and a new
+ * message ID is built for each further observer, and sent along with the
+ * shared part of the buffer with sock_udp_sendv_aux(). All observers receive
+ * the same Observe value. With `gnrc_pkt_ext`, a large enough shared part is
+ * not even copied into the packet buffer.
+ *
  * ### Other considerations ###
  *
  * By default, the value for the Observe option in a notification is three
@@ -354,7 +386,42 @@
  * By default, it tries to have CONFIG_GCOAP_DTLS_MINIMUM_AVAILABLE_SESSIONS
  * session slots available to keep the server responsive. If not enough sessions
  * are available the server destroys the session that has not been used for the
- * longest time after CONFIG_GCOAP_DTLS_MINIMUM_AVAILABLE_SESSIONS_TIMEOUT_USEC.
+ * longest time after CONFIG_GCOAP_DTLS_MINIMUM_AVAILABLE_SESSIONS_TIMEOUT_MSEC.
+ *
+ * Sessions are looked up by the remote endpoint, so requests to a peer with an
+ * established session reuse it without a new handshake. A destroyed session
+ * always takes a full handshake to re-establish, as tinydtls implements
+ * neither session ID nor session ticket resumption. On constrained clients
+ * with ECC, keep CONFIG_DSM_PEER_MAX at least as large as the number of peers
+ * that are talked to regularly and CONFIG_GCOAP_DTLS_MINIMUM_AVAILABLE_SESSIONS
+ * small (or 0 on nodes that are only clients), so sessions are not evicted
+ * between requests.
+ *
+ * ## CoAP over TCP ##
+ *
+ * With the module gcoap_tcp, gcoap also speaks CoAP over TCP as specified in
+ * [RFC 8323](https://datatracker.ietf.org/doc/html/rfc8323) on top of the
+ * @ref net_sock_tcp "TCP sock API". It listens for connections on
+ * CONFIG_GCOAP_TCP_PORT and sends requests over TCP if
+ * @ref GCOAP_SOCKET_TYPE_TCP is passed to gcoap_req_send(). TCP is never
+ * picked for @ref GCOAP_SOCKET_TYPE_UNDEF.
+ *
+ * There is no message layer over TCP: requests are never retransmitted, have
+ * no message ID and are matched to responses by their token only, so many
+ * requests can be in flight on one connection. A CON request is sent like a
+ * NON one and waits CONFIG_GCOAP_NON_TIMEOUT_MSEC for its response.
+ *
+ * Connections are pooled per remote endpoint. The first request to a remote
+ * connects (blocking the caller) and sends a Capabilities and Settings
+ * Message, later requests and responses to the same remote reuse the
+ * connection. Up to CONFIG_GCOAP_TCP_CONN_NUMOF connections are kept, accepted
+ * and outgoing ones alike; they stay open until the peer closes them or an
+ * error occurs, requests waiting on a closed connection time out at once.
+ *
+ * As not every stack provides asynchronous TCP socks, the gcoap thread polls
+ * the connections every CONFIG_GCOAP_TCP_POLL_MSEC. With GNRC, also raise
+ * CONFIG_GNRC_TCP_RCV_BUFFERS to twice CONFIG_GCOAP_TCP_CONN_NUMOF, as every
+ * listening sock holds a receive buffer as well.
  *
  * ## Implementation Notes ##
  *
@@ -406,6 +473,9 @@
 #if IS_USED(MODULE_GCOAP_DTLS)
 #include "net/sock/dtls.h"
 #endif
+#if IS_USED(MODULE_GCOAP_TCP)
+#include "net/sock/tcp.h"
+#endif
 #include "net/nanocoap.h"
 #include "net/nanocoap/cache.h"
 #include "timex.h"
@@ -433,6 +503,31 @@ extern "C" {
 #define CONFIG_GCOAPS_PORT             (5684)
 #endif
 
+/**
+ * @brief   Server port for CoAP over TCP; use RFC 8323 default if not defined
+ */
+#ifndef CONFIG_GCOAP_TCP_PORT
+#define CONFIG_GCOAP_TCP_PORT          (5683)
+#endif
+
+/**
+ * @brief   Number of CoAP over TCP connections, accepted and outgoing ones
+ *
+ * Only used with the gcoap_tcp module.
+ */
+#ifndef CONFIG_GCOAP_TCP_CONN_NUMOF
+#define CONFIG_GCOAP_TCP_CONN_NUMOF    (2)
+#endif
+
+/**
+ * @brief   Interval in which the gcoap thread polls the TCP connections
+ *
+ * Only used with the gcoap_tcp module.
+ */
+#ifndef CONFIG_GCOAP_TCP_POLL_MSEC
+#define CONFIG_GCOAP_TCP_POLL_MSEC     (10)
+#endif
+
 /**
  * @brief   Timeout for the DTLS handshake process. Set to 0 for infinite time
  */
@@ -466,6 +561,10 @@ extern "C" {
 
 /**
  * @brief   Maximum number of requests awaiting a response
+ *
+ * Responses are matched to their request by hash chains over the token and
+ * message ID, so this can be raised to hundreds (e.g. for a proxy) without
+ * slowing down response handling.
  */
 #ifndef CONFIG_GCOAP_REQ_WAITING_MAX
 #define CONFIG_GCOAP_REQ_WAITING_MAX   (2)
@@ -553,7 +652,8 @@ extern "C" {
  * @ingroup net_gcoap_conf
  * @brief   Maximum number of Observe clients
  *
- * @note As documented in this file, the implementation is limited to one observer per resource.
+ * @note As documented in this file, the implementation is limited to one observer per resource,
+ *       unless module `gcoap_obs_fanout` is used.
  *       Therefore, every stored observer is associated with a different resource.
  *       If you have only one observable resource, you could set this value to 1.
  */
@@ -565,7 +665,8 @@ extern "C" {
  * @ingroup net_gcoap_conf
  * @brief   Maximum number of local notifying endpoint addresses
  *
- * @note As documented in this file, the implementation is limited to one observer per resource.
+ * @note As documented in this file, the implementation is limited to one observer per resource,
+ *       unless module `gcoap_obs_fanout` is used.
  *       Therefore, every stored local endpoint alias is associated with an observation context
  *       of a different resource.
  *       If you have only one observable resource, you could set this value to 1.
@@ -578,7 +679,8 @@ extern "C" {
  * @ingroup net_gcoap_conf
  * @brief   Maximum number of registrations for Observable resources
  *
- * @note As documented in this file, the implementation is limited to one observer per resource.
+ * @note As documented in this file, the implementation is limited to one observer per resource,
+ *       unless module `gcoap_obs_fanout` is used.
  *       Therefore, every stored observation context is associated with a different resource.
  *       If you have only one observable resource, you could set this value to 1.
  */
@@ -668,6 +770,24 @@ extern "C" {
 #endif
 /** @} */
 
+/**
+ * @ingroup net_gcoap_conf
+ * @brief   Number of worker threads for slow handlers (module `gcoap_workers`)
+ *
+ * Each worker has a PDU buffer of CONFIG_GCOAP_PDU_BUF_SIZE bytes.
+ */
+#ifndef CONFIG_GCOAP_WORKERS_NUMOF
+#define CONFIG_GCOAP_WORKERS_NUMOF      (2)
+#endif
+
+/**
+ * @brief   Stack size of a worker thread (module `gcoap_workers`)
+ */
+#ifndef GCOAP_WORKER_STACK_SIZE
+#define GCOAP_WORKER_STACK_SIZE (THREAD_STACKSIZE_DEFAULT + DEBUG_EXTRA_STACKSIZE \
+                                 + GCOAP_VFS_EXTRA_STACKSIZE)
+#endif
+
 /**
  * @ingroup net_gcoap_conf
  * @brief   Count of PDU buffers available for resending confirmable messages
@@ -751,6 +871,7 @@ typedef enum {
     GCOAP_SOCKET_TYPE_UNDEF = 0x0,      /**< undefined */
     GCOAP_SOCKET_TYPE_UDP = 0x1,        /**< Unencrypted UDP transport */
     GCOAP_SOCKET_TYPE_DTLS = 0x2,       /**< DTLS-over-UDP transport */
+    GCOAP_SOCKET_TYPE_TCP = 0x4,        /**< CoAP over TCP (RFC 8323) transport */
 } gcoap_socket_type_t;
 
 /**
@@ -762,6 +883,9 @@ typedef struct {
         sock_udp_t *udp;
 #if IS_USED(MODULE_GCOAP_DTLS) || defined(DOXYGEN)
         sock_dtls_t *dtls;
+#endif
+#if IS_USED(MODULE_GCOAP_TCP) || defined(DOXYGEN)
+        sock_tcp_t *tcp;
 #endif
     } socket;                               /**< Stored socket */
 #if IS_USED(MODULE_GCOAP_DTLS) || defined(DOXYGEN)
@@ -892,6 +1016,12 @@ kernel_pid_t gcoap_init(void);
  *       fields of the listener struct), they can just be registered
  *       individually.
  *
+ * @note If gcoap_listener_t::request_matcher is NULL and the paths of the
+ *       resources are sorted in ascending order (as by `strcmp()`), requests
+ *       are matched with a binary search (see
+ *       @ref coap_find_resource_sorted()). Listeners with many resources should
+ *       keep them sorted.
+ *
  * @param[in] listener  Listener containing the resources.
  */
 void gcoap_register_listener(gcoap_listener_t *listener);
@@ -973,6 +1103,26 @@ static inline int gcoap_req_init(coap_pkt_t *pdu, uint8_t *buf, size_t len,
                                       (path) ? strlen(path) : 0U);
 }
 
+/**
+ * @brief   Initializes a CoAP request PDU from a template
+ *
+ * Like gcoap_req_init(), but the options are copied from @p tpl instead of
+ * being encoded, see @ref coap_build_from_template(). A token and a message
+ * ID are generated as for any request. With `nanocoap_cache`, the request has
+ * no room to revalidate a stale cache entry with an ETag.
+ *
+ * @param[out] pdu      Request metadata
+ * @param[out] buf      Buffer containing the PDU
+ * @param[in] len       Length of the buffer
+ * @param[in] tpl       Type, code and pre-encoded options of the request
+ *
+ * @return  length of the PDU without payload, the payload follows at
+ *          coap_pkt_t::payload
+ * @return  < 0 on error
+ */
+ssize_t gcoap_req_init_from_template(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                                     const coap_template_t *tpl);
+
 /**
  * @brief   Writes a complete CoAP request PDU when there is not a payload
  *
@@ -1112,13 +1262,14 @@ int gcoap_obs_init(coap_pkt_t *pdu, uint8_t *buf, size_t len,
  * @brief   Sends a buffer containing a CoAP Observe notification to the
  *          observer registered for a resource
  *
- * Assumes a single observer for a resource.
+ * Assumes a single observer for a resource, unless module `gcoap_obs_fanout`
+ * is used. Then the notification is sent to all observers of the resource.
  *
  * @param[in] buf Buffer containing the PDU
  * @param[in] len Length of the buffer
  * @param[in] resource Resource to send
  *
- * @return  length of the packet
+ * @return  length of the packet (sent to the first observer)
  * @return  0 if cannot send
  */
 size_t gcoap_obs_send(const uint8_t *buf, size_t len,
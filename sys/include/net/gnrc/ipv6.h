@@ -86,6 +86,23 @@
  *
  * `GNRC_NETAPI_MSG_TYPE_GET` is not supported.
  *
+ * Inline reception
+ * ================
+ *
+ * With the pseudo-module `gnrc_ipv6_inline` IPv6 registers a
+ * @ref GNRC_NETREG_TYPE_CB "callback" instead of its thread. Received packets
+ * are then handled in the context of the thread dispatching them, typically
+ * the thread of the network interface, and passed on to the upper layers from
+ * there. Together with `gnrc_udp_inline` a UDP packet reaches the
+ * @ref net_gnrc_sock "sock" of the application without any context switch in
+ * between. Packets to send are still passed to the IPv6 thread, which also
+ * keeps handling the @ref net_gnrc_ipv6_nib "NIB" timers and fragmentation.
+ * Packet handling is serialized by a recursive mutex, so IPv6 can be entered
+ * from several interface threads.
+ *
+ * The stack size of the network interface threads is increased by
+ * `GNRC_NETIF_INLINE_EXTRA_STACKSIZE` for this.
+ *
  * @{
  *
  * @file
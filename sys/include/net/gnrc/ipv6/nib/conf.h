@@ -281,6 +281,20 @@ extern "C" {
 #define CONFIG_GNRC_IPV6_NIB_NUMOF                   (4)
 #endif
 
+/**
+ * @brief   Look up entries of the NIB by address in a hash table
+ *
+ * By default, neighbor cache entries and other entries of the NIB are
+ * searched for in all @ref CONFIG_GNRC_IPV6_NIB_NUMOF entries whenever a
+ * packet is sent to a neighbor or neighbor discovery messages are handled.
+ * With this option, they are found by their address in a hash table of
+ * `2 * CONFIG_GNRC_IPV6_NIB_NUMOF` slots of 2 bytes each. This pays off for
+ * border routers with many neighbors.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_ONL_HASH
+#define CONFIG_GNRC_IPV6_NIB_ONL_HASH                0
+#endif
+
 /**
  * @brief   Number of off-link entries in NIB
  *
@@ -291,6 +305,35 @@ extern "C" {
 #define CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF              (8)
 #endif
 
+/**
+ * @brief   Look up the forwarding table in a prefix trie
+ *
+ * By default, the longest prefix matching a destination is searched in all
+ * @ref CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF off-link entries for every packet. With
+ * this option, the off-link entries are also indexed by a path-compressed
+ * binary trie, so the lookup only follows the bits of the destination. This
+ * pays off for routers with many routes, at the cost of
+ * `2 * CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF - 1` trie nodes of RAM.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_OFFL_TRIE
+#define CONFIG_GNRC_IPV6_NIB_OFFL_TRIE               0
+#endif
+
+/**
+ * @brief   Number of entries in the route cache
+ *
+ * The route cache remembers the off-link entry with the longest prefix
+ * matching a destination, so repeated packets to the same destination skip
+ * the forwarding table lookup. All entries are invalidated when an off-link
+ * entry is added or removed. Each entry takes 24 bytes (on 32-bit platforms)
+ * of RAM. 0 disables the cache.
+ *
+ * @see     gnrc_ipv6_nib_ft_cache_stats()
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF
+#define CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF       0
+#endif
+
 #if CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C || defined(DOXYGEN)
 /**
  * @brief   Number of authoritative border router entries in NIB
@@ -22,6 +22,7 @@
 
 #include <stdint.h>
 
+#include "net/gnrc/ipv6/nib/conf.h"
 #include "net/gnrc/pkt.h"
 #include "net/ipv6/addr.h"
 
@@ -42,6 +43,16 @@ typedef struct {
     uint16_t iface;         /**< interface to gnrc_ipv6_nib_ft_t::next_hop */
 } gnrc_ipv6_nib_ft_t;
 
+/**
+ * @brief   Statistics of the route cache
+ *
+ * @see     @ref CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF
+ */
+typedef struct {
+    uint32_t hits;          /**< lookups answered from the cache */
+    uint32_t misses;        /**< lookups that searched the forwarding table */
+} gnrc_ipv6_nib_ft_cache_stats_t;
+
 /**
  * @brief   Gets the best matching forwarding table entry to a destination
  *
@@ -148,6 +159,22 @@ bool gnrc_ipv6_nib_ft_iter(const ipv6_addr_t *next_hop, unsigned iface,
  */
 void gnrc_ipv6_nib_ft_print(const gnrc_ipv6_nib_ft_t *fte);
 
+#if CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF || defined(DOXYGEN)
+/**
+ * @brief   Gets the statistics of the route cache
+ *
+ * Every packet to an off-link destination looks up the forwarding table up to
+ * two times, so the numbers do not equal the number of packets sent.
+ *
+ * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF > 0.
+ *
+ * @pre `stats != NULL`
+ *
+ * @param[out] stats    Statistics of the route cache.
+ */
+void gnrc_ipv6_nib_ft_cache_stats(gnrc_ipv6_nib_ft_cache_stats_t *stats);
+#endif  /* CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF */
+
 #ifdef __cplusplus
 }
 #endif
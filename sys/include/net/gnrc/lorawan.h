@@ -226,7 +226,9 @@ void gnrc_lorawan_mlme_request(gnrc_lorawan_t *mac,
  * @param[out] mcps_confirm the MCPS confirm. `mlme_confirm->status` could either
  *             be GNRC_LORAWAN_REQ_STATUS_SUCCESS if the request was OK,
  *             GNRC_LORAWAN_REQ_STATUS_DEFERRED if the confirmation is deferred
- *             or an standard error number
+ *             or an standard error number. -EBUSY if another transmission is
+ *             ongoing, -EAGAIN if the duty cycle of all enabled channels is
+ *             exhausted (see @ref gnrc_lorawan_region_time_off).
  */
 void gnrc_lorawan_mcps_request(gnrc_lorawan_t *mac,
                                const mcps_request_t *mcps_request,
@@ -321,6 +323,19 @@ void gnrc_lorawan_set_timer(gnrc_lorawan_t *mac, uint32_t us);
  */
 void gnrc_lorawan_remove_timer(gnrc_lorawan_t *mac);
 
+/**
+ * @brief Get the current time in milliseconds
+ * @note Supposed to be implemented by the user of GNRC LoRaWAN
+ *
+ * Used to keep track of the duty cycle of the sub-bands. The value may
+ * overflow.
+ *
+ * @param[in] mac pointer to the MAC descriptor
+ *
+ * @return current time in milliseconds
+ */
+uint32_t gnrc_lorawan_get_time_ms(gnrc_lorawan_t *mac);
+
 /**
  * @brief Set unconfirmed uplink redundancy
  *
@@ -61,6 +61,16 @@ void gnrc_lorawan_process_cflist(gnrc_lorawan_t *mac, uint8_t *cflist);
  */
 uint8_t gnrc_lorawan_rx1_get_dr_offset(uint8_t dr_up, uint8_t dr_offset);
 
+/**
+ * @brief Get the time until a transmission is allowed by the duty cycle
+ *
+ * @param[in] mac pointer to the MAC descriptor
+ *
+ * @return time in milliseconds until one of the enabled channels can be used,
+ *         0 if one can be used right away
+ */
+uint32_t gnrc_lorawan_region_time_off(gnrc_lorawan_t *mac);
+
 /**
  * @brief Check if a datarate is valid in the current region
  *
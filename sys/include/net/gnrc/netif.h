@@ -19,6 +19,39 @@
  * If you only have one network interface on the board, you can select the
  * `gnrc_netif_single` pseudo-module to enable further optimisations.
  *
+ * ## Shared interface thread
+ *
+ * With the `gnrc_netif_shared` pseudo-module, interfaces created with
+ * `stack == NULL` do not get a thread of their own, but are all served by a
+ * single thread with a stack of @ref GNRC_NETIF_SHARED_STACKSIZE bytes. That
+ * thread handles the events and @ref net_gnrc_netapi "netapi" messages of its
+ * interfaces in turns, one event and one message per interface at a time, so
+ * a busy interface cannot starve the others. Interfaces with a stack of their
+ * own can be mixed with shared ones.
+ *
+ * A shared interface is still addressed by gnrc_netif_t::pid, which is an
+ * unused thread slot counted down from @ref KERNEL_PID_LAST and not a thread.
+ * Make sure @ref MAXTHREADS leaves room for those. As messages reach shared
+ * interfaces only through @ref net_gnrc_netapi "netapi", modules that send
+ * messages to the interface thread by other means (@ref net_gnrc_lwmac,
+ * @ref net_gnrc_gomach, @ref net_gnrc_netif_pktq, LoRaWAN, SFR) can not be
+ * used on shared interfaces.
+ *
+ * ## Receive polling
+ *
+ * Usually every @ref NETDEV_EVENT_RX_COMPLETE of a device fetches a single
+ * frame. With the `gnrc_netif_rx_poll` pseudo-module, the interface keeps
+ * fetching frames after that until the device has none left or
+ * @ref CONFIG_GNRC_NETIF_RX_POLL_BUDGET frames were fetched. In the latter
+ * case, polling resumes from a low priority event, so sending and other events
+ * are handled in between. Interrupts of the device arriving meanwhile merge
+ * into the one ISR event already pending. This saves the event and thread
+ * switch per frame for fast devices such as Ethernet controllers under load.
+ *
+ * Only use it if all devices return a frame size of 0 or less from
+ * netdev_driver_t::recv() with `buf == NULL` and `len == 0` when they have no
+ * frame pending, as e.g. `stm32_eth` and `w5500` do.
+ *
  * @{
  *
  * @file
@@ -35,6 +68,9 @@
 
 #include "sched.h"
 #include "msg.h"
+#if IS_USED(MODULE_GNRC_NETIF_SHARED)
+#include "mbox.h"
+#endif
 #ifdef MODULE_GNRC_NETIF_BUS
 #include "msg_bus.h"
 #endif
@@ -42,6 +78,9 @@
 #include "net/ipv6/addr.h"
 #include "net/gnrc/netapi.h"
 #include "net/gnrc/pkt.h"
+#ifdef MODULE_GNRC_PKT_QUOTA
+#include "net/gnrc/pktbuf.h"
+#endif
 #include "net/gnrc/netif/conf.h"
 #if IS_USED(MODULE_GNRC_NETIF_LORAWAN)
 #include "net/gnrc/netif/lorawan.h"
@@ -69,6 +108,9 @@
 #ifdef MODULE_NETSTATS_L2
 #include "net/netstats.h"
 #endif
+#if IS_USED(MODULE_NETSTATS_LATENCY)
+#include "net/netstats/latency.h"
+#endif
 #include "rmutex.h"
 #include "net/netif.h"
 
@@ -140,6 +182,28 @@ typedef struct {
 #if IS_USED(MODULE_NETSTATS_L2) || defined(DOXYGEN)
     netstats_t stats;                       /**< transceiver's statistics */
 #endif
+#if IS_USED(MODULE_NETSTATS_LATENCY) || defined(DOXYGEN)
+    /**
+     * @brief   Receive latency histograms
+     *
+     * @note    Only available with @ref net_netstats_latency.
+     */
+    netstats_latency_t latency;
+    /**
+     * @brief   Time of the last interrupt of the device in µs
+     *
+     * @note    Only available with @ref net_netstats_latency.
+     */
+    uint32_t isr_stamp;
+#endif
+#if IS_USED(MODULE_GNRC_PKT_QUOTA) || defined(DOXYGEN)
+    /**
+     * @brief   Packet buffer quota of received packets
+     *
+     * @note    Only available with @ref net_gnrc_pkt_quota.
+     */
+    gnrc_pktbuf_quota_t rx_quota;
+#endif
 #if IS_USED(MODULE_GNRC_NETIF_LORAWAN) || defined(DOXYGEN)
     gnrc_netif_lorawan_t lorawan;           /**< LoRaWAN component */
 #endif
@@ -182,6 +246,14 @@ typedef struct {
      */
     gnrc_pktsnip_t *tx_pkt;
 #endif
+#if IS_USED(MODULE_GNRC_NETIF_RX_POLL) || defined(DOXYGEN)
+    /**
+     * @brief   Event to resume polling the device for received frames
+     *
+     * @note    Only available with `gnrc_netif_rx_poll`.
+     */
+    event_t event_rx_poll;
+#endif
 #if (GNRC_NETIF_L2ADDR_MAXLEN > 0) || DOXYGEN
     /**
      * @brief   The link-layer address currently used as the source address
@@ -221,6 +293,16 @@ typedef struct {
      * @brief   Message queue for the netif thread
      */
     msg_t msg_queue[GNRC_NETIF_MSG_QUEUE_SIZE];
+#if IS_USED(MODULE_GNRC_NETIF_SHARED) || defined(DOXYGEN)
+    /**
+     * @brief   Messages for an interface on the shared thread
+     *
+     * Uses gnrc_netif_t::msg_queue as storage.
+     *
+     * @note    Only available with `gnrc_netif_shared`.
+     */
+    mbox_t mbox;
+#endif
     uint8_t cur_hl;                         /**< Current hop-limit for out-going packets */
     uint8_t device_type;                    /**< Device type */
     kernel_pid_t pid;                       /**< PID of the network interface's thread */
@@ -402,7 +484,9 @@ void gnrc_netif_init_devs(void);
  * @brief   Creates a network interface
  *
  * @param[out] netif    The interface. May not be `NULL`.
- * @param[in] stack     The stack for the network interface's thread.
+ * @param[in] stack     The stack for the network interface's thread. With
+ *                      `gnrc_netif_shared`, NULL to run the interface on the
+ *                      shared thread.
  * @param[in] stacksize Size of @p stack.
  * @param[in] priority  Priority for the network interface's thread.
  * @param[in] name      Name for the network interface. May be NULL.
@@ -410,7 +494,8 @@ void gnrc_netif_init_devs(void);
  * @param[in] ops       Operations for the network interface.
  *
  * @note If @ref DEVELHELP is defined netif_params_t::name is used as the
- *       name of the network interface's thread.
+ *       name of the network interface's thread. Interfaces on the shared
+ *       thread ignore @p stacksize, @p priority, and @p name.
  *
  * @return  0 on success
  * @return  negative number on error
@@ -735,6 +820,28 @@ static inline int gnrc_netif_send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
     return gnrc_netapi_send(netif->pid, pkt);
 }
 
+/**
+ * @brief   Records the receive latency of a packet
+ *
+ * Counts the time since the packet was stamped by its interface in the
+ * histogram of @p stage of that interface. Packets not stamped on reception
+ * are ignored.
+ *
+ * @details If the module `netstats_latency` is not used, a call to this
+ *          function becomes a no-op.
+ *
+ * @see @ref net_netstats_latency
+ *
+ * @param[in] pkt   A received packet with a @ref net_gnrc_netif_hdr snip
+ * @param[in] stage The stage of the network stack the packet reached
+ */
+#if IS_USED(MODULE_NETSTATS_LATENCY) || defined(DOXYGEN)
+void gnrc_netif_latency_record(gnrc_pktsnip_t *pkt,
+                               netstats_latency_stage_t stage);
+#else
+#define gnrc_netif_latency_record(pkt, stage)   (void)(pkt)
+#endif
+
 #if defined(MODULE_GNRC_NETIF_BUS) || DOXYGEN
 /**
  * @brief   Get a message bus of a given @ref gnrc_netif_t interface.
@@ -79,6 +79,22 @@ extern "C" {
 #define CONFIG_GNRC_NETIF_PKTQ_TIMER_US       (5000U)
 #endif
 
+/**
+ * @brief       Maximum number of queued packets sent back to back
+ *
+ * When the device becomes ready again, up to this many packets are taken
+ * from the packet queue and handed to the device one after another, as long
+ * as it completes each transmission right away (e.g. Ethernet devices with the
+ * blocking netdev send). TX done events of the device during such a burst do
+ * not trigger further sending, the next burst starts with the next event
+ * after it or with the dequeue timer.
+ *
+ * @see         net_gnrc_netif_pktq
+ */
+#ifndef CONFIG_GNRC_NETIF_PKTQ_BURST
+#define CONFIG_GNRC_NETIF_PKTQ_BURST          (1U)
+#endif
+
 /**
  * @brief   Number of multicast addresses needed for @ref net_gnrc_rpl "RPL".
  *
@@ -173,8 +189,55 @@ extern "C" {
 #ifndef CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US
 #define CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US   (0U)
 #endif
+
+/**
+ * @brief   Headroom in bytes reserved in front of frames received by IEEE
+ *          802.15.4 interfaces
+ *
+ * Together with the IEEE 802.15.4 header, that is also turned into headroom,
+ * this lets 6LoWPAN header decompression write the IPv6 header in front of the
+ * payload instead of copying the payload. Only used with `gnrc_pkt_headroom`.
+ */
+#ifndef CONFIG_GNRC_NETIF_RX_HEADROOM
+#if IS_USED(MODULE_GNRC_PKT_HEADROOM)
+#define CONFIG_GNRC_NETIF_RX_HEADROOM               (40U)
+#else
+#define CONFIG_GNRC_NETIF_RX_HEADROOM               (0U)
+#endif
+#endif
+
+/**
+ * @brief   Bytes of received packets an interface may have in the packet
+ *          buffer at a time
+ *
+ * Frames received beyond that are dropped until the stack released enough of
+ * the earlier ones, so one flooded interface leaves packet buffer space to the
+ * others. 0 disables the limit. Only used with `gnrc_pkt_quota`.
+ */
+#ifndef CONFIG_GNRC_NETIF_PKTBUF_QUOTA
+#define CONFIG_GNRC_NETIF_PKTBUF_QUOTA              (CONFIG_GNRC_PKTBUF_SIZE / 2)
+#endif
 /** @} */
 
+/**
+ * @brief   Maximum number of frames fetched from a device in one go
+ *
+ * @note    Only used with `gnrc_netif_rx_poll`, see
+ *          @ref net_gnrc_netif "Receive polling".
+ */
+#ifndef CONFIG_GNRC_NETIF_RX_POLL_BUDGET
+#define CONFIG_GNRC_NETIF_RX_POLL_BUDGET    (8U)
+#endif
+
+/**
+ * @brief   Stack size of the thread shared by network interfaces
+ *
+ * @note    Only used with `gnrc_netif_shared`, see @ref gnrc_netif_create().
+ */
+#ifndef GNRC_NETIF_SHARED_STACKSIZE
+#define GNRC_NETIF_SHARED_STACKSIZE (THREAD_STACKSIZE_DEFAULT)
+#endif
+
 /**
  * @brief   Message queue size for network interface threads
  */
@@ -194,6 +257,18 @@ extern "C" {
 #define CONFIG_GNRC_NETIF_NONSTANDARD_6LO_MTU 0
 #endif
 
+/**
+ * @brief   Filter IPv6 multicast groups by a hash before searching them
+ *
+ * When set, every interface keeps a 32-bit bitmap of the hashes of the
+ * multicast groups it joined. A received multicast packet, for which the bit
+ * of its destination is not set, is not for this interface and is dropped
+ * without searching gnrc_netif_ipv6_t::groups.
+ */
+#ifndef CONFIG_GNRC_NETIF_IPV6_GROUPS_FILTER
+#define CONFIG_GNRC_NETIF_IPV6_GROUPS_FILTER    0
+#endif
+
 /**
  * @brief   Automatically add 6LoWPAN compression at border router
  *
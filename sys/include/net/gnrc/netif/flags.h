@@ -145,6 +145,27 @@ enum {
  * @brief   Network interface is configured in raw mode
  */
 #define GNRC_NETIF_FLAGS_RAWMODE                   (0x00010000U)
+
+/**
+ * @brief   Network interface runs on the shared interface thread
+ *
+ * @see     gnrc_netif_create()
+ */
+#define GNRC_NETIF_FLAGS_SHARED                    (0x00020000U)
+
+/**
+ * @brief   Device computes the transport layer checksums of outgoing packets
+ *
+ * @see     @ref NETOPT_TX_CSUM_OFFLOAD
+ */
+#define GNRC_NETIF_FLAGS_TX_CSUM_OFFLOAD           (0x00040000U)
+
+/**
+ * @brief   Device verifies the transport layer checksums of incoming packets
+ *
+ * @see     @ref NETOPT_RX_CSUM_OFFLOAD
+ */
+#define GNRC_NETIF_FLAGS_RX_CSUM_OFFLOAD           (0x00080000U)
 /** @} */
 
 #ifdef __cplusplus
@@ -113,6 +113,24 @@ extern "C" {
  *          can be used to check for presence of a valid timestamp.
  */
 #define GNRC_NETIF_HDR_FLAGS_TIMESTAMP  (0x08)
+
+/**
+ * @brief   Indicate presence of a valid gnrc_netif_hdr_t::rx_stamp
+ *
+ * @details Only set with module `netstats_latency`, see
+ *          @ref net_netstats_latency.
+ */
+#define GNRC_NETIF_HDR_FLAGS_RX_STAMP   (0x04)
+
+/**
+ * @brief   Transport layer checksum was already verified by the device
+ *
+ * @details Set for packets received on interfaces with
+ *          @ref GNRC_NETIF_FLAGS_RX_CSUM_OFFLOAD, so UDP, TCP and ICMPv6 skip
+ *          the verification of the checksum. Reassembled packets never carry
+ *          this flag.
+ */
+#define GNRC_NETIF_HDR_FLAGS_CSUM_VALID (0x02)
 /**
  * @}
  */
@@ -154,6 +172,17 @@ typedef struct {
      */
     uint64_t timestamp;
 #endif /* MODULE_GNRC_NETIF_TIMESTAMP */
+#if IS_USED(MODULE_NETSTATS_LATENCY) || defined(DOXYGEN)
+    /**
+     * @brief   Time of the device interrupt that led to the reception in µs
+     *
+     * @note    Only when @ref GNRC_NETIF_HDR_FLAGS_RX_STAMP is set, this
+     *          field contains valid info.
+     *
+     * This field is only provided if module `netstats_latency` is used.
+     */
+    uint32_t rx_stamp;
+#endif
 } gnrc_netif_hdr_t;
 
 /**
@@ -58,6 +58,83 @@ void gnrc_netif_acquire(gnrc_netif_t *netif);
  */
 void gnrc_netif_release(gnrc_netif_t *netif);
 
+#if IS_USED(MODULE_GNRC_NETIF_SHARED) || DOXYGEN
+/**
+ * @brief   Gets the interface on the shared thread addressed by @p pid
+ *
+ * @param[in] pid   PID a @ref net_gnrc_netapi "netapi" message is sent to
+ *
+ * @note    Only available with `gnrc_netif_shared`.
+ *
+ * @return  the interface, if @p pid is not a thread but a shared interface
+ * @return  NULL otherwise
+ *
+ * @internal
+ */
+gnrc_netif_t *gnrc_netif_shared_get(kernel_pid_t pid);
+
+/**
+ * @brief   Passes a message to an interface on the shared thread
+ *
+ * Counterpart of msg_try_send() for shared interfaces.
+ *
+ * @param[in] netif the network interface, must be shared
+ * @param[in] msg   the message
+ *
+ * @note    Only available with `gnrc_netif_shared`.
+ *
+ * @return  1, if the message was queued
+ * @return  0, if the message queue of @p netif is full
+ *
+ * @internal
+ */
+int gnrc_netif_shared_msg(gnrc_netif_t *netif, msg_t *msg);
+
+/**
+ * @brief   Gets or sets an option of an interface on the shared thread
+ *
+ * Blocks until the shared thread handled the request.
+ *
+ * @param[in] netif the network interface, must be shared
+ * @param[in] opt   the option
+ * @param[in] type  @ref GNRC_NETAPI_MSG_TYPE_GET or
+ *                  @ref GNRC_NETAPI_MSG_TYPE_SET
+ *
+ * @note    Only available with `gnrc_netif_shared`.
+ *
+ * @return  return value of gnrc_netif_ops_t::get() or gnrc_netif_ops_t::set()
+ *
+ * @internal
+ */
+int gnrc_netif_shared_get_set(gnrc_netif_t *netif, gnrc_netapi_opt_t *opt,
+                              uint16_t type);
+#endif
+
+#if IS_USED(MODULE_GNRC_NETAPI_CALLBACKS) || DOXYGEN
+/**
+ * @brief   Gets or sets an option of an interface from within its own thread
+ *
+ * A layer registered as @ref GNRC_NETREG_TYPE_CB "callback" may run in the
+ * thread of the interface it addresses, where a synchronous netapi message
+ * to the interface would dead-lock.
+ *
+ * @pre `thread_getpid() == netif->pid`
+ *
+ * @param[in] netif the network interface
+ * @param[in] opt   the option
+ * @param[in] type  @ref GNRC_NETAPI_MSG_TYPE_GET or
+ *                  @ref GNRC_NETAPI_MSG_TYPE_SET
+ *
+ * @note    Only available with `gnrc_netapi_callbacks`.
+ *
+ * @return  return value of gnrc_netif_ops_t::get() or gnrc_netif_ops_t::set()
+ *
+ * @internal
+ */
+int gnrc_netif_get_set_own(gnrc_netif_t *netif, gnrc_netapi_opt_t *opt,
+                           uint16_t type);
+#endif
+
 #if IS_USED(MODULE_GNRC_NETIF_IPV6) || DOXYGEN
 /**
  * @brief   Adds an IPv6 address to the interface
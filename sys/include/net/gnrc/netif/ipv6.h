@@ -98,6 +98,14 @@ typedef struct {
      * @note    Only available with module @ref net_gnrc_ipv6 "gnrc_ipv6".
      */
     ipv6_addr_t groups[GNRC_NETIF_IPV6_GROUPS_NUMOF];
+#if IS_ACTIVE(CONFIG_GNRC_NETIF_IPV6_GROUPS_FILTER) || DOXYGEN
+    /**
+     * @brief   Bitmap of the hashes of gnrc_netif_ipv6_t::groups
+     *
+     * @note    Only available with @ref CONFIG_GNRC_NETIF_IPV6_GROUPS_FILTER.
+     */
+    uint32_t groups_filter;
+#endif
 #ifdef MODULE_NETSTATS_IPV6
     /**
      * @brief IPv6 packet statistics
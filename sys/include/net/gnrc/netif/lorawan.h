@@ -31,6 +31,17 @@ extern "C" {
  */
 #define GNRC_NETIF_LORAWAN_FLAGS_LINK_CHECK                (0x1U)
 
+/**
+ * @brief   Number of uplinks the interface queues while it can't send
+ *
+ * Frames that are sent while the MAC is busy with another transmission or
+ * while the duty cycle of all enabled channels is exhausted are queued and
+ * sent in order as soon as possible, instead of being dropped.
+ */
+#ifndef CONFIG_GNRC_NETIF_LORAWAN_TX_QUEUE_LEN
+#define CONFIG_GNRC_NETIF_LORAWAN_TX_QUEUE_LEN      (4U)
+#endif
+
 /**
  * @brief   GNRC LoRaWAN interface descriptor
  */
@@ -50,6 +61,10 @@ typedef struct {
     gnrc_lorawan_t mac;                             /**< gnrc lorawan mac descriptor */
     ztimer_t timer;                                 /**< General purpose timer */
     ztimer_t backoff_timer;                         /**< Backoff timer */
+    ztimer_t tx_timer;                              /**< Timer to send queued uplinks */
+    gnrc_pktsnip_t *tx_queue[CONFIG_GNRC_NETIF_LORAWAN_TX_QUEUE_LEN]; /**< queued uplinks */
+    uint8_t tx_queue_head;                          /**< index of the oldest queued uplink */
+    uint8_t tx_queue_len;                           /**< number of queued uplinks */
     uint8_t flags;                                  /**< flags for the LoRaWAN interface */
     uint8_t demod_margin;                           /**< value of last demodulation margin */
     uint8_t num_gateways;                           /**< number of gateways of last link check */
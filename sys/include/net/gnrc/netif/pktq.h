@@ -76,6 +76,7 @@ static inline gnrc_pktsnip_t *gnrc_netif_pktq_get(gnrc_netif_t *netif)
     if (entry != NULL) {
         pkt = entry->pkt;
         entry->pkt = NULL;
+        netif->send_queue.len--;
     }
     return pkt;
 #else   /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
@@ -137,6 +138,28 @@ static inline bool gnrc_netif_pktq_empty(gnrc_netif_t *netif)
 #endif  /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
 }
 
+/**
+ * @brief   Gets the number of packets in the packet send queue of a network
+ *          interface
+ *
+ * @pre `netif != NULL`
+ *
+ * @param[in] netif A network interface. May not be NULL.
+ *
+ * @return  number of packets in the packet send queue of @p netif
+ */
+static inline unsigned gnrc_netif_pktq_len(gnrc_netif_t *netif)
+{
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ)
+    assert(netif != NULL);
+
+    return netif->send_queue.len;
+#else   /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
+    (void)netif;
+    return 0;
+#endif  /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
+}
+
 #ifdef __cplusplus
 }
 #endif
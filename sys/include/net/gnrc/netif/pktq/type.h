@@ -23,6 +23,9 @@
 #ifndef NET_GNRC_NETIF_PKTQ_TYPE_H
 #define NET_GNRC_NETIF_PKTQ_TYPE_H
 
+#include <stdbool.h>
+#include <stdint.h>
+
 #include "net/gnrc/pktqueue.h"
 #include "xtimer.h"
 
@@ -35,6 +38,9 @@ extern "C" {
  */
 typedef struct {
     gnrc_pktqueue_t *queue;     /**< the actual packet queue class */
+    uint16_t len;               /**< number of packets in the queue */
+    bool in_burst;              /**< queued packets are being sent back to
+                                 *   back */
 #if CONFIG_GNRC_NETIF_PKTQ_TIMER_US >= 0
     msg_t dequeue_msg;          /**< message for gnrc_netif_pktq_t::dequeue_timer to send */
     xtimer_t dequeue_timer;     /**< timer to schedule next sending of
@@ -79,6 +79,22 @@ typedef enum {
  */
 #define GNRC_NETREG_DEMUX_CTX_ALL   (0xffff0000)
 
+/**
+ * @brief   Number of hash buckets per transport layer with `gnrc_netreg_hash`
+ *
+ * With the `gnrc_netreg_hash` module, the entries of @ref GNRC_NETTYPE_UDP
+ * and @ref GNRC_NETTYPE_TCP are kept in a hash table by
+ * @ref gnrc_netreg_entry_t::demux_ctx (the port), so a lookup only walks the
+ * entries in the bucket of the port instead of all entries of the type. The
+ * demux context of an entry must not change while it is registered.
+ *
+ * @note    Must be a power of 2. Costs a pointer per bucket and transport
+ *          layer.
+ */
+#ifndef CONFIG_GNRC_NETREG_HASH_BUCKETS
+#define CONFIG_GNRC_NETREG_HASH_BUCKETS (8U)
+#endif
+
 /**
  * @name    Static entry initialization macros
  * @anchor  net_gnrc_netreg_init_static
@@ -121,6 +121,39 @@ typedef struct gnrc_pktsnip {
     kernel_pid_t err_sub;           /**< subscriber to errors related to this
                                      *   packet snip */
 #endif
+#if defined(MODULE_GNRC_PKT_HEADROOM) || defined(DOXYGEN)
+    /**
+     * @brief   Number of bytes in front of gnrc_pktsnip_t::data that belong
+     *          to this snip, see @ref gnrc_pktbuf_push().
+     *
+     * @internal
+     */
+    uint16_t headroom;
+#endif
+#if defined(MODULE_GNRC_PKT_QUOTA) || defined(DOXYGEN)
+    /**
+     * @brief   Quota this snip is charged to, see
+     *          @ref gnrc_pktbuf_quota_charge()
+     *
+     * @internal
+     */
+    struct gnrc_pktbuf_quota *quota;
+    /**
+     * @brief   Number of bytes charged to gnrc_pktsnip_t::quota
+     *
+     * @internal
+     */
+    uint16_t quota_charge;
+#endif
+#if defined(MODULE_GNRC_PKT_EXT) || defined(DOXYGEN)
+    /**
+     * @brief   Owner of the memory gnrc_pktsnip_t::data points to, if it is
+     *          not part of the packet buffer, see @ref gnrc_pktbuf_add_ext()
+     *
+     * @internal
+     */
+    struct gnrc_pktbuf_ext *ext;
+#endif
 } gnrc_pktsnip_t;
 
 /**
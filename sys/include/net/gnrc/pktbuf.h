@@ -36,6 +36,7 @@
 
 #include "cpu_conf.h"
 #include "mutex.h"
+#include "sched.h"
 #include "net/gnrc/pkt.h"
 #include "net/gnrc/neterr.h"
 #include "net/gnrc/nettype.h"
@@ -63,6 +64,49 @@ extern "C" {
 #ifndef CONFIG_GNRC_PKTBUF_SIZE
 #define CONFIG_GNRC_PKTBUF_SIZE    (6144)
 #endif
+
+/**
+ * @brief   Number of packet snip descriptors of `gnrc_pktbuf_pool`
+ *
+ * `gnrc_pktbuf_pool` replaces the single arena of `gnrc_pktbuf_static` by
+ * pools of fixed size blocks: one for packet snip descriptors, one for small
+ * headers and one for MTU sized payloads. Allocations take the smallest block
+ * that fits (or the next larger class if that one is exhausted), so
+ * allocating and freeing never searches and the buffer can not fragment.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_POOL_SNIP_NUMOF
+#define CONFIG_GNRC_PKTBUF_POOL_SNIP_NUMOF     (48)
+#endif
+
+/**
+ * @brief   Size of the small header blocks of `gnrc_pktbuf_pool` in bytes
+ */
+#ifndef CONFIG_GNRC_PKTBUF_POOL_SMALL_SIZE
+#define CONFIG_GNRC_PKTBUF_POOL_SMALL_SIZE     (128)
+#endif
+
+/**
+ * @brief   Number of small header blocks of `gnrc_pktbuf_pool`
+ */
+#ifndef CONFIG_GNRC_PKTBUF_POOL_SMALL_NUMOF
+#define CONFIG_GNRC_PKTBUF_POOL_SMALL_NUMOF    (16)
+#endif
+
+/**
+ * @brief   Size of the payload blocks of `gnrc_pktbuf_pool` in bytes
+ *
+ * This is the largest snip that can be allocated.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_POOL_LARGE_SIZE
+#define CONFIG_GNRC_PKTBUF_POOL_LARGE_SIZE     (1280)
+#endif
+
+/**
+ * @brief   Number of payload blocks of `gnrc_pktbuf_pool`
+ */
+#ifndef CONFIG_GNRC_PKTBUF_POOL_LARGE_NUMOF
+#define CONFIG_GNRC_PKTBUF_POOL_LARGE_NUMOF    (4)
+#endif
 /** @} */
 
 /**
@@ -88,12 +132,70 @@ void gnrc_pktbuf_init(void);
  *                      be NULL.
  * @param[in] type      Protocol type of the gnrc_pktsnip_t.
  *
+ * With `gnrc_pkt_headroom` a header is put into the headroom of @p next
+ * (see @ref gnrc_pktbuf_push()) if it fits and @p next is not shared, so only
+ * the new snip descriptor is allocated. The new snip takes over the remaining
+ * headroom, so the same buffer can serve the headers of all layers of a
+ * packet, as `gnrc_sock_udp` does with `CONFIG_GNRC_SOCK_UDP_TX_HEADROOM`.
+ * `gnrc_pktbuf_malloc` does not support this and always allocates the data
+ * separately.
+ *
  * @return  Pointer to the packet part that represents the new gnrc_pktsnip_t.
  * @return  NULL, if no space is left in the packet buffer.
  */
 gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t size,
                                 gnrc_nettype_t type);
 
+#if defined(MODULE_GNRC_PKT_EXT) || defined(DOXYGEN)
+/**
+ * @brief   Owner of memory outside of the packet buffer that packet snips
+ *          reference, see @ref gnrc_pktbuf_add_ext()
+ */
+typedef struct gnrc_pktbuf_ext {
+    /**
+     * @brief   Called once no snip references the memory anymore, may be NULL
+     *
+     * The callback is called with the packet buffer locked, from the thread
+     * releasing the last snip (usually the interface after transmission), so
+     * it must not use the packet buffer and should only wake up the owner,
+     * e.g. by unlocking a mutex.
+     */
+    void (*cb)(struct gnrc_pktbuf_ext *ext);
+    unsigned snips;     /**< number of snips referencing the memory, initialize to 0 */
+} gnrc_pktbuf_ext_t;
+
+/**
+ * @brief   Adds a new gnrc_pktsnip_t referencing memory outside of the packet
+ *          buffer
+ *
+ * Unlike @ref gnrc_pktbuf_add(), @p data are not copied, so e.g. a large
+ * payload in ROM can be sent down the network stack as it is. The memory
+ * must stay valid and unchanged until gnrc_pktbuf_ext_t::cb of @p ext is
+ * called. Several snips may share the same @p ext.
+ *
+ * Layers duplicating the snip with @ref gnrc_pktbuf_start_write() copy the
+ * data into the packet buffer. The data of the snip must not be resized
+ * however, i.e. by @ref gnrc_pktbuf_realloc_data(), @ref gnrc_pktbuf_mark() or
+ * @ref gnrc_pktbuf_pull(), which the send path of the network stack only does
+ * to headers.
+ *
+ * @pre `(ext != NULL)`
+ *
+ * @param[in] next      Next gnrc_pktsnip_t in the packet. Leave NULL if you
+ *                      want to create a new packet.
+ * @param[in] data      Data of the new gnrc_pktsnip_t.
+ * @param[in] size      Length of @p data.
+ * @param[in] type      Protocol type of the gnrc_pktsnip_t.
+ * @param[in] ext       Owner of @p data.
+ *
+ * @return  Pointer to the packet part that represents the new gnrc_pktsnip_t.
+ * @return  NULL, if no space is left in the packet buffer.
+ */
+gnrc_pktsnip_t *gnrc_pktbuf_add_ext(gnrc_pktsnip_t *next, const void *data,
+                                    size_t size, gnrc_nettype_t type,
+                                    gnrc_pktbuf_ext_t *ext);
+#endif
+
 /**
  * @brief   Marks the first @p size bytes in a received packet with a new
  *          packet snip that is appended to the packet.
@@ -279,13 +381,137 @@ gnrc_pktsnip_t *gnrc_pktbuf_reverse_snips(gnrc_pktsnip_t *pkt);
  */
 int gnrc_pktbuf_merge(gnrc_pktsnip_t *pkt);
 
+/**
+ * @brief   Gets the number of bytes in front of gnrc_pktsnip_t::data that can
+ *          be claimed with @ref gnrc_pktbuf_push()
+ *
+ * @param[in] pkt   A packet snip.
+ *
+ * @return  The headroom of @p pkt, always 0 without `gnrc_pkt_headroom`.
+ */
+static inline size_t gnrc_pktbuf_headroom(const gnrc_pktsnip_t *pkt)
+{
+#ifdef MODULE_GNRC_PKT_HEADROOM
+    return pkt->headroom;
+#else
+    (void)pkt;
+    return 0;
+#endif
+}
+
+/**
+ * @brief   Removes the first @p size bytes from the data of @p pkt
+ *
+ * This is a cheaper replacement of @ref gnrc_pktbuf_mark() followed by
+ * @ref gnrc_pktbuf_remove_snip() for headers that are not needed anymore.
+ * With `gnrc_pkt_headroom` the data are neither moved nor copied and the
+ * removed bytes become headroom of @p pkt that can be reclaimed with
+ * @ref gnrc_pktbuf_push().
+ *
+ * ~~~~~~~~~~~~~~~~~~~
+ * Before                                    After
+ * ======                                    =====
+ *
+ *  pkt->data                                                 pkt->data
+ *  v                                                         v
+ * +--------------------------------+        +----------------+---------------+
+ * +--------------------------------+        +----------------+---------------+
+ *  \__________pkt->size___________/          \____size______/ \__pkt->size__/
+ * ~~~~~~~~~~~~~~~~~~~
+ *
+ * @pre `pkt != NULL`
+ * @pre gnrc_pktsnip_t::users of @p pkt is 1, see @ref gnrc_pktbuf_start_write()
+ *
+ * @param[in,out] pkt   A packet snip.
+ * @param[in] size      Number of bytes to remove.
+ *
+ * @return  0, on success
+ * @return  -EINVAL, if @p size > gnrc_pktsnip_t::size of @p pkt
+ * @return  -ENOMEM, if no space is left in the packet buffer.
+ */
+int gnrc_pktbuf_pull(gnrc_pktsnip_t *pkt, size_t size);
+
+/**
+ * @brief   Prepends @p size bytes of the headroom of @p pkt to its data
+ *
+ * Used to write a header (e.g. a decompressed one) in front of data without
+ * copying the data. gnrc_pktsnip_t::data is moved @p size bytes to the front,
+ * the content of the new bytes is undefined.
+ *
+ * Packet snips only have headroom with `gnrc_pkt_headroom`, either after
+ * @ref gnrc_pktbuf_pull() or if they were allocated larger and pulled by
+ * their creator, as e.g. @ref CONFIG_GNRC_NETIF_RX_HEADROOM.
+ *
+ * @pre `pkt != NULL`
+ * @pre gnrc_pktsnip_t::users of @p pkt is 1, see @ref gnrc_pktbuf_start_write()
+ *
+ * @param[in,out] pkt   A packet snip.
+ * @param[in] size      Number of bytes to prepend.
+ *
+ * @return  0, on success
+ * @return  -ENOSPC, if @p size exceeds the headroom of @p pkt.
+ */
+int gnrc_pktbuf_push(gnrc_pktsnip_t *pkt, size_t size);
+
+#if defined(MODULE_GNRC_PKT_QUOTA) || defined(DOXYGEN)
+/**
+ * @brief   Share of the packet buffer that the packets of one source may
+ *          occupy
+ *
+ * With `gnrc_pkt_quota` every @ref net_gnrc_netif charges the packets it
+ * receives to its own quota, so a flood on one interface can not fill the
+ * packet buffer and starve the other interfaces.
+ */
+typedef struct gnrc_pktbuf_quota {
+    struct gnrc_pktbuf_quota *next; /**< next quota in the list of all quotas */
+    size_t limit;                   /**< maximum of @p used, 0 for no limit */
+    size_t used;                    /**< bytes currently charged */
+    size_t used_max;                /**< maximum of @p used */
+    uint32_t fails;                 /**< number of refused charges */
+    kernel_pid_t owner;             /**< owner shown by gnrc_pktbuf_stats() */
+} gnrc_pktbuf_quota_t;
+
+/**
+ * @brief   Initializes a quota and adds it to the list shown by
+ *          gnrc_pktbuf_stats()
+ *
+ * @param[out] quota    The quota.
+ * @param[in] owner     Thread (usually the interface) the quota belongs to.
+ * @param[in] limit     Maximum number of bytes charged at a time, 0 for no
+ *                      limit.
+ */
+void gnrc_pktbuf_quota_init(gnrc_pktbuf_quota_t *quota, kernel_pid_t owner,
+                            size_t limit);
+
+/**
+ * @brief   Charges a packet to a quota
+ *
+ * The data of all snips of @p pkt, including their headroom, are charged to
+ * @p quota. They are credited back when the first snip of @p pkt is
+ * released, however the packet is split up until then.
+ *
+ * @pre @p pkt is not charged to a quota yet.
+ *
+ * @param[in] quota     The quota.
+ * @param[in] pkt       A packet.
+ *
+ * @return  0, on success
+ * @return  -ENOBUFS, if @p pkt would exceed the limit of @p quota. The
+ *          packet is not released.
+ */
+int gnrc_pktbuf_quota_charge(gnrc_pktbuf_quota_t *quota, gnrc_pktsnip_t *pkt);
+#endif
+
 #ifdef DEVELHELP
 /**
  * @brief   Prints some statistics about the packet buffer to stdout.
  *
  * @note    Only available with DEVELHELP defined.
  *
- * @details Statistics include maximum number of reserved bytes.
+ * @details Statistics include maximum number of reserved bytes. With
+ *          `gnrc_pktbuf_pool`, the usage, internal fragmentation and failed
+ *          allocations of each block class are printed. With
+ *          `gnrc_pkt_quota`, the usage of all quotas is printed.
  */
 void gnrc_pktbuf_stats(void);
 #endif
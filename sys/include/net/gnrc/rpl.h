@@ -248,12 +248,52 @@ extern "C" {
 /**
  * @brief   Number of implemented Objective Functions
  */
+#if IS_USED(MODULE_GNRC_RPL_MRHOF) || defined(DOXYGEN)
+#define GNRC_RPL_IMPLEMENTED_OFS_NUMOF (2)
+#else
 #define GNRC_RPL_IMPLEMENTED_OFS_NUMOF (1)
+#endif
 
 /**
- * @brief   Default Objective Code Point (OF0)
+ * @brief   Objective Code Point of MRHOF
+ * @see <a href="https://tools.ietf.org/html/rfc6719#section-6.1">
+ *          RFC 6719, section 6.1
+ *      </a>
  */
+#define GNRC_RPL_OCP_MRHOF (1)
+
+/**
+ * @brief   Default Objective Code Point (MRHOF with module `gnrc_rpl_mrhof`,
+ *          OF0 otherwise)
+ */
+#if IS_USED(MODULE_GNRC_RPL_MRHOF)
+#define GNRC_RPL_DEFAULT_OCP (GNRC_RPL_OCP_MRHOF)
+#else
 #define GNRC_RPL_DEFAULT_OCP (0)
+#endif
+
+/**
+ * @brief   Maximum ETX of the link to a parent for MRHOF in units of
+ *          @ref NETSTATS_NB_ETX_DIVISOR (MAX_LINK_METRIC)
+ * @see <a href="https://tools.ietf.org/html/rfc6719#section-5">
+ *          RFC 6719, section 5
+ *      </a>
+ */
+#ifndef CONFIG_GNRC_RPL_MRHOF_MAX_LINK_METRIC
+#define CONFIG_GNRC_RPL_MRHOF_MAX_LINK_METRIC (512)
+#endif
+
+/**
+ * @brief   ETX in units of @ref NETSTATS_NB_ETX_DIVISOR by which the path
+ *          through another parent has to be better before MRHOF switches to it
+ *          (PARENT_SWITCH_THRESHOLD)
+ * @see <a href="https://tools.ietf.org/html/rfc6719#section-5">
+ *          RFC 6719, section 5
+ *      </a>
+ */
+#ifndef CONFIG_GNRC_RPL_MRHOF_PARENT_SWITCH_THRESHOLD
+#define CONFIG_GNRC_RPL_MRHOF_PARENT_SWITCH_THRESHOLD (192)
+#endif
 
 /**
  * @brief   Default Instance ID
@@ -13,6 +13,12 @@
  * @see <a href="https://tools.ietf.org/html/rfc6554">
  *          RFC 6554
  *      </a>
+ *
+ * @note    Only the processing of source routing headers by intermediate
+ *          routers is implemented. In non-storing mode, the DODAG root adds
+ *          the targets of received DAOs to the forwarding table of the NIB
+ *          with the DAO's source as next hop and does not insert source
+ *          routing headers into downward packets (yet).
  * @{
  *
  * @file
@@ -243,7 +243,8 @@ struct gnrc_rpl_parent {
     uint8_t dtsn;                   /**< last seen dtsn of this parent */
     uint16_t rank;                  /**< rank of the parent */
     gnrc_rpl_dodag_t *dodag;        /**< DODAG the parent belongs to */
-    double link_metric;             /**< metric of the link */
+    uint16_t link_metric;           /**< metric of the link, set by
+                                         gnrc_rpl_of_t::update_link_metric */
     uint8_t link_metric_type;       /**< type of the metric */
     /**
      * @brief Parent timeout events (see @ref GNRC_RPL_MSG_TYPE_PARENT_TIMEOUT)
@@ -295,6 +296,18 @@ typedef struct {
      * @param[in]   dodag   RPL dodag object.
      */
     void (*reset)(gnrc_rpl_dodag_t *dodag);
+
+    /**
+     * @brief   Update the link metric of a parent
+     *
+     * Called whenever a DIO of @p parent was received, so the metric is only
+     * refreshed for that parent. May be NULL when the objective function does
+     * not use a link metric.
+     *
+     * @param[in]   parent  The parent to update gnrc_rpl_parent_t::link_metric
+     *                      of.
+     */
+    void (*update_link_metric)(gnrc_rpl_parent_t *parent);
     void (*parent_state_callback)(gnrc_rpl_parent_t *, int, int); /**< retrieves the state of a parent*/
 
     /**
@@ -57,6 +57,20 @@ extern "C" {
 #define CONFIG_GNRC_SIXLOWPAN_MSG_QUEUE_SIZE_EXP   (3U)
 #endif
 
+/**
+ * @brief   Number of compressed IPv6 headers cached by IPHC
+ *
+ * By default, IPHC looks up the compression contexts for the source and
+ * destination address and builds the compressed IPv6 header for every packet.
+ * With this option, the compressed headers of the last packets are kept, and
+ * a packet with the same source, destination, traffic class, flow label, next
+ * header, and hop limit as a cached one just gets a copy of its header. Each
+ * entry takes about 120 bytes of RAM. 0 disables the cache.
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_NUMOF
+#define CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_NUMOF     (0U)
+#endif
+
 /**
  * @brief   Number of datagrams that can be fragmented simultaneously
  *
@@ -312,6 +326,33 @@ extern "C" {
 #define CONFIG_GNRC_SIXLOWPAN_SFR_DG_RETRIES            0U
 #endif
 
+/**
+ * @brief   Factor by which the measured TX time of a frame to the next hop is
+ *          multiplied to get the inter-frame gap
+ *
+ * When `gnrc_sixlowpan_frag_sfr_pacing` is compiled in, the InterFrameGap
+ * towards a next hop is at least its average TX time (as measured by
+ * `netstats_neighbor_tx_time`) times this factor. With a factor of 3, a
+ * fragment is not sent before its predecessor left the transmission range of
+ * the sender on a linear path.
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_SFR_PACING_TX_TIME_FACTOR
+#define CONFIG_GNRC_SIXLOWPAN_SFR_PACING_TX_TIME_FACTOR 3U
+#endif
+
+/**
+ * @brief   Number of next hops the round-trip time is estimated for
+ *
+ * When `gnrc_sixlowpan_frag_sfr_pacing` is compiled in, the time between
+ * sending a fragment and receiving its RFRAG-ACK is measured per next hop. The
+ * RFRAG-ACK timeout of new datagrams to that hop is then derived from the
+ * smoothed round-trip time as in [RFC 6298](https://tools.ietf.org/html/rfc6298)
+ * instead of using @ref CONFIG_GNRC_SIXLOWPAN_SFR_OPT_ARQ_TIMEOUT_MS.
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_SFR_PACING_DST_NUMOF
+#define CONFIG_GNRC_SIXLOWPAN_SFR_PACING_DST_NUMOF      4U
+#endif
+
 /**
  * @brief   The numerator for the factor for when to mark ECN on incoming `netif`
  *          queue state
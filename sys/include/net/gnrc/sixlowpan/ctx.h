@@ -115,6 +115,18 @@ gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_update(uint8_t id, const ipv6_addr_t *p
                                                 uint8_t prefix_len, uint16_t ltime,
                                                 bool comp);
 
+/**
+ * @brief   Gets the generation of the contexts
+ *
+ * The generation changes whenever a context is updated or added, so users can
+ * tell if a cached result of @ref gnrc_sixlowpan_ctx_lookup_addr() may be
+ * outdated. Contexts that expire or are removed do not change it, so users
+ * also have to check that a context they cached is still valid.
+ *
+ * @return  The current generation of the contexts.
+ */
+uint32_t gnrc_sixlowpan_ctx_gen(void);
+
 /**
  * @brief   Removes context.
  *
@@ -212,7 +212,8 @@ static inline bool gnrc_sixlowpan_frag_sfr_congure_snd_next_in_cwnd(gnrc_sixlowp
  * @brief   Checks if inter-frame gap is provided
  *
  * Either because @ref CONFIG_GNRC_SIXLOWPAN_SFR_INTER_FRAME_GAP_US is greater
- * 0 or module `gnrc_sixlowpan_frag_sfr_congure` is provided
+ * 0 or module `gnrc_sixlowpan_frag_sfr_congure` or
+ * `gnrc_sixlowpan_frag_sfr_pacing` is provided
  *
  * @retval  true    When an inter-frame gap can be provided
  * @retval  false   When the inter-frame gap is supposed to be 0.
@@ -220,7 +221,8 @@ static inline bool gnrc_sixlowpan_frag_sfr_congure_snd_next_in_cwnd(gnrc_sixlowp
 static inline bool gnrc_sixlowpan_frag_sfr_congure_snd_has_inter_frame_gap(void)
 {
     return (CONFIG_GNRC_SIXLOWPAN_SFR_INTER_FRAME_GAP_US > 0) ||
-           IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR_CONGURE);
+           IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR_CONGURE) ||
+           IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR_PACING);
 }
 
 /**
@@ -121,6 +121,26 @@ int gnrc_tcp_init(void);
  */
 void gnrc_tcp_tcb_init(gnrc_tcp_tcb_t *tcb);
 
+/**
+ * @brief Provide a receive buffer for a Transmission Control Block (TCB)
+ *
+ * By default, a connection gets one of @ref CONFIG_GNRC_TCP_RCV_BUFFERS
+ * receive buffers of size @ref GNRC_TCP_RCV_BUF_SIZE when it is opened. With
+ * this function, the receive buffer and with it the receive window can be
+ * sized per connection. The buffer is used for all connections of @p tcb
+ * until gnrc_tcp_tcb_init() is called again.
+ *
+ * @pre gnrc_tcp_tcb_init() must have been successfully called.
+ * @pre @p tcb must not be opened or listening.
+ * @pre @p buf must not be NULL.
+ * @pre 0 < @p size <= UINT16_MAX
+ *
+ * @param[in,out] tcb    TCB to use the buffer for.
+ * @param[in]     buf    Buffer to store received data in.
+ * @param[in]     size   Size of @p buf in bytes.
+ */
+void gnrc_tcp_tcb_set_rcv_buf(gnrc_tcp_tcb_t *tcb, void *buf, size_t size);
+
 /**
  * @brief Initialize Transmission Control Block (TCB) queue
  * @pre @p queue must not be NULL.
@@ -95,7 +95,9 @@ extern "C" {
  * @brief Number of preallocated receive buffers.
  *
  * This value determines how many parallel TCP connections can be active at the
- * same time.
+ * same time. Connections that got a receive buffer by
+ * gnrc_tcp_tcb_set_rcv_buf() do not use one of them. With 0, every connection
+ * needs its own receive buffer.
  */
 #ifndef CONFIG_GNRC_TCP_RCV_BUFFERS
 #define CONFIG_GNRC_TCP_RCV_BUFFERS (1U)
@@ -108,6 +110,45 @@ extern "C" {
 #define GNRC_TCP_RCV_BUF_SIZE (CONFIG_GNRC_TCP_DEFAULT_WINDOW)
 #endif
 
+/**
+ * @brief Number of hash buckets used to find the connection of a received segment.
+ *
+ * With the default of 0, every received segment is matched against all
+ * connections. Otherwise, connections are additionally hashed by their ports
+ * and peer address, so only connections in the same bucket are compared. This
+ * pays off with dozens of connections. Segments opening a connection still
+ * search all listening connections. Must be a power of two.
+ */
+#ifndef CONFIG_GNRC_TCP_TCB_HASH_BUCKETS
+#define CONFIG_GNRC_TCP_TCB_HASH_BUCKETS (0U)
+#endif
+
+/**
+ * @brief Maximum number of unacknowledged segments in flight.
+ *
+ * With the default of 1, a segment is only sent after the previous one was
+ * acknowledged. Larger values allow to fill a send window of several MSS
+ * within one round trip and enable fast retransmit after three duplicate
+ * ACKs (RFC 5681). Every segment in flight is kept in the packet buffer until
+ * it is acknowledged.
+ */
+#ifndef CONFIG_GNRC_TCP_SND_SEGMENTS
+#define CONFIG_GNRC_TCP_SND_SEGMENTS (1U)
+#endif
+
+/**
+ * @brief Number of ranges of out-of-order data kept in the receive buffer.
+ *
+ * With the default of 0, segments not starting at the next expected sequence
+ * number are dropped. Otherwise, their data is stored in the free part of the
+ * receive buffer, and delivered once the gap before it is filled. This only
+ * helps if the receive window spans several MSS, see
+ * @ref CONFIG_GNRC_TCP_MSS_MULTIPLICATOR.
+ */
+#ifndef CONFIG_GNRC_TCP_RCV_OOO_SEGMENTS
+#define CONFIG_GNRC_TCP_RCV_OOO_SEGMENTS (0U)
+#endif
+
 /**
  * @brief Lower bound for RTO in milliseconds. Default is 1 sec (see RFC 6298)
  *
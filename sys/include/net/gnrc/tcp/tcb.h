@@ -67,16 +67,41 @@ typedef struct sock_tcp {
     int32_t srtt;          /**< Smoothed round trip time */
     int32_t rto;           /**< Retransmission timeout duration */
     uint8_t retries;       /**< Number of retransmissions */
+    uint8_t dup_acks;      /**< Number of duplicate ACKs for snd_una */
     evtimer_msg_event_t event_retransmit; /**< Retransmission event */
     evtimer_msg_event_t event_timeout;    /**< Timeout event */
     evtimer_mbox_event_t event_misc;      /**< General purpose event */
-    gnrc_pktsnip_t *pkt_retransmit;       /**< Pointer to packet in "retransmit queue" */
+    /**
+     * @brief Retransmit queue, oldest unacknowledged segment first
+     */
+    gnrc_pktsnip_t *pkt_retransmit[CONFIG_GNRC_TCP_SND_SEGMENTS];
     mbox_t *mbox;            /**< TCB mbox for synchronization */
     uint8_t *rcv_buf_raw;    /**< Pointer to the receive buffer */
+    uint8_t *rcv_buf_usr;    /**< Receive buffer provided by the user, if any */
+    uint16_t rcv_buf_usr_size; /**< Size of rcv_buf_usr */
     ringbuffer_t rcv_buf;    /**< Receive buffer data structure */
+#if CONFIG_GNRC_TCP_RCV_OOO_SEGMENTS || defined(DOXYGEN)
+    /**
+     * @brief Ranges of out-of-order data in the free part of rcv_buf
+     *
+     * @note Only available with @ref CONFIG_GNRC_TCP_RCV_OOO_SEGMENTS > 0.
+     */
+    struct {
+        uint32_t seq;        /**< Sequence number of the first byte */
+        uint16_t len;        /**< Length of the range, 0 if unused */
+    } rcv_ooo[CONFIG_GNRC_TCP_RCV_OOO_SEGMENTS];
+#endif
     mutex_t fsm_lock;        /**< Mutex for FSM access synchronization */
     mutex_t function_lock;   /**< Mutex for function call synchronization */
     struct sock_tcp *next;   /**< Pointer next TCB */
+#if CONFIG_GNRC_TCP_TCB_HASH_BUCKETS || defined(DOXYGEN)
+    /**
+     * @brief Pointer to next TCB in the same hash bucket
+     *
+     * @note Only available with @ref CONFIG_GNRC_TCP_TCB_HASH_BUCKETS > 0.
+     */
+    struct sock_tcp *hash_next;
+#endif
 } gnrc_tcp_tcb_t;
 
 /**
@@ -11,6 +11,16 @@
  * @ingroup     net_gnrc
  * @brief       GNRC's implementation of the UDP protocol
  *
+ * Inline UDP
+ * ==========
+ *
+ * With the pseudo-module `gnrc_udp_inline` no UDP thread is started. UDP
+ * registers a @ref GNRC_NETREG_TYPE_CB "callback" instead, so packets are
+ * handled in the context of the thread dispatching them to UDP: the network
+ * layer on reception and the application (e.g. via @ref net_gnrc_sock) on
+ * sending. This saves the UDP thread's stack and a context switch per packet
+ * in both directions, but the stacks of those threads need to fit UDP as well.
+ *
  * @{
  *
  * @file
@@ -107,6 +117,7 @@ gnrc_pktsnip_t *gnrc_udp_hdr_build(gnrc_pktsnip_t *payload, uint16_t src,
  * @brief   Initialize and start UDP
  *
  * @return  PID of the UDP thread
+ * @return  KERNEL_PID_UNDEF with `gnrc_udp_inline`
  * @return  negative value on error
  */
 int gnrc_udp_init(void);
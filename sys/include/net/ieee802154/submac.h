@@ -100,6 +100,23 @@
  * - @ref ieee802154_submac_ack_timer_cancel
  * - @ref ieee802154_submac_bh_request
  *
+ * ## Pipeline mode
+ *
+ * By default, every step of a transmission that is not triggered by the
+ * radio (e.g. the CSMA-CA backoff or a retransmission after an ACK timeout)
+ * is deferred to the bottom half with @ref ieee802154_submac_bh_request, so
+ * that each step costs a round trip through the event loop of the upper layer.
+ *
+ * With @ref CONFIG_IEEE802154_SUBMAC_PIPELINE enabled, the SubMAC processes
+ * these steps right after the event that caused them instead, so the retry
+ * logic only waits for the radio and the ACK timer.
+ * @ref ieee802154_submac_bh_request is never called in this mode.
+ * Additionally, @ref ieee802154_send accepts one more frame while a
+ * transmission is ongoing. The frame is copied and loaded into the radio right
+ * after @ref ieee802154_submac_cb_t::tx_done reported the end of the ongoing
+ * transmission, so the radio does not idle while the upper layer handles it.
+ * The frame reports its own @ref ieee802154_submac_cb_t::tx_done later.
+ *
  * @{
  *
  * @author       José I. Alamos <jose.alamos@haw-hamburg.de>
@@ -118,6 +135,21 @@ extern "C" {
 #include "net/ieee802154.h"
 #include "net/ieee802154/radio.h"
 
+/**
+ * @defgroup net_ieee802154_submac_conf IEEE802.15.4 SubMAC compile configurations
+ * @ingroup  net_ieee802154_conf
+ * @{
+ */
+/**
+ * @brief   Enable the pipeline mode of the SubMAC
+ *
+ * @see     @ref net_ieee802154_submac "Pipeline mode"
+ */
+#ifndef CONFIG_IEEE802154_SUBMAC_PIPELINE
+#define CONFIG_IEEE802154_SUBMAC_PIPELINE   0
+#endif
+/** @} */
+
 /**
  * @brief IEEE 802.15.4 SubMAC forward declaration
  */
@@ -206,6 +238,12 @@ struct ieee802154_submac {
     ieee802154_fsm_state_t fsm_state;    /**< State of the SubMAC */
     ieee802154_phy_mode_t phy_mode;     /**< IEEE 802.15.4 PHY mode */
     const iolist_t *psdu;               /**< stores the current PSDU */
+    bool bh_pending;                    /**< bottom half is processed inline */
+#if IS_ACTIVE(CONFIG_IEEE802154_SUBMAC_PIPELINE) || defined(DOXYGEN)
+    bool next_pending;                  /**< next frame waits for transmission */
+    iolist_t next_psdu;                 /**< describes the next frame */
+    uint8_t next_frame[IEEE802154_FRAME_LEN_MAX]; /**< copy of the next frame */
+#endif
 };
 
 /**
@@ -221,7 +259,9 @@ struct ieee802154_submac {
  * @return 0 on success
  * @return -EBUSY if the SubMAC is not in RX or IDLE state or if called inside
  *         @ref ieee802154_submac_cb_t::rx_done or
- *         @ref ieee802154_submac_cb_t::tx_done
+ *         @ref ieee802154_submac_cb_t::tx_done. In pipeline mode, only if
+ *         another frame already waits for the ongoing transmission.
+ * @return -EMSGSIZE if the frame to be pipelined is too big
  */
 int ieee802154_send(ieee802154_submac_t *submac, const iolist_t *iolist);
 
@@ -126,6 +126,9 @@ extern "C" {
 #define COAP_IPATCH             (0x40)
 #define COAP_IGNORE             (0xFF)   /**< For situations where the method
                                               is not important */
+#define COAP_HANDLER_SLOW       (0x4000) /**< Handler may block for a while,
+                                              gcoap runs it in a worker thread
+                                              (module `gcoap_workers`) */
 #define COAP_MATCH_SUBTREE      (0x8000) /**< Path is considered as a prefix
                                               when matching */
 /** @} */
@@ -235,7 +238,8 @@ typedef struct {
     iolist_t *snips;                                  /**< payload snips (optional)*/
     uint16_t payload_len;                             /**< length of payload       */
     uint16_t options_len;                             /**< length of options array */
-    coap_optpos_t options[CONFIG_NANOCOAP_NOPTS_MAX]; /**< option offset array     */
+    coap_optpos_t options[CONFIG_NANOCOAP_NOPTS_MAX]; /**< option offset array,
+                                                           sorted by option number */
     BITFIELD(opt_crit, CONFIG_NANOCOAP_NOPTS_MAX);    /**< unhandled critical option */
 #ifdef MODULE_GCOAP
     uint32_t observe_value;                           /**< observe value           */
@@ -521,7 +525,7 @@ static inline unsigned coap_get_code_raw(const coap_pkt_t *pkt)
  */
 static inline coap_method_t coap_get_method(const coap_pkt_t *pkt)
 {
-    return pkt->hdr->code;
+    return (coap_method_t)pkt->hdr->code;
 }
 
 /**
@@ -554,10 +558,10 @@ static inline unsigned coap_get_token_len(const coap_pkt_t *pkt)
         return tkl;
     }
 
-    void *ext = pkt->hdr + 1;
+    uint8_t *ext = (uint8_t *)(pkt->hdr + 1);
     switch (tkl) {
     case 13:
-        return tkl + *(uint8_t *)ext;
+        return tkl + *ext;
     case 14:
         return tkl + 255 + byteorder_bebuftohs(ext);
     case 15:
@@ -725,6 +729,9 @@ static inline void coap_hdr_set_type(coap_hdr_t *hdr, unsigned type)
 /**
  * @brief   Get pointer to an option field by type
  *
+ * The option is looked up in the option offset array filled by coap_parse()
+ * or the coap_opt_add_*() functions, the options are not decoded again.
+ *
  * @param[in]   pkt     packet to work on
  * @param[in]   opt_num the option number to search for
  *
@@ -1907,6 +1914,104 @@ static inline size_t coap_put_option_ct(uint8_t *buf, uint16_t lastonum,
 }
 /**@}*/
 
+/**
+ * @name    Pre-encoded options
+ *
+ * Options of requests or responses that never change can be encoded at
+ * compile time. Each option is a member of a struct that holds the encoded
+ * options in order, e.g. for a POST to `/sensor/telemetry` with a CBOR payload:
+ *
+ * ```C
+ * static const struct {
+ *     COAP_OPT_ENC_STR_T("sensor") path0;
+ *     COAP_OPT_ENC_STR_T("telemetry") path1;
+ *     COAP_OPT_ENC_UINT8_T format;
+ * } _telemetry_opts = {
+ *     COAP_OPT_ENC_STR(COAP_OPT_URI_PATH, "sensor"),
+ *     COAP_OPT_ENC_STR(0, "telemetry"),
+ *     COAP_OPT_ENC_UINT8(COAP_OPT_CONTENT_FORMAT - COAP_OPT_URI_PATH,
+ *                        COAP_FORMAT_CBOR),
+ * };
+ * ```
+ *
+ * The first argument of each value macro is the option delta, the difference
+ * to the number of the previous option. The struct can then be used with a
+ * @ref coap_template_t.
+ *
+ * Only option deltas and value lengths below 13 are supported, i.e. the
+ * option header is a single byte. Anything else fails to compile; encode
+ * such options at runtime with the Options Write Buffer API instead.
+ */
+/**@{*/
+/**
+ * @brief   Single byte header of an option with delta @p delta and value
+ *          length @p len
+ */
+#define COAP_OPT_ENC_HDR(delta, len) \
+    (uint8_t)((((delta) << 4) | (len)) \
+              + 0 * sizeof(char[(((delta) < 13) && ((len) < 13)) ? 1 : -1]))
+
+/**
+ * @brief   Type of a pre-encoded option with the string value @p str
+ */
+#define COAP_OPT_ENC_STR_T(str) \
+    struct { uint8_t hdr; char value[sizeof(str) - 1]; }
+
+/**
+ * @brief   Initializer of a @ref COAP_OPT_ENC_STR_T option
+ *
+ * @param[in]   delta   option delta
+ * @param[in]   str     string literal, without the terminating zero
+ */
+#define COAP_OPT_ENC_STR(delta, str) \
+    { COAP_OPT_ENC_HDR(delta, sizeof(str) - 1), str }
+
+/**
+ * @brief   Type of a pre-encoded option without value
+ */
+#define COAP_OPT_ENC_EMPTY_T \
+    struct { uint8_t hdr; }
+
+/**
+ * @brief   Initializer of a @ref COAP_OPT_ENC_EMPTY_T option, also used for
+ *          unsigned integer options with the value 0
+ *
+ * @param[in]   delta   option delta
+ */
+#define COAP_OPT_ENC_EMPTY(delta) \
+    { COAP_OPT_ENC_HDR(delta, 0) }
+
+/**
+ * @brief   Type of a pre-encoded unsigned integer option from 1 to 255
+ */
+#define COAP_OPT_ENC_UINT8_T \
+    struct { uint8_t hdr; uint8_t value; }
+
+/**
+ * @brief   Initializer of a @ref COAP_OPT_ENC_UINT8_T option
+ *
+ * @param[in]   delta   option delta
+ * @param[in]   val     value of the option
+ */
+#define COAP_OPT_ENC_UINT8(delta, val) \
+    { COAP_OPT_ENC_HDR(delta, 1), (uint8_t)(val) }
+
+/**
+ * @brief   Type of a pre-encoded unsigned integer option from 256 to 65535
+ */
+#define COAP_OPT_ENC_UINT16_T \
+    struct { uint8_t hdr; uint8_t value[2]; }
+
+/**
+ * @brief   Initializer of a @ref COAP_OPT_ENC_UINT16_T option
+ *
+ * @param[in]   delta   option delta
+ * @param[in]   val     value of the option
+ */
+#define COAP_OPT_ENC_UINT16(delta, val) \
+    { COAP_OPT_ENC_HDR(delta, 2), { (uint8_t)((val) >> 8), (uint8_t)(val) } }
+/**@}*/
+
 /**
  * @name    Functions -- Messaging
  *
@@ -1951,6 +2056,48 @@ ssize_t coap_block2_build_reply(coap_pkt_t *pkt, unsigned code,
 ssize_t coap_build_hdr(coap_hdr_t *hdr, unsigned type, const void *token,
                        size_t token_len, unsigned code, uint16_t id);
 
+/**
+ * @brief   Message with fixed type, code and options
+ *
+ * See @ref coap_build_from_template().
+ */
+typedef struct {
+    const void *opts;       /**< encoded options, e.g. a struct of
+                                 @ref COAP_OPT_ENC_STR_T etc. */
+    uint16_t opts_len;      /**< length of coap_template_t::opts */
+    uint8_t type;           /**< message type, e.g. COAP_TYPE_NON */
+    uint8_t code;           /**< request method or response code */
+    bool payload;           /**< message has a payload */
+} coap_template_t;
+
+/**
+ * @brief   Builds a message from a template
+ *
+ * Writes the header and copies the pre-encoded options of @p tpl, followed by
+ * the payload marker if coap_template_t::payload is set. A message that only
+ * differs in token, message ID and payload each time, e.g. a periodic
+ * telemetry report, so needs no option encoding at runtime.
+ *
+ * The payload is to be written to coap_pkt_t::payload for up to
+ * coap_pkt_t::payload_len bytes after this call, just as after
+ * coap_opt_finish(). It must not be empty if coap_template_t::payload is set.
+ *
+ * @param[out]  pkt         packet to initialize
+ * @param[out]  buf         buffer for the message
+ * @param[in]   len         length of @p buf
+ * @param[in]   tpl         the template
+ * @param[in]   token       token
+ * @param[in]   token_len   length of @p token
+ * @param[in]   id          message ID
+ *
+ * @returns     length of the message without payload
+ * @returns     -ENOSPC if @p buf is too small
+ */
+ssize_t coap_build_from_template(coap_pkt_t *pkt, uint8_t *buf, size_t len,
+                                 const coap_template_t *tpl,
+                                 const void *token, size_t token_len,
+                                 uint16_t id);
+
 /**
  * @brief   Build reply to CoAP request
  *
@@ -2036,6 +2183,32 @@ ssize_t coap_tree_handler(coap_pkt_t *pkt, uint8_t *resp_buf,
                           const coap_resource_t *resources,
                           size_t resources_numof);
 
+/**
+ * @brief   Pass a coap request to a matching handler in resources sorted by
+ *          path
+ *
+ * Same as @ref coap_tree_handler(), but finds the handler with
+ * @ref coap_find_resource_sorted() in O(length of the URI path * log(number
+ * of resources)) instead of comparing the URI path with every resource.
+ *
+ * @pre The paths of @p resources are sorted in ascending order, as by
+ *      `strcmp()`.
+ *
+ * @param[in]   pkt             pointer to (parsed) CoAP packet
+ * @param[out]  resp_buf        buffer for response
+ * @param[in]   resp_buf_len    size of response buffer
+ * @param[in]   ctx             CoAP request context information
+ * @param[in]   resources       Array of coap endpoint resources, sorted by path
+ * @param[in]   resources_numof length of the coap endpoint resources
+ *
+ * @returns     size of the reply packet on success
+ * @returns     <0 on error
+ */
+ssize_t coap_sorted_tree_handler(coap_pkt_t *pkt, uint8_t *resp_buf,
+                                 unsigned resp_buf_len, coap_request_ctx_t *ctx,
+                                 const coap_resource_t *resources,
+                                 size_t resources_numof);
+
 /**
  * @brief   Generic coap subtree handler
  *
@@ -2056,6 +2229,28 @@ ssize_t coap_tree_handler(coap_pkt_t *pkt, uint8_t *resp_buf,
 ssize_t coap_subtree_handler(coap_pkt_t *pkt, uint8_t *resp_buf,
                              size_t resp_buf_len, coap_request_ctx_t *context);
 
+/**
+ * @brief   Generic coap subtree handler for resources sorted by path
+ *
+ * Same as @ref coap_subtree_handler(), but uses
+ * @ref coap_sorted_tree_handler().
+ *
+ * @note The @p context must be of type @ref coap_resource_subtree_t, with the
+ *       resources sorted by path in ascending order, as by `strcmp()`.
+ *
+ * @param[in]   pkt             pointer to (parsed) CoAP packet
+ * @param[out]  resp_buf        buffer for response
+ * @param[in]   resp_buf_len    size of response buffer
+ * @param[in]   context         pointer to request context, must contain context
+ *                              to @ref coap_resource_subtree_t instance
+ *
+ * @returns     size of the reply packet on success
+ * @returns     <0 on error
+ */
+ssize_t coap_sorted_subtree_handler(coap_pkt_t *pkt, uint8_t *resp_buf,
+                                    size_t resp_buf_len,
+                                    coap_request_ctx_t *context);
+
 /**
  * @brief   Convert message code (request method) into a corresponding bit field
  *
@@ -2247,6 +2442,32 @@ extern ssize_t coap_well_known_core_default_handler(coap_pkt_t *pkt, \
  */
 int coap_match_path(const coap_resource_t *resource, const uint8_t *uri);
 
+/**
+ * @brief   Finds the resource for a URI in resources sorted by path
+ *
+ * The result is the same as of checking every resource in order with
+ * @ref coap_match_path() and the method, but the range of candidates is
+ * narrowed down character by character of @p uri with a binary search.
+ *
+ * @pre The paths of @p resources are sorted in ascending order, as by
+ *      `strcmp()`.
+ *
+ * @param[in] resources         Resources to search
+ * @param[in] resources_numof   Number of @p resources
+ * @param[in] uri               Null-terminated URI path
+ * @param[in] method_flag       Method of the request, see
+ *                              @ref coap_method2flag()
+ * @param[out] resource         The first matching resource
+ *
+ * @return  0 if a resource was found
+ * @return  -EPERM if resources match @p uri, but none allows the method
+ * @return  -ENOENT if no resource matches @p uri
+ */
+int coap_find_resource_sorted(const coap_resource_t *resources,
+                              size_t resources_numof, const uint8_t *uri,
+                              coap_method_flags_t method_flag,
+                              const coap_resource_t **resource);
+
 #if defined(MODULE_GCOAP) || defined(DOXYGEN)
 /**
  * @name    Functions -- gcoap specific
@@ -11,6 +11,21 @@
  * @ingroup     net_nanocoap
  * @brief       A cache implementation for nanocoap response messages
  *
+ * The cached entries are indexed by a hash table over their cache keys and
+ * kept in a doubly-linked list in the order of their last use, so lookup,
+ * insertion, deletion and the LRU replacement take constant time regardless
+ * of @ref CONFIG_NANOCOAP_CACHE_ENTRIES.
+ *
+ * By default, the cache key is the SHA-256 digest of the options of a request
+ * (and the payload of a FETCH request), truncated to
+ * @ref CONFIG_NANOCOAP_CACHE_KEY_LENGTH bytes. With the pseudomodule
+ * `nanocoap_cache_siphash`, @ref sys_hashes_siphash with a random key chosen
+ * by nanocoap_cache_init() is used instead, which is a lot cheaper to
+ * calculate. As the key is secret, clients still cannot craft requests with
+ * colliding cache keys. The keys are only valid until the next call of
+ * nanocoap_cache_init() and @ref CONFIG_NANOCOAP_CACHE_KEY_LENGTH must not
+ * exceed 8 bytes then.
+ *
  * @{
  *
  * @file
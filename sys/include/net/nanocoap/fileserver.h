@@ -67,6 +67,20 @@
  *   If you want to support ``PUT`` and `DELETE`, you need to enable the modules
  *   ``nanocoap_fileserver_put`` and ``nanocoap_fileserver_delete``.
  *
+ * # Read-ahead
+ *
+ * Without further configuration, every Block2 request opens the file, seeks to
+ * the block and reads it. With ``USEMODULE += nanocoap_fileserver_readahead``
+ * a miss reads @ref CONFIG_NANOCOAP_FILESERVER_READAHEAD_SIZE bytes at once
+ * into a slot kept for the requesting client, and the following blocks of a
+ * sequential download are copied from there without touching the file system.
+ * Slots are validated by the ETag of the file, so a changed file is never
+ * served from a stale chunk. Any client's slot is used on a hit, which helps
+ * when several peers fetch the same file in lockstep.
+ *
+ * Every slot costs @ref CONFIG_NANOCOAP_FILESERVER_READAHEAD_SIZE bytes plus
+ * the path and the client's endpoint of RAM.
+ *
  * @{
  *
  * @file
@@ -84,6 +98,32 @@ extern "C" {
 
 #include "net/nanocoap.h"
 
+/**
+ * @defgroup net_nanocoap_fileserver_conf    CoAP file server compile time configuration
+ * @ingroup  config
+ * @{
+ */
+/**
+ * @brief   Number of clients for which a chunk of a file is read ahead
+ *
+ * Only used with the `nanocoap_fileserver_readahead` module.
+ */
+#ifndef CONFIG_NANOCOAP_FILESERVER_READAHEAD_NUMOF
+#define CONFIG_NANOCOAP_FILESERVER_READAHEAD_NUMOF  (2)
+#endif
+
+/**
+ * @brief   Size of the chunk that is read ahead per client
+ *
+ * Has to be larger than the block size to be of any use, blocks that do not
+ * fit are read from the file directly. Only used with the
+ * `nanocoap_fileserver_readahead` module.
+ */
+#ifndef CONFIG_NANOCOAP_FILESERVER_READAHEAD_SIZE
+#define CONFIG_NANOCOAP_FILESERVER_READAHEAD_SIZE   (4 * (1 << CONFIG_NANOCOAP_BLOCK_SIZE_EXP_MAX))
+#endif
+/** @} */
+
 /**
  * @brief   Randomly generated Etag, used by a client when a directory should only be
  *          deleted, if it is empty
@@ -0,0 +1,176 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_nanocoap
+ * @{
+ *
+ * @file
+ * @brief   Resource tables sorted by path at compile time for C++
+ *
+ * @ref coap_sorted_tree_handler() finds the resource of a request with a
+ * binary search, but needs the resources sorted by path. With
+ * riot::make_coap_resource_table() the compiler does the sorting, so the
+ * resources can be listed in any order and the table is still placed in
+ * ROM:
+ *
+ * @code{.cpp}
+ * static constexpr auto resources = riot::make_coap_resource_table({
+ *     { "/riot/board", COAP_GET, _board_handler, nullptr },
+ *     { "/echo/", COAP_GET | COAP_MATCH_SUBTREE, _echo_handler, nullptr },
+ *     { "/riot/ver", COAP_GET, _riot_ver_handler, nullptr },
+ * });
+ *
+ * ssize_t len = resources.handle(&pkt, buf, sizeof(buf), &ctx);
+ * @endcode
+ *
+ * Resources registered with @ref NANOCOAP_RESOURCE are placed by the linker
+ * and cannot be sorted this way. Instead, a whole table can be mounted with
+ * a single entry that uses @ref coap_sorted_subtree_handler() and
+ * riot::coap_resource_table::subtree() as context. Two resources with the
+ * same path and a common method are rejected at compile time, as the second
+ * one could never be reached.
+ *
+ * As the nanocoap headers use designated initializers, C++20 is required: add
+ * `CXXEXFLAGS += -std=c++20` to the Makefile of the application.
+ *
+ * @author  RIOT developers <devel@riot-os.org>
+ */
+
+#ifndef NET_NANOCOAP_RESOURCE_TABLE_HPP
+#define NET_NANOCOAP_RESOURCE_TABLE_HPP
+
+#include <cstddef>
+
+#include "net/nanocoap.h"
+
+namespace riot {
+
+/** @cond INTERNAL */
+namespace detail {
+
+/* same order as strcmp(), which coap_find_resource_sorted() relies on */
+constexpr int coap_path_cmp(const char* a, const char* b) {
+  while ((*a != '\0') && (*a == *b)) {
+    a++;
+    b++;
+  }
+  return static_cast<int>(static_cast<unsigned char>(*a))
+         - static_cast<int>(static_cast<unsigned char>(*b));
+}
+
+/* not constexpr: reaching it makes the constant evaluation fail */
+inline void coap_resource_unreachable() {}
+
+} // namespace detail
+/** @endcond */
+
+/**
+ * @brief Array of @p N CoAP resources, sorted by path
+ *
+ * Create it with riot::make_coap_resource_table() as `constexpr` variable, so
+ * the sorting happens at compile time.
+ *
+ * @tparam N    Number of resources
+ */
+template <std::size_t N>
+class coap_resource_table {
+public:
+  /**
+   * @brief Copy @p resources and sort them by path.
+   *
+   * The sort is stable, so resources with the same path keep their order.
+   */
+  constexpr explicit coap_resource_table(const coap_resource_t (&resources)[N])
+    : m_resources{} {
+    for (std::size_t i = 0; i < N; i++) {
+      std::size_t j = i;
+      while ((j > 0)
+             && (detail::coap_path_cmp(m_resources[j - 1].path,
+                                       resources[i].path) > 0)) {
+        m_resources[j] = m_resources[j - 1];
+        j--;
+      }
+      m_resources[j] = resources[i];
+    }
+    for (std::size_t i = 1; i < N; i++) {
+      if ((detail::coap_path_cmp(m_resources[i - 1].path,
+                                 m_resources[i].path) == 0)
+          && ((m_resources[i - 1].methods & m_resources[i].methods
+               & COAP_IGNORE) != 0)) {
+        detail::coap_resource_unreachable();
+      }
+    }
+  }
+
+  /**
+   * @brief Number of resources.
+   */
+  static constexpr std::size_t size() noexcept { return N; }
+  /**
+   * @brief The sorted resources.
+   */
+  constexpr const coap_resource_t* data() const noexcept {
+    return m_resources;
+  }
+  /**
+   * @brief Iterator to the first resource.
+   */
+  constexpr const coap_resource_t* begin() const noexcept {
+    return m_resources;
+  }
+  /**
+   * @brief Iterator behind the last resource.
+   */
+  constexpr const coap_resource_t* end() const noexcept {
+    return m_resources + N;
+  }
+  /**
+   * @brief Access the resource at @p i in sorted order.
+   */
+  constexpr const coap_resource_t& operator[](std::size_t i) const noexcept {
+    return m_resources[i];
+  }
+
+  /**
+   * @brief Subtree for use with @ref coap_sorted_subtree_handler().
+   */
+  constexpr coap_resource_subtree_t subtree() const noexcept {
+    return { m_resources, N };
+  }
+
+  /**
+   * @brief Pass a request to the handler of the matching resource.
+   *
+   * @see coap_sorted_tree_handler()
+   */
+  ssize_t handle(coap_pkt_t* pkt, uint8_t* resp_buf, unsigned resp_buf_len,
+                 coap_request_ctx_t* ctx) const {
+    return coap_sorted_tree_handler(pkt, resp_buf, resp_buf_len, ctx,
+                                    m_resources, N);
+  }
+
+private:
+  coap_resource_t m_resources[N];
+};
+
+/**
+ * @brief Create a riot::coap_resource_table from @p resources.
+ *
+ * Declare the result `constexpr` to have it sorted at compile time.
+ */
+template <std::size_t N>
+constexpr coap_resource_table<N>
+make_coap_resource_table(const coap_resource_t (&resources)[N]) {
+  return coap_resource_table<N>{ resources };
+}
+
+} // namespace riot
+
+#endif // NET_NANOCOAP_RESOURCE_TABLE_HPP
+/** @} */
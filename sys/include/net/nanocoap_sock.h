@@ -187,6 +187,24 @@ extern "C" {
 #define CONFIG_NANOCOAP_SOCK_BLOCK_TOKEN        (0)
 #endif
 
+/**
+ * @brief   Maximum number of Block2 requests kept in flight by
+ *          @ref nanocoap_sock_get_blockwise_window()
+ */
+#ifndef CONFIG_NANOCOAP_SOCK_BLOCK_WINDOW_MAX
+#define CONFIG_NANOCOAP_SOCK_BLOCK_WINDOW_MAX   (8)
+#endif
+
+/**
+ * @brief   Size of the reorder buffer needed by
+ *          @ref nanocoap_sock_get_blockwise_window()
+ *
+ * @param[in]   window  number of requests in flight
+ * @param[in]   blksize SZX of the requested blocks
+ */
+#define NANOCOAP_SOCK_BLOCK_WINDOW_BUF_SIZE(window, blksize) \
+    (((window) - 1) * coap_szx2size(blksize))
+
 /**
  * @brief   NanoCoAP socket types
  */
@@ -603,6 +621,49 @@ int nanocoap_sock_get_blockwise(nanocoap_sock_t *sock, const char *path,
                                 coap_blksize_t blksize,
                                 coap_blockwise_cb_t callback, void *arg);
 
+/**
+ * @brief    Performs a blockwise coap get request on a socket with several
+ *           requests in flight
+ *
+ * Like @ref nanocoap_sock_get_blockwise(), but instead of waiting for each
+ * block before requesting the next one, up to @p window Block2 requests are
+ * sent at a time. This takes about 1 / @p window of the time on paths with
+ * a long round-trip time, e.g. over several 6LoWPAN hops.
+ *
+ * Each request has its own message ID and token. Blocks that arrive out of
+ * order are kept in @p buf, so @p callback is called for the blocks in order,
+ * just as with @ref nanocoap_sock_get_blockwise(). Requests are repeated
+ * after the usual CoAP retransmission timeouts, for NON requests as well.
+ *
+ * The first block is requested on its own, as the server may answer with a
+ * smaller block size than @p blksize.
+ *
+ * @warning This exceeds the NSTART limit of 1 of RFC 7252. Only use it with
+ *          servers that are known to handle (or drop) concurrent requests.
+ *
+ * @param[in]   sock       socket to use for the request
+ * @param[in]   path       pointer to source path
+ * @param[in]   blksize    sender suggested SZX for the COAP block request
+ * @param[in]   window     number of requests in flight, at most
+ *                         @ref CONFIG_NANOCOAP_SOCK_BLOCK_WINDOW_MAX. 1 is
+ *                         the same as @ref nanocoap_sock_get_blockwise().
+ * @param[in]   type       @ref COAP_TYPE_CON or @ref COAP_TYPE_NON
+ * @param[in]   buf        reorder buffer of
+ *                         @ref NANOCOAP_SOCK_BLOCK_WINDOW_BUF_SIZE bytes,
+ *                         may be NULL if @p window is 1
+ * @param[in]   callback   callback to be executed on each received block
+ * @param[in]   arg        optional function arguments
+ *
+ * @returns      0         on success
+ * @returns     -ETIMEDOUT if a block was not received after all retries
+ * @returns     -EBADMSG   if a response did not match its request
+ * @returns     <0         error code of the response or of @p callback
+ */
+int nanocoap_sock_get_blockwise_window(nanocoap_sock_t *sock, const char *path,
+                                       coap_blksize_t blksize, unsigned window,
+                                       uint8_t type, void *buf,
+                                       coap_blockwise_cb_t callback, void *arg);
+
 /**
  * @brief    Performs a blockwise coap get request to the specified url, store
  *           the response in a buffer.
@@ -643,6 +704,31 @@ int nanocoap_get_blockwise_url(const char *url,
                                coap_blksize_t blksize,
                                coap_blockwise_cb_t callback, void *arg);
 
+/**
+ * @brief    Performs a blockwise coap get request to the specified url with
+ *           several requests in flight
+ *
+ * See @ref nanocoap_sock_get_blockwise_window().
+ *
+ * @param[in]   url        Absolute URL pointer to source path (i.e. not containing
+ *                         a fragment identifier)
+ * @param[in]   blksize    sender suggested SZX for the COAP block request
+ * @param[in]   window     number of requests in flight
+ * @param[in]   type       @ref COAP_TYPE_CON or @ref COAP_TYPE_NON
+ * @param[in]   buf        reorder buffer of
+ *                         @ref NANOCOAP_SOCK_BLOCK_WINDOW_BUF_SIZE bytes
+ * @param[in]   callback   callback to be executed on each received block
+ * @param[in]   arg        optional function arguments
+ *
+ * @returns     -EINVAL    if an invalid url is provided
+ * @returns     <0         if failed to fetch the url content
+ * @returns      0         on success
+ */
+int nanocoap_get_blockwise_window_url(const char *url,
+                                      coap_blksize_t blksize, unsigned window,
+                                      uint8_t type, void *buf,
+                                      coap_blockwise_cb_t callback, void *arg);
+
 /**
  * @brief    Performs a blockwise coap get request to the specified url, store
  *           the response in a buffer.
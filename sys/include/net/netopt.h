@@ -410,6 +410,9 @@ typedef enum {
      * A get operation expects a @ref netstats_t and will copy the current
      * statistics into it, atomically. A set operation resets the statistics
      * (zeros it out) regardless of the parameter given.
+     *
+     * Device drivers only fill in the fields they track themselves, such as
+     * @ref netstats_t::tx_ring_max, and leave the others untouched.
      */
     NETOPT_STATS,
 
@@ -871,6 +874,31 @@ typedef enum {
      */
     NETOPT_GTS_TX,
 
+    /**
+     * @brief   (@ref netopt_enable_t) device computes the transport layer
+     *          checksums of outgoing packets
+     *
+     * If enabled, the device fills in the UDP, TCP and ICMPv6 checksums of
+     * outgoing IP packets, so the network stack leaves them unset. Devices
+     * only do so for unfragmented packets.
+     *
+     * Support of this option is probed by the network stack when the interface
+     * is initialized.
+     */
+    NETOPT_TX_CSUM_OFFLOAD,
+
+    /**
+     * @brief   (@ref netopt_enable_t) device verifies the transport layer
+     *          checksums of incoming packets
+     *
+     * If enabled, the device drops incoming IP packets with an invalid UDP,
+     * TCP or ICMPv6 checksum, so the network stack does not verify them again.
+     *
+     * Support of this option is probed by the network stack when the interface
+     * is initialized.
+     */
+    NETOPT_RX_CSUM_OFFLOAD,
+
     /**
      * @brief   maximum number of options defined here.
      *
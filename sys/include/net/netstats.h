@@ -51,6 +51,7 @@ extern "C" {
 #define NETSTATS_LAYER2     (0x01)
 #define NETSTATS_IPV6       (0x02)
 #define NETSTATS_RPL        (0x03)
+#define NETSTATS_LATENCY    (0x04)
 #define NETSTATS_ALL        (0xFF)
 /** @} */
 
@@ -68,6 +69,17 @@ typedef struct {
     uint32_t tx_bytes;          /**< sent bytes */
     uint32_t rx_count;          /**< received (data) packets */
     uint32_t rx_bytes;          /**< received bytes */
+    uint32_t rx_dropped;        /**< received packets dropped for lack of
+                                     buffer space */
+    uint16_t tx_queue_len;      /**< frames in the send queue */
+    uint16_t tx_queue_max;      /**< most frames in the send queue at once */
+    uint32_t tx_bursts;         /**< times several queued frames were sent
+                                     back to back */
+    uint32_t tx_burst_frames;   /**< frames sent in those bursts */
+    uint16_t tx_ring_max;       /**< most TX DMA descriptors in use at once,
+                                     0 if not provided by the device */
+    uint16_t rx_ring_max;       /**< most filled RX DMA descriptors at once,
+                                     0 if not provided by the device */
 } netstats_t;
 
 /**
@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for
+ * more details.
+ */
+
+/**
+ * @defgroup    net_netstats_latency Receive latency statistics
+ * @ingroup     net_netstats
+ * @brief       Histograms of the time received packets take to reach each
+ *              layer of the network stack
+ *
+ * With the `netstats_latency` pseudo-module, every received packet is stamped
+ * when the network device signals the interrupt that led to its reception.
+ * When the packet reaches a layer of the network stack, the time elapsed since
+ * that stamp is counted in the histogram of that layer (see
+ * @ref netstats_latency_stage_t). The difference between the histograms of two
+ * consecutive layers is the time packets spend in between, mostly waiting in
+ * the message queue of the next thread.
+ *
+ * Bucket `i` of a histogram counts packets that took less than `2^(i + 1)` µs
+ * but at least `2^i` µs (bucket 0 includes 0 µs). The last bucket also counts
+ * all slower packets.
+ *
+ * The histograms are provided per interface through @ref NETOPT_STATS with the
+ * context @ref NETSTATS_LATENCY and printed by `ifconfig <if> stats latency`.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Receive latency statistics definitions
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ */
+#ifndef NET_NETSTATS_LATENCY_H
+#define NET_NETSTATS_LATENCY_H
+
+#include <stdint.h>
+
+#include "bitarithm.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of buckets of each histogram
+ */
+#ifndef CONFIG_NETSTATS_LATENCY_BUCKETS
+#define CONFIG_NETSTATS_LATENCY_BUCKETS     (16U)
+#endif
+
+/**
+ * @brief   Points of the network stack at which the latency is recorded
+ */
+typedef enum {
+    NETSTATS_LATENCY_NETIF,     /**< frame read from the device */
+    NETSTATS_LATENCY_6LO,       /**< received by 6LoWPAN */
+    NETSTATS_LATENCY_IPV6,      /**< received by IPv6 */
+    NETSTATS_LATENCY_TRANSPORT, /**< received by UDP */
+    NETSTATS_LATENCY_SOCK,      /**< taken from the sock by the application */
+    NETSTATS_LATENCY_STAGES,    /**< number of stages */
+} netstats_latency_stage_t;
+
+/**
+ * @brief   Receive latency histograms
+ */
+typedef struct {
+    /**
+     * @brief   Packets per stage and bucket
+     */
+    uint32_t hist[NETSTATS_LATENCY_STAGES][CONFIG_NETSTATS_LATENCY_BUCKETS];
+    uint32_t max[NETSTATS_LATENCY_STAGES];  /**< slowest packet per stage in µs */
+} netstats_latency_t;
+
+/**
+ * @brief   Counts a packet in the histogram of a stage
+ *
+ * @note    Callers have to make sure that @p stats is not accessed
+ *          concurrently.
+ *
+ * @param[in,out] stats     Latency histograms
+ * @param[in]     stage     Stage the packet reached
+ * @param[in]     usec      Time since the packet was stamped in µs
+ */
+static inline void netstats_latency_add(netstats_latency_t *stats,
+                                        netstats_latency_stage_t stage,
+                                        uint32_t usec)
+{
+    unsigned bucket = (usec > 1) ? bitarithm_msb(usec) : 0;
+
+    if (bucket >= CONFIG_NETSTATS_LATENCY_BUCKETS) {
+        bucket = CONFIG_NETSTATS_LATENCY_BUCKETS - 1;
+    }
+    stats->hist[stage][bucket]++;
+    if (usec > stats->max[stage]) {
+        stats->max[stage] = usec;
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_NETSTATS_LATENCY_H */
+/** @} */
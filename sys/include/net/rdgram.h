@@ -0,0 +1,258 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_rdgram  Reliable datagram sender
+ * @ingroup     net
+ * @brief       Window-based reliable transfer of a sequence of datagrams,
+ *              driven by @ref sys_congure
+ *
+ * Protocols that need a sequence of datagrams to arrive, e.g. the blocks of a
+ * firmware image or a log, usually send one datagram and wait for its
+ * acknowledgment (stop-and-wait). On paths with a long round-trip time this
+ * leaves most of the capacity unused. This module keeps several datagrams in
+ * flight instead. How many is decided by a @ref sys_congure implementation,
+ * e.g. @ref sys_congure_reno or @ref sys_congure_quic, which also paces the
+ * datagrams if it supports pacing.
+ *
+ * The module does no I/O and knows no packet format. The protocol using it
+ * (the caller):
+ * - sends datagram `seq` with the sequence number in it when the
+ *   @ref rdgram_send_t callback is called,
+ * - calls @ref rdgram_ack() for every received acknowledgment, which
+ *   carries the cumulative sequence number and a selective acknowledgment
+ *   (SACK) bitmap, see @ref rdgram_rcv_t for the receiving side, and
+ * - calls @ref rdgram_poll() after that and when the time returned by the
+ *   last call has passed, to (re-)transmit datagrams.
+ *
+ * A datagram is retransmitted when its acknowledgment timed out (with a
+ * retransmission timeout as in [RFC 6298](https://tools.ietf.org/html/rfc6298))
+ * or when @ref CONFIG_RDGRAM_REORDER_THRESH later datagrams were acknowledged
+ * before it. The caller has to keep the payload of unacknowledged datagrams
+ * to be able to send them again.
+ *
+ * All times are in milliseconds, e.g. from `ztimer_now(ZTIMER_MSEC)`. Pacing
+ * intervals below a millisecond are ignored.
+ *
+ * @note    @ref sys_congure_reno requires congure_reno_snd_consts_t::fr to
+ *          be set. Retransmissions are done by this module, so a function
+ *          that does nothing is sufficient.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Reliable datagram sender definitions
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ */
+#ifndef NET_RDGRAM_H
+#define NET_RDGRAM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "congure.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup net_rdgram_conf    Reliable datagram sender compile configurations
+ * @ingroup  config
+ * @{
+ */
+/**
+ * @brief   Initial retransmission timeout in milliseconds
+ */
+#ifndef CONFIG_RDGRAM_RTO_INIT_MS
+#define CONFIG_RDGRAM_RTO_INIT_MS       (1000U)
+#endif
+
+/**
+ * @brief   Lower bound of the retransmission timeout in milliseconds
+ */
+#ifndef CONFIG_RDGRAM_RTO_MIN_MS
+#define CONFIG_RDGRAM_RTO_MIN_MS        (200U)
+#endif
+
+/**
+ * @brief   Upper bound of the retransmission timeout in milliseconds
+ */
+#ifndef CONFIG_RDGRAM_RTO_MAX_MS
+#define CONFIG_RDGRAM_RTO_MAX_MS        (60000U)
+#endif
+
+/**
+ * @brief   Number of datagrams sent after a datagram that have to be
+ *          acknowledged for it to be considered lost
+ */
+#ifndef CONFIG_RDGRAM_REORDER_THRESH
+#define CONFIG_RDGRAM_REORDER_THRESH    (3U)
+#endif
+/** @} */
+
+/**
+ * @brief   Maximum number of datagrams in flight, given by the width of the
+ *          SACK bitmap
+ */
+#define RDGRAM_WND_MAX                  (32U)
+
+/**
+ * @brief   Returned by @ref rdgram_poll() when there is nothing to wait for
+ */
+#define RDGRAM_NO_TIMEOUT               (UINT32_MAX)
+
+/**
+ * @brief   State of a datagram in flight
+ */
+typedef struct {
+    congure_snd_msg_t super;    /**< see @ref congure_snd_msg_t */
+    uint32_t seq;               /**< sequence number */
+} rdgram_msg_t;
+
+/**
+ * @brief   Forward declaration of the sender
+ */
+typedef struct rdgram rdgram_t;
+
+/**
+ * @brief   (Re-)transmits a datagram
+ *
+ * @param[in] rd    The sender.
+ * @param[in] seq   Sequence number of the datagram.
+ * @param[in] arg   Argument given to @ref rdgram_init().
+ *
+ * @return  Size of the datagram in the unit of the congestion control
+ *          (e.g. bytes) on success.
+ * @return  Negative number if the datagram could not be sent. It is then
+ *          treated as sent and lost.
+ */
+typedef int (*rdgram_send_t)(rdgram_t *rd, uint32_t seq, void *arg);
+
+/**
+ * @brief   Reliable datagram sender
+ *
+ * @note    All members are internal.
+ */
+struct rdgram {
+    congure_snd_t *cong;        /**< congestion control */
+    rdgram_send_t send;         /**< transmit callback */
+    void *arg;                  /**< argument of rdgram_t::send */
+    rdgram_msg_t *msgs;         /**< datagrams in flight */
+    uint32_t acked;             /**< bit i: datagram base + i acknowledged */
+    uint32_t lost;              /**< bit i: datagram base + i to retransmit */
+    uint32_t base;              /**< oldest unacknowledged datagram */
+    uint32_t next;              /**< next datagram to send the first time */
+    uint32_t num;               /**< number of datagrams to send */
+    uint32_t acks;              /**< ACK IDs reported to rdgram_t::cong */
+    uint32_t last_tx;           /**< time the last new datagram was sent */
+    uint32_t pace;              /**< interval between new datagrams */
+    uint32_t srtt;              /**< smoothed round-trip time */
+    uint32_t rttvar;            /**< round-trip time variation */
+    uint32_t rto;               /**< retransmission timeout */
+    unsigned in_flight;         /**< size of the datagrams in flight */
+    uint16_t msg_size;          /**< maximum size of a datagram */
+    uint8_t msgs_numof;         /**< number of rdgram_t::msgs */
+};
+
+/**
+ * @brief   Receiving side: sequence numbers received so far
+ *
+ * The content of this structure is what the receiver acknowledges with every
+ * datagram: all datagrams before rdgram_rcv_t::next were received, and bit
+ * `i` of rdgram_rcv_t::sack is set if datagram `next + 1 + i` was received.
+ * Initialize with 0.
+ */
+typedef struct {
+    uint32_t next;              /**< next expected sequence number */
+    uint32_t sack;              /**< datagrams received after it */
+} rdgram_rcv_t;
+
+/**
+ * @brief   Initializes a sender for a transfer
+ *
+ * @pre @p cong was set up and initialized with congure_snd_driver_t::init.
+ * @pre `0 < msgs_numof <= RDGRAM_WND_MAX`
+ *
+ * @param[out] rd       The sender.
+ * @param[in] cong      The congestion control to use.
+ * @param[in] msgs      Memory for @p msgs_numof datagrams in flight.
+ * @param[in] msgs_numof Maximum number of datagrams in flight.
+ * @param[in] num       Number of datagrams to send, with sequence numbers
+ *                      from 0 to @p num - 1.
+ * @param[in] msg_size  Maximum size of a datagram in the unit of @p cong.
+ * @param[in] send      Transmit callback.
+ * @param[in] arg       Argument of @p send.
+ */
+void rdgram_init(rdgram_t *rd, congure_snd_t *cong, rdgram_msg_t *msgs,
+                 unsigned msgs_numof, uint32_t num, uint16_t msg_size,
+                 rdgram_send_t send, void *arg);
+
+/**
+ * @brief   (Re-)transmits the datagrams that are due
+ *
+ * Retransmits lost datagrams and datagrams whose acknowledgment timed out
+ * first, then sends new datagrams, as far as the congestion window and pacing
+ * allow.
+ *
+ * @param[in] rd    The sender.
+ * @param[in] now   The current time.
+ *
+ * @return  Milliseconds until rdgram_poll() has to be called again at the
+ *          latest if no acknowledgment arrives.
+ * @return  @ref RDGRAM_NO_TIMEOUT if all datagrams were acknowledged.
+ */
+uint32_t rdgram_poll(rdgram_t *rd, uint32_t now);
+
+/**
+ * @brief   Handles an acknowledgment
+ *
+ * Datagrams considered lost are retransmitted by the next call of
+ * rdgram_poll().
+ *
+ * @param[in] rd    The sender.
+ * @param[in] next  Sequence number of the first datagram not received by
+ *                  the peer, see rdgram_rcv_t::next.
+ * @param[in] sack  Datagrams received after @p next, see
+ *                  rdgram_rcv_t::sack.
+ * @param[in] now   The current time.
+ */
+void rdgram_ack(rdgram_t *rd, uint32_t next, uint32_t sack, uint32_t now);
+
+/**
+ * @brief   Checks if all datagrams were acknowledged
+ *
+ * @param[in] rd    The sender.
+ *
+ * @return  true, if the transfer is complete.
+ */
+static inline bool rdgram_done(const rdgram_t *rd)
+{
+    return rd->base == rd->num;
+}
+
+/**
+ * @brief   Records a received datagram
+ *
+ * @param[in,out] rcv   Receiver state.
+ * @param[in] seq       Sequence number of the received datagram.
+ *
+ * @return  1, if the datagram is new.
+ * @return  0, if the datagram was received before.
+ * @return  -1, if @p seq is too far ahead of rdgram_rcv_t::next to be
+ *          recorded. The datagram should be dropped.
+ */
+int rdgram_rcv(rdgram_rcv_t *rcv, uint32_t seq);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_RDGRAM_H */
+/** @} */
@@ -145,6 +145,15 @@ extern "C" {
  */
 #define SOCK_FLAGS_REUSE_EP         (0x0001)    /**< allow to reuse end point on bind */
 #define SOCK_FLAGS_CONNECT_REMOTE   (0x0002)    /**< restrict responses to remote address */
+/**
+ * @brief   Share the end point with other socks that set this flag and
+ *          distribute received datagrams among them by flow
+ *
+ * Implies @ref SOCK_FLAGS_REUSE_EP. With GNRC this requires the module
+ * `gnrc_sock_udp_reuse_port`, other stacks and GNRC without that module
+ * treat it like @ref SOCK_FLAGS_REUSE_EP.
+ */
+#define SOCK_FLAGS_REUSE_PORT       (0x0004 | SOCK_FLAGS_REUSE_EP)
 /** @} */
 
 /**
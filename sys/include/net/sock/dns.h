@@ -93,6 +93,10 @@ extern "C" {
  * This function will return the first DNS record it receives. IF both A and
  * AAAA are requested, AAAA will be preferred.
  *
+ * Queries are sent one at a time. With the `dns_cache` module, a thread
+ * that asks for a name while another thread is resolving it waits for that
+ * query and gets its result from the cache instead of sending its own.
+ *
  * @note @p addr_out needs to provide space for any possible result!
  *       (4byte when family==AF_INET, 16byte otherwise)
  *
@@ -564,6 +564,8 @@ static inline ssize_t sock_udp_recv(sock_udp_t *sock,
  *
  * @note    Function blocks if no packet is currently waiting.
  *
+ * @see     @ref sock_udp_buf_release() to end the lease of the buffer early.
+ *
  * @return  The number of bytes received on success. May not be the complete
  *          payload. Continue calling with the returned `buf_ctx` to get more
  *          buffers until result is 0 or an error.
@@ -610,6 +612,8 @@ ssize_t sock_udp_recv_buf_aux(sock_udp_t *sock, void **data, void **buf_ctx,
  *
  * @note    Function blocks if no packet is currently waiting.
  *
+ * @see     @ref sock_udp_buf_release() to end the lease of the buffer early.
+ *
  * @return  The number of bytes received on success. May not be the complete
  *          payload. Continue calling with the returned `buf_ctx` to get more
  *          buffers until result is 0 or an error.
@@ -632,6 +636,29 @@ static inline ssize_t sock_udp_recv_buf(sock_udp_t *sock,
     return sock_udp_recv_buf_aux(sock, data, buf_ctx, timeout, remote, NULL);
 }
 
+/**
+ * @brief   Releases a stack-internal buffer provided by
+ *          @ref sock_udp_recv_buf_aux()
+ *
+ * A buffer provided by @ref sock_udp_recv_buf_aux() is leased to the
+ * application until its context is either released with this function or
+ * passed to @ref sock_udp_recv_buf_aux() again until it returns 0. Leases of
+ * different contexts are independent of each other, so an application may
+ * hold several received packets at once, e.g. to forward their payload
+ * without copying it, and release them in any order.
+ *
+ * @pre `(sock != NULL)`
+ *
+ * @param[in] sock      The UDP sock object @p buf_ctx was received on.
+ * @param[in] buf_ctx   Stack-internal buffer context as returned by
+ *                      @ref sock_udp_recv_buf_aux(). May be `NULL`.
+ *
+ * @experimental    This function is quite new, not implemented for all stacks
+ *                  yet, and may be subject to sudden API changes. Do not use in
+ *                  production if this is unacceptable.
+ */
+void sock_udp_buf_release(sock_udp_t *sock, void *buf_ctx);
+
 /**
  * @brief   Sends a UDP message to remote end point with non-continous payload
  *
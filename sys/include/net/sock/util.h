@@ -274,6 +274,60 @@ static inline bool sock_udp_ep_equal(const sock_udp_ep_t *a,
     return sock_tl_ep_equal(a, b);
 }
 
+#if defined(MODULE_SOCK_UDP) || DOXYGEN
+/**
+ * @brief   A UDP datagram of a batch
+ */
+typedef struct {
+    void *data;             /**< Payload to send, or buffer to receive into */
+    size_t len;             /**< Length of the payload to send, or size of the
+                             *   buffer on input and length of the received
+                             *   payload on output of sock_udp_recv_batch() */
+    sock_udp_ep_t *remote;  /**< Remote end point, may be NULL */
+} sock_udp_msg_t;
+
+/**
+ * @brief   Receives up to @p num UDP datagrams at once
+ *
+ * Only the first datagram is waited for with @p timeout. The following ones
+ * are taken without blocking, as long as the stack has datagrams queued for
+ * @p sock. This saves the timer and the possible context switch of a
+ * sock_udp_recv() call for every datagram.
+ *
+ * @pre `(sock != NULL) && (msgs != NULL) && (num > 0)`
+ *
+ * @param[in] sock      A UDP sock object.
+ * @param[in,out] msgs  Buffers for the datagrams, see @ref sock_udp_msg_t.
+ * @param[in] num       Number of entries in @p msgs.
+ * @param[in] timeout   Timeout for the first datagram in microseconds, see
+ *                      sock_udp_recv().
+ *
+ * @note    A queued datagram that does not fit into its buffer ends the batch
+ *          and is dropped, unless it is the first one.
+ *
+ * @return  The number of datagrams received.
+ * @return  The errors of sock_udp_recv(), if the first datagram failed.
+ */
+int sock_udp_recv_batch(sock_udp_t *sock, sock_udp_msg_t *msgs, unsigned num,
+                        uint32_t timeout);
+
+/**
+ * @brief   Sends up to @p num UDP datagrams at once
+ *
+ * @pre `(sock != NULL) && (msgs != NULL) && (num > 0)`
+ *
+ * @param[in] sock      A UDP sock object.
+ * @param[in] msgs      The datagrams, see @ref sock_udp_msg_t.
+ * @param[in] num       Number of entries in @p msgs.
+ *
+ * @return  The number of datagrams sent. Sending stops at the first failing
+ *          datagram.
+ * @return  The errors of sock_udp_send(), if the first datagram failed.
+ */
+int sock_udp_send_batch(sock_udp_t *sock, const sock_udp_msg_t *msgs,
+                        unsigned num);
+#endif
+
 #if defined(MODULE_SOCK_DTLS) || DOXYGEN
 /**
  * @brief   Helper function to establish a DTLS connection
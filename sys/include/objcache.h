@@ -0,0 +1,219 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_objcache Object caches
+ * @ingroup     sys_memory_management
+ * @brief       Caches of equally sized objects on top of @ref sys_memarray
+ *
+ * An object cache hands out objects of one size and alignment from a
+ * fixed number of slots. Allocating and freeing pops and pushes a free list
+ * with interrupts disabled for a few instructions, so both run in constant
+ * time, can be used from interrupt context, and never fragment memory.
+ *
+ * The storage of a cache is either provided by the caller
+ * (@ref objcache_init(), e.g. a static buffer of @ref OBJCACHE_BUF_SIZE
+ * bytes) or allocated in one piece from the heap (@ref objcache_create()).
+ * Once all objects are returned, @ref objcache_destroy() gives the memory
+ * back, e.g. when a subsystem shuts down.
+ *
+ * Optionally, a constructor is called on every object handed out and a
+ * destructor on every object returned to the cache. With
+ * @ref CONFIG_OBJCACHE_POISON, returned objects are overwritten with a
+ * pattern that is checked on the next allocation, catching writes to
+ * objects after they were freed.
+ *
+ * All caches are listed with their usage by @ref objcache_stats(), which
+ * is available as shell command `objcache` with `shell_cmd_objcache`.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Object cache API
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ */
+
+#ifndef OBJCACHE_H
+#define OBJCACHE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "memarray.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Poison objects while they are in the cache
+ *
+ * If set to 1, freed objects are filled with @ref OBJCACHE_POISON_BYTE and
+ * the pattern is verified when the object is allocated again. This costs
+ * two passes over the object per allocation.
+ */
+#ifndef CONFIG_OBJCACHE_POISON
+#define CONFIG_OBJCACHE_POISON  0
+#endif
+
+/**
+ * @brief   Pattern freed objects are filled with if
+ *          @ref CONFIG_OBJCACHE_POISON is set
+ */
+#define OBJCACHE_POISON_BYTE    (0x6b)
+
+/**
+ * @brief   Distance between two objects of @p size bytes with alignment
+ *          @p align in a cache
+ *
+ * @p align must be a power of two. Each slot holds at least a pointer.
+ */
+#define OBJCACHE_STRIDE(size, align) \
+    (((((size) > sizeof(void *)) ? (size) : sizeof(void *)) + \
+      (((align) > sizeof(void *)) ? (align) : sizeof(void *)) - 1) & \
+     ~((((align) > sizeof(void *)) ? (align) : sizeof(void *)) - 1))
+
+/**
+ * @brief   Size of the buffer needed by @ref objcache_init()
+ */
+#define OBJCACHE_BUF_SIZE(size, align, count) \
+    (OBJCACHE_STRIDE(size, align) * (count))
+
+/**
+ * @brief   Object constructor and destructor signature
+ *
+ * @param[in]   obj     the object
+ * @param[in]   arg     @ref objcache_params_t::arg
+ */
+typedef void (*objcache_cb_t)(void *obj, void *arg);
+
+/**
+ * @brief   Optional parameters of an object cache
+ */
+typedef struct {
+    const char *name;       /**< name shown by @ref objcache_stats() */
+    objcache_cb_t ctor;     /**< called on every allocated object, may be NULL */
+    objcache_cb_t dtor;     /**< called on every freed object, may be NULL */
+    void *arg;              /**< argument passed to @p ctor and @p dtor */
+} objcache_params_t;
+
+/**
+ * @brief   Object cache
+ *
+ * @note    The fields are internal, use the functions below.
+ */
+typedef struct objcache {
+    memarray_t free;                /**< free objects */
+    struct objcache *next;          /**< next cache in the list of all caches */
+    const objcache_params_t *params;/**< parameters, may be NULL */
+    uint8_t *data;                  /**< storage of the objects */
+    size_t obj_size;                /**< requested size of an object */
+    uint16_t count;                 /**< number of objects */
+    uint16_t used;                  /**< number of allocated objects */
+    uint16_t used_max;              /**< maximum of @p used */
+    uint16_t fails;                 /**< number of failed allocations */
+    bool allocated;                 /**< cache was created on the heap */
+} objcache_t;
+
+/**
+ * @brief   Initialize an object cache in caller provided memory
+ *
+ * @pre     @p align is a power of two and @p buf is aligned to it
+ * @pre     @p buf holds @ref OBJCACHE_BUF_SIZE(@p size, @p align, @p count)
+ *          bytes
+ * @pre     `0 < count <= UINT16_MAX`
+ *
+ * @param[out]  cache   cache to initialize
+ * @param[in]   buf     storage of the objects
+ * @param[in]   size    size of an object in bytes
+ * @param[in]   align   alignment of an object in bytes
+ * @param[in]   count   number of objects
+ * @param[in]   params  optional parameters, must stay valid while the
+ *                      cache is in use, may be NULL
+ */
+void objcache_init(objcache_t *cache, void *buf, size_t size, size_t align,
+                   size_t count, const objcache_params_t *params);
+
+/**
+ * @brief   Create an object cache on the heap
+ *
+ * The cache and its objects are allocated with a single call to malloc().
+ *
+ * @pre     @p align is a power of two
+ * @pre     `0 < count <= UINT16_MAX`
+ *
+ * @param[in]   size    size of an object in bytes
+ * @param[in]   align   alignment of an object in bytes
+ * @param[in]   count   number of objects
+ * @param[in]   params  optional parameters, must stay valid while the
+ *                      cache is in use, may be NULL
+ *
+ * @return  the new cache
+ * @retval  NULL if the heap is exhausted
+ */
+objcache_t *objcache_create(size_t size, size_t align, size_t count,
+                            const objcache_params_t *params);
+
+/**
+ * @brief   Destroy an object cache
+ *
+ * Removes the cache from the list of caches. If it was created with
+ * @ref objcache_create(), its memory is freed.
+ *
+ * @param[in]   cache   cache to destroy
+ *
+ * @retval  0       success
+ * @retval  -EBUSY  objects of the cache are still allocated
+ */
+int objcache_destroy(objcache_t *cache);
+
+/**
+ * @brief   Allocate an object
+ *
+ * @param[in]   cache   cache to allocate from
+ *
+ * @return  the object, passed to the constructor if there is one
+ * @retval  NULL if all objects are in use
+ */
+void *objcache_alloc(objcache_t *cache);
+
+/**
+ * @brief   Return an object to its cache
+ *
+ * @pre     @p obj was allocated from @p cache and is not yet freed
+ *
+ * @param[in]   cache   cache @p obj was allocated from
+ * @param[in]   obj     object to free, may be NULL
+ */
+void objcache_free(objcache_t *cache, void *obj);
+
+/**
+ * @brief   Get the number of free objects of a cache
+ *
+ * @param[in]   cache   the cache
+ *
+ * @return  number of objects that can be allocated
+ */
+static inline size_t objcache_available(const objcache_t *cache)
+{
+    return cache->count - cache->used;
+}
+
+/**
+ * @brief   Print the usage of all object caches
+ */
+void objcache_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OBJCACHE_H */
+/** @} */
@@ -26,6 +26,36 @@
  *
  * In order to use this module, you'll need to implement pm_set().
  *
+ * Tickless idle
+ * -------------
+ *
+ * With the module `pm_layered_tickless`, @ref pm_set_lowest additionally
+ * takes the time until the next timer on `ZTIMER_USEC` and `ZTIMER_MSEC`
+ * expires into account: A mode is only entered if its wakeup latency (given
+ * by @ref PM_WAKEUP_LATENCY_US) is shorter than that time. This avoids
+ * entering deep sleep modes just to be woken up by a timer before the CPU
+ * has settled in that mode, and missing the deadline due to the wakeup
+ * latency.
+ *
+ * Blockers of threads
+ * -------------------
+ *
+ * With the module `pm_layered_thread`, a thread can block a mode with
+ * @ref pm_thread_block for the duration of an operation. These blockers are
+ * owned by the thread: each thread holds a mode at most once, no matter how
+ * often it blocks it, and they are released when the thread exits, so a
+ * thread that ends early (or is killed) cannot keep the system out of the
+ * lower modes for ever.
+ *
+ * A thread can not simply block a mode only while it is running: the idle
+ * thread enters a power mode only when no other thread is runnable, so a
+ * blocker must stay in place while the thread waits for the interrupt that
+ * ends its operation. The time spent in each mode is best compared by
+ * measuring the average supply current of the board over a fixed period
+ * (e.g. with a shunt and an oscilloscope or a power profiler) while the
+ * application runs its usual workload, once with and once without the
+ * blocker.
+ *
  * @file
  * @brief       Layered low power mode infrastructure
  *
@@ -51,6 +81,17 @@ extern "C" {
 #define PROVIDES_PM_SET_LOWEST
 #endif
 
+#if defined(DOXYGEN)
+/**
+ * @brief   Wakeup latency in microseconds for each power mode, starting with
+ *          mode 0
+ *
+ * Used by module `pm_layered_tickless` only. This should be provided by the
+ * CPU (or board), the default assumes no wakeup latency for any mode.
+ */
+#define PM_WAKEUP_LATENCY_US    { 0 }
+#endif
+
 /**
  * @brief Power Management mode blocker typedef
  */
@@ -80,6 +121,26 @@ void pm_unblock(unsigned mode);
 static inline void pm_unblock(unsigned mode) { (void)mode; }
 #endif
 
+#if defined(MODULE_PM_LAYERED_THREAD) || defined(DOXYGEN)
+/**
+ * @brief   Block a power mode on behalf of the calling thread
+ *
+ * Blocking a mode that the thread already blocks has no effect.
+ *
+ * @param[in]   mode      power mode to block
+ */
+void pm_thread_block(unsigned mode);
+
+/**
+ * @brief   Release a power mode blocked by the calling thread
+ *
+ * Unblocking a mode that the thread does not block has no effect.
+ *
+ * @param[in]   mode      power mode to unblock
+ */
+void pm_thread_unblock(unsigned mode);
+#endif
+
 /**
  * @brief   Switches the MCU to a new power mode
  *
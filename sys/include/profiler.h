@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_profiler Sampling profiler
+ * @ingroup     sys
+ * @brief       Statistical CPU profiler
+ *
+ * While running, the profiler periodically samples the program counter of the
+ * interrupted code along with the pid of the running thread from a timer
+ * interrupt. Samples are counted in a hash table of
+ * @ref CONFIG_PROFILER_NUMOF entries, samples that do not fit into the table
+ * anymore are only counted as dropped.
+ *
+ * Samples taken while the timer interrupt preempted another interrupt are
+ * recorded with pc 0 and @ref KERNEL_PID_ISR, on platforms where this can be
+ * detected. Time spent with interrupts disabled is attributed to the code that
+ * re-enables them.
+ *
+ * profiler_dump() prints the table as text:
+ *
+ *     prof-begin <period_us> <samples> <dropped>
+ *     prof 0x<pc> <count> <pid> <thread name>
+ *     ...
+ *     prof-end
+ *
+ * `dist/tools/profiler/profiler2folded.py` symbolizes such a dump using the ELF
+ * file of the application and produces the folded stack format used by
+ * flamegraph.pl, inferno or speedscope. As there is no stack unwinding, the
+ * "stack" consists of the thread and the function (including inlined
+ * functions) the sample hit.
+ *
+ * The profiler can also be controlled with the `profiler` shell command.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Sampling profiler API
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of distinct (pc, pid) pairs that can be counted
+ *
+ * Must be a power of two.
+ */
+#ifndef CONFIG_PROFILER_NUMOF
+#define CONFIG_PROFILER_NUMOF           (256)
+#endif
+
+/**
+ * @brief   Default sampling period in microseconds
+ */
+#ifndef CONFIG_PROFILER_PERIOD_US
+#define CONFIG_PROFILER_PERIOD_US       (1000)
+#endif
+
+/**
+ * @brief   Start sampling
+ *
+ * Samples are added to the ones taken before, see profiler_reset().
+ *
+ * @param[in]   period_us   sampling period in microseconds, 0 for
+ *                          @ref CONFIG_PROFILER_PERIOD_US
+ */
+void profiler_start(uint32_t period_us);
+
+/**
+ * @brief   Stop sampling
+ */
+void profiler_stop(void);
+
+/**
+ * @brief   Discard all samples
+ */
+void profiler_reset(void);
+
+/**
+ * @brief   Print all samples
+ */
+void profiler_dump(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PROFILER_H */
+/** @} */
@@ -31,6 +31,14 @@ extern "C" {
  */
 void ps(void);
 
+/**
+ * @brief Print the CPU utilization of all active threads in the last
+ *        window of module `schedstatistics` to stdout.
+ *
+ * @note  Only available with module `schedstatistics`
+ */
+void ps_window(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -4017,6 +4017,43 @@ psa_status_t psa_verify_hash(psa_key_id_t key,
                              const uint8_t *signature,
                              size_t signature_length);
 
+/**
+ * @brief   Verify a batch of hash signatures made with the same key.
+ *
+ * @details This is an extension of the PSA Crypto API. It is equivalent to
+ *          calling @ref psa_verify_hash() for every pair of @p hashes and
+ *          @p signatures, but looks up the key and checks its policy only once.
+ *          Use it when many signatures of a few known keys need to be checked,
+ *          e.g. when verifying a manifest with several signatures.
+ *
+ *          All signatures are verified, even if one of them is invalid.
+ *
+ * @param key               Identifier of the key to use for the operation. The key must allow
+ *                          the usage @ref PSA_KEY_USAGE_VERIFY_HASH.
+ * @param alg               An ECDSA algorithm that separates the hash and sign operations.
+ * @param hashes            Array of @p count hashes, each of size @p hash_length.
+ * @param hash_length       Size of each hash in bytes.
+ * @param signatures        Array of @p count signatures, each of size @p signature_length.
+ * @param signature_length  Size of each signature in bytes.
+ * @param count             Number of hash and signature pairs.
+ * @param results           Array of @p count entries receiving the result of each
+ *                          verification, may be NULL.
+ *
+ * @return  @ref PSA_SUCCESS                    All signatures are valid.
+ * @return  @ref PSA_ERROR_INVALID_SIGNATURE    At least one signature is invalid, see @p results
+ *                                              for which.
+ * @return  Any other error code of @ref psa_verify_hash(), either for the whole batch or
+ *          for the first signature that failed.
+ */
+psa_status_t psa_verify_hash_batch(psa_key_id_t key,
+                                   psa_algorithm_t alg,
+                                   const uint8_t *const *hashes,
+                                   size_t hash_length,
+                                   const uint8_t *const *signatures,
+                                   size_t signature_length,
+                                   size_t count,
+                                   psa_status_t *results);
+
 /**
  * @brief   Verify the signature of a message with a public key. For hash-and-sign algorithms,
  *          this includes the hashing step.
@@ -50,6 +50,12 @@
  * fit into this and FLASHPAGE_SIZE must be a multiple of
  * RIOTBOOT_FLASHPAGE_BUFFER_SIZE
  *
+ * With `riotboot_flashwrite_verify_sha256`, the SHA-256 digest of the image
+ * is computed while the data passes through riotboot_flashwrite_putbytes(),
+ * riotboot_flashwrite_digest_sha256() returns it without reading the slot
+ * back from flash. Set @ref CONFIG_RIOTBOOT_FLASHWRITE_READBACK to compare
+ * every written block with the data that was hashed.
+ *
  * @author      Kaspar Schleiser <kaspar@schleiser.de>
  * @author      Koen Zandberg <koen@bergzand.net>
  *
@@ -63,8 +69,14 @@
 extern "C" {
 #endif
 
+#include <stdbool.h>
+
+#include "kernel_defines.h"
 #include "riotboot/slot.h"
 #include "periph/flashpage.h"
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_VERIFY_SHA256)
+#include "hashes/sha256.h"
+#endif
 
 /**
  * @brief Enable/disable raw writes to flash
@@ -73,6 +85,16 @@ extern "C" {
 #define CONFIG_RIOTBOOT_FLASHWRITE_RAW  1
 #endif
 
+/**
+ * @brief Read back and compare every block after writing it in raw mode
+ *
+ * Without raw mode, pages are always verified by
+ * @ref flashpage_write_and_verify.
+ */
+#ifndef CONFIG_RIOTBOOT_FLASHWRITE_READBACK
+#define CONFIG_RIOTBOOT_FLASHWRITE_READBACK 0
+#endif
+
 /**
  * @brief Intermediate buffer size for firmware image data
  */
@@ -121,6 +143,9 @@ typedef struct {
     uint8_t RIOTBOOT_FLASHPAGE_BUFFER_ATTRS
         firstblock_buf[RIOTBOOT_FLASHPAGE_BUFFER_SIZE];
 #endif
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_VERIFY_SHA256) || DOXYGEN
+    sha256_context_t sha256;                /**< digest of the image so far  */
+#endif
 } riotboot_flashwrite_t;
 
 /**
@@ -165,8 +190,16 @@ static inline int riotboot_flashwrite_init(riotboot_flashwrite_t *state,
                                            int target_slot)
 {
     /* initialize state, but skip "RIOT" */
-    return riotboot_flashwrite_init_raw(state, target_slot,
-                                        RIOTBOOT_FLASHWRITE_SKIPLEN);
+    int res = riotboot_flashwrite_init_raw(state, target_slot,
+                                           RIOTBOOT_FLASHWRITE_SKIPLEN);
+
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_VERIFY_SHA256)
+    /* the magic number is part of the image, but only written by
+     * riotboot_flashwrite_finish() */
+    sha256_update(&state->sha256, "RIOT", RIOTBOOT_FLASHWRITE_SKIPLEN);
+#endif
+
+    return res;
 }
 
 /**
@@ -273,6 +306,24 @@ size_t riotboot_flashwrite_slotsize(const riotboot_flashwrite_t *state);
 int riotboot_flashwrite_verify_sha256(const uint8_t *sha256_digest,
                                       size_t img_size, int target_slot);
 
+/**
+ * @brief       Get the digest of the image written so far
+ *
+ * The digest is computed while writing, the slot is not read back. It covers
+ * the riotboot magic number followed by all bytes passed to
+ * @ref riotboot_flashwrite_putbytes(), so it is only meaningful for updates
+ * started with @ref riotboot_flashwrite_init(). It can be retrieved at any
+ * point, writing may continue afterwards.
+ *
+ * @param[in]   state           ptr to state struct
+ * @param[out]  sha256_digest   buffer for the digest, must hold
+ *                              @ref SHA256_DIGEST_LENGTH bytes
+ *
+ * @returns     the size of the image the digest was computed over
+ */
+size_t riotboot_flashwrite_digest_sha256(const riotboot_flashwrite_t *state,
+                                         uint8_t *sha256_digest);
+
 #ifdef __cplusplus
 }
 #endif
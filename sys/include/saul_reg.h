@@ -123,6 +123,27 @@ saul_reg_t *saul_reg_find_type_and_name(uint8_t type, const char *name);
  */
 int saul_reg_read(saul_reg_t *dev, phydat_t *res);
 
+/**
+ * @brief   Read a batch of buffered samples from the given device
+ *
+ * Samples are stored oldest first. The timestamp of sample `i` out of `n`
+ * samples returned is `now - (n - 1 - i) * period_us`. Devices that do not
+ * buffer samples return a single sample read with saul_reg_read() and set
+ * @p period_us to 0.
+ *
+ * @param[in] dev           device to read from
+ * @param[out] res          array of @p count results
+ * @param[in] count         maximum number of samples to read
+ * @param[out] period_us    sample period in microseconds
+ *
+ * @return      the number of samples read
+ * @return      -ENODEV if given device is invalid
+ * @return      -ENOTSUP if read operation is not supported by the device
+ * @return      -ECANCELED on device errors
+ */
+int saul_reg_read_batch(saul_reg_t *dev, phydat_t *res, size_t count,
+                        uint32_t *period_us);
+
 /**
  * @brief   Write data to the given device
  *
@@ -16,6 +16,29 @@
  *
  * @note        If auto_init is disabled `init_schedstatistics()` needs to be
  *              called as well as xtimer_init().
+ *
+ * Time Base
+ * ---------
+ *
+ * By default, the runtime is measured with `ZTIMER_USEC`, so one tick of
+ * the statistics is one microsecond. With the module
+ * `schedstatistics_cycles`, the CPU cycle counter (`DWT->CYCCNT` on
+ * Cortex-M, `mcycle` on RISC-V) is used instead, which is both cheaper to
+ * read on every context switch and more precise. Use
+ * @ref schedstat_ticks_to_us to convert ticks to microseconds.
+ *
+ * @note        The cycle counter is only 32 bit wide. A thread running
+ *              longer than one overflow period (e.g. ~67 s at 64 MHz)
+ *              without being preempted is accounted incorrectly.
+ *
+ * Utilization Window
+ * ------------------
+ *
+ * In addition to the total runtime, the runtime of each thread within the
+ * last complete window of (at least) @ref CONFIG_SCHEDSTATISTICS_WINDOW_MS
+ * milliseconds is tracked. Windows are only closed on context switches, so
+ * the actual length of the last window is available via
+ * @ref schedstat_window_ticks.
  * @{
  *
  * @file
@@ -35,6 +58,16 @@
  extern "C" {
 #endif
 
+/**
+ * @brief   Length of the utilization window in milliseconds
+ *
+ * @note    When using `schedstatistics_cycles`, this must be shorter than
+ *          the overflow period of the 32 bit cycle counter.
+ */
+#ifndef CONFIG_SCHEDSTATISTICS_WINDOW_MS
+#define CONFIG_SCHEDSTATISTICS_WINDOW_MS    (1000U)
+#endif
+
 /**
  *  Scheduler statistics
  */
@@ -42,7 +75,10 @@ typedef struct {
     uint32_t laststart;      /**< Time stamp of the last time this thread was
                                   scheduled to run */
     unsigned int schedules;  /**< How often the thread was scheduled to run */
-    uint64_t runtime_us;     /**< The total runtime of this thread in microseconds */
+    uint64_t runtime_ticks;  /**< The total runtime of this thread in ticks */
+    uint32_t window_ticks;   /**< Runtime in the current window in ticks */
+    uint32_t window_last;    /**< Runtime in the last complete window in
+                                  ticks */
 } schedstat_t;
 
 /**
@@ -56,6 +92,30 @@ extern schedstat_t sched_pidlist[KERNEL_PID_LAST + 1];
  */
 void init_schedstatistics(void);
 
+/**
+ * @brief   Get the current time stamp of the statistics time base
+ *
+ * @return  current time in ticks
+ */
+uint32_t schedstat_now(void);
+
+/**
+ * @brief   Convert ticks of the statistics time base to microseconds
+ *
+ * @param[in]   ticks   number of ticks to convert
+ *
+ * @return  @p ticks in microseconds
+ */
+uint64_t schedstat_ticks_to_us(uint64_t ticks);
+
+/**
+ * @brief   Get the length of the last complete utilization window
+ *
+ * @return  window length in ticks
+ * @retval  0 if no window has been completed yet
+ */
+uint32_t schedstat_window_ticks(void);
+
 #ifdef __cplusplus
 }
 #endif
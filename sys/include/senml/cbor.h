@@ -31,6 +31,9 @@
 
 #include "senml.h"
 #include "nanocbor/nanocbor.h"
+#if IS_USED(MODULE_SENML_PHYDAT)
+#include "senml/phydat.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -113,6 +116,44 @@ int senml_encode_string_cbor(nanocbor_encoder_t *enc, const senml_string_value_t
  */
 int senml_encode_data_cbor(nanocbor_encoder_t *enc, const senml_data_value_t *val);
 
+#if IS_USED(MODULE_SENML_PHYDAT) || defined(DOXYGEN)
+/**
+ * @brief A batch of @ref phydat_t samples of one sensor
+ *
+ * Encoded as one record per sample. The base name, base time and base unit
+ * are only encoded in the first record and apply to the ones following it,
+ * so these only carry their value and time.
+ */
+typedef struct {
+    const char *base_name;          /**< Base Name, e.g. the name of the sensor */
+    senml_numeric_t base_time;      /**< Base Time of the batch */
+    const phydat_t *data;           /**< The samples */
+    const senml_numeric_t *time;    /**< Time of each sample relative to @p base_time, may be NULL */
+    size_t numof;                   /**< Number of samples */
+    uint8_t dim;                    /**< Dimension of the samples to encode */
+} senml_phydat_batch_t;
+
+/**
+ * @brief Encode records of a @ref senml_phydat_batch_t as CBOR.
+ *
+ * The values are encoded as decimal fractions using
+ * @ref phydat_to_senml_decimal. The unit of the first sample becomes the base
+ * unit, records only carry a unit if it differs from that.
+ *
+ * Requires the `senml_phydat` module.
+ *
+ * @param enc   NanoCBOR encoder.
+ * @param batch Batch to encode.
+ * @param first Index of the first sample to encode.
+ * @param numof Maximum number of samples to encode, starting from @p first.
+ *
+ * @return Size of the encoded data.
+ */
+int senml_encode_phydat_batch_cbor(nanocbor_encoder_t *enc,
+                                   const senml_phydat_batch_t *batch,
+                                   size_t first, size_t numof);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_senml_coap SenML CoAP
+ * @ingroup     sys_senml
+ * @brief       Functionality for sending @ref sys_senml_cbor packs over CoAP
+ *
+ * The `senml_coap` module encodes SenML packs straight into the payload of
+ * a @ref net_nanocoap response. Packs larger than a single block are sliced
+ * with Block2, so neither the sender nor the receiver has to buffer the
+ * whole pack.
+ *
+ * The pack is generated in chunks of one or more records by a callback.
+ * Each chunk is encoded into a buffer of @ref CONFIG_SENML_COAP_CHUNK_SIZE
+ * bytes on the stack, of which only the part that falls into the requested
+ * block is copied into the payload. The pack is encoded again for every
+ * block, so the chunks must be the same on every call, e.g. when
+ * encoding samples that were stored before.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Functionality for sending @ref sys_senml_cbor packs over CoAP
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ */
+
+#ifndef SENML_COAP_H
+#define SENML_COAP_H
+
+#include <stdint.h>
+#include <sys/types.h>
+
+#include "net/nanocoap.h"
+#include "nanocbor/nanocbor.h"
+#include "senml/cbor.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Maximum size of a chunk of records
+ */
+#ifndef CONFIG_SENML_COAP_CHUNK_SIZE
+#define CONFIG_SENML_COAP_CHUNK_SIZE    (64U)
+#endif
+
+/**
+ * @brief Callback encoding a chunk of records
+ *
+ * @param enc   NanoCBOR encoder to encode the records with.
+ * @param idx   Index of the chunk.
+ * @param arg   Argument passed to @ref senml_coap_blockwise_put_pack.
+ *
+ * @return Size of the encoded data.
+ * @return 0 if there are no more chunks.
+ * @return <0 on error.
+ */
+typedef int (*senml_coap_chunk_cb_t)(nanocbor_encoder_t *enc, unsigned idx,
+                                     void *arg);
+
+/**
+ * @brief Encode a SenML pack into the current block of a response.
+ *
+ * Encodes the pack as an indefinite length array of the records produced
+ * by @p cb, writing the part of it that falls into the block described by
+ * @p slicer to @p bufpos.
+ *
+ * @param slicer Block2 slicer, see @ref coap_block2_init.
+ * @param bufpos Position in the payload to write to.
+ * @param cb     Callback producing the chunks of the pack.
+ * @param arg    Argument passed to @p cb.
+ *
+ * @return Number of bytes written to @p bufpos.
+ * @return -ENOBUFS if a chunk is larger than @ref CONFIG_SENML_COAP_CHUNK_SIZE.
+ * @return Error returned by @p cb.
+ */
+ssize_t senml_coap_blockwise_put_pack(coap_block_slicer_t *slicer,
+                                      uint8_t *bufpos,
+                                      senml_coap_chunk_cb_t cb, void *arg);
+
+#if IS_USED(MODULE_SENML_PHYDAT) || defined(DOXYGEN)
+/**
+ * @brief Build a response with a @ref senml_phydat_batch_t as payload.
+ *
+ * To be called from a @ref net_nanocoap resource handler, supports Block2.
+ * Requires the `senml_phydat` module.
+ *
+ * @param pdu    The request.
+ * @param buf    Buffer for the response.
+ * @param len    Size of @p buf.
+ * @param batch  Batch to send.
+ *
+ * @return Size of the response.
+ * @return <0 on error.
+ */
+ssize_t senml_coap_phydat_batch_reply(coap_pkt_t *pdu, uint8_t *buf,
+                                      size_t len,
+                                      const senml_phydat_batch_t *batch);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SENML_COAP_H */
+/** @} */
@@ -79,6 +79,17 @@ extern "C" {
 #define CONFIG_SHELL_NO_PROMPT 0
 #endif
 
+/**
+ * @brief Size of the shell's input buffer in bytes
+ *
+ * The shell reads all input available on stdin at once, up to this size, and
+ * echoes it back in one go. Scripted input that arrives in bursts is thus
+ * not handled one byte and one write per character.
+ */
+#ifndef CONFIG_SHELL_INPUT_BUFSIZE
+#define CONFIG_SHELL_INPUT_BUFSIZE 16
+#endif
+
 /** @} */
 
 /**
@@ -49,6 +49,20 @@
  * RIOT's shell happily accepts both DOS and UNIX style line endings in any
  * case, so typically no line ending conversion is needed on the input.
  *
+ * ## Buffered output
+ *
+ * By default a write returns only after the last byte left the UART, so a
+ * thread printing a log line at 115200 Bd stalls for about 87 µs per byte.
+ * On platforms providing `periph_uart_nonblocking`, the (pseudo-) module
+ * `stdio_uart_nonblocking` queues the output in the TX ring buffer of the
+ * UART driver instead:
+ * ```
+ * USEMODULE += stdio_uart_nonblocking
+ * ```
+ * A write then only waits when the buffer is full, so size `UART_TXBUF_SIZE`
+ * for the typical burst of output. Buffered output is flushed before the
+ * UART is powered off.
+ *
  * ## STDIO from ISR
  *
  * @attention   Using STDIO over UART from interrupt context should be avoided,
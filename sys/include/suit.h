@@ -62,6 +62,21 @@ extern "C" {
 #define CONFIG_SUIT_COMPONENT_MAX_NAME_LEN          (32U)
 #endif
 
+/**
+ * @brief Size of the buffer for processed payload data in bytes
+ *
+ * Payloads that are decompressed (`suit_payload_heatshrink`) or applied as
+ * delta (`suit_payload_vcdiff`) while they are fetched are written to the
+ * storage in chunks of this size.
+ *
+ * Heatshrink payloads must be compressed with the window and lookahead size
+ * the decoder is configured with, `heatshrink -e -w 8 -l 4` for the defaults
+ * of @ref pkg_heatshrink.
+ */
+#ifndef CONFIG_SUIT_PAYLOAD_BUF_SIZE
+#define CONFIG_SUIT_PAYLOAD_BUF_SIZE                (64U)
+#endif
+
 /**
  * @brief Current SUIT serialization format version
  *
@@ -138,6 +153,47 @@ typedef enum {
     SUIT_DIGEST_TYPE_PREIMAGE   = 4     /**< Pre-image digest */
 } suit_digest_type_t;
 
+/**
+ * @brief SUIT payload compression algorithms
+ *
+ * Values of the compression-info parameter, as used by
+ * [suit-manifest-generator](https://github.com/ARMmbed/suit-manifest-generator).
+ * There is no registered value for heatshrink, the negative value is RIOT
+ * specific.
+ */
+typedef enum {
+    SUIT_COMPRESSION_HEATSHRINK = -1,   /**< heatshrink, see
+                                             @ref pkg_heatshrink */
+    SUIT_COMPRESSION_GZIP       = 1,    /**< gzip */
+    SUIT_COMPRESSION_BZIP2      = 2,    /**< bzip2 */
+    SUIT_COMPRESSION_DEFLATE    = 3,    /**< deflate */
+    SUIT_COMPRESSION_LZ4        = 4,    /**< LZ4 */
+    SUIT_COMPRESSION_LZMA       = 7,    /**< LZMA */
+} suit_compression_t;
+
+/**
+ * @brief SUIT payload unpack algorithms
+ *
+ * Values of the unpack-info parameter, see draft-ietf-suit-manifest-09.
+ * There is no registered value for VCDIFF deltas, the negative value is RIOT
+ * specific.
+ *
+ * With the `suit_payload_vcdiff` module, a payload with unpack-info
+ * @ref SUIT_UNPACK_VCDIFF is applied as delta against the slot binary of the
+ * running firmware, including its riotboot header. The image size and digest
+ * refer to the resulting slot binary. The delta must be in the interleaved
+ * format and must not copy from the target, e.g.
+ * `vcdiff encode -interleaved -dictionary old-slot.bin -target new-slot.bin`.
+ */
+typedef enum {
+    SUIT_UNPACK_VCDIFF  = -1,   /**< VCDIFF delta against the running
+                                     firmware, see @ref pkg_tinyvcdiff */
+    SUIT_UNPACK_HEX     = 1,    /**< Intel HEX */
+    SUIT_UNPACK_ELF     = 2,    /**< ELF */
+    SUIT_UNPACK_COFF    = 3,    /**< COFF */
+    SUIT_UNPACK_SREC    = 4,    /**< Motorola S-record */
+} suit_unpack_t;
+
 /**
  * @brief SUIT component types
  *
@@ -221,6 +277,8 @@ typedef struct {
     suit_param_ref_t param_digest;              /**< Payload verification digest */
     suit_param_ref_t param_uri;                 /**< Payload fetch URI */
     suit_param_ref_t param_size;                /**< Payload size */
+    suit_param_ref_t param_compression_info;    /**< Payload compression */
+    suit_param_ref_t param_unpack_info;         /**< Payload unpacking */
 
     /**
      * @brief Component offset inside the device memory.
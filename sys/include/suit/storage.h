@@ -59,7 +59,9 @@
  * data and check the digest of the payload. @ref suit_storage_driver_t::read
  * must be implemented, providing piecewise reading of the data. @ref
  * suit_storage_driver_t::read_ptr is optional to implement, it can provide
- * direct read access on memory-mapped storage.
+ * direct read access on memory-mapped storage. Backends that hash the payload
+ * while it is written can implement @ref suit_storage_driver_t::get_digest to
+ * skip reading it back altogether.
  *
  * As the storage backend provides a mechanism to store persistent data,
  * functions are added to set and retrieve the manifest sequence number. While
@@ -189,6 +191,24 @@ typedef struct suit_storage_driver {
     int (*read_ptr)(suit_storage_t *storage,
                     const uint8_t **buf, size_t *len);
 
+    /**
+     * @brief retrieve the SHA-256 digest of the written payload
+     *
+     * Allows backends that hash the payload while writing it to skip reading
+     * it back for the digest verification.
+     *
+     * @note Optional to implement
+     *
+     * @param[in]   storage     Storage context
+     * @param[out]  digest      Buffer for the digest, must hold
+     *                          @ref SHA256_DIGEST_LENGTH bytes
+     * @param[in]   len         Expected length of the payload
+     *
+     * @returns     @ref SUIT_OK if @p digest covers exactly @p len bytes
+     * @returns     @ref suit_error_t otherwise, the payload is read back instead
+     */
+    int (*get_digest)(suit_storage_t *storage, uint8_t *digest, size_t len);
+
     /**
      * @brief Install the payload or mark the payload as valid
      *
@@ -376,6 +396,20 @@ static inline bool suit_storage_has_readptr(const suit_storage_t *storage)
     return (storage->driver->read_ptr);
 }
 
+/**
+ * @brief Check if the storage backend implements the @ref
+ * suit_storage_driver_t::get_digest function
+ *
+ * @param[in]   storage     Storage context
+ *
+ * @returns     True if the function is implemented,
+ * @returns     False otherwise
+ */
+static inline bool suit_storage_has_digest(const suit_storage_t *storage)
+{
+    return (storage->driver->get_digest);
+}
+
 /**
  * @brief Check if the storage backend implements the @ref
  * suit_storage_driver_t::match_offset function
@@ -487,6 +521,25 @@ static inline int suit_storage_read_ptr(suit_storage_t *storage, const uint8_t
     return storage->driver->read_ptr(storage, buf, len);
 }
 
+/**
+ * @brief retrieve the SHA-256 digest of the written payload
+ *
+ * @note Optional to implement
+ *
+ * @param[in]   storage     Storage context
+ * @param[out]  digest      Buffer for the digest, must hold
+ *                          @ref SHA256_DIGEST_LENGTH bytes
+ * @param[in]   len         Expected length of the payload
+ *
+ * @returns     @ref SUIT_OK if @p digest covers exactly @p len bytes
+ * @returns     @ref suit_error_t otherwise
+ */
+static inline int suit_storage_get_digest(suit_storage_t *storage,
+                                          uint8_t *digest, size_t len)
+{
+    return storage->driver->get_digest(storage, digest, len);
+}
+
 /**
  * @brief Install the payload or mark the payload as valid
  *
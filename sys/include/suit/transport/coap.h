@@ -75,6 +75,16 @@ extern const coap_resource_subtree_t coap_resource_subtree_suit;
 #define CONFIG_SUIT_COAP_BLOCKSIZE  CONFIG_NANOCOAP_BLOCKSIZE_DEFAULT
 #endif
 
+/**
+ * @brief Number of block requests in flight when fetching an image
+ *
+ * Values above 1 use nanocoap_get_blockwise_window_url(), which needs a
+ * reorder buffer of (CONFIG_SUIT_COAP_BLOCK_WINDOW - 1) blocks.
+ */
+#ifndef CONFIG_SUIT_COAP_BLOCK_WINDOW
+#define CONFIG_SUIT_COAP_BLOCK_WINDOW   (1)
+#endif
+
 /**
  * @brief   Trigger a SUIT udate
  *
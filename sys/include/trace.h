@@ -9,6 +9,7 @@
  */
 
 /**
+ * @defgroup    sys_trace Trace
  * @ingroup     sys
  * @brief       Trace program flows
  *
@@ -28,6 +29,34 @@
  *
  * Tracing is made thread safe by disabling interrupts for critical sections.
  *
+ * Event tracing
+ * -------------
+ *
+ * With the `trace_events` pseudomodule, the kernel and the network stack add
+ * typed records to the same buffer via `trace_event()`:
+ *
+ * | Event                           | Argument                          |
+ * |:------------------------------- |:--------------------------------- |
+ * | @ref TRACE_EVENT_SCHED          | pid of the thread switched to     |
+ * | @ref TRACE_EVENT_MSG_SEND       | msg type << 8 \| target pid       |
+ * | @ref TRACE_EVENT_MSG_RECV       | msg type << 8 \| sender pid       |
+ * | @ref TRACE_EVENT_MUTEX_WAIT     | lower 24 bit of the mutex address |
+ * | @ref TRACE_EVENT_NETIF_RX       | packet length << 8 \| netif pid   |
+ * | @ref TRACE_EVENT_NETIF_TX       | packet length << 8 \| netif pid   |
+ * | @ref TRACE_EVENT_PKTBUF_ALLOC   | size of the allocated chunk       |
+ * | @ref TRACE_EVENT_PKTBUF_FREE    | size of the released chunk        |
+ * | @ref TRACE_EVENT_MUTEX_ACQUIRE  | lower 24 bit of the mutex address |
+ * | @ref TRACE_EVENT_MSG_QUEUE_FULL | msg type << 8 \| target pid       |
+ *
+ * Each record stays 8 bytes: the event type takes the upper 8 bit of the
+ * value, the argument the lower 24 bit. Values passed to `trace()` are
+ * recorded as @ref TRACE_EVENT_USER and are truncated to 24 bit.
+ *
+ * `trace_dump_bin()` writes the buffer in binary form to stdio, so it can be
+ * collected over whatever stdio backend is in use (UART, RTT, CDC ACM, ...).
+ * `dist/tools/trace/trace2perfetto.py` converts such a capture into the JSON
+ * trace format understood by https://ui.perfetto.dev and `chrome://tracing`.
+ *
  * It does incur some overhead (at least a function call, getting the current
  * time, a pair of enable/disable interrupts and a couple of memory accesses).
  *
@@ -55,6 +84,8 @@
 
 #include <stdint.h>
 
+#include "modules.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -92,6 +123,71 @@ void trace_dump(void);
  */
 void trace_reset(void);
 
+/**
+ * @brief   Event types recorded with the `trace_events` module
+ */
+typedef enum {
+    TRACE_EVENT_USER,           /**< value passed to trace() */
+    TRACE_EVENT_SCHED,          /**< context switch */
+    TRACE_EVENT_MSG_SEND,       /**< message sent or queued */
+    TRACE_EVENT_MSG_RECV,       /**< message received */
+    TRACE_EVENT_MUTEX_WAIT,     /**< thread blocks on a locked mutex */
+    TRACE_EVENT_NETIF_RX,       /**< packet received by a GNRC interface */
+    TRACE_EVENT_NETIF_TX,       /**< packet handed to a GNRC interface */
+    TRACE_EVENT_PKTBUF_ALLOC,   /**< packet buffer chunk allocated */
+    TRACE_EVENT_PKTBUF_FREE,    /**< packet buffer chunk released */
+    TRACE_EVENT_MUTEX_ACQUIRE,  /**< thread got the mutex it waited for */
+    TRACE_EVENT_MSG_QUEUE_FULL, /**< message did not fit into the queue */
+    TRACE_EVENT_NUMOF,          /**< number of event types */
+} trace_event_t;
+
+/**
+ * @brief   Magic at the start of the output of trace_dump_bin()
+ */
+#define TRACE_BIN_MAGIC     "RTRC"
+
+/**
+ * @brief   Format version of the output of trace_dump_bin()
+ */
+#define TRACE_BIN_VERSION   (1)
+
+#if IS_USED(MODULE_TRACE_EVENTS) || DOXYGEN
+/**
+ * @brief   Add an event record to the trace buffer
+ *
+ * Events are dropped until the timer used for timestamps has been
+ * initialized.
+ *
+ * @param[in]   type    event type
+ * @param[in]   arg     event argument, only the lower 24 bit are recorded
+ */
+void trace_event(trace_event_t type, uint32_t arg);
+
+/**
+ * @brief   Write the trace buffer in binary form to stdio
+ *
+ * The output consists of a header followed by the records, oldest first:
+ *
+ *     "RTRC" | version (u8) | record size (u8) | record count (u16)
+ *     time (u32) | type << 24 | arg (u32)
+ *     ...
+ *
+ * followed by a table of thread names, which is empty unless thread names are
+ * available (e.g. with `DEVELHELP`):
+ *
+ *     thread count (u8) | (pid (u8) | name length (u8) | name) ...
+ *
+ * All values are little endian, timestamps are in microseconds.
+ */
+void trace_dump_bin(void);
+#else
+static inline void trace_event(trace_event_t type, uint32_t arg)
+{
+    (void)type;
+    (void)arg;
+}
+#endif
+
 #ifdef __cplusplus
 }
 #endif
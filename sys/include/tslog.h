@@ -0,0 +1,211 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_tslog   Time-series ring log
+ * @ingroup     sys
+ * @brief       Append-only log of timestamped records on raw MTD
+ *
+ * Sensor samples written to files on a general purpose file system cause a
+ * metadata update for every append, which dominates the write amplification
+ * and the flash wear. This module instead writes records back to back into a
+ * circular log of MTD sectors:
+ *
+ * - Every sector starts with a header holding a sequence number and the
+ *   timestamp of its first record. The headers are the sparse index: seeking
+ *   to a point in time is a binary search over them, followed by a linear
+ *   scan of a single sector.
+ * - Every record carries its length, its timestamp and a CRC-16 over both and
+ *   the payload. Records that were torn by a power loss are detected and
+ *   skipped.
+ * - Once all sectors are filled, the oldest sector is erased and reused.
+ *   @ref tslog_erase_ahead does this in advance, e.g. from a low priority
+ *   thread, so that appends never have to wait for an erase.
+ *
+ * Timestamps are opaque to the log, but they must not decrease from one
+ * record to the next. A read-only view of the log for the VFS is provided by
+ * the `tslog_fs` module, see @ref sys_fs_tslog.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Time-series ring log API
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ */
+
+#ifndef TSLOG_H
+#define TSLOG_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+#include "mtd.h"
+#include "mutex.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Maximum payload size of a record in bytes
+ */
+#ifndef CONFIG_TSLOG_RECORD_MAX
+#define CONFIG_TSLOG_RECORD_MAX     (64U)
+#endif
+
+/**
+ * @brief   Size of a record header in bytes
+ */
+#define TSLOG_RECORD_HDR_SIZE       (8U)
+
+/**
+ * @brief   Size of a sector header in bytes
+ */
+#define TSLOG_SECTOR_HDR_SIZE       (16U)
+
+/**
+ * @brief   Size of the record buffer, the device's write size must divide 16
+ */
+#define TSLOG_BUF_SIZE  (((TSLOG_RECORD_HDR_SIZE + CONFIG_TSLOG_RECORD_MAX) + 15U) & ~15U)
+
+/**
+ * @brief   Time-series log descriptor
+ *
+ * All members are private.
+ */
+typedef struct {
+    mtd_dev_t *mtd;             /**< MTD device the log is stored on */
+    uint32_t sector_first;      /**< first MTD sector of the log */
+    uint32_t sector_count;      /**< number of MTD sectors of the log */
+    mutex_t lock;               /**< protects the log and the buffer */
+    uint32_t head;              /**< oldest sector in use */
+    uint32_t tail;              /**< sector currently appended to */
+    uint32_t tail_seq;          /**< sequence number of the tail sector */
+    uint32_t write_pos;         /**< offset of the next record in the tail sector */
+    uint32_t last_ts;           /**< timestamp of the last record */
+    uint32_t erased;            /**< sector erased ahead of time, UINT32_MAX if none */
+    bool empty;                 /**< true if no sector is in use */
+    uint8_t buf[TSLOG_BUF_SIZE]; /**< record buffer */
+} tslog_t;
+
+/**
+ * @brief   Read position in a log
+ *
+ * An iterator stays valid while records are appended. It becomes stale once
+ * the sector it points to was reused for new records.
+ */
+typedef struct {
+    uint32_t seq;               /**< sequence number of the sector */
+    uint32_t pos;               /**< offset of the record in the sector */
+} tslog_iter_t;
+
+/**
+ * @brief   Open the log stored in a range of sectors of an MTD device
+ *
+ * Sectors without a valid header are considered unused, so an erased range
+ * is an empty log.
+ *
+ * @param[out] log          Log descriptor to initialize
+ * @param[in]  mtd          MTD device to use
+ * @param[in]  sector_first First sector of the log on @p mtd
+ * @param[in]  sector_count Number of sectors of the log, at least 2
+ *
+ * @return  0 on success
+ * @return  -EINVAL if the sector range is invalid
+ * @return  -ENOTSUP if the write size of @p mtd is not supported
+ * @return  <0 on MTD errors
+ */
+int tslog_init(tslog_t *log, mtd_dev_t *mtd, uint32_t sector_first,
+               uint32_t sector_count);
+
+/**
+ * @brief   Erase all sectors of the log
+ *
+ * @param[in]  log      Log descriptor
+ *
+ * @return  0 on success
+ * @return  <0 on MTD errors
+ */
+int tslog_format(tslog_t *log);
+
+/**
+ * @brief   Append a record
+ *
+ * @param[in]  log          Log descriptor
+ * @param[in]  timestamp    Timestamp of the record, must not be smaller than
+ *                          the one of the previous record
+ * @param[in]  data         Payload of the record
+ * @param[in]  len          Size of @p data, at most @ref CONFIG_TSLOG_RECORD_MAX
+ *
+ * @return  0 on success
+ * @return  -EINVAL if @p timestamp is smaller than the previous one
+ * @return  -EMSGSIZE if @p len is too large
+ * @return  <0 on MTD errors
+ */
+int tslog_append(tslog_t *log, uint32_t timestamp, const void *data, size_t len);
+
+/**
+ * @brief   Erase the sector the log continues in ahead of time
+ *
+ * Meant to be called from a low priority context while the log is idle. If
+ * all sectors are in use, this drops the oldest sector.
+ *
+ * @param[in]  log      Log descriptor
+ *
+ * @return  0 on success, also if the sector was already erased
+ * @return  <0 on MTD errors
+ */
+int tslog_erase_ahead(tslog_t *log);
+
+/**
+ * @brief   Point an iterator to the oldest record of the log
+ *
+ * @param[in]  log      Log descriptor
+ * @param[out] it       Iterator to initialize
+ */
+void tslog_iter_init(tslog_t *log, tslog_iter_t *it);
+
+/**
+ * @brief   Point an iterator to the first record not older than @p timestamp
+ *
+ * @param[in]  log          Log descriptor
+ * @param[out] it           Iterator to initialize
+ * @param[in]  timestamp    Timestamp to seek to
+ *
+ * @return  0 on success, the iterator points to the end of the log if all
+ *          records are older than @p timestamp
+ * @return  <0 on MTD errors
+ */
+int tslog_seek(tslog_t *log, tslog_iter_t *it, uint32_t timestamp);
+
+/**
+ * @brief   Read the record an iterator points to and advance the iterator
+ *
+ * @param[in]     log       Log descriptor
+ * @param[in,out] it        Iterator
+ * @param[out]    timestamp Timestamp of the record, may be NULL
+ * @param[out]    buf       Buffer for the payload
+ * @param[in]     len       Size of @p buf, a longer payload is truncated
+ *
+ * @return  size of the payload of the record
+ * @return  -ENOENT at the end of the log
+ * @return  -ESTALE if the records @p it pointed to were overwritten, it now
+ *          points to the oldest record
+ * @return  <0 on MTD errors
+ */
+ssize_t tslog_read(tslog_t *log, tslog_iter_t *it, uint32_t *timestamp,
+                   void *buf, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TSLOG_H */
+/** @} */
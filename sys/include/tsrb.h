@@ -192,6 +192,51 @@ int tsrb_add_one(tsrb_t *rb, uint8_t c);
  */
 int tsrb_add(tsrb_t *rb, const uint8_t *src, size_t n);
 
+/**
+ * @brief       Get the largest contiguous block of bytes available for
+ *              reading, without removing them
+ *
+ * The bytes can be processed in place, e.g. handed to a DMA transfer, and
+ * are removed with @ref tsrb_drop() afterwards. If the data wraps around the
+ * end of the buffer, only the part up to the end is returned, the rest is
+ * returned by the next call.
+ *
+ * @note        The bytes stay valid until they are dropped, as long as only
+ *              one context reads from the ringbuffer.
+ *
+ * @param[in]   rb      Ringbuffer to operate on
+ * @param[out]  data    start of the block
+ * @return      nr of bytes in the block, 0 if the ringbuffer is empty
+ */
+size_t tsrb_peek_linear(tsrb_t *rb, uint8_t **data);
+
+/**
+ * @brief       Get the largest contiguous block of free space for writing
+ *
+ * The caller writes into the block, e.g. with memcpy() or DMA, and makes the
+ * bytes available for reading with @ref tsrb_commit(). If the free space
+ * wraps around the end of the buffer, only the part up to the end is
+ * returned.
+ *
+ * @note        Only one context must write to the ringbuffer at a time.
+ *
+ * @param[in]   rb      Ringbuffer to operate on
+ * @param[out]  data    start of the block
+ * @return      nr of bytes in the block, 0 if the ringbuffer is full
+ */
+size_t tsrb_reserve_linear(tsrb_t *rb, uint8_t **data);
+
+/**
+ * @brief       Make bytes written into a block obtained by
+ *              @ref tsrb_reserve_linear() available for reading
+ *
+ * @pre         @p n does not exceed the size of the reserved block
+ *
+ * @param[in]   rb      Ringbuffer to operate on
+ * @param[in]   n       nr of bytes written
+ */
+void tsrb_commit(tsrb_t *rb, size_t n);
+
 #ifdef __cplusplus
 }
 #endif
@@ -105,6 +105,19 @@ typedef enum {
      */
     USBOPT_EP_AVAILABLE,
 
+    /**
+     * @brief   (size_t) Maximum length of a transfer on an IN endpoint
+     *
+     * Data passed to @ref usbdev_ep_xmit may be longer than the maximum
+     * packet size of the endpoint, up to this length. The peripheral splits
+     * it into packets and signals a single @ref USBDEV_EVENT_TR_COMPLETE once
+     * all of them are sent. Drivers not supporting multi-packet transfers
+     * return -ENOTSUP, transfers are then limited to the maximum packet size.
+     *
+     * Setting this option must return -ENOTSUP
+     */
+    USBOPT_EP_MAX_XFER_SIZE,
+
     /* expand list if required */
 } usbopt_ep_t;
 
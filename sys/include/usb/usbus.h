@@ -84,6 +84,19 @@ extern "C" {
 #define CONFIG_USBUS_MSC_AUTO_MTD           1
 #endif
 
+/**
+ * @brief USBUS MSC double buffering
+ *
+ * When set to 1, the USBUS MSC module allocates a second block buffer. The
+ * next block of a READ(10) command is then read from the MTD device while the
+ * current one is sent to the host, and the next block of a WRITE(10) command
+ * is received while the previous one is written to the MTD device. This
+ * doubles the RAM used for block buffers.
+ */
+#ifndef CONFIG_USBUS_MSC_DOUBLE_BUFFER
+#define CONFIG_USBUS_MSC_DOUBLE_BUFFER      0
+#endif
+
 /**
  * @brief USBUS endpoint 0 buffer size
  *
@@ -162,6 +162,7 @@ struct usbus_cdcacm_device {
     tsrb_t tsrb;                        /**< TSRB for data to the host       */
     usbus_t *usbus;                     /**< USBUS reference                 */
     size_t occupied;                    /**< Number of bytes for the host    */
+    size_t in_max;                      /**< Max bytes per transfer to host  */
     usbus_cdcacm_line_state_t state;    /**< Current line state              */
     event_t flush;                      /**< device2host forced flush event  */
     usb_req_cdcacm_coding_t coding;     /**< Current coding configuration    */
@@ -173,6 +174,9 @@ struct usbus_cdcacm_device {
 
     /**
      * @brief Device to host data buffer
+     *
+     * If the peripheral supports multi-packet transfers, the whole buffer is
+     * sent with a single transfer, otherwise one packet at a time.
      */
     usbdev_ep_buf_t in_buf[CONFIG_USBUS_CDC_ACM_STDIO_BUF_SIZE];
 };
@@ -128,6 +128,8 @@ typedef struct usbus_cdcecm_device {
     usbus_t *usbus;                         /**< Ptr to the USBUS context */
     mutex_t out_lock;                       /**< mutex used for locking netif/USBUS send */
     size_t tx_len;                          /**< Length of the current tx frame */
+    size_t tx_offset;                       /**< Bytes of the tx frame passed to usbdev */
+    size_t tx_max;                          /**< Max bytes per IN transfer */
     usbus_cdcecm_notif_t notif;             /**< Startup message notification tracker */
     unsigned active_iface;                  /**< Current active data interface */
 
@@ -137,9 +139,9 @@ typedef struct usbus_cdcecm_device {
     usbdev_ep_buf_t data_out[USBUS_ETHERNET_FRAME_BUF];
 
     /**
-     * @brief Host in device out data buffer
+     * @brief Buffer for frames to the host
      */
-    usbdev_ep_buf_t data_in[USBUS_CDCECM_EP_DATA_SIZE];
+    usbdev_ep_buf_t data_in[USBUS_ETHERNET_FRAME_BUF];
 
     /**
      * @brief Host out device in control buffer
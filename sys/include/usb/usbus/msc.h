@@ -22,6 +22,7 @@
 #ifndef USB_USBUS_MSC_H
 #define USB_USBUS_MSC_H
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "usb/usbus.h"
 #include "usb/usbus/msc/scsi.h"
@@ -86,7 +87,11 @@ typedef struct usbus_msc_device {
     event_t rx_event;                /**< Transmit ready event */
     usbus_msc_state_t state;         /**< Internal state machine for msc */
     uint8_t *buffer;                 /**< Pointer to the current data transfer buffer */
+    uint8_t *spare_buffer;           /**< Second data transfer buffer, only with
+                                          @ref CONFIG_USBUS_MSC_DOUBLE_BUFFER */
     uint32_t buffer_size;            /**< Size of the internal buffer used for data transfer */
+    size_t xfer_max;                 /**< Maximum length of a transfer on the IN endpoint */
+    bool prefetched;                 /**< spare_buffer holds the next block to read */
     uint32_t block;                  /**< First block to transfer data from/to */
     uint16_t block_nb;               /**< Number of block to transfer for READ and
                                           WRITE operations */
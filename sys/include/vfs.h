@@ -218,9 +218,24 @@ extern "C" {
 #endif
 /** @} */
 
+/**
+ * @brief   VFS parameters for the time-series log view
+ * @{
+ */
+#if defined(MODULE_TSLOG_FS) || DOXYGEN
+#  define TSLOG_FS_VFS_FILE_BUFFER_SIZE     (12)   /**< sizeof(tslog_fs_file_t) */
+#else
+#  define TSLOG_FS_VFS_FILE_BUFFER_SIZE     (1)
+#endif
+/** @} */
+
 #ifndef VFS_MAX_OPEN_FILES
 /**
  * @brief Maximum number of simultaneous open files
+ *
+ * This includes the stdio file descriptors. Free descriptors are found in an
+ * allocation bitmap, so larger values only cost the memory of the
+ * additional @ref vfs_file_t entries.
  */
 #define VFS_MAX_OPEN_FILES (16)
 #endif
@@ -282,13 +297,14 @@ extern "C" {
  * @attention Put the check in the public header file (.h), do not put the check in the
  * implementation (.c) file.
  */
-#define VFS_FILE_BUFFER_SIZE MAX6(FATFS_VFS_FILE_BUFFER_SIZE,      \
-                                  LITTLEFS_VFS_FILE_BUFFER_SIZE,   \
-                                  LITTLEFS2_VFS_FILE_BUFFER_SIZE,  \
-                                  SPIFFS_VFS_FILE_BUFFER_SIZE,     \
-                                  LWEXT4_VFS_FILE_BUFFER_SIZE,     \
-                                  NANOCOAP_FS_VFS_FILE_BUFFER_SIZE \
-                                 )
+#define VFS_FILE_BUFFER_SIZE MAX(MAX6(FATFS_VFS_FILE_BUFFER_SIZE,      \
+                                      LITTLEFS_VFS_FILE_BUFFER_SIZE,   \
+                                      LITTLEFS2_VFS_FILE_BUFFER_SIZE,  \
+                                      SPIFFS_VFS_FILE_BUFFER_SIZE,     \
+                                      LWEXT4_VFS_FILE_BUFFER_SIZE,     \
+                                      NANOCOAP_FS_VFS_FILE_BUFFER_SIZE \
+                                     ),                                \
+                                 TSLOG_FS_VFS_FILE_BUFFER_SIZE)
 #endif
 
 #ifndef VFS_NAME_MAX
@@ -302,6 +318,30 @@ extern "C" {
 #define VFS_NAME_MAX (31)
 #endif
 
+#ifndef CONFIG_VFS_STAT_CACHE_NUMOF
+/**
+ * @brief Number of @ref vfs_stat results to cache
+ *
+ * Repeated lookups of the same path (e.g. by a file server probing for index
+ * files) are answered without asking the file system. Both existing and
+ * missing paths are cached. Every modification through the VFS drops all
+ * cached results, so the cache must not be used with file systems that
+ * change behind the back of the VFS.
+ *
+ * Set to 0 to disable the cache.
+ */
+#define CONFIG_VFS_STAT_CACHE_NUMOF (0)
+#endif
+
+#ifndef CONFIG_VFS_STAT_CACHE_PATH_MAX
+/**
+ * @brief Size of the path buffer of a @ref vfs_stat cache entry
+ *
+ * Results for longer paths (including the terminating null) are not cached.
+ */
+#define CONFIG_VFS_STAT_CACHE_PATH_MAX (32)
+#endif
+
 /**
  * @brief Used with vfs_bind to bind to any available fd number
  */
@@ -570,6 +610,37 @@ struct vfs_file_ops {
      * @return <0 on error
      */
     int (*fsync) (vfs_file_t *filp);
+
+    /**
+     * @brief Map a range of an open file into the address space
+     *
+     * Only file systems that store the file data contiguously in memory
+     * mapped storage (RAM, internal or XIP flash) can implement this.
+     *
+     * @param[in]  filp     pointer to open file
+     * @param[in]  off      offset of the range in the file
+     * @param[in]  len      length of the range
+     * @param[out] addr     address of the range
+     *
+     * @return 0 on success
+     * @return -ENXIO if the range is not within the file
+     * @return <0 on other errors, e.g. if the file is not stored contiguously
+     */
+    int (*mmap) (vfs_file_t *filp, off_t off, size_t len, const void **addr);
+
+    /**
+     * @brief Release a mapping obtained from vfs_file_ops::mmap
+     *
+     * Optional, only needed if the driver has to track mappings.
+     *
+     * @param[in]  filp     pointer to open file
+     * @param[in]  addr     address returned by vfs_file_ops::mmap
+     * @param[in]  len      length passed to vfs_file_ops::mmap
+     *
+     * @return 0 on success
+     * @return <0 on error
+     */
+    int (*munmap) (vfs_file_t *filp, const void *addr, size_t len);
 };
 
 /**
@@ -608,6 +679,23 @@ struct vfs_dir_ops {
      */
     int (*readdir) (vfs_DIR *dirp, vfs_dirent_t *entry);
 
+    /**
+     * @brief Read a single entry together with its status
+     *
+     * Optional, same as @c readdir but additionally fills @p buf like @c stat
+     * would for the entry. Implement this if the status is known while
+     * reading the directory anyway.
+     *
+     * @param[in]  dirp     pointer to open directory
+     * @param[out] entry    directory entry information
+     * @param[out] buf      status of the entry, zeroed by the caller
+     *
+     * @return 1 if @p entry was updated
+     * @return 0 if @p dirp has reached the end of the directory index
+     * @return <0 on error
+     */
+    int (*readdir_stat) (vfs_DIR *dirp, vfs_dirent_t *entry, struct stat *buf);
+
     /**
      * @brief Close an open directory
      *
@@ -904,6 +992,42 @@ ssize_t vfs_write_iol(int fd, const iolist_t *iolist);
  */
 int vfs_fsync(int fd);
 
+/**
+ * @brief Map a range of an open file for direct read access
+ *
+ * For files stored contiguously in memory mapped storage (e.g. constfs
+ * files in internal or XIP flash) this returns a pointer to the file data,
+ * which saves copying it into RAM with @ref vfs_read. The mapping is
+ * read-only and stays valid until @ref vfs_munmap is called, it must not
+ * be used after the file was closed.
+ *
+ * File systems that can not map files return -ENOTSUP, callers should
+ * fall back to @ref vfs_read then.
+ *
+ * @param[in]  fd       fd number obtained from vfs_open
+ * @param[in]  off      offset of the range in the file
+ * @param[in]  len      length of the range
+ * @param[out] addr     address of the range
+ *
+ * @return 0 on success
+ * @return -ENOTSUP if the file system does not support mapping the file
+ * @return -ENXIO if the range is not within the file
+ * @return <0 on other errors
+ */
+int vfs_mmap(int fd, off_t off, size_t len, const void **addr);
+
+/**
+ * @brief Release a mapping obtained from @ref vfs_mmap
+ *
+ * @param[in]  fd       fd number the mapping was obtained from
+ * @param[in]  addr     address returned by @ref vfs_mmap
+ * @param[in]  len      length passed to @ref vfs_mmap
+ *
+ * @return 0 on success
+ * @return <0 on error
+ */
+int vfs_munmap(int fd, const void *addr, size_t len);
+
 /**
  * @brief Open a directory for reading with readdir
  *
@@ -936,6 +1060,26 @@ int vfs_opendir(vfs_DIR *dirp, const char *dirname);
  */
 int vfs_readdir(vfs_DIR *dirp, vfs_dirent_t *entry);
 
+/**
+ * @brief Read up to @p count entries from the open directory dirp
+ *
+ * If @p stats is not NULL, the status of each entry is stored there when the
+ * file system provides it while reading the directory. Otherwise the status
+ * is zeroed, so a @c st_mode of 0 means that the caller has to use
+ * @ref vfs_stat on the entry if it needs it.
+ *
+ * @param[in]  dirp     pointer to open directory
+ * @param[out] entries  array of @p count directory entries
+ * @param[out] stats    array of @p count status buffers, may be NULL
+ * @param[in]  count    number of entries to read at most
+ *
+ * @return number of entries read
+ * @return 0 if @p dirp has reached the end of the directory index
+ * @return <0 on error if no entry was read
+ */
+int vfs_readdir_batch(vfs_DIR *dirp, vfs_dirent_t *entries, struct stat *stats,
+                      size_t count);
+
 /**
  * @brief Close an open directory
  *
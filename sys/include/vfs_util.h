@@ -22,6 +22,15 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+#if MODULE_SOCK_TCP || DOXYGEN
+#include "net/sock/tcp.h"
+#endif
+#if MODULE_SOCK_UDP || DOXYGEN
+#include "net/sock/udp.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -104,6 +113,101 @@ int vfs_file_sha256(const char* file, void *digest,
                     void *work_buf, size_t work_buf_len);
 #endif
 
+#if MODULE_SOCK_TCP || DOXYGEN
+/**
+ * @brief   Sends a range of an open file over a TCP connection
+ *
+ *          Requires a `sock_tcp` implementation.
+ *
+ * If the file system can map the file (see @ref vfs_mmap), the data is
+ * written to the socket directly from the mapping, without a copy into
+ * @p work_buf. Otherwise it is read in chunks of @p work_buf_len bytes.
+ *
+ * @param[in]  fd       Open file to send from
+ * @param[in]  sock     Connected TCP sock
+ * @param[in]  offset   Offset of the range in the file
+ * @param[in]  len      Length of the range
+ * @param[out] work_buf Work buffer
+ * @param[in] work_buf_len  Size of the work buffer
+ *
+ * @note    The file position of @p fd is undefined afterwards.
+ *
+ * @return  number of bytes sent, less than @p len if the file ended before
+ * @return  negative error from @ref vfs_read or @ref sock_tcp_write
+ */
+ssize_t vfs_sendfile(int fd, sock_tcp_t *sock, off_t offset, size_t len,
+                     void *work_buf, size_t work_buf_len);
+
+/**
+ * @brief   Writes data received over a TCP connection to an open file
+ *
+ *          Requires a `sock_tcp` implementation.
+ *
+ * @param[in]  sock     Connected TCP sock
+ * @param[in]  fd       Open file to write to
+ * @param[in]  len      Number of bytes to receive
+ * @param[in]  timeout  Timeout for each @ref sock_tcp_read in microseconds
+ * @param[out] work_buf Work buffer
+ * @param[in] work_buf_len  Size of the work buffer
+ *
+ * @return  number of bytes written, less than @p len if the connection was
+ *          closed before
+ * @return  negative error from @ref sock_tcp_read or @ref vfs_write, data
+ *          received before the error was written to the file
+ */
+ssize_t vfs_recvfile(sock_tcp_t *sock, int fd, size_t len, uint32_t timeout,
+                     void *work_buf, size_t work_buf_len);
+#endif
+
+#if MODULE_SOCK_UDP || DOXYGEN
+/**
+ * @brief   Sends a range of an open file as a sequence of UDP datagrams
+ *
+ *          Requires a `sock_udp` implementation.
+ *
+ * Every datagram but the last one carries @p work_buf_len bytes. If the file
+ * system can map the file (see @ref vfs_mmap), the datagrams are sent
+ * directly from the mapping and @p work_buf is not touched.
+ *
+ * @param[in]  fd       Open file to send from
+ * @param[in]  sock     UDP sock, may be NULL, see @ref sock_udp_send
+ * @param[in]  remote   Remote end point, may be NULL if @p sock has one
+ * @param[in]  offset   Offset of the range in the file
+ * @param[in]  len      Length of the range
+ * @param[out] work_buf Work buffer
+ * @param[in] work_buf_len  Size of the work buffer and of the datagrams
+ *
+ * @note    The file position of @p fd is undefined afterwards.
+ *
+ * @return  number of bytes sent, less than @p len if the file ended before
+ * @return  negative error from @ref vfs_read or @ref sock_udp_send
+ */
+ssize_t vfs_sendfile_udp(int fd, sock_udp_t *sock, const sock_udp_ep_t *remote,
+                         off_t offset, size_t len,
+                         void *work_buf, size_t work_buf_len);
+
+/**
+ * @brief   Writes the payload of received UDP datagrams to an open file
+ *
+ *          Requires a `sock_udp` implementation.
+ *
+ * The payload is written from the network stack's packet buffer using
+ * @ref sock_udp_recv_buf, so no work buffer is needed.
+ *
+ * @param[in]  sock     UDP sock to receive from
+ * @param[in]  fd       Open file to write to
+ * @param[in]  len      Number of bytes to receive
+ * @param[in]  timeout  Timeout for each datagram in microseconds
+ * @param[out] remote   Remote end point of the last datagram, may be NULL
+ *
+ * @return  number of bytes written, at least @p len unless the timeout
+ *          expired before
+ * @return  negative error from @ref sock_udp_recv_buf or @ref vfs_write
+ */
+ssize_t vfs_recvfile_udp(sock_udp_t *sock, int fd, size_t len, uint32_t timeout,
+                         sock_udp_ep_t *remote);
+#endif
+
 /**
  * @brief   Checks if @p path is a file or a directory.
  *
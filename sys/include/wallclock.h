@@ -0,0 +1,166 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_wallclock Wall clock time
+ * @ingroup     sys
+ * @brief       Disciplined wall clock time on top of ZTIMER64_USEC
+ *
+ * The wall clock is ZTIMER64_USEC plus an offset and a frequency correction.
+ * Reading it costs one ztimer64_now() and some 64 bit arithmetic, so it is
+ * a cheap replacement for reading an (external) RTC again and again.
+ *
+ * Reference time samples, e.g. from SNTP (done automatically by
+ * @ref sntp_sync() if this module is used) or PTP (see
+ * @ref wallclock_sync_ptp()), are fed to @ref wallclock_discipline(). Small
+ * offsets are slewed at most @ref CONFIG_WALLCLOCK_SLEW_MAX_PPM, so the clock
+ * never jumps and never runs backwards. The frequency error of the local
+ * oscillator is estimated from consecutive samples and compensated.
+ * Only offsets larger than @ref CONFIG_WALLCLOCK_STEP_THRESHOLD_US step the
+ * clock.
+ *
+ * If `periph_rtc` is used, the wall clock is initialized from the RTC once
+ * during auto_init. With `libc_gettimeofday`, gettimeofday() returns the wall
+ * clock time.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Wall clock time API
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ */
+
+#ifndef WALLCLOCK_H
+#define WALLCLOCK_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Offsets larger than this (in microseconds) step the clock
+ */
+#ifndef CONFIG_WALLCLOCK_STEP_THRESHOLD_US
+#define CONFIG_WALLCLOCK_STEP_THRESHOLD_US  (128000LU)
+#endif
+
+/**
+ * @brief   Maximum rate in ppm at which offsets are slewed
+ */
+#ifndef CONFIG_WALLCLOCK_SLEW_MAX_PPM
+#define CONFIG_WALLCLOCK_SLEW_MAX_PPM       (500U)
+#endif
+
+/**
+ * @brief   Maximum frequency correction in ppb
+ */
+#ifndef CONFIG_WALLCLOCK_FREQ_MAX_PPB
+#define CONFIG_WALLCLOCK_FREQ_MAX_PPB       (500000L)
+#endif
+
+/**
+ * @brief   Fraction (as 1 / n) of a measured frequency error that is
+ *          corrected per sample
+ *
+ * Larger values filter out more noise of the reference, but converge slower.
+ */
+#ifndef CONFIG_WALLCLOCK_FREQ_GAIN_DIV
+#define CONFIG_WALLCLOCK_FREQ_GAIN_DIV      (2U)
+#endif
+
+/**
+ * @brief   Get the wall clock time
+ *
+ * May be called from interrupt context.
+ *
+ * @return  microseconds since 1970-01-01 00:00:00 UTC
+ */
+uint64_t wallclock_now_usec(void);
+
+/**
+ * @brief   Get the wall clock time as `struct timespec`
+ *
+ * @param[out]  ts      seconds and nanoseconds since 1970-01-01 00:00:00 UTC
+ */
+void wallclock_gettime(struct timespec *ts);
+
+/**
+ * @brief   Get the wall clock time as broken down UTC time
+ *
+ * @pre     The wall clock time is after 01.01.$RIOT_EPOCH
+ *
+ * @param[out]  t       current UTC time
+ */
+void wallclock_get_tm(struct tm *t);
+
+/**
+ * @brief   Set the wall clock time, stepping it if needed
+ *
+ * The frequency correction is kept, the next sample passed to @ref
+ * wallclock_discipline() is only used for the offset.
+ *
+ * @param[in]   usec    microseconds since 1970-01-01 00:00:00 UTC
+ */
+void wallclock_set(uint64_t usec);
+
+/**
+ * @brief   Slew the wall clock by @p offset, like adjtime()
+ *
+ * The offset is applied gradually, at most @ref CONFIG_WALLCLOCK_SLEW_MAX_PPM.
+ * It replaces the part of previous offsets that has not been applied yet.
+ *
+ * @param[in]   offset  offset to apply in microseconds
+ */
+void wallclock_adjust(int64_t offset);
+
+/**
+ * @brief   Discipline the wall clock with a reference time sample
+ *
+ * @param[in]   usec    reference time in microseconds since
+ *                      1970-01-01 00:00:00 UTC
+ * @param[in]   local   ZTIMER64_USEC time at which @p usec was valid,
+ *                      samples must be passed in order
+ *
+ * @return  offset of the wall clock to the reference in microseconds
+ *          (positive if the wall clock was behind)
+ */
+int64_t wallclock_discipline(uint64_t usec, uint64_t local);
+
+/**
+ * @brief   Get the current frequency correction
+ *
+ * @return  correction applied to ZTIMER64_USEC in ppb
+ */
+int32_t wallclock_get_freq_ppb(void);
+
+/**
+ * @brief   Check if the wall clock has been set
+ *
+ * @return  true if the time was set from a RTC, a reference or by
+ *          @ref wallclock_set(), false if it counts from 1970 since boot
+ */
+bool wallclock_is_set(void);
+
+/**
+ * @brief   Discipline the wall clock with the PTP clock
+ *
+ * Only available with `periph_ptp`.
+ */
+void wallclock_sync_ptp(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* WALLCLOCK_H */
+/** @} */
@@ -157,6 +157,20 @@
  * to be shown whether the increased complexity would lead to better
  * performance for any reasonable amount of active timers.
  *
+ * For applications with many concurrently active timers, the
+ * `ztimer_heap` module replaces the list by a pairing heap:
+ *
+ * - two more pointers per timer object ("child" and "previous")
+ * - constant get_min()
+ * - O(1) insertion, O(log n) amortized removal of timer objects
+ * - timers with the same target time trigger in unspecified order
+ *
+ * In that case, every timer stores its absolute target time relative to the
+ * (wrapping) clock base time B. Timers that are due, but have not been
+ * handled yet, are moved from the heap to a FIFO list, so that the base time
+ * can be advanced past them while keeping the full uint32_t range for all
+ * other timers.
+ *
  *
  * ## Clock extension
  *
@@ -297,8 +311,18 @@ typedef void (*ztimer_callback_t)(void *arg);
  * @brief   Minimum information for each timer
  */
 struct ztimer_base {
-    ztimer_base_t *next;        /**< next timer in list */
-    uint32_t offset;            /**< offset from last timer in list */
+    ztimer_base_t *next;        /**< next timer in list, or next sibling
+                                     in the timer heap */
+    uint32_t offset;            /**< offset from last timer in list, or
+                                     target time in the timer heap */
+#if MODULE_ZTIMER_SLACK || DOXYGEN
+    uint32_t slack;             /**< ticks the timer may trigger late */
+#endif
+#if MODULE_ZTIMER_HEAP || DOXYGEN
+    ztimer_base_t *child;       /**< first child in the timer heap */
+    ztimer_base_t *prev;        /**< parent or previous sibling in the timer
+                                     heap, NULL if the timer is not set */
+#endif
 };
 
 /**
@@ -363,6 +387,18 @@ typedef struct {
 #endif
 } ztimer_ops_t;
 
+/**
+ * @brief   Interrupt statistics of a ztimer clock
+ *
+ * Durations are given in ticks of the lower level timer of the clock.
+ */
+typedef struct {
+    uint32_t isr_count;             /**< number of handler invocations      */
+    uint32_t triggered;             /**< number of timer callbacks executed */
+    uint32_t handler_max;           /**< longest handler duration           */
+    uint64_t handler_sum;           /**< total handler duration             */
+} ztimer_stats_t;
+
 /**
  * @brief   ztimer device structure
  */
@@ -370,6 +406,16 @@ struct ztimer_clock {
     ztimer_base_t list;             /**< list of active timers              */
     const ztimer_ops_t *ops;        /**< pointer to methods structure       */
     ztimer_base_t *last;            /**< last timer in queue, for _is_set() */
+#if MODULE_ZTIMER_HEAP || DOXYGEN
+    ztimer_base_t *heap;            /**< root of the heap of pending timers */
+#endif
+#if MODULE_ZTIMER_SLACK || DOXYGEN
+    uint32_t coalesced;             /**< timers triggered in the interrupt of
+                                         an earlier timer                   */
+#endif
+#if MODULE_ZTIMER_STATS || DOXYGEN
+    ztimer_stats_t stats;           /**< interrupt statistics               */
+#endif
     uint16_t adjust_set;            /**< will be subtracted on every set()  */
     uint16_t adjust_sleep;          /**< will be subtracted on every sleep(),
                                          in addition to adjust_set          */
@@ -385,6 +431,9 @@ struct ztimer_clock {
     uint32_t lower_last;            /**< timer value at last now() call     */
     ztimer_now_t checkpoint;        /**< cumulated time at last now() call  */
 #endif
+#if MODULE_ZTIMER_NOW64 || DOXYGEN
+    uint32_t checkpoint_high;       /**< upper 32 bits of the cumulated time */
+#endif
 #if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND || DOXYGEN
     uint8_t block_pm_mode;          /**< min. pm mode to block for the clock to run
                                          don't use in combination with ztimer_ondemand! */
@@ -459,6 +508,26 @@ static inline bool ztimer_release(ztimer_clock_t *clock)
  */
 uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val);
 
+/**
+ * @brief   Set a timer on a clock, allowing it to trigger late
+ *
+ * Same as @ref ztimer_set, but @p timer may trigger up to @p slack ticks after
+ * its target. With the `ztimer_slack` module, ztimer uses this to handle
+ * timers with overlapping windows in a single interrupt, reducing the number
+ * of wakeups. Without the module, or with `ztimer_heap`, @p slack is ignored
+ * and this behaves like @ref ztimer_set.
+ *
+ * @param[in]   clock       ztimer clock to operate on
+ * @param[in]   timer       timer entry to set
+ * @param[in]   val         timer target (relative ticks from now)
+ * @param[in]   slack       maximum delay acceptable for @p timer in ticks
+ *
+ * @return The value of @ref ztimer_now() that @p timer was set against
+ *         (`now() + @p val = absolute trigger time`).
+ */
+uint32_t ztimer_set_slack(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val,
+                          uint32_t slack);
+
 /**
  * @brief   Check if a timer is currently active
  *
@@ -470,6 +539,62 @@ uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val);
  */
 unsigned ztimer_is_set(const ztimer_clock_t *clock, const ztimer_t *timer);
 
+/**
+ * @brief   Get the time until the earliest timer on a clock expires
+ *
+ * This is intended for power management, e.g. to determine how long the
+ * system may sleep before a timer needs to be serviced.
+ *
+ * @param[in]   clock       ztimer clock to operate on
+ *
+ * With `ztimer_slack`, this includes the delay that timers set with
+ * @ref ztimer_set_slack accept, as the clock is only serviced then.
+ *
+ * @return  ticks of @p clock until the next timer expires, 0 if it is
+ *          already due
+ * @retval  UINT32_MAX if no timer is set on @p clock
+ */
+uint32_t ztimer_until_next(ztimer_clock_t *clock);
+
+#if MODULE_ZTIMER_SLACK || DOXYGEN
+/**
+ * @brief   Get the number of timers that triggered without an interrupt of
+ *          their own
+ *
+ * Counts the timers that were handled in the interrupt of an earlier timer,
+ * e.g. because of coalescing via @ref ztimer_set_slack.
+ *
+ * @param[in]   clock       ztimer clock to operate on
+ *
+ * @return  number of coalesced timer expirations on @p clock
+ */
+static inline uint32_t ztimer_coalesced(const ztimer_clock_t *clock)
+{
+    return clock->coalesced;
+}
+#endif
+
+#if MODULE_ZTIMER_STATS || DOXYGEN
+/**
+ * @brief   Get the interrupt statistics of a clock
+ *
+ * The duration of a handler invocation is measured with the `now()` method of
+ * the lower level timer, in its ticks. It includes the time spent in the
+ * callbacks of the timers triggered.
+ *
+ * @param[in]   clock       ztimer clock to operate on
+ * @param[out]  stats       the statistics of @p clock
+ */
+void ztimer_stats_get(ztimer_clock_t *clock, ztimer_stats_t *stats);
+
+/**
+ * @brief   Reset the interrupt statistics of a clock
+ *
+ * @param[in]   clock       ztimer clock to operate on
+ */
+void ztimer_stats_reset(ztimer_clock_t *clock);
+#endif
+
 /**
  * @brief   Remove a timer from a clock
  *
@@ -540,6 +665,30 @@ int ztimer_msg_receive_timeout(ztimer_clock_t *clock, msg_t *msg,
  */
 ztimer_now_t _ztimer_now_extend(ztimer_clock_t *clock);
 
+/**
+ * @brief   Check if ztimer keeps track of the time of a clock itself
+ *
+ * @internal
+ *
+ * This is the case for clocks narrower than 32 bit, and for all clocks with
+ * the `ztimer_now64` module.
+ *
+ * @param[in]   clock          ztimer clock to check
+ * @return  true if @p clock is extended by ztimer
+ */
+static inline bool _ztimer_is_extended(const ztimer_clock_t *clock)
+{
+#if MODULE_ZTIMER_NOW64
+    (void)clock;
+    return true;
+#elif MODULE_ZTIMER_EXTEND
+    return clock->max_value < UINT32_MAX;
+#else
+    (void)clock;
+    return false;
+#endif
+}
+
 /**
  * @brief asserts the given clock to be active
  *
@@ -669,11 +818,7 @@ static inline ztimer_now_t ztimer_now(ztimer_clock_t *clock)
     _ztimer_assert_clock_active(clock);
 #endif
 
-#if MODULE_ZTIMER_EXTEND
-    if (clock->max_value < UINT32_MAX) {
-#else
-    if (0) {
-#endif
+    if (_ztimer_is_extended(clock)) {
         return _ztimer_now_extend(clock);
     }
     else {
@@ -681,6 +826,26 @@ static inline ztimer_now_t ztimer_now(ztimer_clock_t *clock)
     }
 }
 
+#if MODULE_ZTIMER_NOW64 || DOXYGEN
+/**
+ * @brief   Get the current time from a clock as 64 bit value
+ *
+ * Unlike @ref ztimer_now, the value does not wrap around. It counts the ticks
+ * since the clock was initialized, extended from the 32 bit time in the same
+ * place that extends narrower hardware timers, so no additional bookkeeping is
+ * required. ztimer64 clocks use this if available.
+ *
+ * @note    Requires the `ztimer_now64` module, which makes ztimer track the
+ *          time of every clock, setting an intermediate timer at least every
+ *          (2^31) ticks.
+ *
+ * @param[in]   clock          ztimer clock to operate on
+ *
+ * @return  Current count on the clock @p clock
+ */
+uint64_t ztimer_now64(ztimer_clock_t *clock);
+#endif
+
 /**
  * @brief Suspend the calling thread until the time (@p last_wakeup + @p period)
  *
@@ -809,7 +974,7 @@ void ztimer_init(void);
  * @brief   Initialize possible ztimer extension intermediate timer
  *
  * This will basically just set a timer to (clock->max_value >> 1), *if*
- * max_value is not UINT32_MAX.
+ * max_value is not UINT32_MAX (or the `ztimer_now64` module is used).
  *
  * This is called automatically by all ztimer backends and extension modules.
  *
@@ -817,7 +982,7 @@ void ztimer_init(void);
  */
 static inline void ztimer_init_extend(ztimer_clock_t *clock)
 {
-    if (clock->max_value < UINT32_MAX) {
+    if (_ztimer_is_extended(clock)) {
         clock->ops->set(clock, clock->max_value >> 1);
     }
 }
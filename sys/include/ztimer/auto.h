@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_ztimer_auto ztimer auto clock selection
+ * @ingroup     sys_ztimer
+ * @brief       Microsecond timeouts that use low power clocks while waiting
+ *
+ * A timeout set on ZTIMER_USEC keeps the high speed timer running, and with
+ * `pm_layered` blocks the power modes it cannot run in, for the whole
+ * duration. A ztimer_auto_t takes a timeout in microseconds as well, but only
+ * sets it on ZTIMER_USEC if it is short. Longer timeouts are first set on
+ * ZTIMER_SEC (if used) or ZTIMER_MSEC, armed to expire a guard time before the
+ * deadline, and re-armed on the next finer clock as the deadline approaches.
+ * The callback is always executed by the ZTIMER_USEC interrupt.
+ *
+ * ZTIMER_MSEC is the time reference of long timeouts: with `ztimer_ondemand`
+ * it stays acquired while a timeout is pending. This is for free if
+ * ZTIMER_MSEC is backed by the RTT, which is what makes this module useful.
+ * A timeout longer than @ref CONFIG_ZTIMER_AUTO_USEC_MAX is never early, but
+ * may be up to one ZTIMER_MSEC tick late.
+ *
+ * ```
+ * static ztimer_auto_t timeout = { .callback = on_timeout };
+ *
+ * ztimer_auto_set(&timeout, 30 * US_PER_SEC);
+ * ```
+ *
+ * @{
+ *
+ * @file
+ * @brief       ztimer auto clock selection API
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ */
+
+#ifndef ZTIMER_AUTO_H
+#define ZTIMER_AUTO_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ztimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Longest timeout in microseconds that is set on ZTIMER_USEC directly
+ */
+#ifndef CONFIG_ZTIMER_AUTO_USEC_MAX
+#define CONFIG_ZTIMER_AUTO_USEC_MAX     (10000LU)
+#endif
+
+/**
+ * @brief   Time in milliseconds before the deadline at which a timeout is
+ *          moved from ZTIMER_MSEC to ZTIMER_USEC
+ *
+ * Must cover one tick of ZTIMER_MSEC and its interrupt latency.
+ */
+#ifndef CONFIG_ZTIMER_AUTO_GUARD_MSEC
+#define CONFIG_ZTIMER_AUTO_GUARD_MSEC   (2U)
+#endif
+
+/**
+ * @brief   Shortest remaining time in milliseconds that is spent on ZTIMER_SEC
+ *
+ * Only used if the `ztimer_sec` module is. The timeout is moved to ZTIMER_MSEC
+ * two seconds before the deadline.
+ */
+#ifndef CONFIG_ZTIMER_AUTO_SEC_MIN_MSEC
+#define CONFIG_ZTIMER_AUTO_SEC_MIN_MSEC (60000LU)
+#endif
+
+/**
+ * @brief   ztimer auto structure
+ *
+ * Only @ref ztimer_auto_t::callback and @ref ztimer_auto_t::arg are to be
+ * set by the user, the remaining fields are private.
+ */
+typedef struct {
+    ztimer_t timer;             /**< timer set on the current clock */
+    ztimer_clock_t *clock;      /**< clock @ref timer is set on, or NULL */
+    ztimer_callback_t callback; /**< called on ZTIMER_USEC at the deadline */
+    void *arg;                  /**< argument of @ref callback */
+    uint32_t target;            /**< deadline in ZTIMER_MSEC ticks */
+    uint16_t remainder;         /**< microseconds after @ref target */
+} ztimer_auto_t;
+
+/**
+ * @brief   Set a timeout on the most power efficient clock
+ *
+ * Setting a pending timeout restarts it.
+ *
+ * @param[in,out]   timer       timeout to set, with callback and arg set
+ * @param[in]       timeout     timeout in microseconds
+ */
+void ztimer_auto_set(ztimer_auto_t *timer, uint32_t timeout);
+
+/**
+ * @brief   Remove a timeout
+ *
+ * @param[in,out]   timer       timeout to remove
+ *
+ * @return  true if the timeout was pending, false otherwise
+ */
+bool ztimer_auto_remove(ztimer_auto_t *timer);
+
+/**
+ * @brief   Check if a timeout is pending
+ *
+ * @param[in]   timer       timeout to check
+ *
+ * @return  true if the callback has yet to be called, false otherwise
+ */
+static inline bool ztimer_auto_is_set(const ztimer_auto_t *timer)
+{
+    return timer->clock != NULL;
+}
+
+/**
+ * @brief   Put the calling thread to sleep for the specified number of
+ *          microseconds, using low power clocks where possible
+ *
+ * @param[in]   duration    duration of the sleep in microseconds
+ */
+void ztimer_auto_sleep(uint32_t duration);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZTIMER_AUTO_H */
+/** @} */
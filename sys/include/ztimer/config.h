@@ -198,6 +198,17 @@ extern "C" {
 #define CONFIG_ZTIMER_AUTO_ADJUST_SETTLE    0
 #endif
 
+/**
+ * @brief   Offset in the RTC memory at which the values measured by @ref
+ *          pseudomodule_ztimer_auto_adjust are stored when using
+ *          `ztimer_auto_adjust_rtc_mem`.
+ *
+ *          The stored record occupies 8 bytes.
+ */
+#ifndef CONFIG_ZTIMER_AUTO_ADJUST_RTC_MEM_OFFSET
+#define CONFIG_ZTIMER_AUTO_ADJUST_RTC_MEM_OFFSET    0
+#endif
+
 #ifdef __cplusplus
 }
 #endif
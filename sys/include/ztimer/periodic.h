@@ -15,10 +15,19 @@
  * once each interval until the timer is either stopped using
  * ztimer_periodic_stop or the callback function returns a non-zero value.
  *
+ * Each trigger is scheduled relative to the ideal time of the previous one,
+ * not to the time the callback was executed, so latencies do not accumulate.
+ *
  * Should the timer underflow ((time_at_interrupt + interval) % 2**32 >
  * interval), the next timer will be scheduled with an offset of zero, thus
  * fire right away.  This leads to a callback for each missed tick, until the
- * original period can be honoured again.
+ * original period can be honoured again. With ztimer_periodic_skip_overruns(),
+ * the missed ticks are skipped instead and the timer triggers at the next ideal
+ * time still ahead. Either way, ztimer_periodic_overruns() counts them.
+ *
+ * With the `ztimer_periodic_jitter` pseudomodule, a histogram of the latency
+ * of each trigger relative to its ideal time is kept, see @ref
+ * ztimer_periodic_jitter_t.
  *
  * Example:
  *
@@ -88,6 +97,26 @@ extern "C" {
  */
 typedef bool (*ztimer_periodic_callback_t)(void *);
 
+/**
+ * @brief   Number of buckets of the jitter histogram
+ */
+#ifndef CONFIG_ZTIMER_PERIODIC_JITTER_BUCKETS
+#define CONFIG_ZTIMER_PERIODIC_JITTER_BUCKETS   12
+#endif
+
+/**
+ * @brief   Histogram of the trigger latency of a periodic timer
+ *
+ * The buckets are logarithmic: bucket 0 counts triggers without latency,
+ * bucket i > 0 those with a latency of 2^(i-1) to 2^i - 1 ticks. The last
+ * bucket also counts all larger latencies. Triggers ahead of their ideal time
+ * are counted in bucket 0.
+ */
+typedef struct {
+    uint32_t buckets[CONFIG_ZTIMER_PERIODIC_JITTER_BUCKETS];    /**< trigger counts */
+    uint32_t max;                           /**< largest latency in ticks       */
+} ztimer_periodic_jitter_t;
+
 /**
  * @brief   ztimer periodic structure
  */
@@ -98,6 +127,12 @@ typedef struct {
     ztimer_now_t last;                      /**< last trigger time                  */
     ztimer_periodic_callback_t callback;    /**< called on each trigger             */
     void *arg;                              /**< argument for callback              */
+    uint32_t overruns;                      /**< number of ticks missed             */
+    bool skip_overruns;                     /**< skip instead of catch up missed
+                                                 ticks                              */
+#if MODULE_ZTIMER_PERIODIC_JITTER || DOXYGEN
+    ztimer_periodic_jitter_t jitter;        /**< trigger latency histogram          */
+#endif
 } ztimer_periodic_t;
 
 /**
@@ -139,6 +174,53 @@ void ztimer_periodic_start(ztimer_periodic_t *timer);
  */
 void ztimer_periodic_stop(ztimer_periodic_t *timer);
 
+/**
+ * @brief   Skip missed ticks instead of catching up on them
+ *
+ * By default, the callback is executed right away for every tick missed, e.g.
+ * because of a callback taking longer than the interval. With @p skip set,
+ * the timer triggers at the next ideal time still ahead instead.
+ *
+ * @param[in]   timer       periodic timer object to configure
+ * @param[in]   skip        true to skip missed ticks
+ */
+static inline void ztimer_periodic_skip_overruns(ztimer_periodic_t *timer,
+                                                 bool skip)
+{
+    timer->skip_overruns = skip;
+}
+
+/**
+ * @brief   Get the number of ticks missed by a periodic timer
+ *
+ * A tick is missed if its ideal time has already passed when the timer is
+ * re-armed after the callback of the previous tick.
+ *
+ * @param[in]   timer       periodic timer object to query
+ *
+ * @return  number of ticks that were caught up on or skipped since init
+ */
+static inline uint32_t ztimer_periodic_overruns(const ztimer_periodic_t *timer)
+{
+    return timer->overruns;
+}
+
+#if MODULE_ZTIMER_PERIODIC_JITTER || DOXYGEN
+/**
+ * @brief   Print the jitter histogram of a periodic timer
+ *
+ * @param[in]   timer       periodic timer object to print the histogram of
+ */
+void ztimer_periodic_jitter_print(const ztimer_periodic_t *timer);
+
+/**
+ * @brief   Clear the jitter histogram of a periodic timer
+ *
+ * @param[in]   timer       periodic timer object to clear the histogram of
+ */
+void ztimer_periodic_jitter_reset(ztimer_periodic_t *timer);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -48,6 +48,11 @@
  *          timer (e.g., periph_rtt). ztimer64_usec will almost certainly block
  *          low-power sleep.
  *
+ * With the `ztimer_now64` module, the base clock extends its time to 64 bit
+ * itself (see @ref ztimer_now64). ztimer64 then only keeps a timer on the base
+ * clock while ztimer64 timers are set, and @ref ztimer64_now just reads the
+ * time of the base clock.
+ *
  * TODO:
  *  - some explicit power management
  *  - implement adjust_set and adjust_sleep API
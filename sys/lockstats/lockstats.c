@@ -0,0 +1,221 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_lockstats
+ * @{
+ *
+ * @file
+ * @brief       Lock contention statistics implementation
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "cib.h"
+#include "irq.h"
+#include "lockstats.h"
+#include "thread.h"
+#include "ztimer.h"
+
+static lockstats_mutex_t _mutexes[CONFIG_LOCKSTATS_MUTEX_NUMOF];
+static lockstats_msg_queue_t _queues[KERNEL_PID_LAST + 1];
+static uint32_t _untracked;
+
+/* mutexes are used before ztimer is initialized */
+static bool _ready;
+
+void auto_init_lockstats(void)
+{
+    ztimer_acquire(ZTIMER_USEC);
+    _ready = true;
+}
+
+/* must be called with IRQs disabled */
+static lockstats_mutex_t *_find(const mutex_t *mutex, bool add)
+{
+    lockstats_mutex_t *free = NULL;
+
+    for (unsigned i = 0; i < CONFIG_LOCKSTATS_MUTEX_NUMOF; i++) {
+        if (_mutexes[i].mutex == mutex) {
+            return &_mutexes[i];
+        }
+        if (!free && !_mutexes[i].mutex) {
+            free = &_mutexes[i];
+        }
+    }
+
+    if (add && free) {
+        memset(free, 0, sizeof(*free));
+        free->mutex = mutex;
+    }
+
+    return add ? free : NULL;
+}
+
+int lockstats_mutex_name(const mutex_t *mutex, const char *name)
+{
+    unsigned state = irq_disable();
+    lockstats_mutex_t *entry = _find(mutex, true);
+
+    if (entry) {
+        entry->name = name;
+    }
+    irq_restore(state);
+
+    return entry ? 0 : -ENOMEM;
+}
+
+bool lockstats_mutex_get(unsigned idx, lockstats_mutex_t *stats)
+{
+    if (idx >= CONFIG_LOCKSTATS_MUTEX_NUMOF) {
+        return false;
+    }
+
+    unsigned state = irq_disable();
+    *stats = _mutexes[idx];
+    irq_restore(state);
+
+    return stats->mutex != NULL;
+}
+
+uint32_t lockstats_untracked(void)
+{
+    return _untracked;
+}
+
+void lockstats_msg_queue_get(kernel_pid_t pid, lockstats_msg_queue_t *stats)
+{
+    unsigned state = irq_disable();
+    *stats = _queues[pid];
+    irq_restore(state);
+}
+
+void lockstats_reset(void)
+{
+    unsigned state = irq_disable();
+
+    for (unsigned i = 0; i < CONFIG_LOCKSTATS_MUTEX_NUMOF; i++) {
+        lockstats_mutex_t *entry = &_mutexes[i];
+
+        *entry = (lockstats_mutex_t){
+            .mutex = entry->mutex,
+            .name = entry->name,
+            .locked_at = entry->locked_at,
+            .held = entry->held,
+        };
+    }
+    memset(_queues, 0, sizeof(_queues));
+    _untracked = 0;
+
+    irq_restore(state);
+}
+
+static void _lock(lockstats_mutex_t *entry, uint32_t now)
+{
+    entry->locks++;
+    entry->locked_at = now;
+    entry->held = true;
+}
+
+uint32_t lockstats_mutex_block(const mutex_t *mutex)
+{
+    if (!_ready) {
+        return 0;
+    }
+
+    unsigned state = irq_disable();
+    lockstats_mutex_t *entry = _find(mutex, true);
+
+    if (entry) {
+        entry->contentions++;
+    }
+    else {
+        _untracked++;
+    }
+    irq_restore(state);
+
+    return ztimer_now(ZTIMER_USEC);
+}
+
+void lockstats_mutex_locked(const mutex_t *mutex)
+{
+    if (!_ready) {
+        return;
+    }
+
+    unsigned state = irq_disable();
+    lockstats_mutex_t *entry = _find(mutex, false);
+
+    if (entry) {
+        _lock(entry, ztimer_now(ZTIMER_USEC));
+    }
+    irq_restore(state);
+}
+
+void lockstats_mutex_waited(const mutex_t *mutex, uint32_t since)
+{
+    if (!_ready) {
+        return;
+    }
+
+    unsigned state = irq_disable();
+    lockstats_mutex_t *entry = _find(mutex, false);
+
+    if (entry) {
+        uint32_t now = ztimer_now(ZTIMER_USEC);
+        uint32_t wait = now - since;
+
+        entry->wait_total += wait;
+        if (wait > entry->wait_max) {
+            entry->wait_max = wait;
+        }
+        _lock(entry, now);
+    }
+    irq_restore(state);
+}
+
+void lockstats_mutex_unlocked(const mutex_t *mutex)
+{
+    if (!_ready) {
+        return;
+    }
+
+    unsigned state = irq_disable();
+    lockstats_mutex_t *entry = _find(mutex, false);
+
+    if (entry && entry->held) {
+        uint32_t hold = ztimer_now(ZTIMER_USEC) - entry->locked_at;
+
+        entry->hold_total += hold;
+        if (hold > entry->hold_max) {
+            entry->hold_max = hold;
+        }
+        entry->held = false;
+    }
+    irq_restore(state);
+}
+
+void lockstats_msg_queued(const thread_t *thread)
+{
+    lockstats_msg_queue_t *q = &_queues[thread->pid];
+    unsigned n = cib_avail(&thread->msg_queue);
+
+    if (n > q->high_watermark) {
+        q->high_watermark = n;
+    }
+}
+
+void lockstats_msg_queue_full(const thread_t *thread)
+{
+    _queues[thread->pid].full++;
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_log_deferred log_deferred: deferred log formatting
+ * @ingroup     sys
+ * @brief       Log module that moves the printf formatting out of the caller
+ *
+ * A call to @ref LOG_INFO and friends does not format the message. Only the
+ * address of the format string and the raw values of the arguments are
+ * copied into a ring buffer, which costs a few dozen bytes of stack and a
+ * scan over the format string. A thread with the lowest priority above idle
+ * formats and prints the buffered messages once the CPU has nothing better
+ * to do.
+ *
+ * Arguments are captured as described by the conversion specifiers of the
+ * format string. Strings passed with `%s` are copied, as they may be gone by
+ * the time the message is printed; long strings are truncated to fit into
+ * @ref CONFIG_LOG_DEFERRED_ARGS_MAX. `%n` is not supported.
+ *
+ * Messages that do not fit into the ring buffer are dropped, the number of
+ * dropped messages is printed with the next message that gets through.
+ * Messages still in the buffer are lost when the system crashes, so use the
+ * plain printf based logging when chasing a crash.
+ *
+ * @{
+ *
+ * @file
+ * @brief       log_module header
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ */
+
+#ifndef LOG_MODULE_H
+#define LOG_MODULE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Size of the ring buffer holding the pending messages in bytes
+ *
+ * @note    Must be a power of two
+ */
+#ifndef CONFIG_LOG_DEFERRED_BUF_SIZE
+#define CONFIG_LOG_DEFERRED_BUF_SIZE    (512U)
+#endif
+
+/**
+ * @brief   Maximum size of the captured arguments of a message in bytes
+ */
+#ifndef CONFIG_LOG_DEFERRED_ARGS_MAX
+#define CONFIG_LOG_DEFERRED_ARGS_MAX    (48U)
+#endif
+
+/**
+ * @brief   Priority of the thread printing the messages
+ */
+#ifndef LOG_DEFERRED_PRIO
+#define LOG_DEFERRED_PRIO               (THREAD_PRIORITY_IDLE - 1)
+#endif
+
+/**
+ * @brief   Stack size of the thread printing the messages
+ */
+#ifndef LOG_DEFERRED_STACKSIZE
+#define LOG_DEFERRED_STACKSIZE          (THREAD_STACKSIZE_DEFAULT + \
+                                         THREAD_EXTRA_STACKSIZE_PRINTF)
+#endif
+
+/**
+ * @brief log_write overridden function
+ *
+ * Queues the message for printing by the log thread.
+ *
+ * @param[in] level     (unused)
+ * @param[in] format    Format string, must stay valid until printed
+ */
+void log_write(unsigned level, const char *format, ...)
+    __attribute__((format(printf, 2, 3)));
+
+#ifdef __cplusplus
+}
+#endif
+/**@}*/
+#endif /* LOG_MODULE_H */
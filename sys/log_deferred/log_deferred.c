@@ -0,0 +1,400 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_log_deferred
+ * @{
+ *
+ * @file
+ * @brief       Deferred log formatting implementation
+ *
+ * A message is stored in the ring buffer as the address of its format
+ * string, the length of the captured arguments as one byte and the
+ * arguments. Both the producer and the log thread walk the format string
+ * with _parse_spec(), so they agree on the layout of the arguments.
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "irq.h"
+#include "log.h"
+#include "mutex.h"
+#include "thread.h"
+#include "tsrb.h"
+
+static_assert((CONFIG_LOG_DEFERRED_BUF_SIZE & (CONFIG_LOG_DEFERRED_BUF_SIZE - 1)) == 0,
+              "CONFIG_LOG_DEFERRED_BUF_SIZE must be a power of two");
+static_assert(CONFIG_LOG_DEFERRED_ARGS_MAX <= UINT8_MAX,
+              "CONFIG_LOG_DEFERRED_ARGS_MAX must fit into one byte");
+
+/**
+ * @brief   Type of the argument of a conversion specification
+ */
+typedef enum {
+    ARG_NONE,           /**< `%%` */
+    ARG_INT,
+    ARG_LONG,
+    ARG_LLONG,
+    ARG_SIZE,
+    ARG_INTMAX,
+    ARG_PTRDIFF,
+    ARG_PTR,
+    ARG_STR,
+    ARG_DOUBLE,
+    ARG_LDOUBLE,
+} arg_type_t;
+
+/**
+ * @brief   Parsed conversion specification
+ */
+typedef struct {
+    arg_type_t type;    /**< type of the converted argument */
+    uint8_t stars;      /**< number of `*` for width and precision */
+    int prec;           /**< literal precision, -1 if none is given */
+} spec_t;
+
+static uint8_t _buf[CONFIG_LOG_DEFERRED_BUF_SIZE];
+static tsrb_t _rb = TSRB_INIT(_buf);
+static mutex_t _pending = MUTEX_INIT_LOCKED;
+static unsigned _dropped;
+
+static char _stack[LOG_DEFERRED_STACKSIZE];
+
+/* fmt points behind the '%', returns the position behind the specification */
+static const char *_parse_spec(const char *fmt, spec_t *spec)
+{
+    spec->stars = 0;
+    spec->prec = -1;
+
+    while (*fmt && strchr("-+ #0", *fmt)) {
+        fmt++;
+    }
+    if (*fmt == '*') {
+        spec->stars++;
+        fmt++;
+    }
+    while ((*fmt >= '0') && (*fmt <= '9')) {
+        fmt++;
+    }
+    if (*fmt == '.') {
+        fmt++;
+        if (*fmt == '*') {
+            spec->stars++;
+            fmt++;
+        }
+        else {
+            spec->prec = 0;
+            while ((*fmt >= '0') && (*fmt <= '9')) {
+                spec->prec = spec->prec * 10 + (*fmt++ - '0');
+            }
+        }
+    }
+
+    arg_type_t type = ARG_INT;
+    switch (*fmt) {
+    case 'h':
+        fmt += (fmt[1] == 'h') ? 2 : 1;
+        break;
+    case 'l':
+        if (fmt[1] == 'l') {
+            type = ARG_LLONG;
+            fmt++;
+        }
+        else {
+            type = ARG_LONG;
+        }
+        fmt++;
+        break;
+    case 'z':
+        type = ARG_SIZE;
+        fmt++;
+        break;
+    case 'j':
+        type = ARG_INTMAX;
+        fmt++;
+        break;
+    case 't':
+        type = ARG_PTRDIFF;
+        fmt++;
+        break;
+    case 'L':
+        type = ARG_LDOUBLE;
+        fmt++;
+        break;
+    }
+
+    switch (*fmt) {
+    case 'd': case 'i': case 'u': case 'o': case 'x': case 'X':
+        break;
+    case 'c':
+        type = ARG_INT;
+        break;
+    case 'p':
+        type = ARG_PTR;
+        break;
+    case 's':
+        type = ARG_STR;
+        break;
+    case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+        if (type != ARG_LDOUBLE) {
+            type = ARG_DOUBLE;
+        }
+        break;
+    default:
+        /* `%%` and everything we do not know, e.g. `%n` */
+        spec->stars = 0;
+        type = ARG_NONE;
+    }
+    spec->type = type;
+
+    return *fmt ? fmt + 1 : fmt;
+}
+
+static size_t _arg_size(arg_type_t type)
+{
+    switch (type) {
+    case ARG_INT:       return sizeof(int);
+    case ARG_LONG:      return sizeof(long);
+    case ARG_LLONG:     return sizeof(long long);
+    case ARG_SIZE:      return sizeof(size_t);
+    case ARG_INTMAX:    return sizeof(intmax_t);
+    case ARG_PTRDIFF:   return sizeof(ptrdiff_t);
+    case ARG_PTR:       return sizeof(void *);
+    case ARG_DOUBLE:    return sizeof(double);
+    case ARG_LDOUBLE:   return sizeof(long double);
+    default:            return 0;
+    }
+}
+
+/* returns the number of bytes captured or -1 if the arguments do not fit */
+static int _capture(uint8_t *args, const char *fmt, va_list ap)
+{
+    size_t pos = 0;
+    spec_t spec;
+
+    while ((fmt = strchr(fmt, '%'))) {
+        fmt = _parse_spec(fmt + 1, &spec);
+
+        for (unsigned i = 0; i < spec.stars; i++) {
+            int star = va_arg(ap, int);
+            if (pos + sizeof(star) > CONFIG_LOG_DEFERRED_ARGS_MAX) {
+                return -1;
+            }
+            memcpy(&args[pos], &star, sizeof(star));
+            pos += sizeof(star);
+        }
+
+        union {
+            int i;
+            long l;
+            long long ll;
+            size_t z;
+            intmax_t j;
+            ptrdiff_t t;
+            void *p;
+            double d;
+            long double ld;
+        } val;
+
+        switch (spec.type) {
+        case ARG_NONE:      continue;
+        case ARG_INT:       val.i = va_arg(ap, int); break;
+        case ARG_LONG:      val.l = va_arg(ap, long); break;
+        case ARG_LLONG:     val.ll = va_arg(ap, long long); break;
+        case ARG_SIZE:      val.z = va_arg(ap, size_t); break;
+        case ARG_INTMAX:    val.j = va_arg(ap, intmax_t); break;
+        case ARG_PTRDIFF:   val.t = va_arg(ap, ptrdiff_t); break;
+        case ARG_PTR:       val.p = va_arg(ap, void *); break;
+        case ARG_DOUBLE:    val.d = va_arg(ap, double); break;
+        case ARG_LDOUBLE:   val.ld = va_arg(ap, long double); break;
+        case ARG_STR: {
+            const char *s = va_arg(ap, const char *);
+            if (s == NULL) {
+                s = "(null)";
+            }
+            if (pos >= CONFIG_LOG_DEFERRED_ARGS_MAX) {
+                return -1;
+            }
+            size_t max = CONFIG_LOG_DEFERRED_ARGS_MAX - pos - 1;
+            if ((spec.prec >= 0) && ((size_t)spec.prec < max)) {
+                max = spec.prec;
+            }
+            size_t len = strnlen(s, max);
+            memcpy(&args[pos], s, len);
+            args[pos + len] = '\0';
+            pos += len + 1;
+            continue;
+        }
+        }
+
+        size_t size = _arg_size(spec.type);
+        if (pos + size > CONFIG_LOG_DEFERRED_ARGS_MAX) {
+            return -1;
+        }
+        memcpy(&args[pos], &val, size);
+        pos += size;
+    }
+
+    return pos;
+}
+
+void log_write(unsigned level, const char *format, ...)
+{
+    (void)level;
+
+    struct __attribute__((packed)) {
+        const char *format;
+        uint8_t len;
+        uint8_t args[CONFIG_LOG_DEFERRED_ARGS_MAX];
+    } msg;
+
+    va_list ap;
+    va_start(ap, format);
+    int len = _capture(msg.args, format, ap);
+    va_end(ap);
+
+    unsigned state = irq_disable();
+    if ((len < 0)
+        || (tsrb_free(&_rb) < offsetof(__typeof__(msg), args) + (size_t)len)) {
+        _dropped++;
+        irq_restore(state);
+        return;
+    }
+    msg.format = format;
+    msg.len = len;
+    tsrb_add(&_rb, (uint8_t *)&msg, offsetof(__typeof__(msg), args) + (size_t)len);
+    irq_restore(state);
+
+    mutex_unlock(&_pending);
+}
+
+/* the format is a single conversion specification taken from the log call,
+ * whose arguments have been checked by the compiler there */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+static void _print_spec(const char *spec, const int *stars, unsigned nstars,
+                        arg_type_t type, const void *arg)
+{
+#define _PRINT(T)                                                   \
+    do {                                                            \
+        T val;                                                      \
+        memcpy(&val, arg, sizeof(val));                             \
+        switch (nstars) {                                           \
+        case 0: printf(spec, val); break;                           \
+        case 1: printf(spec, stars[0], val); break;                 \
+        default: printf(spec, stars[0], stars[1], val); break;      \
+        }                                                           \
+    } while (0)
+
+    switch (type) {
+    case ARG_INT:       _PRINT(int); break;
+    case ARG_LONG:      _PRINT(long); break;
+    case ARG_LLONG:     _PRINT(long long); break;
+    case ARG_SIZE:      _PRINT(size_t); break;
+    case ARG_INTMAX:    _PRINT(intmax_t); break;
+    case ARG_PTRDIFF:   _PRINT(ptrdiff_t); break;
+    case ARG_PTR:       _PRINT(void *); break;
+    case ARG_STR:       _PRINT(const char *); break;
+    case ARG_DOUBLE:    _PRINT(double); break;
+    case ARG_LDOUBLE:   _PRINT(long double); break;
+    default:            break;
+    }
+#undef _PRINT
+}
+#pragma GCC diagnostic pop
+
+static void _print(const char *fmt, const uint8_t *args)
+{
+    const char *start;
+    spec_t spec;
+
+    while ((start = strchr(fmt, '%'))) {
+        printf("%.*s", (int)(start - fmt), fmt);
+        fmt = _parse_spec(start + 1, &spec);
+
+        if (spec.type == ARG_NONE) {
+            if (*(fmt - 1) == '%') {
+                putchar('%');
+            }
+            continue;
+        }
+
+        int stars[2];
+        memcpy(stars, args, spec.stars * sizeof(int));
+        args += spec.stars * sizeof(int);
+
+        const void *arg = args;
+        const char *str = (const char *)args;
+        if (spec.type == ARG_STR) {
+            arg = &str;
+            args += strlen(str) + 1;
+        }
+        else {
+            args += _arg_size(spec.type);
+        }
+
+        char buf[16];
+        size_t len = fmt - start;
+        if (len < sizeof(buf)) {
+            memcpy(buf, start, len);
+            buf[len] = '\0';
+            _print_spec(buf, stars, spec.stars, spec.type, arg);
+        }
+    }
+    fputs(fmt, stdout);
+}
+
+static void *_log_thread(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        mutex_lock(&_pending);
+
+        while (!tsrb_empty(&_rb)) {
+            struct __attribute__((packed)) {
+                const char *format;
+                uint8_t len;
+            } hdr;
+            uint8_t args[CONFIG_LOG_DEFERRED_ARGS_MAX];
+
+            /* only this thread takes data out of the buffer, so the whole
+             * message is there once its header is */
+            tsrb_get(&_rb, (uint8_t *)&hdr, sizeof(hdr));
+            tsrb_get(&_rb, args, hdr.len);
+
+            unsigned state = irq_disable();
+            unsigned dropped = _dropped;
+            _dropped = 0;
+            irq_restore(state);
+            if (dropped) {
+                printf("log_deferred: %u messages dropped\n", dropped);
+            }
+
+            _print(hdr.format, args);
+        }
+        fflush(stdout);
+    }
+
+    return NULL;
+}
+
+void log_deferred_init(void)
+{
+    thread_create(_stack, sizeof(_stack), LOG_DEFERRED_PRIO,
+                  THREAD_CREATE_STACKTEST, _log_thread, NULL, "log");
+}
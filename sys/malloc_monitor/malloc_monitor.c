@@ -22,6 +22,11 @@
 #include "cpu.h"
 #include "irq.h"
 #include "mutex.h"
+#include "sched.h"
+#include "thread.h"
+#ifdef MODULE_MALLOC_MONITOR_TRACE
+#include "ztimer.h"
+#endif
 
 #include "malloc_monitor.h"
 #include "malloc_monitor_internal.h"
@@ -34,20 +39,95 @@
 #define CONFIG_MODULE_SYS_MALLOC_MONITOR_VERBOSE 0
 #endif
 
+#ifndef CONFIG_MODULE_SYS_MALLOC_MONITOR_TRACE_SIZE
+#define CONFIG_MODULE_SYS_MALLOC_MONITOR_TRACE_SIZE 64
+#endif
+
+/* usage of a thread, or of the code running before the scheduler at index
+ * KERNEL_PID_UNDEF */
+typedef struct {
+    size_t current;
+    size_t high_watermark;
+} _usage_t;
+
 static struct {
     void *addr[CONFIG_MODULE_SYS_MALLOC_MONITOR_SIZE];
     size_t size[CONFIG_MODULE_SYS_MALLOC_MONITOR_SIZE];
+    kernel_pid_t owner[CONFIG_MODULE_SYS_MALLOC_MONITOR_SIZE];
     size_t current;
     size_t high_watermark;
+    _usage_t thread[KERNEL_PID_LAST + 1];
 } malloc_monitor = {
     .addr = {NULL},
     .current = 0,
     .high_watermark = 0,
 };
 
+static void _usage_inc(_usage_t *usage, size_t size)
+{
+    usage->current += size;
+    if (usage->current > usage->high_watermark) {
+        usage->high_watermark = usage->current;
+    }
+}
+
 /* guards access to malloc_monitor */
 static mutex_t _lock;
 
+#ifdef MODULE_MALLOC_MONITOR_TRACE
+/* record of the allocation trace */
+typedef struct {
+    uinttxtptr_t pc;
+    void *addr;
+    uint32_t size;
+    uint32_t time;
+    kernel_pid_t pid;
+    char op;
+} _trace_rec_t;
+
+static struct {
+    _trace_rec_t rec[CONFIG_MODULE_SYS_MALLOC_MONITOR_TRACE_SIZE];
+    uint32_t written;   /* number of records ever written */
+} _trace;
+
+static uint32_t _now(void)
+{
+    static bool acquired;
+
+    /* allocations may happen before auto_init initialized the clock */
+    if (ZTIMER_MSEC->ops == NULL) {
+        return 0;
+    }
+    if (!acquired) {
+        ztimer_acquire(ZTIMER_MSEC);
+        acquired = true;
+    }
+    return ztimer_now(ZTIMER_MSEC);
+}
+
+/* must be called with _lock held */
+static void _trace_add(char op, void *addr, size_t size, uinttxtptr_t pc)
+{
+    _trace_rec_t *rec = &_trace.rec[_trace.written++ %
+                                    CONFIG_MODULE_SYS_MALLOC_MONITOR_TRACE_SIZE];
+
+    rec->pc = pc;
+    rec->addr = addr;
+    rec->size = size;
+    rec->time = _now();
+    rec->pid = thread_getpid();
+    rec->op = op;
+}
+#else
+static inline void _trace_add(char op, void *addr, size_t size, uinttxtptr_t pc)
+{
+    (void)op;
+    (void)addr;
+    (void)size;
+    (void)pc;
+}
+#endif
+
 void malloc_monitor_add(void *ptr, size_t size, uinttxtptr_t pc, char *func_prefix)
 {
     if (ptr == NULL) {
@@ -59,14 +139,19 @@ void malloc_monitor_add(void *ptr, size_t size, uinttxtptr_t pc, char *func_pref
 #endif
     assert(!irq_is_in());
     mutex_lock(&_lock);
+    _trace_add(func_prefix[0], ptr, size, pc);
     for (uint8_t i=0; i<CONFIG_MODULE_SYS_MALLOC_MONITOR_SIZE; i++) {
         if (malloc_monitor.addr[i] == NULL) {
+            kernel_pid_t owner = thread_getpid();
+
             malloc_monitor.addr[i] = ptr;
             malloc_monitor.size[i] = size;
+            malloc_monitor.owner[i] = owner;
             malloc_monitor.current += size;
             if (malloc_monitor.current > malloc_monitor.high_watermark) {
                 malloc_monitor.high_watermark = malloc_monitor.current;
             }
+            _usage_inc(&malloc_monitor.thread[owner], size);
             mutex_unlock(&_lock);
             return;
         }
@@ -88,10 +173,12 @@ void malloc_monitor_rm(void *ptr, uinttxtptr_t pc)
 #endif
     assert(!irq_is_in());
     mutex_lock(&_lock);
+    _trace_add('f', ptr, 0, pc);
     for (uint8_t i=0; i<CONFIG_MODULE_SYS_MALLOC_MONITOR_SIZE; i++) {
         if (malloc_monitor.addr[i] == ptr) {
             malloc_monitor.addr[i] = NULL;
             malloc_monitor.current -= malloc_monitor.size[i];
+            malloc_monitor.thread[malloc_monitor.owner[i]].current -= malloc_monitor.size[i];
             mutex_unlock(&_lock);
             return;
         }
@@ -119,8 +206,13 @@ void malloc_monitor_mv(void *ptr_old, void *ptr_new, size_t size_new, uinttxtptr
 #endif
     assert(!irq_is_in());
     mutex_lock(&_lock);
+    /* traced as free of the old and allocation of the new block */
+    _trace_add('f', ptr_old, 0, pc);
+    _trace_add('r', ptr_new, size_new, pc);
     for (uint8_t i=0; i<CONFIG_MODULE_SYS_MALLOC_MONITOR_SIZE; i++) {
         if (malloc_monitor.addr[i] == ptr_old) {
+            /* the memory stays accounted to the thread that allocated it */
+            _usage_t *usage = &malloc_monitor.thread[malloc_monitor.owner[i]];
             malloc_monitor.addr[i] = ptr_new;
             size_t size_old = malloc_monitor.size[i];
             malloc_monitor.size[i] = size_new;
@@ -129,9 +221,11 @@ void malloc_monitor_mv(void *ptr_old, void *ptr_new, size_t size_new, uinttxtptr
                 if (malloc_monitor.current > malloc_monitor.high_watermark) {
                     malloc_monitor.high_watermark = malloc_monitor.current;
                 }
+                _usage_inc(usage, size_new - size_old);
             }
             else {
                 malloc_monitor.current -= size_old - size_new;
+                usage->current -= size_old - size_new;
             }
             mutex_unlock(&_lock);
             return;
@@ -164,7 +258,89 @@ void malloc_monitor_reset_high_watermark(void)
     assert(!irq_is_in());
     mutex_lock(&_lock);
     malloc_monitor.high_watermark = malloc_monitor.current;
+    for (unsigned i = 0; i < ARRAY_SIZE(malloc_monitor.thread); i++) {
+        malloc_monitor.thread[i].high_watermark = malloc_monitor.thread[i].current;
+    }
     mutex_unlock(&_lock);
 }
 
+size_t malloc_monitor_get_thread_usage_current(kernel_pid_t pid)
+{
+    assert(!irq_is_in());
+    if ((pid < 0) || (pid > KERNEL_PID_LAST)) {
+        return 0;
+    }
+    mutex_lock(&_lock);
+    size_t ret = malloc_monitor.thread[pid].current;
+    mutex_unlock(&_lock);
+    return ret;
+}
+
+size_t malloc_monitor_get_thread_usage_high_watermark(kernel_pid_t pid)
+{
+    assert(!irq_is_in());
+    if ((pid < 0) || (pid > KERNEL_PID_LAST)) {
+        return 0;
+    }
+    mutex_lock(&_lock);
+    size_t ret = malloc_monitor.thread[pid].high_watermark;
+    mutex_unlock(&_lock);
+    return ret;
+}
+
+#ifdef MODULE_MALLOC_MONITOR_TRACE
+void malloc_monitor_trace_dump(void)
+{
+    /* printing may allocate, so records are copied one by one and printed
+     * without holding the lock */
+    assert(!irq_is_in());
+    mutex_lock(&_lock);
+    uint32_t end = _trace.written;
+    uint32_t pos = (end > CONFIG_MODULE_SYS_MALLOC_MONITOR_TRACE_SIZE)
+                 ? end - CONFIG_MODULE_SYS_MALLOC_MONITOR_TRACE_SIZE : 0;
+    mutex_unlock(&_lock);
+
+    printf("malloc_monitor: trace of %" PRIu32 " allocations, %" PRIu32
+           " lost\n", end - pos, pos);
+    for (; pos < end; pos++) {
+        _trace_rec_t rec;
+
+        mutex_lock(&_lock);
+        bool overwritten = (_trace.written - pos) >
+                           CONFIG_MODULE_SYS_MALLOC_MONITOR_TRACE_SIZE;
+        rec = _trace.rec[pos % CONFIG_MODULE_SYS_MALLOC_MONITOR_TRACE_SIZE];
+        mutex_unlock(&_lock);
+
+        if (overwritten) {
+            continue;
+        }
+        printf("mmt %" PRIu32 " %c %" PRIkernel_pid " 0x%" PRIxTXTPTR
+               " %p %" PRIu32 "\n", rec.time, rec.op, rec.pid, rec.pc,
+               rec.addr, rec.size);
+    }
+
+    for (unsigned i = 0; i < CONFIG_MODULE_SYS_MALLOC_MONITOR_SIZE; i++) {
+        mutex_lock(&_lock);
+        void *addr = malloc_monitor.addr[i];
+        size_t size = malloc_monitor.size[i];
+        kernel_pid_t owner = malloc_monitor.owner[i];
+        mutex_unlock(&_lock);
+
+        if (addr != NULL) {
+            printf("mml %p %" PRIuSIZE " %" PRIkernel_pid "\n",
+                   addr, size, owner);
+        }
+    }
+    puts("malloc_monitor: end of trace");
+}
+
+void malloc_monitor_trace_reset(void)
+{
+    assert(!irq_is_in());
+    mutex_lock(&_lock);
+    _trace.written = 0;
+    mutex_unlock(&_lock);
+}
+#endif
+
 /** @} */
@@ -33,6 +33,22 @@ extern void *__real_realloc(void *ptr, size_t size);
 
 static mutex_t _lock;
 
+/* TLSF serializes heap access by itself (see sys_malloc_tlsf), the mutex is
+ * then only needed to keep malloc_monitor consistent with the heap */
+static inline void _heap_lock(void)
+{
+    if (!IS_USED(MODULE_MALLOC_TLSF) || IS_USED(MODULE_MALLOC_MONITOR)) {
+        mutex_lock(&_lock);
+    }
+}
+
+static inline void _heap_unlock(void)
+{
+    if (!IS_USED(MODULE_MALLOC_TLSF) || IS_USED(MODULE_MALLOC_MONITOR)) {
+        mutex_unlock(&_lock);
+    }
+}
+
 void __attribute__((used)) *__wrap_malloc(size_t size)
 {
     uinttxtptr_t pc;
@@ -40,12 +56,12 @@ void __attribute__((used)) *__wrap_malloc(size_t size)
         pc = cpu_get_caller_pc();
     }
     assert(!irq_is_in());
-    mutex_lock(&_lock);
+    _heap_lock();
     void *ptr = __real_malloc(size);
     if (IS_USED(MODULE_MALLOC_MONITOR)) {
         malloc_monitor_add(ptr, size, cpu_get_caller_pc(), "m");
     }
-    mutex_unlock(&_lock);
+    _heap_unlock();
     if (IS_USED(MODULE_MALLOC_TRACING)) {
         printf("malloc(%" PRIuSIZE ") @ 0x%" PRIxTXTPTR " returned %p\n",
                size, pc, ptr);
@@ -60,12 +76,12 @@ void __attribute__((used)) __wrap_free(void *ptr)
         printf("free(%p) @ 0x%" PRIxTXTPTR ")\n", ptr, pc);
     }
     assert(!irq_is_in());
-    mutex_lock(&_lock);
+    _heap_lock();
     __real_free(ptr);
     if (IS_USED(MODULE_MALLOC_MONITOR)) {
         malloc_monitor_rm(ptr, cpu_get_caller_pc());
     }
-    mutex_unlock(&_lock);
+    _heap_unlock();
 }
 
 void * __attribute__((used)) __wrap_calloc(size_t nmemb, size_t size)
@@ -86,12 +102,12 @@ void * __attribute__((used)) __wrap_calloc(size_t nmemb, size_t size)
         return NULL;
     }
 
-    mutex_lock(&_lock);
+    _heap_lock();
     void *res = __real_malloc(total_size);
     if (IS_USED(MODULE_MALLOC_MONITOR)) {
         malloc_monitor_add(res, total_size, cpu_get_caller_pc(), "c");
     }
-    mutex_unlock(&_lock);
+    _heap_unlock();
     if (res) {
         memset(res, 0, total_size);
     }
@@ -112,12 +128,12 @@ void * __attribute__((used))__wrap_realloc(void *ptr, size_t size)
     }
 
     assert(!irq_is_in());
-    mutex_lock(&_lock);
+    _heap_lock();
     void *new = __real_realloc(ptr, size);
     if (IS_USED(MODULE_MALLOC_MONITOR)) {
         malloc_monitor_mv(ptr, new, size, cpu_get_caller_pc());
     }
-    mutex_unlock(&_lock);
+    _heap_unlock();
 
     if (IS_USED(MODULE_MALLOC_TRACING)) {
         printf("realloc(%p, %" PRIuSIZE ") @0x%" PRIxTXTPTR " returned %p\n",
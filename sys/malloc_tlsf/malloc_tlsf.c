@@ -0,0 +1,163 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_malloc_tlsf
+ * @{
+ *
+ * @file
+ * @brief       Heap regions and statistics of the TLSF system allocator
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "architecture.h"
+#include "cpu_conf.h"
+#include "irq.h"
+#include "kernel_defines.h"
+#include "malloc_tlsf.h"
+#include "tlsf.h"
+#include "tlsf-malloc.h"
+
+#ifndef NUM_HEAPS
+#define NUM_HEAPS 1
+#endif
+
+#ifdef CPU_NATIVE
+static uint64_t _heap[CONFIG_MALLOC_TLSF_NATIVE_HEAP_SIZE / sizeof(uint64_t)];
+
+static struct {
+    char *start;
+    char *end;
+} const _regions[] = {
+    { (char *)_heap, (char *)_heap + sizeof(_heap) },
+};
+#else
+extern char _sheap, _eheap;
+#if NUM_HEAPS > 1
+extern char _sheap1, _eheap1;
+#endif
+#if NUM_HEAPS > 2
+extern char _sheap2, _eheap2;
+#endif
+#if NUM_HEAPS > 3
+extern char _sheap3, _eheap3;
+#endif
+#if NUM_HEAPS > 4
+#error "Unsupported NUM_HEAPS value, edit malloc_tlsf.c to add more heaps."
+#endif
+
+static struct {
+    char *start;
+    char *end;
+} const _regions[NUM_HEAPS] = {
+    { &_sheap, &_eheap },
+#if NUM_HEAPS > 1
+    { &_sheap1, &_eheap1 },
+#endif
+#if NUM_HEAPS > 2
+    { &_sheap2, &_eheap2 },
+#endif
+#if NUM_HEAPS > 3
+    { &_sheap3, &_eheap3 },
+#endif
+};
+#endif
+
+/* pools of the heap, needed to walk over all blocks in malloc_tlsf_get_stats() */
+static pool_t _pools[ARRAY_SIZE(_regions) + CONFIG_MALLOC_TLSF_EXTRA_POOLS_NUMOF];
+static size_t _pool_sizes[ARRAY_SIZE(_pools)];
+static unsigned _pools_numof;
+
+/* must be called with IRQs disabled */
+static int _add_pool(void *mem, size_t bytes)
+{
+    bool first = (_tlsf_get_global_control() == NULL);
+
+    if (tlsf_add_global_pool(mem, bytes) != 0) {
+        return -EINVAL;
+    }
+
+    /* tlsf_add_pool() places the pool at the start of the region, but the
+     * first pool is placed behind the control structure */
+    _pools[_pools_numof] = first ? tlsf_get_pool(_tlsf_get_global_control())
+                                 : (pool_t)mem;
+    _pool_sizes[_pools_numof] = bytes;
+    _pools_numof++;
+    return 0;
+}
+
+void tlsf_malloc_init_pools(void)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_regions); i++) {
+        /* a region that is too small is skipped */
+        _add_pool(_regions[i].start, _regions[i].end - _regions[i].start);
+    }
+}
+
+int malloc_tlsf_add_pool(void *mem, size_t bytes)
+{
+    int res = -ENOMEM;
+    unsigned state = irq_disable();
+
+    /* make sure the control structure is in the first default region */
+    if (_tlsf_get_global_control() == NULL) {
+        tlsf_malloc_init_pools();
+    }
+    if (_pools_numof < ARRAY_SIZE(_pools)) {
+        res = _add_pool(mem, bytes);
+    }
+
+    irq_restore(state);
+    return res;
+}
+
+static void _stats_walker(void *ptr, size_t size, int used, void *user)
+{
+    malloc_tlsf_stats_t *stats = user;
+    (void)ptr;
+
+    if (used) {
+        stats->used += size;
+    }
+    else {
+        stats->free += size;
+        if (size > stats->largest_free) {
+            stats->largest_free = size;
+        }
+    }
+}
+
+void malloc_tlsf_get_stats(malloc_tlsf_stats_t *stats)
+{
+    *stats = (malloc_tlsf_stats_t){ 0 };
+
+    unsigned state = irq_disable();
+    for (unsigned i = 0; i < _pools_numof; i++) {
+        stats->size += _pool_sizes[i];
+        tlsf_walk_pool(_pools[i], _stats_walker, stats);
+    }
+    irq_restore(state);
+}
+
+void heap_stats(void)
+{
+    malloc_tlsf_stats_t stats;
+
+    malloc_tlsf_get_stats(&stats);
+    printf("heap: %" PRIuSIZE " (used %" PRIuSIZE ", free %" PRIuSIZE
+           ", largest free block %" PRIuSIZE ") [bytes]\n",
+           stats.size, stats.used, stats.free, stats.largest_free);
+}
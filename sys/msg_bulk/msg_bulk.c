@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_msg_bulk
+ * @{
+ *
+ * @file
+ * @brief       Zero-copy bulk message implementation
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "container.h"
+#include "irq.h"
+#include "memarray.h"
+#include "msg_bulk.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static_assert((CONFIG_MSG_BULK_BUF_SIZE % sizeof(uint32_t)) == 0,
+              "CONFIG_MSG_BULK_BUF_SIZE must be a multiple of 4");
+
+typedef struct {
+    uint32_t refs;
+    uint32_t len;
+    uint8_t data[CONFIG_MSG_BULK_BUF_SIZE];
+} _buf_t;
+
+static _buf_t _bufs[CONFIG_MSG_BULK_BUF_NUMOF];
+static memarray_t _pool;
+static bool _pool_ready;
+static msg_bulk_stats_t _stats;
+
+static _buf_t *_hdr(const void *buf)
+{
+    _buf_t *hdr = (_buf_t *)((uintptr_t)buf - offsetof(_buf_t, data));
+
+    assert((hdr >= _bufs) && (hdr < _bufs + ARRAY_SIZE(_bufs)));
+    assert(hdr->refs > 0);
+    return hdr;
+}
+
+void *msg_bulk_alloc(void)
+{
+    unsigned state = irq_disable();
+
+    if (!_pool_ready) {
+        memarray_init(&_pool, _bufs, sizeof(_buf_t), ARRAY_SIZE(_bufs));
+        _pool_ready = true;
+    }
+
+    _buf_t *hdr = memarray_alloc(&_pool);
+    if (!hdr) {
+        _stats.alloc_fails++;
+        irq_restore(state);
+        DEBUG("msg_bulk: pool exhausted\n");
+        return NULL;
+    }
+
+    hdr->refs = 1;
+    hdr->len = 0;
+    _stats.allocs++;
+    if (++_stats.outstanding > _stats.max_outstanding) {
+        _stats.max_outstanding = _stats.outstanding;
+    }
+
+    irq_restore(state);
+    DEBUG("msg_bulk: allocated %p\n", (void *)hdr->data);
+    return hdr->data;
+}
+
+void msg_bulk_retain(void *buf)
+{
+    unsigned state = irq_disable();
+    _hdr(buf)->refs++;
+    irq_restore(state);
+}
+
+void msg_bulk_release(void *buf)
+{
+    unsigned state = irq_disable();
+    _buf_t *hdr = _hdr(buf);
+
+    if (--hdr->refs == 0) {
+        memarray_free(&_pool, hdr);
+        _stats.outstanding--;
+        DEBUG("msg_bulk: freed %p\n", buf);
+    }
+    irq_restore(state);
+}
+
+void msg_bulk_set_len(void *buf, size_t len)
+{
+    assert(len <= CONFIG_MSG_BULK_BUF_SIZE);
+    _hdr(buf)->len = len;
+}
+
+size_t msg_bulk_len(const void *buf)
+{
+    return _hdr(buf)->len;
+}
+
+int msg_bulk_send(msg_t *m, void *buf, kernel_pid_t target_pid)
+{
+    assert(buf);
+    m->content.ptr = buf;
+    return msg_send(m, target_pid);
+}
+
+int msg_bulk_send_receive(msg_t *m, void *buf, msg_t *reply,
+                          kernel_pid_t target_pid)
+{
+    assert(buf);
+    m->content.ptr = buf;
+    return msg_send_receive(m, reply, target_pid);
+}
+
+int msg_bulk_reply(msg_t *m, msg_t *reply)
+{
+    msg_bulk_release(m->content.ptr);
+    return msg_reply(m, reply);
+}
+
+unsigned msg_bulk_outstanding(void)
+{
+    return _stats.outstanding;
+}
+
+void msg_bulk_get_stats(msg_bulk_stats_t *stats)
+{
+    unsigned state = irq_disable();
+    *stats = _stats;
+    irq_restore(state);
+}
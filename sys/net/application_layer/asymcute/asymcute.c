@@ -55,6 +55,10 @@
 
 #define MIN_PKT_LEN             (2)
 
+static_assert((CONFIG_ASYMCUTE_PENDING_BUCKETS &
+               (CONFIG_ASYMCUTE_PENDING_BUCKETS - 1)) == 0,
+              "CONFIG_ASYMCUTE_PENDING_BUCKETS must be a power of 2");
+
 /* Internally used connection states */
 enum {
     NOTCON = 0,             /**< not connected to any gateway */
@@ -116,6 +120,34 @@ static uint8_t _req_type(asymcute_req_t *req)
     return req->data[(size_t)pos];
 }
 
+static asymcute_req_t **_bucket(asymcute_con_t *con, uint16_t msg_id)
+{
+    return &con->pending[msg_id & (CONFIG_ASYMCUTE_PENDING_BUCKETS - 1)];
+}
+
+/* @pre con is locked */
+static void _req_link(asymcute_con_t *con, asymcute_req_t *req)
+{
+    asymcute_req_t **bucket = _bucket(con, req->msg_id);
+
+    req->next = *bucket;
+    *bucket = req;
+    if (_req_type(req) == MQTTSN_PUBLISH) {
+        con->inflight++;
+    }
+}
+
+/* @pre con is locked */
+static void _req_unlink(asymcute_con_t *con, asymcute_req_t **prev)
+{
+    asymcute_req_t *req = *prev;
+
+    *prev = req->next;
+    if (_req_type(req) == MQTTSN_PUBLISH) {
+        con->inflight--;
+    }
+}
+
 /* @pre con is locked */
 static asymcute_req_t *_req_preprocess(asymcute_con_t *con,
                                        size_t msg_len, size_t min_len,
@@ -129,40 +161,28 @@ static asymcute_req_t *_req_preprocess(asymcute_con_t *con,
 
     uint16_t msg_id = (buf == NULL) ? 0 : byteorder_bebuftohs(&buf[id_pos]);
 
-    asymcute_req_t *res = NULL;
-    asymcute_req_t *iter = con->pending;
-    if (iter == NULL) {
-        return NULL;
-    }
-    if (iter->msg_id == msg_id) {
-        res = iter;
-        con->pending = iter->next;
-    }
-    while (iter && !res) {
-        asymcute_req_t *r = iter->next;
-        if (r && (r->msg_id == msg_id) && (_req_type(r) == rtype)) {
-            res = r;
-            iter->next = iter->next->next;
+    for (asymcute_req_t **prev = _bucket(con, msg_id); *prev;
+         prev = &(*prev)->next) {
+        asymcute_req_t *res = *prev;
+        if ((res->msg_id == msg_id) && (_req_type(res) == rtype)) {
+            _req_unlink(con, prev);
+            res->con = NULL;
+            event_timeout_clear(&res->to_timer);
+            return res;
         }
-        iter = iter->next;
     }
 
-    if (res) {
-        res->con = NULL;
-        event_timeout_clear(&res->to_timer);
-    }
-    return res;
+    return NULL;
 }
 
 /* @pre con is locked */
 static void _req_remove(asymcute_con_t *con, asymcute_req_t *req)
 {
-    if (con->pending == req) {
-        con->pending = con->pending->next;
-    }
-    for (asymcute_req_t *cur = con->pending; cur; cur = cur->next) {
-        if (cur->next == req) {
-            cur->next = cur->next->next;
+    for (asymcute_req_t **prev = _bucket(con, req->msg_id); *prev;
+         prev = &(*prev)->next) {
+        if (*prev == req) {
+            _req_unlink(con, prev);
+            break;
         }
     }
     req->con = NULL;
@@ -210,13 +230,12 @@ static int _req_send(asymcute_req_t *req, asymcute_con_t *con,
     req->retry_cnt = CONFIG_ASYMCUTE_N_RETRY;
     event_callback_init(&req->to_evt, _on_req_timeout, req);
     event_timeout_init(&req->to_timer, &_queue, &req->to_evt.super);
-    /* add request to the pending queue (if non-con request) */
-    req->next = con->pending;
-    con->pending = req;
+    /* add request to the pending requests (if non-con request) */
+    _req_link(con, req);
     /* send request */
     ssize_t n = _req_resend(req, con, 1);
     if (n < MIN_PKT_LEN) {
-        req->con = NULL;
+        _req_remove(con, req);
         mutex_unlock(&req->lock);
         return ASYMCUTE_SENDERR;
     }
@@ -251,10 +270,13 @@ static void _disconnect(asymcute_con_t *con, uint8_t state)
     if (con->state == CONNECTED) {
         /* cancel all pending requests */
         event_timeout_clear(&con->keepalive_timer);
-        for (asymcute_req_t *req = con->pending; req; req = req->next) {
-            _req_cancel(req);
+        for (unsigned i = 0; i < CONFIG_ASYMCUTE_PENDING_BUCKETS; i++) {
+            for (asymcute_req_t *req = con->pending[i]; req; req = req->next) {
+                _req_cancel(req);
+            }
+            con->pending[i] = NULL;
         }
-        con->pending = NULL;
+        con->inflight = 0;
         for (asymcute_sub_t *sub = con->subscriptions; sub; sub = sub->next) {
             _sub_cancel(sub);
         }
@@ -886,6 +908,12 @@ int asymcute_publish(asymcute_con_t *con, asymcute_req_t *req,
         ret = ASYMCUTE_GWERR;
         goto end;
     }
+    /* do not exceed the number of messages waiting for their PUBACK */
+    if ((flags & MQTTSN_QOS_1) &&
+        (con->inflight >= CONFIG_ASYMCUTE_INFLIGHT_MAX)) {
+        ret = ASYMCUTE_WINDOW;
+        goto end;
+    }
     /* make sure request context is clear to be used */
     if (mutex_trylock(&req->lock) != 1) {
         ret = ASYMCUTE_BUSY;
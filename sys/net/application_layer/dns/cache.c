@@ -186,8 +186,9 @@ void dns_cache_add(const char *domain_name, const void *addr_out,
                 cache[i].expires = now + ttl;
             }
             else {
-                /* put one second into past so that it is immediately expired */
-                cache[i].expires = now - 1;
+                /* drop the entry, putting it into the past would make it
+                 * valid for ever within the first second after boot */
+                _set_empty(i);
             }
             goto exit;
         }
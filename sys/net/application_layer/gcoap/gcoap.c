@@ -38,6 +38,7 @@
 #include "mutex.h"
 #include "random.h"
 #include "thread.h"
+#include "thread_flags.h"
 #include "ztimer.h"
 
 #if IS_USED(MODULE_GCOAP_DTLS)
@@ -63,6 +64,8 @@ static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_
 static int _tl_init_coap_socket(gcoap_socket_t *sock, gcoap_socket_type_t type);
 static ssize_t _tl_send(gcoap_socket_t *sock, const void *data, size_t len,
                         const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux);
+static ssize_t _tl_sendv(gcoap_socket_t *sock, const iolist_t *snips,
+                         const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux);
 static ssize_t _tl_authenticate(gcoap_socket_t *sock, const sock_udp_ep_t *remote,
                                 uint32_t timeout);
 static ssize_t _well_known_core_handler(coap_pkt_t* pdu, uint8_t *buf, size_t len,
@@ -71,6 +74,7 @@ static void _cease_retransmission(gcoap_request_memo_t *memo);
 static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
                           size_t len, sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux);
 static void _expire_request(gcoap_request_memo_t *memo);
+static void _memo_free(gcoap_request_memo_t *memo);
 static gcoap_request_memo_t* _find_req_memo_by_mid(const sock_udp_ep_t *remote,
                                                    uint16_t mid);
 static gcoap_request_memo_t* _find_req_memo_by_token(const sock_udp_ep_t *remote,
@@ -88,6 +92,10 @@ static int _find_obs_memo(gcoap_observe_memo_t **memo,
                           coap_pkt_t *pdu);
 static void _find_obs_memo_resource(gcoap_observe_memo_t **memo,
                                    const coap_resource_t *resource);
+static void _find_obs_memo_resource_ep(gcoap_observe_memo_t **memo,
+                                       const coap_resource_t *resource,
+                                       const gcoap_socket_t *sock,
+                                       const sock_udp_ep_t *remote);
 
 static void _check_and_expire_obs_memo_last_mid(sock_udp_ep_t *remote,
                                                 uint16_t last_notify_mid);
@@ -108,6 +116,12 @@ static void _on_sock_dtls_evt(sock_dtls_t *sock, sock_async_flags_t type, void *
 static void _dtls_free_up_session(void *arg);
 #endif
 
+#if IS_USED(MODULE_GCOAP_TCP)
+static int _tcp_init(const sock_udp_ep_t *local);
+static int _tcp_connect(gcoap_socket_t *sock, const sock_udp_ep_t *remote);
+static ssize_t _tcp_sendv(const iolist_t *snips, const sock_udp_ep_t *remote);
+#endif
+
 static char _ipv6_addr_str[IPV6_ADDR_MAX_STR_LEN];
 
 /* Internal variables */
@@ -124,6 +138,32 @@ static gcoap_listener_t _default_listener = {
     _request_matcher_default
 };
 
+/* Index of a request memo, with a value for none */
+#if CONFIG_GCOAP_REQ_WAITING_MAX < UINT8_MAX
+typedef uint8_t gcoap_memo_idx_t;
+#define MEMO_IDX_NONE   (UINT8_MAX)
+#else
+typedef uint16_t gcoap_memo_idx_t;
+#define MEMO_IDX_NONE   (UINT16_MAX)
+#endif
+
+/* Hash chains of the request memos by token and by message ID, and the list
+ * of unused memos, to not search all memos for every response */
+typedef struct {
+    mutex_t lock;                       /* Protects the chains */
+    gcoap_memo_idx_t unused;            /* First unused memo */
+    gcoap_memo_idx_t tkn_head[CONFIG_GCOAP_REQ_WAITING_MAX];
+    gcoap_memo_idx_t mid_head[CONFIG_GCOAP_REQ_WAITING_MAX];
+    gcoap_memo_idx_t tkn_next[CONFIG_GCOAP_REQ_WAITING_MAX];
+                                        /* Next memo in token chain, or next
+                                           unused memo */
+    gcoap_memo_idx_t mid_next[CONFIG_GCOAP_REQ_WAITING_MAX];
+    gcoap_memo_idx_t tkn_bucket[CONFIG_GCOAP_REQ_WAITING_MAX];
+                                        /* Token chain of a memo, NONE if
+                                           the memo is in none */
+    gcoap_memo_idx_t mid_bucket[CONFIG_GCOAP_REQ_WAITING_MAX];
+} gcoap_memo_index_t;
+
 /* Container for the state of gcoap itself */
 typedef struct {
     mutex_t lock;                       /* Shares state attributes safely */
@@ -132,6 +172,7 @@ typedef struct {
                                         /* Storage for open requests; if first
                                            byte of an entry is zero, the entry
                                            is available */
+    gcoap_memo_index_t memo_index;      /* Lookup of open requests */
     atomic_uint next_message_id;        /* Next message ID to use */
     sock_udp_ep_t observers[CONFIG_GCOAP_OBS_CLIENTS_MAX];
                                         /* Observe clients; allows reuse for
@@ -170,6 +211,54 @@ static event_timeout_t _dtls_session_free_up_tmout;
 static event_callback_t _dtls_session_free_up_tmout_cb;
 #endif
 
+#if IS_USED(MODULE_GCOAP_WORKERS)
+#define GCOAP_WORKER_FLAG   (1U << 0)
+
+/* a slow request handler in its own thread */
+typedef struct {
+    coap_pkt_t pdu;                     /* request, points into buf */
+    gcoap_socket_t socket;
+    sock_udp_ep_t remote;
+    sock_udp_aux_tx_t aux;
+    const coap_resource_t *resource;
+    thread_t *thread;
+    uint16_t mid;                       /* message ID of the request */
+    bool has_aux;
+    volatile bool busy;                 /* set by gcoap, cleared by the worker */
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+} _worker_t;
+
+static _worker_t _workers[CONFIG_GCOAP_WORKERS_NUMOF];
+static char _worker_stacks[CONFIG_GCOAP_WORKERS_NUMOF][GCOAP_WORKER_STACK_SIZE];
+#endif
+
+#if IS_USED(MODULE_GCOAP_TCP)
+/* The RFC 8323 header up to the token (Len/TKL, extended length, code) is at
+ * most this much longer than the 4 bytes of the UDP header */
+#define TCP_HDR_EXTRA       (2U)
+/* Max-Message-Size option of a CSM */
+#define TCP_OPT_MAX_MESSAGE_SIZE    (2U)
+
+/* a CoAP over TCP connection */
+typedef struct {
+    sock_tcp_t *sock;                   /* NULL if the slot is unused */
+    sock_udp_ep_t remote;
+    bool ready;                         /* connected, polled by gcoap */
+    uint16_t rx_len;                    /* bytes in rx_buf */
+    uint8_t rx_buf[CONFIG_GCOAP_PDU_BUF_SIZE + TCP_HDR_EXTRA];
+} _tcp_conn_t;
+
+/* protects the slots and _tcp_tx_buf */
+static mutex_t _tcp_lock = MUTEX_INIT;
+static _tcp_conn_t _tcp_conns[CONFIG_GCOAP_TCP_CONN_NUMOF];
+static sock_tcp_t _tcp_client_socks[CONFIG_GCOAP_TCP_CONN_NUMOF];
+static sock_tcp_t _tcp_queue_socks[CONFIG_GCOAP_TCP_CONN_NUMOF];
+static sock_tcp_queue_t _tcp_queue;
+static uint8_t _tcp_tx_buf[CONFIG_GCOAP_PDU_BUF_SIZE + TCP_HDR_EXTRA];
+static event_timeout_t _tcp_poll_tmout;
+static event_callback_t _tcp_poll_cb;
+#endif
+
 /* Event loop for gcoap _pid thread. */
 static void *_event_loop(void *arg)
 {
@@ -218,6 +307,14 @@ static void *_event_loop(void *arg)
 #endif
     }
 
+#if IS_USED(MODULE_GCOAP_TCP)
+    local.port = CONFIG_GCOAP_TCP_PORT;
+    if (_tcp_init(&local) < 0) {
+        DEBUG("gcoap: error creating TCP listen sock\n");
+        return 0;
+    }
+#endif
+
     event_loop(&_queue);
     return 0;
 }
@@ -322,6 +419,361 @@ static void _dtls_free_up_session(void *arg) {
 }
 #endif /* MODULE_GCOAP_DTLS */
 
+#if IS_USED(MODULE_GCOAP_TCP)
+/*
+ * CoAP over TCP (RFC 8323)
+ *
+ * Messages are converted from and to the UDP format at this boundary, so the
+ * rest of gcoap handles them like NON messages. There is no message layer:
+ * empty messages are dropped and the message ID is always 0.
+ */
+
+/* Number of extended length bytes in the header for a message of len bytes
+ * after the token */
+static unsigned _tcp_ext_len(size_t len)
+{
+    return (len < 13) ? 0 : (len < 269) ? 1 : (len < 65805) ? 2 : 4;
+}
+
+/* Writes the header up to the token, returns its length */
+static size_t _tcp_hdr_write(uint8_t *buf, size_t len, unsigned tkl, uint8_t code)
+{
+    uint8_t *pos = buf;
+
+    switch (_tcp_ext_len(len)) {
+    case 0:
+        *pos++ = (len << 4) | tkl;
+        break;
+    case 1:
+        *pos++ = (13 << 4) | tkl;
+        *pos++ = len - 13;
+        break;
+    case 2:
+        *pos++ = (14 << 4) | tkl;
+        byteorder_htobebufs(pos, len - 269);
+        pos += 2;
+        break;
+    default:
+        *pos++ = (15 << 4) | tkl;
+        byteorder_htobebufl(pos, len - 65805);
+        pos += 4;
+        break;
+    }
+    *pos++ = code;
+
+    return pos - buf;
+}
+
+/* Length of the message at the start of buf, or 0 if its header is not
+ * complete yet; hdr_len is set to the length of the header up to the token */
+static size_t _tcp_msg_len(const uint8_t *buf, size_t len, size_t *hdr_len)
+{
+    if (len < 1) {
+        return 0;
+    }
+
+    unsigned nibble = buf[0] >> 4;
+    if (nibble == 15) {
+        /* never fits in our buffers */
+        *hdr_len = 6;
+        return SIZE_MAX;
+    }
+    *hdr_len = (nibble < 13) ? 2 : (nibble == 13) ? 3 : 4;
+    if (len < *hdr_len) {
+        return 0;
+    }
+
+    size_t body = (nibble < 13) ? nibble
+                : (nibble == 13) ? 13U + buf[1]
+                : 269U + byteorder_bebuftohs(&buf[1]);
+
+    return *hdr_len + (buf[0] & 0xf) + body;
+}
+
+static _tcp_conn_t *_tcp_conn_find(const sock_udp_ep_t *remote)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_tcp_conns); i++) {
+        if (_tcp_conns[i].ready && sock_udp_ep_equal(&_tcp_conns[i].remote, remote)) {
+            return &_tcp_conns[i];
+        }
+    }
+    return NULL;
+}
+
+static _tcp_conn_t *_tcp_conn_alloc(void)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_tcp_conns); i++) {
+        if (_tcp_conns[i].sock == NULL) {
+            return &_tcp_conns[i];
+        }
+    }
+    return NULL;
+}
+
+static ssize_t _tcp_write(_tcp_conn_t *conn, const uint8_t *buf, size_t len)
+{
+    for (size_t left = len; left > 0;) {
+        ssize_t res = sock_tcp_write(conn->sock, buf, left);
+        if (res < 0) {
+            return res;
+        }
+        buf += res;
+        left -= res;
+    }
+    return len;
+}
+
+/* Sends a signaling message, with _tcp_lock held */
+static ssize_t _tcp_send_signal(_tcp_conn_t *conn, uint8_t code,
+                                const uint8_t *token, unsigned tkl)
+{
+    uint8_t *pos = _tcp_tx_buf;
+    size_t len = 0;
+    uint8_t opts[4];
+
+    if (code == COAP_CODE_SIGNAL_CSM) {
+        /* the largest message we can receive */
+        len = coap_opt_put_uint(opts, 0, TCP_OPT_MAX_MESSAGE_SIZE,
+                                sizeof(conn->rx_buf));
+    }
+    pos += _tcp_hdr_write(pos, len, tkl, code);
+    memcpy(pos, token, tkl);
+    pos += tkl;
+    memcpy(pos, opts, len);
+    pos += len;
+
+    return _tcp_write(conn, _tcp_tx_buf, pos - _tcp_tx_buf);
+}
+
+/* Takes a connected sock into use, with _tcp_lock held */
+static int _tcp_conn_open(_tcp_conn_t *conn, sock_tcp_t *sock)
+{
+    conn->sock = sock;
+    conn->rx_len = 0;
+    /* the CSM is the first message on both sides */
+    int res = _tcp_send_signal(conn, COAP_CODE_SIGNAL_CSM, NULL, 0);
+    if (res < 0) {
+        sock_tcp_disconnect(sock);
+        conn->sock = NULL;
+        return res;
+    }
+    conn->ready = true;
+    return 0;
+}
+
+/* Closes a connection from the gcoap thread and expires the requests
+ * waiting for a response on it */
+static void _tcp_conn_lost(_tcp_conn_t *conn)
+{
+    DEBUG("gcoap: TCP connection closed\n");
+    mutex_lock(&_tcp_lock);
+    if (conn->ready) {
+        conn->ready = false;
+        sock_tcp_disconnect(conn->sock);
+        conn->sock = NULL;
+    }
+    mutex_unlock(&_tcp_lock);
+
+    for (int i = 0; i < CONFIG_GCOAP_REQ_WAITING_MAX; i++) {
+        gcoap_request_memo_t *memo = &_coap_state.open_reqs[i];
+        if ((memo->state != GCOAP_MEMO_UNUSED) &&
+            (memo->socket.type == GCOAP_SOCKET_TYPE_TCP) &&
+            sock_udp_ep_equal(&memo->remote_ep, &conn->remote)) {
+            event_timeout_clear(&memo->resp_evt_tmout);
+            _expire_request(memo);
+        }
+    }
+}
+
+/* Processes a complete message at the start of the receive buffer */
+static void _tcp_process(_tcp_conn_t *conn, size_t hdr_len, size_t len)
+{
+    const uint8_t *msg = conn->rx_buf;
+    unsigned tkl = msg[0] & 0xf;
+    uint8_t code = msg[hdr_len - 1];
+    const uint8_t *token = &msg[hdr_len];
+
+    if ((code >> 5) == COAP_CLASS_SIGNAL) {
+        if (code == COAP_CODE_SIGNAL_PING) {
+            mutex_lock(&_tcp_lock);
+            _tcp_send_signal(conn, COAP_CODE_SIGNAL_PONG, token, tkl);
+            mutex_unlock(&_tcp_lock);
+        }
+        /* The peer's CSM can only raise the 1152 bytes every message of ours
+         * fits in. Release and Abort are followed by the peer closing the
+         * connection, which we notice then. */
+        return;
+    }
+
+    size_t pdu_len = coap_build_hdr((coap_hdr_t *)_listen_buf, COAP_TYPE_NON,
+                                    token, tkl, code, 0);
+    memcpy(&_listen_buf[pdu_len], &token[tkl], len - hdr_len - tkl);
+    pdu_len += len - hdr_len - tkl;
+
+    gcoap_socket_t socket = {
+        .type = GCOAP_SOCKET_TYPE_TCP,
+        .socket.tcp = conn->sock,
+    };
+    _process_coap_pdu(&socket, &conn->remote, NULL, _listen_buf, pdu_len, false);
+}
+
+/* Reads what is available on a connection and processes the complete
+ * messages; returns true if there may be more to read */
+static bool _tcp_recv(_tcp_conn_t *conn)
+{
+    mutex_lock(&_tcp_lock);
+    if (!conn->ready) {
+        mutex_unlock(&_tcp_lock);
+        return false;
+    }
+    ssize_t res = sock_tcp_read(conn->sock, &conn->rx_buf[conn->rx_len],
+                                sizeof(conn->rx_buf) - conn->rx_len, 0);
+    mutex_unlock(&_tcp_lock);
+
+    if (res == -EAGAIN) {
+        return false;
+    }
+    if (res <= 0) {
+        /* closed by the peer or failed */
+        _tcp_conn_lost(conn);
+        return false;
+    }
+    conn->rx_len += res;
+
+    size_t hdr_len, len;
+    while ((len = _tcp_msg_len(conn->rx_buf, conn->rx_len, &hdr_len)) > 0) {
+        if ((len > sizeof(conn->rx_buf)) ||
+            ((conn->rx_buf[0] & 0xf) > GCOAP_TOKENLEN_MAX) ||
+            (sizeof(coap_hdr_t) + len - hdr_len > sizeof(_listen_buf))) {
+            DEBUG("gcoap: TCP message too large\n");
+            _tcp_conn_lost(conn);
+            return false;
+        }
+        if (len > conn->rx_len) {
+            break;
+        }
+        _tcp_process(conn, hdr_len, len);
+        if (!conn->ready) {
+            return false;
+        }
+        conn->rx_len -= len;
+        memmove(conn->rx_buf, &conn->rx_buf[len], conn->rx_len);
+    }
+    return true;
+}
+
+static void _tcp_poll(void *arg)
+{
+    (void)arg;
+    sock_tcp_t *sock;
+
+    mutex_lock(&_tcp_lock);
+    /* leave connections in the queue while there is no slot for them */
+    _tcp_conn_t *conn = _tcp_conn_alloc();
+    if (conn && (sock_tcp_accept(&_tcp_queue, &sock, 0) == 0)) {
+        if ((sock_tcp_get_remote(sock, &conn->remote) < 0) ||
+            (_tcp_conn_open(conn, sock) < 0)) {
+            DEBUG("gcoap: could not take TCP connection into use\n");
+        }
+    }
+    mutex_unlock(&_tcp_lock);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_tcp_conns); i++) {
+        while (_tcp_recv(&_tcp_conns[i])) {}
+    }
+    event_timeout_set(&_tcp_poll_tmout, CONFIG_GCOAP_TCP_POLL_MSEC);
+}
+
+static int _tcp_init(const sock_udp_ep_t *local)
+{
+    int res = sock_tcp_listen(&_tcp_queue, local, _tcp_queue_socks,
+                              ARRAY_SIZE(_tcp_queue_socks), 0);
+    if (res < 0) {
+        return res;
+    }
+    /* not every stack provides asynchronous TCP socks, so poll */
+    event_callback_init(&_tcp_poll_cb, _tcp_poll, NULL);
+    event_timeout_ztimer_init(&_tcp_poll_tmout, ZTIMER_MSEC, &_queue,
+                              &_tcp_poll_cb.super);
+    event_timeout_set(&_tcp_poll_tmout, CONFIG_GCOAP_TCP_POLL_MSEC);
+    return 0;
+}
+
+/* Finds the connection to remote, or connects to it (blocking) */
+static int _tcp_connect(gcoap_socket_t *sock, const sock_udp_ep_t *remote)
+{
+    int res = 0;
+
+    mutex_lock(&_tcp_lock);
+    _tcp_conn_t *conn = _tcp_conn_find(remote);
+    if (conn == NULL) {
+        if ((conn = _tcp_conn_alloc()) == NULL) {
+            mutex_unlock(&_tcp_lock);
+            DEBUG("gcoap: no slot for a TCP connection\n");
+            return -ENOMEM;
+        }
+        /* reserve the slot, it is not polled before it is ready */
+        sock_tcp_t *tcp = &_tcp_client_socks[conn - _tcp_conns];
+        conn->sock = tcp;
+        conn->remote = *remote;
+        mutex_unlock(&_tcp_lock);
+
+        res = sock_tcp_connect(tcp, remote, 0, 0);
+
+        mutex_lock(&_tcp_lock);
+        if (res < 0) {
+            DEBUG("gcoap: TCP connect failed: %d\n", res);
+            conn->sock = NULL;
+        }
+        else {
+            res = _tcp_conn_open(conn, tcp);
+        }
+    }
+    sock->socket.tcp = conn->sock;
+    mutex_unlock(&_tcp_lock);
+
+    return res;
+}
+
+/* Sends a message built with a UDP header as RFC 8323 message */
+static ssize_t _tcp_sendv(const iolist_t *snips, const sock_udp_ep_t *remote)
+{
+    size_t len = iolist_size(snips);
+    /* the header is written in front of the token */
+    uint8_t *udp = &_tcp_tx_buf[TCP_HDR_EXTRA];
+
+    if ((len < sizeof(coap_hdr_t)) || (len > sizeof(_tcp_tx_buf) - TCP_HDR_EXTRA)) {
+        return -EMSGSIZE;
+    }
+
+    mutex_lock(&_tcp_lock);
+    _tcp_conn_t *conn = _tcp_conn_find(remote);
+    if (conn == NULL) {
+        mutex_unlock(&_tcp_lock);
+        return -ENOTCONN;
+    }
+    iolist_to_buffer(snips, udp, len);
+
+    const coap_hdr_t *hdr = (const coap_hdr_t *)udp;
+    uint8_t code = hdr->code;
+    unsigned tkl = hdr->ver_t_tkl & 0xf;
+    if (code == COAP_CODE_EMPTY) {
+        /* no ACK, RST or CoAP ping over TCP */
+        mutex_unlock(&_tcp_lock);
+        return len;
+    }
+
+    size_t body = len - sizeof(coap_hdr_t) - tkl;
+    uint8_t *start = udp + sizeof(coap_hdr_t) - 2 - _tcp_ext_len(body);
+    _tcp_hdr_write(start, body, tkl, code);
+
+    ssize_t res = _tcp_write(conn, start, udp + len - start);
+    mutex_unlock(&_tcp_lock);
+
+    return (res < 0) ? res : (ssize_t)len;
+}
+#endif /* MODULE_GCOAP_TCP */
+
 /* Handles UDP socket events from the event queue. */
 static void _on_sock_udp_evt(sock_udp_t *sock, sock_async_flags_t type, void *arg)
 {
@@ -552,7 +1004,7 @@ static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_
                  * was removed on the server side. Then also free the memo here. */
                 if (!observe_notification || (code_class != COAP_CLASS_SUCCESS)) {
                     /* setting the state to unused frees (drops) the memo entry */
-                    memo->state = GCOAP_MEMO_UNUSED;
+                    _memo_free(memo);
                 }
 
                 break;
@@ -676,6 +1128,110 @@ static void _cease_retransmission(gcoap_request_memo_t *memo) {
  *
  * return length of response pdu, or < 0 if can't handle
  */
+static ssize_t _call_handler(gcoap_socket_t *sock, coap_pkt_t *pdu,
+                             uint8_t *buf, size_t len, sock_udp_ep_t *remote,
+                             sock_udp_aux_tx_t *aux,
+                             const coap_resource_t *resource)
+{
+    coap_request_ctx_t ctx = {
+        .resource = resource,
+        .tl_type = (uint32_t)sock->type,
+        .remote = remote,
+        .local = aux ? &aux->local : NULL,
+    };
+
+    ssize_t pdu_len = resource->handler(pdu, buf, len, &ctx);
+    if (pdu_len < 0) {
+        pdu_len = gcoap_response(pdu, buf, len,
+                                 COAP_CODE_INTERNAL_SERVER_ERROR);
+    }
+    return pdu_len;
+}
+
+#if IS_USED(MODULE_GCOAP_WORKERS)
+static void *_worker_loop(void *arg)
+{
+    _worker_t *worker = arg;
+
+    while (1) {
+        thread_flags_wait_any(GCOAP_WORKER_FLAG);
+
+        sock_udp_aux_tx_t *aux = worker->has_aux ? &worker->aux : NULL;
+        ssize_t pdu_len = _call_handler(&worker->socket, &worker->pdu,
+                                        worker->buf, sizeof(worker->buf),
+                                        &worker->remote, aux, worker->resource);
+        if (pdu_len > 0) {
+            ssize_t bytes = _tl_send(&worker->socket, worker->buf, pdu_len,
+                                     &worker->remote, aux);
+            if (bytes <= 0) {
+                DEBUG("gcoap: send response failed: %" PRIdSIZE "\n", bytes);
+            }
+        }
+        worker->busy = false;
+    }
+    return NULL;
+}
+
+/* Finds an idle worker for a request. Returns -EALREADY if a worker is busy
+ * with the same request already (a retransmission), -EBUSY if there is no
+ * idle worker. */
+static int _worker_find(const coap_pkt_t *pdu, const sock_udp_ep_t *remote)
+{
+    int idle = -EBUSY;
+
+    for (unsigned i = 0; i < CONFIG_GCOAP_WORKERS_NUMOF; i++) {
+        const _worker_t *worker = &_workers[i];
+
+        if (!worker->busy) {
+            if (idle < 0) {
+                idle = i;
+            }
+        }
+        else if ((worker->mid == coap_get_id(pdu)) &&
+                 sock_udp_ep_equal(&worker->remote, remote)) {
+            return -EALREADY;
+        }
+    }
+    return idle;
+}
+
+static void _worker_start(_worker_t *worker, const gcoap_socket_t *sock,
+                          const coap_pkt_t *pdu, const sock_udp_ep_t *remote,
+                          const sock_udp_aux_tx_t *aux,
+                          const coap_resource_t *resource)
+{
+    size_t hdr_len = pdu->payload - (uint8_t *)pdu->hdr;
+
+    /* the buffer of gcoap is reused for the next request */
+    memcpy(worker->buf, pdu->hdr, hdr_len + pdu->payload_len);
+    worker->pdu = *pdu;
+    worker->pdu.hdr = (coap_hdr_t *)worker->buf;
+    worker->pdu.payload = worker->buf + hdr_len;
+    worker->socket = *sock;
+    worker->remote = *remote;
+    worker->has_aux = (aux != NULL);
+    if (aux != NULL) {
+        worker->aux = *aux;
+    }
+    worker->resource = resource;
+    worker->mid = coap_get_id(pdu);
+    worker->busy = true;
+    thread_flags_set(worker->thread, GCOAP_WORKER_FLAG);
+}
+
+static void _workers_init(void)
+{
+    for (unsigned i = 0; i < CONFIG_GCOAP_WORKERS_NUMOF; i++) {
+        kernel_pid_t pid = thread_create(_worker_stacks[i],
+                                         sizeof(_worker_stacks[i]),
+                                         THREAD_PRIORITY_MAIN - 1, 0,
+                                         _worker_loop, &_workers[i],
+                                         "gcoap worker");
+        _workers[i].thread = thread_get(pid);
+    }
+}
+#endif
+
 static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
                           size_t len, sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
 {
@@ -693,7 +1249,14 @@ static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
             return gcoap_response(pdu, buf, len, COAP_CODE_PATH_NOT_FOUND);
         case GCOAP_RESOURCE_FOUND:
             /* find observe registration for resource */
-            _find_obs_memo_resource(&resource_memo, resource);
+            if (IS_USED(MODULE_GCOAP_OBS_FANOUT)) {
+                /* other endpoints may observe the resource as well */
+                _find_obs_memo_resource_ep(&resource_memo, resource, sock,
+                                           remote);
+            }
+            else {
+                _find_obs_memo_resource(&resource_memo, resource);
+            }
             break;
         case GCOAP_RESOURCE_ERROR:
         default:
@@ -701,6 +1264,25 @@ static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
             break;
     }
 
+#if IS_USED(MODULE_GCOAP_WORKERS)
+    int worker = -ENOENT;
+
+    if ((resource->methods & COAP_HANDLER_SLOW) &&
+        (sock->type == GCOAP_SOCKET_TYPE_UDP)) {
+        worker = _worker_find(pdu, remote);
+        if (worker == -EALREADY) {
+            DEBUG("gcoap: dropping retransmission of a request in progress\n");
+            return 0;
+        }
+        if (worker == -EBUSY) {
+            DEBUG("gcoap: all workers busy\n");
+            return gcoap_response(pdu, buf, len, COAP_CODE_SERVICE_UNAVAILABLE);
+        }
+    }
+#endif
+
+    /* handlers in worker threads may send notifications meanwhile */
+    mutex_lock(&_coap_state.lock);
     if (coap_get_observe(pdu) == COAP_OBS_REGISTER) {
         /* lookup remote+token */
         int empty_slot = _find_obs_memo(&memo, remote, NULL, pdu);
@@ -793,24 +1375,20 @@ static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
     } else if (coap_has_observe(pdu)) {
         /* bogus request; don't respond */
         DEBUG("gcoap: Observe value unexpected: %" PRIu32 "\n", coap_get_observe(pdu));
+        mutex_unlock(&_coap_state.lock);
         return -1;
     }
+    mutex_unlock(&_coap_state.lock);
 
-    ssize_t pdu_len;
-
-    coap_request_ctx_t ctx = {
-        .resource = resource,
-        .tl_type = (uint32_t)sock->type,
-        .remote = remote,
-        .local = aux ? &aux->local : NULL,
-    };
-
-    pdu_len = resource->handler(pdu, buf, len, &ctx);
-    if (pdu_len < 0) {
-        pdu_len = gcoap_response(pdu, buf, len,
-                                 COAP_CODE_INTERNAL_SERVER_ERROR);
+#if IS_USED(MODULE_GCOAP_WORKERS)
+    if (worker >= 0) {
+        /* the worker sends the response */
+        _worker_start(&_workers[worker], sock, pdu, remote, aux, resource);
+        return 0;
     }
-    return pdu_len;
+#endif
+
+    return _call_handler(sock, pdu, buf, len, remote, aux, resource);
 }
 
 static const coap_resource_t *_match_resource_path_iterator(const gcoap_listener_t *listener,
@@ -870,6 +1448,40 @@ static int _request_matcher_default(gcoap_listener_t *listener,
     return ret;
 }
 
+static int _request_matcher_sorted(gcoap_listener_t *listener,
+                                   const coap_resource_t **resource,
+                                   coap_pkt_t *pdu)
+{
+    uint8_t uri[CONFIG_NANOCOAP_URI_MAX];
+
+    if (coap_get_uri_path(pdu, uri) <= 0) {
+        return GCOAP_RESOURCE_NO_PATH;
+    }
+
+    switch (coap_find_resource_sorted(listener->resources,
+                                      listener->resources_len, uri,
+                                      coap_method2flag(coap_get_code_detail(pdu)),
+                                      resource)) {
+    case 0:
+        return GCOAP_RESOURCE_FOUND;
+    case -EPERM:
+        return GCOAP_RESOURCE_WRONG_METHOD;
+    default:
+        return GCOAP_RESOURCE_NO_PATH;
+    }
+}
+
+static bool _resources_sorted(const gcoap_listener_t *listener)
+{
+    for (size_t i = 1; i < listener->resources_len; i++) {
+        if (strcmp(listener->resources[i - 1].path,
+                   listener->resources[i].path) > 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
 /*
  * Searches listener registrations for the resource matching the path in a PDU.
  *
@@ -898,7 +1510,7 @@ static int _find_resource(gcoap_socket_type_t tl_type,
 
         /* only makes sense to check if non-UDP transports are supported,
          * so check if module is used first. */
-        if (IS_USED(MODULE_GCOAP_DTLS) &&
+        if ((IS_USED(MODULE_GCOAP_DTLS) || IS_USED(MODULE_GCOAP_TCP)) &&
             (listener->tl_type != GCOAP_SOCKET_TYPE_UNDEF) &&
             !(listener->tl_type & tl_type)) {
             listener = listener->next;
@@ -932,6 +1544,118 @@ static int _find_resource(gcoap_socket_type_t tl_type,
     return ret;
 }
 
+static unsigned _memo_tkn_bucket(const uint8_t *token, size_t tkl)
+{
+    /* FNV-1a */
+    uint32_t hash = 2166136261U;
+
+    for (size_t i = 0; i < tkl; i++) {
+        hash = (hash ^ token[i]) * 16777619U;
+    }
+    return hash % CONFIG_GCOAP_REQ_WAITING_MAX;
+}
+
+static unsigned _memo_mid_bucket(uint16_t mid)
+{
+    return mid % CONFIG_GCOAP_REQ_WAITING_MAX;
+}
+
+static void _memo_chain_remove(gcoap_memo_idx_t *head, gcoap_memo_idx_t *next,
+                               unsigned idx)
+{
+    while (*head != idx) {
+        assert(*head != MEMO_IDX_NONE);
+        head = &next[*head];
+    }
+    *head = next[idx];
+}
+
+static void _memo_index_init(void)
+{
+    gcoap_memo_index_t *index = &_coap_state.memo_index;
+
+    mutex_init(&index->lock);
+    for (unsigned i = 0; i < CONFIG_GCOAP_REQ_WAITING_MAX; i++) {
+        index->tkn_head[i] = MEMO_IDX_NONE;
+        index->mid_head[i] = MEMO_IDX_NONE;
+        index->tkn_bucket[i] = MEMO_IDX_NONE;
+        index->mid_bucket[i] = MEMO_IDX_NONE;
+        index->tkn_next[i] = i + 1;
+    }
+    index->tkn_next[CONFIG_GCOAP_REQ_WAITING_MAX - 1] = MEMO_IDX_NONE;
+    index->unused = 0;
+}
+
+/*
+ * Takes a memo from the unused ones.
+ *
+ * return         The memo in state GCOAP_MEMO_WAIT, or NULL if all are in use
+ */
+static gcoap_request_memo_t *_memo_alloc(void)
+{
+    gcoap_memo_index_t *index = &_coap_state.memo_index;
+    gcoap_request_memo_t *memo = NULL;
+
+    mutex_lock(&index->lock);
+    if (index->unused != MEMO_IDX_NONE) {
+        memo = &_coap_state.open_reqs[index->unused];
+        index->unused = index->tkn_next[index->unused];
+        memo->state = GCOAP_MEMO_WAIT;
+    }
+    mutex_unlock(&index->lock);
+    return memo;
+}
+
+/*
+ * Makes a memo findable by the token and message ID of its request.
+ */
+static void _memo_index(gcoap_request_memo_t *memo)
+{
+    gcoap_memo_index_t *index = &_coap_state.memo_index;
+    unsigned idx = index_of(_coap_state.open_reqs, memo);
+    coap_pkt_t pdu = { .hdr = gcoap_request_memo_get_hdr(memo) };
+    unsigned tkn_bucket = _memo_tkn_bucket(coap_get_token(&pdu),
+                                           coap_get_token_len(&pdu));
+    unsigned mid_bucket = _memo_mid_bucket(coap_get_id(&pdu));
+
+    mutex_lock(&index->lock);
+    index->tkn_bucket[idx] = tkn_bucket;
+    index->tkn_next[idx] = index->tkn_head[tkn_bucket];
+    index->tkn_head[tkn_bucket] = idx;
+    index->mid_bucket[idx] = mid_bucket;
+    index->mid_next[idx] = index->mid_head[mid_bucket];
+    index->mid_head[mid_bucket] = idx;
+    mutex_unlock(&index->lock);
+}
+
+/*
+ * Sets a memo to GCOAP_MEMO_UNUSED and returns it to the unused ones.
+ */
+static void _memo_free(gcoap_request_memo_t *memo)
+{
+    gcoap_memo_index_t *index = &_coap_state.memo_index;
+    unsigned idx = index_of(_coap_state.open_reqs, memo);
+
+    mutex_lock(&index->lock);
+    if (memo->state == GCOAP_MEMO_UNUSED) {
+        /* already freed */
+        mutex_unlock(&index->lock);
+        return;
+    }
+    if (index->tkn_bucket[idx] != MEMO_IDX_NONE) {
+        _memo_chain_remove(&index->tkn_head[index->tkn_bucket[idx]],
+                           index->tkn_next, idx);
+        _memo_chain_remove(&index->mid_head[index->mid_bucket[idx]],
+                           index->mid_next, idx);
+        index->tkn_bucket[idx] = MEMO_IDX_NONE;
+        index->mid_bucket[idx] = MEMO_IDX_NONE;
+    }
+    memo->state = GCOAP_MEMO_UNUSED;
+    index->tkn_next[idx] = index->unused;
+    index->unused = idx;
+    mutex_unlock(&index->lock);
+}
+
 /*
  * Finds the memo for an outstanding request within the _coap_state.open_reqs
  * array. Matches on remote endpoint and token.
@@ -948,12 +1672,12 @@ static gcoap_request_memo_t* _find_req_memo_by_token(const sock_udp_ep_t *remote
     /* no need to initialize struct; we only care about buffer contents below */
     coap_pkt_t memo_pdu_data;
     coap_pkt_t *memo_pdu = &memo_pdu_data;
+    gcoap_memo_index_t *index = &_coap_state.memo_index;
+    gcoap_request_memo_t *res = NULL;
 
-    for (int i = 0; i < CONFIG_GCOAP_REQ_WAITING_MAX; i++) {
-        if (_coap_state.open_reqs[i].state == GCOAP_MEMO_UNUSED) {
-            continue;
-        }
-
+    mutex_lock(&index->lock);
+    for (unsigned i = index->tkn_head[_memo_tkn_bucket(token, tkl)];
+         i != MEMO_IDX_NONE; i = index->tkn_next[i]) {
         gcoap_request_memo_t *memo = &_coap_state.open_reqs[i];
         memo_pdu->hdr = gcoap_request_memo_get_hdr(memo);
 
@@ -986,9 +1710,11 @@ static gcoap_request_memo_t* _find_req_memo_by_token(const sock_udp_ep_t *remote
                 continue;
             }
         }
-        return memo;
+        res = memo;
+        break;
     }
-    return NULL;
+    mutex_unlock(&index->lock);
+    return res;
 }
 
 /*
@@ -1021,19 +1747,22 @@ static gcoap_request_memo_t* _find_req_memo_by_pdu_token(
  */
 static gcoap_request_memo_t* _find_req_memo_by_mid(const sock_udp_ep_t *remote, uint16_t mid)
 {
-    for (int i = 0; i < CONFIG_GCOAP_REQ_WAITING_MAX; i++) {
-        if (_coap_state.open_reqs[i].state == GCOAP_MEMO_UNUSED) {
-            continue;
-        }
+    gcoap_memo_index_t *index = &_coap_state.memo_index;
+    gcoap_request_memo_t *res = NULL;
 
+    mutex_lock(&index->lock);
+    for (unsigned i = index->mid_head[_memo_mid_bucket(ntohs(mid))];
+         i != MEMO_IDX_NONE; i = index->mid_next[i]) {
         gcoap_request_memo_t *memo = &_coap_state.open_reqs[i];
 
         if ((mid == gcoap_request_memo_get_hdr(memo)->id) &&
             sock_udp_ep_equal(&memo->remote_ep, remote)) {
-            return memo;
+            res = memo;
+            break;
         }
     }
-    return NULL;
+    mutex_unlock(&index->lock);
+    return res;
 }
 
 /* Calls handler callback on receipt of a timeout message. */
@@ -1050,7 +1779,7 @@ static void _expire_request(gcoap_request_memo_t *memo)
             memo->resp_handler(memo, &req, NULL);
         }
         _memo_clear_resend_buffer(memo);
-        memo->state = GCOAP_MEMO_UNUSED;
+        _memo_free(memo);
     }
     else {
         /* Response already handled; timeout must have fired while response */
@@ -1241,6 +1970,32 @@ static void _find_obs_memo_resource(gcoap_observe_memo_t **memo,
     }
 }
 
+/*
+ * Find registered observe memo of an endpoint for a resource.
+ *
+ * memo[out] -- Registered observe memo, or NULL if not found
+ * resource[in] -- Resource to match
+ * sock[in] -- Transport type of the observer
+ * remote[in] -- Endpoint of the observer
+ */
+static void _find_obs_memo_resource_ep(gcoap_observe_memo_t **memo,
+                                       const coap_resource_t *resource,
+                                       const gcoap_socket_t *sock,
+                                       const sock_udp_ep_t *remote)
+{
+    *memo = NULL;
+    for (int i = 0; i < CONFIG_GCOAP_OBS_REGISTRATIONS_MAX; i++) {
+        gcoap_observe_memo_t *m = &_coap_state.observe_memos[i];
+
+        if ((m->observer != NULL) && (m->resource == resource) &&
+            (m->socket.type == sock->type) &&
+            sock_udp_ep_equal(m->observer, remote)) {
+            *memo = m;
+            break;
+        }
+    }
+}
+
 /*
  * Transport layer functions
  */
@@ -1255,6 +2010,13 @@ static int _tl_init_coap_socket(gcoap_socket_t *sock, gcoap_socket_type_t type)
             sock->type = GCOAP_SOCKET_TYPE_UDP;
             sock->socket.udp = &_sock_udp;
             break;
+#if IS_USED(MODULE_GCOAP_TCP)
+        case GCOAP_SOCKET_TYPE_TCP:
+            /* the connection is looked up by the remote */
+            sock->type = GCOAP_SOCKET_TYPE_TCP;
+            sock->socket.tcp = NULL;
+            break;
+#endif
 #if IS_USED(MODULE_GCOAP_DTLS)
         case GCOAP_SOCKET_TYPE_UNDEF:
         case GCOAP_SOCKET_TYPE_DTLS:
@@ -1271,12 +2033,29 @@ static int _tl_init_coap_socket(gcoap_socket_t *sock, gcoap_socket_type_t type)
 
 static ssize_t _tl_send(gcoap_socket_t *sock, const void *data, size_t len,
                         const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
+{
+    const iolist_t snip = {
+        .iol_base = (void *)data,
+        .iol_len  = len,
+    };
+
+    return _tl_sendv(sock, &snip, remote, aux);
+}
+
+static ssize_t _tl_sendv(gcoap_socket_t *sock, const iolist_t *snips,
+                         const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
 {
     ssize_t res = -1;
     switch (sock->type) {
         case GCOAP_SOCKET_TYPE_UDP:
-            res = sock_udp_send_aux(sock->socket.udp, data, len, remote, aux);
+            res = sock_udp_sendv_aux(sock->socket.udp, snips, remote, aux);
+            break;
+#if IS_USED(MODULE_GCOAP_TCP)
+        case GCOAP_SOCKET_TYPE_TCP:
+            (void)aux;
+            res = _tcp_sendv(snips, remote);
             break;
+#endif
 #if IS_USED(MODULE_GCOAP_DTLS)
         case GCOAP_SOCKET_TYPE_DTLS:
             /* prepare session */
@@ -1290,8 +2069,8 @@ static ssize_t _tl_send(gcoap_socket_t *sock, const void *data, size_t len,
             }
 
             /* send application data */
-            res = sock_dtls_send(sock->socket.dtls, &sock->ctx_dtls_session, data, len,
-                                    SOCK_NO_TIMEOUT);
+            res = sock_dtls_sendv_aux(sock->socket.dtls, &sock->ctx_dtls_session,
+                                      snips, SOCK_NO_TIMEOUT, NULL);
             switch (res) {
             case -EHOSTUNREACH:
             case -ENOTCONN:
@@ -1463,7 +2242,7 @@ static void _receive_from_cache_cb(void *ctx)
                 memo->state = (ce->truncated) ? GCOAP_MEMO_RESP_TRUNC : GCOAP_MEMO_RESP;
                 memo->resp_handler(memo, &pdu, &memo->remote_ep);
                 _memo_clear_resend_buffer(memo);
-                memo->state = GCOAP_MEMO_UNUSED;
+                _memo_free(memo);
             }
         }
     }
@@ -1605,6 +2384,7 @@ kernel_pid_t gcoap_init(void)
     mutex_init(&_coap_state.lock);
     /* Blank lists so we know if an entry is available. */
     memset(&_coap_state.open_reqs[0], 0, sizeof(_coap_state.open_reqs));
+    _memo_index_init();
     memset(&_coap_state.observers[0], 0, sizeof(_coap_state.observers));
     memset(&_coap_state.observe_memos[0], 0, sizeof(_coap_state.observe_memos));
     memset(&_coap_state.resend_bufs[0], 0, sizeof(_coap_state.resend_bufs));
@@ -1614,6 +2394,9 @@ kernel_pid_t gcoap_init(void)
     if (IS_USED(MODULE_NANOCOAP_CACHE)) {
         nanocoap_cache_init();
     }
+#if IS_USED(MODULE_GCOAP_WORKERS)
+    _workers_init();
+#endif
     /* initialize the forward proxy operation, if compiled */
     if (IS_ACTIVE(MODULE_GCOAP_FORWARD_PROXY)) {
         gcoap_forward_proxy_init();
@@ -1652,7 +2435,10 @@ void gcoap_register_listener(gcoap_listener_t *listener)
     }
 
     if (!listener->request_matcher) {
-        listener->request_matcher = _request_matcher_default;
+        /* a binary search finds the same resource as the linear one */
+        listener->request_matcher = _resources_sorted(listener)
+                                  ? _request_matcher_sorted
+                                  : _request_matcher_default;
     }
 }
 
@@ -1674,6 +2460,18 @@ const coap_resource_t *gcoap_get_resource_by_path_iterator(const gcoap_listener_
     return NULL;
 }
 
+#if CONFIG_GCOAP_TOKENLEN
+static void _gen_token(uint8_t *token)
+{
+    for (size_t i = 0; i < CONFIG_GCOAP_TOKENLEN; i += 4) {
+        uint32_t rand = random_uint32();
+        memcpy(&token[i],
+               &rand,
+               (CONFIG_GCOAP_TOKENLEN - i >= 4) ? 4 : CONFIG_GCOAP_TOKENLEN - i);
+    }
+}
+#endif
+
 int gcoap_req_init_path_buffer(coap_pkt_t *pdu, uint8_t *buf, size_t len,
                                unsigned code, const char *path, size_t path_len)
 {
@@ -1687,12 +2485,7 @@ int gcoap_req_init_path_buffer(coap_pkt_t *pdu, uint8_t *buf, size_t len,
     if (code) {
 #if CONFIG_GCOAP_TOKENLEN
         uint8_t token[CONFIG_GCOAP_TOKENLEN];
-        for (size_t i = 0; i < CONFIG_GCOAP_TOKENLEN; i += 4) {
-            uint32_t rand = random_uint32();
-            memcpy(&token[i],
-                   &rand,
-                   (CONFIG_GCOAP_TOKENLEN - i >= 4) ? 4 : CONFIG_GCOAP_TOKENLEN - i);
-        }
+        _gen_token(token);
         res = coap_build_hdr(pdu->hdr, COAP_TYPE_NON, &token[0],
                              CONFIG_GCOAP_TOKENLEN, code, msgid);
 #else
@@ -1717,6 +2510,20 @@ int gcoap_req_init_path_buffer(coap_pkt_t *pdu, uint8_t *buf, size_t len,
     return (res > 0) ? 0 : res;
 }
 
+ssize_t gcoap_req_init_from_template(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                                     const coap_template_t *tpl)
+{
+#if CONFIG_GCOAP_TOKENLEN
+    uint8_t token[CONFIG_GCOAP_TOKENLEN];
+    _gen_token(token);
+#else
+    uint8_t *token = NULL;
+#endif
+
+    return coap_build_from_template(pdu, buf, len, tpl, token,
+                                    CONFIG_GCOAP_TOKENLEN, gcoap_next_msg_id());
+}
+
 int gcoap_obs_req_forget(const sock_udp_ep_t *remote, const uint8_t *token,
                          size_t tokenlen) {
     int res = -ENOENT;
@@ -1726,7 +2533,7 @@ int gcoap_obs_req_forget(const sock_udp_ep_t *remote, const uint8_t *token,
     obs_req_memo = _find_req_memo_by_token(remote, token, tokenlen);
     if (obs_req_memo) {
         /* forget the existing observe memo. */
-        obs_req_memo->state = GCOAP_MEMO_UNUSED;
+        _memo_free(obs_req_memo);
         res = 0;
     }
 
@@ -1752,18 +2559,16 @@ ssize_t gcoap_req_send(const uint8_t *buf, size_t len,
     if (res < 0) {
         return -EINVAL;
     }
+    if (socket.type == GCOAP_SOCKET_TYPE_TCP) {
+        /* no retransmissions over a reliable transport */
+        msg_type = COAP_TYPE_NON;
+    }
     /* Only allocate memory if necessary (i.e. if user is interested in the
      * response or request is confirmable) */
     if ((resp_handler != NULL) || (msg_type == COAP_TYPE_CON)) {
         mutex_lock(&_coap_state.lock);
         /* Find empty slot in list of open requests. */
-        for (int i = 0; i < CONFIG_GCOAP_REQ_WAITING_MAX; i++) {
-            if (_coap_state.open_reqs[i].state == GCOAP_MEMO_UNUSED) {
-                memo = &_coap_state.open_reqs[i];
-                memo->state = GCOAP_MEMO_WAIT;
-                break;
-            }
-        }
+        memo = _memo_alloc();
         if (!memo) {
             mutex_unlock(&_coap_state.lock);
             DEBUG("gcoap: dropping request; no space for response tracking\n");
@@ -1780,7 +2585,7 @@ ssize_t gcoap_req_send(const uint8_t *buf, size_t len,
 
             if (res < 0) {
                 DEBUG("gcoap: Error from cache check");
-                memo->state = GCOAP_MEMO_UNUSED;
+                _memo_free(memo);
                 mutex_unlock(&_coap_state.lock);
                 return res;
             }
@@ -1793,7 +2598,7 @@ ssize_t gcoap_req_send(const uint8_t *buf, size_t len,
              * the provided buffer once is possible */
             if (len > CONFIG_GCOAP_PDU_BUF_SIZE) {
                 DEBUG("gcoap: Request too large for retransmit buffer");
-                memo->state = GCOAP_MEMO_UNUSED;
+                _memo_free(memo);
                 mutex_unlock(&_coap_state.lock);
                 return -EINVAL;
             }
@@ -1818,7 +2623,7 @@ ssize_t gcoap_req_send(const uint8_t *buf, size_t len,
                 memo->state = GCOAP_MEMO_RETRANSMIT;
             }
             else {
-                memo->state = GCOAP_MEMO_UNUSED;
+                _memo_free(memo);
                 DEBUG("gcoap: no space for PDU in resend bufs\n");
             }
             break;
@@ -1829,14 +2634,17 @@ ssize_t gcoap_req_send(const uint8_t *buf, size_t len,
             timeout = CONFIG_GCOAP_NON_TIMEOUT_MSEC;
             break;
         default:
-            memo->state = GCOAP_MEMO_UNUSED;
+            _memo_free(memo);
             DEBUG("gcoap: illegal msg type %u\n", msg_type);
             break;
         }
-        mutex_unlock(&_coap_state.lock);
         if (memo->state == GCOAP_MEMO_UNUSED) {
+            mutex_unlock(&_coap_state.lock);
             return 0;
         }
+        /* findable before the response can arrive */
+        _memo_index(memo);
+        mutex_unlock(&_coap_state.lock);
         if (cache_hit) {
             /* post to receive cache entry */
             event_callback_init(&_receive_from_cache,
@@ -1862,6 +2670,11 @@ ssize_t gcoap_req_send(const uint8_t *buf, size_t len,
     if (IS_USED(MODULE_GCOAP_DTLS) && socket.type == GCOAP_SOCKET_TYPE_DTLS) {
         res = _tl_authenticate(&socket, remote, CONFIG_GCOAP_DTLS_HANDSHAKE_TIMEOUT_MSEC);
     }
+#if IS_USED(MODULE_GCOAP_TCP)
+    if (socket.type == GCOAP_SOCKET_TYPE_TCP) {
+        res = _tcp_connect(&socket, remote);
+    }
+#endif
 
     /* set response timeout; may be zero for non-confirmable */
     if (memo != NULL && res == 0) {
@@ -1890,7 +2703,7 @@ ssize_t gcoap_req_send(const uint8_t *buf, size_t len,
             if (timeout > 0) {
                 event_timeout_clear(&memo->resp_evt_tmout);
             }
-            memo->state = GCOAP_MEMO_UNUSED;
+            _memo_free(memo);
     }
         DEBUG("gcoap: sock send failed: %" PRIdSIZE "\n", res);
     }
@@ -1960,6 +2773,66 @@ int gcoap_obs_init(coap_pkt_t *pdu, uint8_t *buf, size_t len,
     return GCOAP_OBS_INIT_OK;
 }
 
+static ssize_t _obs_sendv(gcoap_observe_memo_t *memo, const iolist_t *snips)
+{
+    sock_udp_aux_tx_t aux = { 0 };
+
+    if (memo->notifier) {
+        memcpy(&aux.local, memo->notifier, sizeof(*memo->notifier));
+        aux.flags = SOCK_AUX_SET_LOCAL;
+    }
+    return _tl_sendv(&memo->socket, snips, memo->observer, &aux);
+}
+
+/* Sends the notification in buf, built by gcoap_obs_init() for the first
+ * observer of the resource, to the other observers. Only the header is
+ * rebuilt for each of them, with its token and a new message ID; options and
+ * payload, including the Observe value, are shared. */
+static void _obs_fanout(const gcoap_observe_memo_t *first, const uint8_t *buf,
+                        size_t len)
+{
+    const coap_resource_t *resource = first->resource;
+    const coap_pkt_t pdu = { .hdr = (coap_hdr_t *)buf };
+    size_t hdr_len = ((uint8_t *)coap_get_token(&pdu) - buf)
+                     + coap_get_token_len(&pdu);
+    /* room for up to two bytes of extended token length */
+    uint8_t hdr[GCOAP_HEADER_MAXLEN + 2];
+    iolist_t body = {
+        .iol_base = (void *)(buf + hdr_len),
+        .iol_len = len - hdr_len,
+    };
+    iolist_t snips = {
+        .iol_next = &body,
+        .iol_base = hdr,
+    };
+
+    if (hdr_len > len) {
+        return;
+    }
+    for (gcoap_observe_memo_t *memo = (gcoap_observe_memo_t *)first + 1;
+         memo < &_coap_state.observe_memos[CONFIG_GCOAP_OBS_REGISTRATIONS_MAX];
+         memo++) {
+        if ((memo->observer == NULL) || (memo->resource != resource)) {
+            continue;
+        }
+        uint16_t msgid = gcoap_next_msg_id();
+        ssize_t res = coap_build_hdr((coap_hdr_t *)hdr, COAP_TYPE_NON,
+                                     memo->token, memo->token_len,
+                                     ((coap_hdr_t *)buf)->code, msgid);
+
+        if (res <= 0) {
+            continue;
+        }
+        snips.iol_len = res;
+        memo->last_msgid = msgid;
+        res = _obs_sendv(memo, &snips);
+        if (res <= 0) {
+            DEBUG("gcoap: notification to observer failed: %" PRIdSIZE "\n",
+                  res);
+        }
+    }
+}
+
 size_t gcoap_obs_send(const uint8_t *buf, size_t len,
                       const coap_resource_t *resource)
 {
@@ -1968,12 +2841,15 @@ size_t gcoap_obs_send(const uint8_t *buf, size_t len,
     _find_obs_memo_resource(&memo, resource);
 
     if (memo) {
-        sock_udp_aux_tx_t aux = { 0 };
-        if (memo->notifier) {
-            memcpy(&aux.local, memo->notifier, sizeof(*memo->notifier));
-            aux.flags = SOCK_AUX_SET_LOCAL;
+        const iolist_t snip = {
+            .iol_base = (void *)buf,
+            .iol_len  = len,
+        };
+
+        ret = _obs_sendv(memo, &snip);
+        if (IS_USED(MODULE_GCOAP_OBS_FANOUT)) {
+            _obs_fanout(memo, buf, len);
         }
-        ret = _tl_send(&memo->socket, buf, len, memo->observer, &aux);
     }
     mutex_unlock(&_coap_state.lock);
     return ret <= 0 ? 0 : (size_t)ret;
@@ -2012,11 +2888,10 @@ int gcoap_get_resource_list(void *buf, size_t maxlen, uint8_t cf,
         }
         /* only makes sense to check if non-UDP transports are supported,
          * so check if module is used first. */
-        if (IS_USED(MODULE_GCOAP_DTLS) &&
+        if ((IS_USED(MODULE_GCOAP_DTLS) || IS_USED(MODULE_GCOAP_TCP)) &&
             (tl_type != GCOAP_SOCKET_TYPE_UNDEF) &&
             (listener->tl_type != GCOAP_SOCKET_TYPE_UNDEF) &&
-            ((listener->tl_type & GCOAP_SOCKET_TYPE_UDP) != (tl_type & GCOAP_SOCKET_TYPE_UDP)) &&
-            ((listener->tl_type & GCOAP_SOCKET_TYPE_DTLS) != (tl_type & GCOAP_SOCKET_TYPE_DTLS))) {
+            !(listener->tl_type & tl_type)) {
             continue;
         }
         ctx.link_pos = 0;
@@ -23,40 +23,158 @@
 #include "kernel_defines.h"
 #include "net/nanocoap/cache.h"
 #include "hashes/sha256.h"
+#if IS_USED(MODULE_NANOCOAP_CACHE_SIPHASH)
+#include "hashes/siphash.h"
+#include "random.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+#if CONFIG_NANOCOAP_CACHE_ENTRIES < UINT8_MAX
+typedef uint8_t _idx_t;
+#define _IDX_NONE   UINT8_MAX
+#else
+typedef uint16_t _idx_t;
+#define _IDX_NONE   UINT16_MAX
+#endif
+
+/* the cache keys are hash values already, so their first bytes are used to
+ * select the bucket of an entry */
+#define _BUCKETS    CONFIG_NANOCOAP_CACHE_ENTRIES
+
+#if IS_USED(MODULE_NANOCOAP_CACHE_SIPHASH)
+static_assert(CONFIG_NANOCOAP_CACHE_KEY_LENGTH <= SIPHASH_DIGEST_LENGTH,
+              "nanocoap_cache_siphash: cache key longer than the hash value");
+#endif
+
 static int _cache_replacement_lru(void);
 static int _cache_update_lru(clist_node_t *node);
 
-static clist_node_t _cache_list_head = { NULL };
 static clist_node_t _empty_list_head = { NULL };
 
 static nanocoap_cache_entry_t _cache_entries[CONFIG_NANOCOAP_CACHE_ENTRIES];
 
+/* Index of the cached entries: a doubly-linked LRU list, the least recently
+ * used entry at its head, and a hash table over the cache keys with chains of
+ * entries in the same bucket. Both are linked by array indices to keep the
+ * overhead at a few bytes per entry. */
+static struct {
+    _idx_t lru_head;
+    _idx_t lru_tail;
+    _idx_t lru_prev[CONFIG_NANOCOAP_CACHE_ENTRIES];
+    _idx_t lru_next[CONFIG_NANOCOAP_CACHE_ENTRIES];
+    _idx_t bucket[_BUCKETS];
+    _idx_t chain[CONFIG_NANOCOAP_CACHE_ENTRIES];
+    _idx_t used;
+} _index;
+
+#if IS_USED(MODULE_NANOCOAP_CACHE_SIPHASH)
+static uint8_t _siphash_key[SIPHASH_KEY_LENGTH];
+#endif
+
 static const nanocoap_cache_replacement_strategy_t _replacement_strategy = _cache_replacement_lru;
 static const nanocoap_cache_update_strategy_t _update_strategy = _cache_update_lru;
 
-static int _cache_replacement_lru(void)
+static inline _idx_t _idx(const nanocoap_cache_entry_t *ce)
 {
-    clist_node_t *lru_node = clist_lpeek(&_cache_list_head);
+    return ce - _cache_entries;
+}
+
+static unsigned _bucket(const uint8_t *cache_key)
+{
+    uint32_t val = 0;
 
+    memcpy(&val, cache_key, (CONFIG_NANOCOAP_CACHE_KEY_LENGTH < sizeof(val))
+                            ? CONFIG_NANOCOAP_CACHE_KEY_LENGTH : sizeof(val));
+    return val % _BUCKETS;
+}
+
+static bool _is_cached(const nanocoap_cache_entry_t *ce)
+{
+    if ((ce < &_cache_entries[0]) ||
+        (ce > &_cache_entries[CONFIG_NANOCOAP_CACHE_ENTRIES - 1])) {
+        return false;
+    }
+    return (_index.lru_head == _idx(ce)) ||
+           (_index.lru_prev[_idx(ce)] != _IDX_NONE);
+}
+
+static void _lru_unlink(_idx_t i)
+{
+    _idx_t prev = _index.lru_prev[i];
+    _idx_t next = _index.lru_next[i];
+
+    if (prev == _IDX_NONE) {
+        _index.lru_head = next;
+    }
+    else {
+        _index.lru_next[prev] = next;
+    }
+    if (next == _IDX_NONE) {
+        _index.lru_tail = prev;
+    }
+    else {
+        _index.lru_prev[next] = prev;
+    }
+    _index.lru_prev[i] = _IDX_NONE;
+    _index.lru_next[i] = _IDX_NONE;
+}
+
+static void _lru_append(_idx_t i)
+{
+    _index.lru_prev[i] = _index.lru_tail;
+    _index.lru_next[i] = _IDX_NONE;
+    if (_index.lru_tail == _IDX_NONE) {
+        _index.lru_head = i;
+    }
+    else {
+        _index.lru_next[_index.lru_tail] = i;
+    }
+    _index.lru_tail = i;
+}
+
+static void _bucket_remove(_idx_t i)
+{
+    _idx_t *link = &_index.bucket[_bucket(_cache_entries[i].cache_key)];
+
+    while (*link != _IDX_NONE) {
+        if (*link == i) {
+            *link = _index.chain[i];
+            break;
+        }
+        link = &_index.chain[*link];
+    }
+    _index.chain[i] = _IDX_NONE;
+}
+
+static void _bucket_add(_idx_t i)
+{
+    _idx_t *head = &_index.bucket[_bucket(_cache_entries[i].cache_key)];
+
+    _index.chain[i] = *head;
+    *head = i;
+}
+
+static int _cache_replacement_lru(void)
+{
     /* no element in the list */
-    if (!lru_node) {
+    if (_index.lru_head == _IDX_NONE) {
         return -1;
     }
 
-    nanocoap_cache_entry_t *lru_ce = container_of(lru_node, nanocoap_cache_entry_t, node);
-    return nanocoap_cache_del(lru_ce);
+    return nanocoap_cache_del(&_cache_entries[_index.lru_head]);
 }
 
 static int _cache_update_lru(clist_node_t *node)
 {
-    if (clist_remove(&_cache_list_head, node)) {
+    nanocoap_cache_entry_t *ce = container_of(node, nanocoap_cache_entry_t, node);
+
+    if (_is_cached(ce)) {
         /* Move an accessed node to the end of the list. Least
          * recently used nodes are at the beginning of this list */
-        clist_rpush(&_cache_list_head, node);
+        _lru_unlink(_idx(ce));
+        _lru_append(_idx(ce));
         return 0;
     }
     return -1;
@@ -64,26 +182,38 @@ static int _cache_update_lru(clist_node_t *node)
 
 void nanocoap_cache_init(void)
 {
-    _cache_list_head.next = NULL;
     _empty_list_head.next = NULL;
     memset(_cache_entries, 0, sizeof(_cache_entries));
+    memset(&_index, 0xff, sizeof(_index));
+    _index.used = 0;
     /* construct list of empty entries */
     for (unsigned i = 0; i < CONFIG_NANOCOAP_CACHE_ENTRIES; i++) {
         clist_rpush(&_empty_list_head, &_cache_entries[i].node);
     }
+#if IS_USED(MODULE_NANOCOAP_CACHE_SIPHASH)
+    random_bytes(_siphash_key, sizeof(_siphash_key));
+#endif
 }
 
 size_t nanocoap_cache_used_count(void)
 {
-    return clist_count(&_cache_list_head);
+    return _index.used;
 }
 
 size_t nanocoap_cache_free_count(void)
 {
-    return clist_count(&_empty_list_head);
+    return CONFIG_NANOCOAP_CACHE_ENTRIES - _index.used;
+}
+
+typedef void (*_digest_update_t)(void *ctx, const void *data, size_t len);
+
+static void _sha256_update(void *ctx, const void *data, size_t len)
+{
+    sha256_update(ctx, data, len);
 }
 
-static void _cache_key_digest_opts(const coap_pkt_t *req, sha256_context_t *ctx,
+static void _cache_key_digest_opts(const coap_pkt_t *req, void *ctx,
+        _digest_update_t update,
         bool include_etag,
         bool include_blockwise)
 {
@@ -111,8 +241,8 @@ static void _cache_key_digest_opts(const coap_pkt_t *req, sha256_context_t *ctx,
                     )) {
                 continue;
             }
-            sha256_update(ctx, &opt.opt_num, sizeof(opt.opt_num));
-            sha256_update(ctx, value, optlen);
+            update(ctx, &opt.opt_num, sizeof(opt.opt_num));
+            update(ctx, value, optlen);
         }
     }
 }
@@ -121,7 +251,7 @@ void nanocoap_cache_key_options_generate(const coap_pkt_t *req, void *cache_key)
 {
     sha256_context_t ctx;
     sha256_init(&ctx);
-    _cache_key_digest_opts(req, &ctx, true, true);
+    _cache_key_digest_opts(req, &ctx, _sha256_update, true, true);
     sha256_final(&ctx, cache_key);
 }
 
@@ -129,16 +259,38 @@ void nanocoap_cache_key_blockreq_options_generate(const coap_pkt_t *req, void *c
 {
     sha256_context_t ctx;
     sha256_init(&ctx);
-    _cache_key_digest_opts(req, &ctx, true, false);
+    _cache_key_digest_opts(req, &ctx, _sha256_update, true, false);
     sha256_final(&ctx, cache_key);
 }
 
+#if IS_USED(MODULE_NANOCOAP_CACHE_SIPHASH)
+static void _siphash_update(void *ctx, const void *data, size_t len)
+{
+    siphash_update(ctx, data, len);
+}
+
+void nanocoap_cache_key_generate(const coap_pkt_t *req, uint8_t *cache_key)
+{
+    siphash_context_t ctx;
+    uint64_t digest;
+
+    siphash_init(&ctx, _siphash_key);
+    _cache_key_digest_opts(req, &ctx, _siphash_update,
+                           !(IS_USED(MODULE_GCOAP_FORWARD_PROXY)), true);
+    if (req->hdr->code == COAP_METHOD_FETCH) {
+        siphash_update(&ctx, req->payload, req->payload_len);
+    }
+    digest = siphash_final(&ctx);
+    memcpy(cache_key, &digest, sizeof(digest));
+}
+#else
 void nanocoap_cache_key_generate(const coap_pkt_t *req, uint8_t *cache_key)
 {
     sha256_context_t ctx;
     sha256_init(&ctx);
 
-    _cache_key_digest_opts(req, &ctx, !(IS_USED(MODULE_GCOAP_FORWARD_PROXY)), true);
+    _cache_key_digest_opts(req, &ctx, _sha256_update,
+                           !(IS_USED(MODULE_GCOAP_FORWARD_PROXY)), true);
     switch (req->hdr->code) {
         case COAP_METHOD_FETCH:
             sha256_update(&ctx, req->payload, req->payload_len);
@@ -148,37 +300,25 @@ void nanocoap_cache_key_generate(const coap_pkt_t *req, uint8_t *cache_key)
     }
     sha256_final(&ctx, cache_key);
 }
+#endif
 
 ssize_t nanocoap_cache_key_compare(uint8_t *cache_key1, uint8_t *cache_key2)
 {
     return memcmp(cache_key1, cache_key2, CONFIG_NANOCOAP_CACHE_KEY_LENGTH);
 }
 
-static int _compare_cache_keys(clist_node_t *ce, void *arg)
-{
-    nanocoap_cache_entry_t *iterator = container_of(ce, nanocoap_cache_entry_t, node);
-    uint8_t *cache_key = (uint8_t *) arg;
-
-    if (!memcmp(iterator->cache_key, cache_key, CONFIG_NANOCOAP_CACHE_KEY_LENGTH)) {
-        return 1;
-    }
-    return 0;
-}
-
-static clist_node_t *_nanocoap_cache_foreach(const uint8_t *key)
-{
-    return clist_foreach(&_cache_list_head, _compare_cache_keys, (uint8_t *)key);
-}
-
 nanocoap_cache_entry_t *nanocoap_cache_key_lookup(const uint8_t *key)
 {
-    clist_node_t *node = _nanocoap_cache_foreach(key);
+    for (_idx_t i = _index.bucket[_bucket(key)]; i != _IDX_NONE;
+         i = _index.chain[i]) {
+        nanocoap_cache_entry_t *ce = &_cache_entries[i];
 
-    if (node) {
-        _update_strategy(node);
+        if (!memcmp(ce->cache_key, key, CONFIG_NANOCOAP_CACHE_KEY_LENGTH)) {
+            _update_strategy(&ce->node);
+            return ce;
+        }
     }
-
-    return container_of(node, nanocoap_cache_entry_t, node);
+    return NULL;
 }
 
 nanocoap_cache_entry_t *nanocoap_cache_request_lookup(const coap_pkt_t *req)
@@ -321,7 +461,9 @@ nanocoap_cache_entry_t *nanocoap_cache_add_by_key(const uint8_t *cache_key,
     ce->max_age = ztimer_now(ZTIMER_SEC) + max_age;
 
     if (add_to_cache) {
-        clist_rpush(&_cache_list_head, &ce->node);
+        _lru_append(_idx(ce));
+        _bucket_add(_idx(ce));
+        _index.used++;
     }
 
     return ce;
@@ -344,12 +486,14 @@ nanocoap_cache_entry_t *nanocoap_cache_add_by_req(const coap_pkt_t *req,
 
 int nanocoap_cache_del(const nanocoap_cache_entry_t *ce)
 {
-    clist_node_t *entry = clist_find(&_cache_list_head, &ce->node);
+    if (_is_cached(ce)) {
+        nanocoap_cache_entry_t *entry = &_cache_entries[_idx(ce)];
 
-    if (entry) {
-        clist_remove(&_cache_list_head, entry);
+        _lru_unlink(_idx(ce));
+        _bucket_remove(_idx(ce));
+        _index.used--;
         memset(entry, 0, sizeof(nanocoap_cache_entry_t));
-        clist_rpush(&_empty_list_head, entry);
+        clist_rpush(&_empty_list_head, &entry->node);
         return 0;
     }
 
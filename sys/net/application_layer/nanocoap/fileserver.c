@@ -21,9 +21,11 @@
 #include <unistd.h>
 #include <fcntl.h>
 
+#include "container.h"
 #include "kernel_defines.h"
 #include "checksum/fletcher32.h"
 #include "net/nanocoap/fileserver.h"
+#include "net/sock/util.h"
 #include "vfs.h"
 #include "vfs_util.h"
 
@@ -33,6 +35,9 @@
 /** Maximum length of an expressible path, including the trailing 0 character. */
 #define COAPFILESERVER_PATH_MAX (64)
 
+/** Number of directory entries read at once for a listing */
+#define COAPFILESERVER_DIR_BATCH (2)
+
 /**
  * @brief   fileserver event callback, only used with `nanocoap_fileserver_callback`
  */
@@ -70,8 +75,31 @@ struct requestdata {
     /** 0-terminated expanded file name in the VFS */
     char namebuf[COAPFILESERVER_PATH_MAX];
     struct requestoptions options;
+    /** remote endpoint of the request, NULL if not received via UDP */
+    const sock_udp_ep_t *remote;
 };
 
+#if IS_USED(MODULE_NANOCOAP_FILESERVER_READAHEAD)
+/**
+ * @brief   A chunk of a file that was read ahead for a client
+ */
+typedef struct {
+    sock_udp_ep_t remote;           /**< client the chunk was read for */
+    uint32_t etag;                  /**< ETag of the file at the time of reading */
+    uint32_t offset;                /**< offset of the chunk in the file */
+    uint16_t len;                   /**< number of valid bytes in @ref buf */
+    uint16_t used;                  /**< last use, for replacement */
+    bool eof;                       /**< chunk reaches to the end of the file */
+    char namebuf[COAPFILESERVER_PATH_MAX];  /**< VFS path of the file */
+    /** file content, plus the byte that tells if there is a next block */
+    uint8_t buf[CONFIG_NANOCOAP_FILESERVER_READAHEAD_SIZE + 1];
+} _readahead_t;
+
+static _readahead_t _readahead[CONFIG_NANOCOAP_FILESERVER_READAHEAD_NUMOF];
+static uint16_t _readahead_clock;
+static mutex_t _readahead_mtx;
+#endif
+
 /**
  * @brief  Return true if path/name is a directory.
  */
@@ -201,6 +229,115 @@ static inline void _event_file(nanocoap_fileserver_event_t event, struct request
     }
 }
 
+#if IS_USED(MODULE_NANOCOAP_FILESERVER_READAHEAD)
+static bool _readahead_hit(const _readahead_t *ra, const struct requestdata *request,
+                           uint32_t etag, uint32_t offset, size_t len)
+{
+    return ra->len && (ra->etag == etag) && (ra->offset <= offset) &&
+           (ra->eof || (offset + len <= ra->offset + ra->len)) &&
+           !strcmp(ra->namebuf, request->namebuf);
+}
+
+static bool _readahead_has(const struct requestdata *request, uint32_t etag,
+                           uint32_t offset, size_t len)
+{
+    bool res = false;
+
+    mutex_lock(&_readahead_mtx);
+    for (unsigned i = 0; i < ARRAY_SIZE(_readahead) && !res; i++) {
+        res = _readahead_hit(&_readahead[i], request, etag, offset, len);
+    }
+    mutex_unlock(&_readahead_mtx);
+
+    return res;
+}
+
+/* Copies up to len bytes from offset of the file into dst if they were read
+ * ahead before. Returns the number of bytes copied, or -ENOENT on a miss. */
+static int _readahead_get(const struct requestdata *request, uint32_t etag,
+                          uint32_t offset, void *dst, size_t len)
+{
+    int res = -ENOENT;
+
+    mutex_lock(&_readahead_mtx);
+    /* any client's chunk will do, peers often fetch the same file */
+    for (unsigned i = 0; i < ARRAY_SIZE(_readahead); i++) {
+        _readahead_t *ra = &_readahead[i];
+        if (!_readahead_hit(ra, request, etag, offset, len)) {
+            continue;
+        }
+        size_t avail = (offset < ra->offset + ra->len)
+                     ? ra->offset + ra->len - offset : 0;
+        res = MIN(len, avail);
+        memcpy(dst, &ra->buf[offset - ra->offset], res);
+        ra->used = ++_readahead_clock;
+        break;
+    }
+    mutex_unlock(&_readahead_mtx);
+
+    return res;
+}
+
+/* Reads a chunk starting at offset from fd into the read-ahead slot of the
+ * client (or the least recently used one) and copies len bytes of it into
+ * dst. Returns the number of bytes copied or a negative errno. */
+static int _readahead_fill(const struct requestdata *request, uint32_t etag, int fd,
+                           uint32_t offset, void *dst, size_t len)
+{
+    _readahead_t *ra = &_readahead[0];
+    int res;
+
+    if (!request->remote || len > sizeof(ra->buf)) {
+        return -ENOTSUP;
+    }
+
+    mutex_lock(&_readahead_mtx);
+    for (unsigned i = 0; i < ARRAY_SIZE(_readahead); i++) {
+        if (sock_udp_ep_equal(&_readahead[i].remote, request->remote)) {
+            ra = &_readahead[i];
+            break;
+        }
+        if ((uint16_t)(_readahead_clock - _readahead[i].used) >
+            (uint16_t)(_readahead_clock - ra->used)) {
+            ra = &_readahead[i];
+        }
+    }
+
+    ra->len = 0;
+    if ((res = vfs_read(fd, ra->buf, sizeof(ra->buf))) >= 0) {
+        ra->remote = *request->remote;
+        ra->etag = etag;
+        ra->offset = offset;
+        ra->len = res;
+        ra->eof = ((size_t)res < sizeof(ra->buf));
+        ra->used = ++_readahead_clock;
+        strcpy(ra->namebuf, request->namebuf);
+        res = MIN((size_t)res, len);
+        memcpy(dst, ra->buf, res);
+    }
+    mutex_unlock(&_readahead_mtx);
+
+    return res;
+}
+#endif
+
+/* Copies up to len bytes from offset of the file into dst if the file system
+ * can map it, which saves seeking and reading ahead. Returns the number of
+ * bytes copied or -ENOTSUP. */
+static int _read_mapped(int fd, uint32_t offset, uint32_t size, void *dst, size_t len)
+{
+    const void *map;
+
+    len = (offset < size) ? MIN(len, size - offset) : 0;
+    if (vfs_mmap(fd, offset, len, &map) < 0) {
+        return -ENOTSUP;
+    }
+    memcpy(dst, map, len);
+    vfs_munmap(fd, map, len);
+
+    return len;
+}
+
 static ssize_t _get_file(coap_pkt_t *pdu, uint8_t *buf, size_t len,
                          struct requestdata *request)
 {
@@ -230,9 +367,18 @@ static ssize_t _get_file(coap_pkt_t *pdu, uint8_t *buf, size_t len,
         return coap_opt_finish(pdu, COAP_OPT_FINISH_NONE);
     }
 
-    int fd = vfs_open(request->namebuf, O_RDONLY, 0);
-    if (fd < 0) {
-        return _error_handler(pdu, buf, len, fd);
+    int fd = -1;
+    bool cached = false;
+#if IS_USED(MODULE_NANOCOAP_FILESERVER_READAHEAD)
+    /* the block can only get smaller in _calc_szx2(), its offset stays */
+    cached = _readahead_has(request, etag, block2.blknum * coap_szx2size(block2.szx),
+                            coap_szx2size(block2.szx) + 1);
+#endif
+    if (!cached) {
+        fd = vfs_open(request->namebuf, O_RDONLY, 0);
+        if (fd < 0) {
+            return _error_handler(pdu, buf, len, fd);
+        }
     }
 
     _resp_init(pdu, buf, len, COAP_CODE_CONTENT);
@@ -250,11 +396,6 @@ static ssize_t _get_file(coap_pkt_t *pdu, uint8_t *buf, size_t len,
 
     size_t resp_len = coap_opt_finish(pdu, COAP_OPT_FINISH_PAYLOAD);
 
-    err = vfs_lseek(fd, slicer.start, SEEK_SET);
-    if (err < 0) {
-        goto late_err;
-    }
-
     if (block2.blknum == 0) {
         _event_file(NANOCOAP_FILESERVER_GET_FILE_START, request);
     }
@@ -267,15 +408,39 @@ static ssize_t _get_file(coap_pkt_t *pdu, uint8_t *buf, size_t len,
      * */
     assert(pdu->payload + slicer.end - slicer.start <= buf + len);
     bool more = 1;
-    int read = vfs_read(fd, pdu->payload, slicer.end - slicer.start + more);
+    size_t want = slicer.end - slicer.start + more;
+    int read = -ENOENT;
+#if IS_USED(MODULE_NANOCOAP_FILESERVER_READAHEAD)
+    if (cached) {
+        read = _readahead_get(request, etag, slicer.start, pdu->payload, want);
+    }
+#endif
     if (read < 0) {
-        goto late_err;
+        /* not read ahead or evicted in the meantime */
+        if ((fd < 0) && ((fd = vfs_open(request->namebuf, O_RDONLY, 0)) < 0)) {
+            goto late_err;
+        }
+        read = _read_mapped(fd, slicer.start, size_total, pdu->payload, want);
+        if (read == -ENOTSUP) {
+            if (vfs_lseek(fd, slicer.start, SEEK_SET) < 0) {
+                goto late_err;
+            }
+#if IS_USED(MODULE_NANOCOAP_FILESERVER_READAHEAD)
+            read = _readahead_fill(request, etag, fd, slicer.start, pdu->payload, want);
+            if (read == -ENOTSUP)
+#endif
+            {
+                read = vfs_read(fd, pdu->payload, want);
+            }
+        }
+        if (read < 0) {
+            goto late_err;
+        }
+        vfs_close(fd);
     }
     more = (unsigned)read > slicer.end - slicer.start;
     read -= more;
 
-    vfs_close(fd);
-
     slicer.cur = slicer.end + more;
     coap_block2_finish(&slicer);
 
@@ -291,7 +456,9 @@ static ssize_t _get_file(coap_pkt_t *pdu, uint8_t *buf, size_t len,
     return resp_len + read;
 
 late_err:
-    vfs_close(fd);
+    if (fd >= 0) {
+        vfs_close(fd);
+    }
     coap_hdr_set_code(pdu->hdr, COAP_CODE_INTERNAL_SERVER_ERROR);
     return coap_get_total_hdr_len(pdu);
 }
@@ -491,28 +658,34 @@ static ssize_t _get_directory(coap_pkt_t *pdu, uint8_t *buf, size_t len,
     size_t root_dir_len = strlen(root_dir);
     size_t resource_dir_len = strlen(resource_dir);
 
-    vfs_dirent_t entry;
-    while (vfs_readdir(&dir, &entry) > 0) {
-        const char *entry_name = entry.d_name;
-        size_t entry_len = strlen(entry_name);
-        if (*entry_name == '.') {
-            /* Exclude everything that starts with '.' */
-            continue;
-        }
-        bool is_dir = entry_is_dir(request->namebuf, entry_name);
+    vfs_dirent_t entries[COAPFILESERVER_DIR_BATCH];
+    struct stat stats[COAPFILESERVER_DIR_BATCH];
+    int n;
+    while ((n = vfs_readdir_batch(&dir, entries, stats, ARRAY_SIZE(entries))) > 0) {
+        for (int i = 0; i < n; i++) {
+            const char *entry_name = entries[i].d_name;
+            size_t entry_len = strlen(entry_name);
+            if (*entry_name == '.') {
+                /* Exclude everything that starts with '.' */
+                continue;
+            }
+            bool is_dir = stats[i].st_mode
+                        ? (stats[i].st_mode & S_IFMT) == S_IFDIR
+                        : entry_is_dir(request->namebuf, entry_name);
 
-        if (slicer.cur) {
-            buf += coap_blockwise_put_char(&slicer, buf, ',');
-        }
-        buf += coap_blockwise_put_char(&slicer, buf, '<');
-        buf += coap_blockwise_put_bytes(&slicer, buf, resource_dir, resource_dir_len);
-        buf += coap_blockwise_put_bytes(&slicer, buf, root_dir, root_dir_len);
-        buf += coap_blockwise_put_char(&slicer, buf, '/');
-        buf += coap_blockwise_put_bytes(&slicer, buf, entry_name, entry_len);
-        if (is_dir) {
+            if (slicer.cur) {
+                buf += coap_blockwise_put_char(&slicer, buf, ',');
+            }
+            buf += coap_blockwise_put_char(&slicer, buf, '<');
+            buf += coap_blockwise_put_bytes(&slicer, buf, resource_dir, resource_dir_len);
+            buf += coap_blockwise_put_bytes(&slicer, buf, root_dir, root_dir_len);
             buf += coap_blockwise_put_char(&slicer, buf, '/');
+            buf += coap_blockwise_put_bytes(&slicer, buf, entry_name, entry_len);
+            if (is_dir) {
+                buf += coap_blockwise_put_char(&slicer, buf, '/');
+            }
+            buf += coap_blockwise_put_char(&slicer, buf, '>');
         }
-        buf += coap_blockwise_put_char(&slicer, buf, '>');
     }
 
     vfs_closedir(&dir);
@@ -596,7 +769,9 @@ ssize_t nanocoap_fileserver_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
                                  coap_request_ctx_t *ctx) {
     const char *root = coap_request_ctx_get_context(ctx);
     const char *resource = coap_request_ctx_get_path(ctx);
-    struct requestdata request = {0};
+    struct requestdata request = {
+        .remote = coap_request_ctx_get_remote_udp(ctx),
+    };
 
     /** Index in request.namebuf. Must not point at the last entry as that will be
      * zeroed to get a 0-terminated string. */
@@ -18,6 +18,8 @@
  * @}
  */
 
+#include <string.h>
+
 #include "fmt.h"
 #include "net/nanocoap/link_format.h"
 #include "net/nanocoap_sock.h"
@@ -26,50 +28,87 @@
 struct dir_list_ctx {
     char *buf;
     char *cur;
-    char *end;
+    char *end;      /**< last byte of buf, reserved for the terminator */
     coap_link_format_handler_t cb;
     void *ctx;
     char esc_buf[2];
     uint8_t esc_idx;
+    bool quoted;
 };
 
+static int _emit(struct dir_list_ctx *ctx)
+{
+    *ctx->cur = 0;
+    ctx->cur = ctx->buf;
+    return ctx->cb(ctx->buf, ctx->ctx);
+}
+
+/* returns the first character that can not simply be copied */
+static const char *_find_special(const char *c, const char *end, bool quoted)
+{
+    for (; c != end; ++c) {
+        if ((*c == '%') || (*c == '"') || ((*c == ',') && !quoted)) {
+            break;
+        }
+    }
+    return c;
+}
+
 static int _dirlist_cb(void *arg, size_t offset, uint8_t *buf, size_t len, int more)
 {
     (void)offset;
 
     struct dir_list_ctx *ctx = arg;
 
-    char *end = (char *)buf + len;
-    for (char *c = (char *)buf; c != end; ++c) {
-
-        /* start of escape sequence */
-        if (*c == '%') {
-            ctx->esc_idx = 1;
-            continue;
-        }
+    /* the state is kept in ctx, as a link may be split across blocks */
+    const char *c = (char *)buf;
+    const char *end = c + len;
+    while (c != end) {
         if (ctx->esc_idx) {
             /* fill escape buffer */
-            ctx->esc_buf[ctx->esc_idx - 1] = *c;
-            if (++ctx->esc_idx == 3) {
-                ctx->esc_idx = 0;
-                *c = scn_u32_hex(ctx->esc_buf, 2);
-            } else {
+            ctx->esc_buf[ctx->esc_idx - 1] = *c++;
+            if (++ctx->esc_idx < 3) {
                 continue;
             }
-        }
-
-        bool found_end = false;
-        if (*c == ',') {
-            found_end = true;
+            ctx->esc_idx = 0;
+            /* a decoded character is never a delimiter */
+            *ctx->cur++ = scn_u32_hex(ctx->esc_buf, 2);
         }
         else {
-            *ctx->cur++ = *c;
+            /* copy ordinary characters up to the next special one at once */
+            const char *special = _find_special(c, end, ctx->quoted);
+            size_t n = special - c;
+            if (n > (size_t)(ctx->end - ctx->cur)) {
+                n = ctx->end - ctx->cur;
+            }
+            memcpy(ctx->cur, c, n);
+            ctx->cur += n;
+            c += n;
+
+            if ((c == special) && (c != end)) {
+                if (*c == '%') {
+                    /* start of escape sequence */
+                    ctx->esc_idx = 1;
+                    c++;
+                    continue;
+                }
+                if (*c == ',') {
+                    c++;
+                    int res = _emit(ctx);
+                    if (res < 0) {
+                        return res;
+                    }
+                    continue;
+                }
+                /* a ',' within a quoted attribute value does not end the link */
+                ctx->quoted = !ctx->quoted;
+                *ctx->cur++ = *c++;
+            }
         }
 
-        if (found_end || ctx->cur == ctx->end) {
-            *ctx->cur = 0;
-            int res = ctx->cb(ctx->buf, ctx->ctx);
-            ctx->cur = ctx->buf;
+        /* entry exceeds the buffer, pass it on truncated */
+        if (ctx->cur == ctx->end) {
+            int res = _emit(ctx);
             if (res < 0) {
                 return res;
             }
@@ -77,8 +116,7 @@ static int _dirlist_cb(void *arg, size_t offset, uint8_t *buf, size_t len, int m
     }
 
     if (!more) {
-        *ctx->cur = 0;
-        return ctx->cb(ctx->buf, ctx->ctx);
+        return _emit(ctx);
     }
 
     return 0;
@@ -90,7 +128,7 @@ int nanocoap_link_format_get(nanocoap_sock_t *sock, const char *path,
     char buffer[CONFIG_NANOCOAP_QS_MAX];
     struct dir_list_ctx ctx = {
         .buf = buffer,
-        .end = buffer + sizeof(buffer),
+        .end = buffer + sizeof(buffer) - 1,
         .cur = buffer,
         .cb = cb,
         .ctx = arg,
@@ -199,12 +199,82 @@ int coap_match_path(const coap_resource_t *resource, const uint8_t *uri)
     return res;
 }
 
+/* first resource in [lo, hi) with a character >= c at pos of its path */
+static size_t _path_char_bound(const coap_resource_t *resources, size_t lo,
+                               size_t hi, size_t pos, unsigned c)
+{
+    while (lo < hi) {
+        size_t mid = lo + ((hi - lo) / 2);
+
+        if ((uint8_t)resources[mid].path[pos] < c) {
+            lo = mid + 1;
+        }
+        else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+int coap_find_resource_sorted(const coap_resource_t *resources,
+                              size_t resources_numof, const uint8_t *uri,
+                              coap_method_flags_t method_flag,
+                              const coap_resource_t **resource)
+{
+    /* resources whose path starts with the first len characters of uri */
+    size_t lo = 0;
+    size_t hi = resources_numof;
+    int res = -ENOENT;
+
+    assert(resources || !resources_numof);
+    assert(uri && resource);
+    for (size_t len = 0; lo < hi; len++) {
+        /* paths of length len sort first, they match if they are all of uri
+         * or a subtree of it. Shorter paths were at lower indices, so the
+         * first match in the array is found as with coap_match_path() */
+        while ((lo < hi) && (resources[lo].path[len] == '\0')) {
+            const coap_resource_t *r = &resources[lo++];
+
+            if ((uri[len] != '\0') && !(r->methods & COAP_MATCH_SUBTREE)) {
+                continue;
+            }
+            if (r->methods & method_flag) {
+                *resource = r;
+                return 0;
+            }
+            res = -EPERM;
+        }
+        if ((uri[len] == '\0') || (lo == hi)) {
+            break;
+        }
+        if (hi - lo == 1) {
+            /* a single candidate left */
+            if (coap_match_path(&resources[lo], uri) != 0) {
+                break;
+            }
+            if (resources[lo].methods & method_flag) {
+                *resource = &resources[lo];
+                return 0;
+            }
+            return -EPERM;
+        }
+        if (((uint8_t)resources[lo].path[len] != uri[len]) ||
+            ((uint8_t)resources[hi - 1].path[len] != uri[len])) {
+            lo = _path_char_bound(resources, lo, hi, len, uri[len]);
+            hi = _path_char_bound(resources, lo, hi, len, uri[len] + 1U);
+        }
+    }
+    return res;
+}
+
 uint8_t *coap_find_option(coap_pkt_t *pkt, unsigned opt_num)
 {
     const coap_optpos_t *optpos = pkt->options;
     unsigned opt_count = pkt->options_len;
 
-    while (opt_count--) {
+    /* the option array is sorted by option number, so an absent option
+     * (e.g. Observe or Block2 in most requests) ends the search early */
+    while (opt_count-- && (optpos->opt_num <= opt_num)) {
         if (optpos->opt_num == opt_num) {
             unsigned idx = index_of(pkt->options, optpos);
             bf_unset(pkt->opt_crit, idx);
@@ -515,11 +585,22 @@ ssize_t coap_subtree_handler(coap_pkt_t *pkt, uint8_t *buf, size_t len,
                              subtree->resources_numof);
 }
 
-ssize_t coap_tree_handler(coap_pkt_t *pkt, uint8_t *resp_buf, unsigned resp_buf_len,
-                          coap_request_ctx_t *ctx, const coap_resource_t *resources,
-                          size_t resources_numof)
+ssize_t coap_sorted_subtree_handler(coap_pkt_t *pkt, uint8_t *buf, size_t len,
+                                    coap_request_ctx_t *context)
+{
+    assert(context);
+    coap_resource_subtree_t *subtree = coap_request_ctx_get_context(context);
+    return coap_sorted_tree_handler(pkt, buf, len, context, subtree->resources,
+                                    subtree->resources_numof);
+}
+
+static ssize_t _tree_handler(coap_pkt_t *pkt, uint8_t *resp_buf,
+                             unsigned resp_buf_len, coap_request_ctx_t *ctx,
+                             const coap_resource_t *resources,
+                             size_t resources_numof, bool sorted)
 {
     coap_method_flags_t method_flag = coap_method2flag(coap_get_code_detail(pkt));
+    const coap_resource_t *resource = NULL;
 
     uint8_t uri[CONFIG_NANOCOAP_URI_MAX];
     if (coap_get_uri_path(pkt, uri) <= 0) {
@@ -527,22 +608,48 @@ ssize_t coap_tree_handler(coap_pkt_t *pkt, uint8_t *resp_buf, unsigned resp_buf_
     }
     DEBUG("nanocoap: URI path: \"%s\"\n", uri);
 
-    for (unsigned i = 0; i < resources_numof; i++) {
-        const coap_resource_t *resource = &resources[i];
-        if (!(resource->methods & method_flag)) {
-            continue;
-        }
+    if (sorted) {
+        coap_find_resource_sorted(resources, resources_numof, uri,
+                                  method_flag, &resource);
+    }
+    else {
+        for (unsigned i = 0; i < resources_numof; i++) {
+            if (!(resources[i].methods & method_flag)) {
+                continue;
+            }
 
-        int res = coap_match_path(resource, uri);
-        if (res != 0) {
-            continue;
+            int res = coap_match_path(&resources[i], uri);
+            if (res != 0) {
+                continue;
+            }
+
+            resource = &resources[i];
+            break;
         }
+    }
 
-        ctx->resource = resource;
-        return resource->handler(pkt, resp_buf, resp_buf_len, ctx);
+    if (resource == NULL) {
+        return coap_build_reply(pkt, COAP_CODE_404, resp_buf, resp_buf_len, 0);
     }
+    ctx->resource = resource;
+    return resource->handler(pkt, resp_buf, resp_buf_len, ctx);
+}
+
+ssize_t coap_tree_handler(coap_pkt_t *pkt, uint8_t *resp_buf, unsigned resp_buf_len,
+                          coap_request_ctx_t *ctx, const coap_resource_t *resources,
+                          size_t resources_numof)
+{
+    return _tree_handler(pkt, resp_buf, resp_buf_len, ctx, resources,
+                         resources_numof, false);
+}
 
-    return coap_build_reply(pkt, COAP_CODE_404, resp_buf, resp_buf_len, 0);
+ssize_t coap_sorted_tree_handler(coap_pkt_t *pkt, uint8_t *resp_buf,
+                                 unsigned resp_buf_len, coap_request_ctx_t *ctx,
+                                 const coap_resource_t *resources,
+                                 size_t resources_numof)
+{
+    return _tree_handler(pkt, resp_buf, resp_buf_len, ctx, resources,
+                         resources_numof, true);
 }
 
 ssize_t coap_build_reply_header(coap_pkt_t *pkt, unsigned code,
@@ -731,6 +838,29 @@ ssize_t coap_build_hdr(coap_hdr_t *hdr, unsigned type, const void *token,
     return sizeof(coap_hdr_t) + token_len + tkl_ext_len;
 }
 
+ssize_t coap_build_from_template(coap_pkt_t *pkt, uint8_t *buf, size_t len,
+                                 const coap_template_t *tpl,
+                                 const void *token, size_t token_len,
+                                 uint16_t id)
+{
+    assert(token_len <= COAP_TOKEN_LENGTH_MAX);
+
+    if (sizeof(coap_hdr_t) + token_len + tpl->opts_len + tpl->payload > len) {
+        return -ENOSPC;
+    }
+
+    size_t pos = coap_build_hdr((coap_hdr_t *)buf, tpl->type, token, token_len,
+                                tpl->code, id);
+    memcpy(buf + pos, tpl->opts, tpl->opts_len);
+    pos += tpl->opts_len;
+    if (tpl->payload) {
+        buf[pos++] = COAP_PAYLOAD_MARKER;
+    }
+    coap_pkt_init(pkt, buf, len, pos);
+
+    return pos;
+}
+
 void coap_pkt_init(coap_pkt_t *pkt, uint8_t *buf, size_t len, size_t header_len)
 {
     memset(pkt, 0, sizeof(coap_pkt_t));
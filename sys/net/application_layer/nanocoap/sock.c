@@ -740,6 +740,315 @@ int nanocoap_sock_get_blockwise(nanocoap_sock_t *sock, const char *path,
     return 0;
 }
 
+enum {
+    _WIN_SENT,              /**< request sent, repeated on timeout */
+    _WIN_SEPARATE,          /**< empty ACK received, waiting for the response */
+    _WIN_DONE,              /**< response received */
+};
+
+typedef struct {
+    uint32_t deadline;      /**< time of the next retransmission in ms */
+    uint32_t timeout;       /**< current retransmission timeout in ms */
+    int res;                /**< error code of the response */
+    uint16_t id;            /**< message ID of the last transmission */
+    uint16_t len;           /**< payload length of the response */
+    uint8_t tries_left;     /**< retransmissions left */
+    uint8_t state;          /**< _WIN_SENT, _WIN_SEPARATE or _WIN_DONE */
+    bool more;              /**< more flag of the response */
+} _win_slot_t;
+
+typedef struct {
+    nanocoap_sock_t *sock;
+    const char *path;
+    uint8_t *buf;           /**< blocks received out of order */
+    coap_blockwise_cb_t callback;
+    void *arg;
+    uint32_t next;          /**< next block to pass to the callback */
+    uint32_t sent;          /**< first block not requested yet */
+    uint32_t end;           /**< number of blocks, UINT32_MAX until known */
+    uint8_t token[2];       /**< token prefix, followed by the block number */
+    uint8_t window;
+    uint8_t type;
+    uint8_t szx;
+    _win_slot_t slots[CONFIG_NANOCOAP_SOCK_BLOCK_WINDOW_MAX];
+} _win_ctx_t;
+
+static _win_slot_t *_win_slot(_win_ctx_t *ctx, uint32_t num)
+{
+    return &ctx->slots[num % ctx->window];
+}
+
+static uint8_t *_win_buf(_win_ctx_t *ctx, uint32_t num)
+{
+    /* the next block is passed on from the packet, so there are never more
+     * than window - 1 blocks to keep */
+    return ctx->buf + (num % (ctx->window - 1)) * coap_szx2size(ctx->szx);
+}
+
+static int _win_send(_win_ctx_t *ctx, uint32_t num)
+{
+    _win_slot_t *slot = _win_slot(ctx, num);
+    uint8_t buf[CONFIG_NANOCOAP_BLOCK_HEADER_MAX];
+    uint8_t token[4] = { ctx->token[0], ctx->token[1], num >> 8, num };
+    uint8_t *pktpos = buf;
+    uint16_t lastonum = 0;
+
+    pktpos += coap_build_hdr((coap_hdr_t *)buf, ctx->type, token, sizeof(token),
+                             COAP_METHOD_GET, slot->id);
+    pktpos += coap_opt_put_uri_pathquery(pktpos, &lastonum, ctx->path);
+    pktpos += coap_opt_put_uint(pktpos, lastonum, COAP_OPT_BLOCK2,
+                                (num << 4) | ctx->szx);
+    assert((uintptr_t)pktpos - (uintptr_t)buf < sizeof(buf));
+
+    const iolist_t snip = {
+        .iol_base = buf,
+        .iol_len  = pktpos - buf,
+    };
+
+    DEBUG("nanocoap: requesting block %" PRIu32 " (%u tries left)\n",
+          num, slot->tries_left);
+    slot->deadline = ztimer_now(ZTIMER_MSEC) + slot->timeout;
+    int res = _sock_sendv(ctx->sock, &snip);
+    return (res < 0) ? res : 0;
+}
+
+static int _win_request(_win_ctx_t *ctx, uint32_t num)
+{
+    _win_slot_t *slot = _win_slot(ctx, num);
+
+    slot->state = _WIN_SENT;
+    slot->id = nanocoap_sock_next_msg_id(ctx->sock);
+    slot->tries_left = CONFIG_COAP_MAX_RETRANSMIT;
+    slot->timeout = random_uint32_range(CONFIG_COAP_ACK_TIMEOUT_MS,
+                                        (uint32_t)CONFIG_COAP_ACK_TIMEOUT_MS
+                                        * CONFIG_COAP_RANDOM_FACTOR_1000 / 1000);
+    return _win_send(ctx, num);
+}
+
+/* repeats the requests that timed out, *left is set to the time until the
+ * next timeout */
+static int _win_timeouts(_win_ctx_t *ctx, uint32_t *left)
+{
+    uint32_t now = ztimer_now(ZTIMER_MSEC);
+
+    *left = UINT32_MAX;
+    for (uint32_t num = ctx->next; num < MIN(ctx->sent, ctx->end); num++) {
+        _win_slot_t *slot = _win_slot(ctx, num);
+
+        if (slot->state == _WIN_DONE) {
+            continue;
+        }
+        if ((int32_t)(slot->deadline - now) <= 0) {
+            if (slot->tries_left == 0) {
+                DEBUG("nanocoap: block %" PRIu32 " timed out\n", num);
+                return -ETIMEDOUT;
+            }
+            slot->tries_left--;
+            slot->timeout *= 2;
+            if (ctx->type == COAP_TYPE_NON) {
+                /* a new request rather than a retransmission */
+                slot->id = nanocoap_sock_next_msg_id(ctx->sock);
+            }
+            int res = _win_send(ctx, num);
+            if (res < 0) {
+                return res;
+            }
+        }
+        if ((slot->deadline - now) < *left) {
+            *left = slot->deadline - now;
+        }
+    }
+    return 0;
+}
+
+static int _win_deliver(_win_ctx_t *ctx, uint8_t *data)
+{
+    _win_slot_t *slot = _win_slot(ctx, ctx->next);
+
+    if (slot->res < 0) {
+        return slot->res;
+    }
+    int res = ctx->callback(ctx->arg, (size_t)ctx->next << (ctx->szx + 4),
+                            data, slot->len, slot->more);
+    if (res < 0) {
+        return res;
+    }
+    ctx->next++;
+    return 0;
+}
+
+static int _win_handle(_win_ctx_t *ctx, coap_pkt_t *pkt)
+{
+    const uint8_t *token = coap_get_token(pkt);
+    uint32_t end = MIN(ctx->sent, ctx->end);
+    coap_block1_t block2;
+    _win_slot_t *slot;
+    uint32_t num;
+
+    if (coap_get_code_raw(pkt) == COAP_CODE_EMPTY) {
+        /* only empty ACK and RST are matched by the message ID */
+        for (num = ctx->next; num < end; num++) {
+            if ((_win_slot(ctx, num)->state == _WIN_SENT) &&
+                (_win_slot(ctx, num)->id == coap_get_id(pkt))) {
+                break;
+            }
+        }
+        if (num == end) {
+            return 0;
+        }
+        slot = _win_slot(ctx, num);
+        if (coap_get_type(pkt) == COAP_TYPE_RST) {
+            return -EBADMSG;
+        }
+        if (coap_get_type(pkt) == COAP_TYPE_ACK) {
+            DEBUG("nanocoap: block %" PRIu32 " will be sent separately\n", num);
+            slot->state = _WIN_SEPARATE;
+            slot->tries_left = 0;
+            slot->deadline = ztimer_now(ZTIMER_MSEC)
+                           + CONFIG_COAP_SEPARATE_RESPONSE_TIMEOUT_MS;
+        }
+        return 0;
+    }
+
+    if ((coap_get_token_len(pkt) != 4) || memcmp(token, ctx->token, 2)) {
+        DEBUG("nanocoap: token mismatch\n");
+        return 0;
+    }
+    if (coap_get_type(pkt) == COAP_TYPE_CON) {
+        _send_ack(ctx->sock, pkt);
+    }
+
+    /* the token only holds the lower 16 bit of the block number */
+    num = ctx->next + (uint16_t)(byteorder_bebuftohs(token + 2) - ctx->next);
+    slot = _win_slot(ctx, num);
+    if ((num >= end) || (slot->state == _WIN_DONE)) {
+        DEBUG("nanocoap: dropping duplicate of block %" PRIu32 "\n", num);
+        return 0;
+    }
+
+    slot->state = _WIN_DONE;
+    slot->res = _get_error(pkt);
+    slot->len = 0;
+    slot->more = false;
+    if (slot->res == 0) {
+        if (!coap_get_block2(pkt, &block2)) {
+            /* response was not block-wise, fine for the first block only */
+            block2.blknum = 0;
+            block2.szx = ctx->szx;
+            block2.more = false;
+        }
+        if ((num == 0) && (block2.szx < ctx->szx)) {
+            /* the first block is requested alone, so the block size can
+             * still be changed */
+            ctx->szx = block2.szx;
+        }
+        if ((block2.blknum != num) || (block2.szx != ctx->szx) ||
+            (pkt->payload_len > coap_szx2size(ctx->szx))) {
+            slot->res = -EBADMSG;
+        }
+        else {
+            slot->len = pkt->payload_len;
+            slot->more = block2.more;
+            if (!block2.more && (num < ctx->end)) {
+                ctx->end = num + 1;
+            }
+        }
+    }
+
+    if (num == ctx->next) {
+        return _win_deliver(ctx, pkt->payload);
+    }
+    if (slot->len) {
+        memcpy(_win_buf(ctx, num), pkt->payload, slot->len);
+    }
+    return 0;
+}
+
+int nanocoap_sock_get_blockwise_window(nanocoap_sock_t *sock, const char *path,
+                                       coap_blksize_t blksize, unsigned window,
+                                       uint8_t type, void *buf,
+                                       coap_blockwise_cb_t callback, void *arg)
+{
+    if (window <= 1) {
+        return nanocoap_sock_get_blockwise(sock, path, blksize, callback, arg);
+    }
+
+    assert(buf != NULL);
+    assert((type == COAP_TYPE_CON) || (type == COAP_TYPE_NON));
+
+    _win_ctx_t ctx = {
+        .sock = sock,
+        .path = path,
+        .buf = buf,
+        .callback = callback,
+        .arg = arg,
+        .end = UINT32_MAX,
+        .window = MIN(window, CONFIG_NANOCOAP_SOCK_BLOCK_WINDOW_MAX),
+        .type = type,
+        .szx = blksize,
+    };
+    void *payload, *rctx = NULL;
+    int res;
+
+    random_bytes(ctx.token, sizeof(ctx.token));
+
+    while (ctx.next < ctx.end) {
+        /* the first block is requested alone, as the server may answer with
+         * a smaller block size */
+        unsigned limit = (ctx.next == 0) ? 1 : ctx.window;
+        uint32_t left;
+
+        while ((ctx.sent < ctx.end) && ((ctx.sent - ctx.next) < limit)) {
+            res = _win_request(&ctx, ctx.sent++);
+            if (res < 0) {
+                DEBUG("nanocoap: error sending block request, %d\n", res);
+                return res;
+            }
+        }
+
+        res = _win_timeouts(&ctx, &left);
+        if (res < 0) {
+            return res;
+        }
+
+        res = _sock_recv_buf(sock, &payload, &rctx, left * US_PER_MS);
+        if (res == -ETIMEDOUT) {
+            continue;
+        }
+        if (res < 0) {
+            DEBUG("nanocoap: error receiving CoAP response, %d\n", res);
+            return res;
+        }
+
+        coap_pkt_t pkt;
+        if (coap_parse(&pkt, payload, res) < 0) {
+            DEBUG("nanocoap: error parsing packet\n");
+            res = 0;
+        }
+        else {
+            res = _win_handle(&ctx, &pkt);
+        }
+        while (rctx) {
+            /* release the receive buffer */
+            _sock_recv_buf(sock, &payload, &rctx, 0);
+        }
+        if (res < 0) {
+            return res;
+        }
+
+        /* pass on the blocks that arrived early */
+        while ((ctx.next < MIN(ctx.sent, ctx.end)) &&
+               (_win_slot(&ctx, ctx.next)->state == _WIN_DONE)) {
+            res = _win_deliver(&ctx, _win_buf(&ctx, ctx.next));
+            if (res < 0) {
+                return res;
+            }
+        }
+    }
+
+    return 0;
+}
+
 typedef struct {
     uint8_t *ptr;
     size_t len;
@@ -913,6 +1222,24 @@ int nanocoap_get_blockwise_url(const char *url,
     return res;
 }
 
+int nanocoap_get_blockwise_window_url(const char *url,
+                                      coap_blksize_t blksize, unsigned window,
+                                      uint8_t type, void *buf,
+                                      coap_blockwise_cb_t callback, void *arg)
+{
+    nanocoap_sock_t sock;
+    int res = nanocoap_sock_url_connect(url, &sock);
+    if (res) {
+        return res;
+    }
+
+    res = nanocoap_sock_get_blockwise_window(&sock, sock_urlpath(url), blksize,
+                                             window, type, buf, callback, arg);
+    nanocoap_sock_close(&sock);
+
+    return res;
+}
+
 typedef struct {
     uint8_t *ptr;
     size_t len;
@@ -26,6 +26,11 @@
 #include "mutex.h"
 #include "byteorder.h"
 
+#if IS_USED(MODULE_WALLCLOCK)
+#include "wallclock.h"
+#include "ztimer64.h"
+#endif
+
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
@@ -49,6 +54,9 @@ int sntp_sync(sock_udp_ep_t *server, uint32_t timeout)
     ntp_packet_set_vn(&_sntp_packet);
     ntp_packet_set_mode(&_sntp_packet, NTP_MODE_CLIENT);
 
+#if IS_USED(MODULE_WALLCLOCK)
+    uint64_t sent = ztimer64_now(ZTIMER64_USEC);
+#endif
     if ((result = (int)sock_udp_send(&_sntp_sock,
                                      &_sntp_packet,
                                      sizeof(_sntp_packet),
@@ -67,6 +75,16 @@ int sntp_sync(sock_udp_ep_t *server, uint32_t timeout)
         return result;
     }
     sock_udp_close(&_sntp_sock);
+#if IS_USED(MODULE_WALLCLOCK)
+    uint64_t received = ztimer64_now(ZTIMER64_USEC);
+    /* the server sent its time somewhere in between, assume the middle */
+    wallclock_discipline(((uint64_t)byteorder_ntohl(_sntp_packet.transmit.seconds)
+                          - NTP_UNIX_OFFSET) * US_PER_SEC
+                         + ((uint64_t)byteorder_ntohl(_sntp_packet.transmit.fraction)
+                            * US_PER_SEC >> 32)
+                         + (received - sent) / 2,
+                         received);
+#endif
     mutex_lock(&_sntp_mutex);
     _sntp_offset = (((int64_t)byteorder_ntohl(_sntp_packet.transmit.seconds)) * US_PER_SEC) +
                    ((((int64_t)byteorder_ntohl(_sntp_packet.transmit.fraction)) * 232)
@@ -21,6 +21,7 @@
 
 #include <arpa/inet.h>
 
+#include "mutex.h"
 #include "net/dns.h"
 #include "net/dns/cache.h"
 #include "net/dns/msg.h"
@@ -33,6 +34,9 @@
 /* global DNS server UDP endpoint */
 sock_udp_ep_t sock_dns_server;
 
+/* serializes the queries, which share the message buffer */
+static mutex_t _query_lock = MUTEX_INIT;
+
 #ifdef MODULE_AUTO_INIT_SOCK_DNS
 void auto_init_sock_dns(void)
 {
@@ -85,6 +89,15 @@ int sock_dns_query(const char *domain_name, void *addr_out, int family)
         return res;
     }
 
+    mutex_lock(&_query_lock);
+    /* another thread may just have resolved the same name while we were
+     * waiting, take its result instead of sending the same query again */
+    res = dns_cache_query(domain_name, addr_out, family);
+    if (res) {
+        mutex_unlock(&_query_lock);
+        return res;
+    }
+
     res = sock_udp_create(&sock_dns, NULL, &sock_dns_server, 0);
     if (res) {
         goto out;
@@ -116,5 +129,6 @@ int sock_dns_query(const char *domain_name, void *addr_out, int family)
 
 out:
     sock_udp_close(&sock_dns);
+    mutex_unlock(&_query_lock);
     return res;
 }
@@ -14,7 +14,9 @@
 
 #include <inttypes.h>
 #include <stdio.h>
+#include <string.h>
 
+#include "byteorder.h"
 #include "modules.h"
 #include "od.h"
 #include "net/inet_csum.h"
@@ -22,6 +24,56 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+/**
+ * @brief   Sums up the 16-bit words of @p buf in host byte order
+ *
+ * Words are loaded 32 bits at a time and added to a 64-bit accumulator, so the
+ * carries are only folded once at the end. Unaligned buffers are read with
+ * `memcpy()`, which compiles to plain loads on platforms that support unaligned
+ * access.
+ *
+ * @return  Folded sum in network byte order
+ */
+static uint16_t _sum_words(const uint8_t *buf, size_t len)
+{
+    uint64_t acc = 0;
+
+    /* a 16-bit length can not overflow a 64-bit sum of 32-bit words */
+    while (len >= 4 * sizeof(uint32_t)) {
+        uint32_t words[4];
+
+        memcpy(words, buf, sizeof(words));
+        acc += (uint64_t)words[0] + words[1] + words[2] + words[3];
+        buf += sizeof(words);
+        len -= sizeof(words);
+    }
+    while (len >= sizeof(uint32_t)) {
+        uint32_t word;
+
+        memcpy(&word, buf, sizeof(word));
+        acc += word;
+        buf += sizeof(word);
+        len -= sizeof(word);
+    }
+    if (len >= sizeof(uint16_t)) {
+        uint16_t word;
+
+        memcpy(&word, buf, sizeof(word));
+        acc += word;
+    }
+
+    /* the carries of the last additions may need another round each */
+    acc = (acc & 0xffffffff) + (acc >> 32);
+    acc = (acc & 0xffffffff) + (acc >> 32);
+    acc = (acc & 0xffff) + (acc >> 16);
+    acc = (acc & 0xffff) + (acc >> 16);
+    acc = (acc & 0xffff) + (acc >> 16);
+
+    /* the one's complement sum is independent of the byte order (RFC 1071,
+     * section 2), so converting the folded sum is sufficient */
+    return ntohs((uint16_t)acc);
+}
+
 uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t accum_len)
 {
     uint32_t csum = sum;
@@ -47,10 +99,8 @@ uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t
         accum_len++;
     }
 
-    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
-        csum += (uint16_t)(*buf << 8) + *(buf + 1); /* group bytes by 16-byte words */
-                                                    /* and add them */
-    }
+    csum += _sum_words(buf, len & ~1U);
+    buf += len & ~1U;
 
     if ((accum_len + len) & 1)          /* if accumulated length is odd */
         csum += (uint16_t)(*buf << 8);  /* add last byte as top half of 16-byte word */
@@ -288,6 +288,7 @@ void gnrc_lorawan_send_pkt(gnrc_lorawan_t *mac, iolist_t *psdu, uint8_t dr,
     dev->driver->get(dev, NETOPT_CODING_RATE, &cr, sizeof(cr));
 
     mac->toa = lora_time_on_air(iolist_size(psdu), dr, cr);
+    gnrc_lorawan_region_register_tx(mac, chan, mac->toa);
 
     if (dev->driver->send(dev, psdu) == -ENOTSUP) {
         DEBUG("gnrc_lorawan: Cannot send: radio is still transmitting");
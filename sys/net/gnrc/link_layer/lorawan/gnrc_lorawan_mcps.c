@@ -24,7 +24,9 @@
 
 #include "net/lorawan/hdr.h"
 
+#include "macros/utils.h"
 #include "random.h"
+#include "timex.h"
 
 #define ENABLE_DEBUG      0
 #include "debug.h"
@@ -375,6 +377,15 @@ static void _transmit_pkt(gnrc_lorawan_t *mac)
     { .iol_base = mac->mcps.mhdr_mic + header.iol_len, .iol_len = MIC_SIZE,
       .iol_next = NULL };
     iolist_t *last_snip = mac->mcps.msdu;
+    uint32_t time_off = gnrc_lorawan_region_time_off(mac);
+
+    if (time_off) {
+        /* retransmission on hold until the duty cycle allows it, the timer
+         * gets us back here */
+        gnrc_lorawan_set_timer(mac, MIN(time_off, UINT32_MAX / US_PER_MS) *
+                                    US_PER_MS);
+        return;
+    }
 
     while (last_snip->iol_next != NULL) {
         last_snip = last_snip->iol_next;
@@ -497,6 +508,11 @@ void gnrc_lorawan_mcps_request(gnrc_lorawan_t *mac,
         goto out;
     }
 
+    if (gnrc_lorawan_region_time_off(mac)) {
+        mcps_confirm->status = -EAGAIN;
+        goto out;
+    }
+
     int waiting_for_ack = mcps_request->type == MCPS_CONFIRMED;
 
     gnrc_lorawan_build_uplink(mac, pkt, waiting_for_ack,
@@ -23,7 +23,9 @@
 #include "net/gnrc/lorawan/region.h"
 #include "errno.h"
 #include "net/gnrc/pktbuf.h"
+#include "macros/utils.h"
 #include "random.h"
+#include "timex.h"
 
 #include "net/lorawan/hdr.h"
 
@@ -59,6 +61,15 @@ void gnrc_lorawan_trigger_join(gnrc_lorawan_t *mac)
     iolist_t pkt = { .iol_base = mac->mcps.mhdr_mic, .iol_len =
                          sizeof(lorawan_join_request_t), .iol_next = NULL };
 
+    uint32_t time_off = gnrc_lorawan_region_time_off(mac);
+
+    if (time_off) {
+        /* try again when the duty cycle allows it */
+        gnrc_lorawan_set_timer(mac, MIN(time_off, UINT32_MAX / US_PER_MS) *
+                                    US_PER_MS);
+        return;
+    }
+
     mac->last_chan_idx = gnrc_lorawan_pick_channel(mac);
     gnrc_lorawan_send_pkt(mac, &pkt, mac->last_dr,
                           mac->channel[mac->last_chan_idx]);
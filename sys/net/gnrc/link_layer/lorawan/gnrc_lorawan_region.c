@@ -12,11 +12,15 @@
  * @file
  * @author  José Ignacio Alamos <jose.alamos@haw-hamburg.de>
  */
+#include <assert.h>
+
 #include "bitarithm.h"
 #include "kernel_defines.h"
+#include "macros/math.h"
 #include "macros/utils.h"
 #include "net/gnrc/lorawan/region.h"
 #include "random.h"
+#include "timex.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -29,6 +33,120 @@ static uint8_t dr_bw[GNRC_LORAWAN_DATARATES_NUMOF] =
 { LORA_BW_125_KHZ, LORA_BW_125_KHZ, LORA_BW_125_KHZ, LORA_BW_125_KHZ,
   LORA_BW_125_KHZ, LORA_BW_125_KHZ };
 
+#if (IS_ACTIVE(CONFIG_LORAMAC_REGION_EU_868))
+/* sub-bands of ETSI EN 300 220: lower and upper limit in kHz and the inverse
+ * of the duty cycle */
+static const struct {
+    uint32_t min;
+    uint32_t max;
+    uint16_t dc_inv;
+} _sub_bands[] = {
+    { 863000, 865000, 1000 },
+    { 865000, 868000, 100 },
+    { 868000, 868600, 100 },
+    { 868700, 869200, 1000 },
+    { 869400, 869650, 10 },
+    { 869700, 870000, 100 },
+};
+
+static_assert(ARRAY_SIZE(_sub_bands) == GNRC_LORAWAN_SUB_BANDS_NUMOF,
+              "GNRC_LORAWAN_SUB_BANDS_NUMOF does not match the sub-bands");
+
+static int _get_sub_band(uint32_t freq)
+{
+    freq /= 1000;
+    for (unsigned i = 0; i < ARRAY_SIZE(_sub_bands); i++) {
+        if (freq >= _sub_bands[i].min && freq < _sub_bands[i].max) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static uint32_t _channel_time_off(gnrc_lorawan_t *mac, uint32_t freq,
+                                  uint32_t now)
+{
+    int i = _get_sub_band(freq);
+
+    if (i < 0) {
+        return 0;
+    }
+
+    /* unsigned arithmetic, so an overflow of now doesn't matter */
+    uint32_t elapsed = now - mac->sub_band[i].last_tx;
+
+    if (elapsed >= mac->sub_band[i].time_off) {
+        /* don't let the timestamp look recent again after an overflow */
+        mac->sub_band[i].time_off = 0;
+        return 0;
+    }
+    return mac->sub_band[i].time_off - elapsed;
+}
+
+void gnrc_lorawan_region_register_tx(gnrc_lorawan_t *mac, uint32_t freq,
+                                     uint32_t toa)
+{
+    int i = _get_sub_band(freq);
+
+    if (i < 0) {
+        return;
+    }
+
+    mac->sub_band[i].last_tx = gnrc_lorawan_get_time_ms(mac);
+    mac->sub_band[i].time_off = DIV_ROUND_UP(toa, US_PER_MS) *
+                                _sub_bands[i].dc_inv;
+    DEBUG("gnrc_lorawan_region: sub-band %d off for %" PRIu32 " ms\n", i,
+          mac->sub_band[i].time_off);
+}
+
+uint32_t gnrc_lorawan_region_time_off(gnrc_lorawan_t *mac)
+{
+    uint32_t now = gnrc_lorawan_get_time_ms(mac);
+    uint32_t time_off = UINT32_MAX;
+
+    for (unsigned i = 0; i < GNRC_LORAWAN_MAX_CHANNELS; i++) {
+        if (mac->channel_mask & (1 << i)) {
+            time_off = MIN(time_off, _channel_time_off(mac, mac->channel[i], now));
+        }
+    }
+    return time_off;
+}
+
+static unsigned _available_channels(gnrc_lorawan_t *mac)
+{
+    uint32_t now = gnrc_lorawan_get_time_ms(mac);
+    unsigned mask = 0;
+
+    for (unsigned i = 0; i < GNRC_LORAWAN_MAX_CHANNELS; i++) {
+        if ((mac->channel_mask & (1 << i)) &&
+            !_channel_time_off(mac, mac->channel[i], now)) {
+            mask |= 1 << i;
+        }
+    }
+    /* all exhausted, the caller should have checked */
+    return mask ? mask : mac->channel_mask;
+}
+#else
+void gnrc_lorawan_region_register_tx(gnrc_lorawan_t *mac, uint32_t freq,
+                                     uint32_t toa)
+{
+    (void)mac;
+    (void)freq;
+    (void)toa;
+}
+
+uint32_t gnrc_lorawan_region_time_off(gnrc_lorawan_t *mac)
+{
+    (void)mac;
+    return 0;
+}
+
+static unsigned _available_channels(gnrc_lorawan_t *mac)
+{
+    return mac->channel_mask;
+}
+#endif
+
 int gnrc_lorawan_set_dr(gnrc_lorawan_t *mac, uint8_t datarate)
 {
     netdev_t *dev = gnrc_lorawan_get_netdev(mac);
@@ -99,8 +217,8 @@ uint8_t gnrc_lorawan_pick_channel(gnrc_lorawan_t *mac)
 {
     uint8_t index = 0;
 
-    uint8_t pos = random_uint32_range(0, bitarithm_bits_set(mac->channel_mask));
-    unsigned state = mac->channel_mask;
+    unsigned state = _available_channels(mac);
+    uint8_t pos = random_uint32_range(0, bitarithm_bits_set(state));
 
     for (int i = 0; i < pos + 1; i++) {
         state = bitarithm_test_and_clear(state, &index);
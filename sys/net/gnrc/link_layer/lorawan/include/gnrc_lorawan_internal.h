@@ -54,6 +54,12 @@ extern "C" {
 
 #define GNRC_LORAWAN_MAX_CHANNELS (16U)                 /**< Maximum number of channels */
 
+#if IS_ACTIVE(CONFIG_LORAMAC_REGION_EU_868)
+#define GNRC_LORAWAN_SUB_BANDS_NUMOF (6U)               /**< Number of sub-bands with a duty cycle limit */
+#else
+#define GNRC_LORAWAN_SUB_BANDS_NUMOF (1U)               /**< Number of sub-bands with a duty cycle limit */
+#endif
+
 #define LORAWAN_STATE_IDLE (0)                          /**< MAC state machine in idle */
 #define LORAWAN_STATE_RX_1 (1)                          /**< MAC state machine in RX1 */
 #define LORAWAN_STATE_RX_2 (2)                          /**< MAC state machine in RX2 */
@@ -201,6 +207,14 @@ typedef struct {
     uint8_t backoff_state;  /**< state in the backoff state machine */
 } gnrc_lorawan_mlme_t;
 
+/**
+ * @brief Duty cycle state of a sub-band
+ */
+typedef struct {
+    uint32_t last_tx;       /**< start of the last transmission in ms */
+    uint32_t time_off;      /**< time in ms after @p last_tx the sub-band must not be used */
+} gnrc_lorawan_sub_band_t;
+
 /**
  * @brief GNRC LoRaWAN key context struct
  */
@@ -229,6 +243,7 @@ typedef struct {
 #endif
     uint32_t channel[GNRC_LORAWAN_MAX_CHANNELS];    /**< channel array */
     uint16_t channel_mask;                          /**< channel mask */
+    gnrc_lorawan_sub_band_t sub_band[GNRC_LORAWAN_SUB_BANDS_NUMOF]; /**< duty cycle state of the sub-bands */
     uint32_t toa;                                   /**< Time on Air of the last transmission */
     int busy;                                       /**< MAC busy  */
     int shutdown_req;                               /**< MAC Shutdown request */
@@ -353,12 +368,25 @@ size_t gnrc_lorawan_build_uplink(gnrc_lorawan_t *mac, iolist_t *payload,
 /**
  * @brief pick a random available LoRaWAN channel
  *
+ * Channels in a sub-band that exhausted its duty cycle are skipped, unless
+ * all enabled channels are. Check @ref gnrc_lorawan_region_time_off before.
+ *
  * @param[in] mac pointer to the MAC descriptor
  *
  * @return index of free channel inside channel array
  */
 uint8_t gnrc_lorawan_pick_channel(gnrc_lorawan_t *mac);
 
+/**
+ * @brief Account a transmission to the duty cycle of its sub-band
+ *
+ * @param[in] mac pointer to the MAC descriptor
+ * @param[in] freq frequency of the transmission
+ * @param[in] toa time on air of the transmission in us
+ */
+void gnrc_lorawan_region_register_tx(gnrc_lorawan_t *mac, uint32_t freq,
+                                     uint32_t toa);
+
 /**
  * @brief Build fopts header
  *
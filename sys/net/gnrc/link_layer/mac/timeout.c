@@ -39,7 +39,7 @@ void gnrc_mac_init_timeouts(gnrc_mac_timeout_t *mac_timeout,
     mac_timeout->timeout_num = num;
 
     for (int i = 0; i < mac_timeout->timeout_num; i++) {
-        mac_timeout->timeouts[i].msg_event.event.next = NULL;
+        mac_timeout->timeouts[i].msg_event.event = (evtimer_event_t){ 0 };
         mac_timeout->timeouts[i].type = GNRC_MAC_TIMEOUT_DISABLED;
     }
 
@@ -117,13 +117,9 @@ bool gnrc_mac_timeout_is_expired(gnrc_mac_timeout_t *mac_timeout, gnrc_mac_timeo
 
     int index = gnrc_mac_find_timeout(mac_timeout, type);
     if (index >= 0) {
-        evtimer_event_t *list;
-        list = (evtimer_event_t *)&mac_timeout->evtimer.events;
-        while (list->next) {
-            if (list->next == &mac_timeout->timeouts[index].msg_event.event) {
-                return false;
-            }
-            list = list->next;
+        if (evtimer_is_pending(&mac_timeout->evtimer,
+                               &mac_timeout->timeouts[index].msg_event.event)) {
+            return false;
         }
 
         /* if we reach here, timeout is expired */
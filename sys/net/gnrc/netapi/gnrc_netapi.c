@@ -26,6 +26,11 @@
 #include "net/gnrc/netreg.h"
 #include "net/gnrc/pktbuf.h"
 #include "net/gnrc/netapi.h"
+#if IS_USED(MODULE_GNRC_NETIF_SHARED) || \
+    (IS_USED(MODULE_GNRC_NETAPI_CALLBACKS) && IS_USED(MODULE_GNRC_NETIF))
+#include "net/gnrc/netif/internal.h"
+#include "thread.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -44,6 +49,21 @@ int _gnrc_netapi_get_set(kernel_pid_t pid, netopt_t opt, uint16_t context,
     /* set outgoing message's fields */
     cmd.type = type;
     cmd.content.ptr = (void *)&o;
+#if IS_USED(MODULE_GNRC_NETIF_SHARED)
+    gnrc_netif_t *netif = gnrc_netif_shared_get(pid);
+    if (netif != NULL) {
+        return gnrc_netif_shared_get_set(netif, &o, type);
+    }
+#endif
+#if IS_USED(MODULE_GNRC_NETAPI_CALLBACKS) && IS_USED(MODULE_GNRC_NETIF)
+    if (pid == thread_getpid()) {
+        /* request of a callback running in the interface's thread */
+        gnrc_netif_t *own = gnrc_netif_get_by_pid(pid);
+        if (own != NULL) {
+            return gnrc_netif_get_set_own(own, &o, type);
+        }
+    }
+#endif
     /* trigger the netapi */
     msg_send_receive(&cmd, &ack, pid);
     assert(ack.type == GNRC_NETAPI_MSG_TYPE_ACK);
@@ -58,7 +78,13 @@ int _gnrc_netapi_send_recv(kernel_pid_t pid, gnrc_pktsnip_t *pkt, uint16_t type)
     msg.type = type;
     msg.content.ptr = (void *)pkt;
     /* send message */
+#if IS_USED(MODULE_GNRC_NETIF_SHARED)
+    gnrc_netif_t *netif = gnrc_netif_shared_get(pid);
+    int ret = (netif != NULL) ? gnrc_netif_shared_msg(netif, &msg)
+                              : msg_try_send(&msg, pid);
+#else
     int ret = msg_try_send(&msg, pid);
+#endif
     if (ret < 1) {
         DEBUG("gnrc_netapi: dropped message to %" PRIkernel_pid " (%s)\n", pid,
               (ret == 0) ? "receiver queue is full" : "invalid receiver");
@@ -87,10 +113,16 @@ int gnrc_netapi_dispatch(gnrc_nettype_t type, uint32_t demux_ctx,
 {
     gnrc_netreg_acquire_shared();
 
-    int numof = gnrc_netreg_num(type, demux_ctx);
+    gnrc_netreg_entry_t *first = gnrc_netreg_lookup(type, demux_ctx);
+    int numof = 0;
+
+    /* count under the lock already held instead of gnrc_netreg_num() */
+    for (gnrc_netreg_entry_t *e = first; e; e = gnrc_netreg_getnext(e)) {
+        numof++;
+    }
 
     if (numof != 0) {
-        gnrc_netreg_entry_t *sendto = gnrc_netreg_lookup(type, demux_ctx);
+        gnrc_netreg_entry_t *sendto = first;
 
         gnrc_pktbuf_hold(pkt, numof - 1);
 
@@ -215,14 +215,12 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
 #if defined(MODULE_OD) && ENABLE_DEBUG
         od_hex_dump(pkt->data, nread, OD_WIDTH_DEFAULT);
 #endif
-        /* mark ethernet header */
-        gnrc_pktsnip_t *eth_hdr = gnrc_pktbuf_mark(pkt, sizeof(ethernet_hdr_t), GNRC_NETTYPE_UNDEF);
-        if (!eth_hdr) {
-            DEBUG("gnrc_netif_ethernet: no space left in packet buffer\n");
+        if ((size_t)nread < sizeof(ethernet_hdr_t)) {
+            DEBUG("gnrc_netif_ethernet: frame too short\n");
             goto safe_out;
         }
 
-        ethernet_hdr_t *hdr = (ethernet_hdr_t *)eth_hdr->data;
+        ethernet_hdr_t *hdr = (ethernet_hdr_t *)pkt->data;
 
 #ifdef MODULE_L2FILTER
         if (!l2filter_pass(dev->filter, hdr->src, ETHERNET_ADDR_LEN)) {
@@ -242,7 +240,6 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
 
         if (netif_hdr == NULL) {
             DEBUG("gnrc_netif_ethernet: no space left in packet buffer\n");
-            pkt = eth_hdr;
             goto safe_out;
         }
 
@@ -254,7 +251,12 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
             gnrc_netif_hdr_set_timestamp(netif_hdr->data, rx_info.timestamp);
         }
 
-        gnrc_pktbuf_remove_snip(pkt, eth_hdr);
+        /* remove ethernet header, hdr is invalid from here on */
+        if (gnrc_pktbuf_pull(pkt, sizeof(ethernet_hdr_t)) != 0) {
+            DEBUG("gnrc_netif_ethernet: no space left in packet buffer\n");
+            gnrc_pktbuf_release(netif_hdr);
+            goto safe_out;
+        }
         pkt = gnrc_pkt_append(pkt, netif_hdr);
     }
 
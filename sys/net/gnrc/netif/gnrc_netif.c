@@ -39,6 +39,7 @@
 #include "fmt.h"
 #include "log.h"
 #include "sched.h"
+#include "trace.h"
 #if IS_USED(MODULE_ZTIMER)
 #include "ztimer.h"
 #endif
@@ -54,6 +55,12 @@ static void _update_l2addr_from_dev(gnrc_netif_t *netif);
 static void _check_netdev_capabilities(netdev_t *dev);
 static void *_gnrc_netif_thread(void *args);
 static void _event_cb(netdev_t *dev, netdev_event_t event);
+#if IS_USED(MODULE_GNRC_NETIF_RX_POLL)
+static void _event_handler_rx_poll(event_t *evp);
+#endif
+#if IS_USED(MODULE_GNRC_NETIF_SHARED)
+static int _shared_create(gnrc_netif_t *netif);
+#endif
 
 typedef struct {
     gnrc_netif_t *netif;
@@ -87,6 +94,12 @@ int gnrc_netif_create(gnrc_netif_t *netif, char *stack, int stacksize,
     netstats_nb_init(&netif->netif);
 #endif
 
+#if IS_USED(MODULE_GNRC_NETIF_SHARED)
+    if (stack == NULL) {
+        return _shared_create(netif);
+    }
+#endif
+
     /* prepare thread context */
     ctx.netif = netif;
     mutex_init(&ctx.init_done);
@@ -207,8 +220,27 @@ int gnrc_netif_get_from_netdev(gnrc_netif_t *netif, gnrc_netapi_opt_t *opt)
                  * to lock this */
                 memcpy(opt->data, &netif->stats,
                        sizeof(netif->stats));
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ)
+                ((netstats_t *)opt->data)->tx_queue_len =
+                    gnrc_netif_pktq_len(netif);
+#endif
+                /* devices with DMA descriptor rings fill in their occupancy */
+                netif->dev->driver->get(netif->dev, NETOPT_STATS, opt->data,
+                                        opt->data_len);
                 res = sizeof(netif->stats);
                 break;
+#endif
+#if IS_USED(MODULE_NETSTATS_LATENCY)
+            case NETSTATS_LATENCY:
+                {
+                    assert(opt->data_len == sizeof(netstats_latency_t));
+                    /* updated by the threads of all layers */
+                    unsigned irq_state = irq_disable();
+                    memcpy(opt->data, &netif->latency, sizeof(netif->latency));
+                    irq_restore(irq_state);
+                    res = sizeof(netif->latency);
+                }
+                break;
 #endif
             default:
                 /* take from device */
@@ -441,8 +473,20 @@ int gnrc_netif_set_from_netdev(gnrc_netif_t *netif,
                 /* this is only accesses from the netif thread (us), so no need
                  * to lock this */
                 memset(&netif->stats, 0, sizeof(netif->stats));
+                netif->dev->driver->set(netif->dev, NETOPT_STATS,
+                                        &netif->stats, sizeof(netif->stats));
                 res = 0;
                 break;
+#endif
+#if IS_USED(MODULE_NETSTATS_LATENCY)
+            case NETSTATS_LATENCY:
+                {
+                    unsigned irq_state = irq_disable();
+                    memset(&netif->latency, 0, sizeof(netif->latency));
+                    irq_restore(irq_state);
+                    res = 0;
+                }
+                break;
 #endif
             default:
                 /* take from device */
@@ -503,6 +547,11 @@ void gnrc_netif_release(gnrc_netif_t *netif)
 #if IS_USED(MODULE_GNRC_NETIF_IPV6)
 static int _addr_idx(const gnrc_netif_t *netif, const ipv6_addr_t *addr);
 static int _group_idx(const gnrc_netif_t *netif, const ipv6_addr_t *addr);
+#if IS_ACTIVE(CONFIG_GNRC_NETIF_IPV6_GROUPS_FILTER)
+static void _group_filter_update(gnrc_netif_t *netif);
+#else
+#define _group_filter_update(netif)     (void)netif
+#endif
 
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 
@@ -772,10 +821,13 @@ gnrc_netif_t *gnrc_netif_get_by_ipv6_addr(const ipv6_addr_t *addr)
     DEBUG("gnrc_netif: get interface by IPv6 address %s\n",
           ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)));
     while ((netif = gnrc_netif_iter(netif))) {
-        if (_addr_idx(netif, addr) >= 0) {
-            break;
+        if (ipv6_addr_is_multicast(addr)) {
+            /* multicast addresses are never unicast or anycast addresses */
+            if (_group_idx(netif, addr) >= 0) {
+                break;
+            }
         }
-        if (_group_idx(netif, addr) >= 0) {
+        else if (_addr_idx(netif, addr) >= 0) {
             break;
         }
     }
@@ -852,6 +904,7 @@ int gnrc_netif_ipv6_group_join_internal(gnrc_netif_t *netif,
         return -ENOMEM;
     }
     memcpy(&netif->ipv6.groups[idx], addr, sizeof(netif->ipv6.groups[idx]));
+    _group_filter_update(netif);
     /* TODO:
      *  - MLD action
      */
@@ -914,6 +967,7 @@ void gnrc_netif_ipv6_group_leave_internal(gnrc_netif_t *netif,
     }
     if (idx >= 0) {
         ipv6_addr_set_unspecified(&netif->ipv6.groups[idx]);
+        _group_filter_update(netif);
         /* TODO:
          *  - MLD action */
     }
@@ -952,8 +1006,34 @@ static inline int _addr_idx(const gnrc_netif_t *netif, const ipv6_addr_t *addr)
     return _idx(netif, addr, false);
 }
 
+#if IS_ACTIVE(CONFIG_GNRC_NETIF_IPV6_GROUPS_FILTER)
+static inline uint32_t _group_filter_bit(const ipv6_addr_t *addr)
+{
+    /* groups mostly differ in scope and group ID, the latter being in the last
+     * bytes for all well-known and solicited-nodes multicast addresses */
+    return 1UL << ((addr->u8[1] ^ addr->u8[13] ^ addr->u8[14] ^ addr->u8[15]) &
+                   0x1f);
+}
+
+static void _group_filter_update(gnrc_netif_t *netif)
+{
+    /* rebuild, as other groups may share the bit of a removed group */
+    netif->ipv6.groups_filter = 0;
+    for (unsigned i = 0; i < GNRC_NETIF_IPV6_GROUPS_NUMOF; i++) {
+        if (!ipv6_addr_is_unspecified(&netif->ipv6.groups[i])) {
+            netif->ipv6.groups_filter |= _group_filter_bit(&netif->ipv6.groups[i]);
+        }
+    }
+}
+#endif  /* CONFIG_GNRC_NETIF_IPV6_GROUPS_FILTER */
+
 static inline int _group_idx(const gnrc_netif_t *netif, const ipv6_addr_t *addr)
 {
+#if IS_ACTIVE(CONFIG_GNRC_NETIF_IPV6_GROUPS_FILTER)
+    if (!(netif->ipv6.groups_filter & _group_filter_bit(addr))) {
+        return -1;
+    }
+#endif
     return _idx(netif, addr, true);
 }
 
@@ -1477,6 +1557,28 @@ static void _update_l2addr_from_dev(gnrc_netif_t *netif)
     }
 }
 
+static void _init_csum_offload(gnrc_netif_t *netif)
+{
+    netdev_t *dev = netif->dev;
+    netopt_enable_t enable;
+
+    /* 6LoWPAN header compression reads and elides the checksums, so the stack
+     * has to keep handling them */
+    if (gnrc_netif_is_6lo(netif)) {
+        return;
+    }
+    if ((dev->driver->get(dev, NETOPT_TX_CSUM_OFFLOAD, &enable,
+                          sizeof(enable)) == sizeof(enable)) &&
+        (enable == NETOPT_ENABLE)) {
+        netif->flags |= GNRC_NETIF_FLAGS_TX_CSUM_OFFLOAD;
+    }
+    if ((dev->driver->get(dev, NETOPT_RX_CSUM_OFFLOAD, &enable,
+                          sizeof(enable)) == sizeof(enable)) &&
+        (enable == NETOPT_ENABLE)) {
+        netif->flags |= GNRC_NETIF_FLAGS_RX_CSUM_OFFLOAD;
+    }
+}
+
 static void _init_from_device(gnrc_netif_t *netif)
 {
     int res;
@@ -1489,6 +1591,7 @@ static void _init_from_device(gnrc_netif_t *netif)
     netif->device_type = (uint8_t)tmp;
     gnrc_netif_ipv6_init_mtu(netif);
     _update_l2addr_from_dev(netif);
+    _init_csum_offload(netif);
 }
 
 static void _check_netdev_capabilities(netdev_t *dev)
@@ -1692,6 +1795,24 @@ static void _process_receive_stats(gnrc_netif_t *netdev, gnrc_pktsnip_t *pkt)
     netstats_nb_update_rx(&netdev->netif, src, src_len, hdr->rssi, hdr->lqi);
 }
 
+static bool _rx_quota_exceeded(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+#if IS_USED(MODULE_GNRC_PKT_QUOTA)
+    if (gnrc_pktbuf_quota_charge(&netif->rx_quota, pkt) < 0) {
+        DEBUG("gnrc_netif: packet buffer quota exceeded, dropping packet\n");
+#if IS_USED(MODULE_NETSTATS_L2)
+        netif->stats.rx_dropped++;
+#endif
+        gnrc_pktbuf_release(pkt);
+        return true;
+    }
+#else
+    (void)netif;
+    (void)pkt;
+#endif
+    return false;
+}
+
 static event_t *_gnrc_netif_fetch_event(gnrc_netif_t *netif)
 {
     event_t *ev;
@@ -1748,11 +1869,41 @@ static void _send_queued_pkt(gnrc_netif_t *netif)
     (void)netif;
 #if IS_USED(MODULE_GNRC_NETIF_PKTQ)
     gnrc_pktsnip_t *pkt;
+    unsigned sent = 0;
+
+    if ((CONFIG_GNRC_NETIF_PKTQ_BURST > 1) && netif->send_queue.in_burst) {
+        /* TX done event of a frame within the current burst, the burst
+         * continues with the next frame anyway */
+        return;
+    }
+    netif->send_queue.in_burst = true;
+    while ((sent < CONFIG_GNRC_NETIF_PKTQ_BURST) &&
+           ((pkt = gnrc_netif_pktq_get(netif)) != NULL)) {
+        unsigned len = gnrc_netif_pktq_len(netif);
 
-    if ((pkt = gnrc_netif_pktq_get(netif)) != NULL) {
         _send(netif, pkt, true);
+        sent++;
+        /* stop if the device is still busy with the frame or the frame was
+         * pushed back into the queue */
+#if IS_USED(MODULE_NETDEV_NEW_API)
+        if (netif->tx_pkt != NULL) {
+            break;
+        }
+#endif
+        if (gnrc_netif_pktq_len(netif) > len) {
+            break;
+        }
+    }
+    netif->send_queue.in_burst = false;
+    if (sent > 0) {
         gnrc_netif_pktq_sched_get(netif);
     }
+#if IS_USED(MODULE_NETSTATS_L2)
+    if (sent > 1) {
+        netif->stats.tx_bursts++;
+        netif->stats.tx_burst_frames += sent;
+    }
+#endif
 #endif /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
 }
 
@@ -1902,6 +2053,10 @@ static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back)
     /* Split off the TX sync snip */
     gnrc_pktsnip_t *tx_sync = IS_USED(MODULE_GNRC_TX_SYNC)
                             ? gnrc_tx_sync_split(pkt) : NULL;
+    if (IS_USED(MODULE_TRACE_EVENTS)) {
+        trace_event(TRACE_EVENT_NETIF_TX,
+                    (gnrc_pkt_len(pkt) << 8) | (uint8_t)netif->pid);
+    }
     int res = netif->ops->send(netif, pkt);
 
     /* For legacy netdevs (no confirm_send) TX is blocking, thus it is always
@@ -1925,39 +2080,145 @@ static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back)
 #endif
 }
 
-static void *_gnrc_netif_thread(void *args)
+/**
+ * @brief   Initializes the interface in the thread serving it
+ *
+ * @param[in]   netif   gnrc_netif instance to initialize
+ *
+ * @return  result of gnrc_netif_ops_t::init()
+ */
+static int _init(gnrc_netif_t *netif)
 {
-    _netif_ctx_t *ctx = args;
-    gnrc_netapi_opt_t *opt;
-    gnrc_netif_t *netif;
     int res;
-    msg_t reply = { .type = GNRC_NETAPI_MSG_TYPE_ACK };
-
-    DEBUG("gnrc_netif: starting thread %i\n", thread_getpid());
-    netif = ctx->netif;
-    gnrc_netif_acquire(netif);
-    netif->pid = thread_getpid();
 
     netif->event_isr.handler = _event_handler_isr;
+#if IS_USED(MODULE_GNRC_NETIF_RX_POLL)
+    netif->event_rx_poll.handler = _event_handler_rx_poll;
+#endif
 #if IS_USED(MODULE_NETDEV_NEW_API)
     netif->event_tx_done.handler = _event_handler_tx_done;
 #endif
     /* set up the event queue */
     event_queues_init(netif->evq, GNRC_NETIF_EVQ_NUMOF);
 
+    /* initialize low-level driver */
+    res = netif->ops->init(netif);
+    if (res < 0) {
+        LOG_ERROR("gnrc_netif: init %u failed: %d\n", netif->pid, res);
+        return res;
+    }
+#ifdef MODULE_NETSTATS_L2
+    memset(&netif->stats, 0, sizeof(netstats_t));
+#endif
+#if IS_USED(MODULE_GNRC_PKT_QUOTA)
+    gnrc_pktbuf_quota_init(&netif->rx_quota, netif->pid,
+                           CONFIG_GNRC_NETIF_PKTBUF_QUOTA);
+#endif
+    return res;
+}
+
+static int _get_set(gnrc_netif_t *netif, uint16_t type, gnrc_netapi_opt_t *opt)
+{
+    int res;
+
+    if (type == GNRC_NETAPI_MSG_TYPE_SET) {
+#ifdef MODULE_NETOPT
+        DEBUG("gnrc_netif: GNRC_NETAPI_MSG_TYPE_SET received. opt=%s\n",
+              netopt2str(opt->opt));
+#else
+        DEBUG("gnrc_netif: GNRC_NETAPI_MSG_TYPE_SET received. opt=%d\n",
+              opt->opt);
+#endif
+        /* set option for device driver */
+        res = netif->ops->set(netif, opt);
+        DEBUG("gnrc_netif: response of netif->ops->set(): %i\n", res);
+    }
+    else {
+#ifdef MODULE_NETOPT
+        DEBUG("gnrc_netif: GNRC_NETAPI_MSG_TYPE_GET received. opt=%s\n",
+              netopt2str(opt->opt));
+#else
+        DEBUG("gnrc_netif: GNRC_NETAPI_MSG_TYPE_GET received. opt=%d\n",
+              opt->opt);
+#endif
+        /* get option from device driver */
+        res = netif->ops->get(netif, opt);
+        DEBUG("gnrc_netif: response of netif->ops->get(): %i\n", res);
+    }
+    return res;
+}
+
+/**
+ * @brief   Dispatch netdev, MAC and gnrc_netapi messages
+ *
+ * @param[in]   netif   gnrc_netif instance the message is for
+ * @param[in]   msg     the message
+ */
+static void _process_msg(gnrc_netif_t *netif, msg_t *msg)
+{
+    msg_t reply = { .type = GNRC_NETAPI_MSG_TYPE_ACK };
+
+    DEBUG("gnrc_netif: message %u\n", (unsigned)msg->type);
+    switch (msg->type) {
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ)
+        case GNRC_NETIF_PKTQ_DEQUEUE_MSG:
+            DEBUG("gnrc_netif: send from packet send queue\n");
+            _send_queued_pkt(netif);
+            break;
+#endif  /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
+        case GNRC_NETAPI_MSG_TYPE_SND:
+            DEBUG("gnrc_netif: GNRC_NETDEV_MSG_TYPE_SND received\n");
+            _send(netif, msg->content.ptr, false);
+            break;
+        case GNRC_NETAPI_MSG_TYPE_SET:
+        case GNRC_NETAPI_MSG_TYPE_GET:
+            reply.content.value = (uint32_t)_get_set(netif, msg->type,
+                                                     msg->content.ptr);
+            msg_reply(msg, &reply);
+            break;
+        default:
+            if (netif->ops->msg_handler) {
+                DEBUG("gnrc_netif: delegate message of type 0x%04x to "
+                      "netif->ops->msg_handler()\n", msg->type);
+                netif->ops->msg_handler(netif, msg);
+            }
+            else {
+                DEBUG("gnrc_netif: unknown message type 0x%04x"
+                      "(no message handler defined)\n", msg->type);
+            }
+            break;
+    }
+}
+
+#if (CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US > 0U)
+static void _wait_after_send(uint32_t *last_wakeup)
+{
+    ztimer_periodic_wakeup(ZTIMER_USEC, last_wakeup,
+                           CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US);
+    /* override last_wakeup in case last_wakeup +
+     * CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US was in the past */
+    *last_wakeup = ztimer_now(ZTIMER_USEC);
+}
+#endif
+
+static void *_gnrc_netif_thread(void *args)
+{
+    _netif_ctx_t *ctx = args;
+    gnrc_netif_t *netif;
+
+    DEBUG("gnrc_netif: starting thread %i\n", thread_getpid());
+    netif = ctx->netif;
+    gnrc_netif_acquire(netif);
+    netif->pid = thread_getpid();
+
     /* setup the link-layer's message queue */
     msg_init_queue(netif->msg_queue, ARRAY_SIZE(netif->msg_queue));
-    /* initialize low-level driver */
-    ctx->result = netif->ops->init(netif);
+    ctx->result = _init(netif);
     /* signal that driver init is done */
     mutex_unlock(&ctx->init_done);
     if (ctx->result < 0) {
-        LOG_ERROR("gnrc_netif: init %u failed: %d\n", thread_getpid(), ctx->result);
         return NULL;
     }
-#ifdef MODULE_NETSTATS_L2
-    memset(&netif->stats, 0, sizeof(netstats_t));
-#endif
     /* now let rest of GNRC use the interface */
     gnrc_netif_release(netif);
 #if (CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US > 0U)
@@ -1969,77 +2230,231 @@ static void *_gnrc_netif_thread(void *args)
         /* msg will be filled by _process_events_await_msg.
          * The function will not return until a message has been received. */
         _process_events_await_msg(netif, &msg);
-
-        /* dispatch netdev, MAC and gnrc_netapi messages */
-        DEBUG("gnrc_netif: message %u\n", (unsigned)msg.type);
-        switch (msg.type) {
-#if IS_USED(MODULE_GNRC_NETIF_PKTQ)
-            case GNRC_NETIF_PKTQ_DEQUEUE_MSG:
-                DEBUG("gnrc_netif: send from packet send queue\n");
-                _send_queued_pkt(netif);
-                break;
-#endif  /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
-            case GNRC_NETAPI_MSG_TYPE_SND:
-                DEBUG("gnrc_netif: GNRC_NETDEV_MSG_TYPE_SND received\n");
-                _send(netif, msg.content.ptr, false);
+        _process_msg(netif, &msg);
 #if (CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US > 0U)
-                ztimer_periodic_wakeup(
-                        ZTIMER_USEC,
-                        &last_wakeup,
-                        CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US
-                    );
-                /* override last_wakeup in case last_wakeup +
-                 * CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US was in the past */
-                last_wakeup = ztimer_now(ZTIMER_USEC);
+        if (msg.type == GNRC_NETAPI_MSG_TYPE_SND) {
+            _wait_after_send(&last_wakeup);
+        }
 #endif
-                break;
-            case GNRC_NETAPI_MSG_TYPE_SET:
-                opt = msg.content.ptr;
-#ifdef MODULE_NETOPT
-                DEBUG("gnrc_netif: GNRC_NETAPI_MSG_TYPE_SET received. opt=%s\n",
-                      netopt2str(opt->opt));
-#else
-                DEBUG("gnrc_netif: GNRC_NETAPI_MSG_TYPE_SET received. opt=%d\n",
-                      opt->opt);
+    }
+    /* never reached */
+    return NULL;
+}
+
+#if IS_USED(MODULE_GNRC_NETIF_SHARED)
+/**
+ * @brief   Get or set request to an interface on the shared thread
+ */
+typedef struct {
+    gnrc_netapi_opt_t *opt;     /**< the option */
+    mutex_t done;               /**< unlocked by the shared thread */
+    int res;                    /**< result of the request */
+} _shared_req_t;
+
+/**
+ * @brief   Initialization of an interface on the shared thread
+ */
+typedef struct {
+    event_t super;              /**< event handled by the shared thread */
+    gnrc_netif_t *netif;        /**< the interface */
+    mutex_t done;               /**< unlocked by the shared thread */
+    int res;                    /**< result of the initialization */
+} _shared_init_t;
+
+static char _shared_stack[GNRC_NETIF_SHARED_STACKSIZE];
+static kernel_pid_t _shared_pid = KERNEL_PID_UNDEF;
+static kernel_pid_t _shared_next_pid = KERNEL_PID_LAST;
+static event_queue_t _shared_evq = EVENT_QUEUE_INIT_DETACHED;
+static mutex_t _shared_lock = MUTEX_INIT;
+
+static void _shared_init_handler(event_t *evp)
+{
+    _shared_init_t *init = container_of(evp, _shared_init_t, super);
+
+    gnrc_netif_acquire(init->netif);
+    init->res = _init(init->netif);
+    gnrc_netif_release(init->netif);
+    mutex_unlock(&init->done);
+}
+
+/**
+ * @brief   Handles at most one event and one message of a shared interface
+ *
+ * @return  true, if anything was handled
+ */
+static bool _shared_serve(gnrc_netif_t *netif, uint32_t *last_wakeup)
+{
+    bool busy = false;
+    event_t *evp;
+    msg_t msg;
+
+    (void)last_wakeup;
+    if ((evp = _gnrc_netif_fetch_event(netif))) {
+        DEBUG("gnrc_netif: event %p for %i\n", (void *)evp, netif->pid);
+        if (evp->handler) {
+            evp->handler(evp);
+        }
+        busy = true;
+    }
+    if (mbox_try_get(&netif->mbox, &msg)) {
+        if ((msg.type == GNRC_NETAPI_MSG_TYPE_GET) ||
+            (msg.type == GNRC_NETAPI_MSG_TYPE_SET)) {
+            _shared_req_t *req = msg.content.ptr;
+
+            req->res = _get_set(netif, msg.type, req->opt);
+            mutex_unlock(&req->done);
+        }
+        else {
+            _process_msg(netif, &msg);
+#if (CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US > 0U)
+            if (msg.type == GNRC_NETAPI_MSG_TYPE_SND) {
+                _wait_after_send(last_wakeup);
+            }
 #endif
-                /* set option for device driver */
-                res = netif->ops->set(netif, opt);
-                DEBUG("gnrc_netif: response of netif->ops->set(): %i\n", res);
-                reply.content.value = (uint32_t)res;
-                msg_reply(&msg, &reply);
-                break;
-            case GNRC_NETAPI_MSG_TYPE_GET:
-                opt = msg.content.ptr;
-#ifdef MODULE_NETOPT
-                DEBUG("gnrc_netif: GNRC_NETAPI_MSG_TYPE_GET received. opt=%s\n",
-                      netopt2str(opt->opt));
-#else
-                DEBUG("gnrc_netif: GNRC_NETAPI_MSG_TYPE_GET received. opt=%d\n",
-                      opt->opt);
+        }
+        busy = true;
+    }
+    return busy;
+}
+
+static void *_gnrc_netif_shared_thread(void *args)
+{
+    uint32_t last_wakeup = 0;
+
+    (void)args;
+    DEBUG("gnrc_netif: starting shared thread %i\n", thread_getpid());
+    event_queue_claim(&_shared_evq);
+#if (CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US > 0U)
+    last_wakeup = ztimer_now(ZTIMER_USEC);
 #endif
-                /* get option from device driver */
-                res = netif->ops->get(netif, opt);
-                DEBUG("gnrc_netif: response of netif->ops->get(): %i\n", res);
-                reply.content.value = (uint32_t)res;
-                msg_reply(&msg, &reply);
-                break;
-            default:
-                if (netif->ops->msg_handler) {
-                    DEBUG("gnrc_netif: delegate message of type 0x%04x to "
-                          "netif->ops->msg_handler()\n", msg.type);
-                    netif->ops->msg_handler(netif, &msg);
-                }
-                else {
-                    DEBUG("gnrc_netif: unknown message type 0x%04x"
-                          "(no message handler defined)\n", msg.type);
-                }
-                break;
+
+    while (1) {
+        gnrc_netif_t *netif = NULL;
+        event_t *evp;
+        bool busy = false;
+
+        /* initialize new interfaces */
+        while ((evp = event_get(&_shared_evq))) {
+            evp->handler(evp);
+        }
+        /* serve the interfaces in turns, so one can not starve the others */
+        while ((netif = gnrc_netif_iter(netif))) {
+            if ((netif->flags & GNRC_NETIF_FLAGS_SHARED) &&
+                _shared_serve(netif, &last_wakeup)) {
+                busy = true;
+            }
+        }
+        if (!busy) {
+            DEBUG("gnrc_netif: shared thread waiting for events\n");
+            thread_flags_wait_any(THREAD_FLAG_EVENT);
         }
     }
     /* never reached */
     return NULL;
 }
 
+static kernel_pid_t _shared_alloc_pid(void)
+{
+    /* thread_create() takes the lowest free slot, so the interfaces take
+     * free slots from the top */
+    while ((_shared_next_pid > KERNEL_PID_FIRST) &&
+           (thread_get(_shared_next_pid) != NULL)) {
+        _shared_next_pid--;
+    }
+    if (_shared_next_pid <= KERNEL_PID_FIRST) {
+        return KERNEL_PID_UNDEF;
+    }
+    return _shared_next_pid--;
+}
+
+static int _shared_create(gnrc_netif_t *netif)
+{
+    _shared_init_t init = {
+        .super.handler = _shared_init_handler,
+        .netif = netif,
+        .done = MUTEX_INIT_LOCKED,
+    };
+
+    mutex_lock(&_shared_lock);
+    if (_shared_pid == KERNEL_PID_UNDEF) {
+        _shared_pid = thread_create(_shared_stack, sizeof(_shared_stack),
+                                    GNRC_NETIF_PRIO, 0,
+                                    _gnrc_netif_shared_thread, NULL,
+                                    "gnrc_netif");
+        assert(_shared_pid > 0);
+    }
+    netif->pid = _shared_alloc_pid();
+    mutex_unlock(&_shared_lock);
+
+    if (netif->pid == KERNEL_PID_UNDEF) {
+        LOG_ERROR("gnrc_netif: no free PID for shared interface\n");
+        return -ENOMEM;
+    }
+    DEBUG("gnrc_netif: shared interface %i\n", netif->pid);
+    netif->flags |= GNRC_NETIF_FLAGS_SHARED;
+    mbox_init(&netif->mbox, netif->msg_queue, ARRAY_SIZE(netif->msg_queue));
+
+    event_post(&_shared_evq, &init.super);
+    mutex_lock(&init.done);
+    return init.res;
+}
+
+gnrc_netif_t *gnrc_netif_shared_get(kernel_pid_t pid)
+{
+    if (thread_get(pid) != NULL) {
+        return NULL;
+    }
+
+    gnrc_netif_t *netif = gnrc_netif_get_by_pid(pid);
+
+    if ((netif == NULL) || !(netif->flags & GNRC_NETIF_FLAGS_SHARED)) {
+        return NULL;
+    }
+    return netif;
+}
+
+int gnrc_netif_shared_msg(gnrc_netif_t *netif, msg_t *msg)
+{
+    assert(netif->flags & GNRC_NETIF_FLAGS_SHARED);
+
+    msg->sender_pid = thread_getpid();
+    int res = mbox_try_put(&netif->mbox, msg);
+    if (res) {
+        thread_flags_set(thread_get(_shared_pid), THREAD_FLAG_EVENT);
+    }
+    return res;
+}
+
+int gnrc_netif_shared_get_set(gnrc_netif_t *netif, gnrc_netapi_opt_t *opt,
+                              uint16_t type)
+{
+    assert(netif->flags & GNRC_NETIF_FLAGS_SHARED);
+
+    if (thread_getpid() == _shared_pid) {
+        /* request of an interface on the shared thread itself */
+        return _get_set(netif, type, opt);
+    }
+
+    _shared_req_t req = { .opt = opt, .done = MUTEX_INIT_LOCKED };
+    msg_t msg = { .type = type, .content = { .ptr = &req } };
+
+    msg.sender_pid = thread_getpid();
+    mbox_put(&netif->mbox, &msg);
+    thread_flags_set(thread_get(_shared_pid), THREAD_FLAG_EVENT);
+    mutex_lock(&req.done);
+    return req.res;
+}
+#endif  /* IS_USED(MODULE_GNRC_NETIF_SHARED) */
+
+#if IS_USED(MODULE_GNRC_NETAPI_CALLBACKS)
+int gnrc_netif_get_set_own(gnrc_netif_t *netif, gnrc_netapi_opt_t *opt,
+                           uint16_t type)
+{
+    assert(thread_getpid() == netif->pid);
+    return _get_set(netif, type, opt);
+}
+#endif  /* IS_USED(MODULE_GNRC_NETAPI_CALLBACKS) */
+
 static void _pass_on_packet(gnrc_pktsnip_t *pkt)
 {
     /* throw away packet if no one is interested */
@@ -2051,11 +2466,108 @@ static void _pass_on_packet(gnrc_pktsnip_t *pkt)
     }
 }
 
+#if IS_USED(MODULE_NETSTATS_LATENCY)
+void gnrc_netif_latency_record(gnrc_pktsnip_t *pkt,
+                               netstats_latency_stage_t stage)
+{
+    gnrc_pktsnip_t *netif_snip = gnrc_pktsnip_search_type(pkt,
+                                                          GNRC_NETTYPE_NETIF);
+    gnrc_netif_hdr_t *hdr;
+    gnrc_netif_t *netif;
+
+    if ((netif_snip == NULL) ||
+        !((hdr = netif_snip->data)->flags & GNRC_NETIF_HDR_FLAGS_RX_STAMP) ||
+        ((netif = gnrc_netif_hdr_get_netif(hdr)) == NULL)) {
+        return;
+    }
+
+    uint32_t usec = ztimer_now(ZTIMER_USEC) - hdr->rx_stamp;
+    unsigned irq_state = irq_disable();
+
+    netstats_latency_add(&netif->latency, stage, usec);
+    irq_restore(irq_state);
+}
+
+static void _latency_stamp(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *netif_snip = gnrc_pktsnip_search_type(pkt,
+                                                          GNRC_NETTYPE_NETIF);
+
+    if (netif_snip != NULL) {
+        gnrc_netif_hdr_t *hdr = netif_snip->data;
+
+        hdr->rx_stamp = netif->isr_stamp;
+        hdr->flags |= GNRC_NETIF_HDR_FLAGS_RX_STAMP;
+        gnrc_netif_latency_record(pkt, NETSTATS_LATENCY_NETIF);
+    }
+}
+#endif
+
+static void _rx_handle(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+#if IS_USED(MODULE_NETSTATS_LATENCY)
+    if (pkt) {
+        _latency_stamp(netif, pkt);
+    }
+#endif
+    if (pkt && !_rx_quota_exceeded(netif, pkt)) {
+        if (netif->flags & GNRC_NETIF_FLAGS_RX_CSUM_OFFLOAD) {
+            gnrc_pktsnip_t *netif_snip;
+
+            /* the device already dropped frames with invalid checksums */
+            netif_snip = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_NETIF);
+            if (netif_snip != NULL) {
+                gnrc_netif_hdr_t *hdr = netif_snip->data;
+
+                hdr->flags |= GNRC_NETIF_HDR_FLAGS_CSUM_VALID;
+            }
+        }
+        if (IS_USED(MODULE_TRACE_EVENTS)) {
+            trace_event(TRACE_EVENT_NETIF_RX,
+                        (gnrc_pkt_len(pkt) << 8) | (uint8_t)netif->pid);
+        }
+        _process_receive_stats(netif, pkt);
+        _pass_on_packet(pkt);
+    }
+}
+
+static void _rx_poll(gnrc_netif_t *netif, unsigned fetched)
+{
+#if IS_USED(MODULE_GNRC_NETIF_RX_POLL)
+    netdev_t *dev = netif->dev;
+
+    while (dev->driver->recv(dev, NULL, 0, NULL) > 0) {
+        if (fetched++ >= CONFIG_GNRC_NETIF_RX_POLL_BUDGET) {
+            /* let other events of the interface be handled first */
+            event_post(&netif->evq[GNRC_NETIF_EVQ_INDEX_PRIO_LOW],
+                       &netif->event_rx_poll);
+            return;
+        }
+        _rx_handle(netif, netif->ops->recv(netif));
+    }
+#else
+    (void)netif;
+    (void)fetched;
+#endif
+}
+
+#if IS_USED(MODULE_GNRC_NETIF_RX_POLL)
+static void _event_handler_rx_poll(event_t *evp)
+{
+    gnrc_netif_t *netif = container_of(evp, gnrc_netif_t, event_rx_poll);
+
+    _rx_poll(netif, 0);
+}
+#endif
+
 static void _event_cb(netdev_t *dev, netdev_event_t event)
 {
     gnrc_netif_t *netif = (gnrc_netif_t *)dev->context;
 
     if (event == NETDEV_EVENT_ISR) {
+#if IS_USED(MODULE_NETSTATS_LATENCY)
+        netif->isr_stamp = ztimer_now(ZTIMER_USEC);
+#endif
         event_post(&netif->evq[GNRC_NETIF_EVQ_INDEX_PRIO_LOW], &netif->event_isr);
     }
 #if IS_USED(MODULE_NETDEV_NEW_API)
@@ -2089,10 +2601,8 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
                  * layer being busy.
                  * Further packets will be sent on later TX_COMPLETE */
                 _send_queued_pkt(netif);
-                if (pkt) {
-                    _process_receive_stats(netif, pkt);
-                    _pass_on_packet(pkt);
-                }
+                _rx_handle(netif, pkt);
+                _rx_poll(netif, 1);
                 break;
 #if IS_USED(MODULE_NETDEV_LEGACY_API)
 #  if IS_USED(MODULE_NETSTATS_L2) || IS_USED(MODULE_GNRC_NETIF_PKTQ)
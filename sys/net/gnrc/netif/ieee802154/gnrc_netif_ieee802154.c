@@ -100,9 +100,14 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
     if (bytes_expected >= (int)IEEE802154_MIN_FRAME_LEN) {
         int nread;
 
-        pkt = gnrc_pktbuf_add(NULL, NULL, bytes_expected, GNRC_NETTYPE_UNDEF);
-        if (pkt == NULL) {
+        /* reserve headroom for header decompression in upper layers */
+        pkt = gnrc_pktbuf_add(NULL, NULL,
+                              CONFIG_GNRC_NETIF_RX_HEADROOM + bytes_expected,
+                              GNRC_NETTYPE_UNDEF);
+        if ((pkt == NULL) ||
+            (gnrc_pktbuf_pull(pkt, CONFIG_GNRC_NETIF_RX_HEADROOM) != 0)) {
             DEBUG("_recv_ieee802154: cannot allocate pktsnip.\n");
+            gnrc_pktbuf_release(pkt);
             /* Discard packet on netdev device */
             dev->driver->recv(dev, NULL, bytes_expected, NULL);
             return NULL;
@@ -139,7 +144,7 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
         }
         else {
             /* Normal mode, try to parse the frame according to IEEE 802.15.4 */
-            gnrc_pktsnip_t *ieee802154_hdr, *netif_hdr;
+            gnrc_pktsnip_t *netif_hdr;
             gnrc_netif_hdr_t *hdr;
             size_t mhr_len = ieee802154_get_frame_hdr_len(pkt->data);
             uint8_t *mhr = pkt->data;
@@ -225,16 +230,14 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
                     od_hex_dump(pkt->data, nread, OD_WIDTH_DEFAULT);
                 }
             }
-            /* mark IEEE 802.15.4 header */
-            ieee802154_hdr = gnrc_pktbuf_mark(pkt, mhr_len, GNRC_NETTYPE_UNDEF);
-            if (ieee802154_hdr == NULL) {
+            /* remove IEEE 802.15.4 header */
+            if (gnrc_pktbuf_pull(pkt, mhr_len) != 0) {
                 DEBUG("_recv_ieee802154: no space left in packet buffer\n");
                 gnrc_pktbuf_release(pkt);
                 gnrc_pktbuf_release(netif_hdr);
                 return NULL;
             }
-            nread -= ieee802154_hdr->size;
-            gnrc_pktbuf_remove_snip(pkt, ieee802154_hdr);
+            nread -= mhr_len;
             pkt = gnrc_pkt_append(pkt, netif_hdr);
         }
 
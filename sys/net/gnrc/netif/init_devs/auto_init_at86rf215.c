@@ -50,7 +50,9 @@
 
 static at86rf215_t at86rf215_devs[AT86RF215_NUM * USED_BANDS];
 static gnrc_netif_t _netif[AT86RF215_NUM * USED_BANDS];
+#if !IS_USED(MODULE_GNRC_NETIF_SHARED)
 static char _at86rf215_stacks[AT86RF215_NUM * USED_BANDS][AT86RF215_MAC_STACKSIZE];
+#endif
 
 static inline void _setup_netif(gnrc_netif_t *netif, void* netdev, void* stack,
                                 int prio, const char *name)
@@ -88,14 +90,18 @@ void auto_init_at86rf215(void)
 
         if (IS_USED(MODULE_AT86RF215_SUBGHZ)) {
             dev_09   = &at86rf215_devs[i];
+#if !IS_USED(MODULE_GNRC_NETIF_SHARED)
             stack_09 = &_at86rf215_stacks[i];
+#endif
             netif_09 = &_netif[i];
             ++i;
         }
 
         if (IS_USED(MODULE_AT86RF215_24GHZ)) {
             dev_24   = &at86rf215_devs[i];
+#if !IS_USED(MODULE_GNRC_NETIF_SHARED)
             stack_24 = &_at86rf215_stacks[i];
+#endif
             netif_24 = &_netif[i];
             ++i;
         }
@@ -28,6 +28,18 @@
 extern "C" {
 #endif
 
+/**
+ * @brief   extra stack size if IPv6 runs inline in the netif thread
+ *
+ * With `gnrc_ipv6_inline` received IPv6 packets (and the layers above that
+ * are inline as well) are handled on the stack of the netif thread.
+ */
+#if IS_USED(MODULE_GNRC_IPV6_INLINE) || DOXYGEN
+#define GNRC_NETIF_INLINE_EXTRA_STACKSIZE   (THREAD_STACKSIZE_DEFAULT / 2)
+#else
+#define GNRC_NETIF_INLINE_EXTRA_STACKSIZE   (0)
+#endif
+
 /**
  * @brief   stack size of a netif thread
  *
@@ -35,7 +47,8 @@ extern "C" {
  *          stack size by default msg queue size to keep the RAM use the same
  */
 #ifndef GNRC_NETIF_STACKSIZE_DEFAULT
-#define GNRC_NETIF_STACKSIZE_DEFAULT    (THREAD_STACKSIZE_DEFAULT - 128)
+#define GNRC_NETIF_STACKSIZE_DEFAULT    (THREAD_STACKSIZE_DEFAULT - 128 + \
+                                         GNRC_NETIF_INLINE_EXTRA_STACKSIZE)
 #endif
 
 /**
@@ -34,6 +34,7 @@
 #include "debug.h"
 
 #define MSG_TYPE_MLME_BACKOFF_EXPIRE (0x3458)           /**< Backoff timer expiration message type */
+#define MSG_TYPE_TX_QUEUE            (0x3459)           /**< Send queued uplinks message type */
 
 static uint8_t _appskey[LORAMAC_APPSKEY_LEN];
 static uint8_t _appkey[LORAMAC_APPKEY_LEN];
@@ -47,6 +48,7 @@ static uint8_t _devaddr[LORAMAC_DEVADDR_LEN];
 
 static msg_t timeout_msg = { .type = MSG_TYPE_TIMEOUT };
 static msg_t backoff_msg = { .type = MSG_TYPE_MLME_BACKOFF_EXPIRE };
+static msg_t tx_queue_msg = { .type = MSG_TYPE_TX_QUEUE };
 
 static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt);
 static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif);
@@ -89,6 +91,11 @@ void gnrc_lorawan_mlme_confirm(gnrc_lorawan_t *mac, mlme_confirm_t *confirm)
         lw_netif->demod_margin = confirm->link_req.margin;
         lw_netif->num_gateways = confirm->link_req.num_gateways;
     }
+
+    /* uplinks queued during the join are sent now, or dropped if it failed */
+    if ((confirm->type == MLME_JOIN) && lw_netif->tx_queue_len) {
+        msg_send_to_self(&tx_queue_msg);
+    }
 }
 
 void gnrc_lorawan_set_timer(gnrc_lorawan_t *mac, uint32_t us)
@@ -105,6 +112,13 @@ void gnrc_lorawan_remove_timer(gnrc_lorawan_t *mac)
     ztimer_remove(ZTIMER_MSEC, &lw_netif->timer);
 }
 
+uint32_t gnrc_lorawan_get_time_ms(gnrc_lorawan_t *mac)
+{
+    (void)mac;
+
+    return ztimer_now(ZTIMER_MSEC);
+}
+
 static inline void _set_be_addr(gnrc_lorawan_t *mac, uint8_t *be_addr)
 {
     uint32_t tmp = byteorder_bebuftohl(be_addr);
@@ -168,12 +182,18 @@ void gnrc_lorawan_mlme_indication(gnrc_lorawan_t *mac, mlme_indication_t *ind)
 
 void gnrc_lorawan_mcps_confirm(gnrc_lorawan_t *mac, mcps_confirm_t *confirm)
 {
-    (void)mac;
+    gnrc_netif_lorawan_t *lw_netif = container_of(mac, gnrc_netif_lorawan_t, mac);
 
     gnrc_pktbuf_release_error((gnrc_pktsnip_t *)confirm->msdu, confirm->status);
 
     DEBUG("gnrc_lorawan: transmission finished with status %i\n",
           confirm->status);
+
+    /* the MAC is not done with the radio yet, send the next uplink from the
+     * message loop */
+    if (lw_netif->tx_queue_len) {
+        msg_send_to_self(&tx_queue_msg);
+    }
 }
 
 static void _rx_done(gnrc_lorawan_t *mac)
@@ -355,51 +375,131 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
     return 0;
 }
 
-static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *payload)
+static int _send_frame(gnrc_netif_t *netif, gnrc_pktsnip_t *payload)
 {
-    gnrc_netif_hdr_t *netif_hdr;
-    const uint8_t *dst;
+    gnrc_netif_hdr_t *netif_hdr = payload->data;
+    const uint8_t *dst = gnrc_netif_hdr_get_dst_addr(netif_hdr);
     mlme_request_t mlme_request;
     mlme_confirm_t mlme_confirm;
 
-    uint8_t port;
+    if (netif->lorawan.flags & GNRC_NETIF_LORAWAN_FLAGS_LINK_CHECK) {
+        mlme_request.type = MLME_LINK_CHECK;
+        gnrc_lorawan_mlme_request(&netif->lorawan.mac, &mlme_request,
+                                  &mlme_confirm);
+    }
+
+    /* the netif hdr snip is only removed once the MAC took the MSDU, so the
+     * frame can be queued as it is if the MAC can't send right now */
+    mcps_request_t req =
+    { .type = netif->lorawan.ack_req ? MCPS_CONFIRMED : MCPS_UNCONFIRMED,
+      .data =
+      { .pkt = (iolist_t *)payload->next, .port = dst[0],
+        .dr = netif->lorawan.datarate } };
+    mcps_confirm_t conf;
+
+    gnrc_lorawan_mcps_request(&netif->lorawan.mac, &req, &conf);
+
+    if ((conf.status == -EBUSY) || (conf.status == -EAGAIN)) {
+        return conf.status;
+    }
+
+    /* Remove the netif hdr snip and point to the MSDU */
+    payload = gnrc_pktbuf_remove_snip(payload, payload);
+
+    if (conf.status < 0) {
+        DEBUG("gnrc_netif: unable to send (%s)\n", strerror(-conf.status));
+        gnrc_pktbuf_release_error(payload, -conf.status);
+    }
+    return conf.status;
+}
+
+static void _tx_queue_pop(gnrc_netif_lorawan_t *lw_netif)
+{
+    lw_netif->tx_queue_head = (lw_netif->tx_queue_head + 1) %
+                              CONFIG_GNRC_NETIF_LORAWAN_TX_QUEUE_LEN;
+    lw_netif->tx_queue_len--;
+}
+
+static void _tx_queue_flush(gnrc_netif_lorawan_t *lw_netif, int error)
+{
+    ztimer_remove(ZTIMER_MSEC, &lw_netif->tx_timer);
+    while (lw_netif->tx_queue_len) {
+        gnrc_pktbuf_release_error(lw_netif->tx_queue[lw_netif->tx_queue_head],
+                                  error);
+        _tx_queue_pop(lw_netif);
+    }
+}
+
+static void _tx_queue_send(gnrc_netif_t *netif)
+{
+    gnrc_netif_lorawan_t *lw_netif = &netif->lorawan;
+
+    while (lw_netif->tx_queue_len) {
+        int res = _send_frame(netif, lw_netif->tx_queue[lw_netif->tx_queue_head]);
+
+        if (res == -EBUSY) {
+            /* tried again on the MCPS confirm */
+            return;
+        }
+        if (res == -EAGAIN) {
+            /* tried again when the duty cycle allows it */
+            ztimer_set_msg(ZTIMER_MSEC, &lw_netif->tx_timer,
+                           gnrc_lorawan_region_time_off(&lw_netif->mac),
+                           &tx_queue_msg, thread_getpid());
+            return;
+        }
+
+        _tx_queue_pop(lw_netif);
+        if (res >= 0) {
+            /* one uplink at a time, frames the MAC rejected don't count */
+            return;
+        }
+    }
+}
+
+static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *payload)
+{
+    gnrc_netif_lorawan_t *lw_netif = &netif->lorawan;
+    gnrc_netif_hdr_t *netif_hdr;
     int res = -EINVAL;
 
     assert(payload);
 
     netif_hdr = payload->data;
-    dst = gnrc_netif_hdr_get_dst_addr(netif_hdr);
 
     assert(payload->type == GNRC_NETTYPE_NETIF);
-    port = dst[0];
 
-    if (netif_hdr->dst_l2addr_len != sizeof(port)) {
+    /* the destination address is the port */
+    if (netif_hdr->dst_l2addr_len != sizeof(uint8_t)) {
         goto end;
     }
 
-    /* Remove the netif hdr snip and point to the MSDU */
-    payload = gnrc_pktbuf_remove_snip(payload, payload);
-
-    if (netif->lorawan.flags & GNRC_NETIF_LORAWAN_FLAGS_LINK_CHECK) {
-        mlme_request.type = MLME_LINK_CHECK;
-        gnrc_lorawan_mlme_request(&netif->lorawan.mac, &mlme_request,
-                                  &mlme_confirm);
+    /* frames don't overtake the queued ones */
+    if (lw_netif->tx_queue_len == 0) {
+        res = _send_frame(netif, payload);
+        if ((res != -EBUSY) && (res != -EAGAIN)) {
+            goto end;
+        }
     }
 
-    mcps_request_t req =
-    { .type = netif->lorawan.ack_req ? MCPS_CONFIRMED : MCPS_UNCONFIRMED,
-      .data =
-      { .pkt = (iolist_t *)payload, .port = port,
-        .dr = netif->lorawan.datarate } };
-    mcps_confirm_t conf;
+    if (lw_netif->tx_queue_len == CONFIG_GNRC_NETIF_LORAWAN_TX_QUEUE_LEN) {
+        DEBUG("gnrc_netif: unable to send (TX queue full)\n");
+        res = -ENOBUFS;
+        gnrc_pktbuf_release_error(payload, ENOBUFS);
+        goto end;
+    }
 
-    gnrc_lorawan_mcps_request(&netif->lorawan.mac, &req, &conf);
-    res = conf.status;
+    lw_netif->tx_queue[(lw_netif->tx_queue_head + lw_netif->tx_queue_len) %
+                       CONFIG_GNRC_NETIF_LORAWAN_TX_QUEUE_LEN] = payload;
+    lw_netif->tx_queue_len++;
 
-    if (res < 0) {
-        DEBUG("gnrc_netif: unable to send (%s)\n", strerror(-res));
-        gnrc_pktbuf_release_error(payload, res);
+    if (res == -EAGAIN) {
+        /* no transmission is ongoing whose confirm would send the queue */
+        ztimer_set_msg(ZTIMER_MSEC, &lw_netif->tx_timer,
+                       gnrc_lorawan_region_time_off(&lw_netif->mac),
+                       &tx_queue_msg, thread_getpid());
     }
+    res = 0;
 
 end:
     return res;
@@ -418,6 +518,10 @@ static void _msg_handler(gnrc_netif_t *netif, msg_t *msg)
         ztimer_set_msg(ZTIMER_MSEC, &netif->lorawan.backoff_timer,
                        GNRC_LORAWAN_BACKOFF_WINDOW_TICK / 1000,
                        &backoff_msg, thread_getpid());
+        break;
+    case MSG_TYPE_TX_QUEUE:
+        _tx_queue_send(netif);
+        break;
     default:
         break;
     }
@@ -590,6 +694,7 @@ static int _set(gnrc_netif_t *netif, const gnrc_netapi_opt_t *opt)
             if (mlme_confirm.status == 0) {
                 netif->flags &= ~GNRC_NETIF_FLAGS_HAS_L2ADDR;
                 netif->dev->event_callback(netif->dev, NETDEV_EVENT_LINK_DOWN);
+                _tx_queue_flush(&netif->lorawan, ENOTCONN);
                 /* reset netif as well */
                 _reset(netif);
             }
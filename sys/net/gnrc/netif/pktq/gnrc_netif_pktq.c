@@ -55,6 +55,16 @@ unsigned gnrc_netif_pktq_usage(void)
     return res;
 }
 
+static void _update_len(gnrc_netif_t *netif)
+{
+    netif->send_queue.len++;
+#if IS_USED(MODULE_NETSTATS_L2)
+    if (netif->send_queue.len > netif->stats.tx_queue_max) {
+        netif->stats.tx_queue_max = netif->send_queue.len;
+    }
+#endif
+}
+
 int gnrc_netif_pktq_put(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
 {
     assert(netif != NULL);
@@ -66,6 +76,7 @@ int gnrc_netif_pktq_put(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
         return -1;
     }
     gnrc_pktqueue_add(&netif->send_queue.queue, entry);
+    _update_len(netif);
     return 0;
 }
 
@@ -107,6 +118,7 @@ int gnrc_netif_pktq_push_back(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
         return -1;
     }
     LL_PREPEND(netif->send_queue.queue, entry);
+    _update_len(netif);
     return 0;
 }
 
@@ -34,6 +34,17 @@
 /* The registry as lookup table by gnrc_nettype_t */
 static gnrc_netreg_entry_t *netreg[GNRC_NETTYPE_NUMOF];
 
+#if IS_USED(MODULE_GNRC_NETREG_HASH)
+static_assert((CONFIG_GNRC_NETREG_HASH_BUCKETS &
+               (CONFIG_GNRC_NETREG_HASH_BUCKETS - 1)) == 0,
+              "CONFIG_GNRC_NETREG_HASH_BUCKETS must be a power of 2");
+
+/* The registry of the transport layers by demux context (the port). Entries
+ * with the same demux context share a bucket, so the rest of the list
+ * behind an entry still holds all further matches */
+static gnrc_netreg_entry_t *_netreg_hashed[2][CONFIG_GNRC_NETREG_HASH_BUCKETS];
+#endif
+
 /** Held while accessing _lock_counter, and also while the exclusive lock is held */
 static mutex_t _lock_for_counter = MUTEX_INIT;
 /** Number of shared locks on netreg. Saturating arithmetic is used; if this
@@ -64,6 +75,39 @@ void gnrc_netreg_init(void)
 {
     /* set all pointers in registry to NULL */
     memset(netreg, 0, GNRC_NETTYPE_NUMOF * sizeof(gnrc_netreg_entry_t *));
+#if IS_USED(MODULE_GNRC_NETREG_HASH)
+    memset(_netreg_hashed, 0, sizeof(_netreg_hashed));
+#endif
+}
+
+/**
+ * @brief   Gets the list head of the registry entries of @p type and
+ *          @p demux_ctx
+ *
+ * @pre `!_INVALID_TYPE(type)`
+ */
+static gnrc_netreg_entry_t **_head(gnrc_nettype_t type, uint32_t demux_ctx)
+{
+#if IS_USED(MODULE_GNRC_NETREG_HASH)
+    unsigned bucket = demux_ctx & (CONFIG_GNRC_NETREG_HASH_BUCKETS - 1);
+
+    switch (type) {
+#if IS_USED(MODULE_GNRC_NETTYPE_UDP)
+        case GNRC_NETTYPE_UDP:
+            return &_netreg_hashed[0][bucket];
+#endif
+#if IS_USED(MODULE_GNRC_NETTYPE_TCP)
+        case GNRC_NETTYPE_TCP:
+            return &_netreg_hashed[1][bucket];
+#endif
+        default:
+            (void)bucket;
+            break;
+    }
+#else
+    (void)demux_ctx;
+#endif
+    return &netreg[type];
 }
 
 void gnrc_netreg_acquire_shared(void) {
@@ -153,13 +197,15 @@ int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
 
     _gnrc_netreg_acquire_exclusive();
 
+    gnrc_netreg_entry_t **head = _head(type, entry->demux_ctx);
+
     /* don't add the same entry twice */
     gnrc_netreg_entry_t *e;
-    LL_FOREACH(netreg[type], e) {
+    LL_FOREACH(*head, e) {
         assert(entry != e);
     }
 
-    LL_PREPEND(netreg[type], entry);
+    LL_PREPEND(*head, entry);
     _gnrc_netreg_release_exclusive();
 
     return 0;
@@ -172,7 +218,7 @@ void gnrc_netreg_unregister(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
     }
 
     _gnrc_netreg_acquire_exclusive();
-    LL_DELETE(netreg[type], entry);
+    LL_DELETE(*_head(type, entry->demux_ctx), entry);
     /* We can release now already: No new references to this entry can be made
      * any more, and the caller is only allowed to reuse the entry and the mbox
      * target referenced by it after *this* function returned, not when the
@@ -214,7 +260,8 @@ static gnrc_netreg_entry_t *_netreg_lookup(gnrc_netreg_entry_t *from,
     gnrc_netreg_entry_t *res = NULL;
 
     if (from || !_INVALID_TYPE(type)) {
-        gnrc_netreg_entry_t *head = (from) ? from->next : netreg[type];
+        gnrc_netreg_entry_t *head = (from) ? from->next
+                                           : *_head(type, demux_ctx);
         LL_SEARCH_SCALAR(head, res, demux_ctx, demux_ctx);
     }
 
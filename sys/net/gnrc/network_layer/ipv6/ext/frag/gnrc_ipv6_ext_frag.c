@@ -24,6 +24,7 @@
 #include "net/gnrc/ipv6.h"
 #include "net/gnrc/ipv6/ext.h"
 #include "net/gnrc/ipv6/ext/frag.h"
+#include "net/gnrc/netif/hdr.h"
 #include "net/gnrc/nettype.h"
 #include "net/gnrc/pktbuf.h"
 #include "random.h"
@@ -411,7 +412,7 @@ static gnrc_pktsnip_t *_completed(gnrc_ipv6_ext_frag_rbuf_t *rbuf);
 gnrc_pktsnip_t *gnrc_ipv6_ext_frag_reass(gnrc_pktsnip_t *pkt)
 {
     gnrc_ipv6_ext_frag_rbuf_t *rbuf;
-    gnrc_pktsnip_t *fh_snip, *ipv6_snip;
+    gnrc_pktsnip_t *fh_snip, *ipv6_snip, *netif_snip;
     ipv6_hdr_t *ipv6;
     ipv6_ext_frag_t *fh;
     unsigned offset;
@@ -424,6 +425,14 @@ gnrc_pktsnip_t *gnrc_ipv6_ext_frag_reass(gnrc_pktsnip_t *pkt)
         goto error_release;
     }
     fh = fh_snip->data;
+    /* a device can not verify the checksum of a fragmented datagram, so the
+     * reassembled datagram has to be verified by the stack */
+    netif_snip = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_NETIF);
+    if (netif_snip != NULL) {
+        gnrc_netif_hdr_t *netif_hdr = netif_snip->data;
+
+        netif_hdr->flags &= ~GNRC_NETIF_HDR_FLAGS_CSUM_VALID;
+    }
     /* search IPv6 header */
     ipv6_snip = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_IPV6);
     assert(ipv6_snip != NULL);
@@ -434,8 +443,10 @@ gnrc_pktsnip_t *gnrc_ipv6_ext_frag_reass(gnrc_pktsnip_t *pkt)
         goto error_release;
     }
     rbuf->arrival = xtimer_now_usec();
+    /* reassembly may run inline in another thread, so always target the
+     * IPv6 thread */
     xtimer_set_msg(&_gc_xtimer, CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_TIMEOUT_US, &_gc_msg,
-                   thread_getpid());
+                   gnrc_ipv6_pid);
     nh = fh->nh;
     offset = ipv6_ext_frag_get_offset(fh);
     switch (_overlaps(rbuf, offset, pkt->size)) {
@@ -25,6 +25,7 @@
 #include "net/gnrc/sixlowpan/ctx.h"
 #include "net/gnrc/sixlowpan/nd.h"
 #include "net/protnum.h"
+#include "rmutex.h"
 #include "thread.h"
 #include "utlist.h"
 
@@ -66,6 +67,14 @@ fib_table_t gnrc_ipv6_fib_table;
 
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 
+#if IS_USED(MODULE_GNRC_IPV6_INLINE)
+/**
+ * @brief   Serializes the packet handling of the IPv6 thread and of the
+ *          threads receiving inline
+ */
+static rmutex_t _lock = RMUTEX_INIT;
+#endif
+
 kernel_pid_t gnrc_ipv6_pid = KERNEL_PID_UNDEF;
 
 /* handles GNRC_NETAPI_MSG_TYPE_RCV commands */
@@ -171,11 +180,61 @@ static void _dispatch_next_header(gnrc_pktsnip_t *pkt, unsigned nh,
     }
 }
 
+static inline void _lock_pkt_handling(void)
+{
+#if IS_USED(MODULE_GNRC_IPV6_INLINE)
+    rmutex_lock(&_lock);
+#endif
+}
+
+static inline void _unlock_pkt_handling(void)
+{
+#if IS_USED(MODULE_GNRC_IPV6_INLINE)
+    rmutex_unlock(&_lock);
+#endif
+}
+
+#if IS_USED(MODULE_GNRC_IPV6_INLINE)
+static void _netapi_cb(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
+{
+    msg_t msg = { .type = cmd, .content = { .ptr = pkt } };
+
+    (void)ctx;
+    switch (cmd) {
+        case GNRC_NETAPI_MSG_TYPE_RCV:
+            DEBUG("ipv6: receive inline in thread %" PRIkernel_pid "\n",
+                  thread_getpid());
+            _lock_pkt_handling();
+            _receive(pkt);
+            _unlock_pkt_handling();
+            break;
+        case GNRC_NETAPI_MSG_TYPE_SND:
+            /* senders may hold the NIB lock, taking _lock here could
+             * deadlock with inline reception => leave it to the IPv6 thread */
+            if (msg_try_send(&msg, gnrc_ipv6_pid) < 1) {
+                DEBUG("ipv6: unable to pass packet to IPv6 thread\n");
+                gnrc_pktbuf_release_error(pkt, ENOBUFS);
+            }
+            break;
+        default:
+            DEBUG("ipv6: received unidentified command\n");
+            gnrc_pktbuf_release(pkt);
+            break;
+    }
+}
+#endif
+
 static void *_event_loop(void *args)
 {
     msg_t msg, reply;
+#if IS_USED(MODULE_GNRC_IPV6_INLINE)
+    static gnrc_netreg_entry_cbd_t me_cbd = { .cb = _netapi_cb };
+    static gnrc_netreg_entry_t me_reg = GNRC_NETREG_ENTRY_INIT_CB(GNRC_NETREG_DEMUX_CTX_ALL,
+                                                                  &me_cbd);
+#else
     gnrc_netreg_entry_t me_reg = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
                                                             thread_getpid());
+#endif
 
     (void)args;
     msg_init_queue(_msg_q, GNRC_IPV6_MSG_QUEUE_SIZE);
@@ -198,12 +257,16 @@ static void *_event_loop(void *args)
         switch (msg.type) {
             case GNRC_NETAPI_MSG_TYPE_RCV:
                 DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_RCV received\n");
+                _lock_pkt_handling();
                 _receive(msg.content.ptr);
+                _unlock_pkt_handling();
                 break;
 
             case GNRC_NETAPI_MSG_TYPE_SND:
                 DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_SND received\n");
+                _lock_pkt_handling();
                 _send(msg.content.ptr, true);
+                _unlock_pkt_handling();
                 break;
 
             case GNRC_NETAPI_MSG_TYPE_GET:
@@ -215,15 +278,21 @@ static void *_event_loop(void *args)
 
 #ifdef MODULE_GNRC_IPV6_EXT_FRAG
             case GNRC_IPV6_EXT_FRAG_RBUF_GC:
+                _lock_pkt_handling();
                 gnrc_ipv6_ext_frag_rbuf_gc();
+                _unlock_pkt_handling();
                 break;
             case GNRC_IPV6_EXT_FRAG_CONTINUE:
                 DEBUG("ipv6: continue fragmenting packet\n");
+                _lock_pkt_handling();
                 gnrc_ipv6_ext_frag_send(msg.content.ptr);
+                _unlock_pkt_handling();
                 break;
             case GNRC_IPV6_EXT_FRAG_SEND:
                 DEBUG("ipv6: send fragment\n");
+                _lock_pkt_handling();
                 _send_by_netif_hdr(msg.content.ptr);
+                _unlock_pkt_handling();
                 break;
 #endif  /* MODULE_GNRC_IPV6_EXT_FRAG */
             case GNRC_IPV6_NIB_SND_UC_NS:
@@ -434,6 +503,14 @@ static int _fill_ipv6_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *ipv6)
         prev->next = payload;
         prev = payload;
     }
+    /* netif is NULL for loopback */
+    if ((netif != NULL) &&
+        (netif->flags & GNRC_NETIF_FLAGS_TX_CSUM_OFFLOAD) &&
+        ((sizeof(ipv6_hdr_t) + byteorder_ntohs(hdr->len)) <= netif->ipv6.mtu)) {
+        /* packet is not fragmented, so the device fills in the checksum */
+        DEBUG("ipv6: checksum of upper header is offloaded to the device\n");
+        return 0;
+    }
     DEBUG("ipv6: calculate checksum for upper header.\n");
     if ((res = gnrc_netreg_calc_csum(payload, ipv6)) < 0) {
         if (res != -ENOENT) {   /* if there is no checksum we are okay */
@@ -759,6 +836,7 @@ static void _receive(gnrc_pktsnip_t *pkt)
 
     assert(pkt != NULL);
 
+    gnrc_netif_latency_record(pkt, NETSTATS_LATENCY_IPV6);
     netif_hdr = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_NETIF);
 
     if (netif_hdr != NULL) {
@@ -29,6 +29,7 @@
 #include "random.h"
 
 #include "_nib-internal.h"
+#include "_nib-offl-trie.h"
 #include "_nib-router.h"
 
 #define ENABLE_DEBUG 0
@@ -39,7 +40,34 @@ _nib_dr_entry_t *_prime_def_router = NULL;
 static clist_node_t _next_removable = { NULL };
 
 static _nib_onl_entry_t _nodes[CONFIG_GNRC_IPV6_NIB_NUMOF];
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH)
+#define _ONL_HASH_NUMOF     (2 * CONFIG_GNRC_IPV6_NIB_NUMOF)
+
+static_assert(CONFIG_GNRC_IPV6_NIB_NUMOF < UINT16_MAX,
+              "CONFIG_GNRC_IPV6_NIB_NUMOF too large for on-link hash table");
+
+/* open addressing with linear probing by the address of the entries in
+ * _nodes, slots hold the index of an entry + 1 or 0 when free */
+static uint16_t _onl_hash[_ONL_HASH_NUMOF];
+/* all entries in _nodes before this one are in use */
+static unsigned _onl_free_hint;
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
 static _nib_offl_entry_t _dsts[CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF];
+#if CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF
+/**
+ * @brief   Cached result of _nib_offl_get_match()
+ */
+typedef struct {
+    ipv6_addr_t dst;            /**< destination looked up */
+    _nib_offl_entry_t *match;   /**< off-link entry matching dst, may be NULL */
+    uint32_t gen;               /**< value of _offl_gen when cached, 0 if unused */
+} _route_cache_entry_t;
+
+static _route_cache_entry_t _route_cache[CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF];
+static gnrc_ipv6_nib_ft_cache_stats_t _route_cache_stats;
+/* incremented whenever the set of off-link entries changes */
+static uint32_t _offl_gen = 1;
+#endif  /* CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF */
 static _nib_dr_entry_t _def_routers[CONFIG_GNRC_IPV6_NIB_DEFAULT_ROUTER_NUMOF];
 
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C)
@@ -54,6 +82,7 @@ evtimer_msg_t _nib_evtimer;
 static void _override_node(const ipv6_addr_t *addr, unsigned iface,
                            _nib_onl_entry_t *node);
 static inline bool _node_unreachable(_nib_onl_entry_t *node);
+static void _offl_trie_remove(const _nib_offl_entry_t *dst);
 
 void _nib_init(void)
 {
@@ -61,12 +90,21 @@ void _nib_init(void)
     _prime_def_router = NULL;
     _next_removable.next = NULL;
     memset(_nodes, 0, sizeof(_nodes));
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH)
+    memset(_onl_hash, 0, sizeof(_onl_hash));
+    _onl_free_hint = 0;
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
     memset(_def_routers, 0, sizeof(_def_routers));
     memset(_dsts, 0, sizeof(_dsts));
+#if CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF
+    memset(_route_cache, 0, sizeof(_route_cache));
+    memset(&_route_cache_stats, 0, sizeof(_route_cache_stats));
+#endif  /* CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF */
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C)
     memset(_abrs, 0, sizeof(_abrs));
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
 #endif  /* TEST_SUITES */
+    _nib_offl_trie_init();
     evtimer_init_msg(&_nib_evtimer);
     /* TODO: load ABR information from persistent memory */
 }
@@ -91,6 +129,113 @@ static inline bool _addr_equals(const ipv6_addr_t *addr,
     }
 }
 
+static inline unsigned _addr_hash(const ipv6_addr_t *addr, unsigned numof)
+{
+    uint32_t hash = addr->u32[0].u32 ^ addr->u32[1].u32 ^
+                    addr->u32[2].u32 ^ addr->u32[3].u32;
+
+    /* multiplicative hashing, the upper bits of the product are mapped to
+     * the slots, so sequential interface identifiers are spread out */
+    hash *= 2654435761U;
+    return ((uint64_t)hash * numof) >> 32;
+}
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH)
+static inline unsigned _onl_hash_next(unsigned i)
+{
+    return (i + 1 < _ONL_HASH_NUMOF) ? (i + 1) : 0;
+}
+
+static unsigned _onl_hash_home(const ipv6_addr_t *addr)
+{
+    return _addr_hash(addr, _ONL_HASH_NUMOF);
+}
+
+static void _onl_hash_add(const _nib_onl_entry_t *node)
+{
+    unsigned i;
+
+    if (ipv6_addr_is_unspecified(&node->ipv6)) {
+        return;
+    }
+    /* there are twice as many slots as entries, so a free one is found */
+    for (i = _onl_hash_home(&node->ipv6); _onl_hash[i] != 0;
+         i = _onl_hash_next(i)) {}
+    _onl_hash[i] = (node - _nodes) + 1;
+}
+
+static void _onl_hash_remove(const _nib_onl_entry_t *node)
+{
+    const uint16_t slot = (node - _nodes) + 1;
+    unsigned i;
+
+    if (ipv6_addr_is_unspecified(&node->ipv6)) {
+        return;
+    }
+    for (i = _onl_hash_home(&node->ipv6); _onl_hash[i] != slot;
+         i = _onl_hash_next(i)) {
+        if (_onl_hash[i] == 0) {
+            return;
+        }
+    }
+    /* move later entries of the cluster back into the gap, unless their home
+     * slot lies between the gap and their current slot */
+    for (unsigned j = _onl_hash_next(i); _onl_hash[j] != 0;
+         j = _onl_hash_next(j)) {
+        unsigned home = _onl_hash_home(&_nodes[_onl_hash[j] - 1].ipv6);
+
+        if ((i < j) ? ((i < home) && (home <= j))
+                    : ((i < home) || (home <= j))) {
+            continue;
+        }
+        _onl_hash[i] = _onl_hash[j];
+        i = j;
+    }
+    _onl_hash[i] = 0;
+}
+
+/* returns the first matching entry in _nodes like the linear search did */
+static _nib_onl_entry_t *_onl_hash_get(const ipv6_addr_t *addr, unsigned iface,
+                                       bool exact_if)
+{
+    _nib_onl_entry_t *res = NULL;
+
+    for (unsigned i = _onl_hash_home(addr); _onl_hash[i] != 0;
+         i = _onl_hash_next(i)) {
+        _nib_onl_entry_t *node = &_nodes[_onl_hash[i] - 1];
+        unsigned node_if = _nib_onl_get_if(node);
+
+        if (((res != NULL) && (node > res)) ||
+            !ipv6_addr_equal(&node->ipv6, addr)) {
+            continue;
+        }
+        if (exact_if) {
+            if (node_if == iface) {
+                res = node;
+            }
+        }
+        else if ((node->mode != _EMPTY) &&
+                 ((node_if == 0) || (iface == 0) || (node_if == iface))) {
+            res = node;
+        }
+    }
+    return res;
+}
+
+static _nib_onl_entry_t *_onl_get_empty(void)
+{
+    for (unsigned i = _onl_free_hint; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
+        if (_nodes[i].mode == _EMPTY) {
+            /* the entry stays empty until the caller assigns a mode */
+            _onl_free_hint = i;
+            return &_nodes[i];
+        }
+    }
+    _onl_free_hint = CONFIG_GNRC_IPV6_NIB_NUMOF;
+    return NULL;
+}
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
+
 _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface)
 {
     _nib_onl_entry_t *node = NULL;
@@ -98,6 +243,18 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface)
     DEBUG("nib: Allocating on-link node entry (addr = %s, iface = %u)\n",
           (addr == NULL) ? "NULL" : ipv6_addr_to_str(addr_str, addr,
                                                      sizeof(addr_str)), iface);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH)
+    /* entries without address are not in the hash table */
+    if ((addr != NULL) && !ipv6_addr_is_unspecified(addr)) {
+        if ((node = _onl_hash_get(addr, iface, true)) != NULL) {
+            DEBUG("  %p is an exact match\n", (void *)node);
+        }
+        else if ((node = _onl_get_empty()) != NULL) {
+            DEBUG("  using %p\n", (void *)node);
+        }
+    }
+    else
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *tmp = &_nodes[i];
 
@@ -218,11 +375,35 @@ _nib_onl_entry_t *_nib_onl_iter(const _nib_onl_entry_t *last)
     return NULL;
 }
 
+bool _nib_onl_clear(_nib_onl_entry_t *node)
+{
+    if (node->mode == _EMPTY) {
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH)
+        unsigned idx = node - _nodes;
+
+        _onl_hash_remove(node);
+        if (idx < _onl_free_hint) {
+            _onl_free_hint = idx;
+        }
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
+        memset(node, 0, sizeof(_nib_onl_entry_t));
+        return true;
+    }
+    return false;
+}
+
 _nib_onl_entry_t *_nib_onl_get(const ipv6_addr_t *addr, unsigned iface)
 {
     assert(addr != NULL);
     DEBUG("nib: Getting on-link node entry (addr = %s, iface = %u)\n",
           ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)), iface);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH)
+    _nib_onl_entry_t *res = _onl_hash_get(addr, iface, false);
+
+    DEBUG("  %s %p\n", (res != NULL) ? "Found" : "No suitable entry found",
+          (void *)res);
+    return res;
+#else   /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *node = &_nodes[i];
 
@@ -238,6 +419,7 @@ _nib_onl_entry_t *_nib_onl_get(const ipv6_addr_t *addr, unsigned iface)
     }
     DEBUG("  No suitable entry found\n");
     return NULL;
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
 }
 
 void _nib_nc_set_reachable(_nib_onl_entry_t *node)
@@ -486,6 +668,17 @@ void _nib_drl_ft_get(const _nib_dr_entry_t *drl, gnrc_ipv6_nib_ft_t *fte)
     fte->iface = _nib_onl_get_if(drl->next_hop);
 }
 
+static inline void _route_cache_invalidate(void)
+{
+#if CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF
+    if (++_offl_gen == 0) {
+        /* make sure entries from the previous wrap-around never match */
+        memset(_route_cache, 0, sizeof(_route_cache));
+        _offl_gen = 1;
+    }
+#endif  /* CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF */
+}
+
 _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
                                    const ipv6_addr_t *pfx, unsigned pfx_len)
 {
@@ -519,9 +712,13 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
                                                        || _addr_equals(next_hop, tmp_node))) {
                 /* next hop matches or is unspecified */
                 DEBUG("  %p is an exact match\n", (void *)tmp);
-                if (next_hop != NULL) {
+                if ((next_hop != NULL) &&
+                    ipv6_addr_is_unspecified(&tmp_node->ipv6)) {
                     /* sets next_hop if it was previously unspecified */
                     memcpy(&tmp_node->ipv6, next_hop, sizeof(tmp_node->ipv6));
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH)
+                    _onl_hash_add(tmp_node);
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
                 }
                 /*mark that this NCE is used by an offl_entry*/
                 tmp->next_hop->mode |= _DST;
@@ -531,6 +728,10 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
     }
     if (dst != NULL) {
         DEBUG("  using %p\n", (void *)dst);
+        if (dst->pfx_len > 0) {
+            /* entry was allocated before, but never used */
+            _offl_trie_remove(dst);
+        }
         if (!dst->next_hop && !(dst->next_hop = _nib_onl_alloc(next_hop, iface))) {
             memset(dst, 0, sizeof(_nib_offl_entry_t));
             return NULL;
@@ -539,6 +740,8 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
         dst->next_hop->mode |= _DST;
         ipv6_addr_init_prefix(&dst->pfx, pfx, pfx_len);
         dst->pfx_len = pfx_len;
+        _nib_offl_trie_add(dst);
+        _route_cache_invalidate();
     }
     return dst;
 }
@@ -577,7 +780,11 @@ void _nib_offl_clear(_nib_offl_entry_t *dst)
                 _nib_onl_clear(dst->next_hop);
             }
         }
+        if (dst->pfx_len > 0) {
+            _offl_trie_remove(dst);
+        }
         memset(dst, 0, sizeof(_nib_offl_entry_t));
+        _route_cache_invalidate();
     }
     else {
         DEBUG("nib: offlink entry %s/%u with mode %u not cleared\n",
@@ -605,13 +812,33 @@ bool _nib_offl_is_entry(const _nib_offl_entry_t *entry)
     return (entry >= _dsts) && _in_dsts(entry);
 }
 
-static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
+static void _offl_trie_remove(const _nib_offl_entry_t *dst)
 {
-    _nib_offl_entry_t *res = NULL;
-    uint8_t best_match = 0;
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE)
+    _nib_offl_trie_remove(dst);
+    /* the trie only holds the first of several entries with the same prefix */
+    for (_nib_offl_entry_t *ptr = _dsts; _in_dsts(ptr); ptr++) {
+        if ((ptr != dst) && (ptr->pfx_len == dst->pfx_len) &&
+            (ipv6_addr_match_prefix(&ptr->pfx, &dst->pfx) >= dst->pfx_len)) {
+            _nib_offl_trie_add(ptr);
+            break;
+        }
+    }
+#else   /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+    (void)dst;
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+}
 
+static _nib_offl_entry_t *_offl_lookup(const ipv6_addr_t *dst)
+{
     DEBUG("nib: get match for destination %s from NIB\n",
           ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE)
+    return _nib_offl_trie_match(dst);
+#else   /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+    _nib_offl_entry_t *res = NULL;
+    uint8_t best_len = 0;
+
     for (_nib_offl_entry_t *entry = _dsts; _in_dsts(entry); entry++) {
         if (entry->mode != _EMPTY) {
             uint8_t match = ipv6_addr_match_prefix(&entry->pfx, dst);
@@ -624,15 +851,44 @@ static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
                   ipv6_addr_to_str(addr_str, &entry->next_hop->ipv6,
                                    sizeof(addr_str)),
                   _nib_onl_get_if(entry->next_hop), match);
-            if ((match > best_match) && (match >= entry->pfx_len)) {
-                DEBUG("nib: best match (%u bits)\n", match);
+            if ((entry->pfx_len > best_len) && (match >= entry->pfx_len)) {
+                DEBUG("nib: best match (%u bits)\n", entry->pfx_len);
                 res = entry;
-                best_match = match;
+                best_len = entry->pfx_len;
             }
         }
     }
     return res;
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+}
+
+_nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
+{
+#if CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF
+    _route_cache_entry_t *entry = &_route_cache[
+            _addr_hash(dst, CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF)
+        ];
+
+    if ((entry->gen == _offl_gen) && ipv6_addr_equal(&entry->dst, dst)) {
+        _route_cache_stats.hits++;
+        return entry->match;
+    }
+    _route_cache_stats.misses++;
+    entry->match = _offl_lookup(dst);
+    entry->dst = *dst;
+    entry->gen = _offl_gen;
+    return entry->match;
+#else   /* CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF */
+    return _offl_lookup(dst);
+#endif  /* CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF */
+}
+
+#if CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF
+void _nib_route_cache_stats(gnrc_ipv6_nib_ft_cache_stats_t *stats)
+{
+    *stats = _route_cache_stats;
 }
+#endif  /* CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF */
 
 void _nib_ft_get(const _nib_offl_entry_t *dst, gnrc_ipv6_nib_ft_t *fte)
 {
@@ -890,8 +1146,14 @@ static void _override_node(const ipv6_addr_t *addr, unsigned iface,
                            _nib_onl_entry_t *node)
 {
     _nib_onl_clear(node);
-    if (addr != NULL) {
+    if ((addr != NULL) && !ipv6_addr_equal(&node->ipv6, addr)) {
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH)
+        _onl_hash_remove(node);
+        memcpy(&node->ipv6, addr, sizeof(node->ipv6));
+        _onl_hash_add(node);
+#else   /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
         memcpy(&node->ipv6, addr, sizeof(node->ipv6));
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
     }
     _nib_onl_set_if(node, iface);
 }
@@ -910,10 +1172,29 @@ static inline bool _node_unreachable(_nib_onl_entry_t *node)
 
 uint32_t _evtimer_lookup(const void *ctx, uint16_t type)
 {
+    DEBUG("nib: lookup ctx = %p, type = %04x\n", (void *)ctx, type);
+#if IS_USED(MODULE_EVTIMER_HEAP)
+    /* the heap is not ordered by trigger time, so look at every event */
+    uint32_t offset = UINT32_MAX;
+
+    for (evtimer_event_t *ptr = evtimer_iter(&_nib_evtimer, NULL); ptr;
+         ptr = evtimer_iter(&_nib_evtimer, ptr)) {
+        evtimer_msg_event_t *event = (evtimer_msg_event_t *)ptr;
+
+        if ((event->msg.type == type) &&
+            ((ctx == NULL) || (event->msg.content.ptr == ctx))) {
+            uint32_t event_offset = evtimer_event_offset(&_nib_evtimer, ptr);
+
+            if (event_offset < offset) {
+                offset = event_offset;
+            }
+        }
+    }
+    return offset;
+#else
     evtimer_msg_event_t *event = (evtimer_msg_event_t *)_nib_evtimer.events;
     uint32_t offset = 0;
 
-    DEBUG("nib: lookup ctx = %p, type = %04x\n", (void *)ctx, type);
     while (event != NULL) {
         offset += event->event.offset;
         if ((event->msg.type == type) &&
@@ -923,6 +1204,7 @@ uint32_t _evtimer_lookup(const void *ctx, uint16_t type)
         event = (evtimer_msg_event_t *)event->event.next;
     }
     return UINT32_MAX;
+#endif
 }
 
 /** @} */
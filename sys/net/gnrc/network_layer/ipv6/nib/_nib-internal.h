@@ -364,14 +364,7 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
  * @return  true, if entry was cleared.
  * @return  false, if entry was not cleared.
  */
-static inline bool _nib_onl_clear(_nib_onl_entry_t *node)
-{
-    if (node->mode == _EMPTY) {
-        memset(node, 0, sizeof(_nib_onl_entry_t));
-        return true;
-    }
-    return false;
-}
+bool _nib_onl_clear(_nib_onl_entry_t *node);
 
 /**
  * @brief   Iterates over on-link entries
@@ -844,6 +837,30 @@ _nib_abr_entry_t *_nib_abr_iter(const _nib_abr_entry_t *last);
 #define _nib_abr_iter(abr) NULL
 #endif
 
+/**
+ * @brief   Gets the off-link entry with the longest prefix matching a
+ *          destination
+ *
+ * @see     @ref CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF
+ *
+ * @param[in] dst   Destination address.
+ *
+ * @return  The off-link entry with the longest prefix matching @p dst.
+ * @return  NULL, if no off-link entry matches @p dst.
+ */
+_nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst);
+
+#if CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF || defined(DOXYGEN)
+/**
+ * @brief   Gets the statistics of the route cache
+ *
+ * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF > 0.
+ *
+ * @param[out] stats    Statistics of the route cache.
+ */
+void _nib_route_cache_stats(gnrc_ipv6_nib_ft_cache_stats_t *stats);
+#endif  /* CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF */
+
 /**
  * @brief   Gets external forwarding table entry representation from off-link
  *          entry
@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @author  RIOT developers <devel@riot-os.org>
+ */
+
+#include <assert.h>
+#include <kernel_defines.h>
+#include <string.h>
+
+#include "_nib-offl-trie.h"
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE)
+/* every node holding an entry adds at most one branching node */
+#define _TRIE_NODES_NUMOF   ((2 * CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF) - 1)
+
+typedef struct _trie_node _trie_node_t;
+
+/**
+ * @brief   A node either holds the prefix of an off-link entry, or branches
+ *          the trie at the first bit its two subtrees differ in
+ */
+struct _trie_node {
+    ipv6_addr_t pfx;            /**< prefix, bits beyond len are 0 */
+    _nib_offl_entry_t *entry;   /**< entry with prefix, NULL for branching */
+    _trie_node_t *child[2];     /**< subtrees by the bit following the prefix */
+    uint8_t len;                /**< length of the prefix in bits */
+};
+
+static _trie_node_t _trie_nodes[_TRIE_NODES_NUMOF];
+static _trie_node_t *_root;
+static _trie_node_t *_free;     /* linked by child[0] */
+
+static inline unsigned _bit(const ipv6_addr_t *addr, unsigned pos)
+{
+    return (addr->u8[pos / 8] >> (7 - (pos % 8))) & 1;
+}
+
+static _trie_node_t *_node_alloc(const ipv6_addr_t *pfx, uint8_t len,
+                                 _nib_offl_entry_t *entry)
+{
+    _trie_node_t *node = _free;
+
+    assert(node != NULL);
+    _free = node->child[0];
+    memset(node, 0, sizeof(*node));
+    ipv6_addr_init_prefix(&node->pfx, pfx, len);
+    node->len = len;
+    node->entry = entry;
+    return node;
+}
+
+static void _node_free(_trie_node_t *node)
+{
+    node->child[0] = _free;
+    _free = node;
+}
+
+static inline _trie_node_t *_only_child(const _trie_node_t *node)
+{
+    return (node->child[0] != NULL) ? node->child[0] : node->child[1];
+}
+
+void _nib_offl_trie_init(void)
+{
+    _root = NULL;
+    _free = NULL;
+    for (unsigned i = 0; i < _TRIE_NODES_NUMOF; i++) {
+        _node_free(&_trie_nodes[i]);
+    }
+}
+
+void _nib_offl_trie_add(_nib_offl_entry_t *entry)
+{
+    const ipv6_addr_t *pfx = &entry->pfx;
+    uint8_t len = entry->pfx_len;
+    _trie_node_t **link = &_root;
+
+    assert((len > 0) && (len <= IPV6_ADDR_BIT_LEN));
+    while (*link != NULL) {
+        _trie_node_t *node = *link;
+        uint8_t match = ipv6_addr_match_prefix(&node->pfx, pfx);
+
+        if (match > len) {
+            match = len;
+        }
+        if (match >= node->len) {
+            /* node's prefix is a prefix of the new one */
+            if (len == node->len) {
+                /* like the linear search, prefer the first entry */
+                if ((node->entry == NULL) || (entry < node->entry)) {
+                    node->entry = entry;
+                }
+                return;
+            }
+            link = &node->child[_bit(pfx, node->len)];
+            continue;
+        }
+        /* the new prefix is a prefix of node's or they differ in bit `match` */
+        _trie_node_t *parent = _node_alloc(pfx, len, entry);
+
+        if (match < len) {
+            _trie_node_t *branch = _node_alloc(pfx, match, NULL);
+
+            branch->child[_bit(pfx, match)] = parent;
+            parent = branch;
+        }
+        parent->child[_bit(&node->pfx, match)] = node;
+        *link = parent;
+        return;
+    }
+    *link = _node_alloc(pfx, len, entry);
+}
+
+void _nib_offl_trie_remove(const _nib_offl_entry_t *entry)
+{
+    _trie_node_t **parent_link = NULL;
+    _trie_node_t **link = &_root;
+    _trie_node_t *node;
+
+    /* the path to the entry's node only depends on the bits of its prefix */
+    while (((node = *link) != NULL) && (node->len < entry->pfx_len)) {
+        parent_link = link;
+        link = &node->child[_bit(&entry->pfx, node->len)];
+    }
+    if ((node == NULL) || (node->entry != entry)) {
+        return;
+    }
+    node->entry = NULL;
+    if ((node->child[0] != NULL) && (node->child[1] != NULL)) {
+        /* keep as branching node */
+        return;
+    }
+    *link = _only_child(node);
+    _node_free(node);
+    if ((*link == NULL) && (parent_link != NULL) &&
+        ((*parent_link)->entry == NULL)) {
+        /* parent was branching but has only one subtree left */
+        node = *parent_link;
+        *parent_link = _only_child(node);
+        _node_free(node);
+    }
+}
+
+_nib_offl_entry_t *_nib_offl_trie_match(const ipv6_addr_t *dst)
+{
+    _nib_offl_entry_t *res = NULL;
+    const _trie_node_t *node = _root;
+
+    while ((node != NULL) &&
+           (ipv6_addr_match_prefix(&node->pfx, dst) >= node->len)) {
+        if ((node->entry != NULL) && (node->entry->mode != _EMPTY)) {
+            res = node->entry;
+        }
+        if (node->len >= IPV6_ADDR_BIT_LEN) {
+            break;
+        }
+        node = node->child[_bit(dst, node->len)];
+    }
+    return res;
+}
+#else  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+typedef int dont_be_pedantic;
+#endif /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+
+/** @} */
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_ipv6_nib
+ * @brief
+ * @{
+ *
+ * @file
+ * @brief   Definitions related to the prefix trie of the off-link entries
+ * @see     @ref CONFIG_GNRC_IPV6_NIB_OFFL_TRIE
+ * @internal
+ *
+ * @author  RIOT developers <devel@riot-os.org>
+ */
+#ifndef PRIV_NIB_OFFL_TRIE_H
+#define PRIV_NIB_OFFL_TRIE_H
+
+#include <kernel_defines.h>
+
+#include "net/gnrc/ipv6/nib/conf.h"
+#include "net/ipv6/addr.h"
+
+#include "_nib-internal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE) || defined(DOXYGEN)
+/**
+ * @brief   Empties the trie
+ */
+void _nib_offl_trie_init(void);
+
+/**
+ * @brief   Adds an off-link entry to the trie
+ *
+ * Of several entries with the same prefix, only the first one in memory is
+ * kept in the trie.
+ *
+ * @param[in] entry An off-link entry with its prefix set.
+ */
+void _nib_offl_trie_add(_nib_offl_entry_t *entry);
+
+/**
+ * @brief   Removes an off-link entry from the trie
+ *
+ * @note    Another entry with the same prefix has to be added again by the
+ *          caller.
+ *
+ * @param[in] entry An off-link entry with its prefix still set.
+ */
+void _nib_offl_trie_remove(const _nib_offl_entry_t *entry);
+
+/**
+ * @brief   Gets the off-link entry with the longest prefix matching a
+ *          destination
+ *
+ * Entries in the trie with mode @ref _EMPTY are skipped.
+ *
+ * @param[in] dst   A destination address.
+ *
+ * @return  The entry with the longest prefix matching @p dst.
+ * @return  NULL, if no prefix matches @p dst.
+ */
+_nib_offl_entry_t *_nib_offl_trie_match(const ipv6_addr_t *dst);
+#else   /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+#define _nib_offl_trie_init()           (void)0
+#define _nib_offl_trie_add(entry)       (void)entry
+#define _nib_offl_trie_remove(entry)    (void)entry
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRIV_NIB_OFFL_TRIE_H */
+/** @} */
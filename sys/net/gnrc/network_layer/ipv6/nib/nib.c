@@ -101,13 +101,11 @@ static inline bool _should_search_rtr(const gnrc_netif_t *netif)
 
 void gnrc_ipv6_nib_init(void)
 {
-    evtimer_event_t *tmp;
+    evtimer_event_t *ptr;
 
     _nib_acquire();
-    for (evtimer_event_t *ptr = _nib_evtimer.events;
-         (ptr != NULL) && (tmp = (ptr->next), 1);
-         ptr = tmp) {
-        evtimer_del((evtimer_t *)(&_nib_evtimer), ptr);
+    while ((ptr = evtimer_iter(&_nib_evtimer, NULL))) {
+        evtimer_del(&_nib_evtimer, ptr);
     }
     _nib_init();
     _nib_release();
@@ -243,20 +241,13 @@ void gnrc_ipv6_nib_init_iface(gnrc_netif_t *netif)
 
 static bool _on_link(const ipv6_addr_t *dst, unsigned *iface)
 {
-    _nib_offl_entry_t *entry = NULL;
-    _nib_offl_entry_t *match = NULL;
+    _nib_offl_entry_t *match;
 
     if (ipv6_addr_is_link_local(dst)) {
         return true;
     }
 
-    while ((entry = _nib_offl_iter(entry))) {
-        if ((ipv6_addr_match_prefix(dst, &entry->pfx) >= entry->pfx_len) &&
-            ((match == NULL) || (entry->pfx_len > match->pfx_len))) {
-            match = entry;
-        }
-    }
-
+    match = _nib_offl_get_match(dst);
     if (match) {
         *iface = _nib_onl_get_if(match->next_hop);
         /* check if prefix is on-link */
@@ -175,4 +175,14 @@ void gnrc_ipv6_nib_ft_print(const gnrc_ipv6_nib_ft_t *fte)
     printf("dev #%u\n", fte->iface);
 }
 
+#if CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF
+void gnrc_ipv6_nib_ft_cache_stats(gnrc_ipv6_nib_ft_cache_stats_t *stats)
+{
+    assert(stats != NULL);
+    _nib_acquire();
+    _nib_route_cache_stats(stats);
+    _nib_release();
+}
+#endif  /* CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF */
+
 /** @} */
@@ -30,15 +30,17 @@
 static gnrc_sixlowpan_ctx_t _ctxs[GNRC_SIXLOWPAN_CTX_SIZE];
 static uint32_t _ctx_inval_times[GNRC_SIXLOWPAN_CTX_SIZE];
 static mutex_t _ctx_mutex = MUTEX_INIT;
+static uint32_t _ctx_gen;
 
 static uint32_t _current_minute(void);
-static void _update_lifetime(uint8_t id);
+static void _update_lifetime(uint8_t id, uint32_t *now);
 
 static char ipv6str[IPV6_ADDR_MAX_STR_LEN];
 
-static inline bool _valid(uint8_t id)
+/* now is UINT32_MAX until the current minute is needed */
+static inline bool _valid(uint8_t id, uint32_t *now)
 {
-    _update_lifetime(id);
+    _update_lifetime(id, now);
     return (_ctxs[id].prefix_len > 0);
 }
 
@@ -46,11 +48,12 @@ gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_lookup_addr(const ipv6_addr_t *addr)
 {
     uint8_t best = 0;
     gnrc_sixlowpan_ctx_t *res = NULL;
+    uint32_t now = UINT32_MAX;
 
     mutex_lock(&_ctx_mutex);
 
     for (unsigned int id = 0; id < GNRC_SIXLOWPAN_CTX_SIZE; id++) {
-        if (_valid(id)) {
+        if (_valid(id, &now)) {
             uint8_t match = ipv6_addr_match_prefix(&_ctxs[id].prefix, addr);
 
             if ((_ctxs[id].prefix_len <= match) && (match > best)) {
@@ -77,13 +80,15 @@ gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_lookup_addr(const ipv6_addr_t *addr)
 
 gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_lookup_id(uint8_t id)
 {
+    uint32_t now = UINT32_MAX;
+
     if (id >= GNRC_SIXLOWPAN_CTX_SIZE) {
         return NULL;
     }
 
     mutex_lock(&_ctx_mutex);
 
-    if (_valid(id)) {
+    if (_valid(id, &now)) {
         DEBUG("6lo ctx: found context (%u, %s/%" PRIu8 ")\n", id,
               ipv6_addr_to_str(ipv6str, &_ctxs[id].prefix, sizeof(ipv6str)),
               _ctxs[id].prefix_len);
@@ -129,11 +134,17 @@ gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_update(uint8_t id, const ipv6_addr_t *p
           id, ipv6_addr_to_str(ipv6str, &_ctxs[id].prefix, sizeof(ipv6str)),
           _ctxs[id].prefix_len, _ctxs[id].ltime);
     _ctx_inval_times[id] = ltime + _current_minute();
+    _ctx_gen++;
 
     mutex_unlock(&_ctx_mutex);
     return &(_ctxs[id]);
 }
 
+uint32_t gnrc_sixlowpan_ctx_gen(void)
+{
+    return _ctx_gen;
+}
+
 static uint32_t _current_minute(void)
 {
 #if IS_USED(MODULE_ZTIMER_MSEC)
@@ -143,24 +154,24 @@ static uint32_t _current_minute(void)
 #endif
 }
 
-static void _update_lifetime(uint8_t id)
+static void _update_lifetime(uint8_t id, uint32_t *now)
 {
-    uint32_t now;
-
     if (_ctxs[id].ltime == 0) {
         _ctxs[id].flags_id &= ~GNRC_SIXLOWPAN_CTX_FLAGS_COMP;
         return;
     }
 
-    now = _current_minute();
+    if (*now == UINT32_MAX) {
+        *now = _current_minute();
+    }
 
-    if (now >= _ctx_inval_times[id]) {
+    if (*now >= _ctx_inval_times[id]) {
         DEBUG("6lo ctx: context %u was invalidated for compression\n", id);
         _ctxs[id].ltime = 0;
         _ctxs[id].flags_id &= ~GNRC_SIXLOWPAN_CTX_FLAGS_COMP;
     }
     else {
-        _ctxs[id].ltime = (uint16_t)(_ctx_inval_times[id] - now);
+        _ctxs[id].ltime = (uint16_t)(_ctx_inval_times[id] - *now);
     }
 }
 
@@ -170,6 +181,7 @@ static void _update_lifetime(uint8_t id)
 void gnrc_sixlowpan_ctx_reset(void)
 {
     memset(_ctxs, 0, sizeof(_ctxs));
+    _ctx_gen++;
 }
 #endif
 
@@ -32,7 +32,6 @@
 #include "net/sixlowpan/sfr.h"
 #include "thread.h"
 #include "xtimer.h"
-#include "utlist.h"
 
 #include "net/gnrc/sixlowpan/frag/rb.h"
 
@@ -60,6 +59,8 @@
 #endif
 
 static gnrc_sixlowpan_frag_rb_int_t rbuf_int[RBUF_INT_SIZE];
+/* where to start looking for a free interval */
+static unsigned rbuf_int_next;
 
 static gnrc_sixlowpan_frag_rb_t rbuf[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
 
@@ -71,9 +72,6 @@ static msg_t _gc_timer_msg = { .type = GNRC_SIXLOWPAN_FRAG_RB_GC_MSG };
 /* ------------------------------------
  * internal function definitions
  * ------------------------------------*/
-/* checks whether start and end overlaps, but not identical to, given interval i */
-static inline bool _rbuf_int_overlap_partially(gnrc_sixlowpan_frag_rb_int_t *i,
-                                               uint16_t start, uint16_t end);
 /* gets a free entry from interval buffer */
 static gnrc_sixlowpan_frag_rb_int_t *_rbuf_int_get_free(void);
 /* update interval buffer of entry */
@@ -110,30 +108,34 @@ static int _forward_uncomp(gnrc_pktsnip_t *pkt,
                            unsigned page);
 static int _rbuf_resize_for_reassembly(gnrc_sixlowpan_frag_rb_t *rbuf);
 
+/* The intervals of an entry do not overlap and are sorted by descending
+ * offset. Fragments mostly arrive in order, so a new one is usually checked
+ * against and inserted before the first interval only. */
 static int _check_fragments(gnrc_sixlowpan_frag_rb_base_t *entry,
                             size_t frag_size, size_t offset)
 {
     gnrc_sixlowpan_frag_rb_int_t *ptr = entry->ints;
+    uint16_t end = (uint16_t)(offset + frag_size - 1);
 
+    while ((ptr != NULL) && (ptr->start > end)) {
+        ptr = ptr->next;
+    }
+    /* all further intervals end before ptr starts */
+    if ((ptr == NULL) || (ptr->end < offset)) {
+        return RBUF_ADD_SUCCESS;
+    }
+    if ((ptr->start == offset) && (ptr->end == end)) {
+        DEBUG("6lo rbuf: fragment already in reassembly buffer\n");
+        return RBUF_ADD_DUPLICATE;
+    }
     /* If the fragment overlaps another fragment and differs in either the size
      * or the offset of the overlapped fragment, discards the datagram
+     * https://tools.ietf.org/html/rfc4944#section-5.3
+     *
+     * "A fresh reassembly may be commenced with the most recently
+     * received link fragment"
      * https://tools.ietf.org/html/rfc4944#section-5.3 */
-    while (ptr != NULL) {
-        if (_rbuf_int_overlap_partially(ptr, offset, offset + frag_size - 1)) {
-
-            /* "A fresh reassembly may be commenced with the most recently
-             * received link fragment"
-             * https://tools.ietf.org/html/rfc4944#section-5.3 */
-            return RBUF_ADD_REPEAT;
-        }
-        /* End was already checked in overlap check */
-        if (ptr->start == offset) {
-            DEBUG("6lo rbuf: fragment already in reassembly buffer\n");
-            return RBUF_ADD_DUPLICATE;
-        }
-        ptr = ptr->next;
-    }
-    return RBUF_ADD_SUCCESS;
+    return RBUF_ADD_REPEAT;
 }
 
 gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_add(gnrc_netif_hdr_t *netif_hdr,
@@ -504,17 +506,14 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
     return res;
 }
 
-static inline bool _rbuf_int_overlap_partially(gnrc_sixlowpan_frag_rb_int_t *i,
-                                               uint16_t start, uint16_t end)
-{
-    /* start and ends are both inclusive, so using <= for both */
-    return ((i->start <= end) && (start <= i->end)) && /* overlaps */
-        ((start != i->start) || (end != i->end)); /* not identical */
-}
-
 static gnrc_sixlowpan_frag_rb_int_t *_rbuf_int_get_free(void)
 {
-    for (unsigned int i = 0; i < RBUF_INT_SIZE; i++) {
+    /* intervals are freed in bulk when a datagram is done, so continuing after
+     * the last allocated one mostly finds a free one right away */
+    for (unsigned int n = 0; n < RBUF_INT_SIZE; n++) {
+        unsigned int i = rbuf_int_next;
+
+        rbuf_int_next = (i + 1) % RBUF_INT_SIZE;
         if (rbuf_int[i].end == 0) { /* start must be smaller than end anyways*/
             return rbuf_int + i;
         }
@@ -538,7 +537,7 @@ bool gnrc_sixlowpan_frag_rb_ints_empty(void)
 static bool _rbuf_update_ints(gnrc_sixlowpan_frag_rb_base_t *entry,
                               uint16_t offset, size_t frag_size)
 {
-    gnrc_sixlowpan_frag_rb_int_t *new;
+    gnrc_sixlowpan_frag_rb_int_t *new, **link = &entry->ints;
     uint16_t end = (uint16_t)(offset + frag_size - 1);
 
     new = _rbuf_int_get_free();
@@ -560,7 +559,12 @@ static bool _rbuf_update_ints(gnrc_sixlowpan_frag_rb_base_t *entry,
                                                   l2addr_str),
           entry->datagram_size, entry->tag);
 
-    LL_PREPEND(entry->ints, new);
+    /* keep sorted by descending offset, see _check_fragments() */
+    while ((*link != NULL) && ((*link)->start > offset)) {
+        link = &(*link)->next;
+    }
+    new->next = *link;
+    *link = new;
 
     return true;
 }
@@ -765,6 +769,7 @@ void gnrc_sixlowpan_frag_rb_reset(void)
 {
     xtimer_remove(&_gc_timer);
     memset(rbuf_int, 0, sizeof(rbuf_int));
+    rbuf_int_next = 0;
     for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
         if ((rbuf[i].pkt != NULL) &&
             (rbuf[i].pkt->users > 0)) {
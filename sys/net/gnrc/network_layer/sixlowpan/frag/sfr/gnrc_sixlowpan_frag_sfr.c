@@ -22,6 +22,9 @@
 #endif
 #ifdef MODULE_GNRC_IPV6
 #include "net/ipv6/hdr.h"
+#include "net/l2util.h"
+#include "net/netstats.h"
+#include "net/netstats/neighbor.h"
 #endif
 #include "net/gnrc/neterr.h"
 #include "net/gnrc/netif/internal.h"
@@ -78,6 +81,17 @@ typedef struct {
     } entry;
 } _generic_rb_entry_t;
 
+/**
+ * @brief   Round-trip time estimate towards a next hop
+ */
+typedef struct {
+    uint8_t l2addr[GNRC_NETIF_L2ADDR_MAXLEN];   /**< address of the next hop */
+    uint8_t l2addr_len;     /**< length of _rtt_est_t::l2addr, 0 if unused */
+    kernel_pid_t iface;     /**< interface to the next hop */
+    uint32_t srtt;          /**< smoothed RTT in ms, scaled by 8 */
+    uint32_t rttvar;        /**< RTT variation in ms, scaled by 4 */
+} _rtt_est_t;
+
 #ifdef MODULE_GNRC_IPV6_NIB
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 #else   /* MODULE_GNRC_IPV6_NIB */
@@ -101,6 +115,11 @@ static const gnrc_sixlowpan_frag_sfr_bitmap_t _null_bitmap = { .u32 = 0U };
 
 static gnrc_sixlowpan_frag_sfr_stats_t _stats;
 
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR_PACING)
+static _rtt_est_t _rtt_ests[CONFIG_GNRC_SIXLOWPAN_SFR_PACING_DST_NUMOF];
+static unsigned _rtt_ests_next;     /* next entry to replace */
+#endif
+
 /**
  * @brief   Converts a @ref sys_bitmap based bitmap to a
  *          gnrc_sixlowpan_frag_sfr_bitmap_t
@@ -857,11 +876,154 @@ static void _check_for_ecn(gnrc_pktsnip_t *frame)
     }
 }
 
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR_PACING)
+static _rtt_est_t *_rtt_est_get(const gnrc_sixlowpan_frag_fb_t *fbuf,
+                                bool create)
+{
+    gnrc_netif_hdr_t *netif_hdr = fbuf->pkt->data;
+    const uint8_t *dst = gnrc_netif_hdr_get_dst_addr(netif_hdr);
+    _rtt_est_t *est;
+
+    assert(netif_hdr->dst_l2addr_len <= sizeof(est->l2addr));
+    for (unsigned i = 0; i < ARRAY_SIZE(_rtt_ests); i++) {
+        est = &_rtt_ests[i];
+        if ((est->iface == netif_hdr->if_pid) &&
+            l2util_addr_equal(est->l2addr, est->l2addr_len,
+                              dst, netif_hdr->dst_l2addr_len)) {
+            return est;
+        }
+    }
+    if (!create) {
+        return NULL;
+    }
+    /* replace round-robin, a next hop that is still in use will be measured
+     * again with its next RFRAG-ACK */
+    est = &_rtt_ests[_rtt_ests_next];
+    _rtt_ests_next = (_rtt_ests_next + 1) % ARRAY_SIZE(_rtt_ests);
+    memcpy(est->l2addr, dst, netif_hdr->dst_l2addr_len);
+    est->l2addr_len = netif_hdr->dst_l2addr_len;
+    est->iface = netif_hdr->if_pid;
+    est->srtt = 0;
+    est->rttvar = 0;
+    return est;
+}
+#endif
+
+/**
+ * @brief   Updates the RTT estimate towards the next hop of @p fbuf as in
+ *          RFC 6298, section 2
+ *
+ * @param[in] fbuf  A fragmentation buffer entry.
+ * @param[in] rtt   A new RTT sample in ms.
+ */
+static void _rtt_est_update(const gnrc_sixlowpan_frag_fb_t *fbuf,
+                            uint32_t rtt)
+{
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR_PACING)
+    _rtt_est_t *est = _rtt_est_get(fbuf, true);
+
+    /* an SRTT of 0 marks the estimate as not sampled yet */
+    if (rtt == 0) {
+        rtt = 1;
+    }
+    if (est->srtt == 0) {
+        est->srtt = rtt << 3;
+        est->rttvar = rtt << 1;     /* RTTVAR = R / 2, scaled by 4 */
+    }
+    else {
+        int32_t delta = (int32_t)rtt - (int32_t)(est->srtt >> 3);
+
+        est->srtt += delta;         /* alpha = 1/8 */
+        if (delta < 0) {
+            delta = -delta;
+        }
+        est->rttvar -= est->rttvar >> 2;
+        est->rttvar += delta;       /* beta = 1/4 */
+    }
+    DEBUG("6lo sfr: RTT sample %" PRIu32 " ms => SRTT %" PRIu32 " ms, "
+          "RTTVAR %" PRIu32 " ms\n", rtt, est->srtt >> 3, est->rttvar >> 2);
+#else
+    (void)fbuf;
+    (void)rtt;
+#endif
+}
+
+/**
+ * @brief   Gets the RFRAG-ACK timeout for the datagram in @p fbuf
+ *
+ * @param[in] fbuf  A fragmentation buffer entry.
+ *
+ * @return  SRTT + 4 * RTTVAR towards the next hop of @p fbuf, bounded by
+ *          @ref CONFIG_GNRC_SIXLOWPAN_SFR_MIN_ARQ_TIMEOUT_MS and
+ *          @ref CONFIG_GNRC_SIXLOWPAN_SFR_MAX_ARQ_TIMEOUT_MS.
+ * @return  @ref CONFIG_GNRC_SIXLOWPAN_SFR_OPT_ARQ_TIMEOUT_MS, if the RTT was
+ *          not measured for that next hop.
+ */
+static uint32_t _arq_timeout(const gnrc_sixlowpan_frag_fb_t *fbuf)
+{
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR_PACING)
+    _rtt_est_t *est = _rtt_est_get(fbuf, false);
+
+    if ((est != NULL) && (est->srtt > 0)) {
+        uint32_t rto = (est->srtt >> 3) + est->rttvar;
+
+        if (rto < CONFIG_GNRC_SIXLOWPAN_SFR_MIN_ARQ_TIMEOUT_MS) {
+            return CONFIG_GNRC_SIXLOWPAN_SFR_MIN_ARQ_TIMEOUT_MS;
+        }
+        if (rto > CONFIG_GNRC_SIXLOWPAN_SFR_MAX_ARQ_TIMEOUT_MS) {
+            return CONFIG_GNRC_SIXLOWPAN_SFR_MAX_ARQ_TIMEOUT_MS;
+        }
+        return rto;
+    }
+#else
+    (void)fbuf;
+#endif
+    return CONFIG_GNRC_SIXLOWPAN_SFR_OPT_ARQ_TIMEOUT_MS;
+}
+
+/**
+ * @brief   Gets the inter-frame gap for the datagram in @p fbuf
+ *
+ * With `gnrc_sixlowpan_frag_sfr_pacing`, the inter-frame gap provided by
+ * gnrc_sixlowpan_frag_sfr_congure_snd_inter_frame_gap() is raised to the
+ * average TX time measured for the next hop times
+ * @ref CONFIG_GNRC_SIXLOWPAN_SFR_PACING_TX_TIME_FACTOR.
+ *
+ * @param[in] fbuf  A fragmentation buffer entry. May be NULL.
+ *
+ * @return  The inter-frame gap in microseconds.
+ */
+static uint32_t _inter_frame_gap(gnrc_sixlowpan_frag_fb_t *fbuf)
+{
+    uint32_t if_gap = gnrc_sixlowpan_frag_sfr_congure_snd_inter_frame_gap(fbuf);
+
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR_PACING)
+    if ((fbuf != NULL) && (fbuf->pkt != NULL)) {
+        gnrc_netif_hdr_t *netif_hdr = fbuf->pkt->data;
+        gnrc_netif_t *netif = gnrc_netif_hdr_get_netif(netif_hdr);
+        netstats_nb_t nb;
+
+        if ((netif != NULL) &&
+            netstats_nb_get(&netif->netif,
+                            gnrc_netif_hdr_get_dst_addr(netif_hdr),
+                            netif_hdr->dst_l2addr_len, &nb)) {
+            uint32_t tx_gap = nb.time_tx_avg *
+                              CONFIG_GNRC_SIXLOWPAN_SFR_PACING_TX_TIME_FACTOR;
+
+            if (tx_gap > if_gap) {
+                if_gap = tx_gap;
+            }
+        }
+    }
+#endif
+    return if_gap;
+}
+
 static bool _send_frame(gnrc_pktsnip_t *frame, gnrc_sixlowpan_frag_fb_t *fbuf,
                         void *ctx, unsigned page)
 {
     uint32_t now;
-    uint32_t if_gap = gnrc_sixlowpan_frag_sfr_congure_snd_inter_frame_gap(fbuf);
+    uint32_t if_gap = _inter_frame_gap(fbuf);
 
     _check_for_ecn(frame);
     now = xtimer_now_usec();
@@ -1258,6 +1420,8 @@ static void _check_failed_frags(sixlowpan_sfr_ack_t *ack,
     _frag_desc_t *frag_desc;
     clist_node_t not_received = { .next = NULL };
     ztimer_now_t earliest_send = UINT32_MAX;
+    uint32_t latest_acked_send = 0;
+    bool rtt_sampled = false;
 
     DEBUG("6lo sfr: checking which fragments to resend for datagram %u\n",
           fbuf->tag);
@@ -1276,6 +1440,15 @@ static void _check_failed_frags(sixlowpan_sfr_ack_t *ack,
                   "for datagram %u was received\n", seq,
                   frag_desc->offset, _frag_size(frag_desc), fbuf->tag);
             fbuf->sfr.frags_sent--;
+            /* only sample fragments that were not resent (Karn's algorithm)
+             * and take the last sent one, as it requested the ACK */
+            if (IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR_PACING) &&
+                (frag_desc->super.resends == 0) &&
+                (!rtt_sampled ||
+                 (frag_desc->super.send_time > latest_acked_send))) {
+                latest_acked_send = frag_desc->super.send_time;
+                rtt_sampled = true;
+            }
             clist_rpush(&_frag_descs_free, &frag_desc->super.super);
             if (IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR_CONGURE)) {
                 congure_snd_ack_t ack = {
@@ -1320,6 +1493,11 @@ static void _check_failed_frags(sixlowpan_sfr_ack_t *ack,
         sixlowpan_sfr_ecn(&ack->base)) {
         gnrc_sixlowpan_frag_sfr_congure_snd_report_ecn(fbuf, earliest_send);
     }
+    /* send times before a timer overflow are not comparable */
+    if (rtt_sampled && (ack_recv_time >= latest_acked_send)) {
+        _rtt_est_update(fbuf, ack_recv_time - latest_acked_send);
+        fbuf->sfr.arq_timeout = _arq_timeout(fbuf);
+    }
     /* all fragments were received of the current window were received and
      * the datagram was transmitted completely */
     if ((clist_lpeek(&not_received) == NULL) &&
@@ -1433,7 +1611,7 @@ static uint16_t _send_1st_fragment(gnrc_netif_t *netif,
          * datagram_size */
         fbuf->datagram_size++;
     }
-    fbuf->sfr.arq_timeout = CONFIG_GNRC_SIXLOWPAN_SFR_OPT_ARQ_TIMEOUT_MS;
+    fbuf->sfr.arq_timeout = _arq_timeout(fbuf);
 
     frag = _build_frag_from_fbuf(pkt, fbuf, frag_size);
     if (frag == NULL) {
@@ -1686,7 +1864,7 @@ static void _sched_next_frame(gnrc_sixlowpan_frag_fb_t *fbuf)
         return;
     }
     uint32_t last_sent_since = (_last_frame_sent - xtimer_now_usec());
-    uint32_t if_gap = gnrc_sixlowpan_frag_sfr_congure_snd_inter_frame_gap(fbuf);
+    uint32_t if_gap = _inter_frame_gap(fbuf);
 
     if (last_sent_since <= if_gap) {
         uint32_t offset = if_gap - last_sent_since;
@@ -1708,15 +1886,7 @@ static void _sched_next_frame(gnrc_sixlowpan_frag_fb_t *fbuf)
 
 static inline bool _arq_scheduled(gnrc_sixlowpan_frag_fb_t *fbuf)
 {
-    evtimer_event_t *ptr = _arq_timer.events;
-    evtimer_event_t *event = &fbuf->sfr.arq_timeout_event.event;
-    while (ptr) {
-        if (ptr == event) {
-            return true;
-        }
-        ptr = ptr->next;
-    }
-    return false;
+    return evtimer_is_pending(&_arq_timer, &fbuf->sfr.arq_timeout_event.event);
 }
 
 static void _sched_arq_timeout(gnrc_sixlowpan_frag_fb_t *fbuf, uint32_t offset)
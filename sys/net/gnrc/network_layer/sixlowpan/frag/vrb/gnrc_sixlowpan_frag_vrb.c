@@ -84,7 +84,9 @@ gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_add(
                                              addr_str), vrbe->out_tag);
             }
             /* _equal_index() => append intervals of `base`, so they don't get
-             * lost. We use append, so we don't need to change base! */
+             * lost. We use append, so we don't need to change base! `base`
+             * only gets here with the first fragment, so this keeps the
+             * intervals sorted by descending offset. */
             else if (base->ints != NULL) {
                 gnrc_sixlowpan_frag_rb_int_t *tmp = vrbe->super.ints;
 
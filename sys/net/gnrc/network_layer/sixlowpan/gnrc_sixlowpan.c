@@ -172,6 +172,7 @@ static void _receive(gnrc_pktsnip_t *pkt)
     gnrc_pktsnip_t *payload;
     uint8_t *dispatch;
 
+    gnrc_netif_latency_record(pkt, NETSTATS_LATENCY_6LO);
     /* seize payload as a temporary variable */
     payload = gnrc_pktbuf_start_write(pkt); /* need to duplicate since pkt->next
                                              * might get replaced */
@@ -198,7 +199,6 @@ static void _receive(gnrc_pktsnip_t *pkt)
     dispatch = payload->data;
 
     if (dispatch[0] == SIXLOWPAN_UNCOMP) {
-        gnrc_pktsnip_t *sixlowpan;
         DEBUG("6lo: received uncompressed IPv6 packet\n");
         payload = gnrc_pktbuf_start_write(payload);
 
@@ -211,16 +211,12 @@ static void _receive(gnrc_pktsnip_t *pkt)
             return;
         }
 
-        /* packet is uncompressed: just mark and remove the dispatch */
-        sixlowpan = gnrc_pktbuf_mark(payload, sizeof(uint8_t), GNRC_NETTYPE_SIXLOWPAN);
-
-        if (sixlowpan == NULL) {
-            DEBUG("6lo: can not mark 6LoWPAN dispatch\n");
+        /* packet is uncompressed: just remove the dispatch */
+        if (gnrc_pktbuf_pull(payload, sizeof(uint8_t)) != 0) {
+            DEBUG("6lo: can not remove 6LoWPAN dispatch\n");
             gnrc_pktbuf_release(pkt);
             return;
         }
-
-        pkt = gnrc_pktbuf_remove_snip(pkt, sixlowpan);
 #if defined(MODULE_CCN_LITE)
         payload->type = GNRC_NETTYPE_CCN;
 #elif defined(MODULE_GNRC_IPV6)
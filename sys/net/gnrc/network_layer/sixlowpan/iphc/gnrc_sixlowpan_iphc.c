@@ -115,6 +115,45 @@
 
 #define SIXLOWPAN_IPHC_PREFIX_LEN   (64)    /**< minimum prefix length for IPHC */
 
+#if CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_NUMOF
+/**
+ * @brief   Maximum length of a compressed IPv6 header (without NHC)
+ */
+#define IPHC_IPV6_HDR_MAX_LEN       (SIXLOWPAN_IPHC_HDR_LEN + \
+                                     SIXLOWPAN_IPHC_CID_EXT_LEN + \
+                                     4U /* traffic class and flow label */ + \
+                                     1U /* next header */ + \
+                                     1U /* hop limit */ + \
+                                     (2U * sizeof(ipv6_addr_t)))
+#define IPHC_CACHE_NO_CTX           (0xffU) /**< no context used */
+
+/**
+ * @brief   A compressed IPv6 header and everything it was derived from
+ */
+typedef struct {
+    ipv6_addr_t src;                /**< source address */
+    ipv6_addr_t dst;                /**< destination address */
+    network_uint32_t v_tc_fl;       /**< version, traffic class, flow label */
+    uint32_t ctx_gen;               /**< gnrc_sixlowpan_ctx_gen() at compression */
+    eui64_t iid;                    /**< IID of the interface if uses_iid */
+    uint8_t l2addr[GNRC_NETIF_L2ADDR_MAXLEN];   /**< destination link-layer
+                                                 *   address if uses_l2addr */
+    uint8_t l2addr_len;             /**< length of l2addr */
+    kernel_pid_t iface;             /**< interface */
+    uint8_t nh;                     /**< next header */
+    uint8_t hl;                     /**< hop limit */
+    uint8_t ctx_id[2];              /**< IDs of the source and destination
+                                     *   context or IPHC_CACHE_NO_CTX */
+    bool uses_iid;                  /**< source compressed with iid */
+    bool uses_l2addr;               /**< destination compressed with l2addr */
+    uint8_t len;                    /**< length of hdr, 0 if entry is unused */
+    uint8_t hdr[IPHC_IPV6_HDR_MAX_LEN]; /**< the compressed header */
+} _iphc_cache_entry_t;
+
+/* only accessed from the 6LoWPAN thread */
+static _iphc_cache_entry_t _iphc_cache[CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_NUMOF];
+#endif  /* CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_NUMOF */
+
 /* currently only used with forwarding output, remove guard if more debug info
  * is added */
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
@@ -726,6 +765,24 @@ static inline void _recv_error_release(gnrc_pktsnip_t *sixlo,
     gnrc_pktbuf_release(sixlo);
 }
 
+/* replaces the compressed headers in sixlo by the decoded headers in ipv6,
+ * using the headroom of sixlo so that the payload is not copied */
+static bool _decode_in_place(gnrc_pktsnip_t *sixlo, const gnrc_pktsnip_t *ipv6,
+                             size_t payload_offset, size_t uncomp_hdr_len)
+{
+    if (!IS_USED(MODULE_GNRC_PKT_HEADROOM) || (sixlo->users > 1) ||
+        (payload_offset >= sixlo->size) ||
+        ((gnrc_pktbuf_headroom(sixlo) + payload_offset) < uncomp_hdr_len)) {
+        return false;
+    }
+    /* can't fail with enough headroom */
+    gnrc_pktbuf_pull(sixlo, payload_offset);
+    gnrc_pktbuf_push(sixlo, uncomp_hdr_len);
+    memcpy(sixlo->data, ipv6->data, uncomp_hdr_len);
+    sixlo->type = GNRC_NETTYPE_IPV6;
+    return true;
+}
+
 void gnrc_sixlowpan_iphc_recv(gnrc_pktsnip_t *sixlo, void *rbuf_ptr,
                               unsigned page)
 {
@@ -898,6 +955,16 @@ void gnrc_sixlowpan_iphc_recv(gnrc_pktsnip_t *sixlo, void *rbuf_ptr,
         payload_len = (sixlo->size + uncomp_hdr_len -
                        payload_offset - sizeof(ipv6_hdr_t));
     }
+    if ((rbuf == NULL) &&
+        _decode_in_place(sixlo, ipv6, payload_offset, uncomp_hdr_len)) {
+        DEBUG("6lo iphc: decompressed in place\n");
+        gnrc_pktbuf_release(ipv6);
+        ipv6_hdr = sixlo->data;
+        ipv6_hdr->len = byteorder_htons(payload_len);
+        /* sixlo is followed by netif */
+        gnrc_sixlowpan_dispatch_recv(sixlo, NULL, page);
+        return;
+    }
     if (rbuf == NULL) {
         /* (rbuf == NULL) => forwarding is not affected by this */
         if (gnrc_pktbuf_realloc_data(ipv6, uncomp_hdr_len + payload_len) != 0) {
@@ -1073,6 +1140,103 @@ static inline bool _compressible_nh(uint8_t nh)
     }
 }
 
+#if CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_NUMOF
+static _iphc_cache_entry_t *_iphc_cache_get(const ipv6_hdr_t *ipv6_hdr)
+{
+    uint32_t hash = ipv6_hdr->src.u32[2].u32 ^ ipv6_hdr->src.u32[3].u32 ^
+                    ipv6_hdr->dst.u32[2].u32 ^ ipv6_hdr->dst.u32[3].u32;
+
+    hash *= 2654435761U;
+    return &_iphc_cache[((uint64_t)hash * CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_NUMOF) >> 32];
+}
+
+static bool _iphc_cache_match(const _iphc_cache_entry_t *entry,
+                              const ipv6_hdr_t *ipv6_hdr,
+                              const gnrc_netif_hdr_t *netif_hdr,
+                              gnrc_netif_t *iface)
+{
+    if ((entry->len == 0) || (entry->iface != iface->pid) ||
+        (entry->ctx_gen != gnrc_sixlowpan_ctx_gen()) ||
+        (entry->v_tc_fl.u32 != ipv6_hdr->v_tc_fl.u32) ||
+        (entry->nh != ipv6_hdr->nh) || (entry->hl != ipv6_hdr->hl) ||
+        !ipv6_addr_equal(&entry->src, &ipv6_hdr->src) ||
+        !ipv6_addr_equal(&entry->dst, &ipv6_hdr->dst)) {
+        return false;
+    }
+    if (entry->uses_l2addr &&
+        ((entry->l2addr_len != netif_hdr->dst_l2addr_len) ||
+         (memcmp(entry->l2addr, gnrc_netif_hdr_get_dst_addr(netif_hdr),
+                 entry->l2addr_len) != 0))) {
+        return false;
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(entry->ctx_id); i++) {
+        if (entry->ctx_id[i] != IPHC_CACHE_NO_CTX) {
+            gnrc_sixlowpan_ctx_t *ctx = gnrc_sixlowpan_ctx_lookup_id(entry->ctx_id[i]);
+
+            /* context expired or was removed since */
+            if ((ctx == NULL) || !(ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_COMP)) {
+                return false;
+            }
+        }
+    }
+    if (entry->uses_iid) {
+        eui64_t iid;
+        int res;
+
+        gnrc_netif_acquire(iface);
+        res = gnrc_netif_ipv6_get_iid(iface, &iid);
+        gnrc_netif_release(iface);
+        if ((res < 0) || (iid.uint64.u64 != entry->iid.uint64.u64)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void _iphc_cache_set(_iphc_cache_entry_t *entry,
+                            const ipv6_hdr_t *ipv6_hdr,
+                            const gnrc_netif_hdr_t *netif_hdr,
+                            gnrc_netif_t *iface, const eui64_t *iid,
+                            const uint8_t *iphc_hdr, uint16_t len)
+{
+    uint8_t iphc2 = iphc_hdr[IPHC2_IDX];
+    uint8_t cid_ext = (iphc2 & SIXLOWPAN_IPHC2_CID_EXT) ? iphc_hdr[CID_EXT_IDX] : 0;
+
+    assert(len <= sizeof(entry->hdr));
+    entry->src = ipv6_hdr->src;
+    entry->dst = ipv6_hdr->dst;
+    entry->v_tc_fl = ipv6_hdr->v_tc_fl;
+    entry->ctx_gen = gnrc_sixlowpan_ctx_gen();
+    entry->iface = iface->pid;
+    entry->nh = ipv6_hdr->nh;
+    entry->hl = ipv6_hdr->hl;
+    /* SAC is also set for the unspecified address, which needs no context */
+    entry->ctx_id[0] = ((iphc2 & SIXLOWPAN_IPHC2_SAC) &&
+                        ((iphc2 & (SIXLOWPAN_IPHC2_SAC | SIXLOWPAN_IPHC2_SAM)) !=
+                         IPHC_SAC_SAM_UNSPEC))
+                     ? (cid_ext >> 4) : IPHC_CACHE_NO_CTX;
+    entry->ctx_id[1] = (iphc2 & SIXLOWPAN_IPHC2_DAC)
+                     ? (cid_ext & 0x0f) : IPHC_CACHE_NO_CTX;
+    /* the interface's IID is only considered for these source addresses */
+    entry->uses_iid = !ipv6_addr_is_unspecified(&ipv6_hdr->src) &&
+                      ((entry->ctx_id[0] != IPHC_CACHE_NO_CTX) ||
+                       ipv6_addr_is_link_local(&ipv6_hdr->src));
+    entry->iid = *iid;
+    /* ... and the destination's link-layer address for these destinations */
+    entry->uses_l2addr = !ipv6_addr_is_multicast(&ipv6_hdr->dst) &&
+                         ((entry->ctx_id[1] != IPHC_CACHE_NO_CTX) ||
+                          ipv6_addr_is_link_local(&ipv6_hdr->dst));
+    entry->l2addr_len = 0;
+    if (entry->uses_l2addr && (netif_hdr->dst_l2addr_len <= sizeof(entry->l2addr))) {
+        entry->l2addr_len = netif_hdr->dst_l2addr_len;
+        memcpy(entry->l2addr, gnrc_netif_hdr_get_dst_addr(netif_hdr),
+               entry->l2addr_len);
+    }
+    memcpy(entry->hdr, iphc_hdr, len);
+    entry->len = len;
+}
+#endif  /* CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_NUMOF */
+
 static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
                                 const gnrc_netif_hdr_t *netif_hdr,
                                 gnrc_netif_t *iface,
@@ -1080,6 +1244,7 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
 {
     gnrc_sixlowpan_ctx_t *src_ctx = NULL, *dst_ctx = NULL;
     ipv6_hdr_t *ipv6_hdr;
+    eui64_t src_iid = { .uint64.u64 = 0 };
     bool addr_comp = false;
     uint16_t inline_pos = SIXLOWPAN_IPHC_HDR_LEN;
 
@@ -1091,6 +1256,15 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
     }
     ipv6_hdr = pkt->next->data;
 
+#if CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_NUMOF
+    _iphc_cache_entry_t *cached = _iphc_cache_get(ipv6_hdr);
+
+    if (_iphc_cache_match(cached, ipv6_hdr, netif_hdr, iface)) {
+        memcpy(iphc_hdr, cached->hdr, cached->len);
+        return cached->len;
+    }
+#endif  /* CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_NUMOF */
+
     /* set initial dispatch value*/
     iphc_hdr[IPHC1_IDX] = SIXLOWPAN_IPHC1_DISP;
     iphc_hdr[IPHC2_IDX] = 0;
@@ -1211,19 +1385,16 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
         }
 
         if ((src_ctx != NULL) || ipv6_addr_is_link_local(&(ipv6_hdr->src))) {
-            eui64_t iid;
-            iid.uint64.u64 = 0;
-
             gnrc_netif_acquire(iface);
-            if (gnrc_netif_ipv6_get_iid(iface, &iid) < 0) {
+            if (gnrc_netif_ipv6_get_iid(iface, &src_iid) < 0) {
                 DEBUG("6lo iphc: could not get interface's IID\n");
                 gnrc_netif_release(iface);
                 return 0;
             }
             gnrc_netif_release(iface);
 
-            if ((ipv6_hdr->src.u64[1].u64 == iid.uint64.u64) ||
-                _context_overlaps_iid(src_ctx, &ipv6_hdr->src, &iid)) {
+            if ((ipv6_hdr->src.u64[1].u64 == src_iid.uint64.u64) ||
+                _context_overlaps_iid(src_ctx, &ipv6_hdr->src, &src_iid)) {
                 /* 0 bits. The address is derived from link-layer address */
                 iphc_hdr[IPHC2_IDX] |= IPHC_SAC_SAM_L2;
                 addr_comp = true;
@@ -1369,6 +1540,10 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
         inline_pos += 16;
     }
 
+#if CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_NUMOF
+    _iphc_cache_set(cached, ipv6_hdr, netif_hdr, iface, &src_iid, iphc_hdr,
+                    inline_pos);
+#endif  /* CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_NUMOF */
     return inline_pos;
 }
 
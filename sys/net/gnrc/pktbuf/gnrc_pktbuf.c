@@ -13,6 +13,11 @@
  * @author  Martine Lenders <m.lenders@fu-berlin.de>
  */
 
+#include <assert.h>
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+
 #include "mutex.h"
 #include "net/gnrc/pktbuf.h"
 #include "net/gnrc/tx_sync.h"
@@ -24,6 +29,130 @@
 
 mutex_t gnrc_pktbuf_mutex = MUTEX_INIT;
 
+#ifdef MODULE_GNRC_PKT_QUOTA
+/* list of all quotas, for gnrc_pktbuf_stats() */
+static gnrc_pktbuf_quota_t *_quotas;
+
+void gnrc_pktbuf_quota_init(gnrc_pktbuf_quota_t *quota, kernel_pid_t owner,
+                            size_t limit)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    quota->limit = limit;
+    quota->used = 0;
+    quota->used_max = 0;
+    quota->fails = 0;
+    quota->owner = owner;
+    for (gnrc_pktbuf_quota_t *ptr = _quotas; ptr; ptr = ptr->next) {
+        if (ptr == quota) {
+            /* re-initialized */
+            mutex_unlock(&gnrc_pktbuf_mutex);
+            return;
+        }
+    }
+    quota->next = _quotas;
+    _quotas = quota;
+    mutex_unlock(&gnrc_pktbuf_mutex);
+}
+
+int gnrc_pktbuf_quota_charge(gnrc_pktbuf_quota_t *quota, gnrc_pktsnip_t *pkt)
+{
+    size_t charge = 0;
+
+    assert((quota != NULL) && (pkt != NULL) && (pkt->quota == NULL));
+    for (gnrc_pktsnip_t *snip = pkt; snip != NULL; snip = snip->next) {
+        charge += gnrc_pktbuf_headroom(snip) + snip->size;
+    }
+    if (charge > UINT16_MAX) {
+        charge = UINT16_MAX;
+    }
+
+    mutex_lock(&gnrc_pktbuf_mutex);
+    if ((quota->limit != 0) && ((quota->used + charge) > quota->limit)) {
+        DEBUG("pktbuf: quota of %" PRIkernel_pid " exceeded by %u bytes\n",
+              quota->owner, (unsigned)charge);
+        quota->fails++;
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return -ENOBUFS;
+    }
+    quota->used += charge;
+    if (quota->used > quota->used_max) {
+        quota->used_max = quota->used;
+    }
+    pkt->quota = quota;
+    pkt->quota_charge = charge;
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return 0;
+}
+
+/* must be called with gnrc_pktbuf_mutex locked */
+static void _quota_credit(gnrc_pktsnip_t *pkt)
+{
+    if (pkt->quota != NULL) {
+        assert(pkt->quota->used >= pkt->quota_charge);
+        pkt->quota->used -= pkt->quota_charge;
+        gnrc_pktbuf_clear_quota(pkt);
+    }
+}
+
+#ifdef DEVELHELP
+void gnrc_pktbuf_quota_stats(void)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    printf("%-6s %6s %6s %6s %6s\n", "quota", "limit", "used", "max", "fails");
+    for (gnrc_pktbuf_quota_t *quota = _quotas; quota; quota = quota->next) {
+        printf("%-6" PRIkernel_pid " %6u %6u %6u %6" PRIu32 "\n", quota->owner,
+               (unsigned)quota->limit, (unsigned)quota->used,
+               (unsigned)quota->used_max, quota->fails);
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+}
+#endif
+#else
+static inline void _quota_credit(gnrc_pktsnip_t *pkt)
+{
+    (void)pkt;
+}
+#endif
+
+#ifdef MODULE_GNRC_PKT_EXT
+gnrc_pktsnip_t *gnrc_pktbuf_add_ext(gnrc_pktsnip_t *next, const void *data,
+                                    size_t size, gnrc_nettype_t type,
+                                    gnrc_pktbuf_ext_t *ext)
+{
+    gnrc_pktsnip_t *pkt;
+
+    assert(ext != NULL);
+    pkt = gnrc_pktbuf_add(next, NULL, 0, type);
+    if (pkt == NULL) {
+        return NULL;
+    }
+    mutex_lock(&gnrc_pktbuf_mutex);
+    /* cast away const: the data are never written through an external snip */
+    pkt->data = (void *)data;
+    pkt->size = size;
+    pkt->ext = ext;
+    ext->snips++;
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return pkt;
+}
+
+/* must be called with gnrc_pktbuf_mutex locked */
+static void _ext_release(gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktbuf_ext_t *ext = pkt->ext;
+
+    assert(ext->snips > 0);
+    if ((--ext->snips == 0) && (ext->cb != NULL)) {
+        ext->cb(ext);
+    }
+}
+#else
+static inline void _ext_release(gnrc_pktsnip_t *pkt)
+{
+    (void)pkt;
+}
+#endif
+
 gnrc_pktsnip_t *gnrc_pktbuf_remove_snip(gnrc_pktsnip_t *pkt,
                                         gnrc_pktsnip_t *snip)
 {
@@ -85,33 +214,92 @@ int gnrc_pktbuf_merge(gnrc_pktsnip_t *pkt)
     return res;
 }
 
+int gnrc_pktbuf_pull(gnrc_pktsnip_t *pkt, size_t size)
+{
+    assert(pkt != NULL);
+    assert(pkt->users == 1);
+    assert(gnrc_pktbuf_ext(pkt) == NULL);
+
+    if (size > pkt->size) {
+        return -EINVAL;
+    }
+    if (size == 0) {
+        return 0;
+    }
+    if (size == pkt->size) {
+        /* can't fail when shrinking to 0 */
+        gnrc_pktbuf_realloc_data(pkt, 0);
+        return 0;
+    }
+#ifdef MODULE_GNRC_PKT_HEADROOM
+    assert((pkt->headroom + size) <= UINT16_MAX);
+    pkt->data = ((uint8_t *)pkt->data) + size;
+    pkt->size -= size;
+    pkt->headroom += size;
+#else
+    gnrc_pktsnip_t *hdr = gnrc_pktbuf_mark(pkt, size, GNRC_NETTYPE_UNDEF);
+
+    if (hdr == NULL) {
+        return -ENOMEM;
+    }
+    gnrc_pktbuf_remove_snip(pkt, hdr);
+#endif
+    return 0;
+}
+
+int gnrc_pktbuf_push(gnrc_pktsnip_t *pkt, size_t size)
+{
+    assert(pkt != NULL);
+    assert(pkt->users == 1);
+    assert(gnrc_pktbuf_ext(pkt) == NULL);
+
+    if (size > gnrc_pktbuf_headroom(pkt)) {
+        return -ENOSPC;
+    }
+#ifdef MODULE_GNRC_PKT_HEADROOM
+    pkt->data = ((uint8_t *)pkt->data) - size;
+    pkt->size += size;
+    pkt->headroom -= size;
+#endif
+    return 0;
+}
+
 void gnrc_pktbuf_release_error(gnrc_pktsnip_t *pkt, uint32_t err)
 {
-    mutex_lock(&gnrc_pktbuf_mutex);
+    bool locked = false;
+
     while (pkt) {
         gnrc_pktsnip_t *tmp;
         assert(gnrc_pktbuf_contains(pkt));
-        assert(pkt->users > 0);
+        assert(gnrc_pktbuf_users(pkt) > 0);
         tmp = pkt->next;
-        if (pkt->users == 1) {
-            pkt->users = 0; /* not necessary but to be on the safe side */
-            if (!IS_USED(MODULE_GNRC_TX_SYNC)
-                || (pkt->type != GNRC_NETTYPE_TX_SYNC)) {
-                gnrc_pktbuf_free_internal(pkt->data, pkt->size);
+        DEBUG("pktbuf: report status code %" PRIu32 "\n", err);
+        gnrc_neterr_report(pkt, err);
+        /* only the last user needs the lock to free the snip */
+        if (gnrc_pktbuf_users_dec(pkt) == 1) {
+            if (!locked) {
+                mutex_lock(&gnrc_pktbuf_mutex);
+                locked = true;
+            }
+            _quota_credit(pkt);
+            if (gnrc_pktbuf_ext(pkt) != NULL) {
+                _ext_release(pkt);
+            }
+            else if (!IS_USED(MODULE_GNRC_TX_SYNC)
+                     || (pkt->type != GNRC_NETTYPE_TX_SYNC)) {
+                gnrc_pktbuf_free_internal(gnrc_pktbuf_buffer(pkt),
+                                          gnrc_pktbuf_headroom(pkt) + pkt->size);
             }
             else {
                 gnrc_tx_complete(pkt);
             }
             gnrc_pktbuf_free_internal(pkt, sizeof(gnrc_pktsnip_t));
         }
-        else {
-            pkt->users--;
-        }
-        DEBUG("pktbuf: report status code %" PRIu32 "\n", err);
-        gnrc_neterr_report(pkt, err);
         pkt = tmp;
     }
-    mutex_unlock(&gnrc_pktbuf_mutex);
+    if (locked) {
+        mutex_unlock(&gnrc_pktbuf_mutex);
+    }
 }
 
 /** @} */
@@ -23,10 +23,14 @@
 #ifndef PKTBUF_INTERNAL_H
 #define PKTBUF_INTERNAL_H
 
+#include <limits.h>
 #include <stdbool.h>
 #include <stdlib.h>
 
+#include "atomic_utils.h"
 #include "mutex.h"
+#include "net/gnrc/pkt.h"
+#include "net/gnrc/pktbuf.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -41,6 +45,60 @@ extern "C" {
  */
 extern mutex_t gnrc_pktbuf_mutex;
 
+/**
+ * @name    Atomic access to gnrc_pktsnip_t::users
+ * @warning These functions are ***internal***.
+ *
+ * Only a user of a packet snip can add users to it, so as long as the number
+ * of users does not drop to 0, the snip can not be freed and its users can be
+ * counted without locking @ref gnrc_pktbuf_mutex.
+ * @{
+ */
+/**
+ * @brief   Get the number of users of a packet snip
+ * @param   pkt     packet snip
+ * @return  number of users of @p pkt
+ */
+static inline unsigned gnrc_pktbuf_users(gnrc_pktsnip_t *pkt)
+{
+#if UINT_MAX == UINT16_MAX
+    return atomic_load_u16((volatile uint16_t *)&pkt->users);
+#else
+    return atomic_load_u32((volatile uint32_t *)&pkt->users);
+#endif
+}
+
+/**
+ * @brief   Add users to a packet snip
+ * @param   pkt     packet snip
+ * @param   num     number of users to add
+ * @return  number of users of @p pkt before the addition
+ */
+static inline unsigned gnrc_pktbuf_users_add(gnrc_pktsnip_t *pkt, unsigned num)
+{
+#if UINT_MAX == UINT16_MAX
+    return atomic_fetch_add_u16((volatile uint16_t *)&pkt->users, num);
+#else
+    return atomic_fetch_add_u32((volatile uint32_t *)&pkt->users, num);
+#endif
+}
+
+/**
+ * @brief   Remove a user from a packet snip
+ * @param   pkt     packet snip
+ * @return  number of users of @p pkt before the removal, the caller was the
+ *          last user if this is 1
+ */
+static inline unsigned gnrc_pktbuf_users_dec(gnrc_pktsnip_t *pkt)
+{
+#if UINT_MAX == UINT16_MAX
+    return atomic_fetch_sub_u16((volatile uint16_t *)&pkt->users, 1);
+#else
+    return atomic_fetch_sub_u32((volatile uint32_t *)&pkt->users, 1);
+#endif
+}
+/** @} */
+
 /**
  * @brief   Check if the given pointer is indeed part of the packet buffer
  *
@@ -65,6 +123,109 @@ bool gnrc_pktbuf_contains(void *ptr);
  */
 void gnrc_pktbuf_free_internal(void *data, size_t size);
 
+/**
+ * @brief   Set the headroom of a packet snip
+ *
+ * @warning This function is ***internal***.
+ *
+ * @param   pkt         packet snip
+ * @param   headroom    number of bytes in front of gnrc_pktsnip_t::data of
+ *                      @p pkt that belong to it, must be 0 without
+ *                      `gnrc_pkt_headroom`
+ */
+static inline void gnrc_pktbuf_set_headroom(gnrc_pktsnip_t *pkt, size_t headroom)
+{
+#ifdef MODULE_GNRC_PKT_HEADROOM
+    pkt->headroom = headroom;
+#else
+    (void)pkt;
+    (void)headroom;
+#endif
+}
+
+/**
+ * @brief   Mark a packet snip as not charged to a quota
+ *
+ * @warning This function is ***internal***.
+ *
+ * @param   pkt         packet snip
+ */
+static inline void gnrc_pktbuf_clear_quota(gnrc_pktsnip_t *pkt)
+{
+#ifdef MODULE_GNRC_PKT_QUOTA
+    pkt->quota = NULL;
+    pkt->quota_charge = 0;
+#else
+    (void)pkt;
+#endif
+}
+
+/**
+ * @brief   Mark the data of a packet snip as part of the packet buffer
+ *
+ * @warning This function is ***internal***.
+ *
+ * @param   pkt         packet snip
+ */
+static inline void gnrc_pktbuf_clear_ext(gnrc_pktsnip_t *pkt)
+{
+#ifdef MODULE_GNRC_PKT_EXT
+    pkt->ext = NULL;
+#else
+    (void)pkt;
+#endif
+}
+
+/**
+ * @brief   Get the owner of the data of a packet snip
+ *
+ * @warning This function is ***internal***.
+ *
+ * @param   pkt         packet snip
+ *
+ * @return  the owner of the data, as given to @ref gnrc_pktbuf_add_ext()
+ * @return  NULL, if the data are part of the packet buffer
+ */
+static inline void *gnrc_pktbuf_ext(const gnrc_pktsnip_t *pkt)
+{
+#ifdef MODULE_GNRC_PKT_EXT
+    return pkt->ext;
+#else
+    (void)pkt;
+    return NULL;
+#endif
+}
+
+/**
+ * @brief   Print the usage of all quotas
+ *
+ * @warning This function is ***internal***. It is called by
+ *          @ref gnrc_pktbuf_stats().
+ */
+#if defined(MODULE_GNRC_PKT_QUOTA) && defined(DEVELHELP)
+void gnrc_pktbuf_quota_stats(void);
+#else
+static inline void gnrc_pktbuf_quota_stats(void)
+{
+}
+#endif
+
+/**
+ * @brief   Get the start of the internal buffer backing a packet snip
+ *
+ * @warning This function is ***internal***.
+ *
+ * @param   pkt     packet snip
+ *
+ * @return  the start of the buffer, including the headroom of @p pkt
+ */
+static inline void *gnrc_pktbuf_buffer(const gnrc_pktsnip_t *pkt)
+{
+    size_t headroom = gnrc_pktbuf_headroom(pkt);
+
+    return headroom ? ((uint8_t *)pkt->data) - headroom : pkt->data;
+}
+
 /* for testing */
 #ifdef TEST_SUITES
 /**
@@ -39,6 +39,8 @@
 #include "debug.h"
 
 #ifdef MODULE_FUZZING
+#include "fuzzing.h"
+
 extern gnrc_pktsnip_t *gnrc_pktbuf_fuzzptr;
 #endif
 
@@ -54,17 +56,18 @@ static inline void *_malloc(size_t size)
 static inline void _free(void *ptr)
 {
     if (ptr != NULL) {
+        mallocs--;
+        free(ptr);
+
         /* The fuzzing module is only enabled when building a fuzzing
          * application from the fuzzing/ subdirectory. If _free is
          * called on the crafted fuzzing packet, the setup assumes that
-         * input processing has completed and the application terminates. */
+         * input processing has completed. */
 #if defined(MODULE_FUZZING) && !defined(MODULE_GNRC_SOCK)
         if (ptr == gnrc_pktbuf_fuzzptr) {
-           exit(EXIT_SUCCESS);
+            fuzzing_done();
         }
 #endif
-        mallocs--;
-        free(ptr);
     }
 }
 #else
@@ -87,6 +90,9 @@ static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
 #ifdef MODULE_GNRC_NETERR
     pkt->err_sub = KERNEL_PID_UNDEF;
 #endif
+    gnrc_pktbuf_set_headroom(pkt, 0);
+    gnrc_pktbuf_clear_quota(pkt);
+    gnrc_pktbuf_clear_ext(pkt);
 }
 
 void gnrc_pktbuf_init(void)
@@ -115,7 +121,7 @@ gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t s
 static gnrc_pktsnip_t *_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t type)
 {
     gnrc_pktsnip_t *header;
-    void *header_data, *payload;
+    void *header_data;
 
     if ((size == 0) || (pkt == NULL) || (size > pkt->size) || (pkt->data == NULL)) {
         DEBUG("pktbuf: size == 0 (was %" PRIuSIZE ") or pkt == NULL (was %p) or "
@@ -132,12 +138,26 @@ static gnrc_pktsnip_t *_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t ty
     }
     if (pkt->size == size) {
         _set_pktsnip(header, pkt->next, pkt->data, size, type);
+        gnrc_pktbuf_set_headroom(header, gnrc_pktbuf_headroom(pkt));
         _set_pktsnip(pkt, header, NULL, 0, pkt->type);
         return header;
     }
+#ifdef MODULE_GNRC_PKT_HEADROOM
+    /* copy the (usually small) header, the payload keeps the malloc'd section
+     * and the marked bytes become its headroom */
+    header_data = _malloc(size);
+    if (header_data == NULL) {
+        DEBUG("pktbuf: could not reallocate marked section.\n");
+        _free(header);
+        return NULL;
+    }
+    memcpy(header_data, pkt->data, size);
+    pkt->data = ((uint8_t *)pkt->data) + size;
+    pkt->headroom += size;
+#else
     /* we can not just "snip off" something from the end of a malloc'd section
      * so we need to realloc for marked snip */
-    payload = _malloc(pkt->size - size);
+    void *payload = _malloc(pkt->size - size);
     if (payload == NULL) {
         DEBUG("pktbuf: could not reallocate marked section.\n");
         _free(header);
@@ -152,6 +172,7 @@ static gnrc_pktsnip_t *_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t ty
         return NULL;
     }
     pkt->data = payload;
+#endif
     pkt->size -= size;
     _set_pktsnip(header, pkt->next, header_data, size, type);
     pkt->next = header;
@@ -162,6 +183,7 @@ gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_
 {
     gnrc_pktsnip_t *new;
 
+    assert((pkt == NULL) || (gnrc_pktbuf_ext(pkt) == NULL));
     mutex_lock(&gnrc_pktbuf_mutex);
     new = _mark(pkt, size, type);
     mutex_unlock(&gnrc_pktbuf_mutex);
@@ -179,18 +201,22 @@ static int _realloc_data(gnrc_pktsnip_t *pkt, size_t size)
         return 0;
     }
     /* new size is 0 and data pointer isn't already NULL */
+    size_t headroom = gnrc_pktbuf_headroom(pkt);
+
     if ((size == 0) && (pkt->data != NULL)) {
         /* set data pointer to NULL */
-        _free(pkt->data);
+        _free(gnrc_pktbuf_buffer(pkt));
+        gnrc_pktbuf_set_headroom(pkt, 0);
         pkt->data = NULL;
     }
     else {
-        void *data = (pkt->data) ? realloc(pkt->data, size) : _malloc(size);
+        void *data = (pkt->data) ? realloc(gnrc_pktbuf_buffer(pkt), headroom + size)
+                                 : _malloc(size);
         if (data == NULL) {
             DEBUG("pktbuf: error allocating new data section\n");
             return ENOMEM;
         }
-        pkt->data = data;
+        pkt->data = ((uint8_t *)data) + ((pkt->data) ? headroom : 0);
     }
     pkt->size = size;
     return 0;
@@ -200,6 +226,7 @@ int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
 {
     int res;
 
+    assert((pkt == NULL) || (gnrc_pktbuf_ext(pkt) == NULL));
     mutex_lock(&gnrc_pktbuf_mutex);
     res = _realloc_data(pkt, size);
     mutex_unlock(&gnrc_pktbuf_mutex);
@@ -208,38 +235,39 @@ int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
 
 void gnrc_pktbuf_hold(gnrc_pktsnip_t *pkt, unsigned int num)
 {
-    mutex_lock(&gnrc_pktbuf_mutex);
     while (pkt) {
-        pkt->users += num;
+        gnrc_pktbuf_users_add(pkt, num);
         pkt = pkt->next;
     }
-    mutex_unlock(&gnrc_pktbuf_mutex);
 }
 
 gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt)
 {
-    mutex_lock(&gnrc_pktbuf_mutex);
-    if (pkt == NULL) {
-        mutex_unlock(&gnrc_pktbuf_mutex);
-        return NULL;
+    if ((pkt == NULL) || (gnrc_pktbuf_users(pkt) == 1)) {
+        /* no one else can take a reference to a snip with a single user */
+        return pkt;
     }
-    if (pkt->users > 1) {
-        gnrc_pktsnip_t *new;
-        new = _create_snip(pkt->next, pkt->data, pkt->size, pkt->type);
-        if (new != NULL) {
-            pkt->users--;
-        }
-        mutex_unlock(&gnrc_pktbuf_mutex);
-        return new;
+
+    gnrc_pktsnip_t *new;
+
+    mutex_lock(&gnrc_pktbuf_mutex);
+    new = _create_snip(pkt->next, pkt->data, pkt->size, pkt->type);
+    if ((new != NULL) && (gnrc_pktbuf_users_dec(pkt) == 1)) {
+        /* all other users released pkt meanwhile, so keep it instead */
+        gnrc_pktbuf_users_add(pkt, 1);
+        gnrc_pktbuf_free_internal(new->data, new->size);
+        gnrc_pktbuf_free_internal(new, sizeof(gnrc_pktsnip_t));
+        new = pkt;
     }
     mutex_unlock(&gnrc_pktbuf_mutex);
-    return pkt;
+    return new;
 }
 
 #ifdef DEVELHELP
 void gnrc_pktbuf_stats(void)
 {
     LOG_INFO("pktbuf: no stat output for gnrc_pktbuf_malloc, use tools like valgrind\n");
+    gnrc_pktbuf_quota_stats();
 }
 #endif
 
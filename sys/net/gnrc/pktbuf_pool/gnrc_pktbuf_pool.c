@@ -0,0 +1,495 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_pktbuf
+ * @{
+ *
+ * @file
+ * @brief   Packet buffer with segregated pools of fixed size blocks
+ *
+ * Every allocation is served by a block of one of the pools. A block may back
+ * more than one snip after @ref gnrc_pktbuf_mark(), so each block has a
+ * reference count and is only returned to its pool when it drops to zero.
+ *
+ * @author  RIOT developers <devel@riot-os.org>
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "container.h"
+#include "mutex.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/nettype.h"
+#include "net/gnrc/pkt.h"
+
+#include "pktbuf_internal.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/**
+ * @brief   Alignment of all blocks
+ */
+#define POOL_ALIGN          (alignof(max_align_t))
+
+/**
+ * @brief   Round @p size up to a multiple of @ref POOL_ALIGN
+ */
+#define POOL_ROUND(size)    (((size) + POOL_ALIGN - 1) & ~(POOL_ALIGN - 1))
+
+#define SNIP_SIZE           POOL_ROUND(sizeof(gnrc_pktsnip_t))
+#define SMALL_SIZE          POOL_ROUND(CONFIG_GNRC_PKTBUF_POOL_SMALL_SIZE)
+#define LARGE_SIZE          POOL_ROUND(CONFIG_GNRC_PKTBUF_POOL_LARGE_SIZE)
+
+static_assert(SNIP_SIZE < SMALL_SIZE,
+              "CONFIG_GNRC_PKTBUF_POOL_SMALL_SIZE must exceed a packet snip");
+static_assert(SMALL_SIZE < LARGE_SIZE,
+              "CONFIG_GNRC_PKTBUF_POOL_LARGE_SIZE must exceed the small size");
+static_assert(CONFIG_GNRC_PKTBUF_POOL_SNIP_NUMOF <= UINT16_MAX &&
+              CONFIG_GNRC_PKTBUF_POOL_SMALL_NUMOF <= UINT16_MAX &&
+              CONFIG_GNRC_PKTBUF_POOL_LARGE_NUMOF <= UINT16_MAX,
+              "at most 65535 blocks per pool");
+
+/**
+ * @brief   Free block of a pool
+ */
+typedef struct _free {
+    struct _free *next;     /**< next free block of the pool */
+} _free_t;
+
+/**
+ * @brief   Pool of fixed size blocks
+ */
+typedef struct {
+    uint8_t *buf;           /**< storage of the blocks */
+    uint8_t *refs;          /**< number of snips backed by each block */
+    _free_t *free;          /**< list of free blocks */
+    uint16_t block_size;    /**< size of a block in bytes */
+    uint16_t numof;         /**< number of blocks */
+    uint16_t used;          /**< number of blocks in use */
+    uint16_t max_used;      /**< high water mark of @ref used */
+    uint32_t requested;     /**< bytes requested from the used blocks */
+    uint32_t fallbacks;     /**< allocations served by a larger class */
+    uint32_t fails;         /**< failed allocations of this class */
+} _pool_t;
+
+static alignas(POOL_ALIGN) uint8_t _snip_buf[CONFIG_GNRC_PKTBUF_POOL_SNIP_NUMOF][SNIP_SIZE];
+static alignas(POOL_ALIGN) uint8_t _small_buf[CONFIG_GNRC_PKTBUF_POOL_SMALL_NUMOF][SMALL_SIZE];
+static alignas(POOL_ALIGN) uint8_t _large_buf[CONFIG_GNRC_PKTBUF_POOL_LARGE_NUMOF][LARGE_SIZE];
+static uint8_t _snip_refs[CONFIG_GNRC_PKTBUF_POOL_SNIP_NUMOF];
+static uint8_t _small_refs[CONFIG_GNRC_PKTBUF_POOL_SMALL_NUMOF];
+static uint8_t _large_refs[CONFIG_GNRC_PKTBUF_POOL_LARGE_NUMOF];
+
+/* sorted by block size */
+static _pool_t _pools[] = {
+    { .buf = _snip_buf[0], .refs = _snip_refs, .block_size = SNIP_SIZE,
+      .numof = CONFIG_GNRC_PKTBUF_POOL_SNIP_NUMOF },
+    { .buf = _small_buf[0], .refs = _small_refs, .block_size = SMALL_SIZE,
+      .numof = CONFIG_GNRC_PKTBUF_POOL_SMALL_NUMOF },
+    { .buf = _large_buf[0], .refs = _large_refs, .block_size = LARGE_SIZE,
+      .numof = CONFIG_GNRC_PKTBUF_POOL_LARGE_NUMOF },
+};
+
+static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
+                                void *data, size_t size, gnrc_nettype_t type)
+{
+    pkt->next = next;
+    pkt->data = data;
+    pkt->size = size;
+    pkt->type = type;
+    pkt->users = 1;
+#ifdef MODULE_GNRC_NETERR
+    pkt->err_sub = KERNEL_PID_UNDEF;
+#endif
+    gnrc_pktbuf_set_headroom(pkt, 0);
+    gnrc_pktbuf_clear_quota(pkt);
+    gnrc_pktbuf_clear_ext(pkt);
+}
+
+static _pool_t *_pool_of(const void *ptr)
+{
+    uintptr_t pos = (uintptr_t)ptr;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_pools); i++) {
+        uintptr_t start = (uintptr_t)_pools[i].buf;
+
+        if ((pos >= start) &&
+            (pos < start + (size_t)_pools[i].numof * _pools[i].block_size)) {
+            return &_pools[i];
+        }
+    }
+    return NULL;
+}
+
+static inline unsigned _block_idx(const _pool_t *pool, const void *ptr)
+{
+    return ((uintptr_t)ptr - (uintptr_t)pool->buf) / pool->block_size;
+}
+
+static inline uint8_t *_block(const _pool_t *pool, unsigned idx)
+{
+    return pool->buf + (size_t)idx * pool->block_size;
+}
+
+static void *_pktbuf_alloc(size_t size)
+{
+    _pool_t *fitting = NULL;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_pools); i++) {
+        _pool_t *pool = &_pools[i];
+
+        if (size > pool->block_size) {
+            continue;
+        }
+        if (fitting == NULL) {
+            fitting = pool;
+        }
+        if (pool->free == NULL) {
+            continue;
+        }
+
+        _free_t *block = pool->free;
+
+        pool->free = block->next;
+        pool->refs[_block_idx(pool, block)] = 1;
+        pool->requested += size;
+        if (++pool->used > pool->max_used) {
+            pool->max_used = pool->used;
+        }
+        if (pool != fitting) {
+            fitting->fallbacks++;
+        }
+        return block;
+    }
+
+    if (fitting) {
+        fitting->fails++;
+    }
+    DEBUG("pktbuf: no block left for %" PRIuSIZE " bytes\n", size);
+    return NULL;
+}
+
+void gnrc_pktbuf_free_internal(void *data, size_t size)
+{
+    _pool_t *pool = _pool_of(data);
+
+    if (pool == NULL) {
+        return;
+    }
+
+    unsigned idx = _block_idx(pool, data);
+
+    assert(pool->refs[idx] > 0);
+    pool->requested -= size;
+    if (--pool->refs[idx] == 0) {
+        _free_t *block = (_free_t *)(uintptr_t)_block(pool, idx);
+
+        block->next = pool->free;
+        pool->free = block;
+        pool->used--;
+    }
+}
+
+bool gnrc_pktbuf_contains(void *ptr)
+{
+    return _pool_of(ptr) != NULL;
+}
+
+void gnrc_pktbuf_init(void)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    for (unsigned i = 0; i < ARRAY_SIZE(_pools); i++) {
+        _pool_t *pool = &_pools[i];
+
+        pool->free = NULL;
+        /* push in reverse to hand out the blocks in address order */
+        for (unsigned j = pool->numof; j > 0; j--) {
+            _free_t *block = (_free_t *)(uintptr_t)_block(pool, j - 1);
+
+            block->next = pool->free;
+            pool->free = block;
+        }
+        memset(pool->refs, 0, pool->numof);
+        pool->used = 0;
+        pool->max_used = 0;
+        pool->requested = 0;
+        pool->fallbacks = 0;
+        pool->fails = 0;
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+}
+
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt = _pktbuf_alloc(sizeof(gnrc_pktsnip_t));
+    void *_data = NULL;
+
+    if (pkt == NULL) {
+        DEBUG("pktbuf: error allocating new packet snip\n");
+        return NULL;
+    }
+    if (size > 0) {
+        _data = _pktbuf_alloc(size);
+        if (_data == NULL) {
+            DEBUG("pktbuf: error allocating data for new packet snip\n");
+            gnrc_pktbuf_free_internal(pkt, sizeof(gnrc_pktsnip_t));
+            return NULL;
+        }
+        if (data != NULL) {
+            memcpy(_data, data, size);
+        }
+    }
+    _set_pktsnip(pkt, next, _data, size, type);
+    return pkt;
+}
+
+static gnrc_pktsnip_t *_claim_headroom(gnrc_pktsnip_t *next, const void *data,
+                                       size_t size, gnrc_nettype_t type)
+{
+#ifdef MODULE_GNRC_PKT_HEADROOM
+    gnrc_pktsnip_t *pkt;
+    _pool_t *pool;
+
+    if ((next == NULL) || (next->users != 1) || (size == 0) ||
+        (size > next->headroom) ||
+        ((pool = _pool_of(next->data)) == NULL)) {
+        return NULL;
+    }
+    pkt = _pktbuf_alloc(sizeof(gnrc_pktsnip_t));
+    if (pkt == NULL) {
+        return NULL;
+    }
+    /* both snips share the block of the data now */
+    assert(pool->refs[_block_idx(pool, next->data)] < UINT8_MAX);
+    pool->refs[_block_idx(pool, next->data)]++;
+    _set_pktsnip(pkt, next, ((uint8_t *)next->data) - size, size, type);
+    pkt->headroom = next->headroom - size;
+    next->headroom = 0;
+    if (data != NULL) {
+        memcpy(pkt->data, data, size);
+    }
+    return pkt;
+#else
+    (void)next;
+    (void)data;
+    (void)size;
+    (void)type;
+    return NULL;
+#endif
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt;
+
+    if (size > LARGE_SIZE) {
+        DEBUG("pktbuf: size (%" PRIuSIZE ") > CONFIG_GNRC_PKTBUF_POOL_LARGE_SIZE (%u)\n",
+              size, (unsigned)LARGE_SIZE);
+        return NULL;
+    }
+    mutex_lock(&gnrc_pktbuf_mutex);
+    pkt = _claim_headroom(next, data, size, type);
+    if (pkt == NULL) {
+        pkt = _create_snip(next, data, size, type);
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return pkt;
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *marked_snip;
+
+    assert((pkt == NULL) || (gnrc_pktbuf_ext(pkt) == NULL));
+    mutex_lock(&gnrc_pktbuf_mutex);
+    if ((size == 0) || (pkt == NULL) || (size > pkt->size) || (pkt->data == NULL)) {
+        DEBUG("pktbuf: size == 0 (was %" PRIuSIZE ") or pkt == NULL (was %p) or "
+              "size > pkt->size (was %" PRIuSIZE ") or pkt->data == NULL (was %p)\n",
+              size, (void *)pkt, (pkt ? pkt->size : 0),
+              (pkt ? pkt->data : NULL));
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return NULL;
+    }
+    /* create new snip descriptor for marked data */
+    marked_snip = _pktbuf_alloc(sizeof(gnrc_pktsnip_t));
+    if (marked_snip == NULL) {
+        DEBUG("pktbuf: could not reallocate marked section.\n");
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return NULL;
+    }
+    _set_pktsnip(marked_snip, pkt->next, pkt->data, size, type);
+    /* the headroom is in front of the marked data */
+    gnrc_pktbuf_set_headroom(marked_snip, gnrc_pktbuf_headroom(pkt));
+    gnrc_pktbuf_set_headroom(pkt, 0);
+    if (pkt->size == size) {
+        pkt->data = NULL;
+    }
+    else {
+        /* both snips share the block of the data now */
+        _pool_t *pool = _pool_of(pkt->data);
+
+        if (pool) {
+            assert(pool->refs[_block_idx(pool, pkt->data)] < UINT8_MAX);
+            pool->refs[_block_idx(pool, pkt->data)]++;
+        }
+        pkt->data = ((uint8_t *)pkt->data) + size;
+    }
+    pkt->size -= size;
+    pkt->next = marked_snip;
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return marked_snip;
+}
+
+int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    assert(pkt != NULL);
+    assert(gnrc_pktbuf_ext(pkt) == NULL);
+    assert(((pkt->size == 0) && (pkt->data == NULL)) ||
+           ((pkt->size > 0) && (pkt->data != NULL) && gnrc_pktbuf_contains(pkt->data)));
+
+    _pool_t *pool = _pool_of(pkt->data);
+    unsigned idx = pool ? _block_idx(pool, pkt->data) : 0;
+    size_t headroom = gnrc_pktbuf_headroom(pkt);
+
+    if (size == pkt->size) {
+        /* nothing to do */
+    }
+    else if (size == 0) {
+        gnrc_pktbuf_free_internal(gnrc_pktbuf_buffer(pkt), headroom + pkt->size);
+        gnrc_pktbuf_set_headroom(pkt, 0);
+        pkt->data = NULL;
+    }
+    else if (pool && ((size < pkt->size) ||
+                      ((pool->refs[idx] == 1) &&
+                       (((uint8_t *)pkt->data + size) <= _block(pool, idx + 1))))) {
+        /* shrink, or grow within a block that is not shared */
+        pool->requested += size;
+        pool->requested -= pkt->size;
+    }
+    else {
+        void *new_data = _pktbuf_alloc(size);
+
+        if (new_data == NULL) {
+            DEBUG("pktbuf: error allocating new data section\n");
+            mutex_unlock(&gnrc_pktbuf_mutex);
+            return ENOMEM;
+        }
+        if (pkt->data != NULL) {
+            memcpy(new_data, pkt->data, (pkt->size < size) ? pkt->size : size);
+            gnrc_pktbuf_free_internal(gnrc_pktbuf_buffer(pkt), headroom + pkt->size);
+        }
+        gnrc_pktbuf_set_headroom(pkt, 0);
+        pkt->data = new_data;
+    }
+    pkt->size = size;
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return 0;
+}
+
+void gnrc_pktbuf_hold(gnrc_pktsnip_t *pkt, unsigned int num)
+{
+    while (pkt) {
+        gnrc_pktbuf_users_add(pkt, num);
+        pkt = pkt->next;
+    }
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt)
+{
+    if ((pkt == NULL) || (gnrc_pktbuf_users(pkt) == 1)) {
+        /* no one else can take a reference to a snip with a single user */
+        return pkt;
+    }
+
+    gnrc_pktsnip_t *new;
+
+    mutex_lock(&gnrc_pktbuf_mutex);
+    new = _create_snip(pkt->next, pkt->data, pkt->size, pkt->type);
+    if ((new != NULL) && (gnrc_pktbuf_users_dec(pkt) == 1)) {
+        /* all other users released pkt meanwhile, so keep it instead */
+        gnrc_pktbuf_users_add(pkt, 1);
+        gnrc_pktbuf_free_internal(new->data, new->size);
+        gnrc_pktbuf_free_internal(new, sizeof(gnrc_pktsnip_t));
+        new = pkt;
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return new;
+}
+
+#ifdef DEVELHELP
+void gnrc_pktbuf_stats(void)
+{
+    static const char *names[] = { "snip", "small", "large" };
+
+    mutex_lock(&gnrc_pktbuf_mutex);
+    printf("%-6s %5s %5s %5s %5s %9s %9s %6s\n", "class", "size", "used", "max",
+           "total", "fragment.", "fallbacks", "fails");
+    for (unsigned i = 0; i < ARRAY_SIZE(_pools); i++) {
+        const _pool_t *pool = &_pools[i];
+        uint32_t reserved = (uint32_t)pool->used * pool->block_size;
+        /* share of the used blocks that is not requested */
+        unsigned frag = reserved ? 100 - (pool->requested * 100) / reserved : 0;
+
+        printf("%-6s %5u %5u %5u %5u %8u%% %9" PRIu32 " %6" PRIu32 "\n",
+               names[i], pool->block_size, pool->used, pool->max_used,
+               pool->numof, frag, pool->fallbacks, pool->fails);
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    gnrc_pktbuf_quota_stats();
+}
+#endif
+
+#ifdef TEST_SUITES
+bool gnrc_pktbuf_is_empty(void)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_pools); i++) {
+        if (_pools[i].used) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool gnrc_pktbuf_is_sane(void)
+{
+    /* Invariants of this implementation:
+     *  - every free block is the start of a block of its pool, with no
+     *    references, and is listed once
+     *  - free blocks + used blocks == number of blocks */
+    for (unsigned i = 0; i < ARRAY_SIZE(_pools); i++) {
+        const _pool_t *pool = &_pools[i];
+        unsigned numof_free = 0;
+
+        for (_free_t *ptr = pool->free; ptr; ptr = ptr->next) {
+            if ((_pool_of(ptr) != pool) ||
+                (((uintptr_t)ptr - (uintptr_t)pool->buf) % pool->block_size) ||
+                pool->refs[_block_idx(pool, ptr)] ||
+                (++numof_free > pool->numof)) {
+                return false;
+            }
+        }
+        if (numof_free + pool->used != pool->numof) {
+            return false;
+        }
+    }
+    return true;
+}
+#endif
+
+/** @} */
@@ -31,6 +31,7 @@
 #include "net/gnrc/nettype.h"
 #include "net/gnrc/pkt.h"
 #include "string_utils.h"
+#include "trace.h"
 
 #include "pktbuf_internal.h"
 #include "pktbuf_static.h"
@@ -61,6 +62,8 @@ static uint16_t max_byte_count = 0;
 static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
                                     gnrc_nettype_t type);
 static void *_pktbuf_alloc(size_t size);
+static gnrc_pktsnip_t *_claim_headroom(gnrc_pktsnip_t *next, const void *data,
+                                       size_t size, gnrc_nettype_t type);
 
 static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
                                 void *data, size_t size, gnrc_nettype_t type)
@@ -73,6 +76,9 @@ static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
 #ifdef MODULE_GNRC_NETERR
     pkt->err_sub = KERNEL_PID_UNDEF;
 #endif
+    gnrc_pktbuf_set_headroom(pkt, 0);
+    gnrc_pktbuf_clear_quota(pkt);
+    gnrc_pktbuf_clear_ext(pkt);
 }
 
 void gnrc_pktbuf_init(void)
@@ -100,7 +106,10 @@ gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t s
         return NULL;
     }
     mutex_lock(&gnrc_pktbuf_mutex);
-    pkt = _create_snip(next, data, size, type);
+    pkt = _claim_headroom(next, data, size, type);
+    if (pkt == NULL) {
+        pkt = _create_snip(next, data, size, type);
+    }
     mutex_unlock(&gnrc_pktbuf_mutex);
     return pkt;
 }
@@ -108,10 +117,10 @@ gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t s
 gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t type)
 {
     gnrc_pktsnip_t *marked_snip;
-    /* size required for chunk */
-    size_t required_new_size = _align(size);
+    size_t headroom, marked_headroom = 0;
     void *new_data_marked;
 
+    assert((pkt == NULL) || (gnrc_pktbuf_ext(pkt) == NULL));
     mutex_lock(&gnrc_pktbuf_mutex);
     if ((size == 0) || (pkt == NULL) || (size > pkt->size) || (pkt->data == NULL)) {
         DEBUG("pktbuf: size == 0 (was %" PRIuSIZE ") or pkt == NULL (was %p) or "
@@ -121,6 +130,7 @@ gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_
         mutex_unlock(&gnrc_pktbuf_mutex);
         return NULL;
     }
+    headroom = gnrc_pktbuf_headroom(pkt);
     /* create new snip descriptor for marked data */
     marked_snip = _pktbuf_alloc(sizeof(gnrc_pktsnip_t));
     if (marked_snip == NULL) {
@@ -130,8 +140,7 @@ gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_
     }
     /* marked data would not fit _unused_t marker => move data around to allow
      * for proper free */
-    if ((pkt->size != size) && (size < required_new_size)) {
-        void *new_data_rest;
+    if ((pkt->size != size) && ((headroom + size) < _align(headroom + size))) {
         new_data_marked = _pktbuf_alloc(size);
         if (new_data_marked == NULL) {
             DEBUG("pktbuf: could not reallocate marked section.\n");
@@ -139,7 +148,14 @@ gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_
             mutex_unlock(&gnrc_pktbuf_mutex);
             return NULL;
         }
-        new_data_rest = _pktbuf_alloc(pkt->size - size);
+        memcpy(new_data_marked, pkt->data, size);
+#ifdef MODULE_GNRC_PKT_HEADROOM
+        /* the remaining data keep the buffer, so only the marked data are
+         * copied and the marked bytes become headroom */
+        pkt->data = ((uint8_t *)pkt->data) + size;
+        pkt->headroom += size;
+#else
+        void *new_data_rest = _pktbuf_alloc(pkt->size - size);
         if (new_data_rest == NULL) {
             DEBUG("pktbuf: could not reallocate remaining section.\n");
             gnrc_pktbuf_free_internal(marked_snip, sizeof(gnrc_pktsnip_t));
@@ -147,20 +163,23 @@ gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_
             mutex_unlock(&gnrc_pktbuf_mutex);
             return NULL;
         }
-        memcpy(new_data_marked, pkt->data, size);
         memcpy(new_data_rest, ((uint8_t *)pkt->data) + size, pkt->size - size);
         gnrc_pktbuf_free_internal(pkt->data, pkt->size);
-        marked_snip->data = new_data_marked;
         pkt->data = new_data_rest;
+#endif
     }
     else {
         new_data_marked = pkt->data;
+        /* the headroom is in front of the marked data */
+        marked_headroom = headroom;
+        gnrc_pktbuf_set_headroom(pkt, 0);
         /* if (pkt->size - size) != 0 take remainder of data, otherwise set NULL */
         pkt->data = (pkt->size != size) ? (((uint8_t *)pkt->data) + size) :
                                           NULL;
     }
     pkt->size -= size;
     _set_pktsnip(marked_snip, pkt->next, new_data_marked, size, type);
+    gnrc_pktbuf_set_headroom(marked_snip, marked_headroom);
     pkt->next = marked_snip;
     mutex_unlock(&gnrc_pktbuf_mutex);
     return marked_snip;
@@ -168,12 +187,17 @@ gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_
 
 int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
 {
-    size_t aligned_size = _align(size);
-
     mutex_lock(&gnrc_pktbuf_mutex);
     assert(pkt != NULL);
+    assert(gnrc_pktbuf_ext(pkt) == NULL);
     assert(((pkt->size == 0) && (pkt->data == NULL)) ||
            ((pkt->size > 0) && (pkt->data != NULL) && gnrc_pktbuf_contains(pkt->data)));
+
+    size_t headroom = gnrc_pktbuf_headroom(pkt);
+    /* sizes of the buffer, including the headroom */
+    size_t aligned_size = _align(headroom + size);
+    size_t buf_size = headroom + pkt->size;
+
     /* new size and old size are equal */
     if (size == pkt->size) {
         /* nothing to do */
@@ -183,7 +207,8 @@ int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
     /* new size is 0 and data pointer isn't already NULL */
     if ((size == 0) && (pkt->data != NULL)) {
         /* set data pointer to NULL */
-        gnrc_pktbuf_free_internal(pkt->data, pkt->size);
+        gnrc_pktbuf_free_internal(gnrc_pktbuf_buffer(pkt), buf_size);
+        gnrc_pktbuf_set_headroom(pkt, 0);
         pkt->data = NULL;
     }
     /* if new size is bigger than old size */
@@ -196,13 +221,14 @@ int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
         }
         if (pkt->data != NULL) {            /* if old data exist */
             memcpy(new_data, pkt->data, (pkt->size < size) ? pkt->size : size);
+            gnrc_pktbuf_free_internal(gnrc_pktbuf_buffer(pkt), buf_size);
         }
-        gnrc_pktbuf_free_internal(pkt->data, pkt->size);
+        gnrc_pktbuf_set_headroom(pkt, 0);
         pkt->data = new_data;
     }
-    else if (_align(pkt->size) > aligned_size) {
-        gnrc_pktbuf_free_internal(((uint8_t *)pkt->data) + aligned_size,
-                     pkt->size - aligned_size);
+    else if (_align(buf_size) > aligned_size) {
+        gnrc_pktbuf_free_internal(((uint8_t *)gnrc_pktbuf_buffer(pkt)) + aligned_size,
+                                  buf_size - aligned_size);
     }
     pkt->size = size;
     mutex_unlock(&gnrc_pktbuf_mutex);
@@ -211,32 +237,32 @@ int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
 
 void gnrc_pktbuf_hold(gnrc_pktsnip_t *pkt, unsigned int num)
 {
-    mutex_lock(&gnrc_pktbuf_mutex);
     while (pkt) {
-        pkt->users += num;
+        gnrc_pktbuf_users_add(pkt, num);
         pkt = pkt->next;
     }
-    mutex_unlock(&gnrc_pktbuf_mutex);
 }
 
 gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt)
 {
-    mutex_lock(&gnrc_pktbuf_mutex);
-    if (pkt == NULL) {
-        mutex_unlock(&gnrc_pktbuf_mutex);
-        return NULL;
+    if ((pkt == NULL) || (gnrc_pktbuf_users(pkt) == 1)) {
+        /* no one else can take a reference to a snip with a single user */
+        return pkt;
     }
-    if (pkt->users > 1) {
-        gnrc_pktsnip_t *new;
-        new = _create_snip(pkt->next, pkt->data, pkt->size, pkt->type);
-        if (new != NULL) {
-            pkt->users--;
-        }
-        mutex_unlock(&gnrc_pktbuf_mutex);
-        return new;
+
+    gnrc_pktsnip_t *new;
+
+    mutex_lock(&gnrc_pktbuf_mutex);
+    new = _create_snip(pkt->next, pkt->data, pkt->size, pkt->type);
+    if ((new != NULL) && (gnrc_pktbuf_users_dec(pkt) == 1)) {
+        /* all other users released pkt meanwhile, so keep it instead */
+        gnrc_pktbuf_users_add(pkt, 1);
+        gnrc_pktbuf_free_internal(new->data, new->size);
+        gnrc_pktbuf_free_internal(new, sizeof(gnrc_pktsnip_t));
+        new = pkt;
     }
     mutex_unlock(&gnrc_pktbuf_mutex);
-    return pkt;
+    return new;
 }
 
 #ifdef DEVELHELP
@@ -309,6 +335,7 @@ void gnrc_pktbuf_stats(void)
 #else
     DEBUG("pktbuf: needs od module\n");
 #endif
+    gnrc_pktbuf_quota_stats();
 }
 #endif
 
@@ -379,6 +406,38 @@ static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size
     return pkt;
 }
 
+static gnrc_pktsnip_t *_claim_headroom(gnrc_pktsnip_t *next, const void *data,
+                                       size_t size, gnrc_nettype_t type)
+{
+#ifdef MODULE_GNRC_PKT_HEADROOM
+    gnrc_pktsnip_t *pkt;
+
+    /* the headroom is freed together with the new snip, so it has to end at
+     * an aligned boundary to not free the beginning of next */
+    if ((next == NULL) || (next->users != 1) || (size == 0) ||
+        (size > next->headroom) || (_align(next->headroom) != next->headroom)) {
+        return NULL;
+    }
+    pkt = _pktbuf_alloc(sizeof(gnrc_pktsnip_t));
+    if (pkt == NULL) {
+        return NULL;
+    }
+    _set_pktsnip(pkt, next, ((uint8_t *)next->data) - size, size, type);
+    pkt->headroom = next->headroom - size;
+    next->headroom = 0;
+    if (data != NULL) {
+        memcpy(pkt->data, data, size);
+    }
+    return pkt;
+#else
+    (void)next;
+    (void)data;
+    (void)size;
+    (void)type;
+    return NULL;
+#endif
+}
+
 static void *_pktbuf_alloc(size_t size)
 {
     _unused_t *prev = NULL, *ptr = _first_unused;
@@ -439,6 +498,8 @@ static void *_pktbuf_alloc(size_t size)
         assert(0);
     }
 
+    trace_event(TRACE_EVENT_PKTBUF_ALLOC, size);
+
     return (void *)ptr;
 }
 
@@ -468,6 +529,8 @@ void gnrc_pktbuf_free_internal(void *data, size_t size)
         return;
     }
 
+    trace_event(TRACE_EVENT_PKTBUF_FREE, _align(size));
+
     if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
         memset(data, CANARY, _align(size));
     }
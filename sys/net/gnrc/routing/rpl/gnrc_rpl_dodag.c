@@ -288,6 +288,9 @@ void gnrc_rpl_parent_update(gnrc_rpl_dodag_t *dodag, gnrc_rpl_parent_t *parent)
     /* update Parent lifetime */
     if ((parent != NULL) && (parent->state != GNRC_RPL_PARENT_UNUSED)) {
         parent->state = GNRC_RPL_PARENT_ACTIVE;
+        if (dodag->instance->of->update_link_metric != NULL) {
+            dodag->instance->of->update_link_metric(parent);
+        }
         evtimer_del((evtimer_t *)(&gnrc_rpl_evtimer), (evtimer_event_t *)&parent->timeout_event);
         ((evtimer_event_t *)&(parent->timeout_event))->offset = (dodag->default_lifetime - 1) * dodag->lifetime_unit * MS_PER_SEC;
         parent->timeout_event.msg.type = GNRC_RPL_MSG_TYPE_PARENT_TIMEOUT;
@@ -313,6 +316,11 @@ void gnrc_rpl_parent_update(gnrc_rpl_dodag_t *dodag, gnrc_rpl_parent_t *parent)
 /**
  * @brief   Find the parent with the lowest rank and update the DODAG's preferred parent
  *
+ * Only the preferred parent is moved to the head of the parent list. The rank
+ * of this node is only updated when the preferred parent changed or when the
+ * DAGRank changed, so a fluctuating link metric does not reset the trickle
+ * timer on every DIO.
+ *
  * @param[in] dodag     Pointer to the DODAG
  *
  * @return  Pointer to the preferred parent, on success.
@@ -321,8 +329,9 @@ void gnrc_rpl_parent_update(gnrc_rpl_dodag_t *dodag, gnrc_rpl_parent_t *parent)
 static gnrc_rpl_parent_t *_gnrc_rpl_find_preferred_parent(gnrc_rpl_dodag_t *dodag)
 {
     gnrc_rpl_parent_t *old_best = dodag->parents;
-    gnrc_rpl_parent_t *new_best;
-    uint16_t old_rank = dodag->my_rank;
+    gnrc_rpl_parent_t *new_best = old_best;
+    uint16_t min_hop_rank_inc = dodag->instance->min_hop_rank_inc;
+    uint16_t new_rank;
     gnrc_rpl_parent_t *elt = NULL;
     gnrc_rpl_parent_t *tmp = NULL;
 
@@ -330,14 +339,21 @@ static gnrc_rpl_parent_t *_gnrc_rpl_find_preferred_parent(gnrc_rpl_dodag_t *doda
         return NULL;
     }
 
-    LL_SORT(dodag->parents, dodag->instance->of->parent_cmp);
-    new_best = dodag->parents;
+    /* the objective function compares with the current preferred parent at
+     * the head of the list, so do not reorder the list while searching */
+    LL_FOREACH(old_best->next, elt) {
+        if (dodag->instance->of->parent_cmp(elt, new_best) < 0) {
+            new_best = elt;
+        }
+    }
 
     if (new_best->rank == GNRC_RPL_INFINITE_RANK) {
         return NULL;
     }
 
     if (new_best != old_best) {
+        LL_DELETE(dodag->parents, new_best);
+        LL_PREPEND(dodag->parents, new_best);
         /* no-path DAOs only for the storing mode */
         if ((dodag->instance->mop == GNRC_RPL_MOP_STORING_MODE_NO_MC) ||
             (dodag->instance->mop == GNRC_RPL_MOP_STORING_MODE_MC)) {
@@ -357,15 +373,19 @@ static gnrc_rpl_parent_t *_gnrc_rpl_find_preferred_parent(gnrc_rpl_dodag_t *doda
 
     }
 
-    dodag->my_rank = dodag->instance->of->calc_rank(dodag, 0);
-    if (dodag->my_rank != old_rank) {
+    new_rank = dodag->instance->of->calc_rank(dodag, 0);
+    if ((new_rank != dodag->my_rank) &&
+        ((new_best != old_best) || (dodag->my_rank == GNRC_RPL_INFINITE_RANK) ||
+         (DAGRANK(new_rank, min_hop_rank_inc) !=
+          DAGRANK(dodag->my_rank, min_hop_rank_inc)))) {
+        dodag->my_rank = new_rank;
         trickle_reset_timer(&dodag->trickle);
         gnrc_rpl_rpble_update(dodag);
     }
 
     LL_FOREACH_SAFE(dodag->parents, elt, tmp) {
-        if (DAGRANK(dodag->my_rank, dodag->instance->min_hop_rank_inc)
-            <= DAGRANK(elt->rank, dodag->instance->min_hop_rank_inc)) {
+        if (DAGRANK(dodag->my_rank, min_hop_rank_inc)
+            <= DAGRANK(elt->rank, min_hop_rank_inc)) {
             gnrc_rpl_parent_remove(elt);
         }
     }
@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc_rpl
+ * @{
+ * @file
+ * @brief       Minimum Rank with Hysteresis Objective Function.
+ *
+ * Implementation of MRHOF as in RFC 6719 with the ETX of the links to the
+ * parents as measured by `netstats_neighbor_etx`. The ETX is given in units of
+ * @ref NETSTATS_NB_ETX_DIVISOR, which matches the units of RFC 6719, and an
+ * ETX of 1 is mapped to a rank increase of the MinHopRankIncrease of the
+ * instance.
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ * @}
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "mrhof.h"
+#include "net/gnrc/ipv6/nib/nc.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/netif/internal.h"
+#include "net/gnrc/rpl.h"
+#include "net/gnrc/rpl/structs.h"
+#include "net/netstats.h"
+#include "net/netstats/neighbor.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static uint16_t calc_rank(gnrc_rpl_dodag_t *, uint16_t);
+static int parent_cmp(gnrc_rpl_parent_t *, gnrc_rpl_parent_t *);
+static gnrc_rpl_dodag_t *which_dodag(gnrc_rpl_dodag_t *, gnrc_rpl_dodag_t *);
+static void reset(gnrc_rpl_dodag_t *);
+static void update_link_metric(gnrc_rpl_parent_t *);
+
+static gnrc_rpl_of_t gnrc_rpl_mrhof = {
+    .ocp          = GNRC_RPL_OCP_MRHOF,
+    .calc_rank    = calc_rank,
+    .parent_cmp   = parent_cmp,
+    .which_dodag  = which_dodag,
+    .reset        = reset,
+    .update_link_metric = update_link_metric,
+    .parent_state_callback = NULL,
+    .init         = NULL,
+    .process_dio  = NULL
+};
+
+gnrc_rpl_of_t *gnrc_rpl_get_of_mrhof(void)
+{
+    return &gnrc_rpl_mrhof;
+}
+
+void reset(gnrc_rpl_dodag_t *dodag)
+{
+    /* Nothing to do in MRHOF, the link metrics are kept per parent */
+    (void) dodag;
+}
+
+static int _parent_l2addr(gnrc_rpl_parent_t *parent, gnrc_netif_t *netif,
+                          uint8_t *l2addr)
+{
+    void *state = NULL;
+    gnrc_ipv6_nib_nc_t nce;
+
+    while (gnrc_ipv6_nib_nc_iter(netif->pid, &state, &nce)) {
+        if (ipv6_addr_equal(&nce.ipv6, &parent->addr) && (nce.l2addr_len > 0)) {
+            memcpy(l2addr, nce.l2addr, nce.l2addr_len);
+            return nce.l2addr_len;
+        }
+    }
+    /* no neighbor cache entry (yet), but link-local addresses of parents are
+     * usually derived from the L2 address */
+    if (!(netif->flags & GNRC_NETIF_FLAGS_HAS_L2ADDR)) {
+        return -ENOTSUP;
+    }
+    return gnrc_netif_ipv6_iid_to_addr(netif, (eui64_t *)&parent->addr.u64[1],
+                                       l2addr);
+}
+
+void update_link_metric(gnrc_rpl_parent_t *parent)
+{
+    gnrc_netif_t *netif = gnrc_netif_get_by_pid(parent->dodag->iface);
+    uint8_t l2addr[GNRC_NETIF_L2ADDR_MAXLEN];
+    netstats_nb_t stats;
+    int l2addr_len;
+
+    /* assume a mediocre link until the first unicast to the parent */
+    parent->link_metric = NETSTATS_NB_ETX_INIT * NETSTATS_NB_ETX_DIVISOR;
+    if ((netif == NULL) ||
+        ((l2addr_len = _parent_l2addr(parent, netif, l2addr)) <= 0)) {
+        return;
+    }
+    if (netstats_nb_get(&netif->netif, l2addr, l2addr_len, &stats)) {
+        parent->link_metric = stats.etx;
+    }
+    DEBUG("RPL: MRHOF link metric %u\n", parent->link_metric);
+}
+
+/* path cost through a parent in rank units, GNRC_RPL_INFINITE_RANK if the
+ * parent can not be used (see RFC 6719, section 3.2) */
+static uint16_t _path_cost(gnrc_rpl_parent_t *parent)
+{
+    uint16_t min_hop_rank_inc = parent->dodag->instance->min_hop_rank_inc;
+    uint32_t link_cost;
+
+    if ((parent->rank == GNRC_RPL_INFINITE_RANK) ||
+        (parent->link_metric > CONFIG_GNRC_RPL_MRHOF_MAX_LINK_METRIC)) {
+        return GNRC_RPL_INFINITE_RANK;
+    }
+    link_cost = ((uint32_t)parent->link_metric * min_hop_rank_inc) /
+                NETSTATS_NB_ETX_DIVISOR;
+    /* the rank has to increase by at least MinHopRankIncrease */
+    if (link_cost < min_hop_rank_inc) {
+        link_cost = min_hop_rank_inc;
+    }
+    if ((parent->rank + link_cost) >= GNRC_RPL_INFINITE_RANK) {
+        return GNRC_RPL_INFINITE_RANK;
+    }
+    return parent->rank + link_cost;
+}
+
+uint16_t calc_rank(gnrc_rpl_dodag_t *dodag, uint16_t base_rank)
+{
+    if (base_rank == 0) {
+        if (dodag->parents == NULL) {
+            return GNRC_RPL_INFINITE_RANK;
+        }
+        return _path_cost(dodag->parents);
+    }
+
+    /* no link to derive a metric from */
+    if ((uint16_t)(base_rank + dodag->instance->min_hop_rank_inc) < base_rank) {
+        return GNRC_RPL_INFINITE_RANK;
+    }
+    return base_rank + dodag->instance->min_hop_rank_inc;
+}
+
+/* The preferred parent is at the head of the parent list of the DODAG and is
+ * kept unless another parent offers a path cost that is lower by more than
+ * PARENT_SWITCH_THRESHOLD (see RFC 6719, section 3.2.2) */
+int parent_cmp(gnrc_rpl_parent_t *parent1, gnrc_rpl_parent_t *parent2)
+{
+    uint32_t cost1 = _path_cost(parent1);
+    uint32_t cost2 = _path_cost(parent2);
+    uint32_t threshold = ((uint32_t)CONFIG_GNRC_RPL_MRHOF_PARENT_SWITCH_THRESHOLD *
+                          parent1->dodag->instance->min_hop_rank_inc) /
+                         NETSTATS_NB_ETX_DIVISOR;
+
+    if ((parent1 == parent1->dodag->parents) &&
+        (cost1 != GNRC_RPL_INFINITE_RANK)) {
+        cost2 += threshold;
+    }
+    else if ((parent2 == parent2->dodag->parents) &&
+             (cost2 != GNRC_RPL_INFINITE_RANK)) {
+        cost1 += threshold;
+    }
+    if (cost1 < cost2) {
+        return -1;
+    }
+    else if (cost1 > cost2) {
+        return 1;
+    }
+    return 0;
+}
+
+/* Not used yet */
+gnrc_rpl_dodag_t *which_dodag(gnrc_rpl_dodag_t *d1, gnrc_rpl_dodag_t *d2)
+{
+    (void) d2;
+    return d1;
+}
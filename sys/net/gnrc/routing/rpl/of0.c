@@ -34,6 +34,7 @@ static gnrc_rpl_of_t gnrc_rpl_of0 = {
     .parent_cmp   = parent_cmp,
     .which_dodag  = which_dodag,
     .reset        = reset,
+    .update_link_metric = NULL,
     .parent_state_callback = NULL,
     .init         = NULL,
     .process_dio  = NULL
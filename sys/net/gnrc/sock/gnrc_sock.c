@@ -23,6 +23,7 @@
 #include "net/af.h"
 #include "net/gnrc/ipv6.h"
 #include "net/gnrc/ipv6/hdr.h"
+#include "net/gnrc/netif.h"
 #include "net/gnrc/netreg.h"
 #include "net/gnrc/tx_sync.h"
 #include "net/ipv6/hdr.h"
@@ -39,6 +40,8 @@
 #include "gnrc_sock_internal.h"
 
 #ifdef MODULE_FUZZING
+#include "fuzzing.h"
+
 extern gnrc_pktsnip_t *gnrc_pktbuf_fuzzptr;
 gnrc_pktsnip_t *gnrc_sock_prevpkt = NULL;
 #endif
@@ -61,7 +64,7 @@ static void _callback_put(void *arg)
 #endif
 
 #ifdef SOCK_HAS_ASYNC
-static void _netapi_cb(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
+void gnrc_sock_netapi_cb(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
 {
     if (cmd == GNRC_NETAPI_MSG_TYPE_RCV) {
         msg_t msg = { .type = GNRC_NETAPI_MSG_TYPE_RCV,
@@ -87,7 +90,7 @@ void gnrc_sock_create(gnrc_sock_reg_t *reg, gnrc_nettype_t type, uint32_t demux_
     mbox_init(&reg->mbox, reg->mbox_queue, GNRC_SOCK_MBOX_SIZE);
 #ifdef SOCK_HAS_ASYNC
     reg->async_cb.generic = NULL;
-    reg->netreg_cb.cb = _netapi_cb;
+    reg->netreg_cb.cb = gnrc_sock_netapi_cb;
     reg->netreg_cb.ctx = reg;
     gnrc_netreg_entry_init_cb(&reg->entry, demux_ctx, &reg->netreg_cb);
 #else   /* SOCK_HAS_ASYNC */
@@ -109,12 +112,13 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
      * application from the fuzzing/ subdirectory. When using gnrc_sock
      * the fuzzer assumes that gnrc_sock_recv is called in a loop. If it
      * is called again and the previous return value was the special
-     * crafted fuzzing packet, the fuzzing application terminates.
+     * crafted fuzzing packet, input processing has completed.
      *
      * sock_async_event has its on fuzzing termination condition. */
 #if defined(MODULE_FUZZING) && !defined(MODULE_SOCK_ASYNC_EVENT)
     if (gnrc_sock_prevpkt && gnrc_sock_prevpkt == gnrc_pktbuf_fuzzptr) {
-        exit(EXIT_SUCCESS);
+        gnrc_sock_prevpkt = NULL;
+        fuzzing_done();
     }
 #endif
 
@@ -178,6 +182,7 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
     switch (msg.type) {
         case GNRC_NETAPI_MSG_TYPE_RCV:
             pkt = msg.content.ptr;
+            gnrc_netif_latency_record(pkt, NETSTATS_LATENCY_SOCK);
             break;
 #if IS_USED(MODULE_XTIMER) || IS_USED(MODULE_ZTIMER_USEC) || IS_USED(MODULE_ZTIMER_MSEC)
         case _TIMEOUT_MSG_TYPE:
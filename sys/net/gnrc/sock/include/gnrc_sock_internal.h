@@ -63,6 +63,34 @@ extern "C" {
 #define CONFIG_GNRC_SOCK_UDP_CHECK_REMOTE_ADDR (1)
 #endif
 
+/**
+ * @brief   Headroom reserved in front of the payload of a UDP packet to send
+ *
+ * The UDP and IPv6 headers are put into this headroom instead of being
+ * allocated separately, see @ref gnrc_pktbuf_add(). `gnrc_pktbuf_static` can
+ * only put a header there if the headroom left behind it is a multiple of its
+ * alignment (8 bytes on 32-bit platforms).
+ */
+#ifndef CONFIG_GNRC_SOCK_UDP_TX_HEADROOM
+#if IS_USED(MODULE_GNRC_PKT_HEADROOM)
+#define CONFIG_GNRC_SOCK_UDP_TX_HEADROOM (sizeof(udp_hdr_t) + sizeof(ipv6_hdr_t))
+#else
+#define CONFIG_GNRC_SOCK_UDP_TX_HEADROOM (0U)
+#endif
+#endif
+
+/**
+ * @brief   Minimum length of an element of the iolist given to
+ *          @ref sock_udp_sendv() to be referenced instead of copied
+ *
+ * Only used with `gnrc_pkt_ext`. Shorter elements, e.g. headers of the
+ * application protocol, are cheaper to copy than to describe by a packet snip
+ * of their own.
+ */
+#ifndef CONFIG_GNRC_SOCK_UDP_TX_EXT_MIN
+#define CONFIG_GNRC_SOCK_UDP_TX_EXT_MIN (32U)
+#endif
+
 /**
  * @brief   Structure to retrieve auxiliary data from @ref gnrc_sock_recv
  *
@@ -151,6 +179,17 @@ static inline void gnrc_ep_set(sock_ip_ep_t *out, const sock_ip_ep_t *in,
  */
 void gnrc_sock_create(gnrc_sock_reg_t *reg, gnrc_nettype_t type, uint32_t demux_ctx);
 
+#if defined(SOCK_HAS_ASYNC) || defined(DOXYGEN)
+/**
+ * @brief   netreg callback of a sock created with gnrc_sock_create()
+ * @internal
+ *
+ * Puts received packets into the mailbox of the sock `ctx` and calls its
+ * asynchronous callback.
+ */
+void gnrc_sock_netapi_cb(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx);
+#endif
+
 /**
  * @brief   Receive a packet internally
  * @internal
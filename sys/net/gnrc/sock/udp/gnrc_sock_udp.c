@@ -20,6 +20,8 @@
 #include <string.h>
 
 #include "byteorder.h"
+#include "container.h"
+#include "mutex.h"
 #include "net/af.h"
 #include "net/protnum.h"
 #include "net/gnrc/ipv6.h"
@@ -66,6 +68,70 @@ static bool _dyn_port_used(uint16_t port)
     return false;
 }
 
+#if IS_USED(MODULE_GNRC_SOCK_UDP_REUSE_PORT)
+static bool _reuse_port(uint16_t flags)
+{
+    return ((flags & SOCK_FLAGS_REUSE_PORT) == SOCK_FLAGS_REUSE_PORT) &&
+           !(flags & SOCK_FLAGS_CONNECT_REMOTE);
+}
+
+static uint32_t _flow_hash(gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *ipv6 = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_IPV6);
+    gnrc_pktsnip_t *udp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_UDP);
+    uint32_t hash = 0;
+
+    if (ipv6 != NULL) {
+        ipv6_hdr_t *hdr = ipv6->data;
+
+        for (unsigned i = 0; i < ARRAY_SIZE(hdr->src.u32); i++) {
+            hash ^= hdr->src.u32[i].u32;
+        }
+    }
+    if (udp != NULL) {
+        udp_hdr_t *hdr = udp->data;
+
+        hash ^= hdr->src_port.u16;
+    }
+    hash ^= hash >> 16;
+    hash ^= hash >> 8;
+    return hash;
+}
+
+/**
+ * @brief   netreg callback of socks created with SOCK_FLAGS_REUSE_PORT
+ *
+ * Every member of the group is called for a datagram, but only the one
+ * selected by the flow hash takes it.
+ */
+static void _reuse_port_cb(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
+{
+    gnrc_sock_reg_t *reg = ctx;
+    sock_udp_t *sock = container_of(reg, sock_udp_t, reg);
+
+    if (cmd == GNRC_NETAPI_MSG_TYPE_RCV) {
+        unsigned idx = 0, num = 0;
+
+        for (sock_udp_t *ptr = _udp_socks; ptr != NULL;
+             ptr = (sock_udp_t *)ptr->reg.next) {
+            if (ptr == sock) {
+                idx = num;
+            }
+            if (_reuse_port(ptr->flags) &&
+                (memcmp(&ptr->local, &sock->local, sizeof(sock->local)) == 0)) {
+                num++;
+            }
+        }
+        if ((num > 1) && ((_flow_hash(pkt) % num) != idx)) {
+            DEBUG("gnrc_sock_udp: datagram steered to another sock\n");
+            gnrc_pktbuf_release(pkt);
+            return;
+        }
+    }
+    gnrc_sock_netapi_cb(cmd, pkt, ctx);
+}
+#endif /* MODULE_GNRC_SOCK_UDP_REUSE_PORT */
+
 /**
  * @brief   returns a UDP port, and checks for reuse if required
  *
@@ -146,6 +212,11 @@ int sock_udp_create(sock_udp_t *sock, const sock_udp_ep_t *local,
     if (local != NULL) {
         /* listen only with local given */
         gnrc_sock_create(&sock->reg, GNRC_NETTYPE_UDP, sock->local.port);
+#if IS_USED(MODULE_GNRC_SOCK_UDP_REUSE_PORT)
+        if (_reuse_port(flags)) {
+            sock->reg.netreg_cb.cb = _reuse_port_cb;
+        }
+#endif
     }
     sock->flags = flags;
     return 0;
@@ -159,6 +230,7 @@ void sock_udp_close(sock_udp_t *sock)
     if (_udp_socks != NULL) {
         gnrc_sock_reg_t *head = (gnrc_sock_reg_t *)_udp_socks;
         LL_DELETE(head, (gnrc_sock_reg_t *)sock);
+        _udp_socks = (sock_udp_t *)head;
     }
 #endif
 }
@@ -353,6 +425,84 @@ ssize_t sock_udp_recv_buf_aux(sock_udp_t *sock, void **data, void **buf_ctx,
     return res;
 }
 
+void sock_udp_buf_release(sock_udp_t *sock, void *buf_ctx)
+{
+    (void)sock;
+    assert(sock != NULL);
+    if (buf_ctx != NULL) {
+        gnrc_pktbuf_release(buf_ctx);
+    }
+}
+
+static gnrc_pktsnip_t *_payload_copy(const iolist_t *snips)
+{
+    /* allocate snip for payload, with room for the headers in front */
+    gnrc_pktsnip_t *payload = gnrc_pktbuf_add(NULL, NULL,
+                                              CONFIG_GNRC_SOCK_UDP_TX_HEADROOM +
+                                              iolist_size(snips),
+                                              GNRC_NETTYPE_UNDEF);
+
+    if (payload == NULL) {
+        return NULL;
+    }
+    if (gnrc_pktbuf_pull(payload, CONFIG_GNRC_SOCK_UDP_TX_HEADROOM) < 0) {
+        gnrc_pktbuf_release(payload);
+        return NULL;
+    }
+    /* copy payload data into payload snip */
+    iolist_to_buffer(snips, payload->data, payload->size);
+    return payload;
+}
+
+#if IS_USED(MODULE_GNRC_PKT_EXT)
+typedef struct {
+    gnrc_pktbuf_ext_t ext;
+    mutex_t released;
+} _ext_sync_t;
+
+static void _ext_released(gnrc_pktbuf_ext_t *ext)
+{
+    mutex_unlock(&container_of(ext, _ext_sync_t, ext)->released);
+}
+
+static bool _payload_has_ext(const iolist_t *snips)
+{
+    for (; snips != NULL; snips = snips->iol_next) {
+        if (snips->iol_len >= CONFIG_GNRC_SOCK_UDP_TX_EXT_MIN) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static gnrc_pktsnip_t *_payload_ext(const iolist_t *snips,
+                                    gnrc_pktbuf_ext_t *ext)
+{
+    gnrc_pktsnip_t *payload = NULL;
+    gnrc_pktsnip_t **tail = &payload;
+
+    for (; snips != NULL; snips = snips->iol_next) {
+        if (snips->iol_len >= CONFIG_GNRC_SOCK_UDP_TX_EXT_MIN) {
+            *tail = gnrc_pktbuf_add_ext(NULL, snips->iol_base, snips->iol_len,
+                                        GNRC_NETTYPE_UNDEF, ext);
+        }
+        else if (snips->iol_len > 0) {
+            *tail = gnrc_pktbuf_add(NULL, snips->iol_base, snips->iol_len,
+                                    GNRC_NETTYPE_UNDEF);
+        }
+        else {
+            continue;
+        }
+        if (*tail == NULL) {
+            gnrc_pktbuf_release(payload);
+            return NULL;
+        }
+        tail = &(*tail)->next;
+    }
+    return payload;
+}
+#endif
+
 ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
                            const iolist_t *snips,
                            const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
@@ -449,21 +599,33 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
         return -EINVAL;
     }
 
-    /* allocate snip for payload */
-    payload = gnrc_pktbuf_add(NULL, NULL, iolist_size(snips), GNRC_NETTYPE_UNDEF);
+#if IS_USED(MODULE_GNRC_PKT_EXT)
+    /* large elements of the payload are referenced instead of copied, so
+     * they must not be returned to the caller before the stack released
+     * them */
+    _ext_sync_t sync = { .ext = { .cb = _ext_released },
+                         .released = MUTEX_INIT_LOCKED };
+    bool ext = _payload_has_ext(snips);
+
+    payload = (ext) ? _payload_ext(snips, &sync.ext) : _payload_copy(snips);
+#else
+    payload = _payload_copy(snips);
+#endif
     if (payload == NULL) {
         return -ENOMEM;
     }
 
-    /* copy payload data into payload snip */
-    iolist_to_buffer(snips, payload->data, payload->size);
-
     pkt = gnrc_udp_hdr_build(payload, src_port, dst_port);
     if (pkt == NULL) {
         gnrc_pktbuf_release(payload);
         return -ENOMEM;
     }
     res = gnrc_sock_send(pkt, &local, rem, PROTNUM_UDP);
+#if IS_USED(MODULE_GNRC_PKT_EXT)
+    if (ext) {
+        mutex_lock(&sync.released);
+    }
+#endif
     if (res > 0) {
         res -= sizeof(udp_hdr_t);
     }
@@ -325,6 +325,19 @@ void gnrc_tcp_tcb_init(gnrc_tcp_tcb_t *tcb)
     TCP_DEBUG_LEAVE;
 }
 
+void gnrc_tcp_tcb_set_rcv_buf(gnrc_tcp_tcb_t *tcb, void *buf, size_t size)
+{
+    TCP_DEBUG_ENTER;
+    assert(tcb != NULL);
+    assert(tcb->state == FSM_STATE_CLOSED && tcb->rcv_buf_raw == NULL);
+    assert(buf != NULL);
+    assert(size > 0 && size <= UINT16_MAX);
+
+    tcb->rcv_buf_usr = buf;
+    tcb->rcv_buf_usr_size = size;
+    TCP_DEBUG_LEAVE;
+}
+
 void gnrc_tcp_tcb_queue_init(gnrc_tcp_tcb_queue_t *queue)
 {
     TCP_DEBUG_ENTER;
@@ -706,7 +719,7 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
     }
 
     /* Loop until something was sent and acked */
-    while (ret == 0 || tcb->pkt_retransmit != NULL) {
+    while (ret == 0 || tcb->pkt_retransmit[0] != NULL) {
         state = _gnrc_tcp_fsm_get_state(tcb);
 
         /* Check if the connections state is closed. If so, a reset was received */
@@ -733,6 +746,12 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
         if (ret == 0 && !probing_mode) {
             ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_SEND, NULL, (void *) data, len);
         }
+        /* Keep filling the send window while earlier segments are in flight */
+        else if ((CONFIG_GNRC_TCP_SND_SEGMENTS > 1) && (ret > 0) && ((size_t)ret < len) &&
+                 !probing_mode) {
+            ret += _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_SEND, NULL, (uint8_t *)data + ret,
+                                 len - ret);
+        }
 
         /* Wait for responses */
         mbox_get(&mbox, &msg);
@@ -17,11 +17,83 @@
  * @}
  */
 
+#include <assert.h>
+
+#include "net/af.h"
 #include "include/gnrc_tcp_common.h"
 
-static _gnrc_tcp_common_tcb_list_t _list = {NULL, MUTEX_INIT};
+#ifdef MODULE_GNRC_IPV6
+#include "net/ipv6/addr.h"
+#endif
+
+static _gnrc_tcp_common_tcb_list_t _list = { .head = NULL, .lock = MUTEX_INIT };
+
+#if CONFIG_GNRC_TCP_TCB_HASH_BUCKETS
+static_assert((CONFIG_GNRC_TCP_TCB_HASH_BUCKETS & (CONFIG_GNRC_TCP_TCB_HASH_BUCKETS - 1)) == 0,
+              "CONFIG_GNRC_TCP_TCB_HASH_BUCKETS must be a power of two");
+
+static gnrc_tcp_tcb_t **_bucket(uint16_t local_port, uint16_t peer_port)
+{
+    /* local ports of a server are all equal, the peer ports differ */
+    uint32_t hash = ((uint32_t)local_port << 16) ^ peer_port;
+
+    hash ^= hash >> 16;
+    hash ^= hash >> 8;
+    return &_list.hash[hash & (CONFIG_GNRC_TCP_TCB_HASH_BUCKETS - 1)];
+}
+
+void _gnrc_tcp_common_tcb_hash_add(gnrc_tcp_tcb_t *tcb)
+{
+    gnrc_tcp_tcb_t **head = _bucket(tcb->local_port, tcb->peer_port);
+
+    tcb->hash_next = *head;
+    *head = tcb;
+}
+
+void _gnrc_tcp_common_tcb_hash_remove(gnrc_tcp_tcb_t *tcb)
+{
+    gnrc_tcp_tcb_t **link = _bucket(tcb->local_port, tcb->peer_port);
+
+    while (*link != NULL) {
+        if (*link == tcb) {
+            *link = tcb->hash_next;
+            tcb->hash_next = NULL;
+            return;
+        }
+        link = &(*link)->hash_next;
+    }
+}
+#endif
 
 _gnrc_tcp_common_tcb_list_t *_gnrc_tcp_common_get_tcb_list(void)
 {
     return &_list;
 }
+
+gnrc_tcp_tcb_t *_gnrc_tcp_common_tcb_find(uint16_t local_port, uint16_t peer_port,
+                                          const void *peer_addr)
+{
+#if CONFIG_GNRC_TCP_TCB_HASH_BUCKETS
+    gnrc_tcp_tcb_t *tcb = *_bucket(local_port, peer_port);
+#else
+    gnrc_tcp_tcb_t *tcb = _list.head;
+#endif
+
+    while (tcb) {
+#ifdef MODULE_GNRC_IPV6
+        if (tcb->address_family == AF_INET6 && tcb->local_port == local_port &&
+            tcb->peer_port == peer_port &&
+            ipv6_addr_equal((ipv6_addr_t *)tcb->peer_addr, peer_addr)) {
+            return tcb;
+        }
+#else
+        (void)peer_addr;
+#endif
+#if CONFIG_GNRC_TCP_TCB_HASH_BUCKETS
+        tcb = tcb->hash_next;
+#else
+        tcb = tcb->next;
+#endif
+    }
+    return NULL;
+}
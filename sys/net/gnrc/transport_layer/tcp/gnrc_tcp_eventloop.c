@@ -198,7 +198,9 @@ static int _receive(gnrc_pktsnip_t *pkt)
     }
 
     /* Validate checksum */
-    if (byteorder_ntohs(hdr->checksum) != _gnrc_tcp_pkt_calc_csum(tcp, ip, pkt)) {
+    if (!(gnrc_netif_hdr_get_flag(pkt) & GNRC_NETIF_HDR_FLAGS_CSUM_VALID) &&
+        (byteorder_ntohs(hdr->checksum) !=
+         _gnrc_tcp_pkt_calc_csum(tcp, ip, pkt))) {
 #ifndef MODULE_FUZZING
         gnrc_pktbuf_release(pkt);
         TCP_DEBUG_ERROR("-EINVAL: Invalid checksum.");
@@ -210,41 +212,37 @@ static int _receive(gnrc_pktsnip_t *pkt)
     /* Find TCB to for this packet */
     _gnrc_tcp_common_tcb_list_t *list = _gnrc_tcp_common_get_tcb_list();
     mutex_lock(&list->lock);
-    tcb = list->head;
-    while (tcb) {
 #ifdef MODULE_GNRC_IPV6
-        /* Check if current TCB is fitting for the incoming packet */
-        if (ip->type == GNRC_NETTYPE_IPV6 && tcb->address_family == AF_INET6) {
-            /* If SYN is set, a connection is listening on that port ... */
-            ipv6_addr_t *tmp_addr = NULL;
-            _gnrc_tcp_fsm_state_t state = _gnrc_tcp_fsm_get_state(tcb);
-            if (syn && tcb->local_port == dst && state == FSM_STATE_LISTEN) {
-                /* ... and local addr is unspec or pre configured */
-                tmp_addr = &((ipv6_hdr_t *)ip->data)->dst;
-                if (ipv6_addr_equal((ipv6_addr_t *) tcb->local_addr, (ipv6_addr_t *) tmp_addr) ||
-                    ipv6_addr_is_unspecified((ipv6_addr_t *) tcb->local_addr)) {
-                    break;
-                }
-            }
-
-            /* If SYN is not set and the ports match ... */
-            if (!syn && tcb->local_port == dst && tcb->peer_port == src) {
-                /* .. and the IPv6 addresses match */
-                tmp_addr = &((ipv6_hdr_t * )ip->data)->src;
-                if (ipv6_addr_equal((ipv6_addr_t *) tcb->peer_addr, (ipv6_addr_t *) tmp_addr)) {
-                    break;
+    if (ip->type == GNRC_NETTYPE_IPV6) {
+        /* If SYN is set, a connection is listening on that port ... */
+        if (syn) {
+            tcb = list->head;
+            while (tcb) {
+                ipv6_addr_t *tmp_addr = &((ipv6_hdr_t *)ip->data)->dst;
+                _gnrc_tcp_fsm_state_t state = _gnrc_tcp_fsm_get_state(tcb);
+                if (tcb->address_family == AF_INET6 && tcb->local_port == dst &&
+                    state == FSM_STATE_LISTEN) {
+                    /* ... and local addr is unspec or pre configured */
+                    if (ipv6_addr_equal((ipv6_addr_t *) tcb->local_addr, tmp_addr) ||
+                        ipv6_addr_is_unspecified((ipv6_addr_t *) tcb->local_addr)) {
+                        break;
+                    }
                 }
+                tcb = tcb->next;
             }
         }
+        /* If SYN is not set, the ports and the IPv6 addresses must match */
+        else {
+            tcb = _gnrc_tcp_common_tcb_find(dst, src, &((ipv6_hdr_t *)ip->data)->src);
+        }
+    }
 #else
-        /* Suppress compiler warnings if TCP is built without network layer */
-        TCP_DEBUG_ERROR("Missing network layer. Add module to makefile.");
-        (void) syn;
-        (void) src;
-        (void) dst;
+    /* Suppress compiler warnings if TCP is built without network layer */
+    TCP_DEBUG_ERROR("Missing network layer. Add module to makefile.");
+    (void) syn;
+    (void) src;
+    (void) dst;
 #endif
-        tcb = tcb->next;
-    }
     mutex_unlock(&list->lock);
 
     /* Call FSM with event RCVD_PKT if a fitting TCB was found */
@@ -43,6 +43,11 @@
  */
 #define TCB_EQUAL(a, b)      ((a) != (b))
 
+/**
+ * @brief Number of duplicate ACKs that trigger a fast retransmit (see RFC 5681)
+ */
+#define DUP_ACK_THRESHOLD    (3U)
+
 /**
  * @brief Checks if a given port number is currently used by a TCB as local_port.
  *
@@ -92,15 +97,38 @@ static uint16_t _get_random_local_port(void)
 static int _clear_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->pkt_retransmit != NULL) {
+    if (tcb->pkt_retransmit[0] != NULL) {
         _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
+        for (size_t i = 0; i < CONFIG_GNRC_TCP_SND_SEGMENTS; ++i) {
+            if (tcb->pkt_retransmit[i] != NULL) {
+                gnrc_pktbuf_release(tcb->pkt_retransmit[i]);
+                tcb->pkt_retransmit[i] = NULL;
+            }
+        }
     }
+    tcb->dup_acks = 0;
     TCP_DEBUG_LEAVE;
     return 0;
 }
 
+/**
+ * @brief Counts a duplicate ACK and resends the oldest segment in flight on
+ *        the third one (fast retransmit).
+ *
+ * @param[in,out] tcb   TCB holding the retransmit queue.
+ */
+static void _dup_ack(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    if (++tcb->dup_acks == DUP_ACK_THRESHOLD) {
+        TCP_DEBUG_INFO("Fast retransmit.");
+        /* The retransmission timer keeps running, every send consumes a user */
+        gnrc_pktbuf_hold(tcb->pkt_retransmit[0], 1);
+        _gnrc_tcp_pkt_send(tcb, tcb->pkt_retransmit[0], 0, true);
+    }
+    TCP_DEBUG_LEAVE;
+}
+
 /**
  * @brief Restarts timewait timer.
  *
@@ -156,6 +184,7 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
             {
                 /* Remove connection from active connections */
                 mutex_lock(&list->lock);
+                _gnrc_tcp_common_tcb_hash_remove(tcb);
                 LL_DELETE(list->head, tcb);
                 mutex_unlock(&list->lock);
 
@@ -186,7 +215,7 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
                 ipv6_addr_set_unspecified((ipv6_addr_t *) tcb->peer_addr);
             }
 #endif
-            tcb->peer_port = PORT_UNSPEC;
+            _gnrc_tcp_rcvbuf_clear_ooo(tcb);
 
             /* Add connection to active connections (if not already active) */
             mutex_lock(&list->lock);
@@ -194,10 +223,17 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
             if (iter == NULL) {
                 LL_PREPEND(list->head, tcb);
             }
+            else {
+                _gnrc_tcp_common_tcb_hash_remove(tcb);
+            }
+            tcb->peer_port = PORT_UNSPEC;
+            _gnrc_tcp_common_tcb_hash_add(tcb);
             mutex_unlock(&list->lock);
             break;
 
         case FSM_STATE_SYN_SENT:
+            _gnrc_tcp_rcvbuf_clear_ooo(tcb);
+
             /* Add connection to active connections (if not already active) */
             mutex_lock(&list->lock);
             LL_SEARCH(list->head, iter, tcb, TCB_EQUAL);
@@ -218,6 +254,7 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
                     tcb->local_port = _get_random_local_port();
                 }
                 LL_PREPEND(list->head, tcb);
+                _gnrc_tcp_common_tcb_hash_add(tcb);
             }
             mutex_unlock(&list->lock);
             break;
@@ -273,7 +310,9 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
         return -ENOMEM;
     }
 
-    tcb->rcv_wnd = CONFIG_GNRC_TCP_DEFAULT_WINDOW;
+    /* The receive window is limited by the size of the receive buffer */
+    tcb->rcv_wnd = (tcb->rcv_buf_raw == tcb->rcv_buf_usr) ? tcb->rcv_buf_usr_size
+                                                          : CONFIG_GNRC_TCP_DEFAULT_WINDOW;
 
     if (tcb->status & STATUS_LISTENING) {
         /* Passive open, T: CLOSED -> LISTEN */
@@ -317,27 +356,33 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
 static int _fsm_call_send(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
 {
     TCP_DEBUG_ENTER;
-    size_t payload = (tcb->snd_una + tcb->snd_wnd) - tcb->snd_nxt;
+    size_t sent = 0;
+
+    /* Send while the window is open and the retransmit queue has room */
+    while (sent < len && tcb->snd_wnd > 0 &&
+           tcb->pkt_retransmit[CONFIG_GNRC_TCP_SND_SEGMENTS - 1] == NULL &&
+           LSS_32_BIT(tcb->snd_nxt, tcb->snd_una + tcb->snd_wnd)) {
+        size_t payload = (tcb->snd_una + tcb->snd_wnd) - tcb->snd_nxt;
 
-    /* Check if window is open and all packets were transmitted */
-    if (payload > 0 && tcb->snd_wnd > 0 && tcb->pkt_retransmit == NULL) {
         /* Calculate segment size */
         payload = (payload < CONFIG_GNRC_TCP_MSS) ? payload : CONFIG_GNRC_TCP_MSS;
         payload = (payload < tcb->mss) ? payload : tcb->mss;
-        payload = (payload < len) ? payload : len;
+        payload = (payload < (len - sent)) ? payload : (len - sent);
 
         /* Calculate payload size for this segment */
         gnrc_pktsnip_t *out_pkt = NULL;
         uint16_t seq_con = 0;
         _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH,
-                            tcb->snd_nxt, tcb->rcv_nxt, buf, payload);
+                            tcb->snd_nxt, tcb->rcv_nxt, (uint8_t *)buf + sent, payload);
+        if (out_pkt == NULL) {
+            break;
+        }
         _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
         _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
-        TCP_DEBUG_LEAVE;
-        return payload;
+        sent += payload;
     }
     TCP_DEBUG_LEAVE;
-    return 0;
+    return sent;
 }
 
 /**
@@ -565,8 +610,13 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             return 0;
 #endif
 
+            /* Rehash the TCB by the ports of the connection */
+            mutex_lock(&_gnrc_tcp_common_get_tcb_list()->lock);
+            _gnrc_tcp_common_tcb_hash_remove(tcb);
             tcb->local_port = dst;
             tcb->peer_port = src;
+            _gnrc_tcp_common_tcb_hash_add(tcb);
+            mutex_unlock(&_gnrc_tcp_common_get_tcb_list()->lock);
             tcb->irs = byteorder_ntohl(tcp_hdr->seq_num);
             tcb->rcv_nxt = tcb->irs + 1;
             tcb->iss = random_uint32();
@@ -713,8 +763,15 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 /* Acknowledge previously sent data */
                 if (LSS_32_BIT(tcb->snd_una, seg_ack) && LEQ_32_BIT(seg_ack, tcb->snd_nxt)) {
                     tcb->snd_una = seg_ack;
+                    tcb->dup_acks = 0;
                     _gnrc_tcp_pkt_acknowledge(tcb, seg_ack);
                 }
+                /* Duplicate ACK, while several segments are in flight */
+                else if ((CONFIG_GNRC_TCP_SND_SEGMENTS > 1) && (seg_ack == tcb->snd_una) &&
+                         (pay_len == 0) && (seg_wnd == tcb->snd_wnd) &&
+                         (tcb->pkt_retransmit[0] != NULL)) {
+                    _dup_ack(tcb);
+                }
                 /* ACK received for something not yet sent: Reply with pure ACK */
                 else if (LSS_32_BIT(tcb->snd_nxt, seg_ack)) {
                     _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK,
@@ -738,25 +795,25 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 /* Additional processing */
                 /* Check additionally if previously sent FIN was acknowledged */
                 if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit[0] == NULL) {
                         _transition_to(tcb, FSM_STATE_FIN_WAIT_2);
                     }
                 }
                 /* If retransmission queue is empty, acknowledge close operation */
                 if (tcb->state == FSM_STATE_FIN_WAIT_2) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit[0] == NULL) {
                         /* Optional: Unblock user close operation */
                     }
                 }
                 /* If our FIN has been acknowledged: Transition to TIME_WAIT */
                 if (tcb->state == FSM_STATE_CLOSING) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit[0] == NULL) {
                         _transition_to(tcb, FSM_STATE_TIME_WAIT);
                     }
                 }
                 /* If our FIN was acknowledged and status is LAST_ACK: close connection */
                 if (tcb->state == FSM_STATE_LAST_ACK) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit[0] == NULL) {
                         _transition_to(tcb, FSM_STATE_CLOSED);
                         TCP_DEBUG_LEAVE;
                         return 0;
@@ -775,13 +832,8 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 /* Search for begin of payload */
                 snp = gnrc_pktsnip_search_type(in_pkt, GNRC_NETTYPE_UNDEF);
 
-                /* Accept only data that is expected, to be received */
-                if (tcb->rcv_nxt == seg_seq) {
-                    /* Copy contents into receive buffer */
-                    while (snp && snp->type == GNRC_NETTYPE_UNDEF) {
-                        tcb->rcv_nxt += ringbuffer_add(&(tcb->rcv_buf), snp->data, snp->size);
-                        snp = snp->next;
-                    }
+                /* Copy contents into receive buffer, out-of-order data only if enabled */
+                if (_gnrc_tcp_rcvbuf_add(tcb, seg_seq, snp) > 0) {
                     /* Shrink receive window */
                     tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
                     /* Notify owner because new data is available */
@@ -803,6 +855,11 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 TCP_DEBUG_LEAVE;
                 return 0;
             }
+            /* Ignore FIN after a gap in the received data, the peer resends it */
+            if (LSS_32_BIT(tcb->rcv_nxt, seg_seq + pay_len)) {
+                TCP_DEBUG_LEAVE;
+                return 0;
+            }
             /* Advance rcv_nxt over FIN bit */
             tcb->rcv_nxt = seg_seq + seg_len;
             _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt,
@@ -813,7 +870,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 _transition_to(tcb, FSM_STATE_CLOSE_WAIT);
             }
             else if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                if (tcb->pkt_retransmit == NULL) {
+                if (tcb->pkt_retransmit[0] == NULL) {
                     _transition_to(tcb, FSM_STATE_TIME_WAIT);
                 }
                 else {
@@ -857,9 +914,10 @@ static int _fsm_timeout_timewait(gnrc_tcp_tcb_t *tcb)
 static int _fsm_timeout_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->pkt_retransmit != NULL) {
-        _gnrc_tcp_pkt_setup_retransmit(tcb, tcb->pkt_retransmit, true);
-        _gnrc_tcp_pkt_send(tcb, tcb->pkt_retransmit, 0, true);
+    if (tcb->pkt_retransmit[0] != NULL) {
+        tcb->dup_acks = 0;
+        _gnrc_tcp_pkt_setup_retransmit(tcb, tcb->pkt_retransmit[0], true);
+        _gnrc_tcp_pkt_send(tcb, tcb->pkt_retransmit[0], 0, true);
     }
     else {
         TCP_DEBUG_INFO("Retransmission queue is empty.");
@@ -287,9 +287,13 @@ int _gnrc_tcp_pkt_send(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *out_pkt,
 
     /* If this is no retransmission, advance sequence number and measure time */
     if (!retransmit) {
-        tcb->retries = 0;
         tcb->snd_nxt += seq_con;
-        tcb->rtt_start = evtimer_now_msec();
+        /* Only the oldest segment in flight is timed */
+        if ((seq_con > 0) && (tcb->pkt_retransmit[0] == out_pkt)) {
+            tcb->retries = 0;
+            tcb->rtt_start = evtimer_now_msec();
+            tcb->status |= STATUS_RTT_TIMED;
+        }
     }
     else {
         tcb->retries += 1;
@@ -376,6 +380,52 @@ uint32_t _gnrc_tcp_pkt_get_pay_len(gnrc_pktsnip_t *pkt)
     return seg_len;
 }
 
+/**
+ * @brief Adjusts the retransmission timeout and (re)starts the retransmission timer.
+ *
+ * @param[in,out] tcb          TCB holding the connection information.
+ * @param[in]     retransmit   Flag used to indicate that a segment is retransmitted.
+ */
+static void _sched_retransmit(gnrc_tcp_tcb_t *tcb, const bool retransmit)
+{
+    TCP_DEBUG_ENTER;
+    /* RTO adjustment */
+    if (!retransmit) {
+        /* If this is the first transmission: rto is 1 sec (Lower Bound) */
+        if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
+            tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+        }
+        else {
+            tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
+                                        CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
+        }
+    }
+    else {
+        /* If this is a retransmission: Double the rto (Timer Backoff) */
+        tcb->rto *= 2;
+
+        /* If the transmission has been tried five times, we assume srtt and rtt_var are bogus */
+        /* New measurements must be taken the next time something is sent. */
+        if (tcb->retries >= 5) {
+            tcb->srtt = RTO_UNINITIALIZED;
+            tcb->rtt_var = RTO_UNINITIALIZED;
+        }
+    }
+
+    /* Perform boundary checks on current RTO before usage */
+    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+    }
+    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS;
+    }
+
+    /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
+    _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
+                              MSG_TYPE_RETRANSMISSION, tcb);
+    TCP_DEBUG_LEAVE;
+}
+
 int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
                                    const bool retransmit)
 {
@@ -383,6 +433,7 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
     gnrc_pktsnip_t *snp = NULL;
     uint32_t ctl = 0;
     uint32_t len = 0;
+    unsigned slot;
 
     /* No packet received */
     if (pkt == NULL) {
@@ -392,7 +443,12 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
     }
 
     /* Check if retransmit queue is full and pkt is not already in retransmit queue */
-    if (tcb->pkt_retransmit != NULL && tcb->pkt_retransmit != pkt) {
+    for (slot = 0; slot < CONFIG_GNRC_TCP_SND_SEGMENTS; ++slot) {
+        if (tcb->pkt_retransmit[slot] == NULL || tcb->pkt_retransmit[slot] == pkt) {
+            break;
+        }
+    }
+    if (slot == CONFIG_GNRC_TCP_SND_SEGMENTS) {
         TCP_DEBUG_ERROR("-ENOMEM: Retransmit queue is full.");
         TCP_DEBUG_LEAVE;
         return -ENOMEM;
@@ -416,43 +472,15 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
     }
 
     /* Assign pkt and increase users: every send attempt consumes a user */
-    tcb->pkt_retransmit = pkt;
+    tcb->pkt_retransmit[slot] = pkt;
     gnrc_pktbuf_hold(pkt, 1);
 
-    /* RTO adjustment */
-    if (!retransmit) {
-        /* If this is the first transmission: rto is 1 sec (Lower Bound) */
-        if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
-            tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
-        }
-        else {
-            tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
-                                        CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
-        }
-    }
-    else {
-        /* If this is a retransmission: Double the rto (Timer Backoff) */
-        tcb->rto *= 2;
-
-        /* If the transmission has been tried five times, we assume srtt and rtt_var are bogus */
-        /* New measurements must be taken the next time something is sent. */
-        if (tcb->retries >= 5) {
-            tcb->srtt = RTO_UNINITIALIZED;
-            tcb->rtt_var = RTO_UNINITIALIZED;
-        }
-    }
-
-    /* Perform boundary checks on current RTO before usage */
-    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
-    }
-    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS;
+    /* The timer is already running for the oldest segment in flight */
+    if (slot > 0) {
+        TCP_DEBUG_LEAVE;
+        return 0;
     }
-
-    /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
-    _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
-                              MSG_TYPE_RETRANSMISSION, tcb);
+    _sched_retransmit(tcb, retransmit);
     TCP_DEBUG_LEAVE;
     return 0;
 }
@@ -465,36 +493,45 @@ int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
     tcp_hdr_t *hdr;
 
     /* Retransmission queue is empty. Nothing to ACK there */
-    if (tcb->pkt_retransmit == NULL) {
+    if (tcb->pkt_retransmit[0] == NULL) {
         TCP_DEBUG_ERROR("-ENODATA: No packet to acknowledge.");
         TCP_DEBUG_LEAVE;
         return -ENODATA;
     }
 
-    snp = gnrc_pktsnip_search_type(tcb->pkt_retransmit, GNRC_NETTYPE_TCP);
-    if (snp == NULL) {
-        TCP_DEBUG_ERROR("-EINVAL: snp == NULL.");
-        TCP_DEBUG_LEAVE;
-        return -EINVAL;
-    }
+    while (tcb->pkt_retransmit[0] != NULL) {
+        snp = gnrc_pktsnip_search_type(tcb->pkt_retransmit[0], GNRC_NETTYPE_TCP);
+        if (snp == NULL) {
+            TCP_DEBUG_ERROR("-EINVAL: snp == NULL.");
+            TCP_DEBUG_LEAVE;
+            return -EINVAL;
+        }
+
+        hdr = (tcp_hdr_t *) snp->data;
 
-    hdr = (tcp_hdr_t *) snp->data;
+        /* There must be a packet, waiting to be acknowledged. */
+        seg = byteorder_ntohl(hdr->seq_num) + _gnrc_tcp_pkt_get_seg_len(
+            tcb->pkt_retransmit[0]) - 1;
 
-    /* There must be a packet, waiting to be acknowledged. */
-    seg = byteorder_ntohl(hdr->seq_num) + _gnrc_tcp_pkt_get_seg_len(
-        tcb->pkt_retransmit) - 1;
+        /* Stop at the first segment that can not be acknowledged */
+        if (!LSS_32_BIT(seg, ack)) {
+            break;
+        }
 
-        /* If segment can be acknowledged -> stop timer, release packet from pktbuf and update rto. */
-    if (LSS_32_BIT(seg, ack)) {
+        /* Stop timer, release packet from pktbuf and update rto. */
         _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
+        gnrc_pktbuf_release(tcb->pkt_retransmit[0]);
+        for (unsigned i = 1; i < CONFIG_GNRC_TCP_SND_SEGMENTS; ++i) {
+            tcb->pkt_retransmit[i - 1] = tcb->pkt_retransmit[i];
+        }
+        tcb->pkt_retransmit[CONFIG_GNRC_TCP_SND_SEGMENTS - 1] = NULL;
 
         /* Measure round trip time */
         int32_t rtt = evtimer_now_msec() - tcb->rtt_start;
 
-        /* Use time only if there was no timer overflow and no retransmission (Karns Algorithm) */
-        if (tcb->retries == 0 && rtt > 0) {
+        /* Use time only if the segment was timed, there was no timer overflow
+         * and no retransmission (Karns Algorithm) */
+        if ((tcb->status & STATUS_RTT_TIMED) && tcb->retries == 0 && rtt > 0) {
             /* If this is the first sample taken */
             if (tcb->srtt == RTO_UNINITIALIZED && tcb->rtt_var == RTO_UNINITIALIZED) {
                 tcb->srtt = rtt;
@@ -508,6 +545,13 @@ int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
                 tcb->srtt += rtt / CONFIG_GNRC_TCP_RTO_A_DIV;
             }
         }
+        tcb->status &= ~STATUS_RTT_TIMED;
+        tcb->retries = 0;
+
+        /* Restart the timer for the now oldest segment in flight */
+        if (tcb->pkt_retransmit[0] != NULL) {
+            _sched_retransmit(tcb, false);
+        }
     }
     TCP_DEBUG_LEAVE;
     return 0;
@@ -17,7 +17,9 @@
  */
 #include <errno.h>
 #include <mutex.h>
+#include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 #include "net/gnrc/tcp/config.h"
 #include "include/gnrc_tcp_common.h"
 #include "include/gnrc_tcp_rcvbuf.h"
@@ -25,6 +27,7 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+#if CONFIG_GNRC_TCP_RCV_BUFFERS
 /**
  * @brief Receive buffer entry.
  */
@@ -86,21 +89,40 @@ static void _rcvbuf_free(void * const buf)
     mutex_unlock(&(_static_buf.lock));
     TCP_DEBUG_LEAVE;
 }
+#else
+/* Only receive buffers provided by gnrc_tcp_tcb_set_rcv_buf() are used */
+static void* _rcvbuf_alloc(void)
+{
+    return NULL;
+}
+
+static void _rcvbuf_free(void * const buf)
+{
+    (void)buf;
+}
+#endif
 
 void _gnrc_tcp_rcvbuf_init(void)
 {
     TCP_DEBUG_ENTER;
+#if CONFIG_GNRC_TCP_RCV_BUFFERS
     mutex_init(&(_static_buf.lock));
     for (size_t i = 0; i < CONFIG_GNRC_TCP_RCV_BUFFERS; ++i) {
         _static_buf.entries[i].used = 0;
     }
+#endif
     TCP_DEBUG_LEAVE;
 }
 
 int _gnrc_tcp_rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->rcv_buf_raw == NULL) {
+    /* Use the buffer provided by the user instead of a preallocated one */
+    if (tcb->rcv_buf_raw == NULL && tcb->rcv_buf_usr != NULL) {
+        tcb->rcv_buf_raw = tcb->rcv_buf_usr;
+        ringbuffer_init(&tcb->rcv_buf, (char *) tcb->rcv_buf_raw, tcb->rcv_buf_usr_size);
+    }
+    else if (tcb->rcv_buf_raw == NULL) {
         tcb->rcv_buf_raw = _rcvbuf_alloc();
         if (tcb->rcv_buf_raw == NULL) {
             TCP_DEBUG_ERROR("-ENOMEM: Failed to allocate receive buffer.");
@@ -115,11 +137,168 @@ int _gnrc_tcp_rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb)
     return 0;
 }
 
+/**
+ * @brief Copies data into the receive buffer after its available data.
+ *
+ * @param[in,out] rcv_buf   Receive buffer.
+ * @param[in]     offset    Offset after the available data to copy to.
+ * @param[in]     data      Data to copy.
+ * @param[in]     len       Number of bytes to copy, must fit into free space.
+ */
+static void _rcvbuf_write(ringbuffer_t *rcv_buf, size_t offset,
+                          const uint8_t *data, size_t len)
+{
+    /* position of the next expected byte, does not change by reading */
+    size_t pos = (rcv_buf->start + rcv_buf->avail + offset) % rcv_buf->size;
+    size_t part = rcv_buf->size - pos;
+
+    if (part > len) {
+        part = len;
+    }
+    memcpy(&rcv_buf->buf[pos], data, part);
+    memcpy(rcv_buf->buf, data + part, len - part);
+}
+
+#if CONFIG_GNRC_TCP_RCV_OOO_SEGMENTS
+/**
+ * @brief Records a range of out-of-order data, merging it with known ranges.
+ *
+ * @param[in,out] tcb   TCB holding the ranges.
+ * @param[in]     seq   Sequence number of the first byte of the range.
+ * @param[in]     end   Sequence number following the last byte of the range.
+ */
+static void _ooo_add(gnrc_tcp_tcb_t *tcb, uint32_t seq, uint32_t end)
+{
+    int free_slot = -1;
+
+    for (unsigned i = 0; i < CONFIG_GNRC_TCP_RCV_OOO_SEGMENTS; ++i) {
+        uint32_t r_seq = tcb->rcv_ooo[i].seq;
+        uint32_t r_end = r_seq + tcb->rcv_ooo[i].len;
+
+        if (tcb->rcv_ooo[i].len == 0) {
+            free_slot = (free_slot < 0) ? (int)i : free_slot;
+            continue;
+        }
+        /* merge overlapping or adjacent ranges, then insert the union */
+        if (LEQ_32_BIT(r_seq, end) && LEQ_32_BIT(seq, r_end)) {
+            seq = LSS_32_BIT(r_seq, seq) ? r_seq : seq;
+            end = LSS_32_BIT(end, r_end) ? r_end : end;
+            tcb->rcv_ooo[i].len = 0;
+            free_slot = i;
+        }
+    }
+    /* without a free slot, the data is dropped and must be resent */
+    if (free_slot >= 0) {
+        tcb->rcv_ooo[free_slot].seq = seq;
+        tcb->rcv_ooo[free_slot].len = end - seq;
+    }
+}
+
+/**
+ * @brief Makes out-of-order data available, that follows in-order data.
+ *
+ * @param[in,out] tcb   TCB holding the ranges.
+ */
+static void _ooo_deliver(gnrc_tcp_tcb_t *tcb)
+{
+    unsigned i = 0;
+
+    while (i < CONFIG_GNRC_TCP_RCV_OOO_SEGMENTS) {
+        uint32_t r_seq = tcb->rcv_ooo[i].seq;
+        uint32_t r_end = r_seq + tcb->rcv_ooo[i].len;
+
+        if ((tcb->rcv_ooo[i].len > 0) && LEQ_32_BIT(r_seq, tcb->rcv_nxt)) {
+            tcb->rcv_ooo[i].len = 0;
+            if (LSS_32_BIT(tcb->rcv_nxt, r_end)) {
+                tcb->rcv_buf.avail += r_end - tcb->rcv_nxt;
+                tcb->rcv_nxt = r_end;
+                /* the new rcv_nxt may reach ranges checked before */
+                i = 0;
+                continue;
+            }
+        }
+        ++i;
+    }
+}
+#endif
+
+uint32_t _gnrc_tcp_rcvbuf_add(gnrc_tcp_tcb_t *tcb, uint32_t seq,
+                              gnrc_pktsnip_t *payload)
+{
+    TCP_DEBUG_ENTER;
+    size_t free = ringbuffer_get_free(&tcb->rcv_buf);
+    uint32_t rcv_nxt = tcb->rcv_nxt;
+    uint32_t start = 0;
+    uint32_t end = 0;
+    bool written = false;
+
+    for (; payload && payload->type == GNRC_NETTYPE_UNDEF; payload = payload->next) {
+        const uint8_t *data = payload->data;
+        size_t len = payload->size;
+        uint32_t offset;
+
+        /* skip data that was received before */
+        if (LSS_32_BIT(seq, rcv_nxt)) {
+            uint32_t skip = rcv_nxt - seq;
+
+            skip = (skip < len) ? skip : len;
+            data += skip;
+            len -= skip;
+            seq += skip;
+        }
+        if (len == 0) {
+            continue;
+        }
+        offset = seq - rcv_nxt;
+        /* drop data beyond the free space, and out-of-order data if disabled */
+        if ((offset >= free) ||
+            (!written && (offset > 0) && !CONFIG_GNRC_TCP_RCV_OOO_SEGMENTS)) {
+            break;
+        }
+        len = (len < (free - offset)) ? len : (free - offset);
+        _rcvbuf_write(&tcb->rcv_buf, offset, data, len);
+        if (!written) {
+            start = seq;
+            written = true;
+        }
+        seq += len;
+        end = seq;
+    }
+
+    if (written) {
+        if (start == rcv_nxt) {
+            tcb->rcv_buf.avail += end - start;
+            tcb->rcv_nxt = end;
+        }
+#if CONFIG_GNRC_TCP_RCV_OOO_SEGMENTS
+        else {
+            _ooo_add(tcb, start, end);
+        }
+        _ooo_deliver(tcb);
+#endif
+    }
+    TCP_DEBUG_LEAVE;
+    return tcb->rcv_nxt - rcv_nxt;
+}
+
+void _gnrc_tcp_rcvbuf_clear_ooo(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+#if CONFIG_GNRC_TCP_RCV_OOO_SEGMENTS
+    memset(tcb->rcv_ooo, 0, sizeof(tcb->rcv_ooo));
+#else
+    (void)tcb;
+#endif
+    TCP_DEBUG_LEAVE;
+}
+
 void _gnrc_tcp_rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
     if (tcb->rcv_buf_raw != NULL) {
-        _rcvbuf_free(tcb->rcv_buf_raw);
+        if (tcb->rcv_buf_raw != tcb->rcv_buf_usr) {
+            _rcvbuf_free(tcb->rcv_buf_raw);
+        }
         tcb->rcv_buf_raw = NULL;
     }
     TCP_DEBUG_LEAVE;
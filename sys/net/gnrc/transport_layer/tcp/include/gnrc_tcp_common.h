@@ -47,6 +47,7 @@ extern "C" {
 #define STATUS_NOTIFY_USER    (1 << 2) /**< Internal: Status bitmask NOTIFY_USER */
 #define STATUS_ACCEPTED       (1 << 3) /**< Internal: Status bitmask ACCEPTED */
 #define STATUS_LOCKED         (1 << 4) /**< Internal: Status bitmask LOCKED */
+#define STATUS_RTT_TIMED      (1 << 5) /**< Internal: Status bitmask RTT_TIMED */
 /** @} */
 
 /**
@@ -152,6 +153,12 @@ extern "C" {
 typedef struct {
     gnrc_tcp_tcb_t *head; /**< Head of TCB list */
     mutex_t lock;         /**< Lock of TCB list */
+#if CONFIG_GNRC_TCP_TCB_HASH_BUCKETS || defined(DOXYGEN)
+    /**
+     * @brief Heads of the hash buckets, linking the TCBs of the list by ports
+     */
+    gnrc_tcp_tcb_t *hash[CONFIG_GNRC_TCP_TCB_HASH_BUCKETS];
+#endif
 } _gnrc_tcp_common_tcb_list_t;
 
 /**
@@ -161,6 +168,46 @@ typedef struct {
  */
 _gnrc_tcp_common_tcb_list_t *_gnrc_tcp_common_get_tcb_list(void);
 
+/**
+ * @brief Searches the TCB of an established connection in the TCB list
+ *
+ * @pre The lock of the TCB list is held.
+ *
+ * @param[in] local_port   Local port of the connection.
+ * @param[in] peer_port    Peer port of the connection.
+ * @param[in] peer_addr    Peer IPv6 address of the connection.
+ *
+ * @returns   The TCB of the connection.
+ *            NULL if no TCB matches.
+ */
+gnrc_tcp_tcb_t *_gnrc_tcp_common_tcb_find(uint16_t local_port, uint16_t peer_port,
+                                          const void *peer_addr);
+
+#if CONFIG_GNRC_TCP_TCB_HASH_BUCKETS || defined(DOXYGEN)
+/**
+ * @brief Adds a TCB of the TCB list to the hash bucket of its ports
+ *
+ * @pre The lock of the TCB list is held.
+ *
+ * @param[in,out] tcb   TCB to add.
+ */
+void _gnrc_tcp_common_tcb_hash_add(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Removes a TCB from the hash bucket of its ports
+ *
+ * Must be called before the ports of a hashed TCB are changed.
+ *
+ * @pre The lock of the TCB list is held.
+ *
+ * @param[in,out] tcb   TCB to remove.
+ */
+void _gnrc_tcp_common_tcb_hash_remove(gnrc_tcp_tcb_t *tcb);
+#else
+#define _gnrc_tcp_common_tcb_hash_add(tcb)      (void)tcb
+#define _gnrc_tcp_common_tcb_hash_remove(tcb)   (void)tcb
+#endif
+
 #ifdef __cplusplus
 }
 #endif
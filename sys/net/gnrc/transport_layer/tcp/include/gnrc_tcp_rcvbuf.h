@@ -34,6 +34,9 @@ void _gnrc_tcp_rcvbuf_init(void);
 /**
  * @brief Allocate receive buffer and assign it to TCB.
  *
+ * A buffer provided by gnrc_tcp_tcb_set_rcv_buf() is used instead of
+ * allocating one.
+ *
  * @param[in,out] tcb   TCB that acquires receive buffer.
  *
  * @returns   Zero  on success.
@@ -48,6 +51,31 @@ int _gnrc_tcp_rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb);
  */
 void _gnrc_tcp_rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb);
 
+/**
+ * @brief Stores the payload of a received segment in the receive buffer.
+ *
+ * Data starting at tcb->rcv_nxt is made available for reading and
+ * tcb->rcv_nxt is advanced over it. Data that was received before is skipped,
+ * data beyond the free space of the receive buffer is dropped. With
+ * CONFIG_GNRC_TCP_RCV_OOO_SEGMENTS > 0, data after a gap is stored in the
+ * free space, and made available as soon as the gap is filled.
+ *
+ * @param[in,out] tcb       TCB holding the receive buffer.
+ * @param[in]     seq       Sequence number of the segment.
+ * @param[in]     payload   First payload snip of the segment.
+ *
+ * @returns   Number of bytes tcb->rcv_nxt was advanced by.
+ */
+uint32_t _gnrc_tcp_rcvbuf_add(gnrc_tcp_tcb_t *tcb, uint32_t seq,
+                              gnrc_pktsnip_t *payload);
+
+/**
+ * @brief Forget all out-of-order data, e.g. on a new connection.
+ *
+ * @param[in,out] tcb   TCB holding the receive buffer.
+ */
+void _gnrc_tcp_rcvbuf_clear_ooo(gnrc_tcp_tcb_t *tcb);
+
 #ifdef __cplusplus
 }
 #endif
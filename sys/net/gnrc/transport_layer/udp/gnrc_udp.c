@@ -34,6 +34,7 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+#if !IS_USED(MODULE_GNRC_UDP_INLINE)
 /**
  * @brief   Save the UDP's thread PID for later reference
  */
@@ -44,6 +45,7 @@ static kernel_pid_t _pid = KERNEL_PID_UNDEF;
  */
 static char _stack[GNRC_UDP_STACK_SIZE + DEBUG_EXTRA_STACKSIZE];
 static msg_t _msg_queue[GNRC_UDP_MSG_QUEUE_SIZE];
+#endif
 
 /**
  * @brief   Calculate the UDP checksum dependent on the network protocol
@@ -102,6 +104,7 @@ static void _receive(gnrc_pktsnip_t *pkt)
     udp_hdr_t *hdr;
     uint32_t port;
 
+    gnrc_netif_latency_record(pkt, NETSTATS_LATENCY_TRANSPORT);
     /* mark UDP header */
     udp = gnrc_pktbuf_start_write(pkt);
     if (udp == NULL) {
@@ -143,7 +146,8 @@ static void _receive(gnrc_pktsnip_t *pkt)
         gnrc_pktbuf_release(pkt);
         return;
     }
-    if (_calc_csum(udp, ipv6, pkt) != 0xFFFF) {
+    if (!(gnrc_netif_hdr_get_flag(pkt) & GNRC_NETIF_HDR_FLAGS_CSUM_VALID) &&
+        (_calc_csum(udp, ipv6, pkt) != 0xFFFF)) {
         DEBUG("udp: received packet with invalid checksum, dropping it\n");
         gnrc_pktbuf_release(pkt);
         return;
@@ -217,6 +221,26 @@ static void _send(gnrc_pktsnip_t *pkt)
     }
 }
 
+#if IS_USED(MODULE_GNRC_UDP_INLINE)
+static void _netapi_cb(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
+{
+    (void)ctx;
+    switch (cmd) {
+        case GNRC_NETAPI_MSG_TYPE_RCV:
+            DEBUG("udp: GNRC_NETAPI_MSG_TYPE_RCV\n");
+            _receive(pkt);
+            break;
+        case GNRC_NETAPI_MSG_TYPE_SND:
+            DEBUG("udp: GNRC_NETAPI_MSG_TYPE_SND\n");
+            _send(pkt);
+            break;
+        default:
+            DEBUG("udp: received unidentified command\n");
+            gnrc_pktbuf_release(pkt);
+            break;
+    }
+}
+#else
 static void *_event_loop(void *arg)
 {
     (void)arg;
@@ -256,6 +280,7 @@ static void *_event_loop(void *arg)
     /* never reached */
     return NULL;
 }
+#endif
 
 int gnrc_udp_calc_csum(gnrc_pktsnip_t *hdr, gnrc_pktsnip_t *pseudo_hdr)
 {
@@ -299,6 +324,19 @@ gnrc_pktsnip_t *gnrc_udp_hdr_build(gnrc_pktsnip_t *payload, uint16_t src,
 
 int gnrc_udp_init(void)
 {
+#if IS_USED(MODULE_GNRC_UDP_INLINE)
+    static gnrc_netreg_entry_cbd_t cbd = { .cb = _netapi_cb };
+    static gnrc_netreg_entry_t netreg = GNRC_NETREG_ENTRY_INIT_CB(GNRC_NETREG_DEMUX_CTX_ALL,
+                                                                  &cbd);
+    static bool registered;
+
+    /* handle UDP in the context of the thread dispatching to it */
+    if (!registered) {
+        gnrc_netreg_register(GNRC_NETTYPE_UDP, &netreg);
+        registered = true;
+    }
+    return KERNEL_PID_UNDEF;
+#else
     /* check if thread is already running */
     if (_pid == KERNEL_PID_UNDEF) {
         /* start UDP thread */
@@ -306,4 +344,5 @@ int gnrc_udp_init(void)
                              0, _event_loop, NULL, "udp");
     }
     return _pid;
+#endif
 }
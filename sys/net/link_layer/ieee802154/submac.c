@@ -62,6 +62,17 @@ static inline bool _does_handle_csma(ieee802154_dev_t *dev)
            ieee802154_radio_has_auto_csma(dev);
 }
 
+static void _bh_request(ieee802154_submac_t *submac)
+{
+    if (IS_ACTIVE(CONFIG_IEEE802154_SUBMAC_PIPELINE)) {
+        /* processed by ieee802154_submac_process_ev() before returning */
+        submac->bh_pending = true;
+    }
+    else {
+        ieee802154_submac_bh_request(submac);
+    }
+}
+
 static bool _has_retrans_left(ieee802154_submac_t *submac)
 {
     return submac->retrans < CONFIG_IEEE802154_DEFAULT_MAX_FRAME_RETRANS;
@@ -103,7 +114,7 @@ static ieee802154_fsm_state_t _handle_tx_no_ack(ieee802154_submac_t *submac)
         submac->retrans++;
         res = ieee802154_radio_set_idle(&submac->dev, true);
         assert(res >= 0);
-        ieee802154_submac_bh_request(submac);
+        _bh_request(submac);
         return IEEE802154_FSM_STATE_PREPARE;
     }
     else {
@@ -125,7 +136,7 @@ static int _handle_fsm_ev_request_tx(ieee802154_submac_t *submac)
     else {
         /* write frame to radio */
         ieee802154_radio_write(dev, submac->psdu);
-        ieee802154_submac_bh_request(submac);
+        _bh_request(submac);
         return 0;
     }
 }
@@ -304,7 +315,7 @@ static ieee802154_fsm_state_t _fsm_state_tx_process_tx_done(ieee802154_submac_t
             /* The HAL should guarantee that's still possible to transmit
              * in the current state, since the radio is still in TX_ON.
              * Therefore, this is valid */
-            ieee802154_submac_bh_request(submac);
+            _bh_request(submac);
             return IEEE802154_FSM_STATE_PREPARE;
         }
     }
@@ -370,8 +381,7 @@ static ieee802154_fsm_state_t _fsm_state_wait_for_ack(ieee802154_submac_t *subma
     return IEEE802154_FSM_STATE_INVALID;
 }
 
-ieee802154_fsm_state_t ieee802154_submac_process_ev(ieee802154_submac_t *submac,
-                                                    ieee802154_fsm_ev_t ev)
+static void _process_ev(ieee802154_submac_t *submac, ieee802154_fsm_ev_t ev)
 {
     ieee802154_fsm_state_t new_state;
 
@@ -400,6 +410,42 @@ ieee802154_fsm_state_t ieee802154_submac_process_ev(ieee802154_submac_t *submac,
         assert(false);
     }
     submac->fsm_state = new_state;
+}
+
+static ieee802154_fsm_state_t _request_tx(ieee802154_submac_t *submac,
+                                          const iolist_t *iolist)
+{
+    uint8_t *buf = iolist->iol_base;
+    bool cnf = buf[0] & IEEE802154_FCF_ACK_REQ;
+
+    submac->wait_for_ack = cnf;
+    submac->psdu = iolist;
+    submac->retrans = 0;
+    submac->csma_retries_nb = 0;
+    submac->backoff_mask = (1 << submac->be.min) - 1;
+
+    return ieee802154_submac_process_ev(submac, IEEE802154_FSM_EV_REQUEST_TX);
+}
+
+ieee802154_fsm_state_t ieee802154_submac_process_ev(ieee802154_submac_t *submac,
+                                                    ieee802154_fsm_ev_t ev)
+{
+    _process_ev(submac, ev);
+#if IS_ACTIVE(CONFIG_IEEE802154_SUBMAC_PIPELINE)
+    while (submac->bh_pending) {
+        submac->bh_pending = false;
+        _process_ev(submac, IEEE802154_FSM_EV_BH);
+    }
+    /* only a finished transmission leads to IDLE while a frame is pending, so
+     * the radio holds no received frame the next frame could overwrite */
+    if (submac->next_pending &&
+        (submac->fsm_state == IEEE802154_FSM_STATE_IDLE)) {
+        submac->next_pending = false;
+        if (_request_tx(submac, &submac->next_psdu) == IEEE802154_FSM_STATE_IDLE) {
+            submac->cb->tx_done(submac, TX_STATUS_MEDIUM_BUSY, NULL);
+        }
+    }
+#endif
     return submac->fsm_state;
 }
 
@@ -408,24 +454,35 @@ int ieee802154_send(ieee802154_submac_t *submac, const iolist_t *iolist)
     ieee802154_fsm_state_t current_state = submac->fsm_state;
 
     if (current_state != IEEE802154_FSM_STATE_RX && current_state != IEEE802154_FSM_STATE_IDLE) {
+#if IS_ACTIVE(CONFIG_IEEE802154_SUBMAC_PIPELINE)
+        if (submac->next_pending) {
+            return -EBUSY;
+        }
+        if (iolist == NULL) {
+            return 0;
+        }
+        /* the caller may release the frame as soon as this function returns */
+        ssize_t len = iolist_to_buffer(iolist, submac->next_frame,
+                                       sizeof(submac->next_frame));
+        if (len < 0) {
+            return -EMSGSIZE;
+        }
+        submac->next_psdu.iol_next = NULL;
+        submac->next_psdu.iol_base = submac->next_frame;
+        submac->next_psdu.iol_len = len;
+        submac->next_pending = true;
+        return 0;
+#else
         return -EBUSY;
+#endif
     }
 
     if (iolist == NULL) {
         return 0;
     }
 
-    uint8_t *buf = iolist->iol_base;
-    bool cnf = buf[0] & IEEE802154_FCF_ACK_REQ;
-
-    submac->wait_for_ack = cnf;
-    submac->psdu = iolist;
-    submac->retrans = 0;
-    submac->csma_retries_nb = 0;
-    submac->backoff_mask = (1 << submac->be.min) - 1;
-
-    if (ieee802154_submac_process_ev(submac, IEEE802154_FSM_EV_REQUEST_TX)
-        != IEEE802154_FSM_STATE_PREPARE) {
+    /* a failed request does not change the state */
+    if (_request_tx(submac, iolist) == current_state) {
         return -EBUSY;
     }
     return 0;
@@ -437,6 +494,10 @@ int ieee802154_submac_init(ieee802154_submac_t *submac, const network_uint16_t *
     ieee802154_dev_t *dev = &submac->dev;
 
     submac->fsm_state = IEEE802154_FSM_STATE_RX;
+    submac->bh_pending = false;
+#if IS_ACTIVE(CONFIG_IEEE802154_SUBMAC_PIPELINE)
+    submac->next_pending = false;
+#endif
 
     int res;
 
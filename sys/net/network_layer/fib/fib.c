@@ -29,8 +29,8 @@
 #include "thread.h"
 #include "mutex.h"
 #include "msg.h"
-#include "xtimer.h"
 #include "timex.h"
+#include "ztimer64.h"
 #include "utlist.h"
 
 #define ENABLE_DEBUG 0
@@ -65,12 +65,105 @@ static char addr_str[IPV6_ADDR_MAX_STR_LEN];
  */
 static void fib_lifetime_to_absolute(uint32_t ms, uint64_t *target)
 {
-    *target = xtimer_now_usec64() + (ms * US_PER_MS);
+    *target = ztimer64_now(ZTIMER64_USEC) + (ms * US_PER_MS);
+}
+
+/**
+ * @brief returns the number of leading bits of the destination an entry covers
+ *
+ * Entries are kept in descending order of this length, so the first entry
+ * matching a destination is the most specific one.
+ *
+ * @param[in] entry     a used entry
+ *
+ * @return the prefix length for net prefixes,
+ *         0 for the default route (all zero address),
+ *         the full address length in bits otherwise
+ */
+static unsigned fib_entry_prefix_len(const fib_entry_t *entry)
+{
+    if (entry->global_flags & FIB_FLAG_NET_PREFIX_MASK) {
+        return (entry->global_flags & FIB_FLAG_NET_PREFIX_MASK) >> FIB_FLAG_NET_PREFIX_SHIFT;
+    }
+    for (size_t i = 0; i < entry->global->address_size; i++) {
+        if (entry->global->address[i] != 0) {
+            return entry->global->address_size << 3;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief checks if the first @p bits bits of two addresses are equal
+ */
+static bool fib_prefix_equal(const uint8_t *a, const uint8_t *b, unsigned bits)
+{
+    unsigned bytes = bits >> 3;
+
+    if (memcmp(a, b, bytes) != 0) {
+        return false;
+    }
+    bits &= 0x7;
+    return (bits == 0) || (((a[bytes] ^ b[bytes]) & (0xff << (8 - bits))) == 0);
+}
+
+/**
+ * @brief checks if the lifetime of an entry expired
+ *
+ * @param[in] entry     a used entry
+ * @param[in, out] now  the current time or 0 if it has not been read yet
+ */
+static bool fib_entry_expired(const fib_entry_t *entry, uint64_t *now)
+{
+    if (entry->lifetime == FIB_LIFETIME_NO_EXPIRE) {
+        return false;
+    }
+    if (*now == 0) {
+        *now = ztimer64_now(ZTIMER64_USEC);
+    }
+    return entry->lifetime < *now;
+}
+
+/**
+ * @brief removes the given entry
+ *
+ * The following entries are moved up, so all used entries stay at the start of
+ * the table.
+ *
+ * @param[in] table the FIB table holding the entry
+ * @param[in] entry the entry to be removed
+ *
+ * @return 0 on success
+ */
+static int fib_remove(fib_table_t *table, fib_entry_t *entry)
+{
+    fib_entry_t *end = &table->data.entries[table->size];
+    fib_entry_t *last = entry;
+
+    if (entry->global != NULL) {
+        universal_address_rem(entry->global);
+    }
+
+    if (entry->next_hop) {
+        universal_address_rem(entry->next_hop);
+    }
+
+    while (((last + 1) < end) && ((last + 1)->global != NULL)) {
+        last++;
+    }
+    memmove(entry, entry + 1, (last - entry) * sizeof(fib_entry_t));
+    memset(last, 0, sizeof(fib_entry_t));
+    last->iface_id = KERNEL_PID_UNDEF;
+
+    return 0;
 }
 
 /**
  * @brief returns pointer to the entry for the given destination address
  *
+ * Only the most specific entry matching @p dst is checked for expiry. If it
+ * expired, it is removed and the search goes on.
+ *
  * @param[in] table                the FIB table to search in
  * @param[in] dst                  the destination address
  * @param[in] dst_size             the destination address size
@@ -84,13 +177,7 @@ static void fib_lifetime_to_absolute(uint32_t ms, uint64_t *target)
  */
 static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
                           fib_entry_t **entry_arr, size_t *entry_arr_size) {
-    uint64_t now = xtimer_now_usec64();
-
-    size_t count = 0;
-    size_t prefix_size = 0;
-    size_t match_size = dst_size << 3;
-    int ret = -EHOSTUNREACH;
-    bool is_all_zeros_addr = true;
+    uint64_t now = 0;
 
     if (IS_ACTIVE(ENABLE_DEBUG)) {
         DEBUG("[fib_find_entry] dst =");
@@ -100,97 +187,38 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
         DEBUG("\n");
     }
 
-    for (size_t i = 0; i < dst_size; ++i) {
-        if (dst[i] != 0) {
-            is_all_zeros_addr = false;
-            break;
-        }
-    }
-
-    for (size_t i = 0; i < table->size; ++i) {
-
-        /* autoinvalidate if the entry lifetime is not set to not expire */
-        if (table->data.entries[i].lifetime != FIB_LIFETIME_NO_EXPIRE) {
-
-            /* check if the lifetime expired */
-            if (table->data.entries[i].lifetime < now) {
-                /* remove this entry if its lifetime expired */
-                table->data.entries[i].lifetime = 0;
-                table->data.entries[i].global_flags = 0;
-                table->data.entries[i].next_hop_flags = 0;
-                table->data.entries[i].iface_id = KERNEL_PID_UNDEF;
+    for (size_t i = 0; (i < table->size) && (table->data.entries[i].global != NULL); ) {
+        fib_entry_t *entry = &table->data.entries[i];
+        universal_address_container_t *global = entry->global;
+        unsigned prefix_len = fib_entry_prefix_len(entry);
 
-                if (table->data.entries[i].global != NULL) {
-                    universal_address_rem(table->data.entries[i].global);
-                    table->data.entries[i].global = NULL;
-                }
-
-                if (table->data.entries[i].next_hop != NULL) {
-                    universal_address_rem(table->data.entries[i].next_hop);
-                    table->data.entries[i].next_hop = NULL;
-                }
-            }
+        if ((global->address_size != dst_size) ||
+            (prefix_len > (dst_size << 3)) ||
+            !fib_prefix_equal(global->address, dst, prefix_len)) {
+            i++;
+            continue;
         }
-
-        if ((prefix_size < (dst_size<<3)) && (table->data.entries[i].global != NULL)) {
-
-            int ret_comp = universal_address_compare(table->data.entries[i].global, dst,
-                                                     &match_size);
-            /* If we found an exact match */
-            if ((ret_comp == UNIVERSAL_ADDRESS_EQUAL)
-                || (is_all_zeros_addr && (ret_comp == UNIVERSAL_ADDRESS_IS_ALL_ZERO_ADDRESS))) {
-                entry_arr[0] = &(table->data.entries[i]);
-                *entry_arr_size = 1;
-                /* we will not find a better one so we return */
-                return 1;
-            }
-            else {
-                /* we try to find the most fitting prefix */
-                if (ret_comp == UNIVERSAL_ADDRESS_MATCHING_PREFIX) {
-                    if (table->data.entries[i].global_flags & FIB_FLAG_NET_PREFIX_MASK) {
-                        /* we shift the most upper flag byte back to get the number of prefix bits */
-                        uint32_t global_prefix_len = (table->data.entries[i].global_flags
-                                                   & FIB_FLAG_NET_PREFIX_MASK) >> FIB_FLAG_NET_PREFIX_SHIFT;
-
-                        if ((match_size >= global_prefix_len) &&
-                            ((prefix_size == 0) || (match_size > prefix_size))) {
-                            entry_arr[0] = &(table->data.entries[i]);
-                            /* we could find a better one so we move on */
-                            ret = 0;
-
-                            prefix_size = match_size;
-                            count = 1;
-                        }
-                    }
-                 }
-                 else if (ret_comp == UNIVERSAL_ADDRESS_IS_ALL_ZERO_ADDRESS) {
-                    /* we found the default gateway entry, e.g. ::/0 for IPv6
-                     * and we keep it only if there is no better one
-                     */
-                    if (prefix_size == 0) {
-                        entry_arr[0] = &(table->data.entries[i]);
-                        /* we could find a better one so we move on */
-                        ret = 0;
-                        count = 1;
-                    }
-                }
-                match_size = dst_size<<3;
-            }
+        if (fib_entry_expired(entry, &now)) {
+            /* the next entry moves up to index i */
+            fib_remove(table, entry);
+            continue;
         }
-    }
 
-    if (IS_ACTIVE(ENABLE_DEBUG)) {
-        if (count > 0) {
-            DEBUG("[fib_find_entry] found prefix on interface %d:", entry_arr[0]->iface_id);
-            for (size_t i = 0; i < entry_arr[0]->global->address_size; i++) {
-                DEBUG(" %02x", entry_arr[0]->global->address[i]);
+        if (IS_ACTIVE(ENABLE_DEBUG)) {
+            DEBUG("[fib_find_entry] found prefix on interface %d:", entry->iface_id);
+            for (size_t j = 0; j < global->address_size; j++) {
+                DEBUG(" %02x", global->address[j]);
             }
             DEBUG("\n");
         }
+
+        entry_arr[0] = entry;
+        *entry_arr_size = 1;
+        return (memcmp(global->address, dst, dst_size) == 0) ? 1 : 0;
     }
 
-    *entry_arr_size = count;
-    return ret;
+    *entry_arr_size = 0;
+    return -EHOSTUNREACH;
 }
 
 /**
@@ -232,6 +260,9 @@ static int fib_upd_entry(fib_entry_t *entry, uint8_t *next_hop,
 /**
  * @brief creates a new FIB entry with the provided parameters
  *
+ * The entry is inserted after all entries with a longer or equal prefix length.
+ * If the table is full, expired entries are removed first.
+ *
  * @param[in] table          the FIB table to create the entry in
  * @param[in] iface_id       the interface ID
  * @param[in] dst            the destination address
@@ -250,60 +281,58 @@ static int fib_create_entry(fib_table_t *table, kernel_pid_t iface_id,
                             uint8_t *next_hop, size_t next_hop_size, uint32_t
                             next_hop_flags, uint32_t lifetime)
 {
-    for (size_t i = 0; i < table->size; ++i) {
-        if (table->data.entries[i].lifetime == 0) {
-
-            table->data.entries[i].global = universal_address_add(dst, dst_size);
-
-            if (table->data.entries[i].global != NULL) {
-                table->data.entries[i].global_flags = dst_flags;
-                table->data.entries[i].next_hop = universal_address_add(next_hop, next_hop_size);
-                table->data.entries[i].next_hop_flags = next_hop_flags;
+    fib_entry_t new_entry = {
+        .iface_id = iface_id,
+        .global_flags = dst_flags,
+        .next_hop_flags = next_hop_flags,
+    };
+
+    if ((table->size == 0) ||
+        (table->data.entries[table->size - 1].global != NULL)) {
+        uint64_t now = 0;
+
+        for (size_t i = 0; (i < table->size) && (table->data.entries[i].global != NULL); ) {
+            if (fib_entry_expired(&table->data.entries[i], &now)) {
+                fib_remove(table, &table->data.entries[i]);
             }
-
-            if (table->data.entries[i].next_hop != NULL) {
-                /* everything worked fine */
-                table->data.entries[i].iface_id = iface_id;
-
-                if (lifetime != (uint32_t) FIB_LIFETIME_NO_EXPIRE) {
-                    fib_lifetime_to_absolute(lifetime, &table->data.entries[i].lifetime);
-                }
-                else {
-                    table->data.entries[i].lifetime = FIB_LIFETIME_NO_EXPIRE;
-                }
-
-                return 0;
+            else {
+                i++;
             }
         }
+        if ((table->size == 0) ||
+            (table->data.entries[table->size - 1].global != NULL)) {
+            return -ENOMEM;
+        }
     }
 
-    return -ENOMEM;
-}
-
-/**
- * @brief removes the given entry
- *
- * @param[in] entry the entry to be removed
- *
- * @return 0 on success
- */
-static int fib_remove(fib_entry_t *entry)
-{
-    if (entry->global != NULL) {
-        universal_address_rem(entry->global);
+    new_entry.global = universal_address_add(dst, dst_size);
+    if (new_entry.global == NULL) {
+        return -ENOMEM;
     }
-
-    if (entry->next_hop) {
-        universal_address_rem(entry->next_hop);
+    new_entry.next_hop = universal_address_add(next_hop, next_hop_size);
+    if (new_entry.next_hop == NULL) {
+        universal_address_rem(new_entry.global);
+        return -ENOMEM;
+    }
+    if (lifetime != (uint32_t) FIB_LIFETIME_NO_EXPIRE) {
+        fib_lifetime_to_absolute(lifetime, &new_entry.lifetime);
+    }
+    else {
+        new_entry.lifetime = FIB_LIFETIME_NO_EXPIRE;
     }
 
-    entry->global = NULL;
-    entry->global_flags = 0;
-    entry->next_hop = NULL;
-    entry->next_hop_flags = 0;
+    unsigned prefix_len = fib_entry_prefix_len(&new_entry);
+    size_t pos = 0;
+    size_t used;
 
-    entry->iface_id = KERNEL_PID_UNDEF;
-    entry->lifetime = 0;
+    while ((pos < table->size) && (table->data.entries[pos].global != NULL) &&
+           (fib_entry_prefix_len(&table->data.entries[pos]) >= prefix_len)) {
+        pos++;
+    }
+    for (used = pos; table->data.entries[used].global != NULL; used++) {}
+    memmove(&table->data.entries[pos + 1], &table->data.entries[pos],
+            (used - pos) * sizeof(fib_entry_t));
+    table->data.entries[pos] = new_entry;
 
     return 0;
 }
@@ -462,7 +491,7 @@ void fib_remove_entry(fib_table_t *table, uint8_t *dst, size_t dst_size)
 
     if (ret == 1) {
         /* we must take the according entry and update the values */
-        fib_remove(entry[0]);
+        fib_remove(table, entry[0]);
     }
     else {
         /* we have ambiguous entries, i.e. count > 1
@@ -479,10 +508,13 @@ void fib_flush(fib_table_t *table, kernel_pid_t interface)
     mutex_lock(&(table->mtx_access));
     DEBUG("[fib_flush]\n");
 
-    for (size_t i = 0; i < table->size; ++i) {
+    for (size_t i = 0; (i < table->size) && (table->data.entries[i].global != NULL); ) {
         if ((interface == KERNEL_PID_UNDEF) ||
             (interface == table->data.entries[i].iface_id)) {
-            fib_remove(&table->data.entries[i]);
+            fib_remove(table, &table->data.entries[i]);
+        }
+        else {
+            i++;
         }
     }
 
@@ -711,7 +743,7 @@ int fib_sr_create(fib_table_t *table, fib_sr_t **fib_sr, kernel_pid_t sr_iface_i
 */
 static int fib_sr_check_lifetime(fib_sr_t *fib_sr)
 {
-    uint64_t tm = fib_sr->sr_lifetime - xtimer_now_usec64();
+    uint64_t tm = fib_sr->sr_lifetime - ztimer64_now(ZTIMER64_USEC);
     /* check if the lifetime expired */
     if ((int64_t)tm < 0) {
         /* remove this sr if its lifetime expired */
@@ -786,7 +818,7 @@ int fib_sr_read_head(fib_table_t *table, fib_sr_t *fib_sr, kernel_pid_t *iface_i
 
     *iface_id = fib_sr->sr_iface_id;
     *sr_flags = fib_sr->sr_flags;
-    *sr_lifetime = fib_sr->sr_lifetime - xtimer_now_usec64();
+    *sr_lifetime = fib_sr->sr_lifetime - ztimer64_now(ZTIMER64_USEC);
 
     mutex_unlock(&(table->mtx_access));
     return 0;
@@ -1548,7 +1580,7 @@ static void fib_print_address(universal_address_container_t *entry)
 void fib_print_routes(fib_table_t *table)
 {
     mutex_lock(&(table->mtx_access));
-    uint64_t now = xtimer_now_usec64();
+    uint64_t now = ztimer64_now(ZTIMER64_USEC);
 
     if (table->table_type == FIB_TABLE_TYPE_SH) {
         printf("%-" FIB_ADDR_PRINT_LENS "s %-17s %-" FIB_ADDR_PRINT_LENS "s %-10s %-16s"
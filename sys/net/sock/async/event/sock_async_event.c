@@ -17,6 +17,8 @@
 #include "net/sock/async/event.h"
 
 #ifdef MODULE_FUZZING
+#include "fuzzing.h"
+
 extern gnrc_pktsnip_t *gnrc_pktbuf_fuzzptr;
 extern gnrc_pktsnip_t *gnrc_sock_prevpkt;
 #endif
@@ -45,11 +47,12 @@ static inline void _cb(void *sock, sock_async_flags_t type, void *arg,
     /* The fuzzing module is only enabled when building a fuzzing
      * application from the fuzzing/ subdirectory. The fuzzing setup
      * assumes that gnrc_sock_recv is called by the event callback. If
-     * the value returned by gnrc_sock_recv was the fuzzing packet, the
-     * fuzzing application is terminated as input processing finished. */
+     * the value returned by gnrc_sock_recv was the fuzzing packet, input
+     * processing has completed. */
 #ifdef MODULE_FUZZING
     if (gnrc_sock_prevpkt && gnrc_sock_prevpkt == gnrc_pktbuf_fuzzptr) {
-        exit(EXIT_SUCCESS);
+        gnrc_sock_prevpkt = NULL;
+        fuzzing_done();
     }
 #endif
 }
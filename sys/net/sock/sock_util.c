@@ -356,6 +356,44 @@ bool sock_tl_ep_equal(const struct _sock_tl_ep *a,
     }
 }
 
+#if defined(MODULE_SOCK_UDP)
+int sock_udp_recv_batch(sock_udp_t *sock, sock_udp_msg_t *msgs, unsigned num,
+                        uint32_t timeout)
+{
+    unsigned i;
+
+    assert((sock != NULL) && (msgs != NULL) && (num > 0));
+    for (i = 0; i < num; i++) {
+        /* only wait for the first datagram, take queued ones after it */
+        ssize_t res = sock_udp_recv(sock, msgs[i].data, msgs[i].len,
+                                    (i == 0) ? timeout : 0, msgs[i].remote);
+
+        if (res < 0) {
+            return (i == 0) ? res : (int)i;
+        }
+        msgs[i].len = res;
+    }
+    return i;
+}
+
+int sock_udp_send_batch(sock_udp_t *sock, const sock_udp_msg_t *msgs,
+                        unsigned num)
+{
+    unsigned i;
+
+    assert((sock != NULL) && (msgs != NULL) && (num > 0));
+    for (i = 0; i < num; i++) {
+        ssize_t res = sock_udp_send(sock, msgs[i].data, msgs[i].len,
+                                    msgs[i].remote);
+
+        if (res < 0) {
+            return (i == 0) ? res : (int)i;
+        }
+    }
+    return i;
+}
+#endif
+
 #if defined(MODULE_SOCK_DTLS)
 int sock_dtls_establish_session(sock_udp_t *sock_udp, sock_dtls_t *sock_dtls,
                                 sock_dtls_session_t *session, credman_tag_t tag,
@@ -0,0 +1,306 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @author  RIOT developers <devel@riot-os.org>
+ */
+
+#include <assert.h>
+#include <inttypes.h>
+
+#include "bitarithm.h"
+#include "clist.h"
+#include "container.h"
+#include "net/rdgram.h"
+
+#define ENABLE_DEBUG    0
+#include "debug.h"
+
+static inline rdgram_msg_t *_msg(rdgram_t *rd, uint32_t seq)
+{
+    return &rd->msgs[seq % rd->msgs_numof];
+}
+
+static inline bool _acked(const rdgram_t *rd, uint32_t seq)
+{
+    return rd->acked & (1UL << (seq - rd->base));
+}
+
+static inline bool _in_flight(const rdgram_t *rd, uint32_t seq)
+{
+    return ((seq - rd->base) < (rd->next - rd->base)) && !_acked(rd, seq);
+}
+
+/* in flight and neither acknowledged nor waiting for retransmission */
+static inline bool _pending(const rdgram_t *rd, uint32_t seq)
+{
+    return !_acked(rd, seq) && !(rd->lost & (1UL << (seq - rd->base)));
+}
+
+static void _transmit(rdgram_t *rd, rdgram_msg_t *msg, uint32_t now)
+{
+    int res = rd->send(rd, msg->seq, rd->arg);
+
+    msg->super.send_time = now;
+    if (res < 0) {
+        DEBUG("rdgram: sending %" PRIu32 " failed (%d)\n", msg->seq, res);
+        /* retransmitted after the timeout */
+        msg->super.size = 0;
+        return;
+    }
+    msg->super.size = res;
+    rd->in_flight += res;
+    rd->cong->driver->report_msg_sent(rd->cong, res);
+}
+
+static void _take_lost(rdgram_t *rd, clist_node_t *list, rdgram_msg_t *msg)
+{
+    /* the congestion control reduces its flight size itself */
+    rd->in_flight -= msg->super.size;
+    clist_rpush(list, &msg->super.super);
+}
+
+static void _mark_lost(rdgram_t *rd, clist_node_t *list)
+{
+    clist_node_t *node;
+
+    while ((node = clist_lpop(list)) != NULL) {
+        rdgram_msg_t *msg = container_of(node, rdgram_msg_t, super.super);
+
+        DEBUG("rdgram: %" PRIu32 " lost\n", msg->seq);
+        /* not in flight anymore, in case the original arrives after all */
+        msg->super.size = 0;
+        rd->lost |= 1UL << (msg->seq - rd->base);
+    }
+}
+
+static bool _can_send(const rdgram_t *rd)
+{
+    return ((rd->lost != 0) ||
+            ((rd->next != rd->num) && ((rd->next - rd->base) < rd->msgs_numof))) &&
+           ((rd->in_flight + rd->msg_size) <= rd->cong->cwnd);
+}
+
+static void _update_rto(rdgram_t *rd, uint32_t rtt)
+{
+    /* see https://tools.ietf.org/html/rfc6298#section-2 */
+    if (rd->srtt == 0) {
+        rd->srtt = rtt;
+        rd->rttvar = rtt / 2;
+    }
+    else {
+        uint32_t diff = (rd->srtt > rtt) ? (rd->srtt - rtt) : (rtt - rd->srtt);
+
+        rd->rttvar = ((3 * rd->rttvar) + diff) / 4;
+        rd->srtt = ((7 * rd->srtt) + rtt) / 8;
+    }
+    rd->rto = rd->srtt + (4 * rd->rttvar);
+    if (rd->rto < CONFIG_RDGRAM_RTO_MIN_MS) {
+        rd->rto = CONFIG_RDGRAM_RTO_MIN_MS;
+    }
+    else if (rd->rto > CONFIG_RDGRAM_RTO_MAX_MS) {
+        rd->rto = CONFIG_RDGRAM_RTO_MAX_MS;
+    }
+}
+
+static void _ack_msg(rdgram_t *rd, uint32_t seq, uint32_t now)
+{
+    rdgram_msg_t *msg = _msg(rd, seq);
+    congure_snd_ack_t ack = {
+        .recv_time = now,
+        /* the ACK IDs only increase, so none are taken as duplicate */
+        .id = rd->acks++,
+        .clean = true,
+    };
+
+    if (msg->super.resends == 0) {
+        /* Karn's algorithm: no samples from retransmissions */
+        _update_rto(rd, now - msg->super.send_time);
+    }
+    rd->acked |= 1UL << (seq - rd->base);
+    rd->lost &= ~(1UL << (seq - rd->base));
+    rd->in_flight -= msg->super.size;
+    rd->cong->driver->report_msg_acked(rd->cong, &msg->super, &ack);
+}
+
+void rdgram_init(rdgram_t *rd, congure_snd_t *cong, rdgram_msg_t *msgs,
+                 unsigned msgs_numof, uint32_t num, uint16_t msg_size,
+                 rdgram_send_t send, void *arg)
+{
+    assert((msgs_numof > 0) && (msgs_numof <= RDGRAM_WND_MAX));
+    rd->cong = cong;
+    rd->send = send;
+    rd->arg = arg;
+    rd->msgs = msgs;
+    rd->msgs_numof = msgs_numof;
+    rd->num = num;
+    rd->msg_size = msg_size;
+    rd->acked = 0;
+    rd->lost = 0;
+    rd->base = 0;
+    rd->next = 0;
+    rd->acks = 0;
+    rd->last_tx = 0;
+    rd->pace = 0;
+    rd->srtt = 0;
+    rd->rttvar = 0;
+    rd->rto = CONFIG_RDGRAM_RTO_INIT_MS;
+    rd->in_flight = 0;
+}
+
+uint32_t rdgram_poll(rdgram_t *rd, uint32_t now)
+{
+    clist_node_t timed_out = { .next = NULL };
+    uint32_t timeout = RDGRAM_NO_TIMEOUT;
+
+    if (rdgram_done(rd)) {
+        return RDGRAM_NO_TIMEOUT;
+    }
+    for (uint32_t seq = rd->base; seq != rd->next; seq++) {
+        rdgram_msg_t *msg = _msg(rd, seq);
+
+        if (_pending(rd, seq) && ((now - msg->super.send_time) >= rd->rto)) {
+            _take_lost(rd, &timed_out, msg);
+        }
+    }
+    if (timed_out.next != NULL) {
+        rd->cong->driver->report_msgs_timeout(rd->cong,
+                                              (congure_snd_msg_t *)&timed_out);
+        /* see https://tools.ietf.org/html/rfc6298#section-5 (5.5) */
+        rd->rto *= 2;
+        if (rd->rto > CONFIG_RDGRAM_RTO_MAX_MS) {
+            rd->rto = CONFIG_RDGRAM_RTO_MAX_MS;
+        }
+        _mark_lost(rd, &timed_out);
+    }
+    /* retransmissions go first, both are limited by the congestion window */
+    while (_can_send(rd) && ((now - rd->last_tx) >= rd->pace)) {
+        int32_t interval = rd->cong->driver->inter_msg_interval(rd->cong,
+                                                                rd->msg_size);
+        rdgram_msg_t *msg;
+
+        if (rd->lost != 0) {
+            unsigned i = bitarithm_lsb(rd->lost);
+
+            rd->lost &= ~(1UL << i);
+            msg = _msg(rd, rd->base + i);
+            DEBUG("rdgram: retransmitting %" PRIu32 "\n", msg->seq);
+            if (msg->super.resends < UINT8_MAX) {
+                msg->super.resends++;
+            }
+        }
+        else {
+            msg = _msg(rd, rd->next);
+            msg->seq = rd->next++;
+            msg->super.resends = 0;
+        }
+        _transmit(rd, msg, now);
+        rd->last_tx = now;
+        rd->pace = (interval > 0) ? (interval / 1000) : 0;
+    }
+    for (uint32_t seq = rd->base; seq != rd->next; seq++) {
+        if (_pending(rd, seq)) {
+            uint32_t left = rd->rto - (now - _msg(rd, seq)->super.send_time);
+
+            if (left < timeout) {
+                timeout = left;
+            }
+        }
+    }
+    if (_can_send(rd) && ((rd->pace - (now - rd->last_tx)) < timeout)) {
+        /* waiting for pacing only */
+        timeout = rd->pace - (now - rd->last_tx);
+    }
+    return timeout;
+}
+
+void rdgram_ack(rdgram_t *rd, uint32_t next, uint32_t sack, uint32_t now)
+{
+    clist_node_t lost = { .next = NULL };
+    uint32_t highest = rd->base;
+    bool highest_valid = false;
+
+    if ((next - rd->base) > (rd->next - rd->base)) {
+        DEBUG("rdgram: ACK for %" PRIu32 " out of window\n", next);
+        return;
+    }
+    for (uint32_t seq = rd->base; seq != next; seq++) {
+        if (!_acked(rd, seq)) {
+            _ack_msg(rd, seq, now);
+        }
+        highest = seq;
+        highest_valid = true;
+    }
+    for (unsigned i = 0; (i < 32) && (sack >> i); i++) {
+        uint32_t seq = next + 1 + i;
+
+        if (!(sack & (1UL << i)) || !_in_flight(rd, seq)) {
+            continue;
+        }
+        _ack_msg(rd, seq, now);
+        highest = seq;
+        highest_valid = true;
+    }
+    if (highest_valid) {
+        /* a datagram is lost when enough datagrams sent after it arrived */
+        uint32_t highest_sent = _msg(rd, highest)->super.send_time;
+
+        for (uint32_t seq = rd->base; seq != rd->next; seq++) {
+            rdgram_msg_t *msg = _msg(rd, seq);
+
+            if (_pending(rd, seq) &&
+                ((highest - seq) >= CONFIG_RDGRAM_REORDER_THRESH) &&
+                ((int32_t)(highest - seq) > 0) &&
+                ((int32_t)(highest_sent - msg->super.send_time) >= 0)) {
+                _take_lost(rd, &lost, msg);
+            }
+        }
+    }
+    if (lost.next != NULL) {
+        rd->cong->driver->report_msgs_lost(rd->cong,
+                                           (congure_snd_msg_t *)&lost);
+        _mark_lost(rd, &lost);
+    }
+    while ((rd->base != rd->next) && (rd->acked & 1)) {
+        rd->acked >>= 1;
+        rd->lost >>= 1;
+        rd->base++;
+    }
+}
+
+int rdgram_rcv(rdgram_rcv_t *rcv, uint32_t seq)
+{
+    uint32_t offset = seq - rcv->next;
+
+    if ((int32_t)offset < 0) {
+        return 0;
+    }
+    if (offset == 0) {
+        rcv->next++;
+        /* bit 0 is now the new next datagram */
+        while (rcv->sack & 1) {
+            rcv->sack >>= 1;
+            rcv->next++;
+        }
+        rcv->sack >>= 1;
+        return 1;
+    }
+    if (offset > 32) {
+        return -1;
+    }
+    if (rcv->sack & (1UL << (offset - 1))) {
+        return 0;
+    }
+    rcv->sack |= 1UL << (offset - 1);
+    return 1;
+}
+
+/** @} */
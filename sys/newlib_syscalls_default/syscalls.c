@@ -50,6 +50,11 @@
 #include "div.h"
 #include "xtimer.h"
 #endif
+#ifdef MODULE_WALLCLOCK
+#include <sys/time.h>
+#include "div.h"
+#include "wallclock.h"
+#endif
 
 #ifndef NUM_HEAPS
 #define NUM_HEAPS 1
@@ -641,7 +646,11 @@ int _gettimeofday_r(struct _reent *r, struct timeval *restrict tp, void *restric
 {
     (void)tzp;
     (void)r;
+#if IS_USED(MODULE_WALLCLOCK)
+    uint64_t now = wallclock_now_usec();
+#else
     uint64_t now = xtimer_now_usec64();
+#endif
     tp->tv_sec = div_u64_by_1000000(now);
     tp->tv_usec = now - (tp->tv_sec * US_PER_SEC);
     return 0;
@@ -0,0 +1,212 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_objcache
+ * @{
+ *
+ * @file
+ * @brief       Object cache implementation
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "architecture.h"
+#include "irq.h"
+#include "kernel_defines.h"
+#include "mutex.h"
+#include "objcache.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/* list of all caches, for objcache_stats() */
+static objcache_t *_caches;
+static mutex_t _caches_lock = MUTEX_INIT;
+
+static void _register(objcache_t *cache)
+{
+    mutex_lock(&_caches_lock);
+    cache->next = _caches;
+    _caches = cache;
+    mutex_unlock(&_caches_lock);
+}
+
+static void _poison(const objcache_t *cache, void *obj)
+{
+    memset(obj, OBJCACHE_POISON_BYTE, cache->free.size);
+}
+
+static bool _poison_intact(const objcache_t *cache, const void *obj)
+{
+    /* the first bytes hold the free list pointer */
+    const uint8_t *pos = (const uint8_t *)obj + sizeof(void *);
+    const uint8_t *end = (const uint8_t *)obj + cache->free.size;
+
+    for (; pos < end; pos++) {
+        if (*pos != OBJCACHE_POISON_BYTE) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void objcache_init(objcache_t *cache, void *buf, size_t size, size_t align,
+                   size_t count, const objcache_params_t *params)
+{
+    assert((cache != NULL) && (buf != NULL));
+    assert((align != 0) && ((align & (align - 1)) == 0));
+    assert(((uintptr_t)buf & (align - 1)) == 0);
+    assert((count != 0) && (count <= UINT16_MAX));
+
+    size_t stride = OBJCACHE_STRIDE(size, align);
+
+    DEBUG("objcache: init %p with %" PRIuSIZE " objects of %" PRIuSIZE
+          " bytes at %p\n", (void *)cache, count, stride, buf);
+
+    memset(cache, 0, sizeof(*cache));
+    cache->params = params;
+    cache->data = buf;
+    cache->obj_size = size;
+    cache->count = count;
+
+    if (IS_ACTIVE(CONFIG_OBJCACHE_POISON)) {
+        memset(buf, OBJCACHE_POISON_BYTE, stride * count);
+    }
+    memarray_init(&cache->free, buf, stride, count);
+
+    _register(cache);
+}
+
+objcache_t *objcache_create(size_t size, size_t align, size_t count,
+                            const objcache_params_t *params)
+{
+    assert((align != 0) && ((align & (align - 1)) == 0));
+
+    /* malloc() only guarantees the alignment of fundamental types */
+    objcache_t *cache = malloc(sizeof(objcache_t) + align - 1 +
+                               OBJCACHE_BUF_SIZE(size, align, count));
+
+    if (cache == NULL) {
+        return NULL;
+    }
+
+    void *buf = (void *)(((uintptr_t)(cache + 1) + align - 1) &
+                         ~(uintptr_t)(align - 1));
+
+    objcache_init(cache, buf, size, align, count, params);
+    cache->allocated = true;
+    return cache;
+}
+
+int objcache_destroy(objcache_t *cache)
+{
+    assert(cache != NULL);
+
+    if (cache->used) {
+        return -EBUSY;
+    }
+
+    mutex_lock(&_caches_lock);
+    for (objcache_t **pos = &_caches; *pos; pos = &(*pos)->next) {
+        if (*pos == cache) {
+            *pos = cache->next;
+            break;
+        }
+    }
+    mutex_unlock(&_caches_lock);
+
+    if (cache->allocated) {
+        free(cache);
+    }
+    return 0;
+}
+
+void *objcache_alloc(objcache_t *cache)
+{
+    assert(cache != NULL);
+
+    unsigned state = irq_disable();
+    void *obj = memarray_alloc(&cache->free);
+    if (obj) {
+        if (++cache->used > cache->used_max) {
+            cache->used_max = cache->used;
+        }
+    }
+    else if (cache->fails < UINT16_MAX) {
+        cache->fails++;
+    }
+    irq_restore(state);
+
+    if (obj == NULL) {
+        return NULL;
+    }
+
+    if (IS_ACTIVE(CONFIG_OBJCACHE_POISON) && !_poison_intact(cache, obj)) {
+        printf("objcache: %p modified after free\n", obj);
+        assert(0);
+    }
+
+    const objcache_params_t *params = cache->params;
+    if (params && params->ctor) {
+        params->ctor(obj, params->arg);
+    }
+    return obj;
+}
+
+void objcache_free(objcache_t *cache, void *obj)
+{
+    assert(cache != NULL);
+
+    if (obj == NULL) {
+        return;
+    }
+
+    assert(((uint8_t *)obj >= cache->data) &&
+           ((uint8_t *)obj < cache->data + cache->free.size * cache->count));
+    assert((((uint8_t *)obj - cache->data) % cache->free.size) == 0);
+
+    const objcache_params_t *params = cache->params;
+    if (params && params->dtor) {
+        params->dtor(obj, params->arg);
+    }
+    if (IS_ACTIVE(CONFIG_OBJCACHE_POISON)) {
+        _poison(cache, obj);
+    }
+
+    unsigned state = irq_disable();
+    assert(cache->used > 0);
+    memarray_free(&cache->free, obj);
+    cache->used--;
+    irq_restore(state);
+}
+
+void objcache_stats(void)
+{
+    printf("%-16s %6s %6s %6s %6s %6s\n",
+           "name", "size", "count", "used", "max", "fails");
+
+    mutex_lock(&_caches_lock);
+    for (objcache_t *cache = _caches; cache; cache = cache->next) {
+        const char *name = (cache->params && cache->params->name)
+                         ? cache->params->name : "?";
+
+        printf("%-16s %6" PRIuSIZE " %6u %6u %6u %6u\n",
+               name, cache->obj_size, cache->count, cache->used,
+               cache->used_max, cache->fails);
+    }
+    mutex_unlock(&_caches_lock);
+}
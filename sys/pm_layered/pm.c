@@ -19,11 +19,21 @@
  */
 
 #include <assert.h>
+#include <inttypes.h>
 
 #include "board.h"
+#include "kernel_defines.h"
 #include "irq.h"
 #include "periph/pm.h"
 #include "pm_layered.h"
+#if IS_USED(MODULE_PM_LAYERED_TICKLESS)
+#include "time_units.h"
+#include "ztimer.h"
+#endif
+#if IS_USED(MODULE_PM_LAYERED_THREAD)
+#include "sched.h"
+#include "thread.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -55,16 +65,52 @@
  */
 static pm_blocker_t pm_blocker = { .blockers = PM_BLOCKER_INITIAL };
 
+#if IS_USED(MODULE_PM_LAYERED_TICKLESS)
+#ifndef PM_WAKEUP_LATENCY_US
+#define PM_WAKEUP_LATENCY_US { 0 }
+#endif
+
+static const uint32_t _wakeup_latency_us[PM_NUM_MODES] = PM_WAKEUP_LATENCY_US;
+
+/* time in us until the earliest timer on any of the default clocks fires */
+static uint32_t _idle_window_us(void)
+{
+    uint32_t window = UINT32_MAX;
+
+#if IS_USED(MODULE_ZTIMER_USEC)
+    window = ztimer_until_next(ZTIMER_USEC);
+#endif
+#if IS_USED(MODULE_ZTIMER_MSEC)
+    uint32_t msec = ztimer_until_next(ZTIMER_MSEC);
+    if (msec < (window / US_PER_MS)) {
+        window = msec * US_PER_MS;
+    }
+#endif
+
+    return window;
+}
+#endif
+
 void pm_set_lowest(void)
 {
     unsigned mode = PM_NUM_MODES;
 
     /* set lowest mode if blocker is still the same */
     unsigned state = irq_disable();
+#if IS_USED(MODULE_PM_LAYERED_TICKLESS)
+    uint32_t window = _idle_window_us();
+    DEBUG("[pm_layered] idle window: %" PRIu32 " us\n", window);
+#endif
     while (mode) {
         if (pm_blocker.blockers[mode - 1]) {
             break;
         }
+#if IS_USED(MODULE_PM_LAYERED_TICKLESS)
+        /* modes are sorted by depth, so all lower modes take even longer */
+        if (_wakeup_latency_us[mode - 1] >= window) {
+            break;
+        }
+#endif
         mode--;
     }
 
@@ -94,6 +140,48 @@ void pm_unblock(unsigned mode)
     irq_restore(state);
 }
 
+#if IS_USED(MODULE_PM_LAYERED_THREAD)
+/* modes blocked by each thread, one bit per mode */
+static uint8_t _thread_blocked[MAXTHREADS];
+
+static_assert(PM_NUM_MODES <= 8, "modes must fit into a byte");
+
+void pm_thread_block(unsigned mode)
+{
+    kernel_pid_t pid = thread_getpid();
+
+    unsigned state = irq_disable();
+    if (!(_thread_blocked[pid] & (1U << mode))) {
+        _thread_blocked[pid] |= 1U << mode;
+        pm_block(mode);
+    }
+    irq_restore(state);
+}
+
+void pm_thread_unblock(unsigned mode)
+{
+    kernel_pid_t pid = thread_getpid();
+
+    unsigned state = irq_disable();
+    if (_thread_blocked[pid] & (1U << mode)) {
+        _thread_blocked[pid] &= ~(1U << mode);
+        pm_unblock(mode);
+    }
+    irq_restore(state);
+}
+
+/* called by sched_task_exit() with interrupts disabled */
+void pm_thread_exit(kernel_pid_t pid)
+{
+    for (unsigned mode = 0; _thread_blocked[pid]; mode++) {
+        if (_thread_blocked[pid] & (1U << mode)) {
+            _thread_blocked[pid] &= ~(1U << mode);
+            pm_unblock(mode);
+        }
+    }
+}
+#endif
+
 pm_blocker_t pm_get_blocker(void)
 {
     pm_blocker_t result;
@@ -0,0 +1,350 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ * @file
+ * @author  RIOT developers <devel@riot-os.org>
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdbool.h>
+#include <sys/epoll.h>
+
+#include "clist.h"
+#include "container.h"
+#include "irq.h"
+#include "mutex.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "vfs.h"
+#include "ztimer.h"
+
+#if IS_USED(MODULE_POSIX_SOCKETS)
+extern bool posix_socket_is(int fd);
+extern unsigned posix_socket_avail(int fd);
+extern int posix_socket_epoll(int fd, void *item);
+#else   /* MODULE_POSIX_SOCKETS */
+static inline bool posix_socket_is(int fd)
+{
+    (void)fd;
+    return false;
+}
+
+static inline unsigned posix_socket_avail(int fd)
+{
+    (void)fd;
+    return 0;
+}
+
+static inline int posix_socket_epoll(int fd, void *item)
+{
+    (void)fd;
+    (void)item;
+    errno = ENOTSUP;
+    return -1;
+}
+#endif  /* IS_USED(MODULE_POSIX_SOCKETS) */
+
+typedef struct {
+    clist_node_t ready;         /**< ready list */
+    thread_t *waiter;           /**< thread in epoll_wait() */
+    bool used;                  /**< instance is open */
+} _epoll_t;
+
+typedef struct {
+    clist_node_t node;          /**< node in ready list */
+    _epoll_t *ep;               /**< instance, NULL if unused */
+    struct epoll_event event;   /**< event and user data */
+    int fd;                     /**< the file descriptor */
+    bool queued;                /**< node is in ready list */
+} _item_t;
+
+static _epoll_t _instances[CONFIG_POSIX_EPOLL_NUMOF];
+static _item_t _items[CONFIG_POSIX_EPOLL_FDS_NUMOF];
+/* protects the interest lists, the ready lists are protected by disabling
+ * IRQs as sock_async callbacks may run in any context */
+static mutex_t _lock = MUTEX_INIT;
+
+static void _queue(_item_t *item)
+{
+    unsigned state = irq_disable();
+
+    if ((item->ep != NULL) && !item->queued &&
+        (item->event.events & EPOLLIN)) {
+        item->queued = true;
+        clist_rpush(&item->ep->ready, &item->node);
+        if (item->ep->waiter != NULL) {
+            thread_flags_set(item->ep->waiter, POSIX_EPOLL_THREAD_FLAG);
+        }
+    }
+    irq_restore(state);
+}
+
+static void _dequeue(_item_t *item)
+{
+    unsigned state = irq_disable();
+
+    if (item->queued) {
+        clist_remove(&item->ep->ready, &item->node);
+        item->queued = false;
+    }
+    irq_restore(state);
+}
+
+static void _item_free(_item_t *item)
+{
+    _dequeue(item);
+    item->ep = NULL;
+}
+
+static _item_t *_item_get(int fd)
+{
+    for (unsigned i = 0; i < CONFIG_POSIX_EPOLL_FDS_NUMOF; i++) {
+        if ((_items[i].ep != NULL) && (_items[i].fd == fd)) {
+            return &_items[i];
+        }
+    }
+    return NULL;
+}
+
+static _epoll_t *_epoll_get(int epfd)
+{
+    const vfs_file_t *file = vfs_file_get(epfd);
+    _epoll_t *ep = (file == NULL) ? NULL : file->private_data.ptr;
+
+    if ((ep >= &_instances[0]) &&
+        (ep <= &_instances[CONFIG_POSIX_EPOLL_NUMOF - 1])) {
+        return ep;
+    }
+    return NULL;
+}
+
+void posix_epoll_notify(void *item)
+{
+    _queue(item);
+}
+
+void posix_epoll_closed(void *item)
+{
+    mutex_lock(&_lock);
+    _item_free(item);
+    mutex_unlock(&_lock);
+}
+
+static int _epoll_close(vfs_file_t *filp)
+{
+    _epoll_t *ep = filp->private_data.ptr;
+
+    mutex_lock(&_lock);
+    for (unsigned i = 0; i < CONFIG_POSIX_EPOLL_FDS_NUMOF; i++) {
+        if (_items[i].ep == ep) {
+            posix_socket_epoll(_items[i].fd, NULL);
+            _item_free(&_items[i]);
+        }
+    }
+    ep->used = false;
+    mutex_unlock(&_lock);
+    return 0;
+}
+
+static const vfs_file_ops_t _epoll_ops = {
+    .close = _epoll_close,
+};
+
+int epoll_create1(int flags)
+{
+    int res = -1;
+
+    if (flags != 0) {
+        errno = EINVAL;
+        return -1;
+    }
+    mutex_lock(&_lock);
+    errno = EMFILE;
+    for (unsigned i = 0; i < CONFIG_POSIX_EPOLL_NUMOF; i++) {
+        _epoll_t *ep = &_instances[i];
+
+        if (!ep->used) {
+            res = vfs_bind(VFS_ANY_FD, O_RDONLY, &_epoll_ops, ep);
+            if (res >= 0) {
+                ep->used = true;
+                ep->ready.next = NULL;
+                ep->waiter = NULL;
+            }
+            break;
+        }
+    }
+    mutex_unlock(&_lock);
+    return res;
+}
+
+int epoll_create(int size)
+{
+    if (size <= 0) {
+        errno = EINVAL;
+        return -1;
+    }
+    return epoll_create1(0);
+}
+
+static int _ctl_add(_epoll_t *ep, int fd, const struct epoll_event *event)
+{
+    _item_t *item = NULL;
+
+    if (_item_get(fd) != NULL) {
+        errno = EEXIST;
+        return -1;
+    }
+    for (unsigned i = 0; i < CONFIG_POSIX_EPOLL_FDS_NUMOF; i++) {
+        if (_items[i].ep == NULL) {
+            item = &_items[i];
+            break;
+        }
+    }
+    if (item == NULL) {
+        errno = ENOSPC;
+        return -1;
+    }
+    item->fd = fd;
+    item->event = *event;
+    item->queued = false;
+    if (posix_socket_epoll(fd, item) < 0) {
+        return -1;
+    }
+    item->ep = ep;
+    if (posix_socket_avail(fd) > 0) {
+        _queue(item);
+    }
+    return 0;
+}
+
+int epoll_ctl(int epfd, int op, int fd, struct epoll_event *event)
+{
+    _epoll_t *ep = _epoll_get(epfd);
+    _item_t *item;
+    int res = 0;
+
+    if (ep == NULL) {
+        errno = EBADF;
+        return -1;
+    }
+    if ((fd == epfd) || ((op != EPOLL_CTL_DEL) && (event == NULL))) {
+        errno = EINVAL;
+        return -1;
+    }
+    if (!posix_socket_is(fd)) {
+        errno = EPERM;
+        return -1;
+    }
+    mutex_lock(&_lock);
+    item = _item_get(fd);
+    if ((op != EPOLL_CTL_ADD) && ((item == NULL) || (item->ep != ep))) {
+        errno = ENOENT;
+        res = -1;
+    }
+    else if (op == EPOLL_CTL_ADD) {
+        res = _ctl_add(ep, fd, event);
+    }
+    else if (op == EPOLL_CTL_MOD) {
+        _dequeue(item);
+        item->event = *event;
+        if (posix_socket_avail(fd) > 0) {
+            _queue(item);
+        }
+    }
+    else if (op == EPOLL_CTL_DEL) {
+        posix_socket_epoll(fd, NULL);
+        _item_free(item);
+    }
+    else {
+        errno = EINVAL;
+        res = -1;
+    }
+    mutex_unlock(&_lock);
+    return res;
+}
+
+static int _collect(_epoll_t *ep, struct epoll_event *events, int maxevents)
+{
+    /* level-triggered items are queued again, so only look at the items
+     * ready on entry */
+    unsigned pending = clist_count(&ep->ready);
+    int num = 0;
+
+    mutex_lock(&_lock);
+    while ((num < maxevents) && (pending-- > 0)) {
+        unsigned state = irq_disable();
+        clist_node_t *node = clist_lpop(&ep->ready);
+
+        if (node == NULL) {
+            irq_restore(state);
+            break;
+        }
+        _item_t *item = container_of(node, _item_t, node);
+
+        item->queued = false;
+        irq_restore(state);
+        if (posix_socket_avail(item->fd) == 0) {
+            /* already read */
+            continue;
+        }
+        events[num].events = EPOLLIN;
+        events[num].data = item->event.data;
+        num++;
+        if (item->event.events & EPOLLONESHOT) {
+            /* disabled until EPOLL_CTL_MOD */
+            item->event.events &= ~EPOLLIN;
+        }
+        else if (!(item->event.events & EPOLLET)) {
+            _queue(item);
+        }
+    }
+    mutex_unlock(&_lock);
+    return num;
+}
+
+int epoll_wait(int epfd, struct epoll_event *events, int maxevents,
+               int timeout)
+{
+    _epoll_t *ep = _epoll_get(epfd);
+    ztimer_t timer;
+    int num;
+
+    if (ep == NULL) {
+        errno = EBADF;
+        return -1;
+    }
+    if (maxevents <= 0) {
+        errno = EINVAL;
+        return -1;
+    }
+    thread_flags_clear(POSIX_EPOLL_THREAD_FLAG);
+    ep->waiter = thread_get_active();
+    if (timeout > 0) {
+        ztimer_set_timeout_flag(ZTIMER_MSEC, &timer, timeout);
+    }
+    while (((num = _collect(ep, events, maxevents)) == 0) && (timeout != 0)) {
+        thread_flags_t tflags = thread_flags_wait_any(POSIX_EPOLL_THREAD_FLAG |
+                                                      THREAD_FLAG_TIMEOUT);
+
+        if (tflags & THREAD_FLAG_TIMEOUT) {
+            num = _collect(ep, events, maxevents);
+            break;
+        }
+    }
+    if (timeout > 0) {
+        ztimer_remove(ZTIMER_MSEC, &timer);
+        thread_flags_clear(THREAD_FLAG_TIMEOUT);
+    }
+    ep->waiter = NULL;
+    return num;
+}
+
+/** @} */
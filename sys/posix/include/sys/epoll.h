@@ -0,0 +1,195 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup posix_epoll    POSIX epoll
+ * @ingroup  posix
+ * @brief   Scalable readiness notification in the style of Linux' epoll
+ *
+ * Unlike `select()` (see @ref posix_select), which checks every file
+ * descriptor of its sets on each call, an epoll instance keeps an interest
+ * list of file descriptors. The @ref net_sock_async events of a socket in the
+ * interest list put it on the ready list of the instance, so `epoll_wait()`
+ * only looks at the sockets that became readable, i.e. its cost is in O(ready)
+ * instead of O(fds).
+ *
+ * Level-triggered (the default), edge-triggered (`EPOLLET`) and one-shot
+ * (`EPOLLONESHOT`) notification are supported.
+ *
+ * @todo    Omitted from the Linux interface for now:
+ *          - `epoll_pwait()`, as there is no POSIX signal handling in RIOT
+ *          - events other than `EPOLLIN`
+ *          - file descriptors other than [sockets](@ref posix_sockets)
+ *          - a socket being in the interest list of several instances
+ *
+ * @{
+ *
+ * @file
+ * @brief   epoll types and functions
+ *
+ * @author  RIOT developers <devel@riot-os.org>
+ */
+
+#ifndef SYS_EPOLL_H
+#define SYS_EPOLL_H
+
+#ifdef CPU_NATIVE
+/* the types and constants have to match the ones of the host's C library */
+__extension__
+#include_next <sys/epoll.h>
+#else
+#include <stdint.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   @ref core_thread_flags for POSIX epoll
+ */
+#define POSIX_EPOLL_THREAD_FLAG     (1U << 4)
+
+/**
+ * @addtogroup  config_posix
+ * @{
+ */
+/**
+ * @brief   Maximum number of epoll instances
+ */
+#ifndef CONFIG_POSIX_EPOLL_NUMOF
+#define CONFIG_POSIX_EPOLL_NUMOF        (1U)
+#endif
+
+/**
+ * @brief   Maximum number of file descriptors in the interest lists of all
+ *          epoll instances
+ */
+#ifndef CONFIG_POSIX_EPOLL_FDS_NUMOF
+#define CONFIG_POSIX_EPOLL_FDS_NUMOF    (8U)
+#endif
+/** @} */
+
+#if !defined(CPU_NATIVE) || defined(DOXYGEN)
+/**
+ * @name    Events and flags of struct epoll_event::events
+ * @{
+ */
+#define EPOLLIN         (0x001U)        /**< file descriptor is readable */
+#define EPOLLPRI        (0x002U)        /**< exceptional condition, not supported */
+#define EPOLLOUT        (0x004U)        /**< file descriptor is writable, not supported */
+#define EPOLLERR        (0x008U)        /**< error condition, not supported */
+#define EPOLLHUP        (0x010U)        /**< hang up, not supported */
+#define EPOLLONESHOT    (1U << 30)      /**< disable after one event */
+#define EPOLLET         (1U << 31)      /**< edge-triggered notification */
+/** @} */
+
+/**
+ * @name    Operations of epoll_ctl()
+ * @{
+ */
+#define EPOLL_CTL_ADD   (1)             /**< add to the interest list */
+#define EPOLL_CTL_DEL   (2)             /**< remove from the interest list */
+#define EPOLL_CTL_MOD   (3)             /**< change the event of an entry */
+/** @} */
+
+/**
+ * @brief   User data returned with an event
+ */
+typedef union epoll_data {
+    void *ptr;          /**< pointer */
+    int fd;             /**< file descriptor */
+    uint32_t u32;       /**< 32-bit value */
+    uint64_t u64;       /**< 64-bit value */
+} epoll_data_t;
+
+/**
+ * @brief   Event of a file descriptor
+ */
+struct epoll_event {
+    uint32_t events;    /**< events and flags */
+    epoll_data_t data;  /**< user data */
+};
+#endif /* !CPU_NATIVE || DOXYGEN */
+
+/**
+ * @brief   Opens an epoll instance
+ *
+ * @param[in] size  Ignored, but must be greater than 0.
+ *
+ * @return  A file descriptor of the instance on success.
+ * @return  -1 on error, with errno set to
+ *          - `EINVAL` if @p size is not greater than 0
+ *          - `EMFILE` if all @ref CONFIG_POSIX_EPOLL_NUMOF instances or all
+ *            file descriptors are in use
+ */
+int epoll_create(int size);
+
+/**
+ * @brief   Opens an epoll instance
+ *
+ * @param[in] flags Must be 0.
+ *
+ * @return  A file descriptor of the instance on success.
+ * @return  -1 on error, with errno set to
+ *          - `EINVAL` if @p flags is not 0
+ *          - `EMFILE` if all @ref CONFIG_POSIX_EPOLL_NUMOF instances or all
+ *            file descriptors are in use
+ */
+int epoll_create1(int flags);
+
+/**
+ * @brief   Changes the interest list of an epoll instance
+ *
+ * A socket becoming part of the interest list is bound implicitly if it was
+ * not bound yet, as with `select()`.
+ *
+ * @param[in] epfd  File descriptor of the epoll instance.
+ * @param[in] op    `EPOLL_CTL_ADD`, `EPOLL_CTL_MOD` or `EPOLL_CTL_DEL`.
+ * @param[in] fd    A socket.
+ * @param[in] event Event to watch and user data, may be NULL for
+ *                  `EPOLL_CTL_DEL`.
+ *
+ * @return  0 on success.
+ * @return  -1 on error, with errno set to
+ *          - `EBADF` if @p epfd is not an epoll instance
+ *          - `EEXIST` if @p op is `EPOLL_CTL_ADD` and @p fd is already in
+ *            the interest list of an instance
+ *          - `EINVAL` if @p op or @p event are invalid
+ *          - `ENOENT` if @p op is `EPOLL_CTL_MOD` or `EPOLL_CTL_DEL` and @p fd
+ *            is not in the interest list
+ *          - `ENOSPC` if all @ref CONFIG_POSIX_EPOLL_FDS_NUMOF entries are in
+ *            use
+ *          - `EPERM` if @p fd is not a socket
+ */
+int epoll_ctl(int epfd, int op, int fd, struct epoll_event *event);
+
+/**
+ * @brief   Waits for file descriptors of the interest list of an epoll
+ *          instance to become ready
+ *
+ * @param[in] epfd      File descriptor of the epoll instance.
+ * @param[out] events   Ready events.
+ * @param[in] maxevents Maximum number of @p events.
+ * @param[in] timeout   Timeout in milliseconds, -1 to wait indefinitely, 0 to
+ *                      return immediately.
+ *
+ * @return  Number of @p events, 0 if @p timeout expired.
+ * @return  -1 on error, with errno set to
+ *          - `EBADF` if @p epfd is not an epoll instance
+ *          - `EINVAL` if @p maxevents is not greater than 0
+ */
+int epoll_wait(int epfd, struct epoll_event *events, int maxevents,
+               int timeout);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SYS_EPOLL_H */
+/** @} */
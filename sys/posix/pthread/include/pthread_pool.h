@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup pthread
+ * @{
+ * @file
+ * @brief   Pool of worker threads (RIOT extension, not part of POSIX)
+ * @details Short jobs submitted to a pool run on threads created once with
+ *          pthread_pool_init(), instead of paying for pthread_create(),
+ *          the allocation of a stack and pthread_join() every time.
+ *
+ *          The jobs are queued in the order they were submitted and taken
+ *          by the next idle worker. A job is embedded in a structure of the
+ *          caller, like an @ref event_t, so submitting one never allocates
+ *          memory:
+ *
+ * @code{.c}
+ * typedef struct {
+ *     pthread_pool_work_t work;
+ *     int input;
+ * } my_job_t;
+ *
+ * static void _handler(pthread_pool_work_t *work)
+ * {
+ *     my_job_t *job = container_of(work, my_job_t, work);
+ *     ...
+ * }
+ *
+ * static my_job_t job = { .work.handler = _handler, .input = 42 };
+ * pthread_pool_submit(&pool, &job.work);
+ * @endcode
+ *
+ * @author  RIOT developers <devel@riot-os.org>
+ */
+
+#ifndef PTHREAD_POOL_H
+#define PTHREAD_POOL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "pthread.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Maximum number of worker threads of a pool
+ */
+#ifndef CONFIG_PTHREAD_POOL_THREADS_MAX
+#define CONFIG_PTHREAD_POOL_THREADS_MAX     (4U)
+#endif
+
+/**
+ * @brief   Job of a thread pool
+ */
+typedef struct pthread_pool_work pthread_pool_work_t;
+
+/**
+ * @brief   Job of a thread pool
+ */
+struct pthread_pool_work {
+    pthread_pool_work_t *next;                  /**< next queued job,
+                                                     managed by the pool */
+    void (*handler)(pthread_pool_work_t *work); /**< function running the job */
+};
+
+/**
+ * @brief   Thread pool
+ *
+ * @warning fields are managed by the pool functions, don't touch
+ */
+typedef struct {
+    mutex_t lock;                   /**< protects the queue */
+    pthread_cond_t cond;            /**< signals queued jobs to the workers */
+    pthread_pool_work_t *head;      /**< next job to run */
+    pthread_pool_work_t *tail;      /**< job submitted last */
+    pthread_t threads[CONFIG_PTHREAD_POOL_THREADS_MAX]; /**< the workers */
+    uint8_t numof;                  /**< number of workers */
+    bool stop;                      /**< workers exit once the queue is empty */
+} pthread_pool_t;
+
+/**
+ * @brief   Start a thread pool
+ *
+ * The workers are created like threads of pthread_create() with default
+ * attributes.
+ *
+ * @param[out]  pool    pool to start
+ * @param[in]   numof   number of worker threads,
+ *                      1 <= numof <= @ref CONFIG_PTHREAD_POOL_THREADS_MAX
+ *
+ * @return  0 on success
+ * @return  EINVAL if @p numof is out of range
+ * @return  EAGAIN if the workers could not be created
+ */
+int pthread_pool_init(pthread_pool_t *pool, unsigned numof);
+
+/**
+ * @brief   Queue a job to be run by the next idle worker of a pool
+ *
+ * @pre     @p work->handler is set
+ *
+ * @param[in,out]   pool    pool to run the job
+ * @param[in]       work    job to queue, must stay valid and must not be
+ *                          submitted again until its handler was called
+ */
+void pthread_pool_submit(pthread_pool_t *pool, pthread_pool_work_t *work);
+
+/**
+ * @brief   Stop a thread pool
+ *
+ * Waits until all queued jobs have been run and the workers have exited.
+ * Must not be called from a worker of @p pool.
+ *
+ * @param[in,out]   pool    pool to stop
+ */
+void pthread_pool_destroy(pthread_pool_t *pool);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PTHREAD_POOL_H */
+
+/**
+ * @}
+ */
@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup pthread
+ * @{
+ * @file
+ * @brief   Pool of worker threads
+ * @author  RIOT developers <devel@riot-os.org>
+ * @}
+ */
+
+#include <errno.h>
+
+#include "pthread_pool.h"
+
+static void *_worker(void *arg)
+{
+    pthread_pool_t *pool = arg;
+
+    mutex_lock(&pool->lock);
+    while (1) {
+        while (!pool->head && !pool->stop) {
+            pthread_cond_wait(&pool->cond, &pool->lock);
+        }
+        pthread_pool_work_t *work = pool->head;
+        if (work == NULL) {
+            break;
+        }
+        pool->head = work->next;
+        mutex_unlock(&pool->lock);
+
+        work->handler(work);
+
+        mutex_lock(&pool->lock);
+    }
+    mutex_unlock(&pool->lock);
+
+    return NULL;
+}
+
+int pthread_pool_init(pthread_pool_t *pool, unsigned numof)
+{
+    if ((numof == 0) || (numof > CONFIG_PTHREAD_POOL_THREADS_MAX)) {
+        return EINVAL;
+    }
+
+    mutex_init(&pool->lock);
+    pthread_cond_init(&pool->cond, NULL);
+    pool->head = NULL;
+    pool->tail = NULL;
+    pool->numof = 0;
+    pool->stop = false;
+
+    while (pool->numof < numof) {
+        if (pthread_create(&pool->threads[pool->numof], NULL, _worker,
+                           pool) != 0) {
+            pthread_pool_destroy(pool);
+            return EAGAIN;
+        }
+        pool->numof++;
+    }
+
+    return 0;
+}
+
+void pthread_pool_submit(pthread_pool_t *pool, pthread_pool_work_t *work)
+{
+    work->next = NULL;
+
+    mutex_lock(&pool->lock);
+    if (pool->head) {
+        pool->tail->next = work;
+    }
+    else {
+        pool->head = work;
+    }
+    pool->tail = work;
+    pthread_cond_signal(&pool->cond);
+    mutex_unlock(&pool->lock);
+}
+
+void pthread_pool_destroy(pthread_pool_t *pool)
+{
+    mutex_lock(&pool->lock);
+    pool->stop = true;
+    pthread_cond_broadcast(&pool->cond);
+    mutex_unlock(&pool->lock);
+
+    while (pool->numof) {
+        pthread_join(pool->threads[--pool->numof], NULL);
+    }
+    pthread_cond_destroy(&pool->cond);
+}
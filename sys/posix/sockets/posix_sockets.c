@@ -47,6 +47,10 @@
 #include "thread.h"
 #include "thread_flags.h"
 #endif
+#if IS_USED(MODULE_POSIX_EPOLL)
+extern void posix_epoll_notify(void *item);
+extern void posix_epoll_closed(void *item);
+#endif
 
 /* enough to create sockets both with socket() and accept() */
 #define _ACTUAL_SOCKET_POOL_SIZE   (SOCKET_POOL_SIZE + \
@@ -95,6 +99,9 @@ typedef struct {
 #endif
 #if IS_USED(MODULE_POSIX_SELECT)
     thread_t *selecting_thread;
+#endif
+#if IS_USED(MODULE_POSIX_EPOLL)
+    void *epoll_item;
 #endif
     sock_tcp_ep_t local;        /* to store bind before connect/listen */
 } socket_t;
@@ -127,6 +134,9 @@ static socket_t *_get_free_socket(void)
 #endif
 #if IS_USED(MODULE_POSIX_SELECT)
             _socket_pool[i].selecting_thread = NULL;
+#endif
+#if IS_USED(MODULE_POSIX_EPOLL)
+            _socket_pool[i].epoll_item = NULL;
 #endif
             return &_socket_pool[i];
         }
@@ -289,6 +299,12 @@ static int socket_close(vfs_file_t *filp)
     int res = 0;
 
     assert((s->domain == AF_INET) || (s->domain == AF_INET6));
+#if IS_USED(MODULE_POSIX_EPOLL)
+    if (s->epoll_item != NULL) {
+        posix_epoll_closed(s->epoll_item);
+        s->epoll_item = NULL;
+    }
+#endif
     mutex_lock(&_socket_pool_mutex);
     if (s->sock != NULL) {
         int idx = _get_sock_idx(s->sock);
@@ -377,6 +393,11 @@ static void _async_cb(void *sock, sock_async_flags_t type,
             thread_flags_set(socket->selecting_thread,
                              POSIX_SELECT_THREAD_FLAG);
         }
+#endif
+#if IS_USED(MODULE_POSIX_EPOLL)
+        if (socket->epoll_item) {
+            posix_epoll_notify(socket->epoll_item);
+        }
 #endif
     }
 }
@@ -975,10 +996,12 @@ static ssize_t socket_recvfrom(socket_t *s, void *restrict buffer,
         res = -EOPNOTSUPP;
         break;
     }
-    if ((res >= 0) && (address != NULL) && (address_len != NULL)) {
 #ifdef MODULE_SOCK_ASYNC
+    if ((res >= 0) && (atomic_load(&s->available) > 0)) {
         atomic_fetch_sub(&s->available, 1);
+    }
 #endif
+    if ((res >= 0) && (address != NULL) && (address_len != NULL)) {
         switch (s->type) {
 #ifdef MODULE_SOCK_TCP
         case SOCK_STREAM:
@@ -1216,6 +1239,31 @@ int posix_socket_select(int fd)
     return -1;
 }
 
+int posix_socket_epoll(int fd, void *item)
+{
+#if IS_USED(MODULE_POSIX_EPOLL)
+    socket_t *socket = _get_socket(fd);
+
+    if (socket != NULL) {
+        if ((item != NULL) && (socket->sock == NULL)) {
+            int res;
+
+            /* bind implicitly */
+            if ((res = _bind_connect(socket, NULL, 0)) < 0) {
+                return res;
+            }
+        }
+        socket->epoll_item = item;
+        return 0;
+    }
+#else
+    (void)fd;
+    (void)item;
+#endif
+    errno = ENOTSUP;
+    return -1;
+}
+
 /**
  * @}
  */
@@ -0,0 +1,152 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_profiler
+ * @{
+ *
+ * @file
+ * @brief       Sampling profiler implementation
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "cpu.h"
+#include "irq.h"
+#include "profiler.h"
+#include "sched.h"
+#include "thread.h"
+#include "ztimer.h"
+#include "ztimer/periodic.h"
+
+#if (CONFIG_PROFILER_NUMOF & (CONFIG_PROFILER_NUMOF - 1)) != 0
+#error "CONFIG_PROFILER_NUMOF must be a power of two"
+#endif
+
+/* give up on a full neighbourhood instead of scanning the whole table */
+#define PROBES_MAX      (8U)
+
+typedef struct {
+    uintptr_t pc;
+    uint32_t count;
+    kernel_pid_t pid;
+} sample_t;
+
+static sample_t _samples[CONFIG_PROFILER_NUMOF];
+static uint32_t _total;
+static uint32_t _dropped;
+static uint32_t _period;
+static ztimer_periodic_t _timer;
+static bool _running;
+
+static unsigned _hash(uintptr_t pc, kernel_pid_t pid)
+{
+    /* Knuth's multiplicative hash, instructions are at least 2 byte aligned */
+    uint32_t h = ((uint32_t)(pc >> 1) ^ ((uint32_t)pid << 24)) * 2654435761U;
+
+    /* the upper bits are the well mixed ones */
+    return (h ^ (h >> 16)) & (CONFIG_PROFILER_NUMOF - 1);
+}
+
+static void _add(uintptr_t pc, kernel_pid_t pid)
+{
+    unsigned idx = _hash(pc, pid);
+
+    _total++;
+    for (unsigned i = 0; i < PROBES_MAX; i++) {
+        sample_t *s = &_samples[(idx + i) & (CONFIG_PROFILER_NUMOF - 1)];
+
+        if (s->count == 0) {
+            s->pc = pc;
+            s->pid = pid;
+        }
+        else if ((s->pc != pc) || (s->pid != pid)) {
+            continue;
+        }
+        s->count++;
+        return;
+    }
+    _dropped++;
+}
+
+static bool _sample(void *arg)
+{
+    (void)arg;
+    uintptr_t pc = cpu_get_interrupted_pc();
+
+    _add(pc, pc ? thread_getpid() : KERNEL_PID_ISR);
+
+    return ZTIMER_PERIODIC_KEEP_GOING;
+}
+
+void profiler_start(uint32_t period_us)
+{
+    if (period_us == 0) {
+        period_us = CONFIG_PROFILER_PERIOD_US;
+    }
+
+    profiler_stop();
+    _period = period_us;
+    ztimer_acquire(ZTIMER_USEC);
+    ztimer_periodic_init(ZTIMER_USEC, &_timer, _sample, NULL, period_us);
+    ztimer_periodic_start(&_timer);
+    _running = true;
+}
+
+void profiler_stop(void)
+{
+    if (_running) {
+        ztimer_periodic_stop(&_timer);
+        ztimer_release(ZTIMER_USEC);
+        _running = false;
+    }
+}
+
+void profiler_reset(void)
+{
+    unsigned state = irq_disable();
+
+    memset(_samples, 0, sizeof(_samples));
+    _total = 0;
+    _dropped = 0;
+    irq_restore(state);
+}
+
+void profiler_dump(void)
+{
+    printf("prof-begin %" PRIu32 " %" PRIu32 " %" PRIu32 "\n",
+           _period, _total, _dropped);
+
+    for (unsigned i = 0; i < CONFIG_PROFILER_NUMOF; i++) {
+        unsigned state = irq_disable();
+        sample_t s = _samples[i];
+        irq_restore(state);
+
+        if (s.count == 0) {
+            continue;
+        }
+
+        const char *name = NULL;
+        if (pid_is_valid(s.pid)) {
+            name = thread_getname(s.pid);
+        }
+        else if (s.pid == KERNEL_PID_ISR) {
+            name = "isr";
+        }
+        printf("prof 0x%" PRIxPTR " %" PRIu32 " %" PRIkernel_pid " %s\n",
+               s.pc, s.count, s.pid, name ? name : "-");
+    }
+    puts("prof-end");
+}
@@ -15,6 +15,8 @@
  *
  * @note    The entry 'runtime_usec' in 'MODULE_SCHEDSTATISTICS' is limited
  *          to 2**32 microseconds. So the entry gets reset after ~1.2 hours.
+ *          The same applies to 'runtime_ms' printed by @ref ps_window after
+ *          ~49 days.
  * @}
  */
 
@@ -22,12 +24,13 @@
 #include <assert.h>
 
 #include "architecture.h"
+#include "irq.h"
 #include "thread.h"
 #include "sched.h"
 
 #ifdef MODULE_SCHEDSTATISTICS
 #include "schedstatistics.h"
-#include "ztimer.h"
+#include "time_units.h"
 #endif
 
 #ifdef MODULE_TLSF_MALLOC
@@ -78,12 +81,12 @@ void ps(void)
 #ifdef MODULE_SCHEDSTATISTICS
     uint64_t rt_sum = 0;
     if (!IS_ACTIVE(MODULE_CORE_IDLE_THREAD)) {
-        rt_sum = sched_pidlist[KERNEL_PID_UNDEF].runtime_us;
+        rt_sum = sched_pidlist[KERNEL_PID_UNDEF].runtime_ticks;
     }
     for (kernel_pid_t i = KERNEL_PID_FIRST; i <= KERNEL_PID_LAST; i++) {
         thread_t *p = thread_get(i);
         if (p != NULL) {
-            rt_sum += sched_pidlist[i].runtime_us;
+            rt_sum += sched_pidlist[i].runtime_ticks;
         }
     }
 #endif /* MODULE_SCHEDSTATISTICS */
@@ -104,10 +107,10 @@ void ps(void)
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
             /* multiply with 100 for percentage and to avoid floats/doubles */
-            uint64_t runtime_us = sched_pidlist[i].runtime_us * 100;
-            uint32_t ztimer_us = {sched_pidlist[i].runtime_us};
-            unsigned runtime_major = runtime_us / rt_sum;
-            unsigned runtime_minor = ((runtime_us % rt_sum) * 1000) / rt_sum;
+            uint64_t runtime = sched_pidlist[i].runtime_ticks * 100;
+            uint32_t ztimer_us = schedstat_ticks_to_us(sched_pidlist[i].runtime_ticks);
+            unsigned runtime_major = runtime / rt_sum;
+            unsigned runtime_minor = ((runtime % rt_sum) * 1000) / rt_sum;
             unsigned switches = sched_pidlist[i].schedules;
 #endif
             printf("\t%3" PRIkernel_pid
@@ -150,3 +153,55 @@ void ps(void)
 #   endif
 #endif
 }
+
+#ifdef MODULE_SCHEDSTATISTICS
+void ps_window(void)
+{
+    uint32_t window = schedstat_window_ticks();
+
+    printf("utilization over the last %" PRIu32 " us:\n",
+           (uint32_t)schedstat_ticks_to_us(window));
+    printf("\tpid | "
+#ifdef CONFIG_THREAD_NAMES
+           "%-21s| "
+#endif
+           "window   | runtime_ms\n"
+#ifdef CONFIG_THREAD_NAMES
+           , "name"
+#endif
+           );
+
+    if (window == 0) {
+        /* no complete window yet, avoid division by zero */
+        window = 1;
+    }
+
+    for (kernel_pid_t i = KERNEL_PID_FIRST; i <= KERNEL_PID_LAST; i++) {
+        thread_t *p = thread_get(i);
+
+        if (p == NULL) {
+            continue;
+        }
+
+        unsigned state = irq_disable();
+        uint64_t runtime = sched_pidlist[i].window_last * 100ULL;
+        uint64_t total = sched_pidlist[i].runtime_ticks;
+        irq_restore(state);
+
+        unsigned major = runtime / window;
+        unsigned minor = ((runtime % window) * 1000) / window;
+        uint32_t total_ms = schedstat_ticks_to_us(total) / US_PER_MS;
+
+        printf("\t%3" PRIkernel_pid
+#ifdef CONFIG_THREAD_NAMES
+               " | %-20s"
+#endif
+               " | %3u.%03u%% | %10" PRIu32 "\n",
+               thread_getpid_of(p),
+#ifdef CONFIG_THREAD_NAMES
+               thread_get_name(p),
+#endif
+               major, minor, total_ms);
+    }
+}
+#endif /* MODULE_SCHEDSTATISTICS */
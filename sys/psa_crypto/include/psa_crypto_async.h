@@ -0,0 +1,238 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_psa_crypto
+ * @defgroup    psa_crypto_async  PSA Crypto asynchronous jobs
+ * @{
+ *
+ * @file        psa_crypto_async.h
+ * @brief       Asynchronous execution of slow PSA Crypto operations
+ *
+ * Operations on secure elements (e.g. an ATECC608 attached via I2C) take tens
+ * of milliseconds and block the calling thread for the whole transaction.
+ * This module moves such operations into jobs that are executed by worker
+ * threads, so that e.g. network threads can continue processing while a
+ * signature is computed.
+ *
+ * There is one worker thread and job queue for keys in local storage and one
+ * for every registered secure element, identified by the location of the
+ * key's lifetime. Jobs on the same secure element are executed in the order
+ * they were submitted, jobs on different secure elements run concurrently.
+ *
+ * The job structure, the input and the output buffers are owned by the worker
+ * until the completion callback was called. The callback runs in the context
+ * of the worker thread. To continue processing in a different thread, post an
+ * event from within the callback:
+ *
+ * @code {.c}
+ * static void _signed(psa_async_job_t *job, void *arg)
+ * {
+ *     (void)job;
+ *     event_post(EVENT_PRIO_MEDIUM, arg);
+ * }
+ *
+ * psa_async_sign_hash(&job, key, alg, hash, sizeof(hash), sig, sizeof(sig), _signed, &ev_signed);
+ * @endcode
+ *
+ * @note    The synchronous API remains usable. It is up to the application to
+ *          not use a key concurrently from different threads.
+ *
+ * @}
+ */
+
+#ifndef PSA_CRYPTO_ASYNC_H
+#define PSA_CRYPTO_ASYNC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "event.h"
+#include "psa/crypto.h"
+#include "psa_crypto_se_management.h"
+#include "thread.h"
+
+/**
+ * @brief   Stack size of the worker threads
+ *
+ * The worker calls the whole PSA operation including the backend, which
+ * needs as much stack as calling it from the application directly.
+ */
+#ifndef CONFIG_PSA_ASYNC_STACKSIZE
+#define CONFIG_PSA_ASYNC_STACKSIZE      (THREAD_STACKSIZE_DEFAULT)
+#endif
+
+/**
+ * @brief   Priority of the worker threads
+ *
+ * Defaults to a priority below the main thread, jobs are meant to run
+ * in the background.
+ */
+#ifndef CONFIG_PSA_ASYNC_PRIO
+#define CONFIG_PSA_ASYNC_PRIO           (THREAD_PRIORITY_MAIN + 1)
+#endif
+
+/**
+ * @brief   Number of job queues: one for local keys, one per secure element
+ */
+#if IS_USED(MODULE_PSA_SECURE_ELEMENT) || defined(DOXYGEN)
+#define PSA_ASYNC_QUEUE_NUMOF           (1 + PSA_MAX_SE_COUNT)
+#else
+#define PSA_ASYNC_QUEUE_NUMOF           (1)
+#endif
+
+/**
+ * @brief   Operations that can be executed asynchronously
+ */
+typedef enum {
+    PSA_ASYNC_SIGN_HASH,        /**< @ref psa_sign_hash */
+    PSA_ASYNC_VERIFY_HASH,      /**< @ref psa_verify_hash */
+    PSA_ASYNC_SIGN_MESSAGE,     /**< @ref psa_sign_message */
+    PSA_ASYNC_VERIFY_MESSAGE,   /**< @ref psa_verify_message */
+} psa_async_op_t;
+
+/**
+ * @brief   Forward declaration of a job
+ */
+typedef struct psa_async_job psa_async_job_t;
+
+/**
+ * @brief   Completion callback of a job
+ *
+ * Called in the context of the worker thread once the operation is done.
+ * The result is stored in psa_async_job_t::status, the job may be reused
+ * from within the callback.
+ *
+ * @param[in]   job     The completed job
+ * @param[in]   arg     Argument given on submission
+ */
+typedef void (*psa_async_cb_t)(psa_async_job_t *job, void *arg);
+
+/**
+ * @brief   An asynchronous PSA Crypto job
+ *
+ * All members are private except for psa_async_job_t::status and
+ * psa_async_job_t::signature_length, which are valid once the completion
+ * callback was called.
+ */
+struct psa_async_job {
+    event_t super;                  /**< event handled by the worker */
+    psa_async_cb_t cb;              /**< completion callback */
+    void *arg;                      /**< argument of the callback */
+    psa_async_op_t op;              /**< operation to execute */
+    psa_key_id_t key;               /**< key to use */
+    psa_algorithm_t alg;            /**< algorithm to use */
+    const uint8_t *input;           /**< hash or message */
+    size_t input_length;            /**< length of the hash or message */
+    union {
+        uint8_t *out;               /**< signature output of sign operations */
+        const uint8_t *in;          /**< signature input of verify operations */
+    } signature;                    /**< signature buffer */
+    size_t signature_size;          /**< size of the signature buffer */
+    size_t signature_length;        /**< length of the created signature */
+    psa_status_t status;            /**< result of the operation */
+};
+
+/**
+ * @brief   Start the worker threads
+ *
+ * Called by @ref psa_crypto_init, must not be called by the application.
+ */
+void psa_async_init(void);
+
+/**
+ * @brief   Queue a @ref psa_sign_hash operation
+ *
+ * @param[out]  job             Job to fill and queue
+ * @param[in]   key             Identifier of the key to use
+ * @param[in]   alg             Signature algorithm
+ * @param[in]   hash            Hash to sign
+ * @param[in]   hash_length     Size of @p hash in bytes
+ * @param[out]  signature       Buffer for the signature
+ * @param[in]   signature_size  Size of @p signature in bytes
+ * @param[in]   cb              Completion callback, must not be NULL
+ * @param[in]   arg             Argument passed to @p cb
+ *
+ * @return  @ref PSA_SUCCESS if the job was queued
+ * @return  @ref PSA_ERROR_BAD_STATE if the library was not initialized
+ * @return  @ref PSA_ERROR_INVALID_ARGUMENT if @p cb is NULL
+ * @return  @ref PSA_ERROR_INVALID_HANDLE if @p key does not exist
+ * @return  @ref PSA_ERROR_NOT_SUPPORTED if the key's location has no queue
+ */
+psa_status_t psa_async_sign_hash(psa_async_job_t *job, psa_key_id_t key, psa_algorithm_t alg,
+                                 const uint8_t *hash, size_t hash_length,
+                                 uint8_t *signature, size_t signature_size,
+                                 psa_async_cb_t cb, void *arg);
+
+/**
+ * @brief   Queue a @ref psa_verify_hash operation
+ *
+ * @param[out]  job                 Job to fill and queue
+ * @param[in]   key                 Identifier of the key to use
+ * @param[in]   alg                 Signature algorithm
+ * @param[in]   hash                Hash the signature was created on
+ * @param[in]   hash_length         Size of @p hash in bytes
+ * @param[in]   signature           Signature to verify
+ * @param[in]   signature_length    Size of @p signature in bytes
+ * @param[in]   cb                  Completion callback, must not be NULL
+ * @param[in]   arg                 Argument passed to @p cb
+ *
+ * @return  see @ref psa_async_sign_hash
+ */
+psa_status_t psa_async_verify_hash(psa_async_job_t *job, psa_key_id_t key, psa_algorithm_t alg,
+                                   const uint8_t *hash, size_t hash_length,
+                                   const uint8_t *signature, size_t signature_length,
+                                   psa_async_cb_t cb, void *arg);
+
+/**
+ * @brief   Queue a @ref psa_sign_message operation
+ *
+ * @param[out]  job             Job to fill and queue
+ * @param[in]   key             Identifier of the key to use
+ * @param[in]   alg             Signature algorithm
+ * @param[in]   input           Message to sign
+ * @param[in]   input_length    Size of @p input in bytes
+ * @param[out]  signature       Buffer for the signature
+ * @param[in]   signature_size  Size of @p signature in bytes
+ * @param[in]   cb              Completion callback, must not be NULL
+ * @param[in]   arg             Argument passed to @p cb
+ *
+ * @return  see @ref psa_async_sign_hash
+ */
+psa_status_t psa_async_sign_message(psa_async_job_t *job, psa_key_id_t key, psa_algorithm_t alg,
+                                    const uint8_t *input, size_t input_length,
+                                    uint8_t *signature, size_t signature_size,
+                                    psa_async_cb_t cb, void *arg);
+
+/**
+ * @brief   Queue a @ref psa_verify_message operation
+ *
+ * @param[out]  job                 Job to fill and queue
+ * @param[in]   key                 Identifier of the key to use
+ * @param[in]   alg                 Signature algorithm
+ * @param[in]   input               Message the signature was created on
+ * @param[in]   input_length        Size of @p input in bytes
+ * @param[in]   signature           Signature to verify
+ * @param[in]   signature_length    Size of @p signature in bytes
+ * @param[in]   cb                  Completion callback, must not be NULL
+ * @param[in]   arg                 Argument passed to @p cb
+ *
+ * @return  see @ref psa_async_sign_hash
+ */
+psa_status_t psa_async_verify_message(psa_async_job_t *job, psa_key_id_t key,
+                                      psa_algorithm_t alg,
+                                      const uint8_t *input, size_t input_length,
+                                      const uint8_t *signature, size_t signature_length,
+                                      psa_async_cb_t cb, void *arg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PSA_CRYPTO_ASYNC_H */
@@ -0,0 +1,216 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     psa_crypto_async
+ * @{
+ *
+ * @brief       PSA Crypto asynchronous job queues
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+
+#include "container.h"
+#include "mutex.h"
+#include "psa_crypto_async.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/**
+ * @brief   Job queues, index 0 is used for keys in local storage
+ */
+static event_queue_t _queues[PSA_ASYNC_QUEUE_NUMOF];
+
+/**
+ * @brief   Key location served by each queue
+ *
+ * Queues of secure elements are assigned on first use, as the locations
+ * are only known after the drivers registered themselves.
+ */
+static psa_key_location_t _locations[PSA_ASYNC_QUEUE_NUMOF];
+
+/**
+ * @brief   Number of queues that have a location assigned
+ */
+static unsigned _queues_used = 1;
+
+/**
+ * @brief   Protects the assignment of locations to queues
+ */
+static mutex_t _lock = MUTEX_INIT;
+
+/**
+ * @brief   Set once psa_crypto_init() started the workers
+ */
+static bool _initialized;
+
+static char _stacks[PSA_ASYNC_QUEUE_NUMOF][CONFIG_PSA_ASYNC_STACKSIZE];
+
+static void *_worker(void *arg)
+{
+    event_queue_t *queue = arg;
+
+    event_queue_claim(queue);
+    event_loop(queue);
+
+    return NULL;
+}
+
+static void _run(event_t *event)
+{
+    psa_async_job_t *job = container_of(event, psa_async_job_t, super);
+
+    switch (job->op) {
+    case PSA_ASYNC_SIGN_HASH:
+        job->status = psa_sign_hash(job->key, job->alg, job->input, job->input_length,
+                                    job->signature.out, job->signature_size,
+                                    &job->signature_length);
+        break;
+    case PSA_ASYNC_VERIFY_HASH:
+        job->status = psa_verify_hash(job->key, job->alg, job->input, job->input_length,
+                                      job->signature.in, job->signature_size);
+        break;
+    case PSA_ASYNC_SIGN_MESSAGE:
+        job->status = psa_sign_message(job->key, job->alg, job->input, job->input_length,
+                                       job->signature.out, job->signature_size,
+                                       &job->signature_length);
+        break;
+    case PSA_ASYNC_VERIFY_MESSAGE:
+        job->status = psa_verify_message(job->key, job->alg, job->input, job->input_length,
+                                         job->signature.in, job->signature_size);
+        break;
+    default:
+        job->status = PSA_ERROR_NOT_SUPPORTED;
+        break;
+    }
+
+    DEBUG("psa_async: job %p done: %d\n", (void *)job, (int)job->status);
+    job->cb(job, job->arg);
+}
+
+void psa_async_init(void)
+{
+    for (unsigned i = 0; i < PSA_ASYNC_QUEUE_NUMOF; i++) {
+        event_queue_init_detached(&_queues[i]);
+        thread_create(_stacks[i], sizeof(_stacks[i]), CONFIG_PSA_ASYNC_PRIO,
+                      THREAD_CREATE_STACKTEST, _worker, &_queues[i], "psa_async");
+    }
+    _initialized = true;
+}
+
+/**
+ * @brief   Get the queue serving the location of @p key
+ */
+static psa_status_t _get_queue(psa_key_id_t key, event_queue_t **queue)
+{
+    psa_key_attributes_t attr = psa_key_attributes_init();
+    psa_status_t status = psa_get_key_attributes(key, &attr);
+
+    if (status != PSA_SUCCESS) {
+        return status;
+    }
+
+    psa_key_location_t location = PSA_KEY_LIFETIME_GET_LOCATION(psa_get_key_lifetime(&attr));
+    status = PSA_ERROR_NOT_SUPPORTED;
+
+    mutex_lock(&_lock);
+    for (unsigned i = 0; i < PSA_ASYNC_QUEUE_NUMOF; i++) {
+        if (i == _queues_used) {
+            _locations[_queues_used++] = location;
+        }
+        if (_locations[i] == location) {
+            *queue = &_queues[i];
+            status = PSA_SUCCESS;
+            break;
+        }
+    }
+    mutex_unlock(&_lock);
+
+    return status;
+}
+
+static psa_status_t _submit(psa_async_job_t *job, psa_async_op_t op, psa_key_id_t key,
+                            psa_algorithm_t alg, const uint8_t *input, size_t input_length,
+                            size_t signature_size, psa_async_cb_t cb, void *arg)
+{
+    event_queue_t *queue;
+
+    if (cb == NULL) {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+
+    if (!_initialized) {
+        return PSA_ERROR_BAD_STATE;
+    }
+
+    psa_status_t status = _get_queue(key, &queue);
+    if (status != PSA_SUCCESS) {
+        return status;
+    }
+
+    job->super.handler = _run;
+    job->cb = cb;
+    job->arg = arg;
+    job->op = op;
+    job->key = key;
+    job->alg = alg;
+    job->input = input;
+    job->input_length = input_length;
+    job->signature_size = signature_size;
+    job->signature_length = 0;
+    job->status = PSA_ERROR_CORRUPTION_DETECTED;
+
+    event_post(queue, &job->super);
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_async_sign_hash(psa_async_job_t *job, psa_key_id_t key, psa_algorithm_t alg,
+                                 const uint8_t *hash, size_t hash_length,
+                                 uint8_t *signature, size_t signature_size,
+                                 psa_async_cb_t cb, void *arg)
+{
+    job->signature.out = signature;
+    return _submit(job, PSA_ASYNC_SIGN_HASH, key, alg, hash, hash_length, signature_size,
+                   cb, arg);
+}
+
+psa_status_t psa_async_verify_hash(psa_async_job_t *job, psa_key_id_t key, psa_algorithm_t alg,
+                                   const uint8_t *hash, size_t hash_length,
+                                   const uint8_t *signature, size_t signature_length,
+                                   psa_async_cb_t cb, void *arg)
+{
+    job->signature.in = signature;
+    return _submit(job, PSA_ASYNC_VERIFY_HASH, key, alg, hash, hash_length, signature_length,
+                   cb, arg);
+}
+
+psa_status_t psa_async_sign_message(psa_async_job_t *job, psa_key_id_t key, psa_algorithm_t alg,
+                                    const uint8_t *input, size_t input_length,
+                                    uint8_t *signature, size_t signature_size,
+                                    psa_async_cb_t cb, void *arg)
+{
+    job->signature.out = signature;
+    return _submit(job, PSA_ASYNC_SIGN_MESSAGE, key, alg, input, input_length, signature_size,
+                   cb, arg);
+}
+
+psa_status_t psa_async_verify_message(psa_async_job_t *job, psa_key_id_t key,
+                                      psa_algorithm_t alg,
+                                      const uint8_t *input, size_t input_length,
+                                      const uint8_t *signature, size_t signature_length,
+                                      psa_async_cb_t cb, void *arg)
+{
+    job->signature.in = signature;
+    return _submit(job, PSA_ASYNC_VERIFY_MESSAGE, key, alg, input, input_length,
+                   signature_length, cb, arg);
+}
@@ -34,6 +34,10 @@
 #include "psa_crypto_persistent_storage.h"
 #endif /* MODULE_PSA_PERSISTENT_STORAGE */
 
+#if IS_USED(MODULE_PSA_ASYNC)
+#include "psa_crypto_async.h"
+#endif
+
 #include "random.h"
 #include "kernel_defines.h"
 
@@ -133,6 +137,10 @@ psa_status_t psa_crypto_init(void)
     psa_init_key_slots();
 #endif
 
+#if IS_USED(MODULE_PSA_ASYNC)
+    psa_async_init();
+#endif
+
     return PSA_SUCCESS;
 }
 
@@ -2078,6 +2086,73 @@ psa_status_t psa_verify_hash(psa_key_id_t key,
     return ((status == PSA_SUCCESS) ? unlock_status : status);
 }
 
+psa_status_t psa_verify_hash_batch(psa_key_id_t key,
+                                   psa_algorithm_t alg,
+                                   const uint8_t *const *hashes,
+                                   size_t hash_length,
+                                   const uint8_t *const *signatures,
+                                   size_t signature_length,
+                                   size_t count,
+                                   psa_status_t *results)
+{
+    psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
+    psa_status_t unlock_status = PSA_ERROR_CORRUPTION_DETECTED;
+    psa_key_slot_t *slot = NULL;
+
+    if (!lib_initialized) {
+        return PSA_ERROR_BAD_STATE;
+    }
+
+    if (!hashes || !signatures) {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+
+    if (!PSA_ALG_IS_ECDSA(alg)) {
+        return PSA_ERROR_NOT_SUPPORTED;
+    }
+
+    if (!PSA_ALG_IS_SIGN_HASH(alg) || hash_length != PSA_HASH_LENGTH(alg)) {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+
+    /* the key is looked up and checked against the policy once for the whole batch */
+    status = psa_get_and_lock_key_slot_with_policy(key, &slot, PSA_KEY_USAGE_VERIFY_HASH, alg);
+    if (status != PSA_SUCCESS) {
+        psa_unlock_key_slot(slot);
+        return status;
+    }
+
+    if ((signature_length != PSA_ECDSA_SIGNATURE_SIZE(slot->attr.bits)) ||
+        ((PSA_KEY_LIFETIME_GET_LOCATION(slot->attr.lifetime) != PSA_KEY_LOCATION_LOCAL_STORAGE) &&
+         PSA_KEY_TYPE_IS_ECC_KEY_PAIR(slot->attr.type))) {
+        psa_unlock_key_slot(slot);
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+
+    psa_key_attributes_t attributes = slot->attr;
+    psa_status_t batch_status = PSA_SUCCESS;
+
+    for (size_t i = 0; i < count; i++) {
+        if (!hashes[i] || !signatures[i]) {
+            status = PSA_ERROR_INVALID_ARGUMENT;
+        }
+        else {
+            status = psa_location_dispatch_verify_hash(&attributes, alg, slot, hashes[i],
+                                                       hash_length, signatures[i],
+                                                       signature_length);
+        }
+        if (results) {
+            results[i] = status;
+        }
+        if (batch_status == PSA_SUCCESS) {
+            batch_status = status;
+        }
+    }
+
+    unlock_status = psa_unlock_key_slot(slot);
+    return ((batch_status == PSA_SUCCESS) ? unlock_status : batch_status);
+}
+
 psa_status_t psa_verify_message(psa_key_id_t key,
                                 psa_algorithm_t alg,
                                 const uint8_t *input,
@@ -0,0 +1,276 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_random_hmac_drbg
+ * @{
+ * @file
+ *
+ * @brief       HMAC_DRBG (NIST SP 800-90A) with SHA-256, reseeded from a
+ *              background entropy pool
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "container.h"
+#include "hashes/sha256.h"
+#include "kernel_defines.h"
+#include "log.h"
+#include "macros/utils.h"
+#include "mutex.h"
+#include "random.h"
+#include "thread.h"
+
+#if IS_USED(MODULE_PERIPH_HWRNG)
+#include "periph/hwrng.h"
+#endif
+#if IS_USED(MODULE_ENTROPY_SOURCE_ADC_NOISE)
+#include "entropy_source/adc_noise.h"
+#endif
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/**
+ * @brief   Output blocks generated between two reseeds from the pool
+ */
+#ifndef CONFIG_RANDOM_HMAC_DRBG_RESEED_INTERVAL
+#define CONFIG_RANDOM_HMAC_DRBG_RESEED_INTERVAL (64U)
+#endif
+
+/**
+ * @brief   Enable the background entropy pool
+ *
+ * Without it the generator only uses the entropy it was seeded with.
+ */
+#ifndef CONFIG_RANDOM_HMAC_DRBG_POOL
+#define CONFIG_RANDOM_HMAC_DRBG_POOL            (1)
+#endif
+
+/**
+ * @brief   Bytes collected from each entropy source per reseed
+ */
+#ifndef CONFIG_RANDOM_HMAC_DRBG_POOL_SIZE
+#define CONFIG_RANDOM_HMAC_DRBG_POOL_SIZE       (32U)
+#endif
+
+/**
+ * @brief   Stack size of the pool thread
+ */
+#ifndef CONFIG_RANDOM_HMAC_DRBG_POOL_STACKSIZE
+#define CONFIG_RANDOM_HMAC_DRBG_POOL_STACKSIZE  (THREAD_STACKSIZE_SMALL)
+#endif
+
+/* the pool only runs if there is something to collect from */
+#define HAS_POOL    (CONFIG_RANDOM_HMAC_DRBG_POOL && \
+                     (IS_USED(MODULE_PERIPH_HWRNG) || \
+                      IS_USED(MODULE_ENTROPY_SOURCE_ADC_NOISE)))
+
+#define BLOCK_SIZE  (SHA256_DIGEST_LENGTH)
+
+/* working state (K is kept as keyed HMAC context, saving the pad blocks) */
+static hmac_context_t _key;
+static uint8_t _v[BLOCK_SIZE];
+static uint32_t _blocks_since_reseed;
+
+/* output of the last generated block, consumed bytes are wiped */
+static uint8_t _out[BLOCK_SIZE];
+static unsigned _out_pos = BLOCK_SIZE;
+
+/* V = HMAC(K, V) */
+static void _hmac_v(void)
+{
+    hmac_context_t ctx = _key;
+
+    hmac_sha256_update(&ctx, _v, sizeof(_v));
+    hmac_sha256_final(&ctx, _v);
+}
+
+/* HMAC_DRBG_Update (SP 800-90A 10.1.2.2) */
+static void _update(const void *data, size_t len)
+{
+    uint8_t k[BLOCK_SIZE];
+
+    for (uint8_t round = 0; round < ((len > 0) ? 2 : 1); round++) {
+        hmac_context_t ctx = _key;
+
+        hmac_sha256_update(&ctx, _v, sizeof(_v));
+        hmac_sha256_update(&ctx, &round, 1);
+        if (len > 0) {
+            hmac_sha256_update(&ctx, data, len);
+        }
+        hmac_sha256_final(&ctx, k);
+
+        hmac_sha256_init(&_key, k, sizeof(k));
+        _hmac_v();
+    }
+
+    memset(k, 0, sizeof(k));
+}
+
+static void _instantiate(const void *seed, size_t len)
+{
+    uint8_t k[BLOCK_SIZE];
+
+    memset(k, 0x00, sizeof(k));
+    memset(_v, 0x01, sizeof(_v));
+    hmac_sha256_init(&_key, k, sizeof(k));
+
+    _update(seed, len);
+
+    _blocks_since_reseed = 0;
+    memset(_out, 0, sizeof(_out));
+    _out_pos = BLOCK_SIZE;
+}
+
+#if HAS_POOL
+static char _pool_stack[CONFIG_RANDOM_HMAC_DRBG_POOL_STACKSIZE];
+static kernel_pid_t _pool_pid = KERNEL_PID_UNDEF;
+
+/* handed from the pool thread to the generator, owned by the generator while
+ * _seed_ready is set */
+static uint8_t _seed[SHA256_DIGEST_LENGTH];
+static volatile bool _seed_ready;
+static mutex_t _seed_taken = MUTEX_INIT_LOCKED;
+
+static void *_pool_thread(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        sha256_context_t ctx;
+        uint8_t sample[8];
+
+        sha256_init(&ctx);
+        for (unsigned i = 0; i < CONFIG_RANDOM_HMAC_DRBG_POOL_SIZE; i += sizeof(sample)) {
+#if IS_USED(MODULE_PERIPH_HWRNG)
+            hwrng_read(sample, sizeof(sample));
+            sha256_update(&ctx, sample, sizeof(sample));
+#endif
+#if IS_USED(MODULE_ENTROPY_SOURCE_ADC_NOISE)
+            if (entropy_source_adc_get(sample, sizeof(sample)) == 0) {
+                sha256_update(&ctx, sample, sizeof(sample));
+            }
+#endif
+        }
+        memset(sample, 0, sizeof(sample));
+        sha256_final(&ctx, _seed);
+
+        _seed_ready = true;
+        DEBUG("random: pool filled\n");
+
+        /* wait until the generator took the seed */
+        mutex_lock(&_seed_taken);
+    }
+
+    return NULL;
+}
+
+static void _pool_init(void)
+{
+    if (_pool_pid != KERNEL_PID_UNDEF) {
+        return;
+    }
+#if IS_USED(MODULE_ENTROPY_SOURCE_ADC_NOISE)
+    entropy_source_adc_init();
+#endif
+    _pool_pid = thread_create(_pool_stack, sizeof(_pool_stack), THREAD_PRIORITY_MIN - 1,
+                              THREAD_CREATE_STACKTEST, _pool_thread, NULL, "random_pool");
+}
+
+/* takes the pool's seed if it is ready, never waits for it */
+static void _reseed_from_pool(void)
+{
+    if (!_seed_ready) {
+        return;
+    }
+
+    _update(_seed, sizeof(_seed));
+    memset(_seed, 0, sizeof(_seed));
+    _blocks_since_reseed = 0;
+
+    _seed_ready = false;
+    mutex_unlock(&_seed_taken);
+}
+#endif /* HAS_POOL */
+
+static void _generate_block(void)
+{
+#if HAS_POOL
+    if (_blocks_since_reseed >= CONFIG_RANDOM_HMAC_DRBG_RESEED_INTERVAL) {
+        _reseed_from_pool();
+    }
+#endif
+
+    _hmac_v();
+    memcpy(_out, _v, sizeof(_out));
+    _update(NULL, 0);
+
+    _blocks_since_reseed++;
+    _out_pos = 0;
+}
+
+void random_bytes(void *target, size_t n)
+{
+    uint8_t *dst = target;
+
+    while (n > 0) {
+        if (_out_pos == BLOCK_SIZE) {
+            _generate_block();
+        }
+
+        size_t len = MIN(n, (size_t)(BLOCK_SIZE - _out_pos));
+        memcpy(dst, &_out[_out_pos], len);
+        /* do not keep handed out bytes around */
+        memset(&_out[_out_pos], 0, len);
+
+        _out_pos += len;
+        dst += len;
+        n -= len;
+    }
+}
+
+uint32_t random_uint32(void)
+{
+    uint32_t ret;
+
+    random_bytes(&ret, sizeof(ret));
+    return ret;
+}
+
+void random_init_by_array(uint32_t init_key[], int key_length)
+{
+    _instantiate(init_key, key_length * sizeof(uint32_t));
+}
+
+void random_init(uint32_t seed)
+{
+#if IS_USED(MODULE_PERIPH_HWRNG)
+    /* a 32 bit seed is too little for a DRBG, take more from the hwrng. This
+     * only blocks once, later reseeds are collected in the background. */
+    uint32_t material[1 + SHA256_DIGEST_LENGTH / sizeof(uint32_t)];
+
+    material[0] = seed;
+    hwrng_read(&material[1], sizeof(material) - sizeof(material[0]));
+    random_init_by_array(material, ARRAY_SIZE(material));
+    memset(material, 0, sizeof(material));
+#else
+    random_init_by_array(&seed, 1);
+#endif
+
+#if HAS_POOL
+    _pool_init();
+#elif !IS_USED(MODULE_PERIPH_HWRNG)
+    LOG_WARNING("random: HMAC_DRBG has no entropy source to reseed from\n");
+#endif
+}
@@ -25,6 +25,7 @@
 #include "log.h"
 #include "random.h"
 #include "bitarithm.h"
+#include "kernel_defines.h"
 
 #ifdef MODULE_PUF_SRAM
 #include "puf_sram.h"
@@ -60,6 +61,8 @@ void auto_init_random(void)
     random_init(seed);
 }
 
+/* HMAC_DRBG generates whole blocks and provides its own random_bytes() */
+#if !IS_USED(MODULE_PRNG_HMAC_DRBG)
 void random_bytes(void *target, size_t n)
 {
     uint32_t random;
@@ -75,6 +78,7 @@ void random_bytes(void *target, size_t n)
         *dst++ = *random_pos++;
     }
 }
+#endif
 
 uint32_t random_uint32_range(uint32_t a, uint32_t b)
 {
@@ -36,6 +36,18 @@ static inline size_t min(size_t a, size_t b)
     return a <= b ? a : b;
 }
 
+static int _write_block(void *addr, const void *data)
+{
+    flashpage_write(addr, data, RIOTBOOT_FLASHPAGE_BUFFER_SIZE);
+
+    if (CONFIG_RIOTBOOT_FLASHWRITE_READBACK &&
+        memcmp(addr, data, RIOTBOOT_FLASHPAGE_BUFFER_SIZE) != 0) {
+        LOG_WARNING(LOG_PREFIX "readback of block at %p failed!\n", addr);
+        return -1;
+    }
+    return 0;
+}
+
 size_t riotboot_flashwrite_slotsize(
     const riotboot_flashwrite_t *state)
 {
@@ -61,6 +73,9 @@ int riotboot_flashwrite_init_raw(riotboot_flashwrite_t *state, int target_slot,
              target_slot);
 
     memset(state, 0, sizeof(riotboot_flashwrite_t));
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_VERIFY_SHA256)
+    sha256_init(&state->sha256);
+#endif
 
     state->offset = offset;
     state->target_slot = target_slot;
@@ -90,9 +105,9 @@ int riotboot_flashwrite_flush(riotboot_flashwrite_t *state)
         /* Get the offset of the remaining chunk */
         size_t flashpage_pos = state->offset - flashwrite_buffer_pos;
         /* Write remaining chunk */
-        flashpage_write(slot_start + flashpage_pos,
-                        state->flashpage_buf,
-                        RIOTBOOT_FLASHPAGE_BUFFER_SIZE);
+        if (_write_block(slot_start + flashpage_pos, state->flashpage_buf) < 0) {
+            return -1;
+        }
     }
     else {
         if (flashpage_write_and_verify(state->flashpage,
@@ -111,6 +126,11 @@ int riotboot_flashwrite_putbytes(riotboot_flashwrite_t *state,
     LOG_DEBUG(LOG_PREFIX "processing bytes %" PRIuSIZE "-%" PRIuSIZE "\n", state->offset,
               state->offset + len - 1);
 
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_VERIFY_SHA256)
+    /* hash while the data passes through, saves reading back the slot */
+    sha256_update(&state->sha256, bytes, len);
+#endif
+
     while (len) {
         /* Position within the page, calculated from state->offset by
          * subtracting the start offset of the current page */
@@ -154,9 +174,12 @@ int riotboot_flashwrite_putbytes(riotboot_flashwrite_t *state,
                        state->flashpage_buf, RIOTBOOT_FLASHPAGE_BUFFER_SIZE);
             }
             else {
-                flashpage_write((uint8_t *)addr + flashpage_pos,
-                                state->flashpage_buf,
-                                RIOTBOOT_FLASHPAGE_BUFFER_SIZE);
+                /* the block may have been started by a previous call */
+                uint8_t *block = (uint8_t *)addr + flashpage_pos -
+                                 flashwrite_buffer_pos;
+                if (_write_block(block, state->flashpage_buf) < 0) {
+                    return -1;
+                }
             }
 #else
             int res = flashpage_write_and_verify(state->flashpage,
@@ -221,8 +244,10 @@ int riotboot_flashwrite_finish_raw(riotboot_flashwrite_t *state,
 
 #if IS_ACTIVE(CONFIG_RIOTBOOT_FLASHWRITE_RAW)
     memcpy(state->firstblock_buf, bytes, len);
-    flashpage_write(slot_start, state->firstblock_buf,
-                    RIOTBOOT_FLASHPAGE_BUFFER_SIZE);
+    if (_write_block(slot_start, state->firstblock_buf) < 0) {
+        LOG_ERROR(LOG_PREFIX "re-flashing first block failed!\n");
+        return -1;
+    }
 #else
     uint8_t *firstpage;
 
@@ -26,6 +26,7 @@
 #include "architecture.h"
 #include "hashes/sha256.h"
 #include "log.h"
+#include "riotboot/flashwrite.h"
 #include "riotboot/slot.h"
 
 int riotboot_flashwrite_verify_sha256(const uint8_t *sha256_digest,
@@ -58,3 +59,14 @@ int riotboot_flashwrite_verify_sha256(const uint8_t *sha256_digest,
 
     return memcmp(sha256_digest, digest, SHA256_DIGEST_LENGTH) != 0;
 }
+
+size_t riotboot_flashwrite_digest_sha256(const riotboot_flashwrite_t *state,
+                                         uint8_t *sha256_digest)
+{
+    /* finalize a copy, the update may continue */
+    sha256_context_t sha256 = state->sha256;
+
+    sha256_final(&sha256, sha256_digest);
+
+    return state->offset;
+}
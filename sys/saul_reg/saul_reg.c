@@ -23,6 +23,7 @@
 #include <stdint.h>
 #include <string.h>
 
+#include "assert.h"
 #include "saul_reg.h"
 
 /**
@@ -110,6 +111,26 @@ int saul_reg_read(saul_reg_t *dev, phydat_t *res)
     return dev->driver->read(dev->dev, res);
 }
 
+int saul_reg_read_batch(saul_reg_t *dev, phydat_t *res, size_t count,
+                        uint32_t *period_us)
+{
+    if (dev == NULL) {
+        return -ENODEV;
+    }
+    assert(res && count && period_us);
+
+    if (dev->driver->read_batch) {
+        return dev->driver->read_batch(dev->dev, res, count, period_us);
+    }
+
+    int dim = dev->driver->read(dev->dev, res);
+    if (dim < 0) {
+        return dim;
+    }
+    *period_us = 0;
+    return 1;
+}
+
 int saul_reg_write(saul_reg_t *dev, const phydat_t *data)
 {
     if (dev == NULL) {
@@ -24,7 +24,19 @@
 #include "sched.h"
 #include "schedstatistics.h"
 #include "thread.h"
+#include "time_units.h"
+
+#if IS_USED(MODULE_SCHEDSTATISTICS_CYCLES)
+#include "clk.h"
+#include "cpu.h"
+#  if defined(__riscv)
+#  include "vendor/riscv_csr.h"
+#  elif !defined(DWT_CTRL_CYCCNTENA_Msk)
+#  error "schedstatistics_cycles: no cycle counter available on this CPU"
+#  endif
+#else
 #include "ztimer.h"
+#endif
 
 /**
  * When core_idle_thread is not active, the KERNEL_PID_UNDEF is used to track
@@ -32,14 +44,63 @@
  */
 schedstat_t sched_pidlist[KERNEL_PID_LAST + 1];
 
+static uint32_t _window_start;
+static uint32_t _window_len;
+static uint32_t _window_last_len;
+
+uint32_t schedstat_now(void)
+{
+#if IS_USED(MODULE_SCHEDSTATISTICS_CYCLES)
+#  if defined(__riscv)
+    return read_csr(mcycle);
+#  else
+    return DWT->CYCCNT;
+#  endif
+#else
+    return ztimer_now(ZTIMER_USEC);
+#endif
+}
+
+uint64_t schedstat_ticks_to_us(uint64_t ticks)
+{
+#if IS_USED(MODULE_SCHEDSTATISTICS_CYCLES)
+    uint32_t clk = coreclk();
+    /* split to avoid overflowing the multiplication for long runtimes */
+    return (ticks / clk) * US_PER_SEC + ((ticks % clk) * US_PER_SEC) / clk;
+#else
+    return ticks;
+#endif
+}
+
+uint32_t schedstat_window_ticks(void)
+{
+    return _window_last_len;
+}
+
+static void _window_rotate(uint32_t now)
+{
+    for (unsigned i = 0; i <= KERNEL_PID_LAST; i++) {
+        sched_pidlist[i].window_last = sched_pidlist[i].window_ticks;
+        sched_pidlist[i].window_ticks = 0;
+    }
+    _window_last_len = now - _window_start;
+    _window_start = now;
+}
+
 void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread)
 {
-    uint32_t now = ztimer_now(ZTIMER_USEC);
+    uint32_t now = schedstat_now();
 
     /* Update active thread stats */
     if (!IS_USED(MODULE_CORE_IDLE_THREAD) || active_thread != KERNEL_PID_UNDEF) {
         schedstat_t *active_stat = &sched_pidlist[active_thread];
-        active_stat->runtime_us += now - active_stat->laststart;
+        uint32_t delta = now - active_stat->laststart;
+        active_stat->runtime_ticks += delta;
+        active_stat->window_ticks += delta;
+    }
+
+    if ((now - _window_start) >= _window_len) {
+        _window_rotate(now);
     }
 
     /* Update next_thread stats */
@@ -52,10 +113,22 @@ void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread)
 
 void init_schedstatistics(void)
 {
+#if IS_USED(MODULE_SCHEDSTATISTICS_CYCLES)
+#  if !defined(__riscv)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#  endif
+    _window_len = (coreclk() / MS_PER_SEC) * CONFIG_SCHEDSTATISTICS_WINDOW_MS;
+#else
+    _window_len = CONFIG_SCHEDSTATISTICS_WINDOW_MS * US_PER_MS;
+#endif
+
     /* Init laststart for the thread starting schedstatistics since the callback
        wasn't registered when it was first scheduled */
     schedstat_t *active_stat = &sched_pidlist[thread_getpid()];
-    active_stat->laststart = ztimer_now(ZTIMER_USEC);
+    _window_start = schedstat_now();
+    active_stat->laststart = _window_start;
     active_stat->schedules = 1;
     sched_register_cb(sched_statistics_cb);
 }
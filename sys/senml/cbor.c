@@ -6,6 +6,7 @@
  * directory for more details.
  */
 
+#include "macros/utils.h"
 #include "senml.h"
 #include "senml/cbor.h"
 #include "nanocbor/nanocbor.h"
@@ -153,3 +154,42 @@ int senml_encode_data_cbor(nanocbor_encoder_t *enc, const senml_data_value_t *va
            nanocbor_fmt_int(enc, SENML_LABEL_DATA_VALUE) +
            nanocbor_put_bstr(enc, val->value, val->len);
 }
+
+#if IS_USED(MODULE_SENML_PHYDAT)
+int senml_encode_phydat_batch_cbor(nanocbor_encoder_t *enc,
+                                   const senml_phydat_batch_t *batch,
+                                   size_t first, size_t numof)
+{
+    senml_value_t val;
+    int n = 0;
+
+    if (first >= batch->numof) {
+        return 0;
+    }
+
+    size_t last = first + MIN(numof, batch->numof - first);
+
+    phydat_to_senml_decimal(&val, &batch->data[0], batch->dim);
+    senml_unit_t base_unit = val.attr.unit;
+
+    for (size_t i = first; i < last; i++) {
+        val = (senml_value_t){ 0 };
+        phydat_to_senml_decimal(&val, &batch->data[i], batch->dim);
+
+        if (val.attr.unit == base_unit) {
+            val.attr.unit = SENML_UNIT_NONE;
+        }
+        if (i == 0) {
+            val.attr.base_name = batch->base_name;
+            val.attr.base_time = batch->base_time;
+            val.attr.base_unit = base_unit;
+        }
+        if (batch->time != NULL) {
+            val.attr.time = batch->time[i];
+        }
+        n += senml_encode_value_cbor(enc, &val);
+    }
+
+    return n;
+}
+#endif
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#include <errno.h>
+
+#include "net/nanocoap.h"
+#include "nanocbor/nanocbor.h"
+#include "senml/cbor.h"
+#include "senml/coap.h"
+
+/* start of an indefinite length array and the break ending it */
+static const uint8_t _array_start = 0x9f;
+static const uint8_t _array_end = 0xff;
+
+ssize_t senml_coap_blockwise_put_pack(coap_block_slicer_t *slicer,
+                                      uint8_t *bufpos,
+                                      senml_coap_chunk_cb_t cb, void *arg)
+{
+    uint8_t chunk[CONFIG_SENML_COAP_CHUNK_SIZE];
+    uint8_t *start = bufpos;
+
+    bufpos += coap_blockwise_put_bytes(slicer, bufpos, &_array_start, 1);
+
+    for (unsigned i = 0;; i++) {
+        nanocbor_encoder_t enc;
+
+        nanocbor_encoder_init(&enc, chunk, sizeof(chunk));
+        int res = cb(&enc, i, arg);
+        if (res < 0) {
+            return res;
+        }
+        if (res == 0) {
+            break;
+        }
+
+        size_t chunk_len = nanocbor_encoded_len(&enc);
+        if (chunk_len > sizeof(chunk)) {
+            return -ENOBUFS;
+        }
+        bufpos += coap_blockwise_put_bytes(slicer, bufpos, chunk, chunk_len);
+    }
+
+    bufpos += coap_blockwise_put_bytes(slicer, bufpos, &_array_end, 1);
+
+    return bufpos - start;
+}
+
+#if IS_USED(MODULE_SENML_PHYDAT)
+static int _phydat_batch_chunk(nanocbor_encoder_t *enc, unsigned idx,
+                               void *arg)
+{
+    /* one record per chunk, so even the first one carrying the base name
+     * fits into a chunk of moderate size */
+    return senml_encode_phydat_batch_cbor(enc, arg, idx, 1);
+}
+
+ssize_t senml_coap_phydat_batch_reply(coap_pkt_t *pdu, uint8_t *buf,
+                                      size_t len,
+                                      const senml_phydat_batch_t *batch)
+{
+    coap_block_slicer_t slicer;
+
+    coap_block2_init(pdu, &slicer);
+    uint8_t *payload = buf + coap_get_total_hdr_len(pdu);
+    uint8_t *bufpos = payload;
+    bufpos += coap_put_option_ct(bufpos, 0, COAP_FORMAT_SENML_CBOR);
+    bufpos += coap_opt_put_block2(bufpos, COAP_OPT_CONTENT_FORMAT, &slicer, 1);
+
+    *bufpos++ = COAP_PAYLOAD_MARKER;
+
+    ssize_t res = senml_coap_blockwise_put_pack(&slicer, bufpos,
+                                                _phydat_batch_chunk,
+                                                (void *)batch);
+    if (res < 0) {
+        return coap_reply_simple(pdu, COAP_CODE_INTERNAL_SERVER_ERROR, buf,
+                                 len, 0, NULL, 0);
+    }
+    bufpos += res;
+
+    unsigned payload_len = bufpos - payload;
+    return coap_block2_build_reply(pdu, COAP_CODE_205, buf, len, payload_len,
+                                   &slicer);
+}
+#endif
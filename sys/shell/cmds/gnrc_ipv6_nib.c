@@ -13,6 +13,7 @@
  * @author  Martine Lenders <m.lenders@fu-berlin.de>
  */
 
+#include <inttypes.h>
 #include <stdio.h>
 
 #include "kernel_defines.h"
@@ -90,7 +91,11 @@ static void _usage_nib_prefix(char **argv)
 
 static void _usage_nib_route(char **argv)
 {
+#if CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF
+    printf("usage: %s %s [show|add|del|cache|help]\n", argv[0], argv[1]);
+#else
     printf("usage: %s %s [show|add|del|help]\n", argv[0], argv[1]);
+#endif
     printf("       %s %s add <iface> <prefix>[/<prefix_len>] <next_hop> [<ltime in sec>]\n",
            argv[0], argv[1]);
     printf("       %s %s del <iface> <prefix>[/<prefix_len>]\n", argv[0], argv[1]);
@@ -297,6 +302,15 @@ static int _nib_route(int argc, char **argv)
         }
         gnrc_ipv6_nib_ft_del(&pfx, pfx_len);
     }
+#if CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_NUMOF
+    else if ((argc > 2) && (strcmp(argv[2], "cache") == 0)) {
+        gnrc_ipv6_nib_ft_cache_stats_t stats;
+
+        gnrc_ipv6_nib_ft_cache_stats(&stats);
+        printf("route cache: %" PRIu32 " hits, %" PRIu32 " misses\n",
+               stats.hits, stats.misses);
+    }
+#endif
     else {
         _usage_nib_route(argv);
         return 1;
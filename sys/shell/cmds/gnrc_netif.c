@@ -20,6 +20,7 @@
 
 #include <assert.h>
 #include <ctype.h>
+#include <inttypes.h>
 #include <limits.h>
 #include <stdio.h>
 #include <string.h>
@@ -147,6 +148,8 @@ static const char *_netstats_module_to_str(uint8_t module)
         return "Layer 2";
     case NETSTATS_IPV6:
         return "IPv6";
+    case NETSTATS_LATENCY:
+        return "latency";
     case NETSTATS_ALL:
         return "all";
     default:
@@ -182,10 +185,72 @@ static int _netif_stats(netif_t *iface, unsigned module, bool reset)
                (unsigned)stats.tx_bytes,
                (unsigned)stats.tx_success,
                (unsigned)stats.tx_failed);
+        if (stats.rx_dropped) {
+            printf("            RX dropped %u\n", (unsigned)stats.rx_dropped);
+        }
+        if (stats.tx_queue_max) {
+            printf("            TX queue %u (max %u) bursts %u frames %u\n",
+                   (unsigned)stats.tx_queue_len,
+                   (unsigned)stats.tx_queue_max,
+                   (unsigned)stats.tx_bursts,
+                   (unsigned)stats.tx_burst_frames);
+        }
+        if (stats.tx_ring_max || stats.rx_ring_max) {
+            printf("            DMA ring TX max %u RX max %u\n",
+                   (unsigned)stats.tx_ring_max,
+                   (unsigned)stats.rx_ring_max);
+        }
         res = 0;
     }
     return res;
 }
+
+#if IS_USED(MODULE_NETSTATS_LATENCY)
+static void _netif_stats_latency(netif_t *iface, bool reset)
+{
+    static const char *stages[] = {
+        [NETSTATS_LATENCY_NETIF] = "netif",
+        [NETSTATS_LATENCY_6LO] = "6LoWPAN",
+        [NETSTATS_LATENCY_IPV6] = "IPv6",
+        [NETSTATS_LATENCY_TRANSPORT] = "UDP",
+        [NETSTATS_LATENCY_SOCK] = "sock",
+    };
+    netstats_latency_t stats;
+
+    if (reset) {
+        int res = netif_set_opt(iface, NETOPT_STATS, NETSTATS_LATENCY, NULL, 0);
+        printf("Reset statistics for module %s: %s!\n",
+               _netstats_module_to_str(NETSTATS_LATENCY),
+               (res < 0) ? "failed" : "succeeded");
+        return;
+    }
+    if (netif_get_opt(iface, NETOPT_STATS, NETSTATS_LATENCY, &stats,
+                      sizeof(stats)) < 0) {
+        printf("           Protocol or device doesn't provide statistics.\n");
+        return;
+    }
+    printf("          Receive latency since device interrupt (packets per "
+           "< us)\n");
+    for (unsigned i = 0; i < NETSTATS_LATENCY_STAGES; i++) {
+        if (stats.max[i] == 0) {
+            continue;
+        }
+        printf("            %-7s max %" PRIu32 " us\n             ", stages[i],
+               stats.max[i]);
+        for (unsigned j = 0; j < CONFIG_NETSTATS_LATENCY_BUCKETS; j++) {
+            if (stats.hist[i][j]) {
+                if (j == CONFIG_NETSTATS_LATENCY_BUCKETS - 1) {
+                    printf(" >=%lu: %" PRIu32, 1LU << j, stats.hist[i][j]);
+                }
+                else {
+                    printf(" <%lu: %" PRIu32, 2LU << j, stats.hist[i][j]);
+                }
+            }
+        }
+        puts("");
+    }
+}
+#endif /* MODULE_NETSTATS_LATENCY */
 #endif /* MODULE_NETSTATS */
 
 static void _link_usage(char *cmd_name)
@@ -290,7 +355,7 @@ static void _del_usage(char *cmd_name)
 #ifdef MODULE_NETSTATS
 static void _stats_usage(char *cmd_name)
 {
-    printf("usage: %s <if_id> stats [l2|ipv6] [reset]\n", cmd_name);
+    printf("usage: %s <if_id> stats [l2|ipv6|latency] [reset]\n", cmd_name);
     printf("       reset can be only used if the module is specified.\n");
 }
 #endif
@@ -1912,6 +1977,11 @@ int _gnrc_netif_config(int argc, char **argv)
             else if (strcmp(argv[3], "ipv6") == 0) {
                 module = NETSTATS_IPV6;
             }
+#if IS_USED(MODULE_NETSTATS_LATENCY)
+            else if (strcmp(argv[3], "latency") == 0) {
+                module = NETSTATS_LATENCY;
+            }
+#endif
             else {
                 printf("Module %s doesn't exist or does not provide statistics.\n", argv[3]);
 
@@ -1928,6 +1998,11 @@ int _gnrc_netif_config(int argc, char **argv)
             if (module & NETSTATS_IPV6) {
                 _netif_stats(iface, NETSTATS_IPV6, reset);
             }
+#if IS_USED(MODULE_NETSTATS_LATENCY)
+            if (module & NETSTATS_LATENCY) {
+                _netif_stats_latency(iface, reset);
+            }
+#endif
 
             return 1;
         }
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_shell_commands
+ * @{
+ *
+ * @file
+ * @brief       Shell command to print mutex and message queue contention
+ *              recorded by lockstats
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "lockstats.h"
+#include "sched.h"
+#include "shell.h"
+#include "thread.h"
+
+static uint32_t _avg(uint64_t total, uint32_t n)
+{
+    return n ? total / n : 0;
+}
+
+static void _print_mutexes(void)
+{
+    lockstats_mutex_t s;
+
+    puts("mutex              locks  waits  wait avg/max [us]  hold avg/max [us]");
+    for (unsigned i = 0; i < CONFIG_LOCKSTATS_MUTEX_NUMOF; i++) {
+        if (!lockstats_mutex_get(i, &s)) {
+            continue;
+        }
+        if (s.name) {
+            printf("%-16s", s.name);
+        }
+        else {
+            printf("%-16p", (void *)s.mutex);
+        }
+        printf(" %7" PRIu32 " %6" PRIu32 " %8" PRIu32 "/%-8" PRIu32
+               " %8" PRIu32 "/%-8" PRIu32 "\n",
+               s.locks, s.contentions,
+               _avg(s.wait_total, s.contentions), s.wait_max,
+               _avg(s.hold_total, s.locks), s.hold_max);
+    }
+    if (lockstats_untracked()) {
+        printf("waits on untracked mutexes: %" PRIu32 "\n", lockstats_untracked());
+    }
+}
+
+static void _print_queues(void)
+{
+    puts("pid name             size   max  full");
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        thread_t *thread = thread_get(pid);
+        lockstats_msg_queue_t s;
+
+        if (!thread || !thread_has_msg_queue(thread)) {
+            continue;
+        }
+        lockstats_msg_queue_get(pid, &s);
+
+        const char *name = thread_getname(pid);
+        printf("%3" PRIkernel_pid " %-16s %4u  %4u  %4u\n", pid,
+               name ? name : "-", (unsigned)thread->msg_queue.mask + 1,
+               (unsigned)s.high_watermark, (unsigned)s.full);
+    }
+}
+
+static int _lockstats_handler(int argc, char **argv)
+{
+    if (argc < 2) {
+        _print_mutexes();
+        _print_queues();
+        return 0;
+    }
+    if (strcmp(argv[1], "reset") == 0) {
+        lockstats_reset();
+        return 0;
+    }
+    printf("usage: %s [reset]\n", argv[0]);
+    return 1;
+}
+
+SHELL_COMMAND(lockstats, "print mutex and msg queue contention",
+              _lockstats_handler);
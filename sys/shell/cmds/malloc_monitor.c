@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_shell_commands
+ * @{
+ *
+ * @file
+ * @brief       Shell command to print the heap usage recorded by
+ *              malloc_monitor
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "architecture.h"
+#include "malloc_monitor.h"
+#include "sched.h"
+#include "shell.h"
+#include "thread.h"
+
+static void _print_usage(void)
+{
+    printf("heap usage: %" PRIuSIZE " bytes, max %" PRIuSIZE " bytes\n",
+           malloc_monitor_get_usage_current(),
+           malloc_monitor_get_usage_high_watermark());
+
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        size_t max = malloc_monitor_get_thread_usage_high_watermark(pid);
+        const char *name = thread_getname(pid);
+
+        if (max == 0) {
+            continue;
+        }
+        printf("  pid %" PRIkernel_pid " %-16s %" PRIuSIZE " bytes, max %"
+               PRIuSIZE " bytes\n", pid, name ? name : "-",
+               malloc_monitor_get_thread_usage_current(pid), max);
+    }
+}
+
+static int _malloc_monitor_handler(int argc, char **argv)
+{
+    if (argc < 2) {
+        _print_usage();
+        return 0;
+    }
+    if (strcmp(argv[1], "reset") == 0) {
+        malloc_monitor_reset_high_watermark();
+#ifdef MODULE_MALLOC_MONITOR_TRACE
+        malloc_monitor_trace_reset();
+#endif
+        return 0;
+    }
+#ifdef MODULE_MALLOC_MONITOR_TRACE
+    if (strcmp(argv[1], "trace") == 0) {
+        malloc_monitor_trace_dump();
+        return 0;
+    }
+    printf("usage: %s [reset|trace]\n", argv[0]);
+#else
+    printf("usage: %s [reset]\n", argv[0]);
+#endif
+    return 1;
+}
+
+SHELL_COMMAND(malloc_monitor, "print heap usage", _malloc_monitor_handler);
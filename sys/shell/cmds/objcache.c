@@ -0,0 +1,32 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_shell_commands
+ * @{
+ *
+ * @file
+ * @brief       Shell command to print the usage of all object caches
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include "objcache.h"
+#include "shell.h"
+
+static int _objcache_handler(int argc, char **argv)
+{
+    (void)argc;
+    (void)argv;
+    objcache_stats();
+    return 0;
+}
+
+SHELL_COMMAND(objcache, "print usage of object caches", _objcache_handler);
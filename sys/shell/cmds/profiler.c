@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_shell_commands
+ * @{
+ *
+ * @file
+ * @brief       Shell command to control the sampling profiler
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "profiler.h"
+#include "shell.h"
+
+static int _profiler_handler(int argc, char **argv)
+{
+    if (argc < 2) {
+        goto usage;
+    }
+    if (strcmp(argv[1], "start") == 0) {
+        profiler_start(argc > 2 ? strtoul(argv[2], NULL, 0) : 0);
+    }
+    else if (strcmp(argv[1], "stop") == 0) {
+        profiler_stop();
+    }
+    else if (strcmp(argv[1], "reset") == 0) {
+        profiler_reset();
+    }
+    else if (strcmp(argv[1], "dump") == 0) {
+        profiler_dump();
+    }
+    else {
+        goto usage;
+    }
+    return 0;
+
+usage:
+    printf("usage: %s start [period_us]|stop|reset|dump\n", argv[0]);
+    return 1;
+}
+
+SHELL_COMMAND(profiler, "control the sampling profiler", _profiler_handler);
@@ -18,17 +18,28 @@
  * @}
  */
 
+#include <stdio.h>
+#include <string.h>
+
+#include "kernel_defines.h"
 #include "ps.h"
 #include "shell.h"
 
 static int _ps_handler(int argc, char **argv)
 {
-    (void) argc;
-    (void) argv;
+    if (argc < 2) {
+        ps();
+        return 0;
+    }
 
-    ps();
+    if (IS_USED(MODULE_SCHEDSTATISTICS) && (strcmp(argv[1], "-t") == 0)) {
+        ps_window();
+        return 0;
+    }
 
-    return 0;
+    printf("usage: %s%s\n", argv[0],
+           IS_USED(MODULE_SCHEDSTATISTICS) ? " [-t]" : "");
+    return 1;
 }
 
 SHELL_COMMAND(ps, "Prints information about running threads.", _ps_handler);
@@ -30,6 +30,7 @@
 #include <fcntl.h>
 
 #include "architecture.h"
+#include "container.h"
 #include "macros/units.h"
 #include "shell.h"
 #include "tiny_strerror.h"
@@ -41,6 +42,12 @@
 #endif
 
 #define SHELL_VFS_BUFSIZE 256
+
+/**
+ * @brief Number of directory entries read at once by ls
+ */
+#define LS_BATCH_SIZE 4
+
 static uint8_t _shell_vfs_data_buffer[SHELL_VFS_BUFSIZE];
 
 /**
@@ -627,16 +634,12 @@ static int _ls_handler(int argc, char **argv)
 
     while (1) {
         char path_name[2 * (VFS_NAME_MAX + 1)];
-        vfs_dirent_t entry;
-        struct stat stat;
+        vfs_dirent_t entries[LS_BATCH_SIZE];
+        struct stat stats[LS_BATCH_SIZE];
 
-        res = vfs_readdir(&dir, &entry);
+        res = vfs_readdir_batch(&dir, entries, stats, ARRAY_SIZE(entries));
         if (res < 0) {
             printf("vfs_readdir error: %s\n", tiny_strerror(res));
-            if (res == -EAGAIN) {
-                /* try again */
-                continue;
-            }
             ret = 2;
             break;
         }
@@ -645,19 +648,26 @@ static int _ls_handler(int argc, char **argv)
             break;
         }
 
-        snprintf(path_name, sizeof(path_name), "%s/%s", path, entry.d_name);
-        vfs_stat(path_name, &stat);
+        for (int i = 0; i < res; i++) {
+            struct stat *stat = &stats[i];
 
-        printf("%s", entry.d_name);
-        if (stat.st_mode & S_IFDIR) {
-            printf("/");
-        } else if (stat.st_mode & S_IFREG) {
-            if (stat.st_size) {
-                printf("\t%lu B", stat.st_size);
+            if (stat->st_mode == 0) {
+                /* not provided by the file system while reading the directory */
+                snprintf(path_name, sizeof(path_name), "%s/%s", path, entries[i].d_name);
+                vfs_stat(path_name, stat);
             }
-            ++nfiles;
+
+            printf("%s", entries[i].d_name);
+            if (stat->st_mode & S_IFDIR) {
+                printf("/");
+            } else if (stat->st_mode & S_IFREG) {
+                if (stat->st_size) {
+                    printf("\t%lu B", stat->st_size);
+                }
+                ++nfiles;
+            }
+            puts("");
         }
-        puts("");
     }
     if (ret == 0) {
         printf("total %u files\n", nfiles);
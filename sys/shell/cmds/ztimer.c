@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_shell_commands
+ * @{
+ *
+ * @file
+ * @brief       Shell command to print the interrupt statistics of ztimer
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "shell.h"
+#include "ztimer.h"
+
+static void _print_stats(const char *name, ztimer_clock_t *clock)
+{
+    ztimer_stats_t stats;
+
+    ztimer_stats_get(clock, &stats);
+
+    uint32_t avg = stats.isr_count
+                 ? (uint32_t)(stats.handler_sum / stats.isr_count) : 0;
+
+    printf("%-12s %10" PRIu32 " %10" PRIu32 " %8" PRIu32 " %8" PRIu32
+           " %6u %6u\n", name, stats.isr_count, stats.triggered, avg,
+           stats.handler_max, clock->adjust_set, clock->adjust_sleep);
+}
+
+static void _reset_stats(const char *name, ztimer_clock_t *clock)
+{
+    (void)name;
+    ztimer_stats_reset(clock);
+}
+
+static void _for_each_clock(void (*fn)(const char *name, ztimer_clock_t *clock))
+{
+#if MODULE_ZTIMER_USEC
+    fn("ZTIMER_USEC", ZTIMER_USEC);
+#endif
+#if MODULE_ZTIMER_MSEC
+    fn("ZTIMER_MSEC", ZTIMER_MSEC);
+#endif
+#if MODULE_ZTIMER_SEC
+    fn("ZTIMER_SEC", ZTIMER_SEC);
+#endif
+    (void)fn;
+}
+
+static int _ztimer_handler(int argc, char **argv)
+{
+    if (argc == 1) {
+        printf("%-12s %10s %10s %8s %8s %6s %6s\n", "clock", "isr", "triggered",
+               "avg", "max", "a_set", "a_slp");
+        _for_each_clock(_print_stats);
+        return 0;
+    }
+
+    if ((argc == 2) && !strcmp(argv[1], "reset")) {
+        _for_each_clock(_reset_stats);
+        return 0;
+    }
+
+    printf("usage: %s [reset]\n", argv[0]);
+    return 1;
+}
+
+SHELL_COMMAND(ztimer, "print ztimer interrupt statistics", _ztimer_handler);
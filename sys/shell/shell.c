@@ -37,6 +37,7 @@
 #include <errno.h>
 
 #include "kernel_defines.h"
+#include "stdio_base.h"
 #include "xfa.h"
 #include "shell.h"
 #include "shell_lock.h"
@@ -404,6 +405,32 @@ static inline void new_line(void)
     }
 }
 
+/* Input read from stdio, but not yet consumed by readline() */
+static struct {
+    uint8_t pos;
+    uint8_t len;
+    char buf[CONFIG_SHELL_INPUT_BUFSIZE];
+} _input;
+
+static_assert(CONFIG_SHELL_INPUT_BUFSIZE <= UINT8_MAX,
+              "CONFIG_SHELL_INPUT_BUFSIZE too large");
+
+static int _getchar(void)
+{
+    if (_input.pos == _input.len) {
+        /* echo everything before waiting for more input */
+        flush_if_needed();
+
+        ssize_t res = stdio_read(_input.buf, sizeof(_input.buf));
+        if (res <= 0) {
+            return EOF;
+        }
+        _input.pos = 0;
+        _input.len = res;
+    }
+    return (unsigned char)_input.buf[_input.pos++];
+}
+
 /**
  * @brief   Read a single line from standard input into a buffer.
  *
@@ -437,7 +464,7 @@ int readline(char *buf, size_t size) /* needed externally by module shell_lock *
     while (1) {
         assert((size_t) curr_pos < size);
 
-        int c = getchar();
+        int c = _getchar();
 
         switch (c) {
 
@@ -458,6 +485,7 @@ int readline(char *buf, size_t size) /* needed externally by module shell_lock *
                 buf[curr_pos] = '\0';
 
                 new_line();
+                flush_if_needed();
 
                 return (length_exceeded) ? -ENOBUFS : curr_pos;
 
@@ -486,8 +514,6 @@ int readline(char *buf, size_t size) /* needed externally by module shell_lock *
                 echo_char(c);
                 break;
         }
-
-        flush_if_needed();
     }
 }
 
@@ -44,8 +44,22 @@ static void _isrpipe_write_one_wrapper(void *arg, uint8_t value)
     isrpipe_write_one(arg, value);
 }
 
+#if IS_USED(MODULE_PERIPH_UART_RX_BULK)
+static void _isrpipe_write_wrapper(void *arg, const uint8_t *data, size_t len)
+{
+    isrpipe_write(arg, data, len);
+}
+#endif
+
 static void _init(void)
 {
+#if IS_USED(MODULE_PERIPH_UART_RX_BULK)
+    if (IS_USED(MODULE_STDIO_UART_RX)) {
+        uart_init_rx_bulk(STDIO_UART_DEV, STDIO_UART_BAUDRATE,
+                          _isrpipe_write_wrapper, &stdin_isrpipe);
+        return;
+    }
+#endif
     uart_rx_cb_t cb = NULL;
     void *arg = NULL;
 
@@ -86,6 +100,10 @@ static ssize_t _write(const void *buffer, size_t len)
 
 static void _detach(void)
 {
+#if IS_USED(MODULE_STDIO_UART_NONBLOCKING)
+    /* don't cut off buffered output */
+    uart_flush(STDIO_UART_DEV);
+#endif
     uart_poweroff(STDIO_UART_DEV);
 }
 
@@ -22,14 +22,17 @@
  * @}
  */
 
+#include <errno.h>
 #include <inttypes.h>
 #include <nanocbor/nanocbor.h>
 #include <assert.h>
+#include <string.h>
 
 #include "architecture.h"
 #include "hashes/sha256.h"
 
 #include "kernel_defines.h"
+#include "macros/utils.h"
 #include "suit/conditions.h"
 #include "suit/handlers.h"
 #include "suit/policy.h"
@@ -48,6 +51,13 @@
 #if defined(MODULE_PROGRESS_BAR)
 #include "progress_bar.h"
 #endif
+#ifdef MODULE_SUIT_PAYLOAD_HEATSHRINK
+#include "heatshrink_decoder.h"
+#endif
+#ifdef MODULE_SUIT_PAYLOAD_VCDIFF
+#include "riotboot/slot.h"
+#include "vcdiff.h"
+#endif
 
 #include "log.h"
 
@@ -291,6 +301,16 @@ static int _dtv_set_param(suit_manifest_t *manifest, int key,
             case SUIT_PARAMETER_URI:
                 ref = &comp->param_uri;
                 break;
+#ifdef MODULE_SUIT_PAYLOAD_HEATSHRINK
+            case SUIT_PARAMETER_COMPRESSION_INFO:
+                ref = &comp->param_compression_info;
+                break;
+#endif
+#ifdef MODULE_SUIT_PAYLOAD_VCDIFF
+            case SUIT_PARAMETER_UNPACK_INFO:
+                ref = &comp->param_unpack_info;
+                break;
+#endif
             default:
                 LOG_DEBUG("Unsupported parameter %" PRIi32 "\n", param_key);
                 return SUIT_ERR_UNSUPPORTED;
@@ -348,20 +368,15 @@ static inline void _print_download_progress(suit_manifest_t *manifest,
 }
 
 #if defined(MODULE_SUIT_TRANSPORT_COAP) || defined(MODULE_SUIT_TRANSPORT_VFS)
-static int _storage_helper(void *arg, size_t offset, uint8_t *buf, size_t len,
-                           int more)
+static int _storage_write(suit_manifest_t *manifest, suit_component_t *comp,
+                          size_t offset, const uint8_t *buf, size_t len,
+                          int more)
 {
-    suit_manifest_t *manifest = (suit_manifest_t *)arg;
-
     uint32_t image_size;
-    nanocbor_value_t param_size;
     size_t total = offset + len;
-    suit_component_t *comp = &manifest->components[manifest->component_current];
-    suit_param_ref_t *ref_size = &comp->param_size;
 
     /* Grab the total image size from the manifest */
-    if ((suit_param_ref_to_cbor(manifest, ref_size, &param_size) == 0) ||
-            (nanocbor_get_uint32(&param_size, &image_size) < 0)) {
+    if (_get_component_size(manifest, comp, &image_size) < 0) {
         /* Early exit if the total image size can't be determined */
         return -1;
     }
@@ -382,14 +397,255 @@ static int _storage_helper(void *arg, size_t offset, uint8_t *buf, size_t len,
 
     _print_download_progress(manifest, offset, len, image_size);
 
-    int res = suit_storage_write(comp->storage_backend, manifest, buf, offset, len);
-    if (!more) {
+    int res = len ? suit_storage_write(comp->storage_backend, manifest, buf,
+                                       offset, len) : SUIT_OK;
+    if (!more && res >= 0) {
         LOG_INFO("Finalizing payload store\n");
         /* Finalize the write if no more data available */
         res = suit_storage_finish(comp->storage_backend, manifest);
     }
     return res;
 }
+
+#if defined(MODULE_SUIT_PAYLOAD_HEATSHRINK) || defined(MODULE_SUIT_PAYLOAD_VCDIFF)
+/* Only one payload is fetched at a time, by the SUIT worker */
+static struct {
+    size_t offset;              /* processed bytes passed to the storage */
+    size_t fill;                /* bytes in buf */
+    uint8_t buf[CONFIG_SUIT_PAYLOAD_BUF_SIZE];
+} _out;
+
+static bool _param_is(suit_manifest_t *manifest, const suit_param_ref_t *ref,
+                      int32_t value)
+{
+    nanocbor_value_t param;
+    int32_t val;
+
+    return (suit_param_ref_to_cbor(manifest, ref, &param) != 0) &&
+           (nanocbor_get_int32(&param, &val) >= 0) &&
+           (val == value);
+}
+
+static void _out_reset(void)
+{
+    _out.offset = 0;
+    _out.fill = 0;
+}
+
+/* Pass only full buffers, the last one is written by _out_finish() */
+static int _out_commit(suit_manifest_t *manifest, suit_component_t *comp,
+                       size_t len)
+{
+    _out.fill += len;
+    if (_out.fill == sizeof(_out.buf)) {
+        int res = _storage_write(manifest, comp, _out.offset, _out.buf,
+                                 _out.fill, 1);
+        if (res < 0) {
+            return res;
+        }
+        _out.offset += _out.fill;
+        _out.fill = 0;
+    }
+    return 0;
+}
+
+static int _out_finish(suit_manifest_t *manifest, suit_component_t *comp)
+{
+    return _storage_write(manifest, comp, _out.offset, _out.buf, _out.fill, 0);
+}
+#endif
+
+#ifdef MODULE_SUIT_PAYLOAD_HEATSHRINK
+static heatshrink_decoder _hsd;
+
+static int _hs_poll(suit_manifest_t *manifest, suit_component_t *comp)
+{
+    HSD_poll_res pres;
+
+    do {
+        size_t n;
+        pres = heatshrink_decoder_poll(&_hsd, &_out.buf[_out.fill],
+                                       sizeof(_out.buf) - _out.fill, &n);
+        if (pres < 0) {
+            return -1;
+        }
+        int res = _out_commit(manifest, comp, n);
+        if (res < 0) {
+            return res;
+        }
+    } while (pres == HSDR_POLL_MORE);
+
+    return 0;
+}
+
+static int _hs_finish(suit_manifest_t *manifest, suit_component_t *comp)
+{
+    int res;
+
+    while (heatshrink_decoder_finish(&_hsd) == HSDR_FINISH_MORE) {
+        res = _hs_poll(manifest, comp);
+        if (res < 0) {
+            return res;
+        }
+    }
+    return _out_finish(manifest, comp);
+}
+
+static int _hs_write(suit_manifest_t *manifest, suit_component_t *comp,
+                     size_t offset, const uint8_t *buf, size_t len, int more)
+{
+    if (offset == 0) {
+        heatshrink_decoder_reset(&_hsd);
+        _out_reset();
+    }
+
+    while (len) {
+        size_t sunk;
+        if (heatshrink_decoder_sink(&_hsd, (uint8_t *)buf, len, &sunk) < 0) {
+            return -1;
+        }
+        buf += sunk;
+        len -= sunk;
+
+        int res = _hs_poll(manifest, comp);
+        if (res < 0) {
+            return res;
+        }
+    }
+
+    return more ? 0 : _hs_finish(manifest, comp);
+}
+#endif
+
+#ifdef MODULE_SUIT_PAYLOAD_VCDIFF
+static vcdiff_t _vcdiff;
+
+/* The source of the delta is the image in the running slot */
+static int _vcdiff_source_read(void *dev, uint8_t *dest, size_t offset,
+                               size_t len)
+{
+    (void)dev;
+    int slot = riotboot_slot_current();
+
+    if (offset + len > riotboot_slot_size(slot)) {
+        return -EINVAL;
+    }
+    memcpy(dest, (const uint8_t *)riotboot_slot_get_hdr(slot) + offset, len);
+    return 0;
+}
+
+/* The target is written through the storage backend, which erases the flash
+ * and computes the digest on the way */
+static int _vcdiff_no_erase(void *dev, size_t offset, size_t len)
+{
+    (void)dev;
+    (void)offset;
+    (void)len;
+    return 0;
+}
+
+static int _vcdiff_target_write(void *dev, uint8_t *src, size_t offset,
+                                size_t len)
+{
+    suit_manifest_t *manifest = dev;
+    suit_component_t *comp = _get_component(manifest);
+
+    assert(offset == _out.offset + _out.fill);
+    (void)offset;
+
+    while (len) {
+        size_t n = MIN(len, sizeof(_out.buf) - _out.fill);
+        memcpy(&_out.buf[_out.fill], src, n);
+        int res = _out_commit(manifest, comp, n);
+        if (res < 0) {
+            return res;
+        }
+        src += n;
+        len -= n;
+    }
+    return 0;
+}
+
+/* Copies from the target need the data already written to flash, which is
+ * not available while the storage backend buffers it. Deltas must be created
+ * without target matches, the default of open-vcdiff. */
+static int _vcdiff_unsupported(void *dev, uint8_t *buf, size_t offset,
+                               size_t len)
+{
+    (void)dev;
+    (void)buf;
+    (void)offset;
+    (void)len;
+    return -ENOTSUP;
+}
+
+static int _vcdiff_no_flush(void *dev)
+{
+    (void)dev;
+    return 0;
+}
+
+static const vcdiff_driver_t _vcdiff_source_driver = {
+    .erase = _vcdiff_no_erase,
+    .read = _vcdiff_source_read,
+    .write = _vcdiff_unsupported,
+    .flush = _vcdiff_no_flush,
+};
+
+static const vcdiff_driver_t _vcdiff_target_driver = {
+    .erase = _vcdiff_no_erase,
+    .read = _vcdiff_unsupported,
+    .write = _vcdiff_target_write,
+    .flush = _vcdiff_no_flush,
+};
+
+static int _vcdiff_write(suit_manifest_t *manifest, suit_component_t *comp,
+                         size_t offset, const uint8_t *buf, size_t len,
+                         int more)
+{
+    int res;
+
+    if (offset == 0) {
+        vcdiff_init(&_vcdiff);
+        vcdiff_set_source_driver(&_vcdiff, &_vcdiff_source_driver, NULL);
+        vcdiff_set_target_driver(&_vcdiff, &_vcdiff_target_driver, manifest);
+        _out_reset();
+    }
+
+    res = vcdiff_apply_delta(&_vcdiff, buf, len);
+    if ((res < 0) || more) {
+        return res;
+    }
+
+    res = vcdiff_finish(&_vcdiff);
+    if (res < 0) {
+        return res;
+    }
+    return _out_finish(manifest, comp);
+}
+#endif
+
+static int _storage_helper(void *arg, size_t offset, uint8_t *buf, size_t len,
+                           int more)
+{
+    suit_manifest_t *manifest = (suit_manifest_t *)arg;
+    suit_component_t *comp = &manifest->components[manifest->component_current];
+
+    /* The image size and digest apply to the processed payload */
+#ifdef MODULE_SUIT_PAYLOAD_HEATSHRINK
+    if (_param_is(manifest, &comp->param_compression_info,
+                  SUIT_COMPRESSION_HEATSHRINK)) {
+        return _hs_write(manifest, comp, offset, buf, len, more);
+    }
+#endif
+#ifdef MODULE_SUIT_PAYLOAD_VCDIFF
+    if (_param_is(manifest, &comp->param_unpack_info, SUIT_UNPACK_VCDIFF)) {
+        return _vcdiff_write(manifest, comp, offset, buf, len, more);
+    }
+#endif
+
+    return _storage_write(manifest, comp, offset, buf, len, more);
+}
 #endif
 
 static int _dtv_fetch(suit_manifest_t *manifest, int key,
@@ -445,9 +701,21 @@ static int _dtv_fetch(suit_manifest_t *manifest, int key,
 #ifdef MODULE_SUIT_TRANSPORT_COAP
     else if ((strncmp(manifest->urlbuf, "coap://", 7) == 0) ||
              (IS_USED(MODULE_NANOCOAP_DTLS) && strncmp(manifest->urlbuf, "coaps://", 8) == 0)) {
+#if CONFIG_SUIT_COAP_BLOCK_WINDOW > 1
+        static uint8_t reorder_buf[NANOCOAP_SOCK_BLOCK_WINDOW_BUF_SIZE(
+                                   CONFIG_SUIT_COAP_BLOCK_WINDOW,
+                                   CONFIG_SUIT_COAP_BLOCKSIZE)];
+
+        res = nanocoap_get_blockwise_window_url(manifest->urlbuf,
+                                                CONFIG_SUIT_COAP_BLOCKSIZE,
+                                                CONFIG_SUIT_COAP_BLOCK_WINDOW,
+                                                COAP_TYPE_CON, reorder_buf,
+                                                _storage_helper, manifest);
+#else
         res = nanocoap_get_blockwise_url(manifest->urlbuf, CONFIG_SUIT_COAP_BLOCKSIZE,
                                          _storage_helper,
                                          manifest);
+#endif
     }
 #endif
 #ifdef MODULE_SUIT_TRANSPORT_MOCK
@@ -505,7 +773,11 @@ static int _validate_payload(suit_component_t *component, const uint8_t *digest,
     uint8_t payload_digest[SHA256_DIGEST_LENGTH];
     suit_storage_t *storage = component->storage_backend;
 
-    if (suit_storage_has_readptr(storage)) {
+    if (suit_storage_has_digest(storage) &&
+        suit_storage_get_digest(storage, payload_digest, payload_size) == SUIT_OK) {
+        LOG_DEBUG("Using the digest computed while writing\n");
+    }
+    else if (suit_storage_has_readptr(storage)) {
         /* Direct read possible */
         const uint8_t *payload = NULL;
         size_t payload_len = 0;
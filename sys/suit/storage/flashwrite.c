@@ -155,6 +155,17 @@ static int _flashwrite_read(suit_storage_t *storage, uint8_t *buf,
     return 0;
 }
 
+static int _flashwrite_get_digest(suit_storage_t *storage, uint8_t *digest,
+                                  size_t len)
+{
+    suit_storage_flashwrite_t *fw = _get_fw(storage);
+
+    if (riotboot_flashwrite_digest_sha256(&fw->writer, digest) != len) {
+        return SUIT_ERR_STORAGE;
+    }
+    return SUIT_OK;
+}
+
 static bool _flashwrite_has_location(const suit_storage_t *storage,
                                      const char *location)
 {
@@ -229,6 +240,7 @@ static const suit_storage_driver_t suit_storage_flashwrite_driver = {
     .write = _flashwrite_write,
     .finish = _flashwrite_finish,
     .read = _flashwrite_read,
+    .get_digest = _flashwrite_get_digest,
     .install = _flashwrite_install,
     .has_location = _flashwrite_has_location,
     .set_active_location = _flashwrite_set_active_location,
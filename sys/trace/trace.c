@@ -20,10 +20,18 @@
  * @}
  */
 
+#include <assert.h>
+#include <stdbool.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "architecture.h"
+#include "byteorder.h"
 #include "irq.h"
+#include "sched.h"
+#include "stdio_base.h"
+#include "thread.h"
+#include "trace.h"
 #include "ztimer.h"
 
 #ifndef CONFIG_TRACE_BUFSIZE
@@ -35,10 +43,13 @@ typedef struct {
     uint32_t val;
 } tracebuf_entry_t;
 
+#define TRACE_EVENT_SHIFT   (24U)
+#define TRACE_ARG_MASK      ((1UL << TRACE_EVENT_SHIFT) - 1)
+
 static tracebuf_entry_t tracebuf[CONFIG_TRACE_BUFSIZE];
 static size_t tracebuf_pos;
 
-void trace(uint32_t val)
+static void _add(uint32_t val)
 {
     unsigned state = irq_disable();
 
@@ -48,17 +59,38 @@ void trace(uint32_t val)
     irq_restore(state);
 }
 
+void trace(uint32_t val)
+{
+    if (IS_USED(MODULE_TRACE_EVENTS)) {
+        val &= TRACE_ARG_MASK;
+    }
+    _add(val);
+}
+
+/* index of the oldest entry and number of valid entries */
+static size_t _range(size_t *n)
+{
+    if (tracebuf_pos > CONFIG_TRACE_BUFSIZE) {
+        *n = CONFIG_TRACE_BUFSIZE;
+        return tracebuf_pos % CONFIG_TRACE_BUFSIZE;
+    }
+    *n = tracebuf_pos;
+    return 0;
+}
+
 void trace_dump(void)
 {
-    size_t n = tracebuf_pos >
-               CONFIG_TRACE_BUFSIZE ? CONFIG_TRACE_BUFSIZE : tracebuf_pos;
+    size_t n;
+    size_t start = _range(&n);
     uint32_t t_last = 0;
 
     for (size_t i = 0; i < n; i++) {
+        const tracebuf_entry_t *e = &tracebuf[(start + i) % CONFIG_TRACE_BUFSIZE];
+
         printf("n=%4" PRIuSIZE " t=%s%8" PRIu32 " v=0x%08" PRIx32 "\n", i,
                i ? "+" : " ",
-               tracebuf[i].time - t_last, tracebuf[i].val);
-        t_last = tracebuf[i].time;
+               e->time - t_last, e->val);
+        t_last = e->time;
     }
 }
 
@@ -69,3 +101,87 @@ void trace_reset(void)
     tracebuf_pos = 0;
     irq_restore(state);
 }
+
+#if IS_USED(MODULE_TRACE_EVENTS)
+static_assert(CONFIG_TRACE_BUFSIZE <= UINT16_MAX,
+              "CONFIG_TRACE_BUFSIZE too large for the binary dump format");
+static_assert(TRACE_EVENT_NUMOF <= UINT8_MAX, "too many trace event types");
+
+/* the scheduler emits events before ztimer is initialized */
+static bool trace_ready;
+
+void auto_init_trace_events(void)
+{
+    /* keep the clock running, every event reads it */
+    ztimer_acquire(ZTIMER_USEC);
+    trace_ready = true;
+}
+
+void trace_event(trace_event_t type, uint32_t arg)
+{
+    if (!trace_ready) {
+        return;
+    }
+    _add(((uint32_t)type << TRACE_EVENT_SHIFT) | (arg & TRACE_ARG_MASK));
+}
+
+static const char *_name(kernel_pid_t pid)
+{
+    return thread_get(pid) ? thread_getname(pid) : NULL;
+}
+
+static void _write_thread_names(void)
+{
+    uint8_t numof = 0;
+
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        if (_name(pid)) {
+            numof++;
+        }
+    }
+    stdio_write(&numof, sizeof(numof));
+
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        const char *name = _name(pid);
+
+        if (name) {
+            uint8_t hdr[2] = { pid, strnlen(name, UINT8_MAX) };
+
+            stdio_write(hdr, sizeof(hdr));
+            stdio_write(name, hdr[1]);
+        }
+    }
+}
+
+void trace_dump_bin(void)
+{
+    /* stop recording, writing to stdio would add events of its own */
+    bool ready = trace_ready;
+    trace_ready = false;
+
+    size_t n;
+    size_t start = _range(&n);
+    uint8_t hdr[8] = { 0 };
+
+    memcpy(hdr, TRACE_BIN_MAGIC, 4);
+    hdr[4] = TRACE_BIN_VERSION;
+    hdr[5] = sizeof(tracebuf_entry_t);
+    hdr[6] = n & 0xff;
+    hdr[7] = n >> 8;
+    stdio_write(hdr, sizeof(hdr));
+
+    for (size_t i = 0; i < n; i++) {
+        const tracebuf_entry_t *e = &tracebuf[(start + i) % CONFIG_TRACE_BUFSIZE];
+        le_uint32_t rec[2] = {
+            byteorder_htoll(e->time),
+            byteorder_htoll(e->val),
+        };
+
+        stdio_write(rec, sizeof(rec));
+    }
+
+    _write_thread_names();
+
+    trace_ready = ready;
+}
+#endif
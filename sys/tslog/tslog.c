@@ -0,0 +1,480 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_tslog
+ * @{
+ *
+ * @file
+ * @brief       Time-series ring log implementation
+ *
+ * Sector layout (little endian):
+ *
+ *     0       4       8       12      14      16
+ *     | magic | seq   | ts0   | crc   | 0xffff| records...
+ *
+ * Record layout, padded with 0xff to the write size of the device:
+ *
+ *     0       2       4       8
+ *     | len   | crc   | ts    | payload...
+ *
+ * The record CRC covers the length, the timestamp and the payload. An erased
+ * record header ends the records of a sector.
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "checksum/crc16_ccitt.h"
+#include "macros/utils.h"
+#include "tslog.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define SECTOR_MAGIC    (0x474c5354UL)  /* "TSLG" */
+#define LEN_ERASED      (0xffffU)
+
+static uint32_t _sector_size(const tslog_t *log)
+{
+    return log->mtd->pages_per_sector * log->mtd->page_size;
+}
+
+static uint32_t _align(const tslog_t *log, uint32_t size)
+{
+    uint32_t ws = log->mtd->write_size;
+
+    return ((size + ws - 1) / ws) * ws;
+}
+
+static int _read(tslog_t *log, uint32_t sector, uint32_t pos, void *dst, size_t len)
+{
+    uint32_t page = (log->sector_first + sector) * log->mtd->pages_per_sector
+                  + pos / log->mtd->page_size;
+
+    return mtd_read_page(log->mtd, dst, page, pos % log->mtd->page_size, len);
+}
+
+static int _write(tslog_t *log, uint32_t sector, uint32_t pos, const void *src, size_t len)
+{
+    uint32_t page = (log->sector_first + sector) * log->mtd->pages_per_sector
+                  + pos / log->mtd->page_size;
+
+    return mtd_write_page_raw(log->mtd, src, page, pos % log->mtd->page_size, len);
+}
+
+static uint32_t _head_seq(const tslog_t *log)
+{
+    return log->tail_seq - (log->tail + log->sector_count - log->head) % log->sector_count;
+}
+
+static uint32_t _sector_of(const tslog_t *log, uint32_t seq)
+{
+    return (log->head + (seq - _head_seq(log))) % log->sector_count;
+}
+
+static uint16_t _record_crc(const uint8_t *rec, size_t len)
+{
+    /* length and timestamp, then the payload */
+    uint16_t crc = crc16_ccitt_false_calc(rec, 2);
+    return crc16_ccitt_false_update(crc, rec + 4, 4 + len);
+}
+
+/* reads the header of a sector, returns -ENOENT if it is not in use */
+static int _read_sector_hdr(tslog_t *log, uint32_t sector, uint32_t *seq, uint32_t *ts)
+{
+    uint8_t hdr[TSLOG_SECTOR_HDR_SIZE];
+    int res = _read(log, sector, 0, hdr, sizeof(hdr));
+
+    if (res < 0) {
+        return res;
+    }
+    if (byteorder_lebuftohl(hdr) != SECTOR_MAGIC ||
+        byteorder_lebuftohs(&hdr[12]) != crc16_ccitt_false_calc(hdr, 12)) {
+        return -ENOENT;
+    }
+    *seq = byteorder_lebuftohl(&hdr[4]);
+    if (ts) {
+        *ts = byteorder_lebuftohl(&hdr[8]);
+    }
+    return 0;
+}
+
+static bool _is_erased(const uint8_t *buf, size_t len)
+{
+    while (len--) {
+        if (*buf++ != 0xff) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* reads the record at pos of a sector into the buffer, returns its payload
+ * size, -ENOENT if the sector ends there or -EBADMSG if it is corrupt */
+static int _read_record(tslog_t *log, uint32_t sector, uint32_t pos)
+{
+    uint32_t size = _sector_size(log);
+
+    if (pos + TSLOG_RECORD_HDR_SIZE > size) {
+        return -ENOENT;
+    }
+
+    int res = _read(log, sector, pos, log->buf, TSLOG_RECORD_HDR_SIZE);
+    if (res < 0) {
+        return res;
+    }
+
+    uint16_t len = byteorder_lebuftohs(log->buf);
+    if (len == LEN_ERASED) {
+        return _is_erased(log->buf, TSLOG_RECORD_HDR_SIZE) ? -ENOENT : -EBADMSG;
+    }
+    if (len > CONFIG_TSLOG_RECORD_MAX ||
+        pos + _align(log, TSLOG_RECORD_HDR_SIZE + len) > size) {
+        return -EBADMSG;
+    }
+
+    res = _read(log, sector, pos + TSLOG_RECORD_HDR_SIZE,
+                &log->buf[TSLOG_RECORD_HDR_SIZE], len);
+    if (res < 0) {
+        return res;
+    }
+    if (byteorder_lebuftohs(&log->buf[2]) != _record_crc(log->buf, len)) {
+        return -EBADMSG;
+    }
+    return len;
+}
+
+/* finds the end of the records in the tail sector */
+static int _scan_tail(tslog_t *log)
+{
+    uint32_t pos = TSLOG_SECTOR_HDR_SIZE;
+    int res;
+
+    while ((res = _read_record(log, log->tail, pos)) >= 0) {
+        log->last_ts = byteorder_lebuftohl(&log->buf[4]);
+        pos += _align(log, TSLOG_RECORD_HDR_SIZE + res);
+    }
+    if (res == -EBADMSG) {
+        /* torn write, do not append to this sector anymore */
+        DEBUG("tslog: corrupt record in sector %" PRIu32 " at %" PRIu32 "\n",
+              log->tail, pos);
+        pos = _sector_size(log);
+    }
+    else if (res != -ENOENT) {
+        return res;
+    }
+
+    log->write_pos = pos;
+    return 0;
+}
+
+int tslog_init(tslog_t *log, mtd_dev_t *mtd, uint32_t sector_first,
+               uint32_t sector_count)
+{
+    int res = mtd_init(mtd);
+    if (res < 0) {
+        return res;
+    }
+
+    if (sector_count < 2 || sector_first + sector_count > mtd->sector_count) {
+        return -EINVAL;
+    }
+    if (16 % mtd->write_size) {
+        return -ENOTSUP;
+    }
+
+    memset(log, 0, sizeof(*log));
+    log->mtd = mtd;
+    log->sector_first = sector_first;
+    log->sector_count = sector_count;
+    log->erased = UINT32_MAX;
+    log->empty = true;
+    mutex_init(&log->lock);
+
+    /* the tail is the sector with the highest sequence number */
+    for (uint32_t sector = 0; sector < sector_count; sector++) {
+        uint32_t seq, ts;
+
+        res = _read_sector_hdr(log, sector, &seq, &ts);
+        if (res == -ENOENT) {
+            continue;
+        }
+        if (res < 0) {
+            return res;
+        }
+        if (log->empty || (int32_t)(seq - log->tail_seq) > 0) {
+            log->tail = sector;
+            log->tail_seq = seq;
+            log->last_ts = ts;
+            log->empty = false;
+        }
+    }
+    if (log->empty) {
+        return 0;
+    }
+
+    /* the log extends back from the tail as long as the sequence continues */
+    log->head = log->tail;
+    for (uint32_t i = 1; i < sector_count; i++) {
+        uint32_t sector = (log->tail + sector_count - i) % sector_count;
+        uint32_t seq;
+
+        if (_read_sector_hdr(log, sector, &seq, NULL) || seq != log->tail_seq - i) {
+            break;
+        }
+        log->head = sector;
+    }
+
+    DEBUG("tslog: sectors %" PRIu32 "..%" PRIu32 ", seq %" PRIu32 "\n",
+          log->head, log->tail, log->tail_seq);
+    return _scan_tail(log);
+}
+
+int tslog_format(tslog_t *log)
+{
+    mutex_lock(&log->lock);
+
+    int res = mtd_erase_sector(log->mtd, log->sector_first, log->sector_count);
+    log->empty = true;
+    log->tail_seq = 0;
+    log->erased = (res == 0) ? 0 : UINT32_MAX;
+
+    mutex_unlock(&log->lock);
+    return res;
+}
+
+/* the sector the log continues in */
+static uint32_t _next_sector(const tslog_t *log)
+{
+    if (log->empty) {
+        return (log->erased != UINT32_MAX) ? log->erased : 0;
+    }
+    return (log->tail + 1) % log->sector_count;
+}
+
+static int _erase_next(tslog_t *log)
+{
+    uint32_t next = _next_sector(log);
+
+    if (log->erased == next) {
+        return 0;
+    }
+    if (!log->empty && next == log->head) {
+        /* the log is full, drop the oldest sector */
+        log->head = (log->head + 1) % log->sector_count;
+    }
+
+    int res = mtd_erase_sector(log->mtd, log->sector_first + next, 1);
+    if (res == 0) {
+        log->erased = next;
+    }
+    return res;
+}
+
+static int _open_sector(tslog_t *log, uint32_t timestamp)
+{
+    uint8_t hdr[TSLOG_SECTOR_HDR_SIZE];
+    uint32_t seq = log->empty ? log->tail_seq : log->tail_seq + 1;
+
+    int res = _erase_next(log);
+    if (res < 0) {
+        return res;
+    }
+
+    byteorder_htolebufl(hdr, SECTOR_MAGIC);
+    byteorder_htolebufl(&hdr[4], seq);
+    byteorder_htolebufl(&hdr[8], timestamp);
+    byteorder_htolebufs(&hdr[12], crc16_ccitt_false_calc(hdr, 12));
+    byteorder_htolebufs(&hdr[14], 0xffff);
+
+    uint32_t next = log->erased;
+    log->erased = UINT32_MAX;
+    if ((res = _write(log, next, 0, hdr, sizeof(hdr))) < 0) {
+        return res;
+    }
+
+    if (log->empty) {
+        log->head = next;
+        log->empty = false;
+    }
+    log->tail = next;
+    log->tail_seq = seq;
+    log->write_pos = TSLOG_SECTOR_HDR_SIZE;
+    return 0;
+}
+
+int tslog_append(tslog_t *log, uint32_t timestamp, const void *data, size_t len)
+{
+    if (len > CONFIG_TSLOG_RECORD_MAX) {
+        return -EMSGSIZE;
+    }
+
+    int res = 0;
+    uint32_t size = _align(log, TSLOG_RECORD_HDR_SIZE + len);
+
+    mutex_lock(&log->lock);
+
+    if (!log->empty && timestamp < log->last_ts) {
+        res = -EINVAL;
+        goto out;
+    }
+    if (log->empty || log->write_pos + size > _sector_size(log)) {
+        if ((res = _open_sector(log, timestamp)) < 0) {
+            goto out;
+        }
+    }
+
+    byteorder_htolebufs(log->buf, len);
+    byteorder_htolebufl(&log->buf[4], timestamp);
+    memcpy(&log->buf[TSLOG_RECORD_HDR_SIZE], data, len);
+    memset(&log->buf[TSLOG_RECORD_HDR_SIZE + len], 0xff, size - TSLOG_RECORD_HDR_SIZE - len);
+    byteorder_htolebufs(&log->buf[2], _record_crc(log->buf, len));
+
+    if ((res = _write(log, log->tail, log->write_pos, log->buf, size)) == 0) {
+        log->write_pos += size;
+        log->last_ts = timestamp;
+    }
+
+out:
+    mutex_unlock(&log->lock);
+    return res;
+}
+
+int tslog_erase_ahead(tslog_t *log)
+{
+    mutex_lock(&log->lock);
+    int res = _erase_next(log);
+    mutex_unlock(&log->lock);
+
+    return res;
+}
+
+void tslog_iter_init(tslog_t *log, tslog_iter_t *it)
+{
+    mutex_lock(&log->lock);
+    it->seq = log->empty ? log->tail_seq : _head_seq(log);
+    it->pos = TSLOG_SECTOR_HDR_SIZE;
+    mutex_unlock(&log->lock);
+}
+
+/* reads the record the iterator points to into the buffer without advancing,
+ * skipping to the next sector where needed */
+static int _iter_record(tslog_t *log, tslog_iter_t *it)
+{
+    if (log->empty || (int32_t)(it->seq - log->tail_seq) > 0) {
+        return -ENOENT;
+    }
+    if ((int32_t)(it->seq - _head_seq(log)) < 0) {
+        it->seq = _head_seq(log);
+        it->pos = TSLOG_SECTOR_HDR_SIZE;
+        return -ESTALE;
+    }
+
+    while (1) {
+        if (it->seq == log->tail_seq && it->pos >= log->write_pos) {
+            return -ENOENT;
+        }
+
+        int res = _read_record(log, _sector_of(log, it->seq), it->pos);
+        if (res >= 0 || (res != -ENOENT && res != -EBADMSG)) {
+            return res;
+        }
+        if (it->seq == log->tail_seq) {
+            return -ENOENT;
+        }
+        /* end of the sector, or a record torn by a power loss */
+        it->seq++;
+        it->pos = TSLOG_SECTOR_HDR_SIZE;
+    }
+}
+
+/* binary search for the last sector starting before timestamp, records with
+ * an equal timestamp may have started in the sector before */
+static int _seek_sector(tslog_t *log, tslog_iter_t *it, uint32_t timestamp)
+{
+    uint32_t lo = 1;
+    uint32_t hi = log->tail_seq - it->seq;
+    uint32_t found = 0;
+
+    while (lo <= hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        uint32_t seq, ts;
+
+        int res = _read_sector_hdr(log, _sector_of(log, it->seq + mid), &seq, &ts);
+        if (res < 0) {
+            return res;
+        }
+        if (ts < timestamp) {
+            found = mid;
+            lo = mid + 1;
+        }
+        else {
+            hi = mid - 1;
+        }
+    }
+
+    it->seq += found;
+    return 0;
+}
+
+int tslog_seek(tslog_t *log, tslog_iter_t *it, uint32_t timestamp)
+{
+    int res = 0;
+
+    mutex_lock(&log->lock);
+
+    it->seq = log->empty ? log->tail_seq : _head_seq(log);
+    it->pos = TSLOG_SECTOR_HDR_SIZE;
+    if (log->empty || (res = _seek_sector(log, it, timestamp)) < 0) {
+        goto out;
+    }
+
+    /* then scan the sector */
+    while ((res = _iter_record(log, it)) >= 0) {
+        if (byteorder_lebuftohl(&log->buf[4]) >= timestamp) {
+            res = 0;
+            break;
+        }
+        it->pos += _align(log, TSLOG_RECORD_HDR_SIZE + res);
+    }
+    if (res == -ENOENT) {
+        /* all records are older */
+        it->seq = log->tail_seq;
+        it->pos = log->write_pos;
+        res = 0;
+    }
+
+out:
+    mutex_unlock(&log->lock);
+    return res;
+}
+
+ssize_t tslog_read(tslog_t *log, tslog_iter_t *it, uint32_t *timestamp,
+                   void *buf, size_t len)
+{
+    mutex_lock(&log->lock);
+
+    int res = _iter_record(log, it);
+    if (res >= 0) {
+        if (timestamp) {
+            *timestamp = byteorder_lebuftohl(&log->buf[4]);
+        }
+        memcpy(buf, &log->buf[TSLOG_RECORD_HDR_SIZE], MIN(len, (size_t)res));
+        it->pos += _align(log, TSLOG_RECORD_HDR_SIZE + res);
+    }
+
+    mutex_unlock(&log->lock);
+    return res;
+}
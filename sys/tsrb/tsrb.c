@@ -17,6 +17,8 @@
  * @}
  */
 
+#include <string.h>
+
 #include "irq.h"
 #include "tsrb.h"
 
@@ -35,6 +37,32 @@ static uint8_t _peek(tsrb_t *rb, unsigned int idx)
     return rb->buf[(rb->reads + idx) & (rb->size - 1)];
 }
 
+/* copy n bytes starting at position pos (a read or write counter) out of the
+ * buffer, wrapping around at most once */
+static void _copy_out(const tsrb_t *rb, uint8_t *dst, unsigned pos, size_t n)
+{
+    unsigned idx = pos & (rb->size - 1);
+    size_t first = rb->size - idx;
+
+    if (first > n) {
+        first = n;
+    }
+    memcpy(dst, &rb->buf[idx], first);
+    memcpy(dst + first, rb->buf, n - first);
+}
+
+static void _copy_in(tsrb_t *rb, unsigned pos, const uint8_t *src, size_t n)
+{
+    unsigned idx = pos & (rb->size - 1);
+    size_t first = rb->size - idx;
+
+    if (first > n) {
+        first = n;
+    }
+    memcpy(&rb->buf[idx], src, first);
+    memcpy(rb->buf, src + first, n - first);
+}
+
 int tsrb_get_one(tsrb_t *rb)
 {
     int retval = -1;
@@ -59,38 +87,39 @@ int tsrb_peek_one(tsrb_t *rb)
 
 int tsrb_get(tsrb_t *rb, uint8_t *dst, size_t n)
 {
-    size_t tmp = n;
     unsigned irq_state = irq_disable();
-    while (tmp && !tsrb_empty(rb)) {
-        *dst++ = _pop(rb);
-        tmp--;
+    size_t avail = rb->writes - rb->reads;
+    if (n > avail) {
+        n = avail;
     }
+    _copy_out(rb, dst, rb->reads, n);
+    rb->reads += n;
     irq_restore(irq_state);
-    return (n - tmp);
+    return n;
 }
 
 int tsrb_peek(tsrb_t *rb, uint8_t *dst, size_t n)
 {
-    size_t idx = 0;
     unsigned irq_state = irq_disable();
-    unsigned int avail = tsrb_avail(rb);
-    while (idx < n && idx != avail) {
-        *dst++ = _peek(rb, idx++);
+    size_t avail = rb->writes - rb->reads;
+    if (n > avail) {
+        n = avail;
     }
+    _copy_out(rb, dst, rb->reads, n);
     irq_restore(irq_state);
-    return idx;
+    return n;
 }
 
 int tsrb_drop(tsrb_t *rb, size_t n)
 {
-    size_t tmp = n;
     unsigned irq_state = irq_disable();
-    while (tmp && !tsrb_empty(rb)) {
-        _pop(rb);
-        tmp--;
+    size_t avail = rb->writes - rb->reads;
+    if (n > avail) {
+        n = avail;
     }
+    rb->reads += n;
     irq_restore(irq_state);
-    return (n - tmp);
+    return n;
 }
 
 int tsrb_add_one(tsrb_t *rb, uint8_t c)
@@ -107,12 +136,43 @@ int tsrb_add_one(tsrb_t *rb, uint8_t c)
 
 int tsrb_add(tsrb_t *rb, const uint8_t *src, size_t n)
 {
-    size_t tmp = n;
     unsigned irq_state = irq_disable();
-    while (tmp && !tsrb_full(rb)) {
-        _push(rb, *src++);
-        tmp--;
+    size_t free = rb->size - (rb->writes - rb->reads);
+    if (n > free) {
+        n = free;
     }
+    _copy_in(rb, rb->writes, src, n);
+    rb->writes += n;
+    irq_restore(irq_state);
+    return n;
+}
+
+size_t tsrb_peek_linear(tsrb_t *rb, uint8_t **data)
+{
+    unsigned irq_state = irq_disable();
+    size_t avail = rb->writes - rb->reads;
+    unsigned idx = rb->reads & (rb->size - 1);
+    irq_restore(irq_state);
+
+    *data = &rb->buf[idx];
+    return (avail < rb->size - idx) ? avail : rb->size - idx;
+}
+
+size_t tsrb_reserve_linear(tsrb_t *rb, uint8_t **data)
+{
+    unsigned irq_state = irq_disable();
+    size_t free = rb->size - (rb->writes - rb->reads);
+    unsigned idx = rb->writes & (rb->size - 1);
+    irq_restore(irq_state);
+
+    *data = &rb->buf[idx];
+    return (free < rb->size - idx) ? free : rb->size - idx;
+}
+
+void tsrb_commit(tsrb_t *rb, size_t n)
+{
+    unsigned irq_state = irq_disable();
+    assert(n <= rb->size - (rb->writes - rb->reads));
+    rb->writes += n;
     irq_restore(irq_state);
-    return (n - tmp);
 }
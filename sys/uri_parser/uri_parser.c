@@ -20,6 +20,7 @@
 
 #include <assert.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "fmt.h"
 
@@ -30,15 +31,14 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
-/* strchr for non-Null-terminated strings (buffers) */
+/* strchr for non-Null-terminated strings (buffers), memchr() of the C
+ * library compares a word at a time instead of each byte on its own */
 static const char *_strchrb(const char *start, const char *stop, char c)
 {
-    for (; start < stop; start++) {
-        if (*start == c) {
-            return start;
-        }
+    if (start >= stop) {
+        return NULL;
     }
-    return NULL;
+    return memchr(start, c, stop - start);
 }
 
 static const char *_consume_scheme(uri_parser_result_t *result, const char *uri,
@@ -21,6 +21,7 @@
 #include <assert.h>
 #include <string.h>
 
+#include "macros/utils.h"
 #include "tsrb.h"
 #include "usb/descriptor.h"
 #include "usb/cdc.h"
@@ -240,6 +241,16 @@ static void _init(usbus_t *usbus, usbus_handler_t *handler)
     ep->interval = 0; /* Interval is not used with bulk endpoints */
     assert(ep);
     usbus_enable_endpoint(ep);
+    /* Send multiple packets per transfer if the peripheral supports it */
+    size_t max_xfer;
+    if ((usbdev_ep_get(ep->ep, USBOPT_EP_MAX_XFER_SIZE, &max_xfer,
+                       sizeof(max_xfer)) == sizeof(max_xfer)) &&
+        (max_xfer > CONFIG_USBUS_CDC_ACM_BULK_EP_SIZE)) {
+        cdcacm->in_max = MIN(max_xfer, sizeof(cdcacm->in_buf));
+    }
+    else {
+        cdcacm->in_max = CONFIG_USBUS_CDC_ACM_BULK_EP_SIZE;
+    }
     /* Store the endpoint reference to activate it
      * when DTE present is signalled by the host */
     ep = usbus_add_endpoint(usbus, &cdcacm->iface_data,
@@ -339,15 +350,11 @@ static void _handle_in(usbus_cdcacm_device_t *cdcacm,
         (cdcacm->state != USBUS_CDC_ACM_LINE_STATE_DTE)) {
         return;
     }
-    /* copy at most CONFIG_USBUS_CDC_ACM_BULK_EP_SIZE chars from input into ep->buf */
+    /* copy as much as fits into a single transfer from input into in_buf */
     unsigned old = irq_disable();
-    while (!tsrb_empty(&cdcacm->tsrb)) {
-        int c = tsrb_get_one(&cdcacm->tsrb);
-        cdcacm->in_buf[cdcacm->occupied++] = (uint8_t)c;
-        if (cdcacm->occupied >= CONFIG_USBUS_CDC_ACM_BULK_EP_SIZE) {
-            break;
-        }
-    }
+    cdcacm->occupied += tsrb_get(&cdcacm->tsrb,
+                                 &cdcacm->in_buf[cdcacm->occupied],
+                                 cdcacm->in_max - cdcacm->occupied);
     irq_restore(old);
     usbdev_ep_xmit(ep, cdcacm->in_buf, cdcacm->occupied);
 }
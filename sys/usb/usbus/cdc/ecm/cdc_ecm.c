@@ -21,6 +21,7 @@
 #include "fmt.h"
 #include "kernel_defines.h"
 #include "luid.h"
+#include "macros/utils.h"
 #include "net/ethernet.h"
 #include "net/eui48.h"
 #include "usb/cdc.h"
@@ -281,12 +282,31 @@ static int _control_handler(usbus_t *usbus, usbus_handler_t *handler,
     return 1;
 }
 
-static int _handle_in_complete(usbus_t *usbus, usbus_handler_t *handler)
+static void _xmit_next(usbus_cdcecm_device_t *cdcecm)
 {
-    (void)usbus;
-    usbus_cdcecm_device_t *cdcecm = (usbus_cdcecm_device_t *)handler;
+    size_t len = MIN(cdcecm->tx_len - cdcecm->tx_offset, cdcecm->tx_max);
+
+    usbdev_ep_xmit(cdcecm->ep_in->ep, &cdcecm->data_in[cdcecm->tx_offset], len);
+    cdcecm->tx_offset += len;
+}
+
+static void _handle_in_complete(usbus_cdcecm_device_t *cdcecm)
+{
+    if (cdcecm->tx_offset < cdcecm->tx_len) {
+        _xmit_next(cdcecm);
+        return;
+    }
+    if (cdcecm->tx_len &&
+        ((cdcecm->tx_len % cdcecm->ep_in->maxpacketsize) == 0)) {
+        DEBUG("CDC ECM: Zero length USB packet required\n");
+        cdcecm->tx_len = 0;
+        cdcecm->tx_offset = 0;
+        usbdev_ep_xmit(cdcecm->ep_in->ep, cdcecm->data_in, 0);
+        return;
+    }
+    /* frame sent, ready for the next one */
+    cdcecm->tx_len = 0;
     mutex_unlock(&cdcecm->out_lock);
-    return 0;
 }
 
 static void _handle_tx_xmit(event_t *ev)
@@ -299,10 +319,14 @@ static void _handle_tx_xmit(event_t *ev)
     DEBUG("CDC_ECM: Handling TX xmit from netdev\n");
     if (usbus->state != USBUS_STATE_CONFIGURED || cdcecm->active_iface == 0) {
         DEBUG("CDC ECM: not configured, unlocking\n");
+        cdcecm->tx_len = 0;
         mutex_unlock(&cdcecm->out_lock);
+        return;
     }
-    /* Data prepared by netdev_send, signal ready to usbus */
-    usbdev_ep_xmit(cdcecm->ep_in->ep, cdcecm->data_in, cdcecm->tx_len);
+    /* Frame prepared by netdev_send, send as much of it as the peripheral
+     * takes per transfer */
+    cdcecm->tx_offset = 0;
+    _xmit_next(cdcecm);
 }
 
 static void _handle_rx_flush_ev(event_t *ev)
@@ -324,7 +348,7 @@ static void _transfer_handler(usbus_t *usbus, usbus_handler_t *handler,
         netdev_trigger_event_isr(&cdcecm->netdev);
     }
     else if (ep == cdcecm->ep_in->ep) {
-        _handle_in_complete(usbus, handler);
+        _handle_in_complete(cdcecm);
     }
     else if (ep == cdcecm->ep_ctrl->ep &&
              cdcecm->notif == USBUS_CDCECM_NOTIF_LINK_UP) {
@@ -341,9 +365,22 @@ static void _handle_reset(usbus_t *usbus, usbus_handler_t *handler)
     size_t maxpacketsize = usbus_max_bulk_endpoint_size(usbus);
     cdcecm->ep_in->maxpacketsize = maxpacketsize;
     cdcecm->ep_out->maxpacketsize = maxpacketsize;
+    /* Send multiple packets of a frame per transfer if the peripheral
+     * supports it */
+    size_t max_xfer;
+    if ((usbdev_ep_get(cdcecm->ep_in->ep, USBOPT_EP_MAX_XFER_SIZE, &max_xfer,
+                       sizeof(max_xfer)) == sizeof(max_xfer)) &&
+        (max_xfer > maxpacketsize)) {
+        cdcecm->tx_max = max_xfer - (max_xfer % maxpacketsize);
+    }
+    else {
+        cdcecm->tx_max = maxpacketsize;
+    }
 
     DEBUG("CDC ECM: Reset\n");
-    _handle_in_complete(usbus, handler);
+    /* Drop the frame being sent */
+    cdcecm->tx_len = 0;
+    cdcecm->tx_offset = 0;
     cdcecm->notif = USBUS_CDCECM_NOTIF_NONE;
     cdcecm->active_iface = 0;
     mutex_unlock(&cdcecm->out_lock);
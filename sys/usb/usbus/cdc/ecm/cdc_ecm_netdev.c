@@ -20,6 +20,7 @@
 #include <assert.h>
 #include <string.h>
 
+#include "architecture.h"
 #include "kernel_defines.h"
 #include "iolist.h"
 #include "mutex.h"
@@ -59,71 +60,23 @@ static int _send(netdev_t *netdev, const iolist_t *iolist)
 {
     assert(iolist);
     usbus_cdcecm_device_t *cdcecm = _netdev_to_cdcecm(netdev);
-    uint8_t *buf = cdcecm->data_in;
-    const iolist_t *iolist_start = iolist;
-    size_t len = iolist_size(iolist);
     /* interface with alternative function ID 1 is the interface containing the
      * data endpoints, no sense trying to transmit data if it is not active */
     if (cdcecm->active_iface != 1) {
         return -ENOTCONN;
     }
-    DEBUG("CDC_ECM_netdev: sending %u bytes\n", len);
-    /* load packet data into FIFO */
-    size_t iol_offset = 0;
-    size_t usb_offset = 0;
-    size_t usb_remain = cdcecm->ep_in->maxpacketsize;
-    DEBUG("CDC_ECM_netdev: cur iol: %d\n", iolist->iol_len);
-    while (len) {
-        mutex_lock(&cdcecm->out_lock);
-        if (iolist->iol_len - iol_offset > usb_remain) {
-            /* Only part of the iolist can be copied, usb_remain bytes */
-            memcpy(buf + usb_offset, (uint8_t *)iolist->iol_base + iol_offset,
-                   usb_remain);
-
-            usb_offset =  cdcecm->ep_in->maxpacketsize;
-            len -= usb_remain;
-            iol_offset += usb_remain;
-            usb_remain = 0;
-        }
-        else {
-            size_t bytes_copied = iolist->iol_len - iol_offset;
-            /* Full iolist can be copied */
-            memcpy(buf + usb_offset, (uint8_t *)iolist->iol_base + iol_offset,
-                   bytes_copied);
-            len -= bytes_copied;
-            usb_offset += bytes_copied;
-            usb_remain -= bytes_copied;
-            iol_offset = iolist->iol_len;
-        }
-        if (iol_offset == iolist->iol_len) {
-            /* Current iolist exhausted */
-            iolist = iolist->iol_next;
-            if (iolist) {
-                DEBUG("CDC_ECM: cur iol: %d\n", iolist->iol_len);
-            }
-            iol_offset = 0;
-        }
-        if (usb_remain == 0 || !len) {
-            cdcecm->tx_len = usb_offset;
-            /* USB frame full or last frame, flush! */
-
-            DEBUG("CDC_ECM_NETDEV: triggering xmit with len %d\n",
-                  cdcecm->tx_len);
-            _signal_tx_xmit(cdcecm);
-            usb_remain = cdcecm->ep_in->maxpacketsize;
-            usb_offset = 0;
-        }
-        else {
-            mutex_unlock(&cdcecm->out_lock);
-        }
-    }
-    /* Zero length USB packet required */
-    if ((iolist_size(iolist_start) % cdcecm->ep_in->maxpacketsize) == 0) {
-        mutex_lock(&cdcecm->out_lock);
-        DEBUG("CDC ECM netdev: Zero length USB packet required\n");
-        cdcecm->tx_len = 0;
-        _signal_tx_xmit(cdcecm);
+    /* wait for the previous frame to be sent */
+    mutex_lock(&cdcecm->out_lock);
+    ssize_t len = iolist_to_buffer(iolist, cdcecm->data_in,
+                                   sizeof(cdcecm->data_in));
+    if (len < 0) {
+        mutex_unlock(&cdcecm->out_lock);
+        return len;
     }
+    DEBUG("CDC_ECM_netdev: sending %" PRIdSIZE " bytes\n", len);
+    /* USBUS sends the whole frame and unlocks out_lock when done */
+    cdcecm->tx_len = len;
+    _signal_tx_xmit(cdcecm);
     return len;
 }
 
@@ -22,6 +22,7 @@
 #include "usb/usbus/msc.h"
 #include "usb/usbus/msc/scsi.h"
 #include "board.h"
+#include "macros/utils.h"
 
 #include <string.h>
 #include <errno.h>
@@ -63,14 +64,35 @@ static const usbus_descr_gen_funcs_t _msc_descriptor = {
     .len_type = USBUS_DESCR_LEN_FIXED,
 };
 
+static void _write_block(usbus_msc_device_t *msc, mtd_dev_t *mtd,
+                         const uint8_t *buf, uint32_t page, uint32_t len)
+{
+    int ret = mtd_write_page(mtd, buf, page, 0, len);
+
+    if (ret != 0) {
+        /* Failure occurs during write operation, stall the operation */
+        DEBUG("[msc]: Write fail with error: %d\n", ret);
+        /* Stall IN bulk endpoint and signal error to host through
+         * CSW command with command failed status */
+        static const usbopt_enable_t enable = USBOPT_ENABLE;
+        usbdev_ep_set(msc->ep_in->ep, USBOPT_EP_STALL, &enable,
+                      sizeof(usbopt_enable_t));
+        msc->state = GEN_CSW;
+        msc->cmd.status = USB_MSC_CSW_STATUS_COMMAND_FAILED;
+    }
+}
+
 static void _write_xfer(usbus_msc_device_t *msc)
 {
     uint8_t lun = msc->cmd.lun;
     uint16_t block_size = msc->lun_dev[lun].block_size;
     uint32_t sector_count;
     mtd_dev_t *mtd = msc->lun_dev[lun].mtd;
+    /* receiving continues into the spare buffer while a block is written */
+    bool overlap = (msc->spare_buffer != NULL);
+    uint8_t *full = NULL;
+    uint32_t page = 0;
     size_t len;
-    int ret;
 
     /* Check if we have a block to read and transfer */
     if (!msc->block_nb) {
@@ -95,54 +117,63 @@ static void _write_xfer(usbus_msc_device_t *msc)
             sector_count = 1;
         }
 
-        /* Write one or multiple sectors */
-        ret = mtd_write_page(mtd, msc->buffer,
-                             msc->block * sector_count * mtd->pages_per_sector,
-                             0, block_size);
-        if (ret != 0) {
-            /* Failure occurs during write operation, stall the operation */
-            DEBUG("[msc]: Write fail with error: %d\n", ret);
-            /* Stall IN bulk endpoint and signal error to host through
-             * CSW command with command failed status */
-            static const usbopt_enable_t enable = USBOPT_ENABLE;
-            usbdev_ep_set(msc->ep_in->ep, USBOPT_EP_STALL, &enable,
-                          sizeof(usbopt_enable_t));
-            msc->state = GEN_CSW;
-            msc->cmd.status = USB_MSC_CSW_STATUS_COMMAND_FAILED;
+        full = msc->buffer;
+        page = msc->block * sector_count * mtd->pages_per_sector;
+        if (overlap) {
+            msc->buffer = msc->spare_buffer;
+            msc->spare_buffer = full;
+        }
+        else {
+            /* Write one or multiple sectors */
+            _write_block(msc, mtd, full, page, block_size);
         }
         msc->block_offset = 0;
         msc->block++;
         msc->block_nb--;
     }
 
-    if (msc->cmd.len == 0) {
+    if ((msc->cmd.len == 0) && (msc->state == DATA_TRANSFER_OUT)) {
         /* All blocks have been transferred, send CSW to host */
-        if (msc->state == DATA_TRANSFER_OUT) {
-            msc->state = GEN_CSW;
-            /* Data was processed, ready next transfer */
-            usbdev_ep_xmit(msc->ep_out->ep, msc->out_buf, USBUS_MSC_EP_DATA_SIZE);
-            return;
-        }
+        msc->state = GEN_CSW;
+        /* Data was processed, ready next transfer */
+        usbdev_ep_xmit(msc->ep_out->ep, msc->out_buf, USBUS_MSC_EP_DATA_SIZE);
     }
-
-    if (len > 0) {
+    else if (len > 0) {
         /* Directly put data incoming on the endpoint to the flashpage buffer */
         usbdev_ep_xmit(msc->ep_out->ep, &msc->buffer[msc->block_offset], len);
     }
+
+    if (full && overlap) {
+        /* Write one or multiple sectors while the host sends the next block,
+         * the CSW is only sent once this returned */
+        _write_block(msc, mtd, full, page, block_size);
+    }
+}
+
+static int _read_block(usbus_msc_device_t *msc, uint8_t *buf, uint32_t block)
+{
+    usbus_msc_lun_t *lun = &msc->lun_dev[msc->cmd.lun];
+
+    return mtd_read(lun->mtd, buf, block * lun->block_size, lun->block_size);
 }
 
 static void _read_xfer(usbus_msc_device_t *msc)
 {
     uint8_t lun = msc->cmd.lun;
-    mtd_dev_t *mtd = msc->lun_dev[lun].mtd;
     uint32_t block_size = msc->lun_dev[lun].block_size;
     int ret;
     /* Check if we have a block to read and transfer */
     if (msc->block_nb) {
         /* read buffer from mtd device */
         if (msc->block_offset == 0) {
-            ret = mtd_read(mtd, msc->buffer, msc->block * block_size, block_size);
-            if (ret != 0) {
+            if (msc->prefetched) {
+                /* the block was read while the previous one was sent */
+                uint8_t *tmp = msc->buffer;
+                msc->buffer = msc->spare_buffer;
+                msc->spare_buffer = tmp;
+                msc->prefetched = false;
+            }
+            else if ((ret = _read_block(msc, msc->buffer, msc->block)) != 0) {
                 DEBUG("[msc]: Read operation failed with error:%d\n", ret);
                 /* Stall the current operation, and signal it to host */
                 static const usbopt_enable_t enable = USBOPT_ENABLE;
@@ -153,19 +184,26 @@ static void _read_xfer(usbus_msc_device_t *msc)
 
             }
         }
+        /* Send as much of the block as fits into a single transfer */
+        size_t len = MIN(msc->xfer_max, block_size - msc->block_offset);
         /* Data prepared, signal ready to usbus */
-        usbdev_ep_xmit(msc->ep_in->ep, &msc->buffer[msc->block_offset],
-                       msc->ep_in->ep->len);
+        usbdev_ep_xmit(msc->ep_in->ep, &msc->buffer[msc->block_offset], len);
         /* Update offset for page buffer */
-        msc->block_offset += msc->ep_in->ep->len;
+        msc->block_offset += len;
         /* Decrement whole len */
-        msc->cmd.len -= msc->ep_in->ep->len;
+        msc->cmd.len -= len;
         /* whole buffer is empty, point to new block if any */
         if (msc->block_offset >= block_size) {
             msc->block_offset = 0;
             msc->block++;
             msc->block_nb--;
         }
+        /* Read the block following the one in buffer while it is sent */
+        unsigned ahead = (msc->block_offset != 0) ? 1 : 0;
+        if (msc->spare_buffer && !msc->prefetched && (msc->block_nb > ahead)) {
+            msc->prefetched = (_read_block(msc, msc->spare_buffer,
+                                           msc->block + ahead) == 0);
+        }
     }
     else {
         /* All blocks have been transferred, send CSW to host */
@@ -206,6 +244,16 @@ static unsigned _get_lun(usbus_msc_device_t *msc)
     return count;
 }
 
+static uint8_t *_realloc_buffer(uint8_t *buf, size_t size)
+{
+    if (IS_USED(MODULE_ESP32_SDK)) {
+        /* ESP32x does not support posix_memalign */
+        return realloc(buf, size);
+    }
+    free(buf);
+    return aligned_alloc(USBDEV_CPU_DMA_ALIGNMENT, size);
+}
+
 int usbus_msc_add_lun(usbus_t *usbus, mtd_dev_t *dev)
 {
     uint32_t block_size;
@@ -239,31 +287,18 @@ int usbus_msc_add_lun(usbus_t *usbus, mtd_dev_t *dev)
                       dev->pages_per_sector, dev->sector_count);
                 return -ENOMEM;
             }
-            if (msc->buffer != NULL) {
-                /* If new registered MTD device need more memory than the
-                   previous, realloc a new buffer */
-                if (block_size > msc->buffer_size) {
-                    if (IS_USED(MODULE_ESP32_SDK)) {
-                        /* ESP32x does not support posix_memalign */
-                        msc->buffer = realloc(msc->buffer, block_size);
-                    }
-                    else {
-                        free(msc->buffer);
-                        msc->buffer = aligned_alloc(USBDEV_CPU_DMA_ALIGNMENT, block_size);
-                    }
-                }
-            } else {
-                /* No buffer allocated yet, so allocate one */
-                if (IS_USED(MODULE_ESP32_SDK)) {
-                    /* ESP32x does not support posix_memalign */
-                    msc->buffer = malloc(block_size);
-                }
-                else {
-                    msc->buffer = aligned_alloc(USBDEV_CPU_DMA_ALIGNMENT, block_size);
+            /* If new registered MTD device need more memory than the
+               previous, realloc a new buffer */
+            if (!msc->buffer || (block_size > msc->buffer_size)) {
+                msc->buffer = _realloc_buffer(msc->buffer, block_size);
+                if (IS_ACTIVE(CONFIG_USBUS_MSC_DOUBLE_BUFFER) && msc->buffer) {
+                    msc->spare_buffer = _realloc_buffer(msc->spare_buffer,
+                                                        block_size);
                 }
             }
 
-            if (!msc->buffer) {
+            if (!msc->buffer ||
+                (IS_ACTIVE(CONFIG_USBUS_MSC_DOUBLE_BUFFER) && !msc->spare_buffer)) {
                 DEBUG_PUTS("[msc]: Failed to realloc new buffer\n");
                 return -ENOMEM;
             }
@@ -298,6 +333,8 @@ int usbus_msc_remove_lun(usbus_t *usbus, mtd_dev_t *dev)
     /* No more slots available */
     free(msc->buffer);
     msc->buffer = NULL;
+    free(msc->spare_buffer);
+    msc->spare_buffer = NULL;
     return -ENODEV;
 }
 
@@ -324,6 +361,8 @@ static void _init(usbus_t *usbus, usbus_handler_t *handler)
     msc->block_offset = 0;
     /* Buffer will be initialized later */
     msc->buffer = NULL;
+    msc->spare_buffer = NULL;
+    msc->prefetched = false;
     msc->buffer_size = 0;
     msc->block_nb = 0;
     msc->block = 0;
@@ -363,6 +402,13 @@ static void _init(usbus_t *usbus, usbus_handler_t *handler)
     assert(msc->ep_out);
     msc->ep_out->interval = 0;
 
+    /* Send whole blocks with a single transfer if the peripheral supports
+     * it, otherwise one packet per transfer */
+    if (usbdev_ep_get(msc->ep_in->ep, USBOPT_EP_MAX_XFER_SIZE, &msc->xfer_max,
+                      sizeof(msc->xfer_max)) != sizeof(msc->xfer_max)) {
+        msc->xfer_max = USBUS_MSC_EP_DATA_SIZE;
+    }
+
     /* Add interfaces to the stack */
     usbus_add_interface(usbus, &msc->iface);
 
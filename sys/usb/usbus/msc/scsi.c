@@ -110,6 +110,7 @@ static void _scsi_read10(usbus_handler_t *handler, msc_cbw_buf_t *cbw, uint8_t l
     /* Get number of blocks to transfer */
     msc->block_nb = byteorder_ntohs(pkt->xfer_len);
     msc->cmd.len = cbw->data_len;
+    msc->prefetched = false;
     msc->state = DATA_TRANSFER_IN;
 
     if ((cbw->flags & USB_MSC_CBW_FLAG_IN) != 0) {
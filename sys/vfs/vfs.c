@@ -24,9 +24,11 @@
 #include <unistd.h> /* for STDIN_FILENO, STDOUT_FILENO, STDERR_FILENO */
 
 #include "atomic_utils.h"
+#include "bitfield.h"
 #include "clist.h"
 #include "compiler_hints.h"
 #include "container.h"
+#include "irq.h"
 #include "modules.h"
 #include "mutex.h"
 #include "sched.h"
@@ -66,6 +68,19 @@ XFA_INIT(vfs_mount_t, vfs_mountpoints_xfa);
  */
 static vfs_file_t _vfs_open_files[VFS_MAX_OPEN_FILES];
 
+/**
+ * @internal
+ * @brief Allocation map of the _vfs_open_files array
+ *
+ * A set bit marks a used fd. The bits of STDIN, STDOUT and STDERR are always
+ * set so they are never handed out by VFS_ANY_FD, whether they are bound is
+ * tracked by their vfs_file_t::pid only.
+ */
+static BITFIELD(_vfs_fds_used, VFS_MAX_OPEN_FILES) = {
+    /* bits are stored MSB first */
+    (1 << (7 - STDIN_FILENO)) | (1 << (7 - STDOUT_FILENO)) | (1 << (7 - STDERR_FILENO)),
+};
+
 /**
  * @internal
  * @brief List handle for list of all currently mounted file systems
@@ -83,9 +98,8 @@ static clist_node_t _vfs_mounts_list;
  * corresponding slot in the open files table is already occupied, no iteration
  * is done to find another free number in this case.
  *
- * If the @p fd argument is negative, the algorithm will iterate through the
- * open files table until it find an unused slot and return the number of that
- * slot.
+ * If the @p fd argument is negative, the lowest unused slot is taken from the
+ * allocation map, skipping the stdio fd numbers.
  *
  * @param[in]  fd  Desired fd number, use VFS_ANY_FD for any free fd
  *
@@ -146,7 +160,40 @@ static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const cha
 static inline int _fd_is_valid(int fd);
 
 static mutex_t _mount_mutex = MUTEX_INIT;
-static mutex_t _open_mutex = MUTEX_INIT;
+
+#if CONFIG_VFS_STAT_CACHE_NUMOF
+/**
+ * @internal
+ * @brief Cached result of vfs_stat()
+ */
+typedef struct {
+    char path[CONFIG_VFS_STAT_CACHE_PATH_MAX]; /**< absolute path, empty if unused */
+    uint32_t gen;                               /**< @ref _stat_cache_gen when stored */
+    int res;                                    /**< 0 or -ENOENT */
+    struct stat buf;                            /**< status if res is 0 */
+} _stat_cache_entry_t;
+
+static _stat_cache_entry_t _stat_cache[CONFIG_VFS_STAT_CACHE_NUMOF];
+static unsigned _stat_cache_next;
+static mutex_t _stat_cache_mutex = MUTEX_INIT;
+
+/**
+ * @internal
+ * @brief Incremented on every modification, entries of older generations are stale
+ */
+static uint32_t _stat_cache_gen;
+#endif
+
+/**
+ * @internal
+ * @brief Drop all cached vfs_stat() results
+ */
+static inline void _stat_cache_invalidate(void)
+{
+#if CONFIG_VFS_STAT_CACHE_NUMOF
+    atomic_fetch_add_u32(&_stat_cache_gen, 1);
+#endif
+}
 
 int vfs_close(int fd)
 {
@@ -161,6 +208,10 @@ int vfs_close(int fd)
          * system driver close() call below */
         res = filp->f_op->close(filp);
     }
+    if ((filp->flags & O_ACCMODE) != O_RDONLY) {
+        /* some file systems only update the status on close */
+        _stat_cache_invalidate();
+    }
     _free_fd(fd);
     return res;
 }
@@ -292,9 +343,7 @@ int vfs_open(const char *name, int flags, mode_t mode)
         DEBUG("vfs_open: no matching mount\n");
         return res;
     }
-    mutex_lock(&_open_mutex);
     int fd = _init_fd(VFS_ANY_FD, mountp->fs->f_op, mountp, flags, NULL);
-    mutex_unlock(&_open_mutex);
     if (fd < 0) {
         DEBUG("vfs_open: _init_fd: ERR %d!\n", fd);
         /* remember to decrement the open_files count */
@@ -305,6 +354,9 @@ int vfs_open(const char *name, int flags, mode_t mode)
     vfs_file_t *filp = &_vfs_open_files[fd];
     if (filp->f_op->open != NULL) {
         res = filp->f_op->open(filp, rel_path, flags, mode);
+        if (flags & (O_CREAT | O_TRUNC)) {
+            _stat_cache_invalidate();
+        }
         if (res < 0) {
             /* something went wrong during open */
             DEBUG("vfs_open: open: ERR %d!\n", res);
@@ -410,7 +462,11 @@ ssize_t vfs_write(int fd, const void *src, size_t count)
         /* driver does not implement write() */
         return -EINVAL;
     }
-    return filp->f_op->write(filp, src, count);
+    ssize_t written = filp->f_op->write(filp, src, count);
+    if (filp->mp != NULL) {
+        _stat_cache_invalidate();
+    }
+    return written;
 }
 
 ssize_t vfs_write_iol(int fd, const iolist_t *snips)
@@ -445,7 +501,49 @@ int vfs_fsync(int fd)
         /* driver does not implement fsync() */
         return -EINVAL;
     }
-    return filp->f_op->fsync(filp);
+    res = filp->f_op->fsync(filp);
+    _stat_cache_invalidate();
+    return res;
+}
+
+int vfs_mmap(int fd, off_t off, size_t len, const void **addr)
+{
+    DEBUG("vfs_mmap: %d, %ld, %" PRIuSIZE ", %p\n", fd, (long)off, len, (void *)addr);
+    if (addr == NULL) {
+        return -EFAULT;
+    }
+    int res = _fd_is_valid(fd);
+    if (res < 0) {
+        return res;
+    }
+    vfs_file_t *filp = &_vfs_open_files[fd];
+    if ((filp->flags & O_ACCMODE) == O_WRONLY) {
+        /* File not open for reading */
+        return -EBADF;
+    }
+    if (off < 0) {
+        return -EINVAL;
+    }
+    if (filp->f_op->mmap == NULL) {
+        /* driver does not implement mmap() */
+        return -ENOTSUP;
+    }
+    return filp->f_op->mmap(filp, off, len, addr);
+}
+
+int vfs_munmap(int fd, const void *addr, size_t len)
+{
+    DEBUG("vfs_munmap: %d, %p, %" PRIuSIZE "\n", fd, addr, len);
+    int res = _fd_is_valid(fd);
+    if (res < 0) {
+        return res;
+    }
+    vfs_file_t *filp = &_vfs_open_files[fd];
+    if (filp->f_op->munmap == NULL) {
+        /* nothing to release */
+        return 0;
+    }
+    return filp->f_op->munmap(filp, addr, len);
 }
 
 int vfs_opendir(vfs_DIR *dirp, const char *dirname)
@@ -503,6 +601,41 @@ int vfs_readdir(vfs_DIR *dirp, vfs_dirent_t *entry)
     return -EINVAL;
 }
 
+int vfs_readdir_batch(vfs_DIR *dirp, vfs_dirent_t *entries, struct stat *stats,
+                      size_t count)
+{
+    DEBUG("vfs_readdir_batch: %p, %p, %p, %" PRIuSIZE "\n",
+          (void *)dirp, (void *)entries, (void *)stats, count);
+    if ((dirp == NULL) || (entries == NULL) || (dirp->d_op == NULL) ||
+        (dirp->d_op->readdir == NULL)) {
+        return -EINVAL;
+    }
+
+    size_t n = 0;
+    while (n < count) {
+        int res;
+        if (stats) {
+            memset(&stats[n], 0, sizeof(stats[n]));
+        }
+        if (stats && dirp->d_op->readdir_stat) {
+            res = dirp->d_op->readdir_stat(dirp, &entries[n], &stats[n]);
+        }
+        else {
+            res = dirp->d_op->readdir(dirp, &entries[n]);
+        }
+        if (res == -EAGAIN) {
+            /* the driver skipped a broken entry */
+            continue;
+        }
+        if (res <= 0) {
+            return n ? (int)n : res;
+        }
+        n++;
+    }
+
+    return n;
+}
+
 int vfs_closedir(vfs_DIR *dirp)
 {
     DEBUG("vfs_closedir: %p\n", (void *)dirp);
@@ -571,7 +704,9 @@ int vfs_format(vfs_mount_t *mountp)
 
     if (mountp->fs->fs_op != NULL) {
         if (mountp->fs->fs_op->format != NULL) {
-            return mountp->fs->fs_op->format(mountp);
+            ret = mountp->fs->fs_op->format(mountp);
+            _stat_cache_invalidate();
+            return ret;
         }
     }
 
@@ -601,6 +736,8 @@ int vfs_mount(vfs_mount_t *mountp)
     /* Insert last in list. This property is relied on by vfs_iterate_mount_dirs. */
     clist_rpush(&_vfs_mounts_list, &mountp->list_entry);
     mutex_unlock(&_mount_mutex);
+    /* paths below the mount point that were not found before may exist now */
+    _stat_cache_invalidate();
     DEBUG("vfs_mount: mount done\n");
     return 0;
 }
@@ -647,6 +784,7 @@ int vfs_umount(vfs_mount_t *mountp, bool force)
         return -EINVAL;
     }
     mutex_unlock(&_mount_mutex);
+    _stat_cache_invalidate();
     return 0;
 }
 
@@ -696,6 +834,7 @@ int vfs_rename(const char *from_path, const char *to_path)
         return -EXDEV;
     }
     res = mountp->fs->fs_op->rename(mountp, rel_from, rel_to);
+    _stat_cache_invalidate();
     DEBUG("vfs_rename: rename %p, \"%s\" -> \"%s\"", (void *)mountp, rel_from, rel_to);
     if (res < 0) {
         /* something went wrong during rename */
@@ -739,6 +878,7 @@ int vfs_unlink(const char *name)
         return -EROFS;
     }
     res = mountp->fs->fs_op->unlink(mountp, rel_path);
+    _stat_cache_invalidate();
     DEBUG("vfs_unlink: unlink %p, \"%s\"", (void *)mountp, rel_path);
     if (res < 0) {
         /* something went wrong during unlink */
@@ -778,6 +918,7 @@ int vfs_mkdir(const char *name, mode_t mode)
         return -EROFS;
     }
     res = mountp->fs->fs_op->mkdir(mountp, rel_path, mode);
+    _stat_cache_invalidate();
     DEBUG("vfs_mkdir: mkdir %p, \"%s\"", (void *)mountp, rel_path);
     if (res < 0) {
         /* something went wrong during mkdir */
@@ -817,6 +958,7 @@ int vfs_rmdir(const char *name)
         return -EROFS;
     }
     res = mountp->fs->fs_op->rmdir(mountp, rel_path);
+    _stat_cache_invalidate();
     DEBUG("vfs_rmdir: rmdir %p, \"%s\"", (void *)mountp, rel_path);
     if (res < 0) {
         /* something went wrong during rmdir */
@@ -831,6 +973,43 @@ int vfs_rmdir(const char *name)
     return res;
 }
 
+#if CONFIG_VFS_STAT_CACHE_NUMOF
+static bool _stat_cache_get(const char *path, uint32_t gen, struct stat *buf, int *res)
+{
+    bool found = false;
+
+    mutex_lock(&_stat_cache_mutex);
+    for (unsigned i = 0; i < CONFIG_VFS_STAT_CACHE_NUMOF; i++) {
+        _stat_cache_entry_t *entry = &_stat_cache[i];
+        if (entry->gen == gen && entry->path[0] && strcmp(entry->path, path) == 0) {
+            *buf = entry->buf;
+            *res = entry->res;
+            found = true;
+            break;
+        }
+    }
+    mutex_unlock(&_stat_cache_mutex);
+
+    return found;
+}
+
+static void _stat_cache_put(const char *path, uint32_t gen, int res, const struct stat *buf)
+{
+    if ((res != 0 && res != -ENOENT) || strlen(path) >= CONFIG_VFS_STAT_CACHE_PATH_MAX) {
+        return;
+    }
+
+    mutex_lock(&_stat_cache_mutex);
+    _stat_cache_entry_t *entry = &_stat_cache[_stat_cache_next];
+    _stat_cache_next = (_stat_cache_next + 1) % CONFIG_VFS_STAT_CACHE_NUMOF;
+    strcpy(entry->path, path);
+    entry->gen = gen;
+    entry->res = res;
+    entry->buf = *buf;
+    mutex_unlock(&_stat_cache_mutex);
+}
+#endif
+
 int vfs_stat(const char *restrict path, struct stat *restrict buf)
 {
     DEBUG("vfs_stat: \"%s\", %p\n", path, (void *)buf);
@@ -855,8 +1034,21 @@ int vfs_stat(const char *restrict path, struct stat *restrict buf)
         assume(before > 0);
         return -EPERM;
     }
+#if CONFIG_VFS_STAT_CACHE_NUMOF
+    /* a modification while the file system is asked makes the result stale */
+    uint32_t gen = atomic_load_u32(&_stat_cache_gen);
+    if (_stat_cache_get(path, gen, buf, &res)) {
+        DEBUG("vfs_stat: cached\n");
+        uint16_t before = atomic_fetch_sub_u16(&mountp->open_files, 1);
+        assume(before > 0);
+        return res;
+    }
+#endif
     memset(buf, 0, sizeof(*buf));
     res = mountp->fs->fs_op->stat(mountp, rel_path, buf);
+#if CONFIG_VFS_STAT_CACHE_NUMOF
+    _stat_cache_put(path, gen, res, buf);
+#endif
     /* remember to decrement the open_files count */
     uint16_t before = atomic_fetch_sub_u16(&mountp->open_files, 1);
     assume(before > 0);
@@ -901,9 +1093,7 @@ int vfs_bind(int fd, int flags, const vfs_file_ops_t *f_op, void *private_data)
     if (f_op == NULL) {
         return -EINVAL;
     }
-    mutex_lock(&_open_mutex);
     fd = _init_fd(fd, f_op, NULL, flags, private_data);
-    mutex_unlock(&_open_mutex);
     if (fd < 0) {
         DEBUG("vfs_bind: _init_fd: ERR %d!\n", fd);
         return fd;
@@ -1061,37 +1251,55 @@ const vfs_file_t *vfs_file_get(int fd)
     }
 }
 
+static inline bool _is_stdio_fd(int fd)
+{
+    return (fd == STDIN_FILENO) || (fd == STDOUT_FILENO) || (fd == STDERR_FILENO);
+}
+
 static inline int _allocate_fd(int fd)
 {
+    kernel_pid_t pid = thread_getpid();
+    if (pid == KERNEL_PID_UNDEF) {
+        /* This happens when calling vfs_bind during boot, before threads have
+         * been started. */
+        pid = -1;
+    }
+
     if (fd < 0) {
-        for (fd = 0; fd < VFS_MAX_OPEN_FILES; ++fd) {
-            if ((fd == STDIN_FILENO) || (fd == STDOUT_FILENO) || (fd == STDERR_FILENO)) {
-                /* Do not auto-allocate the stdio file descriptor numbers to
-                 * avoid conflicts between normal file system users and stdio
-                 * drivers such as stdio_uart, stdio_rtt which need to be able
-                 * to bind to these specific file descriptor numbers. */
-                continue;
-            }
-            if (_vfs_open_files[fd].pid == KERNEL_PID_UNDEF) {
-                break;
-            }
+        /* The stdio fds are always marked as used in the allocation map to
+         * avoid conflicts between normal file system users and stdio drivers
+         * such as stdio_uart, stdio_rtt which need to be able to bind to
+         * these specific file descriptor numbers. */
+        fd = bf_get_unset(_vfs_fds_used, VFS_MAX_OPEN_FILES);
+        if (fd < 0) {
+            /* The _vfs_open_files array is full */
+            return -ENFILE;
         }
+        _vfs_open_files[fd].pid = pid;
+        return fd;
     }
     if (fd >= VFS_MAX_OPEN_FILES) {
-        /* The _vfs_open_files array is full */
         return -ENFILE;
     }
-    else if (_vfs_open_files[fd].pid != KERNEL_PID_UNDEF) {
+
+    bool used;
+    unsigned state = irq_disable();
+    if (_is_stdio_fd(fd)) {
+        used = _vfs_open_files[fd].pid != KERNEL_PID_UNDEF;
+    }
+    else {
+        used = bf_isset(_vfs_fds_used, fd);
+        bf_set(_vfs_fds_used, fd);
+    }
+    if (!used) {
+        _vfs_open_files[fd].pid = pid;
+    }
+    irq_restore(state);
+
+    if (used) {
         /* The desired fd is already in use */
         return -EEXIST;
     }
-    kernel_pid_t pid = thread_getpid();
-    if (pid == KERNEL_PID_UNDEF) {
-        /* This happens when calling vfs_bind during boot, before threads have
-         * been started. */
-        pid = -1;
-    }
-    _vfs_open_files[fd].pid = pid;
     return fd;
 }
 
@@ -1103,6 +1311,9 @@ static inline void _free_fd(int fd)
         assume(before > 0);
     }
     _vfs_open_files[fd].pid = KERNEL_PID_UNDEF;
+    if (!_is_stdio_fd(fd)) {
+        bf_unset_atomic(_vfs_fds_used, fd);
+    }
 }
 
 static inline int _init_fd(int fd, const vfs_file_ops_t *f_op, vfs_mount_t *mountp, int flags, void *private_data)
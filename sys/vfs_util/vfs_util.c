@@ -19,6 +19,7 @@
 #include <string.h>
 #include <errno.h>
 
+#include "macros/utils.h"
 #include "vfs.h"
 #include "vfs_util.h"
 
@@ -155,6 +156,143 @@ int vfs_file_sha256(const char* file, void *digest,
 }
 #endif /* MODULE_HASHES */
 
+#if MODULE_SOCK_TCP
+static ssize_t _tcp_write_all(sock_tcp_t *sock, const void *data, size_t len)
+{
+    const uint8_t *pos = data;
+
+    while (len) {
+        ssize_t res = sock_tcp_write(sock, pos, len);
+        if (res < 0) {
+            return res;
+        }
+        pos += res;
+        len -= res;
+    }
+    return 0;
+}
+
+ssize_t vfs_sendfile(int fd, sock_tcp_t *sock, off_t offset, size_t len,
+                     void *work_buf, size_t work_buf_len)
+{
+    const void *map;
+    ssize_t res;
+    size_t sent = 0;
+
+    if (vfs_mmap(fd, offset, len, &map) == 0) {
+        res = _tcp_write_all(sock, map, len);
+        vfs_munmap(fd, map, len);
+        return res < 0 ? res : (ssize_t)len;
+    }
+
+    if ((res = vfs_lseek(fd, offset, SEEK_SET)) < 0) {
+        return res;
+    }
+    while (sent < len) {
+        res = vfs_read(fd, work_buf, MIN(len - sent, work_buf_len));
+        if (res <= 0) {
+            break;
+        }
+        if ((res = _tcp_write_all(sock, work_buf, res)) < 0) {
+            break;
+        }
+        sent += res;
+    }
+
+    return res < 0 ? res : (ssize_t)sent;
+}
+
+ssize_t vfs_recvfile(sock_tcp_t *sock, int fd, size_t len, uint32_t timeout,
+                     void *work_buf, size_t work_buf_len)
+{
+    ssize_t res = 0;
+    size_t received = 0;
+
+    while (received < len) {
+        res = sock_tcp_read(sock, work_buf, MIN(len - received, work_buf_len), timeout);
+        if (res <= 0) {
+            /* 0: connection closed */
+            break;
+        }
+        if ((res = vfs_write(fd, work_buf, res)) < 0) {
+            break;
+        }
+        received += res;
+    }
+
+    return res < 0 ? res : (ssize_t)received;
+}
+#endif /* MODULE_SOCK_TCP */
+
+#if MODULE_SOCK_UDP
+ssize_t vfs_sendfile_udp(int fd, sock_udp_t *sock, const sock_udp_ep_t *remote,
+                         off_t offset, size_t len,
+                         void *work_buf, size_t work_buf_len)
+{
+    const uint8_t *map;
+    ssize_t res = 0;
+    size_t sent = 0;
+
+    if (vfs_mmap(fd, offset, len, (const void **)&map) == 0) {
+        while (sent < len) {
+            res = sock_udp_send(sock, map + sent, MIN(len - sent, work_buf_len), remote);
+            if (res < 0) {
+                break;
+            }
+            sent += res;
+        }
+        vfs_munmap(fd, map, len);
+        return res < 0 ? res : (ssize_t)sent;
+    }
+
+    if ((res = vfs_lseek(fd, offset, SEEK_SET)) < 0) {
+        return res;
+    }
+    while (sent < len) {
+        res = vfs_read(fd, work_buf, MIN(len - sent, work_buf_len));
+        if (res <= 0) {
+            break;
+        }
+        if ((res = sock_udp_send(sock, work_buf, res, remote)) < 0) {
+            break;
+        }
+        sent += res;
+    }
+
+    return res < 0 ? res : (ssize_t)sent;
+}
+
+ssize_t vfs_recvfile_udp(sock_udp_t *sock, int fd, size_t len, uint32_t timeout,
+                         sock_udp_ep_t *remote)
+{
+    size_t received = 0;
+
+    while (received < len) {
+        void *data, *ctx = NULL;
+        ssize_t res;
+
+        /* write the datagram straight from the packet buffer, segment by
+         * segment, the buffer is released once all were handed out */
+        while ((res = sock_udp_recv_buf(sock, &data, &ctx, timeout, remote)) > 0) {
+            res = vfs_write(fd, data, res);
+            if (res < 0) {
+                sock_udp_buf_release(sock, ctx);
+                return res;
+            }
+            received += res;
+        }
+        if (res == -ETIMEDOUT) {
+            break;
+        }
+        if (res < 0) {
+            return res;
+        }
+    }
+
+    return received;
+}
+#endif /* MODULE_SOCK_UDP */
+
 int vfs_is_dir(const char *path)
 {
     assert(path);
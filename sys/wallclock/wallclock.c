@@ -0,0 +1,240 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_wallclock
+ * @{
+ *
+ * @file
+ * @brief       Wall clock time implementation
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+
+#include "div.h"
+#include "irq.h"
+#include "periph/rtc.h"
+#include "rtc_utils.h"
+#include "time_units.h"
+#include "wallclock.h"
+#include "ztimer64.h"
+
+#if IS_USED(MODULE_PERIPH_PTP)
+#include "periph/ptp.h"
+#endif
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/* leap years before year Y (in the proleptic Gregorian calendar) */
+#define LEAPS_BEFORE(Y) (((Y) - 1) / 4 - ((Y) - 1) / 100 + ((Y) - 1) / 400)
+
+/* seconds from 1970-01-01 to 01.01.$RIOT_EPOCH */
+#define EPOCH_OFFSET    ((((RIOT_EPOCH) - 1970) * 365UL +               \
+                          LEAPS_BEFORE(RIOT_EPOCH) - LEAPS_BEFORE(1970)) \
+                         * 86400UL)
+
+/**
+ * The wall clock time is
+ *
+ *     wall + dt + dt * ppb / 10^9 + applied part of slew
+ *
+ * with dt = now - local. All of it is updated only at a rebase, which keeps
+ * the time continuous.
+ */
+static struct {
+    uint64_t local;         /**< ZTIMER64_USEC time of the last rebase */
+    uint64_t wall;          /**< wall clock time at @ref local */
+    int64_t slew;           /**< offset still to slew at @ref local */
+    uint64_t last_sample;   /**< local time of the last sample, or 0 */
+    int32_t ppb;            /**< frequency correction */
+    bool set;               /**< time has been set */
+} _clock;
+
+static int64_t _scale_ppb(int64_t dt, int32_t ppb)
+{
+    /* split to avoid overflowing for large dt */
+    return (dt / 1000000) * ppb / 1000 + (dt % 1000000) * ppb / 1000000000;
+}
+
+/* must be called with interrupts disabled */
+static uint64_t _wall_at(uint64_t local, int64_t *slew_left)
+{
+    int64_t dt = (int64_t)(local - _clock.local);
+    int64_t applied = 0;
+
+    if (dt > 0) {
+        int64_t max = dt * CONFIG_WALLCLOCK_SLEW_MAX_PPM / 1000000;
+
+        if (_clock.slew > max) {
+            applied = max;
+        }
+        else if (_clock.slew < -max) {
+            applied = -max;
+        }
+        else {
+            applied = _clock.slew;
+        }
+    }
+
+    *slew_left = _clock.slew - applied;
+
+    return _clock.wall + dt + _scale_ppb(dt, _clock.ppb) + applied;
+}
+
+/* must be called with interrupts disabled */
+static void _rebase(uint64_t local)
+{
+    int64_t slew_left;
+
+    _clock.wall = _wall_at(local, &slew_left);
+    _clock.local = local;
+    _clock.slew = slew_left;
+}
+
+/* must be called with interrupts disabled */
+static void _step(uint64_t usec, uint64_t local)
+{
+    _clock.wall = usec;
+    _clock.local = local;
+    _clock.slew = 0;
+    _clock.set = true;
+}
+
+uint64_t wallclock_now_usec(void)
+{
+    int64_t slew_left;
+    unsigned state = irq_disable();
+    uint64_t now = _wall_at(ztimer64_now(ZTIMER64_USEC), &slew_left);
+
+    irq_restore(state);
+
+    return now;
+}
+
+void wallclock_gettime(struct timespec *ts)
+{
+    uint64_t now = wallclock_now_usec();
+
+    ts->tv_sec = div_u64_by_1000000(now);
+    ts->tv_nsec = (now - ts->tv_sec * US_PER_SEC) * NS_PER_US;
+}
+
+void wallclock_get_tm(struct tm *t)
+{
+    uint64_t secs = div_u64_by_1000000(wallclock_now_usec());
+
+    rtc_localtime(secs - EPOCH_OFFSET, t);
+}
+
+void wallclock_set(uint64_t usec)
+{
+    unsigned state = irq_disable();
+
+    _step(usec, ztimer64_now(ZTIMER64_USEC));
+    _clock.last_sample = 0;
+
+    irq_restore(state);
+}
+
+void wallclock_adjust(int64_t offset)
+{
+    unsigned state = irq_disable();
+
+    _rebase(ztimer64_now(ZTIMER64_USEC));
+    _clock.slew = offset;
+
+    irq_restore(state);
+}
+
+int64_t wallclock_discipline(uint64_t usec, uint64_t local)
+{
+    unsigned state = irq_disable();
+    int64_t slew_left;
+    /* compare to the time the clock converges to, so that only the error
+     * accumulated since the last sample is measured */
+    int64_t offset = (int64_t)(usec - _wall_at(local, &slew_left)) - slew_left;
+
+    if (!_clock.set ||
+        offset > (int64_t)CONFIG_WALLCLOCK_STEP_THRESHOLD_US ||
+        offset < -(int64_t)CONFIG_WALLCLOCK_STEP_THRESHOLD_US) {
+        DEBUG("wallclock: step by %" PRId64 " us\n", offset);
+        _step(usec, local);
+        _clock.last_sample = local;
+        irq_restore(state);
+        return offset;
+    }
+
+    /* rebase at the current time (or the sample, should it be ahead) so the
+     * new frequency and slew do not change the time already passed */
+    uint64_t now = ztimer64_now(ZTIMER64_USEC);
+
+    _rebase((int64_t)(local - now) > 0 ? local : now);
+
+    if (_clock.last_sample && (local > _clock.last_sample)) {
+        int64_t err = offset * 1000000000 / (int64_t)(local - _clock.last_sample);
+        int64_t ppb = _clock.ppb + err / CONFIG_WALLCLOCK_FREQ_GAIN_DIV;
+
+        if (ppb > CONFIG_WALLCLOCK_FREQ_MAX_PPB) {
+            ppb = CONFIG_WALLCLOCK_FREQ_MAX_PPB;
+        }
+        else if (ppb < -CONFIG_WALLCLOCK_FREQ_MAX_PPB) {
+            ppb = -CONFIG_WALLCLOCK_FREQ_MAX_PPB;
+        }
+        _clock.ppb = ppb;
+    }
+
+    _clock.slew += offset;
+    _clock.last_sample = local;
+
+    irq_restore(state);
+
+    DEBUG("wallclock: offset %" PRId64 " us, freq %" PRId32 " ppb\n",
+          offset, _clock.ppb);
+
+    return offset;
+}
+
+int32_t wallclock_get_freq_ppb(void)
+{
+    return _clock.ppb;
+}
+
+bool wallclock_is_set(void)
+{
+    return _clock.set;
+}
+
+#if IS_USED(MODULE_PERIPH_PTP)
+void wallclock_sync_ptp(void)
+{
+    ptp_timestamp_t ts;
+
+    uint64_t before = ztimer64_now(ZTIMER64_USEC);
+    ptp_clock_read(&ts);
+    uint64_t after = ztimer64_now(ZTIMER64_USEC);
+
+    wallclock_discipline((uint64_t)ts.seconds * US_PER_SEC + ts.nanoseconds / NS_PER_US,
+                         before + (after - before) / 2);
+}
+#endif
+
+void auto_init_wallclock(void)
+{
+#if IS_USED(MODULE_PERIPH_RTC)
+    struct tm t;
+
+    if (rtc_get_time(&t) == 0) {
+        wallclock_set((rtc_mktime(&t) + (uint64_t)EPOCH_OFFSET) * US_PER_SEC);
+    }
+#endif
+}
@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_ztimer_auto
+ * @{
+ *
+ * @file
+ * @brief       ztimer auto clock selection implementation
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <assert.h>
+
+#include "irq.h"
+#include "mutex.h"
+#include "time_units.h"
+#include "ztimer.h"
+#include "ztimer/auto.h"
+
+/* ZTIMER_SEC is armed to expire this many seconds before the deadline */
+#define SEC_GUARD   (2U)
+
+static void _stage(void *arg);
+
+static void _expire(void *arg)
+{
+    ztimer_auto_t *timer = arg;
+
+    timer->clock = NULL;
+    timer->callback(timer->arg);
+}
+
+/* must be called with interrupts disabled and ZTIMER_MSEC acquired */
+static void _arm(ztimer_auto_t *timer)
+{
+    uint32_t left = timer->target - ztimer_now(ZTIMER_MSEC);
+
+    if (left > UINT32_MAX / 2) {
+        /* deadline already passed */
+        left = 0;
+    }
+
+    timer->timer.callback = _stage;
+    timer->timer.arg = timer;
+
+#if MODULE_ZTIMER_SEC
+    if (left >= CONFIG_ZTIMER_AUTO_SEC_MIN_MSEC) {
+        timer->clock = ZTIMER_SEC;
+        ztimer_set(ZTIMER_SEC, &timer->timer, left / MS_PER_SEC - SEC_GUARD);
+        return;
+    }
+#endif
+    if (left > CONFIG_ZTIMER_AUTO_GUARD_MSEC) {
+        timer->clock = ZTIMER_MSEC;
+        ztimer_set(ZTIMER_MSEC, &timer->timer,
+                   left - CONFIG_ZTIMER_AUTO_GUARD_MSEC);
+        return;
+    }
+
+    ztimer_release(ZTIMER_MSEC);
+    timer->clock = ZTIMER_USEC;
+    timer->timer.callback = _expire;
+    ztimer_set(ZTIMER_USEC, &timer->timer,
+               left * US_PER_MS + timer->remainder);
+}
+
+static void _stage(void *arg)
+{
+    _arm(arg);
+}
+
+/* must be called with interrupts disabled */
+static bool _remove(ztimer_auto_t *timer)
+{
+    if (!timer->clock) {
+        return false;
+    }
+
+    ztimer_remove(timer->clock, &timer->timer);
+    if (timer->clock != ZTIMER_USEC) {
+        ztimer_release(ZTIMER_MSEC);
+    }
+    timer->clock = NULL;
+
+    return true;
+}
+
+void ztimer_auto_set(ztimer_auto_t *timer, uint32_t timeout)
+{
+    assert(timer->callback);
+
+    unsigned state = irq_disable();
+
+    _remove(timer);
+
+    if (timeout <= CONFIG_ZTIMER_AUTO_USEC_MAX) {
+        timer->clock = ZTIMER_USEC;
+        timer->timer.callback = _expire;
+        timer->timer.arg = timer;
+        ztimer_set(ZTIMER_USEC, &timer->timer, timeout);
+    }
+    else {
+        ztimer_acquire(ZTIMER_MSEC);
+        /* the current ZTIMER_MSEC tick may be almost over, so count it as
+         * elapsed to never expire early */
+        timer->target = ztimer_now(ZTIMER_MSEC) + 1 + timeout / US_PER_MS;
+        timer->remainder = timeout % US_PER_MS;
+        _arm(timer);
+    }
+
+    irq_restore(state);
+}
+
+bool ztimer_auto_remove(ztimer_auto_t *timer)
+{
+    unsigned state = irq_disable();
+    bool was_set = _remove(timer);
+
+    irq_restore(state);
+
+    return was_set;
+}
+
+static void _callback_unlock_mutex(void *arg)
+{
+    mutex_unlock(arg);
+}
+
+void ztimer_auto_sleep(uint32_t duration)
+{
+    assert(!irq_is_in());
+    mutex_t mutex = MUTEX_INIT_LOCKED;
+    ztimer_auto_t timer = {
+        .callback = _callback_unlock_mutex,
+        .arg = &mutex,
+    };
+
+    ztimer_auto_set(&timer, duration);
+    mutex_lock(&mutex);
+}
@@ -25,6 +25,7 @@
 #include <assert.h>
 #include <stdint.h>
 #include <inttypes.h>
+#include <string.h>
 
 #include "kernel_defines.h"
 #include "irq.h"
@@ -43,6 +44,67 @@ static void _ztimer_update(ztimer_clock_t *clock);
 static void _ztimer_print(const ztimer_clock_t *clock);
 static uint32_t _ztimer_update_head_offset(ztimer_clock_t *clock);
 
+#if MODULE_ZTIMER_HEAP
+
+/* distance of a timer's target from the clock's base time */
+static inline uint32_t _key(const ztimer_clock_t *clock,
+                            const ztimer_base_t *entry)
+{
+    return entry->offset - clock->list.offset;
+}
+
+/* timers that are due are on the list, all others in the heap */
+static inline ztimer_base_t *_first(const ztimer_clock_t *clock)
+{
+    return clock->list.next ? clock->list.next : clock->heap;
+}
+
+static inline uint32_t _first_offset(const ztimer_clock_t *clock)
+{
+    return clock->list.next ? 0 : _key(clock, clock->heap);
+}
+#else
+static inline ztimer_base_t *_first(const ztimer_clock_t *clock)
+{
+    return clock->list.next;
+}
+
+static inline uint32_t _first_offset(const ztimer_clock_t *clock)
+{
+    return clock->list.next->offset;
+}
+#endif
+
+#if MODULE_ZTIMER_SLACK && !MODULE_ZTIMER_HEAP
+/* latest offset the clock can be armed to without any timer triggering
+ * later than its slack allows */
+static uint32_t _alarm_offset(const ztimer_clock_t *clock)
+{
+    const ztimer_base_t *entry = clock->list.next;
+    uint32_t offset = entry->offset;
+    uint32_t deadline = offset + entry->slack;
+
+    if (deadline < offset) {
+        deadline = UINT32_MAX;
+    }
+
+    /* all timers with a target before the deadline trigger with the first */
+    while ((entry = entry->next) && (entry->offset <= deadline - offset)) {
+        offset += entry->offset;
+        if (entry->slack < deadline - offset) {
+            deadline = offset + entry->slack;
+        }
+    }
+
+    return deadline;
+}
+#else
+static inline uint32_t _alarm_offset(const ztimer_clock_t *clock)
+{
+    return _first_offset(clock);
+}
+#endif
+
 #ifdef MODULE_ZTIMER_EXTEND
 static inline uint32_t _min_u32(uint32_t a, uint32_t b)
 {
@@ -114,12 +176,17 @@ bool ztimer_release(ztimer_clock_t *clock)
 
 static unsigned _is_set(const ztimer_clock_t *clock, const ztimer_t *t)
 {
+#if MODULE_ZTIMER_HEAP
+    (void)clock;
+    return t->base.prev != NULL;
+#else
     if (!clock->list.next) {
         return 0;
     }
     else {
         return (t->base.next || &t->base == clock->last);
     }
+#endif
 }
 
 unsigned ztimer_is_set(const ztimer_clock_t *clock, const ztimer_t *timer)
@@ -131,6 +198,22 @@ unsigned ztimer_is_set(const ztimer_clock_t *clock, const ztimer_t *timer)
     return res;
 }
 
+uint32_t ztimer_until_next(ztimer_clock_t *clock)
+{
+    uint32_t res = UINT32_MAX;
+    unsigned state = irq_disable();
+
+    if (_first(clock)) {
+        uint32_t target = clock->list.offset + _alarm_offset(clock);
+        int32_t diff = (int32_t)(target - ztimer_now(clock));
+
+        res = (diff > 0) ? (uint32_t)diff : 0;
+    }
+
+    irq_restore(state);
+    return res;
+}
+
 bool ztimer_remove(ztimer_clock_t *clock, ztimer_t *timer)
 {
     bool was_removed = false;
@@ -157,8 +240,15 @@ bool ztimer_remove(ztimer_clock_t *clock, ztimer_t *timer)
 }
 
 uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
+{
+    return ztimer_set_slack(clock, timer, val, 0);
+}
+
+uint32_t ztimer_set_slack(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val,
+                          uint32_t slack)
 {
     unsigned state = irq_disable();
+    bool rearm;
 
 #if MODULE_ZTIMER_ONDEMAND
     /* warm up our clock ... */
@@ -191,11 +281,25 @@ uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
         val = 0;
     }
 
+#if MODULE_ZTIMER_SLACK
+    /* a timer due before the current alarm may require arming earlier */
+    uint32_t alarm = _first(clock) ? _alarm_offset(clock) : UINT32_MAX;
+
+    timer->base.slack = slack;
     timer->base.offset = val;
     _add_entry_to_list(clock, &timer->base);
-    if (clock->list.next == &timer->base) {
+    rearm = (_first(clock) == &timer->base) || (val < alarm);
+#else
+    (void)slack;
+    timer->base.offset = val;
+    _add_entry_to_list(clock, &timer->base);
+    rearm = (_first(clock) == &timer->base);
+#endif
+
+    if (rearm) {
+        val = _alarm_offset(clock);
 #ifdef MODULE_ZTIMER_EXTEND
-        if (clock->max_value < UINT32_MAX) {
+        if (_ztimer_is_extended(clock)) {
             val = _min_u32(val, clock->max_value >> 1);
         }
         DEBUG("ztimer_set(): %p setting %" PRIu32 "\n", (void *)clock, val);
@@ -221,6 +325,7 @@ uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
     return now;
 }
 
+#if !MODULE_ZTIMER_HEAP
 static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 {
     uint32_t delta_sum = 0;
@@ -259,6 +364,7 @@ static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
           entry->offset);
 
 }
+#endif /* !MODULE_ZTIMER_HEAP */
 
 static uint32_t _add_modulo(uint32_t a, uint32_t b, uint32_t mod)
 {
@@ -269,10 +375,10 @@ static uint32_t _add_modulo(uint32_t a, uint32_t b, uint32_t mod)
 }
 
 #ifdef MODULE_ZTIMER_EXTEND
-ztimer_now_t _ztimer_now_extend(ztimer_clock_t *clock)
+/* must be called with interrupts disabled */
+static uint32_t _now_extend(ztimer_clock_t *clock)
 {
     assert(clock->max_value);
-    unsigned state = irq_disable();
     uint32_t lower_now = clock->ops->now(clock);
 
     DEBUG(
@@ -280,17 +386,43 @@ ztimer_now_t _ztimer_now_extend(ztimer_clock_t *clock)
         " lower_now=%" PRIu32 " diff=%" PRIu32 "\n",
         (uint32_t)clock->checkpoint, clock->lower_last, lower_now,
         _add_modulo(lower_now, clock->lower_last, clock->max_value));
-    clock->checkpoint += _add_modulo(lower_now, clock->lower_last,
-                                     clock->max_value);
+    uint32_t diff = _add_modulo(lower_now, clock->lower_last, clock->max_value);
+
+    clock->checkpoint += diff;
+#if MODULE_ZTIMER_NOW64
+    if (clock->checkpoint < diff) {
+        clock->checkpoint_high++;
+    }
+#endif
     clock->lower_last = lower_now;
     DEBUG("ztimer_now() returning %" PRIu32 "\n", (uint32_t)clock->checkpoint);
-    ztimer_now_t now = clock->checkpoint;
+
+    return clock->checkpoint;
+}
+
+ztimer_now_t _ztimer_now_extend(ztimer_clock_t *clock)
+{
+    unsigned state = irq_disable();
+    ztimer_now_t now = _now_extend(clock);
+
+    irq_restore(state);
+    return now;
+}
+
+#if MODULE_ZTIMER_NOW64
+uint64_t ztimer_now64(ztimer_clock_t *clock)
+{
+    unsigned state = irq_disable();
+    uint32_t lower = _now_extend(clock);
+    uint64_t now = ((uint64_t)clock->checkpoint_high << 32) | lower;
 
     irq_restore(state);
     return now;
 }
+#endif
 #endif /* MODULE_ZTIMER_EXTEND */
 
+#if !MODULE_ZTIMER_HEAP
 static uint32_t _ztimer_update_head_offset(ztimer_clock_t *clock)
 {
     uint32_t old_base = clock->list.offset;
@@ -403,13 +535,235 @@ static ztimer_t *_now_next(ztimer_clock_t *clock)
     }
 }
 
+#else /* MODULE_ZTIMER_HEAP */
+
+static ztimer_base_t *_heap_meld(const ztimer_clock_t *clock,
+                                 ztimer_base_t *a, ztimer_base_t *b)
+{
+    if (!a) {
+        return b;
+    }
+    if (!b) {
+        return a;
+    }
+    if (_key(clock, b) < _key(clock, a)) {
+        ztimer_base_t *tmp = a;
+        a = b;
+        b = tmp;
+    }
+
+    /* make b the first child of a */
+    b->next = a->child;
+    if (b->next) {
+        b->next->prev = b;
+    }
+    b->prev = a;
+    a->child = b;
+
+    return a;
+}
+
+/* meld a list of sibling heaps into one (two-pass pairing) */
+static ztimer_base_t *_heap_merge_pairs(const ztimer_clock_t *clock,
+                                        ztimer_base_t *first)
+{
+    ztimer_base_t *pairs = NULL;
+    ztimer_base_t *root = NULL;
+
+    /* first pass: meld siblings pairwise from left to right, collecting the
+     * results on a stack linked through next */
+    while (first) {
+        ztimer_base_t *a = first;
+        ztimer_base_t *b = a->next;
+
+        first = b ? b->next : NULL;
+        a->next = NULL;
+        if (b) {
+            b->next = NULL;
+        }
+        a = _heap_meld(clock, a, b);
+        a->next = pairs;
+        pairs = a;
+    }
+
+    /* second pass: meld the pairs from right to left */
+    while (pairs) {
+        ztimer_base_t *a = pairs;
+
+        pairs = a->next;
+        a->next = NULL;
+        root = _heap_meld(clock, root, a);
+    }
+
+    return root;
+}
+
+static void _heap_set_root(ztimer_clock_t *clock, ztimer_base_t *root)
+{
+    clock->heap = root;
+    if (root) {
+        /* the root has no parent, prev only marks it as set */
+        root->prev = &clock->list;
+    }
+}
+
+static void _heap_remove(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    ztimer_base_t *children = _heap_merge_pairs(clock, entry->child);
+
+    if (entry == clock->heap) {
+        _heap_set_root(clock, children);
+    }
+    else {
+        /* unlink the entry from its parent's list of children */
+        if (entry->prev->child == entry) {
+            entry->prev->child = entry->next;
+        }
+        else {
+            entry->prev->next = entry->next;
+        }
+        if (entry->next) {
+            entry->next->prev = entry->prev;
+        }
+        _heap_set_root(clock, _heap_meld(clock, clock->heap, children));
+    }
+
+    entry->next = NULL;
+    entry->child = NULL;
+    entry->prev = NULL;
+}
+
+static void _due_append(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    entry->offset = 0;
+    entry->next = NULL;
+    entry->child = NULL;
+    entry->prev = &clock->list;
+    if (clock->last) {
+        clock->last->next = entry;
+    }
+    else {
+        clock->list.next = entry;
+    }
+    clock->last = entry;
+}
+
+static void _heap_expire(ztimer_clock_t *clock, uint32_t diff)
+{
+    /* move all timers due within diff ticks to the list, in target order */
+    while (clock->heap && (_key(clock, clock->heap) <= diff)) {
+        ztimer_base_t *entry = clock->heap;
+
+        _heap_remove(clock, entry);
+        _due_append(clock, entry);
+    }
+
+    clock->list.offset += diff;
+}
+
+static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+#if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND
+    /* First timer on the clock */
+    if (!_first(clock) &&
+        clock->block_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
+        pm_block(clock->block_pm_mode);
+    }
+#endif
+
+    if (entry->offset == 0) {
+        _due_append(clock, entry);
+    }
+    else {
+        entry->offset += clock->list.offset;
+        entry->next = NULL;
+        entry->child = NULL;
+        _heap_set_root(clock, _heap_meld(clock, clock->heap, entry));
+    }
+    DEBUG("_add_entry_to_list() %p target %" PRIu32 "\n", (void *)entry,
+          entry->offset);
+}
+
+static uint32_t _ztimer_update_head_offset(ztimer_clock_t *clock)
+{
+    uint32_t now = ztimer_now(clock);
+
+    DEBUG("clock %p: _ztimer_update_head_offset(): diff=%" PRIu32 "\n",
+          (void *)clock, now - clock->list.offset);
+    _heap_expire(clock, now - clock->list.offset);
+
+    return now;
+}
+
+static bool _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    DEBUG("_del_entry_from_list()\n");
+
+    assert(_is_set(clock, (ztimer_t *)entry));
+
+    if ((entry == clock->heap) || (entry->prev != &clock->list)) {
+        _heap_remove(clock, entry);
+    }
+    else {
+        ztimer_base_t *list = &clock->list;
+
+        while (list->next != entry) {
+            list = list->next;
+        }
+        if (entry == clock->last) {
+            clock->last = (list == &clock->list) ? NULL : list;
+        }
+        list->next = entry->next;
+        entry->next = NULL;
+        entry->prev = NULL;
+    }
+
+#if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND
+    /* The last timer just got removed from the clock */
+    if (!_first(clock) &&
+        clock->block_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
+        pm_unblock(clock->block_pm_mode);
+    }
+#endif
+
+    return true;
+}
+
+static ztimer_t *_now_next(ztimer_clock_t *clock)
+{
+    ztimer_base_t *entry = clock->list.next;
+
+    if (!entry) {
+        return NULL;
+    }
+
+    clock->list.next = entry->next;
+    if (!entry->next) {
+        clock->last = NULL;
+#if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND
+        /* The last timer just got removed from the clock */
+        if (!clock->heap &&
+            clock->block_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
+            pm_unblock(clock->block_pm_mode);
+        }
+#endif
+    }
+
+    /* reset prev pointer so ztimer_is_set() works */
+    entry->next = NULL;
+    entry->prev = NULL;
+
+    return (ztimer_t *)entry;
+}
+#endif /* MODULE_ZTIMER_HEAP */
+
 static void _ztimer_update(ztimer_clock_t *clock)
 {
 #ifdef MODULE_ZTIMER_EXTEND
-    if (clock->max_value < UINT32_MAX) {
-        if (clock->list.next) {
+    if (_ztimer_is_extended(clock)) {
+        if (_first(clock)) {
             clock->ops->set(clock,
-                            _min_u32(clock->list.next->offset,
+                            _min_u32(_alarm_offset(clock),
                                      clock->max_value >> 1));
         }
         else {
@@ -420,8 +774,8 @@ static void _ztimer_update(ztimer_clock_t *clock)
 #endif
     }
     else {
-        if (clock->list.next) {
-            clock->ops->set(clock, clock->list.next->offset);
+        if (_first(clock)) {
+            clock->ops->set(clock, _alarm_offset(clock));
         }
         else {
             clock->ops->cancel(clock);
@@ -429,7 +783,47 @@ static void _ztimer_update(ztimer_clock_t *clock)
     }
 }
 
+#if MODULE_ZTIMER_STATS
+static void _ztimer_handler(ztimer_clock_t *clock);
+
 void ztimer_handler(ztimer_clock_t *clock)
+{
+    uint32_t start = clock->ops->now(clock);
+
+    _ztimer_handler(clock);
+
+    uint32_t duration = clock->ops->now(clock) - start;
+#if MODULE_ZTIMER_EXTEND
+    /* the lower level timer may be narrower than 32 bit */
+    duration &= clock->max_value;
+#endif
+    clock->stats.isr_count++;
+    clock->stats.handler_sum += duration;
+    if (duration > clock->stats.handler_max) {
+        clock->stats.handler_max = duration;
+    }
+}
+
+void ztimer_stats_get(ztimer_clock_t *clock, ztimer_stats_t *stats)
+{
+    unsigned state = irq_disable();
+
+    *stats = clock->stats;
+    irq_restore(state);
+}
+
+void ztimer_stats_reset(ztimer_clock_t *clock)
+{
+    unsigned state = irq_disable();
+
+    memset(&clock->stats, 0, sizeof(clock->stats));
+    irq_restore(state);
+}
+
+static void _ztimer_handler(ztimer_clock_t *clock)
+#else
+void ztimer_handler(ztimer_clock_t *clock)
+#endif
 {
     bool no_clock_user_left = false;
 
@@ -440,12 +834,12 @@ void ztimer_handler(ztimer_clock_t *clock)
     }
 
 #if MODULE_ZTIMER_EXTEND
-    if (clock->max_value < UINT32_MAX) {
+    if (_ztimer_is_extended(clock)) {
         /* calling now triggers checkpointing */
         uint32_t now = ztimer_now(clock);
 
-        if (clock->list.next) {
-            uint32_t target = clock->list.offset + clock->list.next->offset;
+        if (_first(clock)) {
+            uint32_t target = clock->list.offset + _alarm_offset(clock);
             int32_t diff = (int32_t)(target - now);
             if (diff > 0) {
                 DEBUG("ztimer_handler(): %p postponing by %" PRIi32 "\n",
@@ -469,15 +863,22 @@ void ztimer_handler(ztimer_clock_t *clock)
     }
 #endif
 
-    if (clock->list.next) {
+    if (_first(clock)) {
+#if MODULE_ZTIMER_HEAP
+        _heap_expire(clock, _first_offset(clock));
+#else
         clock->list.offset += clock->list.next->offset;
         clock->list.next->offset = 0;
+#endif
 
         ztimer_t *entry = _now_next(clock);
         while (entry) {
             DEBUG("ztimer_handler(): trigger %p->%p at %" PRIu32 "\n",
                   (void *)entry, (void *)entry->base.next, clock->ops->now(
                       clock));
+#if MODULE_ZTIMER_STATS
+            clock->stats.triggered++;
+#endif
             entry->callback(entry->arg);
 #if MODULE_ZTIMER_ONDEMAND
             no_clock_user_left = ztimer_release(clock);
@@ -492,6 +893,11 @@ void ztimer_handler(ztimer_clock_t *clock)
                 _ztimer_update_head_offset(clock);
                 entry = _now_next(clock);
             }
+#if MODULE_ZTIMER_SLACK
+            if (entry) {
+                clock->coalesced++;
+            }
+#endif
         }
     }
 
@@ -511,6 +917,12 @@ void ztimer_handler(ztimer_clock_t *clock)
 
 static void _ztimer_print(const ztimer_clock_t *clock)
 {
+#if MODULE_ZTIMER_HEAP
+    if (clock->heap) {
+        printf("heap 0x%08" PRIxPTR ":%" PRIu32 " ", (uintptr_t)clock->heap,
+               _key(clock, clock->heap));
+    }
+#endif
     const ztimer_base_t *entry = &clock->list;
     uint32_t last_offset = 0;
 
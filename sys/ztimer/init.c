@@ -40,6 +40,7 @@
 #include "kernel_defines.h"
 
 #include "board.h"
+#include "periph/rtc_mem.h"
 #include "ztimer.h"
 #include "ztimer/convert_frac.h"
 #include "ztimer/convert_shift.h"
@@ -280,6 +281,59 @@ static void _ztimer_usec_overhead(unsigned samples, unsigned base, uint16_t *adj
     }
     *adjust_value = min;
 }
+
+#if IS_USED(MODULE_ZTIMER_AUTO_ADJUST_RTC_MEM)
+/* marks a valid record, "ZTAJ" */
+#define ZTIMER_AUTO_ADJUST_MAGIC    0x5a54414a
+
+typedef struct {
+    uint32_t magic;
+    uint16_t adjust_set;
+    uint16_t adjust_sleep;
+} _auto_adjust_record_t;
+
+static bool _ztimer_usec_adjust_restore(void)
+{
+    _auto_adjust_record_t rec;
+
+    if (rtc_mem_size() < CONFIG_ZTIMER_AUTO_ADJUST_RTC_MEM_OFFSET + sizeof(rec)) {
+        return false;
+    }
+    rtc_mem_read(CONFIG_ZTIMER_AUTO_ADJUST_RTC_MEM_OFFSET, &rec, sizeof(rec));
+    if (rec.magic != ZTIMER_AUTO_ADJUST_MAGIC) {
+        return false;
+    }
+
+    if (!CONFIG_ZTIMER_USEC_ADJUST_SET) {
+        ZTIMER_USEC->adjust_set = rec.adjust_set;
+    }
+    if (!CONFIG_ZTIMER_USEC_ADJUST_SLEEP) {
+        ZTIMER_USEC->adjust_sleep = rec.adjust_sleep;
+    }
+    LOG_DEBUG("ztimer_init(): ZTIMER_USEC restored adjust values from rtc_mem\n");
+    return true;
+}
+
+static void _ztimer_usec_adjust_store(void)
+{
+    _auto_adjust_record_t rec = {
+        .magic = ZTIMER_AUTO_ADJUST_MAGIC,
+        .adjust_set = ZTIMER_USEC->adjust_set,
+        .adjust_sleep = ZTIMER_USEC->adjust_sleep,
+    };
+
+    if (rtc_mem_size() >= CONFIG_ZTIMER_AUTO_ADJUST_RTC_MEM_OFFSET + sizeof(rec)) {
+        rtc_mem_write(CONFIG_ZTIMER_AUTO_ADJUST_RTC_MEM_OFFSET, &rec, sizeof(rec));
+    }
+}
+#else
+static inline bool _ztimer_usec_adjust_restore(void)
+{
+    return false;
+}
+
+static inline void _ztimer_usec_adjust_store(void) {}
+#endif
 #endif
 
 void ztimer_init(void)
@@ -351,9 +405,15 @@ void ztimer_init(void)
     LOG_DEBUG("ztimer_init(): ZTIMER_USEC without conversion\n");
 #  endif
 
+    /* values measured on an earlier boot are reused, if stored */
+    bool auto_adjust = IS_USED(MODULE_ZTIMER_AUTO_ADJUST) &&
+                       !(CONFIG_ZTIMER_USEC_ADJUST_SET && CONFIG_ZTIMER_USEC_ADJUST_SLEEP);
+    if (auto_adjust && _ztimer_usec_adjust_restore()) {
+        auto_adjust = false;
+    }
+
     /* warm-up time if set and needed */
-    if (IS_USED(MODULE_ZTIMER_AUTO_ADJUST) &&
-        !(CONFIG_ZTIMER_USEC_ADJUST_SET && CONFIG_ZTIMER_USEC_ADJUST_SLEEP)) {
+    if (auto_adjust) {
         if (CONFIG_ZTIMER_AUTO_ADJUST_SETTLE) {
             ztimer_sleep(ZTIMER_USEC, CONFIG_ZTIMER_AUTO_ADJUST_SETTLE);
         }
@@ -370,7 +430,7 @@ void ztimer_init(void)
     if (CONFIG_ZTIMER_USEC_ADJUST_SET) {
         ZTIMER_USEC->adjust_set = CONFIG_ZTIMER_USEC_ADJUST_SET;
     }
-    else if (IS_USED(MODULE_ZTIMER_AUTO_ADJUST)) {
+    else if (auto_adjust) {
         _ztimer_usec_overhead(CONFIG_ZTIMER_AUTO_ADJUST_ITER, CONFIG_ZTIMER_AUTO_ADJUST_BASE_ITVL,
                               &ZTIMER_USEC->adjust_set, ztimer_overhead_set);
     }
@@ -383,7 +443,7 @@ void ztimer_init(void)
     if (CONFIG_ZTIMER_USEC_ADJUST_SLEEP) {
         ZTIMER_USEC->adjust_sleep = CONFIG_ZTIMER_USEC_ADJUST_SLEEP;
     }
-    else if (IS_USED(MODULE_ZTIMER_AUTO_ADJUST)) {
+    else if (auto_adjust) {
         _ztimer_usec_overhead(CONFIG_ZTIMER_AUTO_ADJUST_ITER,
                               CONFIG_ZTIMER_AUTO_ADJUST_BASE_ITVL, &ZTIMER_USEC->adjust_sleep,
                               ztimer_overhead_sleep);
@@ -393,6 +453,10 @@ void ztimer_init(void)
         LOG_DEBUG("ztimer_init(): ZTIMER_USEC setting adjust_sleep value to %i\n",
                   ZTIMER_USEC->adjust_sleep);
     }
+
+    if (auto_adjust) {
+        _ztimer_usec_adjust_store();
+    }
 #endif
 
 #if MODULE_ZTIMER_MSEC
@@ -24,6 +24,7 @@
 #include <stdint.h>
 #include <inttypes.h>
 #include "assert.h"
+#include "kernel_defines.h"
 #include "ztimer/mock.h"
 
 #define ENABLE_DEBUG 0
@@ -167,7 +168,7 @@ void ztimer_mock_init(ztimer_mock_t *self, unsigned width)
 
     DEBUG("zmock_init: %p width=%u mask=0x%08" PRIx32 " running=%u\n", (void *)self, width,
           self->mask, self->running);
-    if (max_value < UINT32_MAX) {
+    if ((max_value < UINT32_MAX) || IS_USED(MODULE_ZTIMER_NOW64)) {
         self->super.ops->set(&self->super, self->super.max_value >> 1);
     }
 }
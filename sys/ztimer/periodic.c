@@ -21,8 +21,12 @@
  */
 
 #include <errno.h>
+#include <inttypes.h>
 #include <stdio.h>
+#include <string.h>
 
+#include "bitarithm.h"
+#include "irq.h"
 #include "ztimer.h"
 #include "ztimer/periodic.h"
 
@@ -32,7 +36,18 @@ static void _ztimer_periodic_reset(ztimer_periodic_t *timer, ztimer_now_t now)
     ztimer_now_t offset = target - now;
 
     if (offset > timer->interval) {
-        offset = 0;
+        /* the target has already passed */
+        if (timer->skip_overruns) {
+            uint32_t missed = (now - target) / timer->interval + 1;
+
+            timer->overruns += missed;
+            target += missed * timer->interval;
+            offset = target - now;
+        }
+        else {
+            timer->overruns++;
+            offset = 0;
+        }
     }
 
     timer->last = target;
@@ -40,10 +55,33 @@ static void _ztimer_periodic_reset(ztimer_periodic_t *timer, ztimer_now_t now)
     ztimer_set(timer->clock, &timer->timer, offset);
 }
 
+#if MODULE_ZTIMER_PERIODIC_JITTER
+static void _jitter_record(ztimer_periodic_t *timer, ztimer_now_t now)
+{
+    int32_t latency = now - timer->last;
+    unsigned bucket = 0;
+
+    if (latency > 0) {
+        bucket = bitarithm_msb(latency) + 1;
+        if (bucket >= CONFIG_ZTIMER_PERIODIC_JITTER_BUCKETS) {
+            bucket = CONFIG_ZTIMER_PERIODIC_JITTER_BUCKETS - 1;
+        }
+        if ((uint32_t)latency > timer->jitter.max) {
+            timer->jitter.max = latency;
+        }
+    }
+    timer->jitter.buckets[bucket]++;
+}
+#endif
+
 static void _ztimer_periodic_callback(void *arg)
 {
     ztimer_periodic_t *timer = arg;
 
+#if MODULE_ZTIMER_PERIODIC_JITTER
+    _jitter_record(timer, ztimer_now(timer->clock));
+#endif
+
     if (timer->callback(timer->arg) == ZTIMER_PERIODIC_KEEP_GOING) {
         ztimer_now_t now = ztimer_now(timer->clock);
         _ztimer_periodic_reset(timer, now);
@@ -79,3 +117,39 @@ void ztimer_periodic_stop(ztimer_periodic_t *timer)
 {
     ztimer_remove(timer->clock, &timer->timer);
 }
+
+#if MODULE_ZTIMER_PERIODIC_JITTER
+void ztimer_periodic_jitter_print(const ztimer_periodic_t *timer)
+{
+    ztimer_periodic_jitter_t jitter;
+    unsigned state = irq_disable();
+
+    jitter = timer->jitter;
+    irq_restore(state);
+
+    printf("latency [ticks]      count\n");
+    for (unsigned i = 0; i < CONFIG_ZTIMER_PERIODIC_JITTER_BUCKETS; i++) {
+        uint32_t low = i ? (1UL << (i - 1)) : 0;
+
+        if (i == CONFIG_ZTIMER_PERIODIC_JITTER_BUCKETS - 1) {
+            printf("%10" PRIu32 " -       %10" PRIu32 "\n", low,
+                   jitter.buckets[i]);
+        }
+        else {
+            uint32_t high = i ? (1UL << i) - 1 : 0;
+            printf("%10" PRIu32 " - %5" PRIu32 " %10" PRIu32 "\n", low, high,
+                   jitter.buckets[i]);
+        }
+    }
+    printf("max latency: %" PRIu32 ", overruns: %" PRIu32 "\n", jitter.max,
+           timer->overruns);
+}
+
+void ztimer_periodic_jitter_reset(ztimer_periodic_t *timer)
+{
+    unsigned state = irq_disable();
+
+    memset(&timer->jitter, 0, sizeof(timer->jitter));
+    irq_restore(state);
+}
+#endif
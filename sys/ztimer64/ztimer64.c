@@ -165,6 +165,10 @@ static int _del_entry_from_list(ztimer64_clock_t *clock, ztimer64_base_t *entry)
 
 uint64_t ztimer64_now(ztimer64_clock_t *clock)
 {
+#if MODULE_ZTIMER_NOW64
+    /* the base clock keeps track of the upper 32 bits itself */
+    return ztimer_now64(clock->base_clock);
+#else
     uint64_t now;
     unsigned state = irq_disable();
     uint32_t base_now = ztimer_now(clock->base_clock);
@@ -191,17 +195,29 @@ uint64_t ztimer64_now(ztimer64_clock_t *clock)
 
     irq_restore(state);
     return now;
+#endif
 }
 
 static void _ztimer64_update(ztimer64_clock_t *clock)
 {
     uint64_t now = ztimer64_now(clock);
-    uint64_t next_checkpoint = clock->checkpoint + ZTIMER64_CHECKPOINT_INTERVAL;
     uint64_t target;
 
+#if MODULE_ZTIMER_NOW64
+    /* no checkpointing needed, the base timer is only used for timers */
+    uint64_t next_checkpoint = now + ZTIMER64_CHECKPOINT_INTERVAL;
+
+    if (!clock->first) {
+        ztimer_remove(clock->base_clock, &clock->base_timer);
+        return;
+    }
+#else
+    uint64_t next_checkpoint = clock->checkpoint + ZTIMER64_CHECKPOINT_INTERVAL;
+
     if (next_checkpoint < now) {
         next_checkpoint = now;
     }
+#endif
 
     if (!clock->first) {
         target = next_checkpoint;
@@ -267,8 +283,13 @@ void ztimer64_clock_init(ztimer64_clock_t *clock, ztimer_clock_t *base_clock)
                             .base_timer =
                             { .callback = ztimer64_handler, .arg = clock } };
 
+#if MODULE_ZTIMER_NOW64
+    /* the base clock must keep running for ztimer64_now() */
+    ztimer_acquire(base_clock);
+#else
     /* initialize checkpointing */
     _ztimer64_update(clock);
+#endif
 }
 
 #if MODULE_ZTIMER64_USEC
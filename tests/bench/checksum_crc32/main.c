@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput of the CRC-32 implementation
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "checksum/crc32.h"
+#include "macros/utils.h"
+#include "test_utils/expect.h"
+#include "time_units.h"
+#include "ztimer.h"
+
+#ifndef SIZE
+#define SIZE            (1024U) /**< bytes per checksum */
+#endif
+
+#ifndef RUNS
+#define RUNS            (256U)  /**< checksums per measurement */
+#endif
+
+static uint8_t _buf[SIZE];
+
+int main(void)
+{
+    volatile uint32_t crc = 0;
+
+    for (unsigned i = 0; i < SIZE; i++) {
+        _buf[i] = i * 7;
+    }
+
+    puts("CRC-32 benchmark.");
+    printf("%u runs over %u bytes\n", RUNS, SIZE);
+
+    /* checksum in odd sized chunks, starting at odd addresses */
+    uint32_t single = crc32(_buf, SIZE);
+    uint32_t chunked = 0;
+    for (unsigned pos = 0; pos < SIZE; pos += 13) {
+        chunked = crc32_update(chunked, _buf + pos, MIN(13U, SIZE - pos));
+    }
+    expect(single == chunked);
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < RUNS; i++) {
+        crc = crc32(_buf, SIZE);
+    }
+    uint32_t time = ztimer_now(ZTIMER_USEC) - start;
+
+    expect(crc == single);
+    printf("crc32: %" PRIu32 " us, %" PRIu32 " KiB/s\n", time,
+           (uint32_t)((uint64_t)SIZE * RUNS * US_PER_SEC / 1024 / time));
+    puts("TEST PASSED");
+    return 0;
+}
@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       evtimer add / del benchmark application
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "test_utils/expect.h"
+
+#include "evtimer.h"
+#include "ztimer.h"
+
+#ifndef NUMOF_EVENTS
+#define NUMOF_EVENTS    (1000U)
+#endif
+
+#ifndef REPEAT
+#define REPEAT          (1000U)
+#endif
+
+#ifndef BASE
+#define BASE            (1000000LU)
+#endif
+
+static evtimer_t _evtimer;
+static evtimer_event_t _events[NUMOF_EVENTS];
+
+/* set by any event that actually triggers, which none is supposed to */
+static unsigned _triggers;
+
+static void _callback(evtimer_event_t *event)
+{
+    (void)event;
+    _triggers++;
+}
+
+/* maps 0..numof-1 onto a permutation of itself, as 7919 is a prime not
+ * dividing NUMOF_EVENTS */
+static unsigned _scrambled(unsigned n, unsigned numof)
+{
+    return (n * 7919UL) % numof;
+}
+
+static void _add(unsigned n)
+{
+    _events[n].offset = BASE + n;
+    evtimer_add(&_evtimer, &_events[n]);
+}
+
+static void _print_result(const char *desc, unsigned n, uint32_t total)
+{
+    printf("%30s %8"PRIu32" / %u = %"PRIu32"\n", desc, total, n, total/n);
+}
+
+int main(void)
+{
+    puts("evtimer benchmark application.\n");
+
+    unsigned n;
+    uint32_t before, diff;
+
+    evtimer_init(&_evtimer, _callback);
+
+    /*
+     * test adding NUMOF_EVENTS events in scrambled order
+     *
+     */
+    before = ztimer_now(ZTIMER_USEC);
+    for (n = 0; n < NUMOF_EVENTS; n++) {
+        _add(_scrambled(n, NUMOF_EVENTS));
+    }
+
+    diff = ztimer_now(ZTIMER_USEC) - before;
+
+    _print_result("add() scrambled", NUMOF_EVENTS, diff);
+    expect(!_triggers);
+
+    /*
+     * test rescheduling one of NUMOF_EVENTS events REPEAT times
+     *
+     */
+    before = ztimer_now(ZTIMER_USEC);
+    for (n = 0; n < REPEAT; n++) {
+        unsigned idx = _scrambled(n, NUMOF_EVENTS);
+
+        evtimer_del(&_evtimer, &_events[idx]);
+        _add(idx);
+    }
+
+    diff = ztimer_now(ZTIMER_USEC) - before;
+
+    _print_result("del() + add()", REPEAT, diff);
+    expect(!_triggers);
+
+    /*
+     * test removing NUMOF_EVENTS events in scrambled order
+     *
+     */
+    before = ztimer_now(ZTIMER_USEC);
+    for (n = 0; n < NUMOF_EVENTS; n++) {
+        evtimer_del(&_evtimer, &_events[_scrambled(n, NUMOF_EVENTS)]);
+    }
+
+    diff = ztimer_now(ZTIMER_USEC) - before;
+
+    _print_result("del() scrambled", NUMOF_EVENTS, diff);
+    expect(!_triggers);
+    expect(!evtimer_iter(&_evtimer, NULL));
+
+    puts("done.");
+
+    return 0;
+}
@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Requests over CoAP over UDP vs. CoAP over TCP with gcoap
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "mutex.h"
+#include "net/gcoap.h"
+#include "net/ipv6/addr.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#ifndef NUM_REQS
+#define NUM_REQS        (64U)   /**< requests per run */
+#endif
+
+#ifndef WINDOW
+#define WINDOW          (4U)    /**< requests in flight at a time */
+#endif
+
+static ssize_t _hello_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                              coap_request_ctx_t *ctx)
+{
+    (void)ctx;
+    gcoap_resp_init(pdu, buf, len, COAP_CODE_CONTENT);
+    size_t resp_len = coap_opt_finish(pdu, COAP_OPT_FINISH_PAYLOAD);
+    memcpy(pdu->payload, "hello", 5);
+    return resp_len + 5;
+}
+
+static const coap_resource_t _resources[] = {
+    { "/hello", COAP_GET, _hello_handler, NULL },
+};
+
+static gcoap_listener_t _listener = {
+    .resources = _resources,
+    .resources_len = ARRAY_SIZE(_resources),
+};
+
+static mutex_t _done = MUTEX_INIT_LOCKED;
+static unsigned _pending;
+static unsigned _failed;
+
+static void _resp_handler(const gcoap_request_memo_t *memo, coap_pkt_t *pdu,
+                          const sock_udp_ep_t *remote)
+{
+    (void)remote;
+    if ((memo->state != GCOAP_MEMO_RESP) ||
+        (coap_get_code_raw(pdu) != COAP_CODE_CONTENT) ||
+        (pdu->payload_len != 5)) {
+        _failed++;
+    }
+    if (--_pending == 0) {
+        mutex_unlock(&_done);
+    }
+}
+
+static void _run(const char *name, const sock_udp_ep_t *remote,
+                 gcoap_socket_type_t tl_type)
+{
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+    coap_pkt_t pdu;
+
+    _failed = 0;
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned sent = 0; sent < NUM_REQS; sent += WINDOW) {
+        _pending = WINDOW;
+        for (unsigned i = 0; i < WINDOW; i++) {
+            gcoap_req_init(&pdu, buf, sizeof(buf), COAP_METHOD_GET, "/hello");
+            coap_hdr_set_type(pdu.hdr, COAP_TYPE_CON);
+            ssize_t len = coap_opt_finish(&pdu, COAP_OPT_FINISH_NONE);
+            expect(gcoap_req_send(buf, len, remote, NULL, _resp_handler, NULL,
+                                  tl_type) > 0);
+        }
+        mutex_lock(&_done);
+    }
+    uint32_t time = ztimer_now(ZTIMER_USEC) - start;
+
+    expect(_failed == 0);
+    printf("%s: %u requests in %6" PRIu32 " us, %4" PRIu32 " us per request\n",
+           name, NUM_REQS, time, time / NUM_REQS);
+}
+
+int main(void)
+{
+    sock_udp_ep_t remote = { .family = AF_INET6 };
+
+    memcpy(remote.addr.ipv6, &ipv6_addr_loopback, sizeof(remote.addr.ipv6));
+    gcoap_register_listener(&_listener);
+
+    puts("gcoap CoAP over TCP benchmark.");
+    printf("%u requests in windows of %u\n", NUM_REQS, WINDOW);
+    remote.port = CONFIG_GCOAP_PORT;
+    _run("UDP", &remote, GCOAP_SOCKET_TYPE_UDP);
+    remote.port = CONFIG_GCOAP_TCP_PORT;
+    _run("TCP", &remote, GCOAP_SOCKET_TYPE_TCP);
+    puts("TEST PASSED");
+    return 0;
+}
@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Latency of fast gcoap requests while a slow handler runs,
+ *              in the gcoap thread vs. in a worker thread
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/gcoap.h"
+#include "net/ipv6/addr.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#ifndef SLOW_MS
+#define SLOW_MS         (200U)  /**< time the slow handler blocks */
+#endif
+
+#ifndef NUM_FAST
+#define NUM_FAST        (20U)   /**< fast requests per run */
+#endif
+
+#ifndef GAP_MS
+#define GAP_MS          (10U)   /**< pause between fast requests */
+#endif
+
+#define TOKEN_SLOW      (0xff)
+
+static ssize_t _fast_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                             coap_request_ctx_t *ctx)
+{
+    (void)ctx;
+    return gcoap_response(pdu, buf, len, COAP_CODE_CONTENT);
+}
+
+static ssize_t _slow_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                             coap_request_ctx_t *ctx)
+{
+    (void)ctx;
+    /* e.g. a flash read or a sensor on a slow bus */
+    ztimer_sleep(ZTIMER_MSEC, SLOW_MS);
+    return gcoap_response(pdu, buf, len, COAP_CODE_CONTENT);
+}
+
+static const coap_resource_t _resources[] = {
+    { "/fast", COAP_GET, _fast_handler, NULL },
+    { "/slow", COAP_GET | COAP_HANDLER_SLOW, _slow_handler, NULL },
+    { "/slow-inline", COAP_GET, _slow_handler, NULL },
+};
+
+static gcoap_listener_t _listener = {
+    .resources = _resources,
+    .resources_len = ARRAY_SIZE(_resources),
+};
+
+static sock_udp_t _sock;
+static sock_udp_ep_t _remote = { .family = AF_INET6, .port = CONFIG_GCOAP_PORT };
+
+static void _send(const char *path, uint8_t token)
+{
+    uint8_t buf[32];
+    uint8_t *pos = buf;
+
+    pos += coap_build_hdr((coap_hdr_t *)buf, COAP_TYPE_NON, &token, 1,
+                          COAP_METHOD_GET, token);
+    pos += coap_opt_put_uri_pathquery(pos, NULL, path);
+    expect(sock_udp_send(&_sock, buf, pos - buf, &_remote) > 0);
+}
+
+/* waits for the response to token, notes the one to the slow request */
+static void _wait_for(uint8_t token, bool *slow_done)
+{
+    uint8_t buf[64];
+
+    while (1) {
+        ssize_t res = sock_udp_recv(&_sock, buf, sizeof(buf),
+                                    2 * SLOW_MS * US_PER_MS, NULL);
+        coap_pkt_t pkt;
+
+        expect(res > 0);
+        expect(coap_parse(&pkt, buf, res) == 0);
+        expect(coap_get_code_raw(&pkt) == COAP_CODE_CONTENT);
+
+        const uint8_t *tkn = coap_get_token(&pkt);
+        if (*tkn == TOKEN_SLOW) {
+            *slow_done = true;
+        }
+        if (*tkn == token) {
+            return;
+        }
+    }
+}
+
+static void _run(const char *name, const char *slow_path)
+{
+    bool slow_done = (slow_path == NULL);
+    uint32_t sum = 0;
+    uint32_t max = 0;
+
+    if (slow_path != NULL) {
+        _send(slow_path, TOKEN_SLOW);
+    }
+    for (unsigned i = 0; i < NUM_FAST; i++) {
+        uint32_t start = ztimer_now(ZTIMER_USEC);
+
+        _send("/fast", i);
+        _wait_for(i, &slow_done);
+
+        uint32_t latency = ztimer_now(ZTIMER_USEC) - start;
+        sum += latency;
+        if (latency > max) {
+            max = latency;
+        }
+        ztimer_sleep(ZTIMER_MSEC, GAP_MS);
+    }
+    if (!slow_done) {
+        _wait_for(TOKEN_SLOW, &slow_done);
+    }
+    printf("%s: mean %7" PRIu32 " us, max %7" PRIu32 " us\n",
+           name, sum / NUM_FAST, max);
+}
+
+int main(void)
+{
+    sock_udp_ep_t local = { .family = AF_INET6 };
+
+    memcpy(_remote.addr.ipv6, &ipv6_addr_loopback, sizeof(_remote.addr.ipv6));
+    gcoap_register_listener(&_listener);
+    expect(sock_udp_create(&_sock, &local, NULL, 0) == 0);
+
+    puts("gcoap worker pool benchmark.");
+    printf("slow handler %u ms, %u fast requests %u ms apart\n",
+           SLOW_MS, NUM_FAST, GAP_MS);
+    _run("no slow request", NULL);
+    _run("slow handler in gcoap thread", "/slow-inline");
+    _run("slow handler in worker", "/slow");
+    puts("TEST PASSED");
+    return 0;
+}
@@ -0,0 +1,22 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2024 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("gcoap worker pool benchmark.\r\n")
+    child.expect(r"slow handler \d+ ms, \d+ fast requests \d+ ms apart\r\n")
+    for _ in range(3):
+        child.expect(r"[a-z ]+: mean\s+\d+ us, max\s+\d+ us\r\n")
+    child.expect_exact("TEST PASSED")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Forwarding table lookup benchmark
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "net/gnrc/ipv6/nib/ft.h"
+#include "net/ipv6/addr.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#ifndef REPEAT
+#define REPEAT              (10000U)
+#endif
+
+#define IFACE               (1U)
+
+/* 2001:db8::/32, a /48 route per subnet ID is added within */
+static const ipv6_addr_t _pfx = { .u8 = { 0x20, 0x01, 0x0d, 0xb8 } };
+static const ipv6_addr_t _next_hop = {
+    .u8 = { 0xfe, 0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1 }
+};
+static const unsigned _routes[] = { 16, 128, 512 };
+
+static void _subnet(ipv6_addr_t *addr, unsigned id)
+{
+    *addr = _pfx;
+    addr->u8[4] = id >> 8;
+    addr->u8[5] = id & 0xff;
+}
+
+static void _print_result(unsigned routes, uint32_t total)
+{
+    printf("%4u routes %8" PRIu32 " us / %u = %" PRIu32 " ns per lookup\n",
+           routes, total, REPEAT,
+           (uint32_t)(((uint64_t)total * 1000) / REPEAT));
+}
+
+int main(void)
+{
+    unsigned added = 0;
+
+    puts("gnrc_ipv6_nib forwarding table benchmark.\n");
+    printf("trie: %u\n", (unsigned)IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE));
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_routes); i++) {
+        if (_routes[i] > CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF) {
+            break;
+        }
+        for (; added < _routes[i]; added++) {
+            ipv6_addr_t dst;
+
+            _subnet(&dst, added);
+            expect(gnrc_ipv6_nib_ft_add(&dst, 48, &_next_hop, IFACE, 0) == 0);
+        }
+
+        /* hit the routes in an order unrelated to the one they were added in */
+        uint32_t before = ztimer_now(ZTIMER_USEC);
+
+        for (unsigned n = 0; n < REPEAT; n++) {
+            gnrc_ipv6_nib_ft_t fte;
+            ipv6_addr_t dst;
+
+            _subnet(&dst, (n * 7919U) % added);
+            dst.u8[15] = 1;
+            expect(gnrc_ipv6_nib_ft_get(&dst, NULL, &fte) == 0);
+        }
+
+        uint32_t total = ztimer_now(ZTIMER_USEC) - before;
+
+        _print_result(added, total);
+    }
+
+    puts("TEST PASSED");
+
+    return 0;
+}
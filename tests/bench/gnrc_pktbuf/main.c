@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       gnrc_pktbuf add / release benchmark application
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "test_utils/expect.h"
+
+#include "net/gnrc/pktbuf.h"
+#include "ztimer.h"
+
+#ifndef NUMOF_PKTS
+#define NUMOF_PKTS      (8U)
+#endif
+
+#ifndef REPEAT
+#define REPEAT          (10000U)
+#endif
+
+/* size of the header snip of each packet */
+#define HDR_SIZE        (40U)
+
+/* largest payload */
+#define PAYLOAD_MAX     (1280U - HDR_SIZE)
+
+static gnrc_pktsnip_t *_pkts[NUMOF_PKTS];
+
+static uint32_t _seed = 1;
+
+/* deterministic, so all backends see the same workload */
+static uint32_t _rand(void)
+{
+    _seed = _seed * 1103515245 + 12345;
+    return _seed >> 8;
+}
+
+/* the operations take less than a microsecond on fast CPUs, so print the
+ * total in us and the average in ns */
+static void _print_result(const char *desc, unsigned n, uint32_t total)
+{
+    printf("%30s %8"PRIu32" us / %u = %"PRIu32" ns\n", desc, total, n,
+           (uint32_t)(((uint64_t)total * 1000) / n));
+}
+
+static gnrc_pktsnip_t *_add(void)
+{
+    /* three out of four payloads are small headers or fragments */
+    size_t size = (_rand() % 4) ? 8 + _rand() % 120
+                                : 1 + _rand() % PAYLOAD_MAX;
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, size, GNRC_NETTYPE_UNDEF);
+
+    if (pkt == NULL) {
+        return NULL;
+    }
+    if ((size > 8) && (_rand() % 2) &&
+        !gnrc_pktbuf_mark(pkt, 8, GNRC_NETTYPE_UNDEF)) {
+        gnrc_pktbuf_release(pkt);
+        return NULL;
+    }
+
+    gnrc_pktsnip_t *hdr = gnrc_pktbuf_add(pkt, NULL, HDR_SIZE, GNRC_NETTYPE_UNDEF);
+
+    if (hdr == NULL) {
+        gnrc_pktbuf_release(pkt);
+    }
+    return hdr;
+}
+
+int main(void)
+{
+    puts("gnrc_pktbuf benchmark application.\n");
+
+    unsigned adds = 0, releases = 0, fails = 0;
+    uint32_t add_time = 0, release_time = 0, add_max = 0;
+
+    for (unsigned n = 0; n < REPEAT; n++) {
+        unsigned slot = _rand() % NUMOF_PKTS;
+        uint32_t before = ztimer_now(ZTIMER_USEC);
+
+        if (_pkts[slot]) {
+            gnrc_pktbuf_release(_pkts[slot]);
+            _pkts[slot] = NULL;
+            release_time += ztimer_now(ZTIMER_USEC) - before;
+            releases++;
+        }
+        else {
+            _pkts[slot] = _add();
+
+            uint32_t diff = ztimer_now(ZTIMER_USEC) - before;
+
+            add_time += diff;
+            if (diff > add_max) {
+                add_max = diff;
+            }
+            adds++;
+            if (_pkts[slot] == NULL) {
+                fails++;
+            }
+        }
+    }
+
+    for (unsigned n = 0; n < NUMOF_PKTS; n++) {
+        gnrc_pktbuf_release(_pkts[n]);
+    }
+
+    _print_result("add() + mark() + add()", adds, add_time);
+    _print_result("release()", releases, release_time);
+    printf("%30s %8"PRIu32" us\n", "slowest add()", add_max);
+    printf("failed allocations: %u\n", fails);
+
+#if defined(DEVELHELP) && defined(MODULE_GNRC_PKTBUF_POOL)
+    gnrc_pktbuf_stats();
+#endif
+
+    puts("done.");
+
+    return 0;
+}
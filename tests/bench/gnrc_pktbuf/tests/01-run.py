@@ -0,0 +1,24 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2024 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("gnrc_pktbuf benchmark application.\r\n")
+    for i in range(2):
+        child.expect(r"\s+[\w() _\+]+\s+\d+ us / \d+ = \d+ ns\r\n")
+    child.expect(r"\s+slowest add\(\)\s+\d+ us\r\n")
+    child.expect(r"failed allocations: \d+\r\n")
+
+    child.expect_exact("done.\r\n")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,190 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       IPHC header compression benchmark
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6/hdr.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/netif/ieee802154.h"
+#include "net/gnrc/sixlowpan/ctx.h"
+#include "net/gnrc/udp.h"
+#include "net/netdev_test.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#ifndef REPEAT
+#define REPEAT              (10000U)
+#endif
+
+#define TEST_PORT           (61617U)    /* compressible to 4 bits */
+#define CTX_LTIME_MIN       (60U)
+
+static const uint8_t _local_eui64[] = {
+    0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x01
+};
+/* 2001:db8::/64, registered as context 0 */
+static const ipv6_addr_t _pfx = { .u8 = { 0x20, 0x01, 0x0d, 0xb8 } };
+static const unsigned _flows[] = { 1, 4 };
+static const char _payload[] = "0123456789abcdef";
+
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static gnrc_netif_t _netif;
+static netdev_test_t _dev;
+static unsigned _frames;
+
+/* the IID of the destination is its EUI-64 with the U/L bit flipped */
+static void _remote_eui64(uint8_t *eui64, unsigned flow)
+{
+    memcpy(eui64, _local_eui64, sizeof(_local_eui64));
+    eui64[7] = flow + 2;
+}
+
+static void _addr(ipv6_addr_t *addr, const uint8_t *eui64)
+{
+    *addr = _pfx;
+    memcpy(&addr->u8[8], eui64, sizeof(_local_eui64));
+    addr->u8[8] ^= 0x02;
+}
+
+static void _send(unsigned flow)
+{
+    gnrc_pktsnip_t *pkt;
+    ipv6_addr_t src, dst;
+    uint8_t dst_l2addr[sizeof(_local_eui64)];
+
+    _remote_eui64(dst_l2addr, flow);
+    _addr(&src, _local_eui64);
+    _addr(&dst, dst_l2addr);
+    pkt = gnrc_pktbuf_add(NULL, _payload, sizeof(_payload),
+                          GNRC_NETTYPE_UNDEF);
+    expect(pkt != NULL);
+    pkt = gnrc_udp_hdr_build(pkt, TEST_PORT, TEST_PORT);
+    expect(pkt != NULL);
+    pkt = gnrc_ipv6_hdr_build(pkt, &src, &dst);
+    expect(pkt != NULL);
+    ((ipv6_hdr_t *)pkt->data)->nh = PROTNUM_UDP;
+    ((ipv6_hdr_t *)pkt->data)->hl = 64;
+    pkt = gnrc_pkt_prepend(pkt, gnrc_netif_hdr_build(NULL, 0, dst_l2addr,
+                                                     sizeof(dst_l2addr)));
+    expect(pkt->type == GNRC_NETTYPE_NETIF);
+    gnrc_netif_hdr_set_netif(pkt->data, &_netif);
+    /* the 6LoWPAN and interface threads have a higher priority, so the frame
+     * was handed to the device when this returns */
+    expect(gnrc_netapi_dispatch_send(GNRC_NETTYPE_SIXLOWPAN,
+                                     GNRC_NETREG_DEMUX_CTX_ALL, pkt) == 1);
+}
+
+static void _print_result(unsigned flows, uint32_t total)
+{
+    printf("%4u flows %8" PRIu32 " us / %u = %" PRIu32 " ns per frame\n",
+           flows, total, REPEAT,
+           (uint32_t)(((uint64_t)total * 1000) / REPEAT));
+}
+
+static int _dev_send(netdev_t *dev, const iolist_t *iolist)
+{
+    int len = 0;
+
+    (void)dev;
+    for (; iolist; iolist = iolist->iol_next) {
+        len += iolist->iol_len;
+    }
+    _frames++;
+    return len;
+}
+
+static int _dev_get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_IEEE802154;
+    return sizeof(uint16_t);
+}
+
+static int _dev_get_proto(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(gnrc_nettype_t));
+    *((gnrc_nettype_t *)value) = GNRC_NETTYPE_SIXLOWPAN;
+    return sizeof(gnrc_nettype_t);
+}
+
+static int _dev_get_max_pdu_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = 102;
+    return sizeof(uint16_t);
+}
+
+static int _dev_get_src_len(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = sizeof(_local_eui64);
+    return sizeof(uint16_t);
+}
+
+static int _dev_get_addr_long(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len >= sizeof(_local_eui64));
+    memcpy(value, _local_eui64, sizeof(_local_eui64));
+    return sizeof(_local_eui64);
+}
+
+int main(void)
+{
+    puts("gnrc_sixlowpan_iphc benchmark.\n");
+    printf("cache: %u\n", (unsigned)CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_NUMOF);
+
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_send_cb(&_dev, _dev_send);
+    netdev_test_set_get_cb(&_dev, NETOPT_DEVICE_TYPE, _dev_get_device_type);
+    netdev_test_set_get_cb(&_dev, NETOPT_PROTO, _dev_get_proto);
+    netdev_test_set_get_cb(&_dev, NETOPT_MAX_PDU_SIZE, _dev_get_max_pdu_size);
+    netdev_test_set_get_cb(&_dev, NETOPT_SRC_LEN, _dev_get_src_len);
+    netdev_test_set_get_cb(&_dev, NETOPT_ADDRESS_LONG, _dev_get_addr_long);
+    expect(gnrc_netif_ieee802154_create(&_netif, _netif_stack,
+                                        sizeof(_netif_stack), GNRC_NETIF_PRIO,
+                                        "netdev_test", &_dev.netdev.netdev) == 0);
+    expect(gnrc_sixlowpan_ctx_update(0, &_pfx, 64, CTX_LTIME_MIN, true) != NULL);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_flows); i++) {
+        unsigned frames = _frames;
+        uint32_t before = ztimer_now(ZTIMER_USEC);
+
+        for (unsigned n = 0; n < REPEAT; n++) {
+            _send(n % _flows[i]);
+        }
+
+        uint32_t total = ztimer_now(ZTIMER_USEC) - before;
+
+        expect((_frames - frames) == REPEAT);
+        _print_result(_flows[i], total);
+    }
+
+    puts("TEST PASSED");
+
+    return 0;
+}
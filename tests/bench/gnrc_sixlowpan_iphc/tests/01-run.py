@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2024 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("gnrc_sixlowpan_iphc benchmark.\r\n")
+    child.expect(r"cache: \d+\r\n")
+    child.expect(r"\s*\d+ flows\s+\d+ us / \d+ = \d+ ns per frame\r\n")
+    child.expect_exact("TEST PASSED")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,313 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure interrupt latency and the latency of waking up a
+ *              thread from an interrupt
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "event.h"
+#include "irq.h"
+#include "msg.h"
+#include "mutex.h"
+#include "periph/timer.h"
+#include "thread.h"
+#include "thread_flags.h"
+
+#if IRQ_SOURCE_GPIO
+#include "periph/gpio.h"
+#include "periph/gpio_ll.h"
+#endif
+
+#if IS_USED(MODULE_DBGPIN)
+#include "dbgpin.h"
+#define PIN_ISR(x)      ((x) ? dbgpin_set(0) : dbgpin_clear(0))
+#define PIN_THREAD(x)   ((x) ? dbgpin_set(1) : dbgpin_clear(1))
+#else
+#define PIN_ISR(x)      (void)(x)
+#define PIN_THREAD(x)   (void)(x)
+#endif
+
+#ifndef TIMER
+#define TIMER           (0)
+#endif
+
+#ifndef TIMER_FREQ
+#define TIMER_FREQ      (1000000LU)
+#endif
+
+/**
+ * @brief   Mask applied to timer differences, e.g. 0xffff for 16 bit timers
+ */
+#ifndef TIMER_MASK
+#define TIMER_MASK      (UINT32_MAX)
+#endif
+
+#ifndef ROUNDS
+#define ROUNDS          (1000U)
+#endif
+
+/**
+ * @brief   Timer ticks between arming the timer and the interrupt
+ */
+#ifndef DELAY_TICKS
+#define DELAY_TICKS     (TIMER_FREQ / 1000)
+#endif
+
+/**
+ * @brief   Number of histogram buckets, latencies beyond the last bucket are
+ *          counted in the last one
+ */
+#ifndef HIST_NUMOF
+#define HIST_NUMOF      (32U)
+#endif
+
+/**
+ * @brief   Width of a histogram bucket in timer ticks
+ */
+#ifndef HIST_WIDTH
+#define HIST_WIDTH      (1U)
+#endif
+
+#define DEV             TIMER_DEV(TIMER)
+/* THREAD_FLAG_EVENT is used by the event queue */
+#define FLAG_WAKEUP     (0x2)
+
+typedef enum {
+    SCENARIO_ISR,
+    SCENARIO_THREAD_FLAGS,
+    SCENARIO_MSG,
+    SCENARIO_EVENT,
+    SCENARIO_NUMOF,
+} scenario_t;
+
+static const char *_names[SCENARIO_NUMOF] = {
+    [SCENARIO_ISR] = "isr",
+    [SCENARIO_THREAD_FLAGS] = "thread_flags",
+    [SCENARIO_MSG] = "msg",
+    [SCENARIO_EVENT] = "event",
+};
+
+typedef struct {
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+    uint32_t hist[HIST_NUMOF];
+} stats_t;
+
+static stats_t _stats;
+static scenario_t _scenario;
+static volatile uint32_t _start;
+static mutex_t _done = MUTEX_INIT_LOCKED;
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static thread_t *_thread;
+static kernel_pid_t _pid;
+static event_queue_t _queue;
+
+#if IRQ_SOURCE_GPIO
+static gpio_port_t _stimulus_port;
+static uword_t _stimulus_mask;
+#endif
+
+static void _record(void)
+{
+    uint32_t latency = (timer_read(DEV) - _start) & TIMER_MASK;
+    unsigned bucket = latency / HIST_WIDTH;
+
+    if (latency < _stats.min) {
+        _stats.min = latency;
+    }
+    if (latency > _stats.max) {
+        _stats.max = latency;
+    }
+    _stats.sum += latency;
+    _stats.hist[bucket < HIST_NUMOF ? bucket : HIST_NUMOF - 1]++;
+}
+
+static void _woken_up(void)
+{
+    PIN_THREAD(1);
+    _record();
+    PIN_THREAD(0);
+    mutex_unlock(&_done);
+}
+
+static void _event_handler(event_t *event)
+{
+    (void)event;
+    _woken_up();
+}
+
+static event_t _event = { .handler = _event_handler };
+
+static void _isr(void)
+{
+    static msg_t msg;
+
+    PIN_ISR(1);
+#if IRQ_SOURCE_GPIO
+    gpio_ll_clear(_stimulus_port, _stimulus_mask);
+#endif
+    switch (_scenario) {
+    case SCENARIO_ISR:
+        _record();
+        mutex_unlock(&_done);
+        break;
+    case SCENARIO_THREAD_FLAGS:
+        thread_flags_set(_thread, FLAG_WAKEUP);
+        break;
+    case SCENARIO_MSG:
+        msg_send_int(&msg, _pid);
+        break;
+    case SCENARIO_EVENT:
+        event_post(&_queue, &_event);
+        break;
+    default:
+        break;
+    }
+    PIN_ISR(0);
+}
+
+#if IRQ_SOURCE_GPIO
+static void _gpio_cb(void *arg)
+{
+    (void)arg;
+    _isr();
+}
+#endif
+
+static void _timer_cb(void *arg, int channel)
+{
+    (void)arg;
+    (void)channel;
+#if !IRQ_SOURCE_GPIO
+    _isr();
+#endif
+}
+
+static void *_thread_func(void *arg)
+{
+    (void)arg;
+    msg_t msg;
+
+    event_queue_claim(&_queue);
+    while (1) {
+        /* woken up by main when a scenario starts */
+        thread_sleep();
+
+        for (unsigned i = 0; i < ROUNDS; i++) {
+            switch (_scenario) {
+            case SCENARIO_THREAD_FLAGS:
+                thread_flags_wait_any(FLAG_WAKEUP);
+                _woken_up();
+                break;
+            case SCENARIO_MSG:
+                msg_receive(&msg);
+                _woken_up();
+                break;
+            case SCENARIO_EVENT: {
+                event_t *event = event_wait(&_queue);
+                /* the handler records the latency */
+                event->handler(event);
+                break;
+            }
+            default:
+                break;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+static void _trigger(void)
+{
+#if IRQ_SOURCE_GPIO
+    unsigned state = irq_disable();
+    _start = timer_read(DEV);
+    gpio_ll_set(_stimulus_port, _stimulus_mask);
+    irq_restore(state);
+#else
+    _start = timer_read(DEV) + DELAY_TICKS;
+    timer_set_absolute(DEV, 0, _start & TIMER_MASK);
+#endif
+}
+
+static void _print(scenario_t scenario)
+{
+    printf("{ \"scenario\" : \"%s\", \"board\" : \"%s\", "
+           "\"freq\" : %" PRIu32 ", \"rounds\" : %u, "
+           "\"min\" : %" PRIu32 ", \"avg\" : %" PRIu32 ", \"max\" : %" PRIu32
+           ", \"width\" : %u, \"hist\" : [",
+           _names[scenario], RIOT_BOARD, (uint32_t)TIMER_FREQ, ROUNDS,
+           _stats.min, (uint32_t)(_stats.sum / ROUNDS), _stats.max,
+           HIST_WIDTH);
+    for (unsigned i = 0; i < HIST_NUMOF; i++) {
+        printf("%s%" PRIu32, i ? ", " : "", _stats.hist[i]);
+    }
+    puts("] }");
+}
+
+int main(void)
+{
+    puts("irq_latency starting");
+
+    if (timer_init(DEV, TIMER_FREQ, _timer_cb, NULL) != 0) {
+        puts("error: timer_init() failed");
+        return 1;
+    }
+
+#if IRQ_SOURCE_GPIO
+    _stimulus_port = gpio_get_port(STIMULUS_PIN);
+    _stimulus_mask = 1U << gpio_get_pin_num(STIMULUS_PIN);
+    gpio_ll_init(_stimulus_port, gpio_get_pin_num(STIMULUS_PIN), gpio_ll_out);
+    gpio_ll_clear(_stimulus_port, _stimulus_mask);
+    if (gpio_init_int(CAPTURE_PIN, GPIO_IN, GPIO_RISING, _gpio_cb, NULL) != 0) {
+        puts("error: gpio_init_int() failed");
+        return 1;
+    }
+#endif
+
+    event_queue_init_detached(&_queue);
+    _pid = thread_create(_stack, sizeof(_stack), THREAD_PRIORITY_MAIN - 1,
+                         THREAD_CREATE_WOUT_YIELD, _thread_func, NULL,
+                         "irq_latency");
+    _thread = thread_get(_pid);
+
+    for (scenario_t s = 0; s < SCENARIO_NUMOF; s++) {
+        _stats = (stats_t){ .min = UINT32_MAX };
+        _scenario = s;
+        if (s != SCENARIO_ISR) {
+            /* let the thread wait in the way required by the scenario */
+            thread_wakeup(_pid);
+        }
+
+        for (unsigned i = 0; i < ROUNDS; i++) {
+            _trigger();
+            /* main sleeps until the round is complete, so the interrupt
+             * hits the idle thread (or the CPU in a low power mode) */
+            mutex_lock(&_done);
+        }
+        _print(s);
+    }
+
+    return 0;
+}
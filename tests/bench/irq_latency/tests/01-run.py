@@ -0,0 +1,22 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2024 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for scenario in ("isr", "thread_flags", "msg", "event"):
+        child.expect(r"{ \"scenario\" : \"%s\", \"board\" : \"[^\"]+\", "
+                     r"\"freq\" : \d+, \"rounds\" : \d+, \"min\" : \d+, "
+                     r"\"avg\" : \d+, \"max\" : \d+, \"width\" : \d+, "
+                     r"\"hist\" : \[[\d, ]+\] }" % scenario)
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure messages send per second using batched msg API
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include "timex.h"
+#include "thread.h"
+
+#include "msg.h"
+#include "ztimer.h"
+
+#ifndef TEST_DURATION_US
+#define TEST_DURATION_US    (1000000U)
+#endif
+
+#ifndef MAX_BATCH_SIZE
+#define MAX_BATCH_SIZE      (32U)
+#endif
+
+static char _stack[THREAD_STACKSIZE_MAIN];
+static msg_t _queue[MAX_BATCH_SIZE];
+
+static void _timer_callback(void *_flag)
+{
+    atomic_flag *flag = _flag;
+    atomic_flag_clear(flag);
+}
+
+static void *_second_thread(void *arg)
+{
+    (void)arg;
+    msg_t test[MAX_BATCH_SIZE];
+
+    msg_init_queue(_queue, MAX_BATCH_SIZE);
+
+    while (1) {
+        msg_receive_batch(test, MAX_BATCH_SIZE);
+    }
+
+    return NULL;
+}
+
+static uint32_t _run(kernel_pid_t other, unsigned batch)
+{
+    atomic_flag flag = ATOMIC_FLAG_INIT;
+    uint32_t n = 0;
+    msg_t test[MAX_BATCH_SIZE];
+
+    ztimer_t timer = {
+        .callback = _timer_callback,
+        .arg = &flag,
+    };
+
+    atomic_flag_test_and_set(&flag);
+    ztimer_set(ZTIMER_USEC, &timer, TEST_DURATION_US);
+
+    while (atomic_flag_test_and_set(&flag)) {
+        n += msg_send_batch(test, batch, other);
+    }
+
+    return n;
+}
+
+int main(void)
+{
+    puts("main starting");
+
+    kernel_pid_t other = thread_create(_stack,
+                                       sizeof(_stack),
+                                       (THREAD_PRIORITY_MAIN - 1),
+                                       0,
+                                       _second_thread,
+                                       NULL,
+                                       "second_thread");
+
+    for (unsigned batch = 1; batch <= MAX_BATCH_SIZE; batch *= 2) {
+        uint32_t n = _run(other, batch);
+
+        printf("{ \"batch\" : %u, \"result\" : %" PRIu32, batch, n);
+        printf(", \"msgs_per_sec\" : %" PRIu32 " }\n",
+               (uint32_t)(((uint64_t)n * US_PER_SEC) / TEST_DURATION_US));
+    }
+
+    puts("DONE");
+
+    return 0;
+}
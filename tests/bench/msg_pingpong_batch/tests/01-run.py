@@ -0,0 +1,24 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2024 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    batch = 1
+    while batch <= 32:
+        child.expect(r"{ \"batch\" : (\d+), \"result\" : \d+, "
+                     r"\"msgs_per_sec\" : \d+ }")
+        assert int(child.match.group(1)) == batch
+        batch *= 2
+    child.expect_exact("DONE")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Erase stalls of mtd_flashpage, with and without deferred erase
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "kernel_defines.h"
+#include "macros/utils.h"
+#include "mtd_flashpage.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#ifndef ROUNDS
+#define ROUNDS          (64U)       /**< erase and write cycles */
+#endif
+
+#ifndef IDLE_US
+#define IDLE_US         (50000U)    /**< idle time between cycles */
+#endif
+
+#ifndef TIMER_US
+#define TIMER_US        (1000U)     /**< period of the timer interrupt */
+#endif
+
+/* the last page may hold the interrupt vectors on MSP430 */
+#ifdef __MSP430__
+#define PAGE            (FLASHPAGE_NUMOF - 2)
+#else
+#define PAGE            (FLASHPAGE_NUMOF - 1)
+#endif
+
+static mtd_flashpage_t _dev = MTD_FLASHPAGE_INIT_VAL(1);
+static mtd_dev_t *dev = &_dev.base;
+
+static ztimer_t _timer;
+static uint32_t _target;
+static uint32_t _latency;
+static uint8_t _buf[64];
+
+static void _timer_cb(void *arg)
+{
+    (void)arg;
+
+    uint32_t now = ztimer_now(ZTIMER_USEC);
+    _latency = MAX(_latency, now - _target);
+
+    _target = now + TIMER_US;
+    ztimer_set(ZTIMER_USEC, &_timer, TIMER_US);
+}
+
+int main(void)
+{
+    uint32_t erase_max = 0;
+    uint32_t write_max = 0;
+
+    puts("mtd_flashpage erase benchmark.");
+    printf("%u rounds, deferred erase: %s\n", ROUNDS,
+           IS_USED(MODULE_MTD_FLASHPAGE_DEFERRED_ERASE) ? "yes" : "no");
+
+    expect(mtd_init(dev) == 0);
+
+    _timer.callback = _timer_cb;
+    _target = ztimer_now(ZTIMER_USEC) + TIMER_US;
+    ztimer_set(ZTIMER_USEC, &_timer, TIMER_US);
+
+    expect(mtd_erase_sector(dev, PAGE, 1) == 0);
+    ztimer_sleep(ZTIMER_USEC, IDLE_US);
+
+    for (unsigned i = 0; i < ROUNDS; i++) {
+        memset(_buf, i, sizeof(_buf));
+
+        uint32_t start = ztimer_now(ZTIMER_USEC);
+        expect(mtd_write_page_raw(dev, _buf, PAGE, 0, sizeof(_buf)) == 0);
+        uint32_t written = ztimer_now(ZTIMER_USEC);
+        expect(memcmp(flashpage_addr(PAGE), _buf, sizeof(_buf)) == 0);
+
+        /* the page is erased while the system is idle */
+        expect(mtd_erase_sector(dev, PAGE, 1) == 0);
+        uint32_t erased = ztimer_now(ZTIMER_USEC);
+        ztimer_sleep(ZTIMER_USEC, IDLE_US);
+
+        write_max = MAX(write_max, written - start);
+        erase_max = MAX(erase_max, erased - written);
+    }
+
+    ztimer_remove(ZTIMER_USEC, &_timer);
+
+    printf("erase: %" PRIu32 " us max\n", erase_max);
+    printf("write: %" PRIu32 " us max\n", write_max);
+    printf("timer latency: %" PRIu32 " us max\n", _latency);
+    puts("TEST PASSED");
+    return 0;
+}
@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure worst-case wakeup latency on a contended mutex
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "mutex.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef ROUNDS
+#define ROUNDS          (100U)
+#endif
+
+#ifndef HOLD_TIME_US
+#define HOLD_TIME_US    (200U)
+#endif
+
+#ifndef BUSY_TIME_US
+#define BUSY_TIME_US    (2000U)
+#endif
+
+static mutex_t _res = MUTEX_INIT;
+
+static char _stack_low[THREAD_STACKSIZE_DEFAULT];
+static char _stack_mid[THREAD_STACKSIZE_DEFAULT];
+static char _stack_high[THREAD_STACKSIZE_DEFAULT];
+
+static kernel_pid_t _pid_mid;
+static kernel_pid_t _pid_high;
+
+static uint32_t _min = UINT32_MAX;
+static uint32_t _max;
+static uint64_t _sum;
+
+static void *_low(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        thread_sleep();
+        mutex_lock(&_res);
+        /* high priority thread will block on the mutex right away */
+        thread_wakeup(_pid_high);
+        /* without priority inheritance, mid will preempt us here */
+        thread_wakeup(_pid_mid);
+        ztimer_spin(ZTIMER_USEC, HOLD_TIME_US);
+        mutex_unlock(&_res);
+    }
+
+    return NULL;
+}
+
+static void *_mid(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        thread_sleep();
+        ztimer_spin(ZTIMER_USEC, BUSY_TIME_US);
+    }
+
+    return NULL;
+}
+
+static void *_high(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        thread_sleep();
+        uint32_t start = ztimer_now(ZTIMER_USEC);
+        mutex_lock(&_res);
+        uint32_t latency = ztimer_now(ZTIMER_USEC) - start;
+        mutex_unlock(&_res);
+
+        _sum += latency;
+        if (latency < _min) {
+            _min = latency;
+        }
+        if (latency > _max) {
+            _max = latency;
+        }
+    }
+
+    return NULL;
+}
+
+int main(void)
+{
+    puts("main starting");
+
+    kernel_pid_t pid_low = thread_create(_stack_low, sizeof(_stack_low),
+                                         THREAD_PRIORITY_MAIN - 1,
+                                         THREAD_CREATE_WOUT_YIELD,
+                                         _low, NULL, "low");
+    _pid_mid = thread_create(_stack_mid, sizeof(_stack_mid),
+                             THREAD_PRIORITY_MAIN - 2,
+                             THREAD_CREATE_WOUT_YIELD,
+                             _mid, NULL, "mid");
+    _pid_high = thread_create(_stack_high, sizeof(_stack_high),
+                              THREAD_PRIORITY_MAIN - 3,
+                              THREAD_CREATE_WOUT_YIELD,
+                              _high, NULL, "high");
+
+    /* let all threads run until they go to sleep */
+    thread_yield_higher();
+
+    for (unsigned i = 0; i < ROUNDS; i++) {
+        /* All threads have higher priority than main, so a round is
+         * complete once main runs again */
+        thread_wakeup(pid_low);
+    }
+
+    printf("{ \"pi\" : %u, \"min\" : %" PRIu32 ", \"avg\" : %" PRIu32
+           ", \"max\" : %" PRIu32 " }\n",
+           (unsigned)IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE),
+           _min, (uint32_t)(_sum / ROUNDS), _max);
+
+    return 0;
+}
@@ -23,6 +23,7 @@
 #include "macros/units.h"
 #include "clk.h"
 #include "mutex.h"
+#include "rmutex.h"
 #include "thread.h"
 #include "xtimer.h"
 
@@ -33,6 +34,8 @@
 volatile unsigned _flag = 0;
 static char _stack[THREAD_STACKSIZE_MAIN];
 static mutex_t _mutex = MUTEX_INIT;
+static mutex_t _mutex_uncontended = MUTEX_INIT;
+static rmutex_t _rmutex = RMUTEX_INIT;
 
 static void _timer_callback(void*arg)
 {
@@ -52,10 +55,60 @@ static void *_second_thread(void *arg)
     return NULL;
 }
 
+static void _print_result(const char *variant, uint32_t n)
+{
+    printf("{ \"variant\" : \"%s\", \"result\" : %"PRIu32, variant, n);
+    printf(", \"ticks\" : %"PRIu32,
+           (uint32_t)((TEST_DURATION/US_PER_MS) * (coreclk()/KHZ(1)))/n);
+    puts(" }");
+}
+
+static void _run_uncontended(xtimer_t *timer)
+{
+    uint32_t n = 0;
+
+    _flag = 0;
+    xtimer_set(timer, TEST_DURATION);
+    while (!_flag) {
+        mutex_lock(&_mutex_uncontended);
+        mutex_unlock(&_mutex_uncontended);
+        n++;
+    }
+    _print_result("mutex_uncontended", n);
+
+    n = 0;
+    _flag = 0;
+    xtimer_set(timer, TEST_DURATION);
+    while (!_flag) {
+        rmutex_lock(&_rmutex);
+        rmutex_unlock(&_rmutex);
+        n++;
+    }
+    _print_result("rmutex_uncontended", n);
+
+    /* the outer lock is held, so this only measures relocking */
+    n = 0;
+    _flag = 0;
+    rmutex_lock(&_rmutex);
+    xtimer_set(timer, TEST_DURATION);
+    while (!_flag) {
+        rmutex_lock(&_rmutex);
+        rmutex_unlock(&_rmutex);
+        n++;
+    }
+    rmutex_unlock(&_rmutex);
+    _print_result("rmutex_recursive", n);
+}
+
 int main(void)
 {
     printf("main starting\n");
 
+    xtimer_t timer;
+    timer.callback = _timer_callback;
+
+    _run_uncontended(&timer);
+
     thread_create(_stack,
                   sizeof(_stack),
                   THREAD_PRIORITY_MAIN - 1,
@@ -68,21 +121,16 @@ int main(void)
     mutex_lock(&_mutex);
     thread_yield_higher();
 
-    xtimer_t timer;
-    timer.callback = _timer_callback;
-
     uint32_t n = 0;
 
+    _flag = 0;
     xtimer_set(&timer, TEST_DURATION);
     while(!_flag) {
         mutex_unlock(&_mutex);
         n++;
     }
 
-    printf("{ \"result\" : %"PRIu32, n);
-    printf(", \"ticks\" : %"PRIu32,
-           (uint32_t)((TEST_DURATION/US_PER_MS) * (coreclk()/KHZ(1)))/n);
-    puts(" }");
+    _print_result("contended", n);
 
     return 0;
 }
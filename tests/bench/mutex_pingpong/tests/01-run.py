@@ -12,7 +12,10 @@ from testrunner import run
 
 
 def testfunc(child):
-    child.expect(r"{ \"result\" : \d+(, \"ticks\" : \d+)? }")
+    for variant in ("mutex_uncontended", "rmutex_uncontended",
+                    "rmutex_recursive", "contended"):
+        child.expect(r"{{ \"variant\" : \"{}\", \"result\" : \d+"
+                     r"(, \"ticks\" : \d+)? }}".format(variant))
 
 
 if __name__ == "__main__":
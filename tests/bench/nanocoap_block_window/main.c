@@ -0,0 +1,208 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput of block-wise GET requests, stop-and-wait vs.
+ *              several requests in flight
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/ipv6/addr.h"
+#include "net/nanocoap_sock.h"
+#include "random.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef SIZE
+#define SIZE            (4096U) /**< size of the resource */
+#endif
+
+#ifndef RTT_MS
+#define RTT_MS          (50U)   /**< emulated round-trip time */
+#endif
+
+#ifndef BLKSIZE
+#define BLKSIZE         COAP_BLOCKSIZE_64
+#endif
+
+#define PORT            (5683U)
+#define QUEUE_LEN       (16U)   /**< responses held back by the server */
+#define WINDOW_MAX      (8U)
+#define SEED            (0x5eed)
+
+/* a response held back by the server */
+typedef struct {
+    sock_udp_ep_t remote;
+    uint32_t due;
+    uint16_t len;
+    uint8_t buf[32 + coap_szx2size(BLKSIZE)];
+} _resp_t;
+
+typedef struct {
+    unsigned window;
+    uint8_t type;
+    unsigned loss;
+} _run_t;
+
+static const _run_t _runs[] = {
+    { .window = 1, .type = COAP_TYPE_CON, .loss = 0 },
+    { .window = 4, .type = COAP_TYPE_CON, .loss = 0 },
+    { .window = 8, .type = COAP_TYPE_CON, .loss = 0 },
+    { .window = 8, .type = COAP_TYPE_NON, .loss = 0 },
+    { .window = 1, .type = COAP_TYPE_CON, .loss = 5 },
+    { .window = 8, .type = COAP_TYPE_CON, .loss = 5 },
+};
+
+static char _server_stack[THREAD_STACKSIZE_DEFAULT];
+static _resp_t _queue[QUEUE_LEN];
+static unsigned _queue_len;
+static uint16_t _server_id;
+static unsigned _loss_pct;
+static size_t _received;
+static uint8_t _reorder_buf[NANOCOAP_SOCK_BLOCK_WINDOW_BUF_SIZE(WINDOW_MAX, BLKSIZE)];
+
+static uint8_t _content(size_t offset)
+{
+    return (offset * 7) ^ (offset >> 8);
+}
+
+static size_t _build_resp(uint8_t *buf, coap_pkt_t *req)
+{
+    coap_block1_t block2;
+    uint8_t type = COAP_TYPE_NON;
+    uint16_t id = _server_id++;
+    uint8_t *pos = buf;
+
+    if (!coap_get_block2(req, &block2)) {
+        block2.blknum = 0;
+        block2.szx = BLKSIZE;
+    }
+    if (block2.szx > BLKSIZE) {
+        block2.szx = BLKSIZE;
+    }
+    if (coap_get_type(req) == COAP_TYPE_CON) {
+        type = COAP_TYPE_ACK;
+        id = coap_get_id(req);
+    }
+
+    size_t offset = block2.blknum * coap_szx2size(block2.szx);
+    size_t len = (offset < SIZE) ? MIN(coap_szx2size(block2.szx), SIZE - offset) : 0;
+    bool more = (offset + len) < SIZE;
+
+    pos += coap_build_hdr((coap_hdr_t *)buf, type, coap_get_token(req),
+                          coap_get_token_len(req), COAP_CODE_CONTENT, id);
+    pos += coap_opt_put_uint(pos, 0, COAP_OPT_BLOCK2,
+                             (block2.blknum << 4) | (more << 3) | block2.szx);
+    *pos++ = 0xff;
+    for (size_t i = 0; i < len; i++) {
+        *pos++ = _content(offset + i);
+    }
+    return pos - buf;
+}
+
+static void *_server(void *arg)
+{
+    (void)arg;
+    sock_udp_ep_t local = { .family = AF_INET6, .port = PORT };
+    uint8_t buf[64];
+    sock_udp_t sock;
+
+    expect(sock_udp_create(&sock, &local, NULL, 0) == 0);
+    while (1) {
+        uint32_t now = ztimer_now(ZTIMER_MSEC);
+        uint32_t timeout = SOCK_NO_TIMEOUT;
+        sock_udp_ep_t remote;
+        coap_pkt_t pkt;
+
+        /* send the responses that are due, the queue is in order */
+        while ((_queue_len > 0) && ((int32_t)(_queue[0].due - now) <= 0)) {
+            sock_udp_send(&sock, _queue[0].buf, _queue[0].len, &_queue[0].remote);
+            memmove(&_queue[0], &_queue[1], --_queue_len * sizeof(_queue[0]));
+        }
+        if (_queue_len > 0) {
+            timeout = (_queue[0].due - now) * US_PER_MS;
+        }
+
+        ssize_t res = sock_udp_recv(&sock, buf, sizeof(buf), timeout, &remote);
+        if ((res <= 0) || (coap_parse(&pkt, buf, res) < 0) ||
+            (_queue_len == QUEUE_LEN) ||
+            (random_uint32_range(0, 100) < _loss_pct)) {
+            continue;
+        }
+
+        _resp_t *resp = &_queue[_queue_len++];
+        resp->remote = remote;
+        resp->due = ztimer_now(ZTIMER_MSEC) + RTT_MS;
+        resp->len = _build_resp(resp->buf, &pkt);
+    }
+    return NULL;
+}
+
+static int _sink(void *arg, size_t offset, uint8_t *buf, size_t len, int more)
+{
+    (void)arg;
+    (void)more;
+
+    /* the blocks have to arrive in order */
+    expect(offset == _received);
+    for (size_t i = 0; i < len; i++) {
+        expect(buf[i] == _content(offset + i));
+    }
+    _received += len;
+    return 0;
+}
+
+int main(void)
+{
+    sock_udp_ep_t remote = { .family = AF_INET6, .port = PORT };
+    nanocoap_sock_t sock;
+
+    memcpy(remote.addr.ipv6, &ipv6_addr_loopback, sizeof(remote.addr.ipv6));
+    random_init(SEED);
+    thread_create(_server_stack, sizeof(_server_stack), THREAD_PRIORITY_MAIN - 1,
+                  0, _server, NULL, "server");
+    expect(nanocoap_sock_connect(&sock, NULL, &remote) == 0);
+
+    puts("nanocoap block-wise window benchmark.");
+    printf("%u bytes in blocks of %u bytes, %u ms round-trip time\n",
+           SIZE, coap_szx2size(BLKSIZE), RTT_MS);
+    for (unsigned i = 0; i < ARRAY_SIZE(_runs); i++) {
+        const _run_t *run = &_runs[i];
+
+        _loss_pct = run->loss;
+        _received = 0;
+
+        uint32_t start = ztimer_now(ZTIMER_MSEC);
+        int res = nanocoap_sock_get_blockwise_window(&sock, "/res", BLKSIZE,
+                                                     run->window, run->type,
+                                                     _reorder_buf, _sink, NULL);
+        uint32_t time = ztimer_now(ZTIMER_MSEC) - start;
+
+        expect(res == 0);
+        expect(_received == SIZE);
+        printf("loss %2u%%, window %u %s: %6" PRIu32 " ms, %6" PRIu32 " byte/s\n",
+               run->loss, run->window,
+               (run->type == COAP_TYPE_CON) ? "CON" : "NON",
+               time, (uint32_t)(SIZE * MS_PER_SEC / time));
+    }
+    nanocoap_sock_close(&sock);
+    puts("TEST PASSED");
+    return 0;
+}
@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       File system reads of the nanocoap file server for block-wise
+ *              downloads, with and without read-ahead
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "mutex.h"
+#include "net/ipv6/addr.h"
+#include "net/nanocoap/fileserver.h"
+#include "net/nanocoap_sock.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "vfs.h"
+#include "vfs_default.h"
+#include "ztimer.h"
+
+#ifndef SIZE
+#define SIZE            (8192U) /**< size of the file */
+#endif
+
+#ifndef BLKSIZE
+#define BLKSIZE         COAP_BLOCKSIZE_64
+#endif
+
+#define FILE_NAME       "blob"
+#define PORT            (5683U)
+
+NANOCOAP_RESOURCE(files) {
+    .path = "/files",
+    .methods = COAP_GET | COAP_MATCH_SUBTREE,
+    .handler = nanocoap_fileserver_handler,
+    .context = VFS_DEFAULT_DATA,
+};
+
+typedef struct {
+    size_t received;
+    uint32_t time;
+    mutex_t done;
+} _client_t;
+
+static char _client_stack[THREAD_STACKSIZE_DEFAULT];
+static sock_udp_ep_t _remote = { .family = AF_INET6, .port = PORT };
+static unsigned _reads;
+
+ssize_t __real_vfs_read(int fd, void *dest, size_t count);
+
+ssize_t __wrap_vfs_read(int fd, void *dest, size_t count)
+{
+    _reads++;
+    return __real_vfs_read(fd, dest, count);
+}
+
+static uint8_t _content(size_t offset)
+{
+    return (offset * 7) ^ (offset >> 8);
+}
+
+static void _write_file(void)
+{
+    uint8_t buf[64];
+    int fd = vfs_open(VFS_DEFAULT_DATA "/" FILE_NAME, O_CREAT | O_TRUNC | O_WRONLY, 0);
+
+    expect(fd >= 0);
+    for (size_t offset = 0; offset < SIZE; offset += sizeof(buf)) {
+        for (size_t i = 0; i < sizeof(buf); i++) {
+            buf[i] = _content(offset + i);
+        }
+        expect(vfs_write(fd, buf, MIN(sizeof(buf), SIZE - offset)) > 0);
+    }
+    vfs_close(fd);
+}
+
+static int _sink(void *arg, size_t offset, uint8_t *buf, size_t len, int more)
+{
+    _client_t *client = arg;
+    (void)more;
+
+    expect(offset == client->received);
+    for (size_t i = 0; i < len; i++) {
+        expect(buf[i] == _content(offset + i));
+    }
+    client->received += len;
+    return 0;
+}
+
+static void _download(_client_t *client)
+{
+    nanocoap_sock_t sock;
+    uint32_t start = ztimer_now(ZTIMER_MSEC);
+
+    client->received = 0;
+    expect(nanocoap_sock_connect(&sock, NULL, &_remote) == 0);
+    expect(nanocoap_sock_get_blockwise(&sock, "/files/" FILE_NAME, BLKSIZE,
+                                       _sink, client) == 0);
+    nanocoap_sock_close(&sock);
+    expect(client->received == SIZE);
+    client->time = ztimer_now(ZTIMER_MSEC) - start;
+}
+
+static void *_client_thread(void *arg)
+{
+    _client_t *client = arg;
+
+    _download(client);
+    mutex_unlock(&client->done);
+    return NULL;
+}
+
+int main(void)
+{
+    sock_udp_ep_t local = { .family = AF_INET6, .port = PORT };
+    _client_t clients[2];
+
+    memcpy(_remote.addr.ipv6, &ipv6_addr_loopback, sizeof(_remote.addr.ipv6));
+    _write_file();
+    expect(nanocoap_server_start(&local) > 0);
+
+    puts("nanocoap file server benchmark.");
+    printf("%u bytes in blocks of %u bytes, read-ahead %s\n",
+           SIZE, coap_szx2size(BLKSIZE),
+           IS_USED(MODULE_NANOCOAP_FILESERVER_READAHEAD) ? "on" : "off");
+
+    _reads = 0;
+    _download(&clients[0]);
+    printf("1 client:  %5" PRIu32 " ms, %4u reads\n", clients[0].time, _reads);
+
+    _reads = 0;
+    clients[1].done = (mutex_t)MUTEX_INIT_LOCKED;
+    thread_create(_client_stack, sizeof(_client_stack), THREAD_PRIORITY_MAIN,
+                  0, _client_thread, &clients[1], "client");
+    _download(&clients[0]);
+    mutex_lock(&clients[1].done);
+    printf("2 clients: %5" PRIu32 " ms, %5" PRIu32 " ms, %4u reads\n",
+           clients[0].time, clients[1].time, _reads);
+
+    puts("TEST PASSED");
+    return 0;
+}
@@ -0,0 +1,22 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2024 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("nanocoap file server benchmark.\r\n")
+    child.expect(r"\d+ bytes in blocks of \d+ bytes, read-ahead (on|off)\r\n")
+    child.expect(r"1 client:\s+\d+ ms,\s+\d+ reads\r\n", timeout=60)
+    child.expect(r"2 clients:\s+\d+ ms,\s+\d+ ms,\s+\d+ reads\r\n", timeout=60)
+    child.expect_exact("TEST PASSED")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
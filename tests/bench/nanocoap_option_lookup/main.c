@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Option lookup benchmark, option offset array vs. decoding
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "net/nanocoap.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#ifndef REPEAT
+#define REPEAT              (10000U)
+#endif
+
+#define REQ_LEN             (64U)
+
+enum {
+    PARSE,
+    INDEX,
+    WALK,
+};
+
+static uint8_t _req[REQ_LEN];
+static size_t _req_len;
+
+static const uint16_t _opts[] = {
+    COAP_OPT_URI_PATH, COAP_OPT_URI_QUERY, COAP_OPT_ACCEPT, COAP_OPT_BLOCK2,
+    COAP_OPT_OBSERVE,
+};
+
+static void _setup(void)
+{
+    coap_pkt_t pkt;
+    ssize_t len;
+
+    len = coap_build_hdr((coap_hdr_t *)_req, COAP_TYPE_CON, (uint8_t *)"tk", 2,
+                         COAP_METHOD_GET, 1);
+    expect(len > 0);
+    coap_pkt_init(&pkt, _req, sizeof(_req), len);
+    expect(coap_opt_add_uri_path(&pkt, "/3303/0/5700") > 0);
+    expect(coap_opt_add_uri_query(&pkt, "lt", "60") > 0);
+    expect(coap_opt_add_uri_query(&pkt, "pmin", "10") > 0);
+    expect(coap_opt_add_accept(&pkt, COAP_FORMAT_SENML_CBOR) > 0);
+    len = coap_opt_finish(&pkt, COAP_OPT_FINISH_NONE);
+    expect(len > 0);
+    _req_len = len;
+}
+
+/* finds an option by decoding all options before it */
+static ssize_t _walk(const coap_pkt_t *pkt, uint16_t opt_num, uint8_t **value)
+{
+    coap_optpos_t opt;
+    ssize_t len;
+
+    for (bool init = true;
+         (len = coap_opt_get_next(pkt, &opt, value, init)) >= 0; init = false) {
+        if (opt.opt_num == opt_num) {
+            return len;
+        }
+        if (opt.opt_num > opt_num) {
+            break;
+        }
+    }
+    return -ENOENT;
+}
+
+static uint32_t _run(unsigned mode)
+{
+    uint32_t before = ztimer_now(ZTIMER_USEC);
+    unsigned found = 0;
+
+    for (unsigned n = 0; n < REPEAT; n++) {
+        coap_pkt_t pkt;
+        uint8_t *value;
+
+        expect(coap_parse(&pkt, _req, _req_len) == 0);
+        if (mode == INDEX) {
+            for (unsigned i = 0; i < ARRAY_SIZE(_opts); i++) {
+                if (coap_opt_get_opaque(&pkt, _opts[i], &value) >= 0) {
+                    found++;
+                }
+            }
+        }
+        else if (mode == WALK) {
+            for (unsigned i = 0; i < ARRAY_SIZE(_opts); i++) {
+                if (_walk(&pkt, _opts[i], &value) >= 0) {
+                    found++;
+                }
+            }
+        }
+    }
+    expect(found == ((mode == PARSE) ? 0 : (3 * REPEAT)));
+
+    return ztimer_now(ZTIMER_USEC) - before;
+}
+
+static void _print_result(const char *name, uint32_t total)
+{
+    printf("%-6s %8" PRIu32 " us / %u = %" PRIu32 " ns\n",
+           name, total, REPEAT,
+           (uint32_t)(((uint64_t)total * 1000) / REPEAT));
+}
+
+int main(void)
+{
+    puts("nanocoap option lookup benchmark.");
+    _setup();
+
+    _print_result("parse", _run(PARSE));
+    _print_result("index", _run(INDEX));
+    _print_result("walk", _run(WALK));
+
+    puts("TEST PASSED");
+
+    return 0;
+}
@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Request matching benchmark, linear vs. sorted resources
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "net/nanocoap.h"
+#include "test_utils/expect.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef REPEAT
+#define REPEAT              (10000U)
+#endif
+
+#define RESOURCES_MAX       (150U)
+#define PATH_LEN            sizeof("/3300/0/5700")
+#define REQ_LEN             (32U)
+
+static const unsigned _numof[] = { 10, 50, RESOURCES_MAX };
+
+/* LwM2M-like object/instance/resource paths, sorted by construction */
+static char _paths[RESOURCES_MAX][PATH_LEN];
+static coap_resource_t _resources[RESOURCES_MAX];
+static uint8_t _reqs[RESOURCES_MAX][REQ_LEN];
+static size_t _reqs_len[RESOURCES_MAX];
+static unsigned _handled;
+
+static ssize_t _handler(coap_pkt_t *pkt, uint8_t *buf, size_t len,
+                        coap_request_ctx_t *ctx)
+{
+    (void)pkt;
+    (void)buf;
+    (void)len;
+    (void)ctx;
+    _handled++;
+    return 0;
+}
+
+static void _setup(void)
+{
+    for (unsigned i = 0; i < RESOURCES_MAX; i++) {
+        coap_hdr_t *hdr = (coap_hdr_t *)_reqs[i];
+        ssize_t len;
+
+        snprintf(_paths[i], PATH_LEN, "/%u/0/%u", 3300 + (i / 10), 5700 + (i % 10));
+        _resources[i] = (coap_resource_t){
+            .path = _paths[i],
+            .methods = COAP_GET,
+            .handler = _handler,
+        };
+        len = coap_build_hdr(hdr, COAP_TYPE_NON, NULL, 0, COAP_METHOD_GET, i);
+        expect(len > 0);
+        len += coap_opt_put_uri_path(&_reqs[i][len], 0, _paths[i]);
+        expect((size_t)len <= REQ_LEN);
+        _reqs_len[i] = len;
+    }
+}
+
+static uint32_t _run(unsigned numof, bool sorted)
+{
+    uint8_t resp[REQ_LEN];
+    uint32_t before = ztimer_now(ZTIMER_USEC);
+
+    _handled = 0;
+    for (unsigned n = 0; n < REPEAT; n++) {
+        /* hit the resources in an order unrelated to the one of the array */
+        unsigned i = (n * 7919U) % numof;
+        coap_request_ctx_t ctx = { 0 };
+        coap_pkt_t pkt;
+
+        expect(coap_parse(&pkt, _reqs[i], _reqs_len[i]) == 0);
+        if (sorted) {
+            coap_sorted_tree_handler(&pkt, resp, sizeof(resp), &ctx,
+                                     _resources, numof);
+        }
+        else {
+            coap_tree_handler(&pkt, resp, sizeof(resp), &ctx,
+                              _resources, numof);
+        }
+        expect(ctx.resource == &_resources[i]);
+    }
+    expect(_handled == REPEAT);
+
+    return ztimer_now(ZTIMER_USEC) - before;
+}
+
+static void _print_result(const char *name, unsigned numof, uint32_t total)
+{
+    printf("%-6s %3u resources %8" PRIu32 " us / %u = %" PRIu32 " ns "
+           "(%" PRIu32 " req/s)\n",
+           name, numof, total, REPEAT,
+           (uint32_t)(((uint64_t)total * 1000) / REPEAT),
+           (uint32_t)(((uint64_t)REPEAT * US_PER_SEC) / total));
+}
+
+int main(void)
+{
+    puts("nanocoap resource lookup benchmark.");
+    _setup();
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_numof); i++) {
+        _print_result("linear", _numof[i], _run(_numof[i], false));
+        _print_result("sorted", _numof[i], _run(_numof[i], true));
+    }
+
+    puts("TEST PASSED");
+
+    return 0;
+}
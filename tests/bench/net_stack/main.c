@@ -0,0 +1,345 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Network stack throughput and latency benchmarks
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "benchmark.h"
+#include "net/nanocoap_sock.h"
+#include "net/sock/tcp.h"
+#include "net/sock/udp.h"
+#include "net/sock/util.h"
+#include "shell.h"
+#include "thread.h"
+
+#ifndef BENCH_PORT
+#define BENCH_PORT          (12345U)
+#endif
+
+#ifndef BENCH_SIZE_MAX
+#define BENCH_SIZE_MAX      (1232U)
+#endif
+
+#ifndef BENCH_COUNT_MAX
+#define BENCH_COUNT_MAX     (128U)
+#endif
+
+#ifndef BENCH_TIMEOUT_US
+#define BENCH_TIMEOUT_US    (1000000U)
+#endif
+
+#define SERVER_STACKSIZE    (THREAD_STACKSIZE_DEFAULT + BENCH_SIZE_MAX)
+
+static char _udp_stack[SERVER_STACKSIZE];
+static char _tcp_stack[SERVER_STACKSIZE];
+static char _coap_stack[SERVER_STACKSIZE];
+
+static uint8_t _buf[BENCH_SIZE_MAX];
+static uint32_t _samples[BENCH_COUNT_MAX];
+static char _name[32];
+
+static bool _server_running;
+
+/* --- servers --- */
+
+static void *_udp_server(void *arg)
+{
+    (void)arg;
+    static uint8_t buf[BENCH_SIZE_MAX];
+    sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+    sock_udp_t sock;
+
+    local.port = BENCH_PORT;
+    if (sock_udp_create(&sock, &local, NULL, 0) < 0) {
+        puts("udp: unable to create server socket");
+        return NULL;
+    }
+
+    while (1) {
+        sock_udp_ep_t remote;
+        ssize_t res = sock_udp_recv(&sock, buf, sizeof(buf), SOCK_NO_TIMEOUT,
+                                    &remote);
+        if (res >= 0) {
+            sock_udp_send(&sock, buf, res, &remote);
+        }
+    }
+
+    return NULL;
+}
+
+static void *_tcp_server(void *arg)
+{
+    (void)arg;
+    static uint8_t buf[BENCH_SIZE_MAX];
+    static sock_tcp_queue_t queue;
+    static sock_tcp_t socks[1];
+    sock_tcp_ep_t local = SOCK_IPV6_EP_ANY;
+
+    local.port = BENCH_PORT + 1;
+    if (sock_tcp_listen(&queue, &local, socks, ARRAY_SIZE(socks), 0) < 0) {
+        puts("tcp: unable to listen");
+        return NULL;
+    }
+
+    while (1) {
+        sock_tcp_t *sock;
+        if (sock_tcp_accept(&queue, &sock, SOCK_NO_TIMEOUT) < 0) {
+            continue;
+        }
+        /* sink everything, acknowledge each chunk with one byte */
+        ssize_t res;
+        while ((res = sock_tcp_read(sock, buf, sizeof(buf),
+                                    SOCK_NO_TIMEOUT)) > 0) {
+            sock_tcp_write(sock, buf, 1);
+        }
+        sock_tcp_disconnect(sock);
+    }
+
+    return NULL;
+}
+
+static ssize_t _bench_handler(coap_pkt_t *pkt, uint8_t *buf, size_t len,
+                              coap_request_ctx_t *ctx)
+{
+    (void)ctx;
+    return coap_reply_simple(pkt, COAP_CODE_CONTENT, buf, len,
+                             COAP_FORMAT_TEXT, NULL, 0);
+}
+
+NANOCOAP_RESOURCE(bench) {
+    .path = "/bench", .methods = COAP_GET, .handler = _bench_handler
+};
+
+static void *_coap_server(void *arg)
+{
+    (void)arg;
+    static uint8_t buf[128];
+    sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+
+    local.port = COAP_PORT;
+    nanocoap_server(&local, buf, sizeof(buf));
+
+    return NULL;
+}
+
+static int _cmd_server(int argc, char **argv)
+{
+    (void)argc;
+    (void)argv;
+
+    if (_server_running) {
+        puts("servers already running");
+        return 0;
+    }
+    _server_running = true;
+
+    thread_create(_udp_stack, sizeof(_udp_stack), THREAD_PRIORITY_MAIN - 1,
+                  THREAD_CREATE_STACKTEST, _udp_server, NULL, "udp echo");
+    thread_create(_tcp_stack, sizeof(_tcp_stack), THREAD_PRIORITY_MAIN - 1,
+                  THREAD_CREATE_STACKTEST, _tcp_server, NULL, "tcp sink");
+    thread_create(_coap_stack, sizeof(_coap_stack), THREAD_PRIORITY_MAIN - 1,
+                  THREAD_CREATE_STACKTEST, _coap_server, NULL, "coap");
+
+    printf("UDP echo on %u, TCP sink on %u, CoAP on %u\n",
+           BENCH_PORT, BENCH_PORT + 1, COAP_PORT);
+    return 0;
+}
+
+SHELL_COMMAND(bench_server, "start the benchmark servers", _cmd_server);
+
+/* --- clients --- */
+
+static void _print(const char *proto, unsigned size, unsigned count,
+                   unsigned lost, uint32_t total)
+{
+    if (count == lost) {
+        printf("%s: no replies\n", proto);
+        return;
+    }
+    if (size) {
+        snprintf(_name, sizeof(_name), "%s %uB", proto, size);
+    }
+    else {
+        snprintf(_name, sizeof(_name), "%s", proto);
+    }
+    benchmark_print_result(_name, _samples, count - lost, 1);
+    if (total) {
+        printf("%s: %u lost, %lu B/s\n", _name, lost,
+               (unsigned long)(((uint64_t)size * (count - lost) * US_PER_SEC)
+                               / total));
+    }
+}
+
+static int _bench_udp(const sock_udp_ep_t *remote, unsigned size,
+                      unsigned count)
+{
+    sock_udp_t sock;
+    unsigned lost = 0;
+
+    if (sock_udp_create(&sock, NULL, remote, 0) < 0) {
+        return -ENOTCONN;
+    }
+
+    uint32_t begin = benchmark_now();
+    for (unsigned i = 0; i < count; i++) {
+        memcpy(_buf, &i, sizeof(i));
+        uint32_t start = benchmark_now();
+        if (sock_udp_send(&sock, _buf, size, NULL) < 0) {
+            lost++;
+            continue;
+        }
+        /* skip stale replies of requests that timed out */
+        ssize_t res;
+        unsigned seq;
+        do {
+            res = sock_udp_recv(&sock, _buf, sizeof(_buf), BENCH_TIMEOUT_US,
+                                NULL);
+            memcpy(&seq, _buf, sizeof(seq));
+        } while ((res >= (ssize_t)sizeof(seq)) && (seq != i));
+        if (res < 0) {
+            lost++;
+            continue;
+        }
+        _samples[i - lost] = benchmark_now() - start;
+    }
+    uint32_t total = benchmark_now() - begin;
+    sock_udp_close(&sock);
+
+    /* throughput is only meaningful in microseconds */
+    _print("udp echo", size, count, lost,
+           IS_USED(MODULE_BENCHMARK_CYCLES) ? 0 : total);
+    return 0;
+}
+
+static int _bench_tcp(const sock_tcp_ep_t *remote, unsigned size,
+                      unsigned count)
+{
+    sock_tcp_t sock;
+    unsigned lost = 0;
+
+    if (sock_tcp_connect(&sock, remote, 0, 0) < 0) {
+        return -ENOTCONN;
+    }
+
+    uint32_t begin = benchmark_now();
+    for (unsigned i = 0; i < count; i++) {
+        uint32_t start = benchmark_now();
+        uint8_t ack;
+        if ((sock_tcp_write(&sock, _buf, size) != (ssize_t)size)
+            || (sock_tcp_read(&sock, &ack, sizeof(ack), BENCH_TIMEOUT_US) < 0)) {
+            lost = count - i;
+            break;
+        }
+        _samples[i] = benchmark_now() - start;
+    }
+    uint32_t total = benchmark_now() - begin;
+    sock_tcp_disconnect(&sock);
+
+    _print("tcp write", size, count, lost,
+           IS_USED(MODULE_BENCHMARK_CYCLES) ? 0 : total);
+    return 0;
+}
+
+static int _bench_coap(const sock_udp_ep_t *remote, unsigned count)
+{
+    nanocoap_sock_t sock;
+    unsigned lost = 0;
+
+    if (nanocoap_sock_connect(&sock, NULL, remote) < 0) {
+        return -ENOTCONN;
+    }
+
+    for (unsigned i = 0; i < count; i++) {
+        uint32_t start = benchmark_now();
+        ssize_t res = nanocoap_sock_get(&sock, "/bench", _buf, sizeof(_buf));
+        if (res < 0) {
+            lost++;
+            continue;
+        }
+        _samples[i - lost] = benchmark_now() - start;
+    }
+    nanocoap_sock_close(&sock);
+
+    _print("coap get", 0, count, lost, 0);
+    return 0;
+}
+
+static int _cmd_bench(int argc, char **argv)
+{
+    if (argc < 3) {
+        printf("usage: %s <udp|tcp> <[addr%%netif]:port> [size] [count]\n"
+               "       %s coap <[addr%%netif]:port> [count]\n",
+               argv[0], argv[0]);
+        return 1;
+    }
+
+    bool coap = !strcmp(argv[1], "coap");
+    unsigned size = (argc > 3 && !coap) ? (unsigned)atoi(argv[3]) : 64;
+    unsigned count = (argc > 4 - coap) ? (unsigned)atoi(argv[4 - coap])
+                                       : BENCH_COUNT_MAX;
+    if ((size < sizeof(unsigned)) || (size > BENCH_SIZE_MAX)
+        || (count == 0) || (count > BENCH_COUNT_MAX)) {
+        printf("size must be %u..%u, count 1..%u\n", (unsigned)sizeof(unsigned),
+               BENCH_SIZE_MAX, BENCH_COUNT_MAX);
+        return 1;
+    }
+
+    sock_udp_ep_t remote;
+    if (sock_udp_str2ep(&remote, argv[2]) < 0) {
+        printf("unable to parse %s\n", argv[2]);
+        return 1;
+    }
+
+    int res;
+    if (!strcmp(argv[1], "udp")) {
+        remote.port = remote.port ? remote.port : BENCH_PORT;
+        res = _bench_udp(&remote, size, count);
+    }
+    else if (!strcmp(argv[1], "tcp")) {
+        remote.port = remote.port ? remote.port : BENCH_PORT + 1;
+        res = _bench_tcp(&remote, size, count);
+    }
+    else if (coap) {
+        remote.port = remote.port ? remote.port : COAP_PORT;
+        res = _bench_coap(&remote, count);
+    }
+    else {
+        printf("unknown benchmark %s\n", argv[1]);
+        return 1;
+    }
+
+    if (res < 0) {
+        printf("%s: %s\n", argv[1], strerror(-res));
+        return 1;
+    }
+    return 0;
+}
+
+SHELL_COMMAND(bench, "run a network benchmark", _cmd_bench);
+
+int main(void)
+{
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(NULL, line_buf, SHELL_DEFAULT_BUFSIZE);
+
+    return 0;
+}
@@ -18,8 +18,10 @@
  * @}
  */
 
+#include <inttypes.h>
 #include <stdio.h>
 
+#include "bitbang.h"
 #include "periph/gpio.h"
 #include "periph/gpio_ll.h"
 #include "test_utils/expect.h"
@@ -45,6 +47,14 @@
 
 static gpio_port_t port_out = PORT_OUT;
 
+static void print_shift_summary(const char *name, uint_fast16_t bytes,
+                                uint32_t duration)
+{
+    printf("%s: %" PRIu32 " us for %u bytes, %" PRIu32 " kbit/s\n",
+           name, duration, (unsigned)bytes,
+           (uint32_t)((uint64_t)8 * MS_PER_SEC * bytes / duration));
+}
+
 static void print_summary_compensated(uint_fast16_t loops, uint32_t duration,
                                       uint32_t duration_uncompensated)
 {
@@ -295,6 +305,46 @@ int main(void)
         }
     }
 
+    {
+        puts("\n"
+             "Bit-banging: shifting out bytes MSB first on data and clock\n"
+             "-----------------------------------------------------------");
+        const uint_fast16_t bytes = loops / 8;
+        gpio_t p0 = GPIO_PIN(PORT_OUT_NUM, PIN_OUT_0);
+        gpio_t p1 = GPIO_PIN(PORT_OUT_NUM, PIN_OUT_1);
+        gpio_init(p0, GPIO_OUT);
+        gpio_init(p1, GPIO_OUT);
+        gpio_clear(p1);
+
+        uint32_t start = ztimer_now(ZTIMER_USEC);
+        for (uint_fast16_t i = bytes; i > 0; i--) {
+            uint8_t out = i;
+            for (unsigned bit = 0; bit < 8; bit++, out <<= 1) {
+                gpio_write(p0, out & 0x80);
+                gpio_toggle(p1);
+                gpio_toggle(p1);
+            }
+        }
+        print_shift_summary("gpio_write()", bytes,
+                            ztimer_now(ZTIMER_USEC) - start);
+
+        bitbang_pin_t data, clk;
+        bitbang_pin_init(&data, p0, p0);
+        bitbang_pin_init(&clk, p1, p1);
+
+        start = ztimer_now(ZTIMER_USEC);
+        for (uint_fast16_t i = bytes; i > 0; i--) {
+            uint8_t out = i;
+            for (unsigned bit = 0; bit < 8; bit++, out <<= 1) {
+                bitbang_write(&data, out & 0x80);
+                bitbang_toggle(&clk);
+                bitbang_toggle(&clk);
+            }
+        }
+        print_shift_summary("bitbang_write()", bytes,
+                            ztimer_now(ZTIMER_USEC) - start);
+    }
+
     puts("\n\nTEST SUCCEEDED");
     return 0;
 }
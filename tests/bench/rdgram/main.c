@@ -0,0 +1,188 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Completion time of a reliable transfer over a lossy link,
+ *              stop-and-wait vs. a congestion-controlled window
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "congure/reno.h"
+#include "net/rdgram.h"
+#include "random.h"
+#include "test_utils/expect.h"
+
+#ifndef NUM
+#define NUM             (256U)  /**< datagrams per transfer */
+#endif
+
+#ifndef DELAY_MS
+#define DELAY_MS        (50U)   /**< one-way delay of the link */
+#endif
+
+#ifndef TX_TIME_MS
+#define TX_TIME_MS      (2U)    /**< time to put a datagram on the link */
+#endif
+
+#define QUEUE_LEN       (16U)   /**< datagrams queued at the link, tail drop */
+#define SEED            (0x5eed)
+
+/* a datagram or ACK on its way */
+typedef struct {
+    uint32_t arrival;
+    uint32_t seq;
+    uint32_t sack;
+} _pkt_t;
+
+/* packets on one direction of the link, in order of arrival */
+typedef struct {
+    _pkt_t pkts[64];
+    unsigned head;
+    unsigned len;
+    uint32_t free;              /* time the link is free to transmit */
+} _link_t;
+
+static const unsigned _wnd[] = { 1, 16 };
+static const unsigned _loss[] = { 0, 2, 10 };
+
+static uint32_t _now;
+static unsigned _loss_pct;
+static unsigned _sent;
+static _link_t _data;
+static _link_t _acks;
+static rdgram_rcv_t _rcv;
+static rdgram_msg_t _msgs[RDGRAM_WND_MAX];
+static congure_reno_snd_t _reno;
+
+static void _fr(congure_reno_snd_t *c)
+{
+    /* rdgram retransmits itself */
+    (void)c;
+}
+
+static const congure_reno_snd_consts_t _reno_consts = {
+    .fr = _fr,
+    /* rdgram window and congestion window are counted in datagrams */
+    .init_mss = 1,
+    .cwnd_lower = 1,
+    .cwnd_upper = 2,
+    .init_ssthresh = RDGRAM_WND_MAX,
+    .frthresh = 3,
+};
+
+static bool _lost(void)
+{
+    return random_uint32_range(0, 100) < _loss_pct;
+}
+
+static void _link_send(_link_t *link, uint32_t seq, uint32_t sack)
+{
+    _pkt_t *pkt;
+    uint32_t start = (link->free > _now) ? link->free : _now;
+
+    if ((link->len >= QUEUE_LEN) || _lost()) {
+        return;
+    }
+    link->free = start + TX_TIME_MS;
+    pkt = &link->pkts[(link->head + link->len++) % ARRAY_SIZE(link->pkts)];
+    pkt->arrival = link->free + DELAY_MS;
+    pkt->seq = seq;
+    pkt->sack = sack;
+}
+
+static _pkt_t *_link_peek(_link_t *link)
+{
+    return (link->len > 0) ? &link->pkts[link->head] : NULL;
+}
+
+static void _link_pop(_link_t *link)
+{
+    link->head = (link->head + 1) % ARRAY_SIZE(link->pkts);
+    link->len--;
+}
+
+static int _send(rdgram_t *rd, uint32_t seq, void *arg)
+{
+    (void)rd;
+    (void)arg;
+    _sent++;
+    _link_send(&_data, seq, 0);
+    return 1;
+}
+
+static uint32_t _run(unsigned wnd)
+{
+    rdgram_t rd;
+    uint32_t deadline;
+
+    _now = 0;
+    _sent = 0;
+    _rcv = (rdgram_rcv_t){ 0 };
+    _data = (_link_t){ .len = 0 };
+    _acks = (_link_t){ .len = 0 };
+    random_init(SEED);
+    congure_reno_snd_setup(&_reno, &_reno_consts);
+    _reno.super.driver->init(&_reno.super, NULL);
+    rdgram_init(&rd, &_reno.super, _msgs, wnd, NUM, 1, _send, NULL);
+    deadline = rdgram_poll(&rd, _now);
+    while (!rdgram_done(&rd)) {
+        _pkt_t *data = _link_peek(&_data);
+        _pkt_t *ack = _link_peek(&_acks);
+
+        /* advance the virtual clock to the next event */
+        if ((data != NULL) && (data->arrival <= deadline) &&
+            ((ack == NULL) || (data->arrival <= ack->arrival))) {
+            _now = data->arrival;
+            /* full SACK window is dropped, the sender retransmits it */
+            if (rdgram_rcv(&_rcv, data->seq) >= 0) {
+                _link_send(&_acks, _rcv.next, _rcv.sack);
+            }
+            _link_pop(&_data);
+        }
+        else if ((ack != NULL) && (ack->arrival <= deadline)) {
+            _now = ack->arrival;
+            rdgram_ack(&rd, ack->seq, ack->sack, _now);
+            _link_pop(&_acks);
+        }
+        else {
+            expect(deadline != RDGRAM_NO_TIMEOUT);
+            _now = deadline;
+        }
+        deadline = _now + rdgram_poll(&rd, _now);
+    }
+    expect(_rcv.next == NUM);
+    return _now;
+}
+
+int main(void)
+{
+    puts("rdgram benchmark.");
+    printf("%u datagrams, %u ms one-way delay, %u ms per datagram\n",
+           NUM, DELAY_MS, TX_TIME_MS);
+    for (unsigned i = 0; i < ARRAY_SIZE(_loss); i++) {
+        _loss_pct = _loss[i];
+        for (unsigned j = 0; j < ARRAY_SIZE(_wnd); j++) {
+            uint32_t time = _run(_wnd[j]);
+
+            printf("loss %2u%%, window %2u: %7" PRIu32 " ms, %4u retransmissions\n",
+                   _loss[i], _wnd[j], time, _sent - NUM);
+        }
+    }
+    puts("TEST PASSED");
+    return 0;
+}
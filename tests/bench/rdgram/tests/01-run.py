@@ -0,0 +1,22 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2024 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("rdgram benchmark.\r\n")
+    child.expect(r"\d+ datagrams, \d+ ms one-way delay, \d+ ms per datagram\r\n")
+    for _ in range(6):
+        child.expect(r"loss\s+\d+%, window\s+\d+:\s+\d+ ms,\s+\d+ retransmissions\r\n")
+    child.expect_exact("TEST PASSED")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure the deadline-miss rate of periodic tasks
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "sched.h"
+#include "thread.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef DURATION_MS
+#define DURATION_MS     (2000U)
+#endif
+
+/* granularity of the emulated computation, preemption during one slice
+ * makes a job appear shorter by at most this amount */
+#define SLICE_US        (50U)
+
+#define TASK_PRIO       (THREAD_PRIORITY_MAIN - 1)
+
+typedef struct {
+    uint32_t period_us;
+    uint32_t wcet_us;
+    unsigned jobs;
+    unsigned misses;
+} task_t;
+
+/* utilization is 0.35 + 0.3 + 0.2 = 0.85: schedulable with EDF, but not
+ * when jobs are served in FIFO order */
+static task_t _tasks[] = {
+    { .period_us = 2000, .wcet_us = 700 },
+    { .period_us = 3000, .wcet_us = 900 },
+    { .period_us = 5000, .wcet_us = 1000 },
+};
+
+static char _stacks[ARRAY_SIZE(_tasks)][THREAD_STACKSIZE_DEFAULT];
+
+static volatile unsigned _stop;
+
+static void _set_deadline(uint32_t deadline)
+{
+#if IS_USED(MODULE_SCHED_EDF)
+    sched_set_deadline(thread_get_active(), deadline);
+#else
+    (void)deadline;
+#endif
+}
+
+static void *_task(void *arg)
+{
+    task_t *task = arg;
+    uint32_t release = ztimer_now(ZTIMER_USEC);
+
+    _set_deadline(release + task->period_us);
+
+    while (!_stop) {
+        for (unsigned i = 0; i < task->wcet_us / SLICE_US; i++) {
+            ztimer_spin(ZTIMER_USEC, SLICE_US);
+        }
+
+        uint32_t deadline = release + task->period_us;
+        if ((int32_t)(ztimer_now(ZTIMER_USEC) - deadline) > 0) {
+            task->misses++;
+        }
+        task->jobs++;
+
+        /* the deadline of the next job is set before it is released, so that
+         * the thread is sorted into the runqueue correctly on wakeup */
+        _set_deadline(deadline + task->period_us);
+        ztimer_periodic_wakeup(ZTIMER_USEC, &release, task->period_us);
+    }
+
+    return NULL;
+}
+
+int main(void)
+{
+    puts("main starting");
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_tasks); i++) {
+        thread_create(_stacks[i], sizeof(_stacks[i]), TASK_PRIO,
+                      THREAD_CREATE_WOUT_YIELD, _task, &_tasks[i], "task");
+    }
+
+    /* all tasks have higher priority than main, main only runs when the
+     * tasks are idle */
+    ztimer_sleep(ZTIMER_USEC, DURATION_MS * US_PER_MS);
+    _stop = 1;
+
+    unsigned jobs = 0;
+    unsigned misses = 0;
+    for (unsigned i = 0; i < ARRAY_SIZE(_tasks); i++) {
+        printf("{ \"task\" : %u, \"period\" : %" PRIu32 ", \"wcet\" : %" PRIu32
+               ", \"jobs\" : %u, \"misses\" : %u }\n",
+               i, _tasks[i].period_us, _tasks[i].wcet_us,
+               _tasks[i].jobs, _tasks[i].misses);
+        jobs += _tasks[i].jobs;
+        misses += _tasks[i].misses;
+    }
+
+    printf("{ \"edf\" : %u, \"jobs\" : %u, \"misses\" : %u, "
+           "\"miss_rate_permille\" : %u }\n",
+           (unsigned)IS_USED(MODULE_SCHED_EDF), jobs, misses,
+           jobs ? (misses * 1000U) / jobs : 0);
+
+    return 0;
+}
@@ -0,0 +1,22 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2024 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for _ in range(3):
+        child.expect(r"{ \"task\" : \d+, \"period\" : \d+, \"wcet\" : \d+, "
+                     r"\"jobs\" : \d+, \"misses\" : \d+ }")
+    child.expect(r"{ \"edf\" : (\d), \"jobs\" : \d+, \"misses\" : \d+, "
+                 r"\"miss_rate_permille\" : \d+ }")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=10))
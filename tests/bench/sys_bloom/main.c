@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Classic vs. blocked vs. counting Bloom filter
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "bitfield.h"
+#include "bloom.h"
+#include "hashes.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#define BLOOM_BITS      (4096U)     /**< size of all filters */
+#define BLOOM_K         (8U)        /**< probes per element */
+#define ADDED           (256U)      /**< elements added to the filters */
+#define CHECKED         (4096U)     /**< elements checked that were not added */
+
+static bloom_t _classic;
+static BITFIELD(_classic_bits, BLOOM_BITS);
+static hashfp_t _hashes[BLOOM_K] = {
+    fnv_hash, sax_hash, sdbm_hash, djb2_hash,
+    kr_hash, dek_hash, rotating_hash, one_at_a_time_hash,
+};
+
+static bloom_blocked_t _blocked;
+static uint8_t _blocked_bits[BLOOM_BITS / 8];
+
+static bloom_counting_t _counting;
+static uint8_t _counters[BLOOM_BITS / 2];
+
+/* elements are sequence numbers of flooded packets */
+static uint32_t _elem(uint32_t i)
+{
+    return i * 2654435761U;
+}
+
+#define BENCH(name, add, check)                                             \
+    do {                                                                    \
+        uint32_t elem, in = 0;                                              \
+        uint32_t start = ztimer_now(ZTIMER_USEC);                           \
+        for (uint32_t i = 0; i < ADDED; i++) {                              \
+            elem = _elem(i);                                                \
+            add;                                                            \
+        }                                                                   \
+        uint32_t added = ztimer_now(ZTIMER_USEC);                           \
+        for (uint32_t i = ADDED; i < ADDED + CHECKED; i++) {                \
+            elem = _elem(i);                                                \
+            in += check;                                                    \
+        }                                                                   \
+        uint32_t checked = ztimer_now(ZTIMER_USEC);                         \
+        for (uint32_t i = 0; i < ADDED; i++) {                              \
+            elem = _elem(i);                                                \
+            expect(check);                                                  \
+        }                                                                   \
+        printf("%s: add %" PRIu32 " us, check %" PRIu32 " us, "             \
+               "%" PRIu32 " false positives\n", name, added - start,        \
+               checked - added, in);                                        \
+    } while (0)
+
+int main(void)
+{
+    puts("Bloom filter benchmark.");
+    printf("m: %u k: %u, %u added, %u checked\n", BLOOM_BITS, BLOOM_K,
+           ADDED, CHECKED);
+
+    bloom_init(&_classic, BLOOM_BITS, _classic_bits, _hashes, BLOOM_K);
+    bloom_blocked_init(&_blocked, _blocked_bits,
+                       sizeof(_blocked_bits) / BLOOM_BLOCKED_BLOCK_SIZE,
+                       fnv_hash, BLOOM_K);
+    bloom_counting_init(&_counting, _counters,
+                        sizeof(_counters) / BLOOM_COUNTING_BLOCK_SIZE,
+                        fnv_hash, BLOOM_K);
+
+    BENCH("classic",
+          bloom_add(&_classic, (uint8_t *)&elem, sizeof(elem)),
+          bloom_check(&_classic, (uint8_t *)&elem, sizeof(elem)));
+    BENCH("blocked",
+          bloom_blocked_add(&_blocked, (uint8_t *)&elem, sizeof(elem)),
+          bloom_blocked_check(&_blocked, (uint8_t *)&elem, sizeof(elem)));
+    BENCH("counting",
+          bloom_counting_add(&_counting, (uint8_t *)&elem, sizeof(elem)),
+          bloom_counting_check(&_counting, (uint8_t *)&elem, sizeof(elem)));
+
+    puts("TEST PASSED");
+    return 0;
+}
@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2024 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("Bloom filter benchmark.\r\n")
+    child.expect(r"m: \d+ k: \d+, \d+ added, \d+ checked\r\n")
+    for name in ("classic", "blocked", "counting"):
+        child.expect(name + r": add \d+ us, check \d+ us, \d+ false positives\r\n",
+                     timeout=60)
+    child.expect_exact("TEST PASSED")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput of ChaCha20-Poly1305 and Poly1305
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "crypto/chacha20poly1305.h"
+#include "crypto/poly1305.h"
+#include "test_utils/expect.h"
+#include "time_units.h"
+#include "ztimer.h"
+
+#ifndef SIZE
+#define SIZE            (1024U) /**< bytes per message */
+#endif
+
+#ifndef RUNS
+#define RUNS            (64U)   /**< messages per measurement */
+#endif
+
+static const uint8_t _key[CHACHA20POLY1305_KEY_BYTES] = { 0x42 };
+static const uint8_t _nonce[CHACHA20POLY1305_NONCE_BYTES] = { 0x23 };
+static const uint8_t _aad[12] = { 0x17 };
+
+static uint8_t _plain[SIZE];
+static uint8_t _cipher[SIZE + CHACHA20POLY1305_TAG_BYTES];
+static uint8_t _check[SIZE];
+
+static void _encrypt(void)
+{
+    chacha20poly1305_encrypt(_cipher, _plain, SIZE, _aad, sizeof(_aad),
+                             _key, _nonce);
+}
+
+static void _decrypt(void)
+{
+    size_t len;
+
+    expect(chacha20poly1305_decrypt(_cipher, sizeof(_cipher), _check, &len,
+                                    _aad, sizeof(_aad), _key, _nonce) == 1);
+}
+
+static void _poly1305(void)
+{
+    uint8_t mac[16];
+
+    poly1305_auth(mac, _plain, SIZE, _key);
+}
+
+static const struct {
+    const char *name;
+    void (*func)(void);
+} _ops[] = {
+    { "encrypt", _encrypt },
+    { "decrypt", _decrypt },
+    { "poly1305", _poly1305 },
+};
+
+int main(void)
+{
+    for (unsigned i = 0; i < SIZE; i++) {
+        _plain[i] = i * 7;
+    }
+    _encrypt();
+    _decrypt();
+    expect(memcmp(_check, _plain, SIZE) == 0);
+
+    puts("chacha20poly1305 benchmark.");
+    printf("%u runs over %u bytes\n", RUNS, SIZE);
+    for (unsigned i = 0; i < ARRAY_SIZE(_ops); i++) {
+        uint32_t start = ztimer_now(ZTIMER_USEC);
+        for (unsigned j = 0; j < RUNS; j++) {
+            _ops[i].func();
+        }
+        uint32_t time = ztimer_now(ZTIMER_USEC) - start;
+
+        printf("%8s: %7" PRIu32 " us, %6" PRIu32 " KiB/s\n", _ops[i].name,
+               time, (uint32_t)((uint64_t)SIZE * RUNS * US_PER_SEC / 1024 / time));
+    }
+    puts("TEST PASSED");
+    return 0;
+}
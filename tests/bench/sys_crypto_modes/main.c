@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput of AES-128 in the cipher modes of sys/crypto
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "crypto/aes.h"
+#include "crypto/modes/cbc.h"
+#include "crypto/modes/ccm.h"
+#include "crypto/modes/ctr.h"
+#include "crypto/modes/ecb.h"
+#include "test_utils/expect.h"
+#include "time_units.h"
+#include "ztimer.h"
+
+#ifndef SIZE
+#define SIZE            (1024U) /**< bytes per message */
+#endif
+
+#ifndef RUNS
+#define RUNS            (64U)   /**< messages per measurement */
+#endif
+
+#define MAC_LEN         (8U)
+
+static const uint8_t _key[AES_KEY_SIZE_128] = {
+    0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+    0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c,
+};
+
+static cipher_t _cipher;
+static uint8_t _plain[SIZE];
+static uint8_t _out[SIZE + MAC_LEN];
+static uint8_t _check[SIZE];
+
+static int _ecb(void)
+{
+    return cipher_encrypt_ecb(&_cipher, _plain, SIZE, _out);
+}
+
+static int _cbc(void)
+{
+    uint8_t iv[16] = { 0 };
+
+    return cipher_encrypt_cbc(&_cipher, iv, _plain, SIZE, _out);
+}
+
+static int _ctr(void)
+{
+    uint8_t ctr[16] = { 0 };
+
+    return cipher_encrypt_ctr(&_cipher, ctr, 8, _plain, SIZE, _out);
+}
+
+static int _ccm(void)
+{
+    static const uint8_t nonce[13] = { 0 };
+
+    return cipher_encrypt_ccm(&_cipher, _plain, 16, MAC_LEN, 2, nonce,
+                              sizeof(nonce), _plain, SIZE, _out);
+}
+
+static const struct {
+    const char *name;
+    int (*func)(void);
+} _modes[] = {
+    { "ecb", _ecb },
+    { "cbc", _cbc },
+    { "ctr", _ctr },
+    { "ccm", _ccm },
+};
+
+static void _self_test(void)
+{
+    uint8_t iv[16] = { 0 };
+    uint8_t ctr[16] = { 0 };
+    static const uint8_t nonce[13] = { 0 };
+
+    expect(_ecb() == SIZE);
+    expect(cipher_decrypt_ecb(&_cipher, _out, SIZE, _check) == SIZE);
+    expect(memcmp(_check, _plain, SIZE) == 0);
+
+    expect(_cbc() == SIZE);
+    expect(cipher_decrypt_cbc(&_cipher, iv, _out, SIZE, _check) == SIZE);
+    expect(memcmp(_check, _plain, SIZE) == 0);
+
+    expect(_ctr() == SIZE);
+    expect(cipher_decrypt_ctr(&_cipher, ctr, 8, _out, SIZE, _check) == SIZE);
+    expect(memcmp(_check, _plain, SIZE) == 0);
+
+    expect(_ccm() == SIZE + MAC_LEN);
+    expect(cipher_decrypt_ccm(&_cipher, _plain, 16, MAC_LEN, 2, nonce,
+                              sizeof(nonce), _out, SIZE + MAC_LEN,
+                              _check) == SIZE);
+    expect(memcmp(_check, _plain, SIZE) == 0);
+}
+
+int main(void)
+{
+    for (unsigned i = 0; i < SIZE; i++) {
+        _plain[i] = i * 7;
+    }
+    expect(cipher_init(&_cipher, CIPHER_AES, _key, sizeof(_key)) == CIPHER_INIT_SUCCESS);
+    _self_test();
+
+    puts("cipher modes benchmark.");
+    printf("%u runs over %u bytes with AES-128\n", RUNS, SIZE);
+    for (unsigned i = 0; i < ARRAY_SIZE(_modes); i++) {
+        uint32_t start = ztimer_now(ZTIMER_USEC);
+        for (unsigned j = 0; j < RUNS; j++) {
+            _modes[i].func();
+        }
+        uint32_t time = ztimer_now(ZTIMER_USEC) - start;
+
+        printf("%s: %7" PRIu32 " us, %6" PRIu32 " KiB/s\n", _modes[i].name,
+               time, (uint32_t)((uint64_t)SIZE * RUNS * US_PER_SEC / 1024 / time));
+    }
+    puts("TEST PASSED");
+    return 0;
+}
@@ -0,0 +1,22 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2024 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("cipher modes benchmark.\r\n")
+    child.expect(r"\d+ runs over \d+ bytes with AES-128\r\n")
+    for _ in range(4):
+        child.expect(r"\w+:\s+\d+ us,\s+\d+ KiB/s\r\n", timeout=60)
+    child.expect_exact("TEST PASSED")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
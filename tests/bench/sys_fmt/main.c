@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Speed of the decimal conversions of the fmt module
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "fmt.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#ifndef RUNS
+#define RUNS            (10000U)    /**< conversions per measurement */
+#endif
+
+static char _buf[24];
+
+static void _check(size_t len, const char *exp)
+{
+    expect(len == strlen(exp));
+    expect(memcmp(_buf, exp, len) == 0);
+}
+
+static void _result(const char *name, uint32_t start)
+{
+    uint32_t time = ztimer_now(ZTIMER_USEC) - start;
+
+    printf("%s: %" PRIu32 " us\n", name, time);
+}
+
+int main(void)
+{
+    uint32_t start;
+    /* keep the compiler from hoisting the conversions out of the loops */
+    volatile uint32_t u32 = 4294967295LU;
+    volatile uint64_t u64 = 18446744073709551615LLU;
+    volatile int32_t s32 = -2147483647;
+    volatile float f = -1234.5678f;
+
+    puts("fmt benchmark.");
+    printf("%u runs\n", RUNS);
+
+    _check(fmt_u32_dec(_buf, u32), "4294967295");
+    _check(fmt_u64_dec(_buf, u64), "18446744073709551615");
+    _check(fmt_s32_dfp(_buf, s32, -3), "-2147483.647");
+    _check(fmt_float(_buf, f, 2), "-1234.56");
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < RUNS; i++) {
+        fmt_u32_dec(_buf, u32);
+    }
+    _result("fmt_u32_dec", start);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < RUNS; i++) {
+        fmt_u32_dec(_buf, i);
+    }
+    _result("fmt_u32_dec (small)", start);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < RUNS; i++) {
+        fmt_u64_dec(_buf, u64);
+    }
+    _result("fmt_u64_dec", start);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < RUNS; i++) {
+        fmt_s32_dfp(_buf, s32, -3);
+    }
+    _result("fmt_s32_dfp", start);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < RUNS; i++) {
+        fmt_float(_buf, f, 2);
+    }
+    _result("fmt_float", start);
+
+    puts("TEST PASSED");
+    return 0;
+}
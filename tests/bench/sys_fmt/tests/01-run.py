@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2024 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("fmt benchmark.\r\n")
+    child.expect(r"\d+ runs\r\n")
+    for name in ("fmt_u32_dec", r"fmt_u32_dec \(small\)", "fmt_u64_dec",
+                 "fmt_s32_dfp", "fmt_float"):
+        child.expect(name + r": \d+ us\r\n", timeout=60)
+    child.expect_exact("TEST PASSED")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
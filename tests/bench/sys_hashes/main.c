@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput of the hash functions in sys/hashes
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "hashes/md5.h"
+#include "hashes/sha1.h"
+#include "hashes/sha256.h"
+#include "hashes/sha3.h"
+#include "hashes/sha512.h"
+#include "test_utils/expect.h"
+#include "time_units.h"
+#include "ztimer.h"
+
+#ifndef SIZE
+#define SIZE            (1024U) /**< bytes per hash */
+#endif
+
+#ifndef RUNS
+#define RUNS            (64U)   /**< hashes per measurement */
+#endif
+
+typedef struct {
+    const char *name;
+    void (*hash)(const void *data, size_t len, void *digest);
+} _hash_t;
+
+static void _md5(const void *data, size_t len, void *digest)
+{
+    md5(digest, data, len);
+}
+
+static void _sha1(const void *data, size_t len, void *digest)
+{
+    sha1(digest, data, len);
+}
+
+static void _sha3_256(const void *data, size_t len, void *digest)
+{
+    sha3_256(digest, data, len);
+}
+
+static const _hash_t _hashes[] = {
+    { "md5", _md5 },
+    { "sha1", _sha1 },
+    { "sha256", sha256 },
+    { "sha512", sha512 },
+    { "sha3-256", _sha3_256 },
+};
+
+static uint8_t _buf[SIZE];
+static uint8_t _digest[SHA512_DIGEST_LENGTH];
+
+/* SHA-256 of 1000 times 'a', spans several blocks and ends in a partial one */
+static const uint8_t _sha256_1000a[] = {
+    0x41, 0xed, 0xec, 0xe4, 0x2d, 0x63, 0xe8, 0xd9,
+    0xbf, 0x51, 0x5a, 0x9b, 0xa6, 0x93, 0x2e, 0x1c,
+    0x20, 0xcb, 0xc9, 0xf5, 0xa5, 0xd1, 0x34, 0x64,
+    0x5a, 0xdb, 0x5d, 0xb1, 0xb9, 0x73, 0x7e, 0xa3,
+};
+
+int main(void)
+{
+    /* at an odd address to cover the unaligned path */
+    memset(_buf, 'a', 1001);
+    sha256(_buf + 1, 1000, _digest);
+    expect(memcmp(_digest, _sha256_1000a, sizeof(_sha256_1000a)) == 0);
+
+    for (unsigned i = 0; i < SIZE; i++) {
+        _buf[i] = i * 7;
+    }
+
+    puts("hashes benchmark.");
+    printf("%u runs over %u bytes\n", RUNS, SIZE);
+    for (unsigned i = 0; i < ARRAY_SIZE(_hashes); i++) {
+        uint32_t start = ztimer_now(ZTIMER_USEC);
+        for (unsigned j = 0; j < RUNS; j++) {
+            _hashes[i].hash(_buf, SIZE, _digest);
+        }
+        uint32_t time = ztimer_now(ZTIMER_USEC) - start;
+
+        printf("%8s: %7" PRIu32 " us, %7" PRIu32 " KiB/s\n", _hashes[i].name,
+               time, (uint32_t)((uint64_t)SIZE * RUNS * US_PER_SEC / 1024 / time));
+    }
+
+    /* four independent messages, one after the other and interleaved */
+    static uint8_t digests[SHA2XX_MULTI_LANES_MAX][SHA256_DIGEST_LENGTH];
+    const void *data[SHA2XX_MULTI_LANES_MAX];
+    void *digest[SHA2XX_MULTI_LANES_MAX];
+    size_t len = SIZE / SHA2XX_MULTI_LANES_MAX;
+
+    for (unsigned l = 0; l < SHA2XX_MULTI_LANES_MAX; l++) {
+        data[l] = &_buf[l * len];
+        digest[l] = digests[l];
+    }
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned j = 0; j < RUNS; j++) {
+        for (unsigned l = 0; l < SHA2XX_MULTI_LANES_MAX; l++) {
+            sha256(data[l], len, digest[l]);
+        }
+    }
+    uint32_t time = ztimer_now(ZTIMER_USEC) - start;
+    printf("%8s: %7" PRIu32 " us, %7" PRIu32 " KiB/s\n", "sha256x4",
+           time, (uint32_t)((uint64_t)SIZE * RUNS * US_PER_SEC / 1024 / time));
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned j = 0; j < RUNS; j++) {
+        sha256_multi(data, len, digest, SHA2XX_MULTI_LANES_MAX);
+    }
+    time = ztimer_now(ZTIMER_USEC) - start;
+    printf("%8s: %7" PRIu32 " us, %7" PRIu32 " KiB/s\n", "multi-x4",
+           time, (uint32_t)((uint64_t)SIZE * RUNS * US_PER_SEC / 1024 / time));
+
+    /* both must agree */
+    for (unsigned l = 0; l < SHA2XX_MULTI_LANES_MAX; l++) {
+        sha256(data[l], len, _digest);
+        expect(memcmp(_digest, digests[l], SHA256_DIGEST_LENGTH) == 0);
+    }
+
+    puts("TEST PASSED");
+    return 0;
+}
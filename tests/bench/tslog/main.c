@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Append time and flash wear of the time-series ring log
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "kernel_defines.h"
+#include "mtd_emulated.h"
+#include "test_utils/expect.h"
+#include "tslog.h"
+#include "ztimer.h"
+
+#if IS_USED(MODULE_LITTLEFS2)
+#include <fcntl.h>
+#include "fs/littlefs2_fs.h"
+#include "vfs.h"
+#endif
+
+#ifndef SAMPLES
+#define SAMPLES         (4096U) /**< records appended */
+#endif
+
+#ifndef SAMPLE_SIZE
+#define SAMPLE_SIZE     (8U)    /**< payload of a record */
+#endif
+
+#define SECTOR_COUNT    (32)
+#define PAGE_PER_SECTOR (16)
+#define PAGE_SIZE       (256)
+
+MTD_EMULATED_DEV(0, SECTOR_COUNT, PAGE_PER_SECTOR, PAGE_SIZE);
+
+#define _dev (&mtd_emulated_dev0.base)
+
+static mtd_desc_t _counting_driver;
+static uint32_t _written;
+static uint32_t _erased;
+
+static int _count_write_page(mtd_dev_t *dev, const void *src, uint32_t page,
+                             uint32_t offset, uint32_t size)
+{
+    int res = _mtd_emulated_driver.write_page(dev, src, page, offset, size);
+
+    if (res > 0) {
+        _written += res;
+    }
+    return res;
+}
+
+static int _count_erase_sector(mtd_dev_t *dev, uint32_t sector, uint32_t count)
+{
+    _erased += count;
+    return _mtd_emulated_driver.erase_sector(dev, sector, count);
+}
+
+static void _reset(void)
+{
+    _written = 0;
+    _erased = 0;
+}
+
+static void _print(const char *name, uint32_t time)
+{
+    printf("%s: %" PRIu32 " us for all appends, %" PRIu32 " bytes written, "
+           "%" PRIu32 " sectors erased\n",
+           name, time, _written, _erased);
+}
+
+static void _sample(uint32_t i, uint8_t *buf)
+{
+    memset(buf, i, SAMPLE_SIZE);
+    memcpy(buf, &i, sizeof(i));
+}
+
+static void _bench_tslog(void)
+{
+    static tslog_t log;
+    uint8_t buf[SAMPLE_SIZE];
+    tslog_iter_t it;
+    uint32_t ts;
+
+    expect(tslog_init(&log, _dev, 0, SECTOR_COUNT) == 0);
+    expect(tslog_format(&log) == 0);
+    _reset();
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (uint32_t i = 0; i < SAMPLES; i++) {
+        _sample(i, buf);
+        expect(tslog_append(&log, i, buf, sizeof(buf)) == 0);
+    }
+    _print("tslog", ztimer_now(ZTIMER_USEC) - start);
+
+    start = ztimer_now(ZTIMER_USEC);
+    expect(tslog_seek(&log, &it, SAMPLES / 2) == 0);
+    for (uint32_t i = 0; i < SAMPLES / 16; i++) {
+        expect(tslog_read(&log, &it, &ts, buf, sizeof(buf)) == SAMPLE_SIZE);
+        expect(ts == SAMPLES / 2 + i);
+    }
+    printf("tslog: %" PRIu32 " us to seek and read %u records\n",
+           ztimer_now(ZTIMER_USEC) - start, SAMPLES / 16);
+}
+
+#if IS_USED(MODULE_LITTLEFS2)
+static void _bench_littlefs2(void)
+{
+    static littlefs2_desc_t fs = { .dev = _dev };
+    static vfs_mount_t mnt = {
+        .fs = &littlefs2_file_system,
+        .mount_point = "/lfs",
+        .private_data = &fs,
+    };
+    uint8_t buf[sizeof(uint32_t) + SAMPLE_SIZE];
+
+    expect(vfs_format(&mnt) == 0);
+    expect(vfs_mount(&mnt) == 0);
+    _reset();
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (uint32_t i = 0; i < SAMPLES; i++) {
+        /* the file system has no timestamps, store them with the sample */
+        memcpy(buf, &i, sizeof(i));
+        _sample(i, &buf[sizeof(i)]);
+
+        int fd = vfs_open("/lfs/log", O_CREAT | O_WRONLY | O_APPEND, 0);
+        expect(fd >= 0);
+        expect(vfs_write(fd, buf, sizeof(buf)) == sizeof(buf));
+        expect(vfs_close(fd) == 0);
+    }
+    _print("littlefs2", ztimer_now(ZTIMER_USEC) - start);
+
+    vfs_umount(&mnt, false);
+}
+#endif
+
+int main(void)
+{
+    _counting_driver = _mtd_emulated_driver;
+    _counting_driver.write_page = _count_write_page;
+    _counting_driver.erase_sector = _count_erase_sector;
+    _dev->driver = &_counting_driver;
+
+    puts("tslog benchmark.");
+    printf("%u samples of %u bytes\n", SAMPLES, SAMPLE_SIZE);
+
+    _bench_tslog();
+#if IS_USED(MODULE_LITTLEFS2)
+    _bench_littlefs2();
+#endif
+
+    puts("TEST PASSED");
+    return 0;
+}
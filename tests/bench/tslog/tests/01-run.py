@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2024 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("tslog benchmark.\r\n")
+    child.expect(r"\d+ samples of \d+ bytes\r\n")
+    child.expect(r"tslog: \d+ us for all appends, \d+ bytes written, "
+                 r"\d+ sectors erased\r\n", timeout=60)
+    child.expect(r"tslog: \d+ us to seek and read \d+ records\r\n")
+    child.expect_exact("TEST PASSED", timeout=120)
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -20,6 +20,8 @@
 
 #include <stdio.h>
 
+#include "container.h"
+#include "event/timeout_callback.h"
 #include "test_utils/expect.h"
 
 #include "msg.h"
@@ -46,8 +48,25 @@
 #define SPREAD  (10LU)
 #endif
 
+#ifndef NUMOF_ISR_TIMERS
+#define NUMOF_ISR_TIMERS    (8U)
+#endif
+
+/* time each callback of the ISR latency benchmarks is busy in microseconds */
+#ifndef ISR_WORK_US
+#define ISR_WORK_US         (50U)
+#endif
+
 static ztimer_t _timers[NUMOF_TIMERS];
 
+/* numbers of concurrently active timers for the sweep benchmarks */
+static const unsigned _sweep[] = { 10, 100, 1000 };
+
+static ztimer_t _isr_timers[NUMOF_ISR_TIMERS];
+static event_timeout_callback_t _isr_events[NUMOF_ISR_TIMERS];
+static event_queue_t _queue;
+static unsigned _isr_work_done;
+
 /* This variable is set by any timer that actually triggers.  As the test is
  * only testing set/remove/now operations, timers are not supposed to trigger.
  * Thus, after every test there's an 'expect(!_triggers)'
@@ -86,11 +105,54 @@ static void _timer_remove(unsigned n)
     ztimer_remove(ZTIMER, &_timers[n]);
 }
 
+/* maps 0..numof-1 onto a permutation of itself, as 7919 is a prime not
+ * dividing any of the sweep sizes */
+static unsigned _scrambled(unsigned n, unsigned numof)
+{
+    return (n * 7919UL) % numof;
+}
+
+static void _isr_work(void *arg)
+{
+    (void)arg;
+    ztimer_spin(ZTIMER_USEC, ISR_WORK_US);
+    _isr_work_done++;
+}
+
+/* busy loops for @p duration microseconds and returns the longest time the
+ * loop was interrupted */
+static uint32_t _max_blocked(uint32_t duration)
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    uint32_t last = start;
+    uint32_t max = 0;
+
+    while (last - start < duration) {
+        uint32_t now = ztimer_now(ZTIMER_USEC);
+
+        if (now - last > max) {
+            max = now - last;
+        }
+        last = now;
+    }
+
+    return max;
+}
+
 static void _print_result(const char *desc, unsigned n, uint32_t total)
 {
     printf("%30s %8"PRIu32" / %u = %"PRIu32"\n", desc, total, n, total/n);
 }
 
+static void _sweep_result(const char *desc, unsigned numof, unsigned n,
+                          uint32_t total)
+{
+    char buf[32];
+
+    snprintf(buf, sizeof(buf), "%s %u", desc, numof);
+    _print_result(buf, n, total);
+}
+
 int main(void)
 {
     puts("ztimer benchmark application.\n");
@@ -290,6 +352,88 @@ int main(void)
 
     _print_result("sizeof(ztimer_t)", NUMOF_TIMERS, sizeof(_timers));
 
+    /*
+     * test set() / remove() with an increasing number of active timers. The
+     * timers are set in scrambled order, so they don't just get appended.
+     *
+     */
+    for (unsigned i = 0; i < ARRAY_SIZE(_sweep); i++) {
+        unsigned numof = _sweep[i];
+
+        if (numof > NUMOF_TIMERS) {
+            break;
+        }
+
+        before = ztimer_now(ZTIMER_USEC);
+        _base = BASE  - (before - start);
+        for (n = 0; n < numof; n++) {
+            _timer_set(_scrambled(n, numof));
+        }
+
+        diff = ztimer_now(ZTIMER_USEC) - before;
+
+        _sweep_result("set() scrambled", numof, numof, diff);
+        expect(!_triggers);
+
+        before = ztimer_now(ZTIMER_USEC);
+        _base = BASE  - (before - start);
+        for (n = 0; n < REPEAT; n++) {
+            _timer_remove(_scrambled(n, numof));
+            _timer_set(_scrambled(n, numof));
+        }
+
+        diff = ztimer_now(ZTIMER_USEC) - before;
+
+        _sweep_result("remove() + set()", numof, REPEAT, diff);
+        expect(!_triggers);
+
+        before = ztimer_now(ZTIMER_USEC);
+        for (n = 0; n < numof; n++) {
+            _timer_remove(_scrambled(n, numof));
+        }
+
+        diff = ztimer_now(ZTIMER_USEC) - before;
+
+        _sweep_result("remove() scrambled", numof, numof, diff);
+        expect(!_triggers);
+    }
+
+    /*
+     * test the time spent in the ISR if the callbacks of NUMOF_ISR_TIMERS
+     * timers that trigger at the same time do ISR_WORK_US of work each, when
+     * executed by the ISR vs. when deferred to an event queue
+     *
+     */
+    for (n = 0; n < NUMOF_ISR_TIMERS; n++) {
+        _isr_timers[n].callback = _isr_work;
+        ztimer_set(ZTIMER_USEC, &_isr_timers[n], 1000);
+    }
+
+    diff = _max_blocked(1000 + 2 * NUMOF_ISR_TIMERS * ISR_WORK_US);
+
+    expect(_isr_work_done == NUMOF_ISR_TIMERS);
+    _print_result("ISR duration direct", NUMOF_ISR_TIMERS, diff);
+
+    _isr_work_done = 0;
+    event_queue_init(&_queue);
+    for (n = 0; n < NUMOF_ISR_TIMERS; n++) {
+        event_timeout_callback_init(&_isr_events[n], ZTIMER_USEC, &_queue,
+                                    _isr_work, NULL);
+        event_timeout_callback_set(&_isr_events[n], 1000);
+    }
+
+    diff = _max_blocked(1000 + 2 * NUMOF_ISR_TIMERS * ISR_WORK_US);
+
+    expect(_isr_work_done == 0);
+    _print_result("ISR duration deferred", NUMOF_ISR_TIMERS, diff);
+
+    /* now execute the deferred callbacks */
+    event_t *event;
+    while ((event = event_get(&_queue))) {
+        event->handler(event);
+    }
+    expect(_isr_work_done == NUMOF_ISR_TIMERS);
+
     puts("done.");
 
     return 0;
@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       ztimer64 set / remove / now benchmark application
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "test_utils/expect.h"
+
+#include "ztimer.h"
+#include "ztimer64.h"
+
+#ifndef NUMOF_TIMERS
+#define NUMOF_TIMERS   (100U)
+#endif
+
+#ifndef REPEAT
+#define REPEAT   (1000U)
+#endif
+
+#ifndef BASE
+#define BASE    (10000000LU)
+#endif
+
+#ifndef SPREAD
+#define SPREAD  (10LU)
+#endif
+
+static ztimer64_t _timers[NUMOF_TIMERS];
+
+/* set by any timer that actually triggers, which none is supposed to */
+static unsigned _triggers;
+
+static void _callback(void *arg)
+{
+    unsigned *triggers = arg;
+    *triggers += 1;
+}
+
+static void _print_result(const char *desc, unsigned n, uint32_t total)
+{
+    printf("%30s %8"PRIu32" / %u = %"PRIu32"\n", desc, total, n, total/n);
+}
+
+int main(void)
+{
+    puts("ztimer64 benchmark application.\n");
+
+    unsigned n;
+    uint32_t before, diff;
+
+    for (n = 0; n < NUMOF_TIMERS; n++) {
+        _timers[n].callback = _callback;
+        _timers[n].arg = &_triggers;
+    }
+
+    /*
+     * test ztimer_now() of the base clock
+     *
+     */
+    before = ztimer_now(ZTIMER_USEC);
+    for (n = 0; n < REPEAT; n++) {
+        ztimer_now(ZTIMER_USEC);
+    }
+
+    diff = ztimer_now(ZTIMER_USEC) - before;
+
+    _print_result("ztimer_now()", REPEAT, diff);
+
+    /*
+     * test ztimer64_now()
+     *
+     */
+    before = ztimer_now(ZTIMER_USEC);
+    for (n = 0; n < REPEAT; n++) {
+        ztimer64_now(ZTIMER64_USEC);
+    }
+
+    diff = ztimer_now(ZTIMER_USEC) - before;
+
+    _print_result("ztimer64_now()", REPEAT, diff);
+
+    /*
+     * test setting / removing one timer REPEAT times
+     *
+     */
+    before = ztimer_now(ZTIMER_USEC);
+    for (n = 0; n < REPEAT; n++) {
+        ztimer64_set(ZTIMER64_USEC, &_timers[0], BASE);
+        ztimer64_remove(ZTIMER64_USEC, &_timers[0]);
+    }
+
+    diff = ztimer_now(ZTIMER_USEC) - before;
+
+    _print_result("set() + remove() one", REPEAT, diff);
+    expect(!_triggers);
+
+    /*
+     * test setting NUMOF_TIMERS timers with increasing targets
+     *
+     */
+    before = ztimer_now(ZTIMER_USEC);
+    for (n = 0; n < NUMOF_TIMERS; n++) {
+        ztimer64_set(ZTIMER64_USEC, &_timers[n], BASE + SPREAD * n);
+    }
+
+    diff = ztimer_now(ZTIMER_USEC) - before;
+
+    _print_result("set() many", NUMOF_TIMERS, diff);
+    expect(!_triggers);
+
+    /*
+     * test removing NUMOF_TIMERS timers (latest first)
+     *
+     */
+    before = ztimer_now(ZTIMER_USEC);
+    for (n = 0; n < NUMOF_TIMERS; n++) {
+        ztimer64_remove(ZTIMER64_USEC, &_timers[NUMOF_TIMERS - n - 1]);
+    }
+
+    diff = ztimer_now(ZTIMER_USEC) - before;
+
+    _print_result("remove() many", NUMOF_TIMERS, diff);
+    expect(!_triggers);
+
+    puts("done.");
+
+    return 0;
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       ztimer periodic jitter benchmark application
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "mutex.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+#include "ztimer/periodic.h"
+
+#ifndef INTERVAL_US
+#define INTERVAL_US     (1000U)
+#endif
+
+#ifndef REPEAT
+#define REPEAT          (2000U)
+#endif
+
+#ifndef OVERRUN_EVERY
+#define OVERRUN_EVERY   (100U)
+#endif
+
+static ztimer_periodic_t _timer;
+static mutex_t _done = MUTEX_INIT_LOCKED;
+static unsigned _count;
+static bool _overrun;
+
+static bool _callback(void *arg)
+{
+    (void)arg;
+
+    if (_overrun && !(_count % OVERRUN_EVERY)) {
+        ztimer_spin(ZTIMER_USEC, INTERVAL_US * 3 / 2);
+    }
+
+    if (++_count == REPEAT) {
+        mutex_unlock(&_done);
+        return !ZTIMER_PERIODIC_KEEP_GOING;
+    }
+    return ZTIMER_PERIODIC_KEEP_GOING;
+}
+
+static void _run(const char *desc, bool overrun, bool skip)
+{
+    printf("%s:\n", desc);
+
+    _count = 0;
+    _overrun = overrun;
+    ztimer_periodic_init(ZTIMER_USEC, &_timer, _callback, NULL, INTERVAL_US);
+    ztimer_periodic_skip_overruns(&_timer, skip);
+    ztimer_periodic_start(&_timer);
+    mutex_lock(&_done);
+
+    ztimer_periodic_jitter_print(&_timer);
+    if (overrun) {
+        expect(ztimer_periodic_overruns(&_timer) >= REPEAT / OVERRUN_EVERY);
+    }
+}
+
+int main(void)
+{
+    puts("ztimer periodic jitter benchmark application.\n");
+
+    ztimer_acquire(ZTIMER_USEC);
+    _run("no load", false, false);
+    _run("overruns, catching up", true, false);
+    _run("overruns, skipping", true, true);
+    ztimer_release(ZTIMER_USEC);
+
+    puts("done.");
+
+    return 0;
+}
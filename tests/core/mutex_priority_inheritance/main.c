@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for nested and chained priority inheritance
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "mutex.h"
+#include "thread.h"
+
+#define PRIO_MAIN   (THREAD_PRIORITY_MAIN)
+
+static mutex_t mtx_a = MUTEX_INIT;
+static mutex_t mtx_b = MUTEX_INIT;
+static mutex_t mtx_c = MUTEX_INIT;
+
+static char stacks[2][THREAD_STACKSIZE_SMALL];
+static unsigned failures;
+static unsigned prio_after_unlock;
+
+static void _expect_prio(const char *step, kernel_pid_t pid, unsigned prio)
+{
+    unsigned actual = thread_get(pid)->priority;
+
+    printf("%s: prio = %u (expected %u)\n", step, actual, prio);
+    if (actual != prio) {
+        failures++;
+    }
+}
+
+static void *_lock_unlock(void *arg)
+{
+    mutex_t *mutex = arg;
+
+    mutex_lock(mutex);
+    mutex_unlock(mutex);
+
+    return NULL;
+}
+
+static void *_lock_sleep_unlock(void *arg)
+{
+    mutex_t *mutex = arg;
+
+    mutex_lock(mutex);
+    thread_sleep();
+    mutex_unlock(mutex);
+    prio_after_unlock = thread_get_active()->priority;
+
+    return NULL;
+}
+
+static void *_lock_chained(void *arg)
+{
+    (void)arg;
+
+    /* lock mtx_b, then block on mtx_c held by main */
+    mutex_lock(&mtx_b);
+    mutex_lock(&mtx_c);
+    mutex_unlock(&mtx_c);
+    mutex_unlock(&mtx_b);
+
+    return NULL;
+}
+
+static kernel_pid_t _spawn(unsigned idx, unsigned prio,
+                           thread_task_func_t func, void *arg)
+{
+    return thread_create(stacks[idx], sizeof(stacks[idx]), prio, 0,
+                         func, arg, "waiter");
+}
+
+static void _test_nested(void)
+{
+    kernel_pid_t me = thread_getpid();
+
+    puts("nested locks");
+    mutex_lock(&mtx_a);
+    mutex_lock(&mtx_b);
+    _expect_prio("locked a and b", me, PRIO_MAIN);
+
+    _spawn(0, PRIO_MAIN - 1, _lock_unlock, &mtx_a);
+    _expect_prio("waiter on a", me, PRIO_MAIN - 1);
+
+    _spawn(1, PRIO_MAIN - 3, _lock_unlock, &mtx_b);
+    _expect_prio("waiter on b", me, PRIO_MAIN - 3);
+
+    mutex_unlock(&mtx_b);
+    _expect_prio("unlocked b", me, PRIO_MAIN - 1);
+
+    mutex_unlock(&mtx_a);
+    _expect_prio("unlocked a", me, PRIO_MAIN);
+}
+
+static void _test_chained(void)
+{
+    kernel_pid_t me = thread_getpid();
+
+    puts("chained locks");
+    mutex_lock(&mtx_c);
+
+    kernel_pid_t mid = _spawn(0, PRIO_MAIN - 1, _lock_chained, NULL);
+    _expect_prio("waiter on c", me, PRIO_MAIN - 1);
+
+    _spawn(1, PRIO_MAIN - 3, _lock_unlock, &mtx_b);
+    _expect_prio("waiter on b (owner)", mid, PRIO_MAIN - 3);
+    _expect_prio("waiter on b (chain)", me, PRIO_MAIN - 3);
+
+    mutex_unlock(&mtx_c);
+    _expect_prio("unlocked c", me, PRIO_MAIN);
+}
+
+static void _test_handover(void)
+{
+    kernel_pid_t me = thread_getpid();
+
+    puts("handover");
+    mutex_lock(&mtx_a);
+
+    kernel_pid_t owner = _spawn(0, PRIO_MAIN - 1, _lock_sleep_unlock, &mtx_a);
+    _expect_prio("waiter on a", me, PRIO_MAIN - 1);
+
+    /* ownership is passed on to the waiter, which then sleeps holding it */
+    mutex_unlock(&mtx_a);
+    _expect_prio("unlocked a", me, PRIO_MAIN);
+
+    _spawn(1, PRIO_MAIN - 3, _lock_unlock, &mtx_a);
+    _expect_prio("waiter on a (new owner)", owner, PRIO_MAIN - 3);
+    _expect_prio("waiter on a (old owner)", me, PRIO_MAIN);
+
+    thread_wakeup(owner);
+    printf("new owner unlocked a: prio = %u (expected %u)\n",
+           prio_after_unlock, PRIO_MAIN - 1);
+    if (prio_after_unlock != PRIO_MAIN - 1) {
+        failures++;
+    }
+}
+
+int main(void)
+{
+    _test_nested();
+    _test_chained();
+    _test_handover();
+
+    if (failures) {
+        puts("TEST FAILED");
+    }
+    else {
+        puts("TEST PASSED");
+    }
+
+    return 0;
+}
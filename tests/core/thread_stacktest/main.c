@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test stack usage measurement and stack reclaiming
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "test_utils/expect.h"
+#include "thread.h"
+
+#define RESERVE     (256U)
+
+static char _stack[THREAD_STACKSIZE_LARGE + THREAD_EXTRA_STACKSIZE_PRINTF];
+
+static void *_thread(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        /* use a bit of stack */
+        volatile char buf[64];
+        memset((char *)buf, 0x55, sizeof(buf));
+        thread_sleep();
+    }
+
+    return NULL;
+}
+
+int main(void)
+{
+    puts("thread_stacktest");
+
+    kernel_pid_t pid = thread_create(_stack, sizeof(_stack),
+                                     THREAD_PRIORITY_MAIN - 1,
+                                     THREAD_CREATE_STACKTEST,
+                                     _thread, NULL, "stacktest");
+    thread_t *thread = thread_get(pid);
+
+    size_t size = thread_get_stacksize(thread);
+    size_t free = thread_measure_stack_free(thread);
+    size_t free_fast = thread_measure_stack_free_fast(thread);
+
+    printf("size: %u free: %u free_fast: %u\n",
+           (unsigned)size, (unsigned)free, (unsigned)free_fast);
+    expect(free > 0);
+    expect(free < size);
+    /* the fast estimate never reports more free stack */
+    expect(free_fast <= free);
+    expect(free - free_fast <
+           CONFIG_THREAD_STACKTEST_FAST_STRIDE * sizeof(uintptr_t));
+    puts("measure: OK");
+
+    size_t reclaimed;
+    char *mem = thread_stack_reclaim(thread, RESERVE, &reclaimed);
+    expect(mem == _stack);
+    expect(reclaimed > 0);
+    expect(thread_get_stacksize(thread) == size - reclaimed);
+    expect((char *)thread_get_stackstart(thread) == mem + reclaimed);
+    /* the remaining stack still has the reserve left */
+    expect(thread_measure_stack_free(thread) >= RESERVE);
+
+    /* the reclaimed memory can be used without disturbing the thread */
+    memset(mem, 0xaa, reclaimed);
+    for (unsigned i = 0; i < 3; i++) {
+        thread_wakeup(pid);
+    }
+    expect(thread_measure_stack_free(thread) >= RESERVE);
+    printf("reclaimed: %u\n", (unsigned)reclaimed);
+
+    /* nothing left to reclaim beyond the reserve */
+    expect(thread_stack_reclaim(thread, RESERVE, &reclaimed) == NULL);
+    expect(reclaimed == 0);
+    puts("reclaim: OK");
+
+    puts("TEST PASSED");
+    return 0;
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief Test application for the mpu_thread_regions pseudo-module
+ *
+ * @author RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "cpu.h"
+#include "msg.h"
+#include "mpu.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define ROUND_TRIPS     (10000U)
+#define POOL_SIZE       (512U)
+
+/* private data of the isolated thread, only it may access the pool */
+static uint8_t _pool[POOL_SIZE] __attribute__((aligned(POOL_SIZE)));
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+
+static void *_isolated(void *arg)
+{
+    (void)arg;
+    msg_t m;
+
+    while (1) {
+        msg_receive(&m);
+        _pool[m.content.value % POOL_SIZE]++;
+        msg_reply(&m, &m);
+    }
+
+    return NULL;
+}
+
+int main(void)
+{
+    puts("\nMPU Thread Regions Test\n");
+
+    kernel_pid_t pid = thread_create(_stack, sizeof(_stack),
+                                     THREAD_PRIORITY_MAIN - 1, 0,
+                                     _isolated, NULL, "isolated");
+
+#ifdef MODULE_MPU_THREAD_REGIONS
+    /* deny all access to the pool, but let the isolated thread use it */
+    mpu_configure(MPU_THREAD_REGIONS_FIRST - 1, (uintptr_t)_pool,
+                  MPU_ATTR(1, AP_NO_NO, 0, 1, 0, 0, MPU_SIZE_512B));
+    mpu_thread_region_set(pid, 0, (uintptr_t)_pool,
+                          MPU_ATTR(1, AP_RW_RW, 0, 1, 0, 0, MPU_SIZE_512B));
+    puts("Per-thread MPU regions are used.");
+#else
+    puts("Per-thread MPU regions are not used.");
+#endif
+
+    msg_t m;
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < ROUND_TRIPS; i++) {
+        m.content.value = i;
+        msg_send_receive(&m, &m, pid);
+    }
+    uint32_t time = ztimer_now(ZTIMER_USEC) - start;
+
+    /* each round trip consists of two context switches */
+    printf("%u round trips in %" PRIu32 " us, %" PRIu32 " ns per switch\n",
+           ROUND_TRIPS, time, (time * 1000) / (2 * ROUND_TRIPS));
+
+#ifdef MODULE_MPU_THREAD_REGIONS
+    puts("Accessing the private data of the isolated thread from main,");
+    puts("expect the MEM MANAGE HANDLER to trigger a kernel panic.");
+    printf("value = %u\n", _pool[0]);
+    puts("Test failed.");
+#else
+    puts("Test done.");
+#endif
+
+    return 0;
+}
@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2024 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("MPU Thread Regions Test\r\n")
+    child.expect(r"\d+ round trips in \d+ us, \d+ ns per switch\r\n")
+    if child.expect_exact(["expect the MEM MANAGE HANDLER to trigger a kernel panic.",
+                           "Test done."]) == 0:
+        child.expect(r".*RIOT kernel panic:")
+        child.expect_exact("MEM MANAGE HANDLER\r\n")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=30))
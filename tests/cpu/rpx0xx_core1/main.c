@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for running code on the second core of the
+ *              RP2040, measuring the latency of the inter-core FIFOs
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "mutex.h"
+#include "periph_cpu.h"
+#include "ztimer.h"
+
+#include "test_utils/expect.h"
+
+#define ROUND_TRIPS     (10000U)
+
+static uint32_t _core1_stack[256];
+static mutex_t _reply = MUTEX_INIT_LOCKED;
+static uint32_t _last;
+
+static void _echo(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        core_fifo_push(core_fifo_pop() + 1);
+    }
+}
+
+static void _doorbell(void *arg)
+{
+    while (core_fifo_try_pop(&_last)) { }
+    mutex_unlock(arg);
+}
+
+static uint32_t _ns_per_round_trip(uint32_t start)
+{
+    return (ztimer_now(ZTIMER_USEC) - start) * 1000LU / ROUND_TRIPS;
+}
+
+int main(void)
+{
+    core1_start(_echo, NULL, _core1_stack, sizeof(_core1_stack));
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (uint32_t i = 0; i < ROUND_TRIPS; i++) {
+        core_fifo_push(i);
+        expect(core_fifo_pop() == i + 1);
+    }
+    printf("polling: %" PRIu32 " ns per round trip\n", _ns_per_round_trip(start));
+
+    core_fifo_set_cb(_doorbell, &_reply);
+    start = ztimer_now(ZTIMER_USEC);
+    for (uint32_t i = 0; i < ROUND_TRIPS; i++) {
+        core_fifo_push(i);
+        mutex_lock(&_reply);
+        expect(_last == i + 1);
+    }
+    printf("interrupt and thread wake up: %" PRIu32 " ns per round trip\n",
+           _ns_per_round_trip(start));
+
+    core_fifo_set_cb(NULL, NULL);
+    core1_stop();
+    puts("SUCCESS");
+
+    return 0;
+}
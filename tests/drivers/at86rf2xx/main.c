@@ -18,6 +18,7 @@
  * @}
  */
 
+#include <inttypes.h>
 #include <stdio.h>
 
 #include "at86rf2xx.h"
@@ -68,6 +69,24 @@ static const shell_command_t shell_commands[] = {
 };
 #endif
 
+#if IS_USED(MODULE_AT86RF2XX_SPI_STATS)
+static int spistats(int argc, char **argv)
+{
+    (void)argc;
+    (void)argv;
+
+    /* send or receive a single frame between two calls to get the per frame
+     * count */
+    printf("SPI bus acquisitions since last call: %" PRIu32 "\n",
+           at86rf2xx_spi_acquisitions);
+    at86rf2xx_spi_acquisitions = 0;
+    return 0;
+}
+
+SHELL_COMMAND(spistats, "Print and reset the number of SPI bus acquisitions",
+              spistats);
+#endif
+
 int netdev_ieee802154_minimal_init_devs(netdev_event_cb_t cb) {
 
     puts("Initializing AT86RF2XX devices");
@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       mtd_async module test
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "mtd_async.h"
+#include "mtd_emulated.h"
+#include "mutex.h"
+
+#define SECTOR_COUNT    4
+#define PAGE_PER_SECTOR 4
+#define PAGE_SIZE       64
+
+MTD_EMULATED_DEV(0, SECTOR_COUNT, PAGE_PER_SECTOR, PAGE_SIZE);
+
+#define _dev (&mtd_emulated_dev0.base)
+
+static mtd_async_req_t _reqs[3];
+static mtd_async_req_t *_completed[ARRAY_SIZE(_reqs)];
+static unsigned _completed_numof;
+static unsigned _expected_numof;
+static mutex_t _done = MUTEX_INIT_LOCKED;
+
+static uint8_t _wbuf[PAGE_SIZE];
+static uint8_t _rbuf[PAGE_SIZE];
+
+static void _req_done(mtd_async_req_t *req, void *arg)
+{
+    (void)arg;
+
+    _completed[_completed_numof++] = req;
+    if (_completed_numof == _expected_numof) {
+        mutex_unlock(&_done);
+    }
+}
+
+static void _wait(unsigned numof)
+{
+    _expected_numof = numof;
+    mutex_lock(&_done);
+}
+
+static void test_mtd_async_sequence(void)
+{
+    memset(_wbuf, 0xAA, sizeof(_wbuf));
+    memset(_rbuf, 0, sizeof(_rbuf));
+
+    mtd_async_erase_sector(&_reqs[0], _dev, 1, 1, _req_done, NULL);
+    mtd_async_write_page_raw(&_reqs[1], _dev, _wbuf, PAGE_PER_SECTOR, 0, sizeof(_wbuf),
+                             _req_done, NULL);
+    mtd_async_read_page(&_reqs[2], _dev, _rbuf, PAGE_PER_SECTOR, 0, sizeof(_rbuf),
+                        _req_done, NULL);
+
+    /* the worker runs at a lower priority, nothing completes before we wait */
+    TEST_ASSERT_EQUAL_INT(0, _completed_numof);
+
+    _wait(ARRAY_SIZE(_reqs));
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_reqs); i++) {
+        TEST_ASSERT(_completed[i] == &_reqs[i]);
+        TEST_ASSERT_EQUAL_INT(0, _reqs[i].res);
+    }
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_wbuf, _rbuf, sizeof(_rbuf)));
+}
+
+static void test_mtd_async_error(void)
+{
+    mtd_async_read_page(&_reqs[0], _dev, _rbuf, SECTOR_COUNT * PAGE_PER_SECTOR, 0,
+                        sizeof(_rbuf), _req_done, NULL);
+    _wait(1);
+
+    TEST_ASSERT(_reqs[0].res < 0);
+}
+
+static void set_up(void)
+{
+    mtd_init(_dev);
+    _completed_numof = 0;
+}
+
+Test *tests_mtd_async_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_mtd_async_sequence),
+        new_TestFixture(test_mtd_async_error),
+    };
+
+    EMB_UNIT_TESTCALLER(mtd_async_tests, set_up, NULL, fixtures);
+
+    return (Test *)&mtd_async_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_mtd_async_tests());
+    TESTS_END();
+    return 0;
+}
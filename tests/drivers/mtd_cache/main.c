@@ -0,0 +1,244 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       mtd_cache module test
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <errno.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "macros/utils.h"
+#include "mtd.h"
+#include "mtd_cache.h"
+
+/* Test mock object implementing a simple RAM-based mtd that counts accesses */
+#define SECTOR_COUNT    4
+#define PAGE_PER_SECTOR 4
+#define PAGE_SIZE       64
+#define CACHE_PAGES     2
+
+#define MEMORY_SIZE     (PAGE_SIZE * PAGE_PER_SECTOR * SECTOR_COUNT)
+
+static uint8_t _dummy_memory[MEMORY_SIZE];
+static unsigned _reads;
+static unsigned _writes;
+
+static uint8_t _buffer[PAGE_SIZE];
+
+static int _init(mtd_dev_t *dev)
+{
+    (void)dev;
+
+    return 0;
+}
+
+static int _read_page(mtd_dev_t *dev, void *buff, uint32_t page, uint32_t offset, uint32_t size)
+{
+    uint32_t addr = page * dev->page_size + offset;
+
+    size = MIN(dev->page_size - offset, size);
+    memcpy(buff, _dummy_memory + addr, size);
+    _reads++;
+
+    return size;
+}
+
+static int _write_page(mtd_dev_t *dev, const void *buff, uint32_t page, uint32_t offset,
+                       uint32_t size)
+{
+    uint32_t addr = page * dev->page_size + offset;
+
+    size = MIN(dev->page_size - offset, size);
+    memcpy(_dummy_memory + addr, buff, size);
+    _writes++;
+
+    return size;
+}
+
+static int _erase_sector(mtd_dev_t *dev, uint32_t sector, uint32_t count)
+{
+    uint32_t sector_size = dev->pages_per_sector * dev->page_size;
+
+    memset(_dummy_memory + sector * sector_size, 0xff, count * sector_size);
+
+    return 0;
+}
+
+static const mtd_desc_t _driver = {
+    .init = _init,
+    .read_page = _read_page,
+    .write_page = _write_page,
+    .erase_sector = _erase_sector,
+};
+
+static mtd_dev_t _dev = {
+    .driver = &_driver,
+    .sector_count = SECTOR_COUNT,
+    .pages_per_sector = PAGE_PER_SECTOR,
+    .page_size = PAGE_SIZE,
+    .write_size = 1,
+};
+
+MTD_CACHE_DEV(_cache, &_dev, CACHE_PAGES, PAGE_SIZE);
+
+#define _cdev (&_cache.base)
+
+static void _test_mem(const uint8_t *mem, size_t len, uint8_t expected)
+{
+    for (size_t i = 0; i < len; i++) {
+        TEST_ASSERT_EQUAL_INT(expected, mem[i]);
+    }
+}
+
+static void test_mtd_cache_init(void)
+{
+    TEST_ASSERT_EQUAL_INT(SECTOR_COUNT, _cdev->sector_count);
+    TEST_ASSERT_EQUAL_INT(PAGE_PER_SECTOR, _cdev->pages_per_sector);
+    TEST_ASSERT_EQUAL_INT(PAGE_SIZE, _cdev->page_size);
+    TEST_ASSERT_EQUAL_INT(1, _cdev->write_size);
+}
+
+static void test_mtd_cache_read(void)
+{
+    /* small reads of one page only read it once */
+    for (unsigned i = 0; i < PAGE_SIZE; i += 8) {
+        TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_cdev, _buffer, 1, i, 8));
+    }
+    TEST_ASSERT_EQUAL_INT(1, _reads);
+
+    /* whole pages are not cached */
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_cdev, _buffer, 2, 0, PAGE_SIZE));
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_cdev, _buffer, 2, 0, PAGE_SIZE));
+    TEST_ASSERT_EQUAL_INT(3, _reads);
+}
+
+static void test_mtd_cache_write_coalesce(void)
+{
+    memset(_buffer, 0xAA, sizeof(_buffer));
+
+    for (unsigned i = 0; i < PAGE_SIZE; i += 4) {
+        TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(_cdev, _buffer, 1, i, 4));
+    }
+    TEST_ASSERT_EQUAL_INT(0, _writes);
+
+    /* reads see the pending data */
+    memset(_buffer, 0, sizeof(_buffer));
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(_cdev, _buffer, PAGE_SIZE, PAGE_SIZE));
+    _test_mem(_buffer, PAGE_SIZE, 0xAA);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_cache_flush(&_cache));
+    TEST_ASSERT_EQUAL_INT(1, _writes);
+    _test_mem(_dummy_memory + PAGE_SIZE, PAGE_SIZE, 0xAA);
+
+    /* nothing left to write back */
+    TEST_ASSERT_EQUAL_INT(0, mtd_cache_flush(&_cache));
+    TEST_ASSERT_EQUAL_INT(1, _writes);
+}
+
+static void test_mtd_cache_write_gap(void)
+{
+    memset(_buffer, 0xAA, sizeof(_buffer));
+
+    /* bytes must not be written twice, a gap forces a write back */
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(_cdev, _buffer, 0, 0, 8));
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(_cdev, _buffer, 0, 16, 8));
+    TEST_ASSERT_EQUAL_INT(1, _writes);
+    _test_mem(_dummy_memory, 8, 0xAA);
+    _test_mem(_dummy_memory + 8, PAGE_SIZE - 8, 0xFF);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_cache_flush(&_cache));
+    TEST_ASSERT_EQUAL_INT(2, _writes);
+    _test_mem(_dummy_memory + 8, 8, 0xFF);
+    _test_mem(_dummy_memory + 16, 8, 0xAA);
+}
+
+static void test_mtd_cache_lru(void)
+{
+    memset(_buffer, 0xAA, sizeof(_buffer));
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(_cdev, _buffer, 0, 0, 4));
+    memset(_buffer, 0xBB, sizeof(_buffer));
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(_cdev, _buffer, 1, 0, 4));
+
+    /* use page 0 again, page 1 is now least recently used */
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_cdev, _buffer, 0, 0, 4));
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_cdev, _buffer, 2, 0, 4));
+    TEST_ASSERT_EQUAL_INT(1, _writes);
+    _test_mem(_dummy_memory, 4, 0xFF);
+    _test_mem(_dummy_memory + PAGE_SIZE, 4, 0xBB);
+}
+
+static void test_mtd_cache_erase(void)
+{
+    memset(_buffer, 0xAA, sizeof(_buffer));
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(_cdev, _buffer, PAGE_PER_SECTOR, 0, 4));
+
+    /* pending writes to erased sectors are dropped */
+    TEST_ASSERT_EQUAL_INT(0, mtd_erase_sector(_cdev, 1, 1));
+    TEST_ASSERT_EQUAL_INT(0, mtd_cache_flush(&_cache));
+    TEST_ASSERT_EQUAL_INT(0, _writes);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_cdev, _buffer, PAGE_PER_SECTOR, 0, 4));
+    _test_mem(_buffer, 4, 0xFF);
+}
+
+static void test_mtd_cache_power(void)
+{
+    memset(_buffer, 0xAA, sizeof(_buffer));
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(_cdev, _buffer, 0, 0, 4));
+
+    /* the mock has no power control, but the cache is written back first */
+    TEST_ASSERT_EQUAL_INT(-ENOTSUP, mtd_power(_cdev, MTD_POWER_DOWN));
+    TEST_ASSERT_EQUAL_INT(1, _writes);
+    _test_mem(_dummy_memory, 4, 0xAA);
+}
+
+static void set_up(void)
+{
+    memset(_dummy_memory, 0xff, sizeof(_dummy_memory));
+    _cache.base.driver = &mtd_cache_driver;
+    mtd_init(_cdev);
+    _reads = 0;
+    _writes = 0;
+}
+
+Test *tests_mtd_cache_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_mtd_cache_init),
+        new_TestFixture(test_mtd_cache_read),
+        new_TestFixture(test_mtd_cache_write_coalesce),
+        new_TestFixture(test_mtd_cache_write_gap),
+        new_TestFixture(test_mtd_cache_lru),
+        new_TestFixture(test_mtd_cache_erase),
+        new_TestFixture(test_mtd_cache_power),
+    };
+
+    EMB_UNIT_TESTCALLER(mtd_cache_tests, set_up, NULL, fixtures);
+
+    return (Test *)&mtd_cache_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_mtd_cache_tests());
+    TESTS_END();
+    return 0;
+}
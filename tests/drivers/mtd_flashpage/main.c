@@ -292,6 +292,45 @@ static void test_mtd_aux_slot(void)
 }
 #endif
 
+#ifdef MODULE_MTD_FLASHPAGE_DEFERRED_ERASE
+static void test_mtd_deferred_erase(void)
+{
+    const char buf[] = "ABCDEFGHIJKLMNO";
+    char buf_read[sizeof(buf)];
+    uint8_t expected[sizeof(buf)];
+    const void *raw = flashpage_addr(LAST_AVAILABLE_PAGE);
+
+    memset(expected, FLASHPAGE_ERASE_STATE, sizeof(expected));
+    mtd_flashpage_flush();
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_write(dev, buf, TEST_ADDRESS1, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(0, mtd_erase(dev, TEST_ADDRESS1, FLASHPAGE_SIZE));
+
+    /* the erase thread runs at a lower priority than this one */
+    TEST_ASSERT_EQUAL_INT(0, memcmp(buf, raw, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(dev, buf_read, TEST_ADDRESS1, sizeof(buf_read)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(expected, buf_read, sizeof(buf_read)));
+
+    /* a write erases the page first */
+    TEST_ASSERT_EQUAL_INT(0, mtd_write(dev, buf, TEST_ADDRESS1 + 16, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(expected, raw, sizeof(expected)));
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(dev, buf_read, TEST_ADDRESS1 + 16, sizeof(buf_read)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(buf, buf_read, sizeof(buf_read)));
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_erase(dev, TEST_ADDRESS1, FLASHPAGE_SIZE));
+    mtd_flashpage_flush();
+    TEST_ASSERT_EQUAL_INT(0, memcmp(expected, (const uint8_t *)raw + 16, sizeof(expected)));
+
+#if CONFIG_MTD_FLASHPAGE_ERASE_COUNT
+    /* blank pages are not erased again */
+    uint16_t count = mtd_flashpage_erase_count(LAST_AVAILABLE_PAGE);
+    TEST_ASSERT_EQUAL_INT(0, mtd_erase(dev, TEST_ADDRESS1, FLASHPAGE_SIZE));
+    mtd_flashpage_flush();
+    TEST_ASSERT_EQUAL_INT(count, mtd_flashpage_erase_count(LAST_AVAILABLE_PAGE));
+#endif
+}
+#endif
+
 Test *tests_mtd_flashpage_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -302,6 +341,9 @@ Test *tests_mtd_flashpage_tests(void)
         new_TestFixture(test_mtd_write_read_page),
 #ifdef MODULE_PERIPH_FLASHPAGE_AUX
         new_TestFixture(test_mtd_aux_slot),
+#endif
+#ifdef MODULE_MTD_FLASHPAGE_DEFERRED_ERASE
+        new_TestFixture(test_mtd_deferred_erase),
 #endif
     };
 
@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief test C++ wrappers for packets and UDP socks
+ *
+ * @author RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <span>
+
+#include "net/ipv6/addr.h"
+#include "riot/pkt.hpp"
+#include "riot/udp_socket.hpp"
+
+#include "test_utils/expect.h"
+
+using namespace riot;
+
+static const uint8_t hdr[] = { 0xde, 0xad };
+static const uint8_t payload[] = { 'h', 'e', 'l', 'l', 'o' };
+
+int main() {
+  puts("\n************ C++ net wrapper test ***********");
+
+  puts("Packet ownership ...");
+  {
+    pkt p = pkt::add(payload, GNRC_NETTYPE_UNDEF);
+    expect(bool(p));
+    p = pkt::add(hdr, GNRC_NETTYPE_UNDEF, std::move(p));
+    expect(bool(p));
+    expect(p.size() == sizeof(hdr) + sizeof(payload));
+    expect(p->users == 1);
+    {
+      pkt other = p.share();
+      expect(p->users == 2);
+      expect(other.start_write());
+      // the copy of the first snip is now owned by other
+      expect(other.get() != p.get());
+      expect(p->users == 1);
+    }
+    pkt moved = std::move(p);
+    expect(!p);
+    expect(memcmp(moved.data().data(), hdr, sizeof(hdr)) == 0);
+  }
+  expect(gnrc_pktbuf_is_empty());
+  puts("Done\n");
+
+  puts("Failed allocation keeps the packet ...");
+  {
+    pkt p = pkt::add(payload, GNRC_NETTYPE_UNDEF);
+    pkt big = pkt::add(CONFIG_GNRC_PKTBUF_SIZE, GNRC_NETTYPE_UNDEF,
+                       std::move(p));
+    expect(!big);
+    expect(bool(p));
+  }
+  expect(gnrc_pktbuf_is_empty());
+  puts("Done\n");
+
+  puts("UDP scatter-gather send and zero-copy receive ...");
+  {
+    sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+    local.port = 12345;
+    sock_udp_ep_t remote = local;
+    memcpy(remote.addr.ipv6, &ipv6_addr_loopback, sizeof(remote.addr.ipv6));
+
+    udp_socket sock;
+    expect(sock.create(&local) == 0);
+    ssize_t sent = sock.send({ std::span<const uint8_t>{hdr},
+                               std::span<const uint8_t>{payload} }, &remote);
+    expect(sent == sizeof(hdr) + sizeof(payload));
+    {
+      auto buf = sock.recv_buf(1000000);
+      expect(bool(buf));
+      expect(buf.data().size() == sizeof(hdr) + sizeof(payload));
+      expect(memcmp(buf.data().data(), hdr, sizeof(hdr)) == 0);
+      expect(memcmp(buf.data().data() + sizeof(hdr), payload,
+                    sizeof(payload)) == 0);
+      expect(!gnrc_pktbuf_is_empty());
+    }
+    expect(gnrc_pktbuf_is_empty());
+
+    pkt p = pkt::add(payload, GNRC_NETTYPE_UNDEF);
+    expect(sock.send(p, &remote) == sizeof(payload));
+    uint8_t data[sizeof(payload)];
+    expect(sock.recv(data, 1000000) == sizeof(payload));
+    expect(memcmp(data, payload, sizeof(payload)) == 0);
+  }
+  expect(gnrc_pktbuf_is_empty());
+  puts("Done\n");
+
+  puts("Bye, bye.");
+  puts("******************************************");
+
+  return 0;
+}
@@ -0,0 +1,24 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2024 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("************ C++ net wrapper test ***********")
+    for test in ("Packet ownership ...",
+                 "Failed allocation keeps the packet ...",
+                 "UDP scatter-gather send and zero-copy receive ..."):
+        child.expect_exact(test)
+        child.expect_exact("Done")
+    child.expect_exact("Bye, bye.")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,255 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Test application for checksum offloading to network devices
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/af.h"
+#include "net/gnrc/netif/raw.h"
+#include "net/inet_csum.h"
+#include "net/ipv6/addr.h"
+#include "net/ipv6/hdr.h"
+#include "net/netdev_test.h"
+#include "net/protnum.h"
+#include "net/sock/udp.h"
+#include "net/udp.h"
+#include "test_utils/expect.h"
+
+#define NETIF_PRIO          (THREAD_PRIORITY_MAIN - 4)
+#define MAIN_QUEUE_SIZE     (8)
+#define TEST_PORT           (12345U)
+#define TEST_TIMEOUT_US     (100U * US_PER_MS)
+
+#define EXECUTE(test) \
+    puts("Executing " # test "()"); \
+    if (!test()) { \
+        puts(" + failed."); \
+        return 1; \
+    } \
+    else { \
+        puts(" + succeeded."); \
+    }
+
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static msg_t _main_msg_queue[MAIN_QUEUE_SIZE];
+
+static gnrc_netif_t _netif;
+static netdev_test_t _netdev_test;
+static sock_udp_t _sock;
+
+static const char _test_msg[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTU";
+
+/* IPv6 packet from fe80::1 to ff02::1, received or sent */
+typedef struct __attribute__((packed)) {
+    ipv6_hdr_t ipv6;
+    udp_hdr_t udp;
+    char payload[sizeof(_test_msg)];
+} _test_pkt_t;
+
+static _test_pkt_t _rx_pkt;
+static _test_pkt_t _tx_pkt;
+static unsigned _sends;
+
+/* the checksum is wrong, but the device claims to have verified it */
+static void _init_rx_pkt(void)
+{
+    const uint16_t udp_len = sizeof(_rx_pkt.udp) + sizeof(_rx_pkt.payload);
+
+    ipv6_hdr_set_version(&_rx_pkt.ipv6);
+    _rx_pkt.ipv6.len = byteorder_htons(udp_len);
+    _rx_pkt.ipv6.nh = PROTNUM_UDP;
+    _rx_pkt.ipv6.hl = 64;
+    ipv6_addr_set_link_local_prefix(&_rx_pkt.ipv6.src);
+    _rx_pkt.ipv6.src.u8[15] = 1;
+    ipv6_addr_set_all_nodes_multicast(&_rx_pkt.ipv6.dst,
+                                      IPV6_ADDR_MCAST_SCP_LINK_LOCAL);
+    _rx_pkt.udp.src_port = byteorder_htons(TEST_PORT);
+    _rx_pkt.udp.dst_port = byteorder_htons(TEST_PORT);
+    _rx_pkt.udp.length = byteorder_htons(udp_len);
+    memcpy(_rx_pkt.payload, _test_msg, sizeof(_test_msg));
+
+    uint16_t csum = ipv6_hdr_inet_csum(0, &_rx_pkt.ipv6, PROTNUM_UDP, udp_len);
+
+    csum = inet_csum(csum, (uint8_t *)&_rx_pkt.udp, udp_len);
+    _rx_pkt.udp.checksum = byteorder_htons(~csum ^ 0x5a5a);
+}
+
+static int test_flags(void)
+{
+    if (!(_netif.flags & GNRC_NETIF_FLAGS_TX_CSUM_OFFLOAD) ||
+        !(_netif.flags & GNRC_NETIF_FLAGS_RX_CSUM_OFFLOAD)) {
+        puts("Offload capabilities of the device not detected");
+        return 0;
+    }
+    return 1;
+}
+
+static int test_rx_skips_csum(void)
+{
+    char buf[sizeof(_test_msg)];
+
+    netdev_trigger_event_isr(&_netdev_test.netdev.netdev);
+    if (sock_udp_recv(&_sock, buf, sizeof(buf), TEST_TIMEOUT_US,
+                      NULL) != sizeof(_test_msg)) {
+        puts("Packet verified by the device was dropped");
+        return 0;
+    }
+    return 1;
+}
+
+static int test_tx_skips_csum(void)
+{
+    sock_udp_ep_t remote = { .family = AF_INET6, .port = TEST_PORT };
+
+    ipv6_addr_set_all_nodes_multicast((ipv6_addr_t *)&remote.addr.ipv6,
+                                      IPV6_ADDR_MCAST_SCP_LINK_LOCAL);
+    /* the network stack threads have a higher priority, so the packet has
+     * been handed to the device when sock_udp_send() returns */
+    if (sock_udp_send(&_sock, _test_msg, sizeof(_test_msg), &remote) < 0) {
+        puts("Could not send packet");
+        return 0;
+    }
+    if (_sends != 1) {
+        puts("Packet was not sent");
+        return 0;
+    }
+    if (_tx_pkt.udp.checksum.u16 != 0) {
+        puts("Checksum was calculated by the network stack");
+        return 0;
+    }
+    return 1;
+}
+
+static void _netdev_isr(netdev_t *dev)
+{
+    dev->event_callback(dev, NETDEV_EVENT_RX_COMPLETE);
+}
+
+static int _netdev_recv(netdev_t *dev, char *buf, int len, void *info)
+{
+    (void)dev;
+    (void)info;
+    if (buf == NULL) {
+        return sizeof(_rx_pkt);
+    }
+    if (len < (int)sizeof(_rx_pkt)) {
+        return -ENOBUFS;
+    }
+    memcpy(buf, &_rx_pkt, sizeof(_rx_pkt));
+    return sizeof(_rx_pkt);
+}
+
+static int _netdev_send(netdev_t *dev, const iolist_t *iolist)
+{
+    uint8_t *ptr = (uint8_t *)&_tx_pkt;
+    size_t len = 0;
+
+    (void)dev;
+    for (; iolist; iolist = iolist->iol_next) {
+        expect((len + iolist->iol_len) <= sizeof(_tx_pkt));
+        memcpy(ptr + len, iolist->iol_base, iolist->iol_len);
+        len += iolist->iol_len;
+    }
+    _sends++;
+    return len;
+}
+
+static int _netdev_get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    const uint16_t type = NETDEV_TYPE_ETHERNET;
+
+    (void)dev;
+    expect(max_len == sizeof(type));
+    memcpy(value, &type, sizeof(type));
+    return sizeof(type);
+}
+
+static int _netdev_get_max_pdu_size(netdev_t *dev, void *value, size_t max_len)
+{
+    const uint16_t pdu_size = 1500;
+
+    (void)dev;
+    expect(max_len == sizeof(pdu_size));
+    memcpy(value, &pdu_size, sizeof(pdu_size));
+    return sizeof(pdu_size);
+}
+
+static int _netdev_get_proto(netdev_t *dev, void *value, size_t max_len)
+{
+    const gnrc_nettype_t proto = GNRC_NETTYPE_IPV6;
+
+    (void)dev;
+    expect(max_len == sizeof(proto));
+    memcpy(value, &proto, sizeof(proto));
+    return sizeof(proto);
+}
+
+static int _netdev_get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    const uint8_t addr[] = { 0x13, 0x37, 0xac, 0xdc, 0xbe, 0xef };
+
+    (void)dev;
+    expect(max_len >= sizeof(addr));
+    memcpy(value, addr, sizeof(addr));
+    return sizeof(addr);
+}
+
+static int _netdev_get_csum_offload(netdev_t *dev, void *value, size_t max_len)
+{
+    const netopt_enable_t enable = NETOPT_ENABLE;
+
+    (void)dev;
+    expect(max_len == sizeof(enable));
+    memcpy(value, &enable, sizeof(enable));
+    return sizeof(enable);
+}
+
+int main(void)
+{
+    sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+
+    _init_rx_pkt();
+    msg_init_queue(_main_msg_queue, MAIN_QUEUE_SIZE);
+    netdev_test_setup(&_netdev_test, NULL);
+    netdev_test_set_isr_cb(&_netdev_test, _netdev_isr);
+    netdev_test_set_recv_cb(&_netdev_test, _netdev_recv);
+    netdev_test_set_send_cb(&_netdev_test, _netdev_send);
+    netdev_test_set_get_cb(&_netdev_test, NETOPT_DEVICE_TYPE, _netdev_get_device_type);
+    netdev_test_set_get_cb(&_netdev_test, NETOPT_MAX_PDU_SIZE, _netdev_get_max_pdu_size);
+    netdev_test_set_get_cb(&_netdev_test, NETOPT_PROTO, _netdev_get_proto);
+    netdev_test_set_get_cb(&_netdev_test, NETOPT_ADDRESS, _netdev_get_address);
+    netdev_test_set_get_cb(&_netdev_test, NETOPT_TX_CSUM_OFFLOAD,
+                           _netdev_get_csum_offload);
+    netdev_test_set_get_cb(&_netdev_test, NETOPT_RX_CSUM_OFFLOAD,
+                           _netdev_get_csum_offload);
+    gnrc_netif_raw_create(&_netif, _netif_stack, sizeof(_netif_stack), NETIF_PRIO,
+                          "netdev_test", &_netdev_test.netdev.netdev);
+    /* the device never signals a link up, which joins the group otherwise */
+    expect(gnrc_netif_ipv6_group_join(&_netif, &ipv6_addr_all_nodes_link_local) >= 0);
+    local.port = TEST_PORT;
+    expect(sock_udp_create(&_sock, &local, NULL, 0) == 0);
+
+    EXECUTE(test_flags);
+    EXECUTE(test_rx_skips_csum);
+    EXECUTE(test_tx_skips_csum);
+    puts("ALL TESTS SUCCESSFUL");
+
+    return 0;
+}
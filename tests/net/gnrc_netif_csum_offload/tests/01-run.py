@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2024 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for test in ("test_flags", "test_rx_skips_csum", "test_tx_skips_csum"):
+        child.expect_exact('Executing {}()'.format(test))
+        child.expect_exact(' + succeeded.')
+    child.expect_exact('ALL TESTS SUCCESSFUL')
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
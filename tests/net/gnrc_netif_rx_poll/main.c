@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Test application for polling network devices for received
+ *              frames
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "msg.h"
+#include "net/ethernet.h"
+#include "net/gnrc.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/netdev_test.h"
+#include "thread.h"
+
+#define _MAIN_MSG_QUEUE_SIZE (32)
+
+#define _TEST_PAYLOAD   "gO3Xt,fP)6* MR16"
+
+#define EXECUTE(test) \
+    puts("Executing " # test "()"); \
+    if (!test()) { \
+        puts(" + failed."); \
+        return 1; \
+    } \
+    else { \
+        puts(" + succeeded."); \
+    }
+
+static const uint8_t _test_src[] = { 0x41, 0x9b, 0x9f, 0x56, 0x36, 0x46 };
+static const uint8_t _dev_addr[] = { 0x6c, 0x5d, 0xff, 0x73, 0x84, 0x6f };
+
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static gnrc_netif_t _netif;
+static netdev_test_t _dev;
+static msg_t _main_msg_queue[_MAIN_MSG_QUEUE_SIZE];
+static unsigned _pending;
+static unsigned _isr_calls;
+
+/* all frames pending at the device are received after a single interrupt */
+static int _receive(unsigned num)
+{
+    gnrc_netreg_entry_t me = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
+                                                        thread_getpid());
+    int res = 1;
+
+    _pending = num;
+    _isr_calls = 0;
+    gnrc_netreg_register(GNRC_NETTYPE_UNDEF, &me);
+    netdev_trigger_event_isr(&_dev.netdev.netdev);
+    for (unsigned i = 0; i < num; i++) {
+        msg_t msg;
+
+        msg_receive(&msg);
+        if (msg.type != GNRC_NETAPI_MSG_TYPE_RCV) {
+            puts("Expected netapi receive message");
+            res = 0;
+            break;
+        }
+        gnrc_pktbuf_release(msg.content.ptr);
+    }
+    gnrc_netreg_unregister(GNRC_NETTYPE_UNDEF, &me);
+    if (res && ((_pending != 0) || (_isr_calls != 1))) {
+        printf("%u frames left after %u interrupts\n", _pending, _isr_calls);
+        res = 0;
+    }
+    return res;
+}
+
+static int test_poll_within_budget(void)
+{
+    return _receive(CONFIG_GNRC_NETIF_RX_POLL_BUDGET / 2);
+}
+
+static int test_poll_beyond_budget(void)
+{
+    return _receive(3 * CONFIG_GNRC_NETIF_RX_POLL_BUDGET);
+}
+
+/* netdev_test callbacks */
+static void _dev_isr(netdev_t *dev)
+{
+    _isr_calls++;
+    dev->event_callback(dev, NETDEV_EVENT_RX_COMPLETE);
+}
+
+static int _dev_recv(netdev_t *dev, char *buf, int len, void *info)
+{
+    ethernet_hdr_t *hdr = (ethernet_hdr_t *)buf;
+    int size = sizeof(ethernet_hdr_t) + sizeof(_TEST_PAYLOAD) - 1;
+
+    (void)dev;
+    (void)info;
+    if (_pending == 0) {
+        return 0;
+    }
+    if (buf == NULL) {
+        if (len > 0) {
+            _pending--;
+        }
+        return size;
+    }
+    _pending--;
+    if (len < size) {
+        return -ENOBUFS;
+    }
+    memcpy(hdr->dst, _dev_addr, ETHERNET_ADDR_LEN);
+    memcpy(hdr->src, _test_src, ETHERNET_ADDR_LEN);
+    hdr->type = byteorder_htons(ETHERTYPE_UNKNOWN);
+    memcpy(hdr + 1, _TEST_PAYLOAD, sizeof(_TEST_PAYLOAD) - 1);
+    return size;
+}
+
+static int _dev_get_addr(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    if (max_len < ETHERNET_ADDR_LEN) {
+        return -ENOBUFS;
+    }
+    memcpy(value, _dev_addr, ETHERNET_ADDR_LEN);
+    return ETHERNET_ADDR_LEN;
+}
+
+static int _dev_get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    if (max_len != sizeof(uint16_t)) {
+        return -EOVERFLOW;
+    }
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+int main(void)
+{
+    /* initialization */
+    gnrc_pktbuf_init();
+    msg_init_queue(_main_msg_queue, _MAIN_MSG_QUEUE_SIZE);
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_isr_cb(&_dev, _dev_isr);
+    netdev_test_set_recv_cb(&_dev, _dev_recv);
+    netdev_test_set_get_cb(&_dev, NETOPT_ADDRESS, _dev_get_addr);
+    netdev_test_set_get_cb(&_dev, NETOPT_DEVICE_TYPE, _dev_get_device_type);
+    if (gnrc_netif_ethernet_create(&_netif, _netif_stack, sizeof(_netif_stack),
+                                   THREAD_PRIORITY_MAIN - 1, "netdev_test",
+                                   &_dev.netdev.netdev) < 0) {
+        puts("Could not create interface");
+        return 1;
+    }
+
+    /* test execution */
+    EXECUTE(test_poll_within_budget);
+    EXECUTE(test_poll_beyond_budget);
+    puts("ALL TESTS SUCCESSFUL");
+
+    return 0;
+}
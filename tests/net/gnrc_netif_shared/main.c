@@ -0,0 +1,297 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Test application for network interfaces on a shared thread
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "msg.h"
+#include "net/ethernet.h"
+#include "net/gnrc.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/netdev_test.h"
+#include "thread.h"
+
+#define _NETIF_NUMOF    (2U)
+
+#define _MAIN_MSG_QUEUE_SIZE (4)
+
+#define _TEST_PAYLOAD   "gO3Xt,fP)6* MR161Auk?W^mTb\"LmY^Qc5w1h:C<+n(*/@4k("
+
+#define EXECUTE(test) \
+    puts("Executing " # test "()"); \
+    if (!test()) { \
+        puts(" + failed."); \
+        return 1; \
+    } \
+    else { \
+        puts(" + succeeded."); \
+    }
+
+static const uint8_t _test_dst[] = { 0xf5, 0x19, 0x9a, 0x1d, 0xd8, 0x8f };
+static const uint8_t _test_src[] = { 0x41, 0x9b, 0x9f, 0x56, 0x36, 0x46 };
+
+static uint8_t _dev_addr[_NETIF_NUMOF][ETHERNET_ADDR_LEN] = {
+    { 0x6c, 0x5d, 0xff, 0x73, 0x84, 0x6f },
+    { 0x6c, 0x5d, 0xff, 0x73, 0x84, 0x70 },
+};
+
+static gnrc_netif_t _netif[_NETIF_NUMOF];
+static netdev_test_t _dev[_NETIF_NUMOF];
+static msg_t _main_msg_queue[_MAIN_MSG_QUEUE_SIZE];
+static unsigned _sent[_NETIF_NUMOF];
+
+static unsigned _idx(netdev_t *dev)
+{
+    return container_of(dev, netdev_test_t, netdev.netdev) - _dev;
+}
+
+/* both interfaces get an identifier of their own, but no thread */
+static int test_pids(void)
+{
+    if (_netif[0].pid == _netif[1].pid) {
+        puts("Interfaces share a PID");
+        return 0;
+    }
+    for (unsigned i = 0; i < _NETIF_NUMOF; i++) {
+        if (!(_netif[i].flags & GNRC_NETIF_FLAGS_SHARED) ||
+            (thread_get(_netif[i].pid) != NULL)) {
+            printf("Interface %u is not shared\n", i);
+            return 0;
+        }
+        if (gnrc_netif_get_by_pid(_netif[i].pid) != &_netif[i]) {
+            printf("Interface %u not found by PID\n", i);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* netapi requests reach the device of the interface addressed */
+static int test_get_set_addr(void)
+{
+    static const uint8_t new_addr[] = { 0x71, 0x29, 0x5b, 0xc8, 0x52, 0x65 };
+    uint8_t tmp[ETHERNET_ADDR_LEN];
+
+    for (unsigned i = 0; i < _NETIF_NUMOF; i++) {
+        if ((gnrc_netapi_get(_netif[i].pid, NETOPT_ADDRESS, 0, tmp,
+                             sizeof(tmp)) != sizeof(tmp)) ||
+            (memcmp(tmp, _dev_addr[i], sizeof(tmp)) != 0)) {
+            printf("Got wrong address of interface %u\n", i);
+            return 0;
+        }
+    }
+    if (gnrc_netapi_set(_netif[1].pid, NETOPT_ADDRESS, 0, new_addr,
+                        sizeof(new_addr)) != sizeof(new_addr)) {
+        puts("Error setting device address");
+        return 0;
+    }
+    if (memcmp(_dev_addr[1], new_addr, sizeof(new_addr)) != 0) {
+        puts("Set address of the wrong device");
+        return 0;
+    }
+    if (memcmp(_dev_addr[0], new_addr, sizeof(new_addr)) == 0) {
+        puts("Set address of both devices");
+        return 0;
+    }
+    return 1;
+}
+
+static int _send(unsigned idx)
+{
+    gnrc_pktsnip_t *pkt, *hdr;
+    msg_t msg;
+
+    pkt = gnrc_pktbuf_add(NULL, _TEST_PAYLOAD, sizeof(_TEST_PAYLOAD) - 1,
+                          GNRC_NETTYPE_UNDEF);
+    hdr = gnrc_netif_hdr_build(NULL, 0, _test_dst, sizeof(_test_dst));
+    if ((pkt == NULL) || (hdr == NULL)) {
+        puts("Could not allocate packet");
+        return 0;
+    }
+    pkt = gnrc_pkt_prepend(pkt, hdr);
+    if (gnrc_neterr_reg(pkt) != 0) {
+        puts("Can not register for error reporting");
+        return 0;
+    }
+    if (gnrc_netapi_send(_netif[idx].pid, pkt) < 1) {
+        puts("Could not send packet");
+        return 0;
+    }
+    msg_receive(&msg);
+    if ((msg.type != GNRC_NETERR_MSG_TYPE) ||
+        (msg.content.value != GNRC_NETERR_SUCCESS)) {
+        puts("Error sending packet");
+        return 0;
+    }
+    return 1;
+}
+
+/* packets are sent by the device of the interface addressed */
+static int test_send(void)
+{
+    if (!_send(1) || (_sent[0] != 0) || (_sent[1] != 1)) {
+        puts("Packet not sent by interface 1");
+        return 0;
+    }
+    if (!_send(0) || (_sent[0] != 1) || (_sent[1] != 1)) {
+        puts("Packet not sent by interface 0");
+        return 0;
+    }
+    return 1;
+}
+
+/* frames received on both interfaces are passed up with the right interface */
+static int test_receive(void)
+{
+    gnrc_netreg_entry_t me = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
+                                                        thread_getpid());
+    bool received[_NETIF_NUMOF] = { false };
+    int res = 1;
+
+    gnrc_netreg_register(GNRC_NETTYPE_UNDEF, &me);
+    for (unsigned i = 0; i < _NETIF_NUMOF; i++) {
+        netdev_trigger_event_isr(&_dev[i].netdev.netdev);
+    }
+    for (unsigned i = 0; i < _NETIF_NUMOF; i++) {
+        msg_t msg;
+
+        msg_receive(&msg);
+        if (msg.type != GNRC_NETAPI_MSG_TYPE_RCV) {
+            puts("Expected netapi receive message");
+            res = 0;
+            break;
+        }
+
+        gnrc_pktsnip_t *pkt = msg.content.ptr;
+        gnrc_netif_hdr_t *hdr = pkt->next->data;
+        gnrc_netif_t *netif = gnrc_netif_hdr_get_netif(hdr);
+
+        if ((netif == NULL) || received[netif - _netif]) {
+            puts("Packet received on unexpected interface");
+            res = 0;
+        }
+        else {
+            received[netif - _netif] = true;
+        }
+        gnrc_pktbuf_release(pkt);
+    }
+    gnrc_netreg_unregister(GNRC_NETTYPE_UNDEF, &me);
+    return res;
+}
+
+/* netdev_test callbacks */
+static void _dev_isr(netdev_t *dev)
+{
+    dev->event_callback(dev, NETDEV_EVENT_RX_COMPLETE);
+}
+
+static int _dev_recv(netdev_t *dev, char *buf, int len, void *info)
+{
+    ethernet_hdr_t *hdr = (ethernet_hdr_t *)buf;
+    int size = sizeof(ethernet_hdr_t) + sizeof(_TEST_PAYLOAD) - 1;
+
+    (void)info;
+    if (buf == NULL) {
+        return size;
+    }
+    if (len < size) {
+        return -ENOBUFS;
+    }
+    memcpy(hdr->dst, _dev_addr[_idx(dev)], ETHERNET_ADDR_LEN);
+    memcpy(hdr->src, _test_src, ETHERNET_ADDR_LEN);
+    hdr->type = byteorder_htons(ETHERTYPE_UNKNOWN);
+    memcpy(hdr + 1, _TEST_PAYLOAD, sizeof(_TEST_PAYLOAD) - 1);
+    return size;
+}
+
+static int _dev_send(netdev_t *dev, const iolist_t *iolist)
+{
+    const ethernet_hdr_t *hdr = iolist->iol_base;
+    int size = 0;
+
+    if (memcmp(hdr->src, _dev_addr[_idx(dev)], ETHERNET_ADDR_LEN) != 0) {
+        puts("Frame sent with the address of another device");
+        return -EINVAL;
+    }
+    for (; iolist; iolist = iolist->iol_next) {
+        size += iolist->iol_len;
+    }
+    _sent[_idx(dev)]++;
+    return size;
+}
+
+static int _dev_get_addr(netdev_t *dev, void *value, size_t max_len)
+{
+    if (max_len < ETHERNET_ADDR_LEN) {
+        return -ENOBUFS;
+    }
+    memcpy(value, _dev_addr[_idx(dev)], ETHERNET_ADDR_LEN);
+    return ETHERNET_ADDR_LEN;
+}
+
+static int _dev_get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    if (max_len != sizeof(uint16_t)) {
+        return -EOVERFLOW;
+    }
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _dev_set_addr(netdev_t *dev, const void *value, size_t value_len)
+{
+    if (value_len != ETHERNET_ADDR_LEN) {
+        return -EOVERFLOW;
+    }
+    memcpy(_dev_addr[_idx(dev)], value, ETHERNET_ADDR_LEN);
+    return ETHERNET_ADDR_LEN;
+}
+
+int main(void)
+{
+    /* initialization */
+    gnrc_pktbuf_init();
+    msg_init_queue(_main_msg_queue, _MAIN_MSG_QUEUE_SIZE);
+    for (unsigned i = 0; i < _NETIF_NUMOF; i++) {
+        netdev_test_setup(&_dev[i], NULL);
+        netdev_test_set_isr_cb(&_dev[i], _dev_isr);
+        netdev_test_set_recv_cb(&_dev[i], _dev_recv);
+        netdev_test_set_send_cb(&_dev[i], _dev_send);
+        netdev_test_set_get_cb(&_dev[i], NETOPT_ADDRESS, _dev_get_addr);
+        netdev_test_set_get_cb(&_dev[i], NETOPT_DEVICE_TYPE,
+                               _dev_get_device_type);
+        netdev_test_set_set_cb(&_dev[i], NETOPT_ADDRESS, _dev_set_addr);
+        if (gnrc_netif_ethernet_create(&_netif[i], NULL, 0, 0, "netdev_test",
+                                       &_dev[i].netdev.netdev) < 0) {
+            puts("Could not create interface");
+            return 1;
+        }
+    }
+
+    /* test execution */
+    EXECUTE(test_pids);
+    EXECUTE(test_get_set_addr);
+    EXECUTE(test_send);
+    EXECUTE(test_receive);
+    puts("ALL TESTS SUCCESSFUL");
+
+    return 0;
+}
@@ -0,0 +1,252 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Test application for receive latency statistics
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/af.h"
+#include "net/gnrc/netif/raw.h"
+#include "net/inet_csum.h"
+#include "net/ipv6/addr.h"
+#include "net/ipv6/hdr.h"
+#include "net/netdev_test.h"
+#include "net/netstats.h"
+#include "net/protnum.h"
+#include "net/sock/udp.h"
+#include "net/udp.h"
+#include "test_utils/expect.h"
+
+#define NETIF_PRIO          (THREAD_PRIORITY_MAIN - 4)
+#define MAIN_QUEUE_SIZE     (8)
+#define TEST_PORT           (12345U)
+#define TEST_PKTS           (5U)
+
+#define EXECUTE(test) \
+    puts("Executing " # test "()"); \
+    if (!test()) { \
+        puts(" + failed."); \
+        return 1; \
+    } \
+    else { \
+        puts(" + succeeded."); \
+    }
+
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static msg_t _main_msg_queue[MAIN_QUEUE_SIZE];
+
+static gnrc_netif_t _netif;
+static netdev_test_t _netdev_test;
+static sock_udp_t _sock;
+
+static const char _test_msg[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTU";
+
+/* IPv6 packet from fe80::1 to ff02::1 received for every event */
+static struct __attribute__((packed)) {
+    ipv6_hdr_t ipv6;
+    udp_hdr_t udp;
+    char payload[sizeof(_test_msg)];
+} _rx_pkt;
+
+static void _init_rx_pkt(void)
+{
+    const uint16_t udp_len = sizeof(_rx_pkt.udp) + sizeof(_rx_pkt.payload);
+
+    ipv6_hdr_set_version(&_rx_pkt.ipv6);
+    _rx_pkt.ipv6.len = byteorder_htons(udp_len);
+    _rx_pkt.ipv6.nh = PROTNUM_UDP;
+    _rx_pkt.ipv6.hl = 64;
+    ipv6_addr_set_link_local_prefix(&_rx_pkt.ipv6.src);
+    _rx_pkt.ipv6.src.u8[15] = 1;
+    ipv6_addr_set_all_nodes_multicast(&_rx_pkt.ipv6.dst,
+                                      IPV6_ADDR_MCAST_SCP_LINK_LOCAL);
+    _rx_pkt.udp.src_port = byteorder_htons(TEST_PORT);
+    _rx_pkt.udp.dst_port = byteorder_htons(TEST_PORT);
+    _rx_pkt.udp.length = byteorder_htons(udp_len);
+    memcpy(_rx_pkt.payload, _test_msg, sizeof(_test_msg));
+
+    uint16_t csum = ipv6_hdr_inet_csum(0, &_rx_pkt.ipv6, PROTNUM_UDP, udp_len);
+
+    csum = inet_csum(csum, (uint8_t *)&_rx_pkt.udp, udp_len);
+    _rx_pkt.udp.checksum = byteorder_htons(~csum);
+}
+
+static void _netdev_isr(netdev_t *dev)
+{
+    dev->event_callback(dev, NETDEV_EVENT_RX_COMPLETE);
+}
+
+static int _netdev_recv(netdev_t *dev, char *buf, int len, void *info)
+{
+    (void)dev;
+    (void)info;
+    if (buf == NULL) {
+        return sizeof(_rx_pkt);
+    }
+    if (len < (int)sizeof(_rx_pkt)) {
+        return -ENOBUFS;
+    }
+    memcpy(buf, &_rx_pkt, sizeof(_rx_pkt));
+    return sizeof(_rx_pkt);
+}
+
+static int _netdev_get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    const uint16_t type = NETDEV_TYPE_ETHERNET;
+
+    (void)dev;
+    expect(max_len == sizeof(type));
+    memcpy(value, &type, sizeof(type));
+    return sizeof(type);
+}
+
+static int _netdev_get_max_pdu_size(netdev_t *dev, void *value, size_t max_len)
+{
+    const uint16_t pdu_size = 1500;
+
+    (void)dev;
+    expect(max_len == sizeof(pdu_size));
+    memcpy(value, &pdu_size, sizeof(pdu_size));
+    return sizeof(pdu_size);
+}
+
+static int _netdev_get_proto(netdev_t *dev, void *value, size_t max_len)
+{
+    const gnrc_nettype_t proto = GNRC_NETTYPE_IPV6;
+
+    (void)dev;
+    expect(max_len == sizeof(proto));
+    memcpy(value, &proto, sizeof(proto));
+    return sizeof(proto);
+}
+
+static int _netdev_get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    const uint8_t addr[] = { 0x13, 0x37, 0xac, 0xdc, 0xbe, 0xef };
+
+    (void)dev;
+    expect(max_len >= sizeof(addr));
+    memcpy(value, addr, sizeof(addr));
+    return sizeof(addr);
+}
+
+static uint32_t _count(const netstats_latency_t *stats, unsigned stage)
+{
+    uint32_t count = 0;
+
+    for (unsigned i = 0; i < CONFIG_NETSTATS_LATENCY_BUCKETS; i++) {
+        count += stats->hist[stage][i];
+    }
+    return count;
+}
+
+static int _get_stats(netstats_latency_t *stats)
+{
+    return gnrc_netapi_get(_netif.pid, NETOPT_STATS, NETSTATS_LATENCY, stats,
+                           sizeof(*stats)) == sizeof(*stats);
+}
+
+/* every packet is counted once at every layer it passes */
+static int test_stages(void)
+{
+    static const unsigned expected[] = {
+        [NETSTATS_LATENCY_NETIF] = TEST_PKTS,
+        [NETSTATS_LATENCY_6LO] = 0,
+        [NETSTATS_LATENCY_IPV6] = TEST_PKTS,
+        [NETSTATS_LATENCY_TRANSPORT] = TEST_PKTS,
+        [NETSTATS_LATENCY_SOCK] = TEST_PKTS,
+    };
+    netstats_latency_t stats;
+    char buf[sizeof(_test_msg)];
+
+    for (unsigned n = 0; n < TEST_PKTS; n++) {
+        netdev_trigger_event_isr(&_netdev_test.netdev.netdev);
+        if (sock_udp_recv(&_sock, buf, sizeof(buf), SOCK_NO_TIMEOUT,
+                          NULL) != sizeof(_test_msg)) {
+            puts("Packet not received");
+            return 0;
+        }
+    }
+    if (!_get_stats(&stats)) {
+        puts("Could not get latency statistics");
+        return 0;
+    }
+    for (unsigned i = 0; i < NETSTATS_LATENCY_STAGES; i++) {
+        if (_count(&stats, i) != expected[i]) {
+            printf("Stage %u counted %u packets\n", i,
+                   (unsigned)_count(&stats, i));
+            return 0;
+        }
+    }
+    /* a packet can not reach a layer before it reached the one below */
+    if ((stats.max[NETSTATS_LATENCY_SOCK] < stats.max[NETSTATS_LATENCY_TRANSPORT]) ||
+        (stats.max[NETSTATS_LATENCY_TRANSPORT] < stats.max[NETSTATS_LATENCY_IPV6])) {
+        puts("Latency decreases up the stack");
+        return 0;
+    }
+    return 1;
+}
+
+static int test_reset(void)
+{
+    netstats_latency_t stats;
+
+    if (gnrc_netapi_set(_netif.pid, NETOPT_STATS, NETSTATS_LATENCY, NULL, 0) < 0) {
+        puts("Could not reset latency statistics");
+        return 0;
+    }
+    if (!_get_stats(&stats)) {
+        puts("Could not get latency statistics");
+        return 0;
+    }
+    for (unsigned i = 0; i < NETSTATS_LATENCY_STAGES; i++) {
+        if (_count(&stats, i) != 0) {
+            puts("Statistics not reset");
+            return 0;
+        }
+    }
+    return 1;
+}
+
+int main(void)
+{
+    sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+
+    _init_rx_pkt();
+    msg_init_queue(_main_msg_queue, MAIN_QUEUE_SIZE);
+    netdev_test_setup(&_netdev_test, NULL);
+    netdev_test_set_isr_cb(&_netdev_test, _netdev_isr);
+    netdev_test_set_recv_cb(&_netdev_test, _netdev_recv);
+    netdev_test_set_get_cb(&_netdev_test, NETOPT_DEVICE_TYPE, _netdev_get_device_type);
+    netdev_test_set_get_cb(&_netdev_test, NETOPT_MAX_PDU_SIZE, _netdev_get_max_pdu_size);
+    netdev_test_set_get_cb(&_netdev_test, NETOPT_PROTO, _netdev_get_proto);
+    netdev_test_set_get_cb(&_netdev_test, NETOPT_ADDRESS, _netdev_get_address);
+    gnrc_netif_raw_create(&_netif, _netif_stack, sizeof(_netif_stack), NETIF_PRIO,
+                          "netdev_test", &_netdev_test.netdev.netdev);
+    /* the device never signals a link up, which joins the group otherwise */
+    expect(gnrc_netif_ipv6_group_join(&_netif, &ipv6_addr_all_nodes_link_local) >= 0);
+    local.port = TEST_PORT;
+    expect(sock_udp_create(&_sock, &local, NULL, 0) == 0);
+
+    EXECUTE(test_stages);
+    EXECUTE(test_reset);
+    puts("ALL TESTS SUCCESSFUL");
+
+    return 0;
+}
@@ -22,6 +22,8 @@ from riotctrl_shell.netif import IfconfigListParser
 
 RIOTBASE = os.getenv("RIOTBASE", os.path.abspath(os.path.join(os.path.dirname(__file__), "../../../")))
 ZEP_DISPATCH_PATH = os.path.join(RIOTBASE, "dist/tools/zep_dispatch/bin/zep_dispatch")
+THROUGHPUT_COUNT = 50
+THROUGHPUT_SIZE = 500
 PARSERS = {
     "ping6": GNRCICMPv6EchoParser(),
     "ifconfig": IfconfigListParser(),
@@ -136,6 +138,18 @@ def test_fragmentation(factory, zep_dispatch):
         # 2 intermediate hops, 64 - 2
         assert_result(result, 90, 1, 64 - 2)
 
+        # echo requests and replies are both fragmented over the 3 hops, so
+        # count the payload of both
+        start = time.monotonic()
+        result = parser.parse(D.ping6(root_addr, count=THROUGHPUT_COUNT,
+                                      interval=10,
+                                      packet_size=THROUGHPUT_SIZE))
+        duration = time.monotonic() - start
+        print("\nthroughput: {:.0f} B/s ({} of {} echo replies in {:.1f} s)"
+              .format(2 * result['stats']['rx'] * THROUGHPUT_SIZE / duration,
+                      result['stats']['rx'], THROUGHPUT_COUNT, duration))
+        assert_result(result, 90, 1, 64 - 2)
+
 
 @contextlib.contextmanager
 def run_zep_dispatch():
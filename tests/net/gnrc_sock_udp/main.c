@@ -24,6 +24,7 @@
 #include <stdio.h>
 
 #include "net/sock/udp.h"
+#include "net/sock/util.h"
 #include "test_utils/expect.h"
 #include "xtimer.h"
 
@@ -308,6 +309,52 @@ static void test_sock_udp_recv__socketed(void)
     expect(_check_net());
 }
 
+#ifdef MODULE_GNRC_SOCK_UDP_REUSE_PORT
+static void test_sock_udp_recv__reuse_port(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    sock_udp_t *socks[] = { &_sock, &_sock2 };
+    unsigned flows[ARRAY_SIZE(socks)] = { 0 };
+
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_PORT));
+    expect(0 == sock_udp_create(&_sock2, &local, NULL, SOCK_FLAGS_REUSE_PORT));
+    for (uint16_t port = _TEST_PORT_REMOTE; port < (_TEST_PORT_REMOTE + 8);
+         port++) {
+        int flow_sock = -1;
+
+        /* each datagram of a flow is taken by exactly one sock, and always
+         * by the same */
+        for (unsigned n = 0; n < 2; n++) {
+            int taken = -1;
+
+            expect(_inject_packet(&src_addr, &dst_addr, port,
+                                  _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"),
+                                  _TEST_NETIF));
+            xtimer_usleep(1000);    /* let GNRC stack finish */
+            for (unsigned i = 0; i < ARRAY_SIZE(socks); i++) {
+                if (sock_udp_recv(socks[i], _test_buffer,
+                                  sizeof(_test_buffer), 0,
+                                  NULL) == sizeof("ABCD")) {
+                    expect(taken < 0);
+                    taken = i;
+                }
+            }
+            expect(taken >= 0);
+            expect((flow_sock < 0) || (flow_sock == taken));
+            flow_sock = taken;
+        }
+        flows[flow_sock]++;
+    }
+    expect(flows[0] > 0);
+    expect(flows[1] > 0);
+    sock_udp_close(&_sock2);
+    expect(_check_net());
+}
+#endif
+
 static void test_sock_udp_recv__socketed_with_remote(void)
 {
     static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
@@ -518,6 +565,67 @@ static void test_sock_udp_recv_buf__success(void)
     expect(_check_net());
 }
 
+static void test_sock_udp_recv_buf__leases(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    void *data1 = NULL, *ctx1 = NULL;
+    void *data2 = NULL, *ctx2 = NULL;
+
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"),
+                          _TEST_NETIF));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "EFG", sizeof("EFG"),
+                          _TEST_NETIF));
+    expect(sizeof("ABCD") == sock_udp_recv_buf(&_sock, &data1, &ctx1,
+                                               SOCK_NO_TIMEOUT, NULL));
+    expect(sizeof("EFG") == sock_udp_recv_buf(&_sock, &data2, &ctx2,
+                                              SOCK_NO_TIMEOUT, NULL));
+    /* both buffers are still valid */
+    expect(memcmp(data1, "ABCD", sizeof("ABCD")) == 0);
+    expect(memcmp(data2, "EFG", sizeof("EFG")) == 0);
+    sock_udp_buf_release(&_sock, ctx1);
+    expect(memcmp(data2, "EFG", sizeof("EFG")) == 0);
+    sock_udp_buf_release(&_sock, ctx2);
+    expect(_check_net());
+}
+
+static void test_sock_udp_recv_batch__success(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    sock_udp_ep_t remote = { .family = AF_UNSPEC };
+    sock_udp_msg_t msgs[] = {
+        { .data = _test_buffer, .len = sizeof("ABCD"), .remote = &remote },
+        { .data = _test_buffer + sizeof("ABCD"), .len = 16 },
+        { .data = _test_buffer + sizeof("ABCD") + 16, .len = 16 },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"),
+                          _TEST_NETIF));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "EFG", sizeof("EFG"),
+                          _TEST_NETIF));
+    /* the batch ends when no datagram is queued anymore */
+    expect(2 == sock_udp_recv_batch(&_sock, msgs, ARRAY_SIZE(msgs),
+                                    SOCK_NO_TIMEOUT));
+    expect(sizeof("ABCD") == msgs[0].len);
+    expect(sizeof("EFG") == msgs[1].len);
+    expect(0 == memcmp(msgs[0].data, "ABCD", sizeof("ABCD")));
+    expect(0 == memcmp(msgs[1].data, "EFG", sizeof("EFG")));
+    expect(_TEST_PORT_REMOTE == remote.port);
+    expect(-EAGAIN == sock_udp_recv_batch(&_sock, msgs, ARRAY_SIZE(msgs), 0));
+    expect(_check_net());
+}
+
 static void test_sock_udp_send__EAFNOSUPPORT(void)
 {
     static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
@@ -685,6 +793,34 @@ static void test_sock_udp_sendv__socketed(void)
     expect(_check_net());
 }
 
+static void test_sock_udp_send_batch__socketed(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const sock_udp_ep_t local = { .addr = { .ipv6 = _TEST_ADDR_LOCAL },
+                                         .family = AF_INET6,
+                                         .netif = _TEST_NETIF,
+                                         .port = _TEST_PORT_LOCAL };
+    static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
+                                          .family = AF_INET6,
+                                          .port = _TEST_PORT_REMOTE };
+    const sock_udp_msg_t msgs[] = {
+        { .data = "ABCD", .len = sizeof("ABCD") },
+        { .data = "EFG", .len = sizeof("EFG") },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, &remote, SOCK_FLAGS_REUSE_EP));
+    expect(2 == sock_udp_send_batch(&_sock, msgs, ARRAY_SIZE(msgs)));
+    expect(_check_packet(&src_addr, &dst_addr, _TEST_PORT_LOCAL,
+                         _TEST_PORT_REMOTE, "ABCD", sizeof("ABCD"),
+                         _TEST_NETIF, false));
+    expect(_check_packet(&src_addr, &dst_addr, _TEST_PORT_LOCAL,
+                         _TEST_PORT_REMOTE, "EFG", sizeof("EFG"),
+                         _TEST_NETIF, false));
+    xtimer_usleep(1000);    /* let GNRC stack finish */
+    expect(_check_net());
+}
+
 static void test_sock_udp_send__socketed_other_remote(void)
 {
     static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_LOCAL };
@@ -847,6 +983,9 @@ int main(void)
     CALL(test_sock_udp_recv__multicast());
     CALL(test_sock_udp_recv__ETIMEDOUT());
     CALL(test_sock_udp_recv__socketed());
+#ifdef MODULE_GNRC_SOCK_UDP_REUSE_PORT
+    CALL(test_sock_udp_recv__reuse_port());
+#endif
     CALL(test_sock_udp_recv__socketed_with_remote());
     CALL(test_sock_udp_recv__socketed_with_port0());
     CALL(test_sock_udp_recv__unsocketed());
@@ -855,6 +994,8 @@ int main(void)
     CALL(test_sock_udp_recv__non_blocking());
     CALL(test_sock_udp_recv__aux());
     CALL(test_sock_udp_recv_buf__success());
+    CALL(test_sock_udp_recv_buf__leases());
+    CALL(test_sock_udp_recv_batch__success());
     _prepare_send_checks();
     CALL(test_sock_udp_send__EAFNOSUPPORT());
     CALL(test_sock_udp_send__EINVAL_addr());
@@ -866,6 +1007,7 @@ int main(void)
     CALL(test_sock_udp_send__socketed_no_local());
     CALL(test_sock_udp_send__socketed());
     CALL(test_sock_udp_sendv__socketed());
+    CALL(test_sock_udp_send_batch__socketed());
     CALL(test_sock_udp_send__socketed_other_remote());
     CALL(test_sock_udp_send__unsocketed_no_local_no_netif());
     CALL(test_sock_udp_send__unsocketed_no_netif());
@@ -28,11 +28,14 @@ def testfunc(child):
     child.expect_exact(u" * Calling sock_udp_recv()")
     child.expect(r" \* \(timed out with timeout \d+\)")
     child.expect_exact(u"Calling test_sock_udp_recv__socketed()")
+    child.expect_exact(u"Calling test_sock_udp_recv__reuse_port()")
     child.expect_exact(u"Calling test_sock_udp_recv__socketed_with_remote()")
     child.expect_exact(u"Calling test_sock_udp_recv__unsocketed()")
     child.expect_exact(u"Calling test_sock_udp_recv__unsocketed_with_remote()")
     child.expect_exact(u"Calling test_sock_udp_recv__with_timeout()")
     child.expect_exact(u"Calling test_sock_udp_recv__non_blocking()")
+    child.expect_exact(u"Calling test_sock_udp_recv_buf__leases()")
+    child.expect_exact(u"Calling test_sock_udp_recv_batch__success()")
     child.expect_exact(u"Calling test_sock_udp_send__EAFNOSUPPORT()")
     child.expect_exact(u"Calling test_sock_udp_send__EINVAL_addr()")
     child.expect_exact(u"Calling test_sock_udp_send__EINVAL_netif()")
@@ -42,6 +45,7 @@ def testfunc(child):
     child.expect_exact(u"Calling test_sock_udp_send__socketed_no_netif()")
     child.expect_exact(u"Calling test_sock_udp_send__socketed_no_local()")
     child.expect_exact(u"Calling test_sock_udp_send__socketed()")
+    child.expect_exact(u"Calling test_sock_udp_send_batch__socketed()")
     child.expect_exact(u"Calling test_sock_udp_send__socketed_other_remote()")
     child.expect_exact(u"Calling test_sock_udp_send__unsocketed_no_local_no_netif()")
     child.expect_exact(u"Calling test_sock_udp_send__unsocketed_no_netif()")
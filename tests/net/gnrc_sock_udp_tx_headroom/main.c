@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark of sock_udp_send() with and without TX headroom
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/af.h"
+#include "net/gnrc/netif/raw.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/ipv6/addr.h"
+#include "net/netdev_test.h"
+#include "net/sock/udp.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#ifndef REPEAT
+#define REPEAT              (1000U)
+#endif
+
+#define NETIF_STACKSIZE     THREAD_STACKSIZE_DEFAULT
+#define NETIF_PRIO          (THREAD_PRIORITY_MAIN - 4)
+#define MAIN_QUEUE_SIZE     (8)
+
+static char _netif_stack[NETIF_STACKSIZE];
+static msg_t _main_msg_queue[MAIN_QUEUE_SIZE];
+
+static gnrc_netif_t _netif;
+static netdev_test_t _netdev_test;
+
+static const char _test_msg[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTU";
+
+static unsigned _sends;
+static unsigned _snips;
+static unsigned _buffers;
+
+static int _netdev_send(netdev_t *dev, const iolist_t *iolist)
+{
+    const uint8_t *end = NULL;
+
+    (void)dev;
+    _sends++;
+    for (const iolist_t *iol = iolist; iol; iol = iol->iol_next) {
+        _snips++;
+        /* a snip continuing where the previous one ends shares its buffer */
+        if (iol->iol_base != end) {
+            _buffers++;
+        }
+        end = (const uint8_t *)iol->iol_base + iol->iol_len;
+    }
+    return iolist_size(iolist);
+}
+
+static int _netdev_get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    const uint16_t type = NETDEV_TYPE_ETHERNET;
+
+    (void)dev;
+    expect(max_len == sizeof(type));
+    memcpy(value, &type, sizeof(type));
+    return sizeof(type);
+}
+
+static int _netdev_get_max_pdu_size(netdev_t *dev, void *value, size_t max_len)
+{
+    const uint16_t pdu_size = 1500;
+
+    (void)dev;
+    expect(max_len == sizeof(pdu_size));
+    memcpy(value, &pdu_size, sizeof(pdu_size));
+    return sizeof(pdu_size);
+}
+
+static int _netdev_get_proto(netdev_t *dev, void *value, size_t max_len)
+{
+    const gnrc_nettype_t proto = GNRC_NETTYPE_IPV6;
+
+    (void)dev;
+    expect(max_len == sizeof(proto));
+    memcpy(value, &proto, sizeof(proto));
+    return sizeof(proto);
+}
+
+static int _netdev_get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    const uint8_t addr[] = { 0x13, 0x37, 0xac, 0xdc, 0xbe, 0xef };
+
+    (void)dev;
+    expect(max_len >= sizeof(addr));
+    memcpy(value, addr, sizeof(addr));
+    return sizeof(addr);
+}
+
+int main(void)
+{
+    puts("gnrc_sock_udp TX headroom benchmark.\n");
+    printf("gnrc_pkt_headroom: %u\n", (unsigned)IS_USED(MODULE_GNRC_PKT_HEADROOM));
+
+    msg_init_queue(_main_msg_queue, MAIN_QUEUE_SIZE);
+    netdev_test_setup(&_netdev_test, NULL);
+    netdev_test_set_send_cb(&_netdev_test, _netdev_send);
+    netdev_test_set_get_cb(&_netdev_test, NETOPT_DEVICE_TYPE, _netdev_get_device_type);
+    netdev_test_set_get_cb(&_netdev_test, NETOPT_MAX_PDU_SIZE, _netdev_get_max_pdu_size);
+    netdev_test_set_get_cb(&_netdev_test, NETOPT_PROTO, _netdev_get_proto);
+    netdev_test_set_get_cb(&_netdev_test, NETOPT_ADDRESS, _netdev_get_address);
+    gnrc_netif_raw_create(&_netif, _netif_stack, sizeof(_netif_stack), NETIF_PRIO,
+                          "netdev_test", &_netdev_test.netdev.netdev);
+
+    sock_udp_t sock;
+    sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+    sock_udp_ep_t remote = { .family = AF_INET6, .port = 12345 };
+
+    ipv6_addr_set_all_nodes_multicast((ipv6_addr_t *)&remote.addr.ipv6,
+                                      IPV6_ADDR_MCAST_SCP_LINK_LOCAL);
+    expect(sock_udp_create(&sock, &local, NULL, 0) == 0);
+
+    /* the network stack threads have a higher priority, so the packet has
+     * been handed to the device when sock_udp_send() returns */
+    uint32_t before = ztimer_now(ZTIMER_USEC);
+
+    for (unsigned n = 0; n < REPEAT; n++) {
+        expect(sock_udp_send(&sock, _test_msg, sizeof(_test_msg), &remote) > 0);
+    }
+
+    uint32_t total = ztimer_now(ZTIMER_USEC) - before;
+
+    sock_udp_close(&sock);
+    expect(_sends == REPEAT);
+    printf("snips per send: %u, buffers per send: %u\n",
+           _snips / _sends, _buffers / _sends);
+    printf("%30s %8" PRIu32 " us / %u = %" PRIu32 " ns\n", "sock_udp_send()",
+           total, REPEAT, (uint32_t)(((uint64_t)total * 1000) / REPEAT));
+    expect(gnrc_pktbuf_is_empty());
+
+    puts("TEST PASSED");
+
+    return 0;
+}
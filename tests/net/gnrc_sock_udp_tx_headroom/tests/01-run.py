@@ -0,0 +1,31 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2024 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("gnrc_sock_udp TX headroom benchmark.\r\n")
+    child.expect(r"gnrc_pkt_headroom: (\d+)\r\n")
+    headroom = int(child.match.group(1))
+    child.expect(r"snips per send: (\d+), buffers per send: (\d+)\r\n")
+    snips = int(child.match.group(1))
+    buffers = int(child.match.group(2))
+    assert snips == 3
+    if headroom:
+        # gnrc_pktbuf_static can only split the buffer at aligned offsets
+        assert buffers < snips
+    else:
+        assert buffers == snips
+    child.expect(r"sock_udp_send\(\)\s+\d+ us / \d+ = \d+ ns\r\n")
+    child.expect_exact("TEST PASSED")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
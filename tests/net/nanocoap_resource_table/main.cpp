@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for nanocoap resource tables sorted at
+ *              compile time
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <cstdio>
+#include <cstring>
+
+#include "net/nanocoap/resource_table.hpp"
+
+#include "test_utils/expect.h"
+
+static ssize_t _handler(coap_pkt_t *pkt, uint8_t *buf, size_t len,
+                        coap_request_ctx_t *ctx)
+{
+    (void)pkt;
+    (void)buf;
+    (void)len;
+    (void)ctx;
+    return 0;
+}
+
+static constexpr auto resources = riot::make_coap_resource_table({
+    { "/riot/ver", COAP_GET, _handler, nullptr },
+    { "/echo/", COAP_GET | COAP_MATCH_SUBTREE, _handler, nullptr },
+    { "/riot/board", COAP_GET, _handler, nullptr },
+    { "/riot", COAP_GET, _handler, nullptr },
+    { "/riot/board", COAP_PUT, _handler, nullptr },
+    { "/a", COAP_POST, _handler, nullptr },
+});
+
+static constexpr coap_resource_subtree_t subtree = resources.subtree();
+
+static void test_sorting(void)
+{
+    puts("compile time sorting");
+
+    static_assert(resources.size() == 6, "");
+    static_assert(riot::detail::coap_path_cmp(resources[0].path, "/a") == 0, "");
+    static_assert(riot::detail::coap_path_cmp(resources[1].path, "/echo/") == 0, "");
+    static_assert(riot::detail::coap_path_cmp(resources[2].path, "/riot") == 0, "");
+    /* stable: GET before PUT, as listed */
+    static_assert(riot::detail::coap_path_cmp(resources[3].path, "/riot/board") == 0
+                  && resources[3].methods == COAP_GET, "");
+    static_assert(riot::detail::coap_path_cmp(resources[4].path, "/riot/board") == 0
+                  && resources[4].methods == COAP_PUT, "");
+    static_assert(riot::detail::coap_path_cmp(resources[5].path, "/riot/ver") == 0, "");
+    static_assert(subtree.resources_numof == resources.size(), "");
+
+    for (const coap_resource_t &r : resources) {
+        expect((&r == resources.begin())
+               || (strcmp((&r - 1)->path, r.path) <= 0));
+    }
+}
+
+static const coap_resource_t *_dispatch(unsigned method, const char *path)
+{
+    uint8_t req[64];
+    uint8_t resp[32];
+    coap_request_ctx_t ctx = {};
+    coap_pkt_t pkt;
+
+    ssize_t len = coap_build_hdr((coap_hdr_t *)req, COAP_TYPE_NON, nullptr, 0,
+                                 method, 1);
+    expect(len > 0);
+    len += coap_opt_put_uri_path(&req[len], 0, path);
+    expect(coap_parse(&pkt, req, len) == 0);
+    len = resources.handle(&pkt, resp, sizeof(resp), &ctx);
+    if (len != 0) {
+        /* 4.04 reply built by nanocoap */
+        return nullptr;
+    }
+    return ctx.resource;
+}
+
+static void test_dispatch(void)
+{
+    puts("dispatch");
+
+    expect(_dispatch(COAP_METHOD_GET, "/riot/board") == &resources[3]);
+    expect(_dispatch(COAP_METHOD_PUT, "/riot/board") == &resources[4]);
+    expect(_dispatch(COAP_METHOD_GET, "/riot") == &resources[2]);
+    expect(_dispatch(COAP_METHOD_GET, "/echo/hello") == &resources[1]);
+    expect(_dispatch(COAP_METHOD_POST, "/a") == &resources[0]);
+    expect(_dispatch(COAP_METHOD_GET, "/a") == nullptr);
+    expect(_dispatch(COAP_METHOD_GET, "/riot/foo") == nullptr);
+}
+
+int main(void)
+{
+    test_sorting();
+    test_dispatch();
+    puts("SUCCESS");
+
+    return 0;
+}
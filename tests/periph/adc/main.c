@@ -20,12 +20,58 @@
 
 #include <stdio.h>
 
+#include "container.h"
+#include "kernel_defines.h"
+#include "time_units.h"
 #include "ztimer.h"
 #include "periph/adc.h"
 
 #define RES             ADC_RES_10BIT
 #define DELAY_MS        100U
 
+#if IS_USED(MODULE_PERIPH_ADC_STREAM)
+#ifndef STREAM_TIMER
+#define STREAM_TIMER    TIMER_DEV(1)
+#endif
+#define STREAM_RATE_HZ  1000U
+
+static uint16_t _stream_buf[64];
+static volatile unsigned _stream_halves;
+static volatile uint16_t _stream_min, _stream_max;
+
+static void _stream_cb(void *arg, const uint16_t *samples, size_t len)
+{
+    (void)arg;
+
+    uint16_t min = UINT16_MAX, max = 0;
+    for (size_t i = 0; i < len; i++) {
+        min = samples[i] < min ? samples[i] : min;
+        max = samples[i] > max ? samples[i] : max;
+    }
+    _stream_min = min;
+    _stream_max = max;
+    _stream_halves++;
+}
+
+static void _test_stream(void)
+{
+    adc_stream_t stream;
+
+    printf("Streaming ADC_LINE(0) at %u Hz for one second\n", STREAM_RATE_HZ);
+    if (adc_stream_start(&stream, ADC_LINE(0), RES, STREAM_TIMER, STREAM_RATE_HZ,
+                         _stream_buf, ARRAY_SIZE(_stream_buf), _stream_cb, NULL)) {
+        puts("adc_stream_start() failed");
+        return;
+    }
+    ztimer_sleep(ZTIMER_MSEC, MS_PER_SEC);
+    adc_stream_stop(&stream);
+
+    printf("%u halves of %u samples, last half: min %u, max %u\n\n",
+           _stream_halves, (unsigned)ARRAY_SIZE(_stream_buf) / 2,
+           _stream_min, _stream_max);
+}
+#endif
+
 int main(void)
 {
     int sample = 0;
@@ -44,6 +90,10 @@ int main(void)
         }
     }
 
+#if IS_USED(MODULE_PERIPH_ADC_STREAM)
+    _test_stream();
+#endif
+
     while (1) {
         for (unsigned i = 0; i < ADC_NUMOF; i++) {
             sample = adc_sample(ADC_LINE(i), RES);
@@ -24,6 +24,8 @@
 #include <string.h>
 #include <stdlib.h>
 
+#include "kernel_defines.h"
+#include "mutex.h"
 #include "ztimer.h"
 #include "shell.h"
 #include "periph/spi.h"
@@ -102,6 +104,13 @@ static uint32_t _sched_us(void)
     return sched_pidlist[thread_getpid()].runtime_us;
 }
 
+#if IS_USED(MODULE_PERIPH_SPI_ASYNC)
+static void _async_done(void *arg)
+{
+    mutex_unlock(arg);
+}
+#endif
+
 static uint32_t _ztimer_diff_usec(uint32_t stop, uint32_t start)
 {
     return stop - start;
@@ -528,6 +537,31 @@ int cmd_bench(int argc, char **argv)
     sum += (stop - start);
     sched_sum += sched_diff_us;
 
+#if IS_USED(MODULE_PERIPH_SPI_ASYNC)
+    /* 16 - transfer 1000 times 100 byte asynchronously */
+    mutex_t done = MUTEX_INIT_LOCKED;
+    spi_async_t trans;
+    spi_xfer_t xfer = {
+        .out = bench_wbuf,
+        .in = bench_rbuf,
+        .len = BENCH_LARGE,
+    };
+    sched_start = _sched_us();
+    start = ztimer_now(ZTIMER_USEC);
+    for (int i = 0; i < BENCH_REDOS; i++) {
+        spi_transfer_async(&trans, spiconf.dev, spiconf.cs, &xfer,
+                           _async_done, &done);
+        mutex_lock(&done);
+    }
+    stop = ztimer_now(ZTIMER_USEC);
+    sched_stop = _sched_us();
+    sched_diff_us = _ztimer_diff_usec(sched_stop, sched_start);
+    printf("16 - transfer %i times %i byte async:", BENCH_REDOS, BENCH_LARGE);
+    printf("\t%"PRIu32"\t%"PRIu32"\n", (stop - start), sched_diff_us);
+    sum += (stop - start);
+    sched_sum += sched_diff_us;
+#endif
+
     ztimer_sleep(ZTIMER_SEC, 1);
 
     printf("-- - SUM:\t\t\t\t\t%"PRIu32"\t%"PRIu32"\n", sum, sched_sum);
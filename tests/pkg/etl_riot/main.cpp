@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the RIOT integration of the ETL
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <cstdio>
+
+#include "event/thread.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#include "riot/etl/event.hpp"
+#include "riot/etl/pool.hpp"
+#include "riot/etl/queue.hpp"
+#include "riot/etl/timer.hpp"
+
+#include "test_utils/expect.h"
+
+static constexpr unsigned NUMOF = 16;
+
+static riot::etl::queue<unsigned, 4> queue;
+static char stack[THREAD_STACKSIZE_DEFAULT];
+
+static void *producer(void *)
+{
+    for (unsigned i = 0; i < NUMOF; i++) {
+        queue.push(i);
+    }
+    return nullptr;
+}
+
+static void test_queue(void)
+{
+    puts("queue");
+
+    unsigned value;
+    expect(!queue.try_pop(value));
+    /* the producer has a higher priority and blocks as soon as the queue is
+     * full */
+    thread_create(stack, sizeof(stack), THREAD_PRIORITY_MAIN - 1, 0,
+                  producer, nullptr, "producer");
+    expect(queue.full());
+    for (unsigned i = 0; i < NUMOF; i++) {
+        expect(queue.pop() == i);
+    }
+    expect(queue.empty());
+    expect(queue.try_push(42));
+    expect(queue.try_pop(value) && (value == 42));
+}
+
+struct item {
+    explicit item(unsigned v) : value{v} {}
+    unsigned value;
+    char padding[3];
+};
+
+static void test_pool(void)
+{
+    puts("pool");
+
+    riot::etl::pool<item, 3> pool;
+    expect(pool.available() == 3);
+    item *a = pool.create(1U);
+    item *b = pool.create(2U);
+    item *c = pool.create(3U);
+    expect(a && b && c && pool.full());
+    expect(pool.create(4U) == nullptr);
+    expect((a->value == 1) && (b->value == 2) && (c->value == 3));
+    pool.destroy(b);
+    expect(pool.available() == 1);
+    /* the free list is a plain memarray */
+    expect(memarray_alloc(pool.native_handle()) == b);
+    memarray_free(pool.native_handle(), b);
+    pool.destroy(a);
+    pool.destroy(c);
+    expect(pool.empty());
+}
+
+class counter {
+public:
+    void increment() { count++; }
+    unsigned count = 0;
+};
+
+static void test_event_and_timer(void)
+{
+    puts("event and timer");
+
+    counter cnt;
+    riot::etl::event ev{
+        riot::etl::event::callback_type::create<counter, &counter::increment>(cnt)};
+    ev.post(EVENT_PRIO_MEDIUM);
+    ztimer_sleep(ZTIMER_MSEC, 10);
+    expect(cnt.count == 1);
+
+    riot::etl::timer timer{
+        riot::etl::timer::callback_type::create<counter, &counter::increment>(cnt)};
+    timer.set(ZTIMER_MSEC, 10);
+    ztimer_sleep(ZTIMER_MSEC, 20);
+    expect(cnt.count == 2);
+    timer.set(ZTIMER_MSEC, 10);
+    expect(timer.remove(ZTIMER_MSEC));
+    ztimer_sleep(ZTIMER_MSEC, 20);
+    expect(cnt.count == 2);
+}
+
+int main(void)
+{
+    test_queue();
+    test_pool();
+    test_event_and_timer();
+    puts("SUCCESS");
+
+    return 0;
+}
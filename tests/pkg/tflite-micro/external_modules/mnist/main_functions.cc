@@ -17,6 +17,7 @@
 
 #include <stdio.h>
 #include "kernel_defines.h"
+#include "ztimer.h"
 
 #include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
 #include "tensorflow/lite/micro/micro_interpreter.h"
@@ -83,6 +84,10 @@ void setup()
         puts("AllocateTensors() failed");
         return;
     }
+    // The exact arena size needed by the model with the kernels in use
+    printf("Arena used: %u of %u bytes\n",
+           static_cast<unsigned>(interpreter->arena_used_bytes()),
+           static_cast<unsigned>(kTensorArenaSize));
 
     // Obtain pointers to the model's input and output tensors.
     input = interpreter->input(0);
@@ -94,11 +99,14 @@ void setup()
     }
 
     // Run inference, and report any error
+    uint32_t start = ztimer_now(ZTIMER_USEC);
     TfLiteStatus invoke_status = interpreter->Invoke();
+    uint32_t duration = ztimer_now(ZTIMER_USEC) - start;
     if (invoke_status != kTfLiteOk) {
         puts("Invoke failed");
         return;
     }
+    printf("Inference time: %lu us\n", static_cast<unsigned long>(duration));
 
     // Get the best match from the output tensor
     float val = 0;
@@ -100,7 +100,7 @@ int main() {
     uint64_t before, after;
     unique_lock<mutex> lk(m);
     before = ztimer64_now(ZTIMER64_USEC);
-    cv.wait_for(lk, chrono::seconds(timeout));
+    expect(cv.wait_for(lk, chrono::seconds(timeout)) == cv_status::timeout);
     after = ztimer64_now(ZTIMER64_USEC);
     auto diff = after - before;
     expect(diff >= timeout * US_PER_SEC);
@@ -117,7 +117,7 @@ int main() {
     unique_lock<mutex> lk(m);
     before = ztimer64_now(ZTIMER64_USEC);
     auto time = riot::now() += chrono::seconds(timeout);
-    cv.wait_until(lk, time);
+    expect(cv.wait_until(lk, time) == cv_status::timeout);
     after = ztimer64_now(ZTIMER64_USEC);
     auto diff = after - before;
     expect(diff >= timeout * US_PER_SEC);
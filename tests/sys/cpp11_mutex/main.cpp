@@ -87,6 +87,26 @@ int main() {
   }
   puts("Done\n");
 
+  puts("Try_lock_for ...");
+  {
+    mutex m;
+    m.lock();
+    thread t([&m] {
+               auto start = std::chrono::system_clock::now();
+               expect(!m.try_lock_for(chrono::milliseconds(100)));
+               auto duration = std::chrono::duration_cast
+                 <chrono::milliseconds>(std::chrono::system_clock::now()
+                                        - start);
+               expect(duration.count() >= 100);
+               expect(m.try_lock_for(chrono::seconds(1)));
+               m.unlock();
+             });
+    this_thread::sleep_for(chrono::milliseconds(200));
+    m.unlock();
+    t.join();
+  }
+  puts("Done\n");
+
   puts("Bye, bye.");
   puts("*****************************************\n");
 
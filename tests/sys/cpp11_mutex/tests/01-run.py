@@ -17,6 +17,8 @@ def testfunc(child):
     child.expect_exact("Done")
     child.expect_exact("Try_lock ...")
     child.expect_exact("Done")
+    child.expect_exact("Try_lock_for ...")
+    child.expect_exact("Done")
     child.expect_exact("Bye, bye.")
     child.expect_exact("*****************************************")
 
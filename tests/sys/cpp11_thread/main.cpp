@@ -182,6 +182,27 @@ int main() {
 
   expect(sched_num_threads == initial_num_threads);
 
+  puts("Thread with caller-provided stack ...");
+  {
+    static thread_stack<THREAD_STACKSIZE_MAIN> stack;
+    for (int i = 0; i < 2; ++i) {
+      // the stack can be reused once the thread was joined
+      thread t(thread_attributes{stack}.priority(THREAD_PRIORITY_MAIN - 2)
+                                        .name("static_stack"),
+               [](int j) {
+                 expect(j < 2);
+                 expect(thread_get_active()->priority
+                        == THREAD_PRIORITY_MAIN - 2);
+                 expect(string(thread_getname(thread_getpid()))
+                        == "static_stack");
+               }, i);
+      t.join();
+    }
+  }
+  puts("Done\n");
+
+  expect(sched_num_threads == initial_num_threads);
+
   puts("Bye, bye.");
   puts("******************************************");
 
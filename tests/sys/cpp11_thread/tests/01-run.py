@@ -29,6 +29,8 @@ def testfunc(child):
     child.expect_exact("Done")
     child.expect_exact("Move constructor ...")
     child.expect_exact("Done")
+    child.expect_exact("Thread with caller-provided stack ...")
+    child.expect_exact("Done")
     child.expect_exact("Bye, bye.")
     child.expect_exact("******************************************")
 
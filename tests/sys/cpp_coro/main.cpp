@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief test C++20 coroutines on event queues
+ *
+ * @author RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <cstdio>
+#include <string>
+
+#include "event.h"
+#include "riot/coro.hpp"
+#include "ztimer.h"
+
+#include "test_utils/expect.h"
+
+using namespace riot::coro;
+
+static event_queue_t queue;
+static unsigned running;
+static std::string trace;
+
+static void run_until_done() {
+  while (running) {
+    event_t* ev = event_wait(&queue);
+    ev->handler(ev);
+  }
+}
+
+static task<> sleeper(char name, uint32_t delay) {
+  for (int i = 0; i < 2; ++i) {
+    co_await sleep(ZTIMER_MSEC, delay);
+    trace += name;
+  }
+  --running;
+}
+
+static task<int> square(int i) {
+  co_await yield();
+  co_return i * i;
+}
+
+static task<> sum_of_squares(int n, int* result) {
+  int sum = 0;
+  for (int i = 1; i <= n; ++i) {
+    sum += co_await square(i);
+  }
+  *result = sum;
+  --running;
+}
+
+static mutex m;
+
+static task<> locker(char name) {
+  co_await m.lock();
+  trace += name;
+  co_await sleep(ZTIMER_MSEC, 10);
+  trace += name;
+  m.unlock();
+  --running;
+}
+
+static flags f;
+
+static task<> waiter(flags::flags_t* result) {
+  *result = co_await f.wait_any(0x3);
+  --running;
+}
+
+static task<> nop() {
+  co_return;
+}
+
+int main() {
+  puts("\n************ C++ coroutine test ***********");
+  event_queue_init(&queue);
+
+  const std::size_t frames = frames_available();
+  expect(frames == CONFIG_CPP_CORO_FRAME_NUMOF);
+
+  puts("Interleaving sleeping tasks ...");
+  {
+    trace.clear();
+    running = 2;
+    expect(spawn(&queue, sleeper('a', 20)));
+    expect(spawn(&queue, sleeper('b', 30)));
+    run_until_done();
+    expect(trace == "abab");
+  }
+  puts("Done\n");
+
+  puts("Awaiting tasks with results ...");
+  {
+    int result = 0;
+    running = 1;
+    expect(spawn(&queue, sum_of_squares(4, &result)));
+    run_until_done();
+    expect(result == 30);
+  }
+  puts("Done\n");
+
+  puts("Mutex between tasks ...");
+  {
+    trace.clear();
+    running = 3;
+    expect(spawn(&queue, locker('a')));
+    expect(spawn(&queue, locker('b')));
+    expect(spawn(&queue, locker('c')));
+    run_until_done();
+    expect(trace == "aabbcc");
+  }
+  puts("Done\n");
+
+  puts("Flags set from ISR ...");
+  {
+    flags::flags_t result = 0;
+    ztimer_t timer = {};
+    timer.callback = [](void*) { f.set(0x6); };
+    running = 1;
+    expect(spawn(&queue, waiter(&result)));
+    ztimer_set(ZTIMER_MSEC, &timer, 10);
+    run_until_done();
+    expect(result == 0x2);
+    expect(f.clear(0xffff) == 0x4);
+  }
+  puts("Done\n");
+
+  puts("Exhausting the frame pool ...");
+  {
+    running = 0;
+    task<> tasks[CONFIG_CPP_CORO_FRAME_NUMOF + 1] = {
+      nop(), nop(), nop(), nop(), nop(), nop(), nop(), nop(), nop()
+    };
+    static_assert(CONFIG_CPP_CORO_FRAME_NUMOF == 8);
+    for (unsigned i = 0; i < CONFIG_CPP_CORO_FRAME_NUMOF; ++i) {
+      expect(bool(tasks[i]));
+    }
+    expect(!bool(tasks[CONFIG_CPP_CORO_FRAME_NUMOF]));
+    expect(!spawn(&queue, std::move(tasks[CONFIG_CPP_CORO_FRAME_NUMOF])));
+  }
+  expect(frames_available() == frames);
+  puts("Done\n");
+
+  puts("Bye, bye.");
+  puts("******************************************");
+
+  return 0;
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief test riot::inplace_function
+ *
+ * @author RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <cstdio>
+
+#include "event/callback.h"
+#include "riot/inplace_function.hpp"
+#include "ztimer.h"
+
+#include "test_utils/expect.h"
+
+using riot::inplace_function;
+
+namespace {
+
+struct tracker {
+  static int alive;
+  int value;
+  explicit tracker(int v) : value{v} { alive++; }
+  tracker(const tracker& other) : value{other.value} { alive++; }
+  ~tracker() { alive--; }
+};
+
+int tracker::alive = 0;
+
+int add(int a, int b) { return a + b; }
+
+void test_basic() {
+  puts("basic");
+  inplace_function<int(int, int)> fn;
+  expect(!fn && fn == nullptr);
+  fn = add;
+  expect(fn && fn(1, 2) == 3);
+  int offset = 10;
+  fn = [offset](int a, int b) { return a + b + offset; };
+  expect(fn(1, 2) == 13);
+  int calls = 0;
+  inplace_function<void()> counter = [&calls]() mutable { calls++; };
+  counter();
+  counter();
+  expect(calls == 2);
+  fn = nullptr;
+  expect(!fn);
+}
+
+void test_lifetime() {
+  puts("lifetime");
+  {
+    tracker t{42};
+    inplace_function<int()> a = [t] { return t.value; };
+    expect(tracker::alive == 2);
+    inplace_function<int()> b = a;
+    expect(tracker::alive == 3 && b() == 42);
+    inplace_function<int()> c = std::move(a);
+    expect(tracker::alive == 3 && !a && c() == 42);
+    b = nullptr;
+    expect(tracker::alive == 2);
+    a = c;
+    expect(tracker::alive == 3);
+  }
+  expect(tracker::alive == 0);
+}
+
+void test_trampolines() {
+  puts("trampolines");
+  int calls = 0;
+  inplace_function<void()> fn = [&calls] { calls++; };
+
+  event_callback_t event;
+  event_callback_init(&event, fn.trampoline, &fn);
+  event.super.handler(&event.super);
+  expect(calls == 1);
+
+  ztimer_t timer = {};
+  timer.callback = fn.trampoline;
+  timer.arg = &fn;
+  ztimer_set(ZTIMER_MSEC, &timer, 10);
+  ztimer_sleep(ZTIMER_MSEC, 20);
+  expect(calls == 2);
+
+  inplace_function<int(int)> twice = [](int x) { return 2 * x; };
+  int (*last)(int, void*) = twice.trampoline_last;
+  expect(last(21, &twice) == 42);
+}
+
+} // namespace
+
+int main() {
+  test_basic();
+  test_lifetime();
+  test_trampolines();
+  puts("SUCCESS");
+  return 0;
+}
@@ -281,6 +281,23 @@ static void test_crypto_poly1305_11(void)
     _test_poly1305(key_11, msg_11, sizeof(msg_11), tag_11);
 }
 
+/* feeds msg_3 in chunks of every size, crossing block boundaries */
+static void test_crypto_poly1305_update_chunks(void)
+{
+    for (size_t chunk = 1; chunk <= 33; chunk++) {
+        poly1305_ctx_t ctx;
+        uint8_t gen_tag[16];
+
+        poly1305_init(&ctx, key_3);
+        for (size_t pos = 0; pos < sizeof(msg_3); pos += chunk) {
+            size_t len = sizeof(msg_3) - pos;
+            poly1305_update(&ctx, msg_3 + pos, (len < chunk) ? len : chunk);
+        }
+        poly1305_finish(&ctx, gen_tag);
+        TEST_ASSERT_EQUAL_INT(0, memcmp(gen_tag, tag_3, sizeof(tag_3)));
+    }
+}
+
 Test *tests_crypto_poly1305_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -295,6 +312,7 @@ Test *tests_crypto_poly1305_tests(void)
         new_TestFixture(test_crypto_poly1305_9),
         new_TestFixture(test_crypto_poly1305_10),
         new_TestFixture(test_crypto_poly1305_11),
+        new_TestFixture(test_crypto_poly1305_update_chunks),
     };
     EMB_UNIT_TESTCALLER(crypto_poly1305_tests, NULL, NULL, fixtures);
     return (Test *) &crypto_poly1305_tests;
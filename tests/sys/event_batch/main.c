@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test batched event processing and event queue statistics
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "event.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#define EVENTS_HIGH     (2U)
+#define EVENTS_LOW      (5U)
+#define BATCH           (4U)
+#define DELAY_US        (1000U)
+
+static event_queue_t queues[2];
+static unsigned order;
+
+typedef struct {
+    event_t super;
+    unsigned expected;
+} test_event_t;
+
+static void handler(event_t *event)
+{
+    test_event_t *ev = container_of(event, test_event_t, super);
+
+    expect(ev->expected == order);
+    order++;
+}
+
+static test_event_t high[EVENTS_HIGH];
+static test_event_t low[EVENTS_LOW];
+
+int main(void)
+{
+    puts("event_batch test");
+
+    event_queues_init(queues, ARRAY_SIZE(queues));
+
+    for (unsigned i = 0; i < EVENTS_LOW; i++) {
+        low[i] = (test_event_t){ .super.handler = handler,
+                                 .expected = EVENTS_HIGH + i };
+        event_post(&queues[1], &low[i].super);
+    }
+    for (unsigned i = 0; i < EVENTS_HIGH; i++) {
+        high[i] = (test_event_t){ .super.handler = handler, .expected = i };
+        event_post(&queues[0], &high[i].super);
+    }
+
+    ztimer_sleep(ZTIMER_USEC, DELAY_US);
+
+    /* a batch never spans multiple queues */
+    expect(event_process_multi(queues, ARRAY_SIZE(queues), BATCH) == EVENTS_HIGH);
+    expect(event_process_multi(queues, ARRAY_SIZE(queues), BATCH) == BATCH);
+    expect(event_process_multi(queues, ARRAY_SIZE(queues), BATCH)
+           == EVENTS_LOW - BATCH);
+    expect(order == EVENTS_HIGH + EVENTS_LOW);
+    puts("batch: OK");
+
+    event_queue_stats_t stats;
+    event_queue_get_stats(&queues[0], &stats);
+    expect(stats.dispatched == EVENTS_HIGH);
+    expect(stats.latency_max >= DELAY_US);
+    expect(stats.latency_sum >= (uint64_t)DELAY_US * EVENTS_HIGH);
+
+    event_queue_get_stats(&queues[1], &stats);
+    expect(stats.dispatched == EVENTS_LOW);
+    expect(stats.latency_max >= DELAY_US);
+
+    event_queue_reset_stats(&queues[1]);
+    event_queue_get_stats(&queues[1], &stats);
+    expect(stats.dispatched == 0);
+    expect(stats.latency_max == 0);
+    puts("stats: OK");
+
+    puts("TEST PASSED");
+    return 0;
+}
@@ -38,6 +38,13 @@
 #define PRIO                    (THREAD_PRIORITY_MAIN - 1)
 #define DELAYED_QUEUES_NUMOF    2
 
+#ifndef BENCH_EVENTS_NUMOF
+#define BENCH_EVENTS_NUMOF      64
+#endif
+#ifndef BENCH_REPEAT
+#define BENCH_REPEAT            100
+#endif
+
 static char stack[STACKSIZE];
 
 static unsigned order = 0;
@@ -134,6 +141,75 @@ static void delayed_callback3(event_t *arg)
     printf("triggered delayed event %p\n", (void *)arg);
 }
 
+static uint32_t _now_us(void)
+{
+#if IS_USED(MODULE_ZTIMER_USEC)
+    return ztimer_now(ZTIMER_USEC);
+#else
+    return xtimer_now_usec();
+#endif
+}
+
+static void bench_callback(event_t *arg)
+{
+    (void)arg;
+}
+
+static event_t bench_events[BENCH_EVENTS_NUMOF];
+
+/* posts BENCH_EVENTS_NUMOF events and cancels them again, latest first, which
+ * is the worst case when event_cancel() has to walk the queue */
+static void bench_post_cancel(void)
+{
+    event_queue_t bench_queue = EVENT_QUEUE_INIT_DETACHED;
+
+    for (unsigned i = 0; i < BENCH_EVENTS_NUMOF; i++) {
+        bench_events[i].handler = bench_callback;
+    }
+
+    uint32_t start = _now_us();
+    for (unsigned n = 0; n < BENCH_REPEAT; n++) {
+        for (unsigned i = 0; i < BENCH_EVENTS_NUMOF; i++) {
+            event_post(&bench_queue, &bench_events[i]);
+        }
+        for (unsigned i = BENCH_EVENTS_NUMOF; i > 0; i--) {
+            event_cancel(&bench_queue, &bench_events[i - 1]);
+        }
+    }
+    uint32_t duration = _now_us() - start;
+
+    expect(!event_get(&bench_queue));
+    printf("post + cancel of %u events: %" PRIu32 " us\n",
+           BENCH_EVENTS_NUMOF * BENCH_REPEAT, duration);
+}
+
+#if IS_USED(MODULE_EVENT_DLIST)
+static void test_priority(void)
+{
+    event_queue_t prio_queue = EVENT_QUEUE_INIT_DETACHED;
+    static const uint8_t prios[] = { 0, 2, 0, 1, 2 };
+    /* expected order of the events taken from the queue */
+    static const unsigned order[] = { 1, 4, 3, 0, 2 };
+
+    for (unsigned i = 0; i < ARRAY_SIZE(prios); i++) {
+        bench_events[i].priority = prios[i];
+        event_post(&prio_queue, &bench_events[i]);
+    }
+    event_cancel(&prio_queue, &bench_events[2]);
+    event_post(&prio_queue, &bench_events[2]);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(order); i++) {
+        expect(event_get(&prio_queue) == &bench_events[order[i]]);
+    }
+    expect(!event_get(&prio_queue));
+
+    for (unsigned i = 0; i < ARRAY_SIZE(prios); i++) {
+        bench_events[i].priority = 0;
+    }
+    puts("events taken by priority");
+}
+#endif
+
 static void *claiming_thread(void *arg)
 {
     event_queue_t *dqs = arg;
@@ -209,6 +285,11 @@ int main(void)
     event_timeout_clear(&event_timeout_canceled);
     expect(!event_timeout_is_pending(&event_timeout_canceled));
 
+#if IS_USED(MODULE_EVENT_DLIST)
+    test_priority();
+#endif
+    bench_post_cancel();
+
     puts("launching event queue");
     event_loop(&queue);
 
@@ -0,0 +1,41 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @file
+ * @brief       Test deferred logging gives the expected output
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "log.h"
+
+int main(void)
+{
+    char string[] = "test";
+    const uint8_t value = 42;
+
+    LOG_ERROR("Logging value '%d' and string '%s'\n", value, string);
+    /* the string is copied, so overwriting it must not change the output */
+    strcpy(string, "gone");
+
+    LOG_WARNING("%" PRIu32 " %" PRIx64 " %zu %c 100%%\n",
+                UINT32_MAX, UINT64_C(0x1122334455667788), sizeof(uint32_t), 'x');
+    LOG_INFO("[%5s|%-5d|%.*s|%*d]\n", "ab", -7, 3, "truncated", 4, 9);
+    LOG_DEBUG("nothing to format\n");
+
+    /* only printed once main() blocks or returns */
+    puts("main done");
+
+    return 0;
+}
@@ -0,0 +1,22 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2024 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact('main done')
+    child.expect_exact("Logging value '42' and string 'test'")
+    child.expect_exact('4294967295 1122334455667788 4 x 100%')
+    child.expect_exact('[   ab|-7   |tru|   9]')
+    child.expect_exact('nothing to format')
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
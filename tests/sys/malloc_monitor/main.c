@@ -24,6 +24,7 @@
 #include "embUnit.h"
 
 #include "malloc_monitor.h"
+#include "thread.h"
 
 #define MALLOC_SIZE 1
 
@@ -188,6 +189,52 @@ static void test_free_NULL(void)
     TEST_ASSERT_WATERMARK(1);
 }
 
+static char _thread_stack[THREAD_STACKSIZE_DEFAULT];
+static void *volatile _thread_alloc;
+
+static void *_thread_malloc(void *arg)
+{
+    (void)arg;
+    _thread_alloc = malloc(2*MALLOC_SIZE);
+    return NULL;
+}
+
+/*
+ * memory should be accounted to the thread that allocated it, even if another
+ * thread frees it
+ */
+static void test_thread_usage(void)
+{
+    malloc_monitor_reset_high_watermark();
+
+    TEST_MALLOC_MONITOR_SAVE
+
+    kernel_pid_t me = thread_getpid();
+    size_t me_curr = malloc_monitor_get_thread_usage_current(me);
+
+    kernel_pid_t pid = thread_create(_thread_stack, sizeof(_thread_stack),
+                                     THREAD_PRIORITY_MAIN - 1, 0,
+                                     _thread_malloc, NULL, "malloc");
+    TEST_ASSERT(pid_is_valid(pid));
+    TEST_ASSERT_NOT_NULL(_thread_alloc);
+    TEST_ASSERT_CURRENT(2);
+    TEST_ASSERT_WATERMARK(2);
+    TEST_ASSERT_EQUAL_INT(2*MALLOC_SIZE, malloc_monitor_get_thread_usage_current(pid));
+    TEST_ASSERT_EQUAL_INT(2*MALLOC_SIZE, malloc_monitor_get_thread_usage_high_watermark(pid));
+    TEST_ASSERT_EQUAL_INT(me_curr, malloc_monitor_get_thread_usage_current(me));
+
+    free(_thread_alloc);
+
+    TEST_ASSERT_CURRENT(0);
+    TEST_ASSERT_EQUAL_INT(0, malloc_monitor_get_thread_usage_current(pid));
+    TEST_ASSERT_EQUAL_INT(2*MALLOC_SIZE, malloc_monitor_get_thread_usage_high_watermark(pid));
+    TEST_ASSERT_EQUAL_INT(me_curr, malloc_monitor_get_thread_usage_current(me));
+
+    malloc_monitor_reset_high_watermark();
+
+    TEST_ASSERT_EQUAL_INT(0, malloc_monitor_get_thread_usage_high_watermark(pid));
+}
+
 static Test *tests_malloc_monitor(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -195,6 +242,7 @@ static Test *tests_malloc_monitor(void)
         new_TestFixture(test_calloc),
         new_TestFixture(test_realloc),
         new_TestFixture(test_free_NULL),
+        new_TestFixture(test_thread_usage),
     };
 
     EMB_UNIT_TESTCALLER(tests, NULL, NULL, fixtures);
@@ -208,5 +256,12 @@ int main(void)
     TESTS_RUN(tests_malloc_monitor());
     TESTS_END();
 
+    /* the trace is checked by the test script */
+    malloc_monitor_trace_reset();
+    void *ptr = malloc(42);
+    ptr = realloc(ptr, 84);
+    free(ptr);
+    malloc_monitor_trace_dump();
+
     return 0;
 }
@@ -7,8 +7,20 @@
 # directory for more details.
 
 import sys
-from testrunner import run_check_unittests
+from testrunner import run, check_unittests
+
+
+def testfunc(child):
+    check_unittests(child)
+    child.expect_exact("malloc_monitor: trace of 4 allocations, 0 lost")
+    child.expect(r"mmt \d+ m \d+ 0x[0-9a-f]+ (\S+) 42\r\n")
+    ptr = child.match.group(1)
+    child.expect(r"mmt \d+ f \d+ 0x[0-9a-f]+ {} 0\r\n".format(ptr))
+    child.expect(r"mmt \d+ r \d+ 0x[0-9a-f]+ (\S+) 84\r\n")
+    ptr = child.match.group(1)
+    child.expect(r"mmt \d+ f \d+ 0x[0-9a-f]+ {} 0\r\n".format(ptr))
+    child.expect_exact("malloc_monitor: end of trace")
 
 
 if __name__ == "__main__":
-    sys.exit(run_check_unittests())
+    sys.exit(run(testfunc))
@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the TLSF system allocator
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "malloc_monitor.h"
+#include "malloc_tlsf.h"
+#include "thread.h"
+
+#define MALLOC_SIZE     (100U)
+#define EXTRA_POOL_SIZE (4096U)
+
+static uint64_t _extra_pool[EXTRA_POOL_SIZE / sizeof(uint64_t)];
+
+/*
+ * allocated blocks should show up in the heap statistics
+ */
+static void test_malloc_free(void)
+{
+    malloc_tlsf_stats_t before, during, after;
+
+    malloc_tlsf_get_stats(&before);
+    TEST_ASSERT(before.size > 0);
+    TEST_ASSERT(before.size > before.used + before.free);
+
+    void *volatile alloc = malloc(MALLOC_SIZE);
+    TEST_ASSERT_NOT_NULL(alloc);
+
+    malloc_tlsf_get_stats(&during);
+    TEST_ASSERT(during.used >= before.used + MALLOC_SIZE);
+    TEST_ASSERT_EQUAL_INT(before.size, during.size);
+
+    free(alloc);
+
+    malloc_tlsf_get_stats(&after);
+    TEST_ASSERT_EQUAL_INT(before.used, after.used);
+    TEST_ASSERT_EQUAL_INT(before.free, after.free);
+}
+
+/*
+ * calloc() should clear and realloc() should keep the memory
+ */
+static void test_calloc_realloc(void)
+{
+    uint8_t *alloc = calloc(MALLOC_SIZE, 1);
+    TEST_ASSERT_NOT_NULL(alloc);
+    for (unsigned i = 0; i < MALLOC_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(0, alloc[i]);
+    }
+
+    memset(alloc, 0x5a, MALLOC_SIZE);
+    alloc = realloc(alloc, 4 * MALLOC_SIZE);
+    TEST_ASSERT_NOT_NULL(alloc);
+    for (unsigned i = 0; i < MALLOC_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(0x5a, alloc[i]);
+    }
+
+    free(alloc);
+}
+
+/*
+ * a pool added at run time should enlarge the heap
+ */
+static void test_add_pool(void)
+{
+    malloc_tlsf_stats_t before, after;
+
+    malloc_tlsf_get_stats(&before);
+    TEST_ASSERT_EQUAL_INT(0, malloc_tlsf_add_pool(_extra_pool, sizeof(_extra_pool)));
+    malloc_tlsf_get_stats(&after);
+
+    TEST_ASSERT_EQUAL_INT(before.size + sizeof(_extra_pool), after.size);
+    TEST_ASSERT(after.free > before.free + sizeof(_extra_pool) / 2);
+    TEST_ASSERT(after.largest_free >= before.largest_free);
+}
+
+/*
+ * malloc_monitor should still see the allocations of the calling thread
+ */
+static void test_monitor(void)
+{
+    kernel_pid_t me = thread_getpid();
+    size_t curr = malloc_monitor_get_thread_usage_current(me);
+
+    void *volatile alloc = malloc(MALLOC_SIZE);
+    TEST_ASSERT_NOT_NULL(alloc);
+    TEST_ASSERT_EQUAL_INT(curr + MALLOC_SIZE, malloc_monitor_get_thread_usage_current(me));
+
+    free(alloc);
+    TEST_ASSERT_EQUAL_INT(curr, malloc_monitor_get_thread_usage_current(me));
+}
+
+static Test *tests_malloc_tlsf(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_malloc_free),
+        new_TestFixture(test_calloc_realloc),
+        new_TestFixture(test_add_pool),
+        new_TestFixture(test_monitor),
+    };
+
+    EMB_UNIT_TESTCALLER(tests, NULL, NULL, fixtures);
+
+    return (Test *)&tests;
+}
+
+int main(void)
+{
+    puts("malloc_tlsf test");
+
+    TESTS_START();
+    TESTS_RUN(tests_malloc_tlsf());
+    TESTS_END();
+
+    return 0;
+}
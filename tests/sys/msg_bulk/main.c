@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for zero-copy bulk messages
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "msg_bulk.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+
+#define FRAMES          (16U)
+#define TYPE_FRAME      (0x4242)
+#define TYPE_FRAME_REQ  (0x4243)
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static msg_t _queue[CONFIG_MSG_BULK_BUF_NUMOF];
+
+static void *_expected_buf;
+static unsigned _received;
+
+static void *_consumer(void *arg)
+{
+    (void)arg;
+    msg_init_queue(_queue, ARRAY_SIZE(_queue));
+
+    while (1) {
+        msg_t m;
+        msg_receive(&m);
+        expect((m.type == TYPE_FRAME) || (m.type == TYPE_FRAME_REQ));
+
+        uint8_t *frame = msg_bulk_buf(&m);
+        /* the payload is handed over, not copied */
+        expect((void *)frame == _expected_buf);
+        expect(msg_bulk_len(frame) == CONFIG_MSG_BULK_BUF_SIZE);
+        for (unsigned i = 0; i < CONFIG_MSG_BULK_BUF_SIZE; i++) {
+            expect(frame[i] == (uint8_t)(_received + i));
+        }
+        _received++;
+
+        if (m.type == TYPE_FRAME_REQ) {
+            msg_t reply = { .type = TYPE_FRAME };
+            msg_bulk_reply(&m, &reply);
+        }
+        else {
+            msg_bulk_release(frame);
+        }
+    }
+
+    return NULL;
+}
+
+static uint8_t *_fill_frame(unsigned seq)
+{
+    uint8_t *frame = msg_bulk_alloc();
+    expect(frame);
+
+    for (unsigned i = 0; i < CONFIG_MSG_BULK_BUF_SIZE; i++) {
+        frame[i] = (uint8_t)(seq + i);
+    }
+    msg_bulk_set_len(frame, CONFIG_MSG_BULK_BUF_SIZE);
+    _expected_buf = frame;
+    return frame;
+}
+
+static void _test_pool(void)
+{
+    void *bufs[CONFIG_MSG_BULK_BUF_NUMOF];
+
+    for (unsigned i = 0; i < ARRAY_SIZE(bufs); i++) {
+        bufs[i] = msg_bulk_alloc();
+        expect(bufs[i]);
+    }
+    expect(msg_bulk_outstanding() == CONFIG_MSG_BULK_BUF_NUMOF);
+    expect(msg_bulk_alloc() == NULL);
+
+    /* an extra reference keeps the buffer allocated */
+    msg_bulk_retain(bufs[0]);
+    for (unsigned i = 0; i < ARRAY_SIZE(bufs); i++) {
+        msg_bulk_release(bufs[i]);
+    }
+    expect(msg_bulk_outstanding() == 1);
+    msg_bulk_release(bufs[0]);
+    expect(msg_bulk_outstanding() == 0);
+
+    msg_bulk_stats_t stats;
+    msg_bulk_get_stats(&stats);
+    expect(stats.allocs == CONFIG_MSG_BULK_BUF_NUMOF);
+    expect(stats.alloc_fails == 1);
+    expect(stats.max_outstanding == CONFIG_MSG_BULK_BUF_NUMOF);
+    puts("pool: OK");
+}
+
+static void _test_send(kernel_pid_t consumer)
+{
+    for (unsigned seq = 0; seq < FRAMES; seq++) {
+        msg_t m = { .type = TYPE_FRAME };
+        expect(msg_bulk_send(&m, _fill_frame(seq), consumer) == 1);
+    }
+    expect(_received == FRAMES);
+    expect(msg_bulk_outstanding() == 0);
+    puts("send: OK");
+}
+
+static void _test_send_receive(kernel_pid_t consumer)
+{
+    msg_t m = { .type = TYPE_FRAME_REQ };
+
+    expect(msg_bulk_send_receive(&m, _fill_frame(_received), &m,
+                                 consumer) == 1);
+    /* the buffer was freed by msg_bulk_reply() */
+    expect(msg_bulk_outstanding() == 0);
+    puts("send_receive: OK");
+}
+
+int main(void)
+{
+    puts("msg_bulk test");
+
+    _test_pool();
+
+    kernel_pid_t consumer = thread_create(_stack, sizeof(_stack),
+                                          THREAD_PRIORITY_MAIN - 1,
+                                          THREAD_CREATE_STACKTEST,
+                                          _consumer, NULL, "consumer");
+
+    _test_send(consumer);
+    _test_send_receive(consumer);
+
+    puts("TEST PASSED");
+    return 0;
+}
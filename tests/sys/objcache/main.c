@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for object caches
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "embUnit.h"
+
+#include "objcache.h"
+
+#define OBJ_NUMOF       (4U)
+#define OBJ_ALIGN       (16U)
+
+typedef struct {
+    uint32_t magic;
+    uint8_t payload[21];
+} obj_t;
+
+static uint8_t _buf[OBJCACHE_BUF_SIZE(sizeof(obj_t), OBJ_ALIGN, OBJ_NUMOF)]
+    __attribute__((aligned(OBJ_ALIGN)));
+
+static unsigned _ctor_calls;
+static unsigned _dtor_calls;
+
+static void _ctor(void *obj, void *arg)
+{
+    ((obj_t *)obj)->magic = (uintptr_t)arg;
+    _ctor_calls++;
+}
+
+static void _dtor(void *obj, void *arg)
+{
+    TEST_ASSERT_EQUAL_INT((uintptr_t)arg, ((obj_t *)obj)->magic);
+    _dtor_calls++;
+}
+
+static const objcache_params_t _params = {
+    .name = "test",
+    .ctor = _ctor,
+    .dtor = _dtor,
+    .arg = (void *)0x1234,
+};
+
+/*
+ * all objects can be allocated, aligned and distinct, and are returned to the
+ * cache on free
+ */
+static void test_static(void)
+{
+    objcache_t cache;
+    obj_t *objs[OBJ_NUMOF];
+
+    objcache_init(&cache, _buf, sizeof(obj_t), OBJ_ALIGN, OBJ_NUMOF, NULL);
+    TEST_ASSERT_EQUAL_INT(OBJ_NUMOF, objcache_available(&cache));
+
+    for (unsigned i = 0; i < OBJ_NUMOF; i++) {
+        objs[i] = objcache_alloc(&cache);
+        TEST_ASSERT_NOT_NULL(objs[i]);
+        TEST_ASSERT_EQUAL_INT(0, (uintptr_t)objs[i] % OBJ_ALIGN);
+        for (unsigned j = 0; j < i; j++) {
+            TEST_ASSERT(objs[i] != objs[j]);
+        }
+        objs[i]->magic = i;
+    }
+    TEST_ASSERT_EQUAL_INT(0, objcache_available(&cache));
+    TEST_ASSERT_NULL(objcache_alloc(&cache));
+    TEST_ASSERT_EQUAL_INT(1, cache.fails);
+
+    objcache_free(&cache, objs[1]);
+    TEST_ASSERT_EQUAL_INT(1, objcache_available(&cache));
+    TEST_ASSERT(objcache_alloc(&cache) == objs[1]);
+
+    TEST_ASSERT_EQUAL_INT(-EBUSY, objcache_destroy(&cache));
+
+    for (unsigned i = 0; i < OBJ_NUMOF; i++) {
+        objcache_free(&cache, objs[i]);
+    }
+    objcache_free(&cache, NULL);
+    TEST_ASSERT_EQUAL_INT(OBJ_NUMOF, objcache_available(&cache));
+    TEST_ASSERT_EQUAL_INT(OBJ_NUMOF, cache.used_max);
+
+    TEST_ASSERT_EQUAL_INT(0, objcache_destroy(&cache));
+}
+
+/*
+ * constructor and destructor are called on every allocation and free
+ */
+static void test_ctor_dtor(void)
+{
+    objcache_t *cache = objcache_create(sizeof(obj_t), OBJ_ALIGN, OBJ_NUMOF,
+                                        &_params);
+    TEST_ASSERT_NOT_NULL(cache);
+
+    _ctor_calls = 0;
+    _dtor_calls = 0;
+
+    obj_t *a = objcache_alloc(cache);
+    obj_t *b = objcache_alloc(cache);
+    TEST_ASSERT_NOT_NULL(a);
+    TEST_ASSERT_NOT_NULL(b);
+    TEST_ASSERT_EQUAL_INT(0, (uintptr_t)a % OBJ_ALIGN);
+    TEST_ASSERT_EQUAL_INT(0x1234, a->magic);
+    TEST_ASSERT_EQUAL_INT(2, _ctor_calls);
+
+    objcache_free(cache, a);
+    TEST_ASSERT_EQUAL_INT(1, _dtor_calls);
+
+    objcache_stats();
+
+    objcache_free(cache, b);
+    TEST_ASSERT_EQUAL_INT(2, _dtor_calls);
+    TEST_ASSERT_EQUAL_INT(0, objcache_destroy(cache));
+}
+
+/*
+ * freed objects are filled with the poison pattern, except for the free list
+ * pointer
+ */
+static void test_poison(void)
+{
+    objcache_t cache;
+
+    objcache_init(&cache, _buf, sizeof(obj_t), OBJ_ALIGN, OBJ_NUMOF, NULL);
+
+    obj_t *obj = objcache_alloc(&cache);
+    TEST_ASSERT_NOT_NULL(obj);
+    obj->payload[sizeof(obj->payload) - 1] = 0;
+    objcache_free(&cache, obj);
+
+    const uint8_t *bytes = (const uint8_t *)obj;
+    for (unsigned i = sizeof(void *); i < sizeof(obj_t); i++) {
+        TEST_ASSERT_EQUAL_INT(OBJCACHE_POISON_BYTE, bytes[i]);
+    }
+
+    TEST_ASSERT_EQUAL_INT(0, objcache_destroy(&cache));
+}
+
+static Test *tests_objcache(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_static),
+        new_TestFixture(test_ctor_dtor),
+        new_TestFixture(test_poison),
+    };
+
+    EMB_UNIT_TESTCALLER(tests, NULL, NULL, fixtures);
+
+    return (Test *)&tests;
+}
+
+int main(void)
+{
+    puts("objcache test");
+
+    TESTS_START();
+    TESTS_RUN(tests_objcache());
+    TESTS_END();
+
+    return 0;
+}
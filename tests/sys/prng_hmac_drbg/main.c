@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ *
+ * @file
+ * @brief       Test cases for the HMAC_DRBG random number generator
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "kernel_defines.h"
+#include "macros/utils.h"
+#include "random.h"
+
+/**
+ * @brief seed words 1..8, encoded in little endian
+ */
+static uint32_t seed[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+
+/**
+ * @brief expected output for @ref seed, generated with a Python reference
+ *        implementation of HMAC_DRBG (SHA-256, no personalization string)
+ */
+static const uint8_t seq_seed[] =
+   {0x14, 0x2d, 0x96, 0x5e, 0xdb, 0x30, 0xc0, 0xe4, 0x9b, 0x55, 0x2f, 0xa5, 0xad, 0x0e,
+    0x3d, 0xc2, 0x6b, 0xe4, 0x59, 0x5f, 0x0f, 0x90, 0x11, 0xcf, 0x98, 0x22, 0x15, 0xc1,
+    0xeb, 0xa3, 0xf0, 0xa4, 0x42, 0xa1, 0xf8, 0x24, 0x14, 0x16, 0x3a, 0xe5, 0xae, 0xea,
+    0x0a, 0xbb, 0xf1, 0x8d, 0xea, 0xc1, 0x82, 0x9b, 0x0e, 0x65, 0x94, 0x8a, 0xfc, 0x80,
+    0x2b, 0xee, 0xac, 0xe2, 0x4a, 0x0c, 0xfe, 0x65, 0xc1, 0xc9, 0xfb, 0xe4};
+
+/**
+ * @brief random_uint32() following @ref seq_seed
+ */
+#define SEQ_SEED_NEXT_U32   (1621714601UL)
+
+static void _init(void)
+{
+    uint32_t key[ARRAY_SIZE(seed)];
+
+    for (unsigned i = 0; i < ARRAY_SIZE(seed); i++) {
+        key[i] = htole32(seed[i]);
+    }
+    random_init_by_array(key, ARRAY_SIZE(key));
+}
+
+static void test_prng_hmac_drbg_seed_u8(void)
+{
+    uint8_t test8[sizeof(seq_seed)];
+
+    _init();
+
+    /* request random bytes */
+    random_bytes(test8, sizeof(seq_seed));
+
+    /* compare generator output and reference */
+    if (!(memcmp(test8, seq_seed, sizeof(seq_seed)))) {
+        printf("%s:SUCCESS\n", __func__);
+    }
+    else {
+        printf("%s:FAILURE\n", __func__);
+    }
+}
+
+static void test_prng_hmac_drbg_seed_chunks(void)
+{
+    uint8_t test8[sizeof(seq_seed)];
+    unsigned pos = 0;
+
+    _init();
+
+    /* requests of varying size are served from the same blocks */
+    for (unsigned len = 1; pos < sizeof(test8); len += 3) {
+        len = MIN(len, sizeof(test8) - pos);
+        random_bytes(&test8[pos], len);
+        pos += len;
+    }
+
+    if (!(memcmp(test8, seq_seed, sizeof(seq_seed)))
+        && le32toh(random_uint32()) == SEQ_SEED_NEXT_U32) {
+        printf("%s:SUCCESS\n", __func__);
+    }
+    else {
+        printf("%s:FAILURE\n", __func__);
+    }
+}
+
+int main(void)
+{
+    test_prng_hmac_drbg_seed_u8();
+    test_prng_hmac_drbg_seed_chunks();
+
+    return 0;
+}
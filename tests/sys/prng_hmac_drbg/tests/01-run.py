@@ -0,0 +1,19 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2024 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect("test_prng_hmac_drbg_seed_u8:SUCCESS\r\n")
+    child.expect("test_prng_hmac_drbg_seed_chunks:SUCCESS\r\n")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -57,10 +57,19 @@ def _check_ps(child):
     child.expect_exact('>')
 
 
+def _check_ps_window(child):
+    child.sendline('ps -t')
+    child.expect(r'utilization over the last \d+ us:')
+    child.expect(r'\tpid | name                 | window   | runtime_ms')
+    child.expect(r'\t  2 | main                 | +\d+\.\d+% | +\d+')
+    child.expect_exact('>')
+
+
 def testfunc(child):
     _check_startup(child)
     _check_help(child)
     _check_ps(child)
+    _check_ps_window(child)
 
 
 if __name__ == "__main__":
@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @brief       Tests the asynchronous PSA Crypto jobs
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "mutex.h"
+#include "psa/crypto.h"
+#include "psa_crypto_async.h"
+
+#define JOB_NUMOF       (4)
+
+#define ECC_KEY_SIZE    (256)
+#define ECC_KEY_TYPE    (PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_R1))
+#define ECC_ALG_HASH    (PSA_ALG_SHA_256)
+#define ECC_ALG         (PSA_ALG_ECDSA(ECC_ALG_HASH))
+#define SIG_SIZE        (PSA_ECDSA_SIGNATURE_SIZE(ECC_KEY_SIZE))
+
+static psa_async_job_t _jobs[JOB_NUMOF];
+static uint8_t _sigs[JOB_NUMOF][SIG_SIZE];
+static uint8_t _msgs[JOB_NUMOF][32];
+static uint8_t _hashes[JOB_NUMOF][PSA_HASH_LENGTH(ECC_ALG_HASH)];
+
+static mutex_t _done = MUTEX_INIT_LOCKED;
+static unsigned _completed;
+static bool _in_order = true;
+
+static void _job_done(psa_async_job_t *job, void *arg)
+{
+    (void)arg;
+
+    if (job != &_jobs[_completed]) {
+        _in_order = false;
+    }
+    if (++_completed == JOB_NUMOF) {
+        mutex_unlock(&_done);
+    }
+}
+
+static psa_status_t _wait(void)
+{
+    mutex_lock(&_done);
+    _completed = 0;
+
+    for (unsigned i = 0; i < JOB_NUMOF; i++) {
+        if (_jobs[i].status != PSA_SUCCESS) {
+            return _jobs[i].status;
+        }
+    }
+    return _in_order ? PSA_SUCCESS : PSA_ERROR_GENERIC_ERROR;
+}
+
+static psa_status_t _test_async_ecdsa(void)
+{
+    psa_key_id_t key;
+    psa_key_attributes_t attr = psa_key_attributes_init();
+    size_t hash_length;
+    psa_status_t status;
+
+    psa_set_key_algorithm(&attr, ECC_ALG);
+    psa_set_key_usage_flags(&attr, PSA_KEY_USAGE_SIGN_HASH | PSA_KEY_USAGE_VERIFY_HASH |
+                                   PSA_KEY_USAGE_SIGN_MESSAGE | PSA_KEY_USAGE_VERIFY_MESSAGE);
+    psa_set_key_type(&attr, ECC_KEY_TYPE);
+    psa_set_key_bits(&attr, ECC_KEY_SIZE);
+
+    status = psa_generate_key(&attr, &key);
+    if (status != PSA_SUCCESS) {
+        return status;
+    }
+
+    for (unsigned i = 0; i < JOB_NUMOF; i++) {
+        memset(_msgs[i], i, sizeof(_msgs[i]));
+        status = psa_hash_compute(ECC_ALG_HASH, _msgs[i], sizeof(_msgs[i]),
+                                  _hashes[i], sizeof(_hashes[i]), &hash_length);
+        if (status != PSA_SUCCESS) {
+            return status;
+        }
+    }
+
+    /* the workers run at a lower priority, nothing completes before we wait */
+    for (unsigned i = 0; i < JOB_NUMOF; i++) {
+        status = psa_async_sign_hash(&_jobs[i], key, ECC_ALG, _hashes[i], sizeof(_hashes[i]),
+                                     _sigs[i], sizeof(_sigs[i]), _job_done, NULL);
+        if (status != PSA_SUCCESS) {
+            return status;
+        }
+    }
+    if (_completed != 0) {
+        puts("submission blocked on a job");
+        return PSA_ERROR_GENERIC_ERROR;
+    }
+
+    status = _wait();
+    if (status != PSA_SUCCESS) {
+        return status;
+    }
+
+    for (unsigned i = 0; i < JOB_NUMOF; i++) {
+        status = psa_async_verify_message(&_jobs[i], key, ECC_ALG,
+                                          _msgs[i], sizeof(_msgs[i]),
+                                          _sigs[i], _jobs[i].signature_length,
+                                          _job_done, NULL);
+        if (status != PSA_SUCCESS) {
+            return status;
+        }
+    }
+
+    status = _wait();
+    if (status != PSA_SUCCESS) {
+        return status;
+    }
+
+    /* a signature of a different hash must be rejected */
+    for (unsigned i = 0; i < JOB_NUMOF; i++) {
+        psa_async_verify_hash(&_jobs[i], key, ECC_ALG, _hashes[i], sizeof(_hashes[i]),
+                              _sigs[(i + 1) % JOB_NUMOF], SIG_SIZE, _job_done, NULL);
+    }
+    status = _wait();
+    if (status != PSA_ERROR_INVALID_SIGNATURE) {
+        return PSA_ERROR_GENERIC_ERROR;
+    }
+
+    return psa_destroy_key(key);
+}
+
+int main(void)
+{
+    psa_status_t status;
+
+    psa_crypto_init();
+
+    status = _test_async_ecdsa();
+    if (status != PSA_SUCCESS) {
+        printf("Async ECDSA failed: %s\n", psa_status_to_humanly_readable(status));
+        puts("Tests failed...");
+    }
+    else {
+        puts("All Done");
+    }
+    return 0;
+}
@@ -24,6 +24,7 @@
 
 extern psa_status_t example_ecdsa_p256(void);
 extern psa_status_t test_ecdsa_p256_vectors(void);
+extern psa_status_t test_ecdsa_p256_batch(void);
 
 int main(void)
 {
@@ -38,6 +39,12 @@ int main(void)
         printf("ECDSA test vectors failed: %s\n", psa_status_to_humanly_readable(status));
     }
 
+    status = test_ecdsa_p256_batch();
+    if (status != PSA_SUCCESS) {
+        failed = true;
+        printf("ECDSA batch verification failed: %s\n", psa_status_to_humanly_readable(status));
+    }
+
     ztimer_acquire(ZTIMER_USEC);
     ztimer_now_t start = ztimer_now(ZTIMER_USEC);
 
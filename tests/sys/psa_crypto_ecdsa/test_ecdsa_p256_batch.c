@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests PSA ECDSA batch verification
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "psa/crypto.h"
+#include "ztimer.h"
+
+#define BATCH_SIZE      (8)
+
+#define ECC_KEY_SIZE    (256)
+#define ECC_KEY_TYPE    (PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_R1))
+#define ECC_ALG_HASH    (PSA_ALG_SHA_256)
+#define ECC_ALG         (PSA_ALG_ECDSA(ECC_ALG_HASH))
+#define SIG_SIZE        (PSA_ECDSA_SIGNATURE_SIZE(ECC_KEY_SIZE))
+
+static uint8_t _hashes[BATCH_SIZE][PSA_HASH_LENGTH(ECC_ALG_HASH)];
+static uint8_t _sigs[BATCH_SIZE][SIG_SIZE];
+
+/**
+ * @brief   Verifies a batch of signatures against the individual verification
+ *          and prints the time per signature of both.
+ *
+ * @return  psa_status_t
+ */
+psa_status_t test_ecdsa_p256_batch(void)
+{
+    psa_key_id_t key_id;
+    psa_key_attributes_t key_attr = psa_key_attributes_init();
+    const uint8_t *hashes[BATCH_SIZE];
+    const uint8_t *sigs[BATCH_SIZE];
+    psa_status_t results[BATCH_SIZE];
+    size_t length;
+    psa_status_t status;
+
+    psa_set_key_algorithm(&key_attr, ECC_ALG);
+    psa_set_key_usage_flags(&key_attr, PSA_KEY_USAGE_SIGN_HASH | PSA_KEY_USAGE_VERIFY_HASH);
+    psa_set_key_type(&key_attr, ECC_KEY_TYPE);
+    psa_set_key_bits(&key_attr, ECC_KEY_SIZE);
+
+    status = psa_generate_key(&key_attr, &key_id);
+    if (status != PSA_SUCCESS) {
+        return status;
+    }
+
+    for (unsigned i = 0; i < BATCH_SIZE; i++) {
+        memset(_hashes[i], i, sizeof(_hashes[i]));
+        status = psa_sign_hash(key_id, ECC_ALG, _hashes[i], sizeof(_hashes[i]),
+                               _sigs[i], sizeof(_sigs[i]), &length);
+        if (status != PSA_SUCCESS) {
+            goto out;
+        }
+        hashes[i] = _hashes[i];
+        sigs[i] = _sigs[i];
+    }
+
+    ztimer_acquire(ZTIMER_USEC);
+
+    ztimer_now_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < BATCH_SIZE; i++) {
+        status = psa_verify_hash(key_id, ECC_ALG, hashes[i], sizeof(_hashes[i]),
+                                 sigs[i], SIG_SIZE);
+        if (status != PSA_SUCCESS) {
+            goto out_timer;
+        }
+    }
+    printf("ECDSA verify took %d us per signature\n",
+           (int)(ztimer_now(ZTIMER_USEC) - start) / BATCH_SIZE);
+
+    start = ztimer_now(ZTIMER_USEC);
+    status = psa_verify_hash_batch(key_id, ECC_ALG, hashes, sizeof(_hashes[0]),
+                                   sigs, SIG_SIZE, BATCH_SIZE, results);
+    printf("ECDSA batch verify took %d us per signature\n",
+           (int)(ztimer_now(ZTIMER_USEC) - start) / BATCH_SIZE);
+    if (status != PSA_SUCCESS) {
+        goto out_timer;
+    }
+
+    /* an invalid signature must only fail its own entry */
+    sigs[2] = _sigs[3];
+    status = psa_verify_hash_batch(key_id, ECC_ALG, hashes, sizeof(_hashes[0]),
+                                   sigs, SIG_SIZE, BATCH_SIZE, results);
+    if (status != PSA_ERROR_INVALID_SIGNATURE) {
+        status = PSA_ERROR_GENERIC_ERROR;
+        goto out_timer;
+    }
+    for (unsigned i = 0; i < BATCH_SIZE; i++) {
+        if (results[i] != ((i == 2) ? PSA_ERROR_INVALID_SIGNATURE : PSA_SUCCESS)) {
+            status = PSA_ERROR_GENERIC_ERROR;
+            goto out_timer;
+        }
+    }
+    status = PSA_SUCCESS;
+
+out_timer:
+    ztimer_release(ZTIMER_USEC);
+out:
+    psa_destroy_key(key_id);
+    return status;
+}
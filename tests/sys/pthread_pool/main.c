@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the pthread thread pool
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdio.h>
+
+#include "container.h"
+#include "pthread_pool.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define WORKERS     (3U)
+#define JOBS        (10U)
+
+typedef struct {
+    pthread_pool_work_t work;
+    unsigned num;
+    kernel_pid_t pid;
+} job_t;
+
+static pthread_pool_t _pool;
+static job_t _jobs[JOBS];
+static mutex_t _lock = MUTEX_INIT;
+static unsigned _done;
+
+static void _handler(pthread_pool_work_t *work)
+{
+    job_t *job = container_of(work, job_t, work);
+
+    ztimer_sleep(ZTIMER_MSEC, 10 * (job->num % WORKERS));
+    job->pid = thread_getpid();
+
+    mutex_lock(&_lock);
+    _done++;
+    mutex_unlock(&_lock);
+}
+
+static void _run_jobs(void)
+{
+    for (unsigned i = 0; i < JOBS; i++) {
+        _jobs[i].work.handler = _handler;
+        _jobs[i].num = i;
+        _jobs[i].pid = KERNEL_PID_UNDEF;
+        pthread_pool_submit(&_pool, &_jobs[i].work);
+    }
+}
+
+static unsigned _count_workers(void)
+{
+    kernel_pid_t seen[JOBS];
+    unsigned numof = 0;
+
+    for (unsigned i = 0; i < JOBS; i++) {
+        unsigned j;
+        for (j = 0; (j < numof) && (seen[j] != _jobs[i].pid); j++) {}
+        if (j == numof) {
+            seen[numof++] = _jobs[i].pid;
+        }
+    }
+
+    return numof;
+}
+
+int main(void)
+{
+    puts("pthread pool test");
+
+    expect(pthread_pool_init(&_pool, 0) == EINVAL);
+    expect(pthread_pool_init(&_pool, WORKERS) == 0);
+
+    _run_jobs();
+    while (_done < JOBS) {
+        ztimer_sleep(ZTIMER_MSEC, 10);
+    }
+    printf("%u jobs ran on %u workers\n", JOBS, _count_workers());
+    expect(_count_workers() <= WORKERS);
+
+    /* destroying the pool runs the jobs still queued */
+    _run_jobs();
+    pthread_pool_destroy(&_pool);
+    expect(_done == 2 * JOBS);
+    printf("%u jobs ran on %u workers\n", JOBS, _count_workers());
+    expect(_count_workers() <= WORKERS);
+
+    puts("SUCCESS");
+    return 0;
+}
@@ -21,6 +21,7 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "container.h"
 #include "embUnit.h"
 #include "senml/cbor.h"
 #include "fmt.h"
@@ -108,10 +109,46 @@ void test_senml_encode(void)
     TEST_ASSERT_EQUAL_INT(0, strncmp(expect, result, len));
 }
 
+void test_senml_encode_phydat_batch(void)
+{
+    static const char expect_batch[] = "82A4216162221864236343656C02C4822018D7"
+                                       "A2060A02C4820022";
+    nanocbor_encoder_t enc;
+
+    phydat_t data[] = {
+        { .val = { 215 }, .unit = UNIT_TEMP_C, .scale = -1 },
+        { .val = { -3 }, .unit = UNIT_TEMP_C, .scale = 0 },
+    };
+    senml_numeric_t time[] = { senml_duration_s(0), senml_duration_s(10) };
+    senml_phydat_batch_t batch = {
+        .base_name = "b",
+        .base_time = senml_duration_s(100),
+        .data = data,
+        .time = time,
+        .numof = ARRAY_SIZE(data),
+    };
+
+    nanocbor_encoder_init(&enc, cbor_buf, sizeof cbor_buf);
+    nanocbor_fmt_array(&enc, 2);
+
+    /* encode in two parts, only the first record carries the base fields */
+    senml_encode_phydat_batch_cbor(&enc, &batch, 0, 1);
+    senml_encode_phydat_batch_cbor(&enc, &batch, 1, SIZE_MAX);
+    TEST_ASSERT_EQUAL_INT(0, senml_encode_phydat_batch_cbor(&enc, &batch, 2, 1));
+
+    size_t len = nanocbor_encoded_len(&enc);
+
+    fmt_bytes_hex(result, cbor_buf, len);
+
+    TEST_ASSERT_EQUAL_INT(2 * len, sizeof(expect_batch) - 1);
+    TEST_ASSERT_EQUAL_INT(0, strncmp(expect_batch, result, 2 * len));
+}
+
 Test *tests_senml(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_senml_encode),
+        new_TestFixture(test_senml_encode_phydat_batch),
     };
     EMB_UNIT_TESTCALLER(senml_tests, NULL, NULL, fixtures);
     return (Test *)&senml_tests;
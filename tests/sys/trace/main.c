@@ -31,5 +31,13 @@ int main(void)
 
     trace_dump();
 
+    /* overflow the buffer, the dump has to start with the oldest entry */
+    trace_reset();
+    for (unsigned i = 0; i < CONFIG_TRACE_BUFSIZE + 2; i++) {
+        trace(i);
+    }
+
+    trace_dump();
+
     return 0;
 }
@@ -7,6 +7,8 @@ from testrunner import run
 def testfunc(child):
     child.expect(r"n=   0 t=\ +\d+ v=0x00000000\r\n")
     child.expect(r"n=   1 t=\+\ +\d+ v=0x00000001\r\n")
+    child.expect(r"n=   0 t=\ +\d+ v=0x00000002\r\n")
+    child.expect(r"n=  63 t=\+\ +\d+ v=0x00000041\r\n")
 
 
 if __name__ == "__main__":
@@ -0,0 +1,335 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests for the time-series ring log
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "embUnit.h"
+#include "fs/tslog_fs.h"
+#include "mtd_emulated.h"
+#include "tslog.h"
+#include "vfs.h"
+
+#define SECTOR_COUNT    (6)
+#define PAGE_PER_SECTOR (4)
+#define PAGE_SIZE       (64)
+
+/* the first sector is left to something else */
+#define LOG_FIRST       (1)
+#define LOG_COUNT       (SECTOR_COUNT - LOG_FIRST)
+
+/* 16 byte records, 15 fit into a sector */
+#define PER_SECTOR      ((PAGE_SIZE * PAGE_PER_SECTOR - TSLOG_SECTOR_HDR_SIZE) / 16)
+
+MTD_EMULATED_DEV(0, SECTOR_COUNT, PAGE_PER_SECTOR, PAGE_SIZE);
+
+#define _dev (&mtd_emulated_dev0.base)
+
+static tslog_t _log;
+
+static vfs_mount_t _mnt = {
+    .fs = &tslog_fs_file_system,
+    .mount_point = "/tslog",
+    .private_data = &_log,
+};
+
+static void _append(uint32_t from, uint32_t to)
+{
+    for (uint32_t ts = from; ts < to; ts++) {
+        uint32_t data[2] = { ts, ~ts };
+        TEST_ASSERT_EQUAL_INT(0, tslog_append(&_log, ts, data, sizeof(data)));
+    }
+}
+
+/* reads all records from it on, they must be consecutive */
+static void _check(tslog_iter_t *it, uint32_t first, unsigned expected)
+{
+    uint32_t data[2];
+    uint32_t ts;
+    unsigned count = 0;
+    ssize_t res;
+
+    while ((res = tslog_read(&_log, it, &ts, data, sizeof(data))) >= 0) {
+        TEST_ASSERT_EQUAL_INT(sizeof(data), res);
+        TEST_ASSERT_EQUAL_INT(first + count, ts);
+        TEST_ASSERT_EQUAL_INT(ts, data[0]);
+        TEST_ASSERT_EQUAL_INT(~ts, data[1]);
+        count++;
+    }
+    TEST_ASSERT_EQUAL_INT(-ENOENT, res);
+    TEST_ASSERT_EQUAL_INT(expected, count);
+}
+
+static void _check_all(uint32_t first, unsigned expected)
+{
+    tslog_iter_t it;
+
+    tslog_iter_init(&_log, &it);
+    _check(&it, first, expected);
+}
+
+static void setup(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, tslog_init(&_log, _dev, LOG_FIRST, LOG_COUNT));
+    TEST_ASSERT_EQUAL_INT(0, tslog_format(&_log));
+}
+
+static void test_tslog_init_invalid(void)
+{
+    tslog_t log;
+
+    TEST_ASSERT_EQUAL_INT(-EINVAL, tslog_init(&log, _dev, 0, 1));
+    TEST_ASSERT_EQUAL_INT(-EINVAL, tslog_init(&log, _dev, 1, SECTOR_COUNT));
+}
+
+static void test_tslog_empty(void)
+{
+    tslog_iter_t it;
+    uint8_t buf[4];
+
+    tslog_iter_init(&_log, &it);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, tslog_read(&_log, &it, NULL, buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(0, tslog_seek(&_log, &it, 42));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, tslog_read(&_log, &it, NULL, buf, sizeof(buf)));
+}
+
+static void test_tslog_append_read(void)
+{
+    tslog_iter_t it;
+
+    tslog_iter_init(&_log, &it);
+    _append(100, 140);
+    _check(&it, 100, 40);
+
+    /* the iterator continues with records appended later */
+    _append(140, 141);
+    _check(&it, 140, 1);
+}
+
+static void test_tslog_append_invalid(void)
+{
+    uint8_t buf[CONFIG_TSLOG_RECORD_MAX + 1] = { 0 };
+
+    TEST_ASSERT_EQUAL_INT(-EMSGSIZE, tslog_append(&_log, 1, buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(0, tslog_append(&_log, 10, buf, 0));
+    TEST_ASSERT_EQUAL_INT(0, tslog_append(&_log, 10, buf, CONFIG_TSLOG_RECORD_MAX));
+    TEST_ASSERT_EQUAL_INT(-EINVAL, tslog_append(&_log, 9, buf, 1));
+}
+
+static void test_tslog_truncate(void)
+{
+    uint8_t buf[3];
+    uint32_t data[2] = { 0, UINT32_MAX };
+    tslog_iter_t it;
+
+    _append(0, 1);
+    tslog_iter_init(&_log, &it);
+    TEST_ASSERT_EQUAL_INT(sizeof(data), tslog_read(&_log, &it, NULL, buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(buf, data, sizeof(buf)));
+}
+
+static void test_tslog_seek(void)
+{
+    tslog_iter_t it;
+    uint32_t data[2];
+    uint32_t ts;
+
+    /* timestamps 0, 2, 4, ... spread over three sectors */
+    for (uint32_t i = 0; i < 2 * PER_SECTOR + 5; i++) {
+        data[0] = i;
+        TEST_ASSERT_EQUAL_INT(0, tslog_append(&_log, 2 * i, data, sizeof(data)));
+    }
+
+    for (uint32_t target = 0; target < 4 * PER_SECTOR + 10; target++) {
+        TEST_ASSERT_EQUAL_INT(0, tslog_seek(&_log, &it, target));
+        if (target > 2 * (2 * PER_SECTOR + 4)) {
+            TEST_ASSERT_EQUAL_INT(-ENOENT, tslog_read(&_log, &it, &ts, data, sizeof(data)));
+            continue;
+        }
+        TEST_ASSERT_EQUAL_INT(sizeof(data), tslog_read(&_log, &it, &ts, data, sizeof(data)));
+        TEST_ASSERT_EQUAL_INT((target + 1) & ~1U, ts);
+    }
+}
+
+static void test_tslog_seek_duplicates(void)
+{
+    tslog_iter_t it;
+    uint8_t buf[8] = { 0 };
+    uint32_t ts;
+
+    /* a run of equal timestamps spanning a sector boundary */
+    for (unsigned i = 0; i < 2 * PER_SECTOR; i++) {
+        TEST_ASSERT_EQUAL_INT(0, tslog_append(&_log, (i < 5) ? 1 : 7, buf, sizeof(buf)));
+    }
+
+    TEST_ASSERT_EQUAL_INT(0, tslog_seek(&_log, &it, 7));
+    unsigned count = 0;
+    while (tslog_read(&_log, &it, &ts, buf, sizeof(buf)) >= 0) {
+        TEST_ASSERT_EQUAL_INT(7, ts);
+        count++;
+    }
+    TEST_ASSERT_EQUAL_INT(2 * PER_SECTOR - 5, count);
+}
+
+static void test_tslog_wrap(void)
+{
+    tslog_iter_t it;
+    uint8_t buf[8];
+
+    tslog_iter_init(&_log, &it);
+    _append(0, 10 * PER_SECTOR + 3);
+
+    /* the sector the iterator pointed to was reused */
+    TEST_ASSERT_EQUAL_INT(-ESTALE, tslog_read(&_log, &it, NULL, buf, sizeof(buf)));
+
+    /* all but the sector being written are full */
+    uint32_t first = 10 * PER_SECTOR + 3 - ((LOG_COUNT - 1) * PER_SECTOR + 3);
+    _check(&it, first, 10 * PER_SECTOR + 3 - first);
+    _check_all(first, 10 * PER_SECTOR + 3 - first);
+
+    /* erasing ahead drops the oldest sector only once */
+    TEST_ASSERT_EQUAL_INT(0, tslog_erase_ahead(&_log));
+    TEST_ASSERT_EQUAL_INT(0, tslog_erase_ahead(&_log));
+    _check_all(first + PER_SECTOR, 10 * PER_SECTOR + 3 - first - PER_SECTOR);
+
+    _append(10 * PER_SECTOR + 3, 11 * PER_SECTOR);
+    _append(11 * PER_SECTOR, 11 * PER_SECTOR + 1);
+    _check_all(first + PER_SECTOR, 11 * PER_SECTOR + 1 - first - PER_SECTOR);
+}
+
+static void test_tslog_remount(void)
+{
+    /* the oldest three sectors were reused */
+    _append(0, 7 * PER_SECTOR + 4);
+    _check_all(3 * PER_SECTOR, 4 * PER_SECTOR + 4);
+
+    TEST_ASSERT_EQUAL_INT(0, tslog_init(&_log, _dev, LOG_FIRST, LOG_COUNT));
+    _check_all(3 * PER_SECTOR, 4 * PER_SECTOR + 4);
+
+    /* appending continues where it stopped */
+    _append(7 * PER_SECTOR + 4, 7 * PER_SECTOR + 5);
+    _check_all(3 * PER_SECTOR, 4 * PER_SECTOR + 5);
+    TEST_ASSERT_EQUAL_INT(-EINVAL, tslog_append(&_log, 0, NULL, 0));
+}
+
+static void test_tslog_torn_record(void)
+{
+    uint8_t buf[8];
+    tslog_iter_t it;
+    uint32_t ts;
+
+    _append(0, PER_SECTOR + 2);
+
+    /* corrupt the third record of the first sector */
+    size_t pos = (LOG_FIRST * PAGE_PER_SECTOR * PAGE_SIZE) + TSLOG_SECTOR_HDR_SIZE + 2 * 16 + 9;
+    mtd_emulated_dev0.memory[pos] ^= 0x01;
+
+    /* the rest of the sector is skipped */
+    tslog_iter_init(&_log, &it);
+    for (uint32_t expected = 0; expected < 3; expected++) {
+        TEST_ASSERT_EQUAL_INT(sizeof(buf), tslog_read(&_log, &it, &ts, buf, sizeof(buf)));
+        TEST_ASSERT_EQUAL_INT((expected < 2) ? expected : PER_SECTOR, ts);
+    }
+
+    /* a torn record in the sector being written ends it */
+    _append(PER_SECTOR + 2, PER_SECTOR + 3);
+    pos = ((LOG_FIRST + 1) * PAGE_PER_SECTOR * PAGE_SIZE) + TSLOG_SECTOR_HDR_SIZE + 2 * 16;
+    mtd_emulated_dev0.memory[pos + 16] = 0x00;
+    TEST_ASSERT_EQUAL_INT(0, tslog_init(&_log, _dev, LOG_FIRST, LOG_COUNT));
+    _append(PER_SECTOR + 3, PER_SECTOR + 4);
+    tslog_seek(&_log, &it, PER_SECTOR + 3);
+    TEST_ASSERT_EQUAL_INT(sizeof(buf), tslog_read(&_log, &it, &ts, buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(PER_SECTOR + 3, ts);
+}
+
+static void test_tslog_fs(void)
+{
+    uint8_t buf[5];
+    uint8_t entry[TSLOG_FS_ENTRY_HDR_SIZE + 8];
+    unsigned pos = 0;
+    unsigned count = 0;
+    int fd;
+    ssize_t res;
+
+    _append(0, 2 * PER_SECTOR);
+    TEST_ASSERT_EQUAL_INT(0, vfs_mount(&_mnt));
+
+    TEST_ASSERT_EQUAL_INT(-EROFS, vfs_open("/tslog/log", O_WRONLY, 0));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, vfs_open("/tslog/foo", O_RDONLY, 0));
+
+    fd = vfs_open("/tslog/log", O_RDONLY, 0);
+    TEST_ASSERT(fd >= 0);
+
+    /* records are split over several reads */
+    while ((res = vfs_read(fd, buf, sizeof(buf))) > 0) {
+        for (ssize_t i = 0; i < res; i++) {
+            entry[pos++] = buf[i];
+            if (pos == sizeof(entry)) {
+                TEST_ASSERT_EQUAL_INT(count, byteorder_lebuftohl(entry));
+                TEST_ASSERT_EQUAL_INT(8, byteorder_lebuftohs(&entry[4]));
+                TEST_ASSERT_EQUAL_INT(count, byteorder_lebuftohl(&entry[6]));
+                count++;
+                pos = 0;
+            }
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(0, res);
+    TEST_ASSERT_EQUAL_INT(0, pos);
+    TEST_ASSERT_EQUAL_INT(2 * PER_SECTOR, count);
+
+    TEST_ASSERT_EQUAL_INT(-EINVAL, vfs_lseek(fd, 3, SEEK_SET));
+    TEST_ASSERT_EQUAL_INT(0, vfs_lseek(fd, 0, SEEK_SET));
+    TEST_ASSERT_EQUAL_INT(sizeof(entry), vfs_read(fd, entry, sizeof(entry)));
+    TEST_ASSERT_EQUAL_INT(0, byteorder_lebuftohl(entry));
+
+    TEST_ASSERT_EQUAL_INT(0, vfs_close(fd));
+    TEST_ASSERT_EQUAL_INT(0, vfs_umount(&_mnt, false));
+}
+
+Test *tests_tslog(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_tslog_init_invalid),
+        new_TestFixture(test_tslog_empty),
+        new_TestFixture(test_tslog_append_read),
+        new_TestFixture(test_tslog_append_invalid),
+        new_TestFixture(test_tslog_truncate),
+        new_TestFixture(test_tslog_seek),
+        new_TestFixture(test_tslog_seek_duplicates),
+        new_TestFixture(test_tslog_wrap),
+        new_TestFixture(test_tslog_remount),
+        new_TestFixture(test_tslog_torn_record),
+        new_TestFixture(test_tslog_fs),
+    };
+
+    EMB_UNIT_TESTCALLER(tslog_tests, setup, NULL, fixtures);
+
+    return (Test *)&tslog_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_tslog());
+    TESTS_END();
+    return 0;
+}
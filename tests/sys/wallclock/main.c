@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       wall clock test application
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "test_utils/expect.h"
+#include "time_units.h"
+#include "wallclock.h"
+#include "ztimer.h"
+#include "ztimer64.h"
+
+/* 2024-01-01 00:00:00 UTC */
+#define TEST_TIME       (1704067200LLU * US_PER_SEC)
+
+/* the simulated reference runs this much slower than ZTIMER64_USEC */
+#define TEST_DRIFT_PPB  (-200000L)
+
+/* interval between simulated reference samples */
+#define TEST_INTERVAL   (16LLU * US_PER_SEC)
+
+static int64_t _abs64(int64_t v)
+{
+    return v < 0 ? -v : v;
+}
+
+static void _test_conversion(void)
+{
+    struct timespec ts;
+    struct tm t;
+
+    wallclock_set(TEST_TIME);
+    expect(wallclock_is_set());
+
+    wallclock_gettime(&ts);
+    expect(ts.tv_sec == (time_t)(TEST_TIME / US_PER_SEC));
+
+    wallclock_get_tm(&t);
+    expect(t.tm_year == 124);
+    expect(t.tm_mon == 0);
+    expect(t.tm_mday == 1);
+    expect(t.tm_hour == 0);
+
+    puts("conversion OK");
+}
+
+static void _test_slew(void)
+{
+    uint64_t local = ztimer64_now(ZTIMER64_USEC);
+    uint64_t wall = wallclock_now_usec();
+
+    wallclock_adjust(1000);
+    ztimer_sleep(ZTIMER_MSEC, 100);
+
+    int64_t gained = (int64_t)(wallclock_now_usec() - wall)
+                     - (int64_t)(ztimer64_now(ZTIMER64_USEC) - local);
+
+    printf("slewed %" PRId64 " us in 100 ms\n", gained);
+    /* 500 ppm of 100 ms, plus a microsecond between the two reads */
+    expect(gained > 0);
+    expect(gained <= 51);
+}
+
+static void _test_discipline(void)
+{
+    uint64_t start = ztimer64_now(ZTIMER64_USEC);
+    int64_t offset;
+
+    /* a large offset steps the clock */
+    offset = wallclock_discipline(TEST_TIME + US_PER_SEC, start);
+    expect(offset > (int64_t)CONFIG_WALLCLOCK_STEP_THRESHOLD_US);
+    expect(_abs64(wallclock_now_usec() - (TEST_TIME + US_PER_SEC)) < 1000);
+
+    for (unsigned i = 1; i <= 16; i++) {
+        uint64_t dt = i * TEST_INTERVAL;
+        uint64_t ref = TEST_TIME + US_PER_SEC + dt
+                       + (int64_t)dt / 1000000 * TEST_DRIFT_PPB / 1000;
+
+        offset = wallclock_discipline(ref, start + dt);
+        printf("sample %2u: offset %6" PRId64 " us, freq %7" PRId32 " ppb\n",
+               i, offset, wallclock_get_freq_ppb());
+    }
+
+    expect(_abs64(offset) < 10);
+    expect(_abs64(wallclock_get_freq_ppb() - TEST_DRIFT_PPB) < 1000);
+}
+
+int main(void)
+{
+    _test_conversion();
+    _test_slew();
+    _test_discipline();
+
+    puts("Test successful.");
+
+    return 0;
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       ztimer auto clock selection test application
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "mutex.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+#include "ztimer/auto.h"
+
+/* how late a timeout may be, one ZTIMER_MSEC tick plus scheduling latency */
+#ifndef MAX_LATE_US
+#define MAX_LATE_US     (3000LU)
+#endif
+
+static mutex_t _mutex = MUTEX_INIT_LOCKED;
+static uint32_t _fired;
+
+static void _callback(void *arg)
+{
+    (void)arg;
+    _fired = ztimer_now(ZTIMER_USEC);
+    mutex_unlock(&_mutex);
+}
+
+static ztimer_auto_t _timer = { .callback = _callback };
+
+static void _test(uint32_t timeout, ztimer_clock_t *clock, const char *name)
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    ztimer_auto_set(&_timer, timeout);
+    expect(ztimer_auto_is_set(&_timer));
+    expect(_timer.clock == clock);
+
+    mutex_lock(&_mutex);
+    expect(!ztimer_auto_is_set(&_timer));
+
+    uint32_t elapsed = _fired - start;
+
+    printf("%10"PRIu32" us on %s: %"PRIu32" us\n", timeout, name, elapsed);
+    expect(elapsed >= timeout);
+    expect(elapsed - timeout <= MAX_LATE_US);
+}
+
+int main(void)
+{
+    ztimer_acquire(ZTIMER_USEC);
+
+    _test(5000, ZTIMER_USEC, "ZTIMER_USEC");
+    _test(50000, ZTIMER_MSEC, "ZTIMER_MSEC");
+    _test(1500000, ZTIMER_MSEC, "ZTIMER_MSEC");
+    _test(4500000, ZTIMER_SEC, "ZTIMER_SEC");
+
+    /* a removed timeout must not fire */
+    ztimer_auto_set(&_timer, 20000);
+    expect(ztimer_auto_remove(&_timer));
+    expect(!ztimer_auto_remove(&_timer));
+    ztimer_sleep(ZTIMER_MSEC, 40);
+    expect(mutex_trylock(&_mutex) == 0);
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    ztimer_auto_sleep(100000);
+    expect(ztimer_now(ZTIMER_USEC) - start >= 100000);
+
+    ztimer_release(ZTIMER_USEC);
+
+    puts("Test successful.");
+
+    return 0;
+}
@@ -11,6 +11,7 @@
 #include "embUnit.h"
 #include "xtimer.h"
 #include "ztimer.h"
+#include "ztimer64.h"
 
 #include "test_utils/interactive_sync.h"
 
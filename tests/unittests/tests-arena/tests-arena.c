@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit/embUnit.h"
+
+#include "arena.h"
+#include "tests-arena.h"
+
+#define BUFFER_SIZE         (64U)
+
+static uint8_t _buf[BUFFER_SIZE] __attribute__((aligned(ARENA_ALIGN)));
+static arena_t _arena;
+
+static void set_up(void)
+{
+    memset(_buf, 0xff, sizeof(_buf));
+    arena_init(&_arena, _buf, sizeof(_buf));
+}
+
+static void test_alloc(void)
+{
+    uint8_t *a = arena_alloc(&_arena, 3);
+    uint8_t *b = arena_alloc(&_arena, 5);
+
+    TEST_ASSERT(a == _buf);
+    TEST_ASSERT(b == _buf + ARENA_ALIGN);
+    TEST_ASSERT_EQUAL_INT(0, (uintptr_t)b % ARENA_ALIGN);
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - ARENA_ALIGN - 5,
+                          arena_available(&_arena));
+}
+
+static void test_alloc_aligned(void)
+{
+    uint8_t *a = arena_alloc_aligned(&_arena, 1, 1);
+    uint8_t *b = arena_alloc_aligned(&_arena, 1, 1);
+    uint8_t *c = arena_alloc_aligned(&_arena, 4, 4);
+
+    TEST_ASSERT(a == _buf);
+    TEST_ASSERT(b == _buf + 1);
+    TEST_ASSERT(c == _buf + 4);
+}
+
+static void test_alloc_unaligned_buf(void)
+{
+    arena_init(&_arena, _buf + 1, sizeof(_buf) - 1);
+
+    uint8_t *a = arena_alloc_aligned(&_arena, 1, 4);
+    TEST_ASSERT(a == _buf + 4);
+}
+
+static void test_alloc_full(void)
+{
+    TEST_ASSERT_NOT_NULL(arena_alloc(&_arena, BUFFER_SIZE - 1));
+    TEST_ASSERT_NULL(arena_alloc(&_arena, 1));
+    TEST_ASSERT_NOT_NULL(arena_alloc_aligned(&_arena, 1, 1));
+    TEST_ASSERT_NULL(arena_alloc_aligned(&_arena, 1, 1));
+    TEST_ASSERT_EQUAL_INT(0, arena_available(&_arena));
+
+    arena_reset(&_arena);
+    TEST_ASSERT_NULL(arena_alloc(&_arena, BUFFER_SIZE + 1));
+    TEST_ASSERT_NULL(arena_alloc(&_arena, SIZE_MAX));
+    TEST_ASSERT(arena_alloc(&_arena, BUFFER_SIZE) == _buf);
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, _arena.used_max);
+}
+
+static void test_calloc(void)
+{
+    uint8_t *a = arena_calloc(&_arena, 3, 5);
+
+    TEST_ASSERT_NOT_NULL(a);
+    for (unsigned i = 0; i < 15; i++) {
+        TEST_ASSERT_EQUAL_INT(0, a[i]);
+    }
+    TEST_ASSERT_NULL(arena_calloc(&_arena, SIZE_MAX / 2, 3));
+}
+
+static void test_mark_release(void)
+{
+    uint8_t *a = arena_alloc(&_arena, 8);
+    arena_mark_t outer = arena_mark(&_arena);
+
+    uint8_t *b = arena_alloc(&_arena, 8);
+    arena_mark_t inner = arena_mark(&_arena);
+
+    TEST_ASSERT_NOT_NULL(arena_alloc(&_arena, 8));
+    arena_release(&_arena, inner);
+
+    /* memory after the inner mark is reused */
+    uint8_t *c = arena_alloc(&_arena, 8);
+    TEST_ASSERT(c > b);
+    TEST_ASSERT(arena_mark(&_arena) > inner);
+
+    arena_release(&_arena, outer);
+    TEST_ASSERT(arena_alloc(&_arena, 8) == b);
+
+    arena_reset(&_arena);
+    TEST_ASSERT(arena_alloc(&_arena, 8) == a);
+    TEST_ASSERT_EQUAL_INT(2 * ARENA_ALIGN + 8, _arena.used_max);
+}
+
+static Test *tests_arena_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_alloc),
+        new_TestFixture(test_alloc_aligned),
+        new_TestFixture(test_alloc_unaligned_buf),
+        new_TestFixture(test_alloc_full),
+        new_TestFixture(test_calloc),
+        new_TestFixture(test_mark_release),
+    };
+
+    EMB_UNIT_TESTCALLER(arena_tests, set_up, NULL, fixtures);
+
+    return (Test *)&arena_tests;
+}
+
+void tests_arena(void)
+{
+    TESTS_RUN(tests_arena_tests());
+}
+/** @} */
@@ -0,0 +1,37 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @addtogroup  unittests
+ * @{
+ *
+ * @file
+ * @brief       Unittests for the arena allocator
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ */
+#ifndef TESTS_ARENA_H
+#define TESTS_ARENA_H
+
+#include "embUnit.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Entry point of the test suite
+ */
+void tests_arena(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TESTS_ARENA_H */
+/** @} */
@@ -502,6 +502,41 @@ static void test_base64_13_size_estimation(void) {
     }
 }
 
+static void test_base64_14_encoder(void)
+{
+    static const char data[] =
+        "Peter Piper picked a peck of pickled peppers.\n"
+        "A peck of pickled peppers Peter Piper picked.";
+    char expected[128];
+    char result[128];
+    size_t expected_size = sizeof(expected);
+
+    TEST_ASSERT_EQUAL_INT(BASE64_SUCCESS,
+                          base64_encode(data, strlen(data), expected,
+                                        &expected_size));
+
+    /* feed the data in chunks of 1 to 7 bytes */
+    for (size_t chunk = 1; chunk < 8; chunk++) {
+        base64_encoder_t enc;
+        size_t len = 0;
+
+        base64_encoder_init(&enc);
+        for (size_t pos = 0; pos < strlen(data); pos += chunk) {
+            size_t n = strlen(data) - pos;
+            n = (n < chunk) ? n : chunk;
+            size_t max = base64_encoder_update_size(&enc, n);
+            size_t used = base64_encoder_update(&enc, data + pos, n,
+                                                result + len);
+            TEST_ASSERT(used <= max);
+            len += used;
+        }
+        len += base64_encoder_finish(&enc, result + len);
+
+        TEST_ASSERT_EQUAL_INT(expected_size, len);
+        TEST_ASSERT_EQUAL_INT(0, memcmp(expected, result, len));
+    }
+}
+
 Test *tests_base64_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -519,6 +554,7 @@ Test *tests_base64_tests(void)
         new_TestFixture(test_base64_11_urlsafe_encode_int),
         new_TestFixture(test_base64_12_urlsafe_decode_int),
         new_TestFixture(test_base64_13_size_estimation),
+        new_TestFixture(test_base64_14_encoder),
     };
 
     EMB_UNIT_TESTCALLER(base64_tests, NULL, NULL, fixtures);
@@ -85,11 +85,61 @@ static void test_bloom_based_on_dictionary_fixture(void)
     TEST_ASSERT(false_positive_rate < TESTS_BLOOM_FALSE_POS_RATE_THR * 1000);
 }
 
+static void test_bloom_blocked(void)
+{
+    static uint8_t bits[2 * BLOOM_BLOCKED_BLOCK_SIZE];
+    bloom_blocked_t blocked;
+    int in = 0;
+
+    bloom_blocked_init(&blocked, bits, 2, (hashfp_t)fnv_hash, TESTS_BLOOM_HASHF);
+    for (int i = 0; i < lenB; i++) {
+        bloom_blocked_add(&blocked, (const uint8_t *)B[i], strlen(B[i]));
+    }
+    for (int i = 0; i < lenB; i++) {
+        TEST_ASSERT(bloom_blocked_check(&blocked, (const uint8_t *)B[i],
+                                        strlen(B[i])));
+    }
+    for (int i = 0; i < lenA; i++) {
+        if (bloom_blocked_check(&blocked, (const uint8_t *)A[i],
+                                strlen(A[i]))) {
+            in++;
+        }
+    }
+    TEST_ASSERT(in < TESTS_BLOOM_FALSE_POS_RATE_THR * lenA);
+}
+
+static void test_bloom_counting(void)
+{
+    static uint8_t counters[2 * BLOOM_COUNTING_BLOCK_SIZE];
+    static const uint8_t zero[sizeof(counters)];
+    bloom_counting_t counting;
+
+    bloom_counting_init(&counting, counters, 2, (hashfp_t)fnv_hash,
+                        TESTS_BLOOM_HASHF);
+    for (int i = 0; i < lenB; i++) {
+        bloom_counting_add(&counting, (const uint8_t *)B[i], strlen(B[i]));
+    }
+    /* remove every second element, the others must still be found */
+    for (int i = 0; i < lenB; i += 2) {
+        bloom_counting_remove(&counting, (const uint8_t *)B[i], strlen(B[i]));
+    }
+    for (int i = 1; i < lenB; i += 2) {
+        TEST_ASSERT(bloom_counting_check(&counting, (const uint8_t *)B[i],
+                                         strlen(B[i])));
+    }
+    for (int i = 1; i < lenB; i += 2) {
+        bloom_counting_remove(&counting, (const uint8_t *)B[i], strlen(B[i]));
+    }
+    TEST_ASSERT_EQUAL_INT(0, memcmp(counters, zero, sizeof(counters)));
+}
+
 Test *tests_bloom_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_bloom_parameters_bytes_hashf),
         new_TestFixture(test_bloom_based_on_dictionary_fixture),
+        new_TestFixture(test_bloom_blocked),
+        new_TestFixture(test_bloom_counting),
     };
 
     EMB_UNIT_TESTCALLER(bloom_tests, set_up_bloom, tear_down_bloom, fixtures);
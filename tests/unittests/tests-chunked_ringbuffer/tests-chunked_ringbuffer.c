@@ -100,11 +100,81 @@ static void test_crb_add_while_consume(void)
     TEST_ASSERT_EQUAL_STRING("HelloWorld", buf_out);
 }
 
+static void test_crb_get_chunk(void)
+{
+    uint8_t buffer[16];
+    crb_span_t span[2];
+    chunk_ringbuf_t cb;
+
+    crb_init(&cb, buffer, sizeof(buffer));
+
+    TEST_ASSERT_EQUAL_INT(0, crb_get_chunk(&cb, span));
+
+    TEST_ASSERT(crb_add_chunk(&cb, "0123456789", 10));
+    TEST_ASSERT_EQUAL_INT(1, crb_get_chunk(&cb, span));
+    TEST_ASSERT(span[0].data == buffer);
+    TEST_ASSERT_EQUAL_INT(10, span[0].len);
+    TEST_ASSERT_EQUAL_INT(0, span[1].len);
+
+    /* second chunk wraps around the end of the buffer */
+    TEST_ASSERT(crb_release_chunk(&cb));
+    TEST_ASSERT(crb_add_chunk(&cb, "abcdefgh", 8));
+
+    TEST_ASSERT_EQUAL_INT(2, crb_get_chunk(&cb, span));
+    TEST_ASSERT(span[0].data == &buffer[10]);
+    TEST_ASSERT_EQUAL_INT(6, span[0].len);
+    TEST_ASSERT(memcmp(span[0].data, "abcdef", 6) == 0);
+    TEST_ASSERT(span[1].data == buffer);
+    TEST_ASSERT_EQUAL_INT(2, span[1].len);
+    TEST_ASSERT(memcmp(span[1].data, "gh", 2) == 0);
+
+    TEST_ASSERT(crb_release_chunk(&cb));
+    TEST_ASSERT_EQUAL_INT(0, crb_get_chunk(&cb, span));
+    TEST_ASSERT(!crb_release_chunk(&cb));
+
+    /* chunk that ends exactly at the end of the buffer is continuous */
+    TEST_ASSERT(crb_add_chunk(&cb, "01234567890123", 14));
+    TEST_ASSERT_EQUAL_INT(1, crb_get_chunk(&cb, span));
+    TEST_ASSERT(span[0].data == &buffer[2]);
+    TEST_ASSERT_EQUAL_INT(14, span[0].len);
+}
+
+static void test_crb_add_chunk_irqsafe(void)
+{
+    size_t len;
+    uint8_t buffer[16];
+    char buf_out[6];
+    chunk_ringbuf_t cb;
+
+    crb_init(&cb, buffer, sizeof(buffer));
+
+    TEST_ASSERT(crb_add_chunk_irqsafe(&cb, "one", 4));
+
+    /* a chunk written byte by byte must not be interleaved */
+    TEST_ASSERT(crb_start_chunk(&cb));
+    TEST_ASSERT(crb_add_bytes(&cb, "tw", 2));
+    TEST_ASSERT(!crb_add_chunk_irqsafe(&cb, "xyz", 4));
+    TEST_ASSERT(crb_add_bytes(&cb, "o", 2));
+    TEST_ASSERT(crb_end_chunk(&cb, true));
+
+    TEST_ASSERT(crb_add_chunk_irqsafe(&cb, "three", 6));
+    TEST_ASSERT(!crb_add_chunk_irqsafe(&cb, "four", 5));
+
+    TEST_ASSERT(crb_consume_chunk(&cb, buf_out, sizeof(buf_out)));
+    TEST_ASSERT_EQUAL_STRING("one", buf_out);
+    TEST_ASSERT(crb_consume_chunk(&cb, buf_out, sizeof(buf_out)));
+    TEST_ASSERT_EQUAL_STRING("two", buf_out);
+    TEST_ASSERT(crb_get_chunk_size(&cb, &len));
+    TEST_ASSERT_EQUAL_INT(6, len);
+}
+
 static Test *chunked_ringbuffer_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_crb_add_and_consume),
         new_TestFixture(test_crb_add_while_consume),
+        new_TestFixture(test_crb_get_chunk),
+        new_TestFixture(test_crb_add_chunk_irqsafe),
     };
 
     EMB_UNIT_TESTCALLER(crb_tests, NULL, NULL, fixtures);
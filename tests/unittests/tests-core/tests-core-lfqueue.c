@@ -0,0 +1,182 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "lfqueue.h"
+
+#include "tests-core.h"
+
+#define QUEUE_SIZE  (8U)
+
+typedef struct {
+    uint16_t seq;
+    uint8_t data[5];
+} elem_t;
+
+static elem_t _buf[QUEUE_SIZE];
+static uint32_t _seq[QUEUE_SIZE];
+static lfqueue_t _q;
+
+static void set_up_spsc(void)
+{
+    lfqueue_init(&_q, _buf, NULL, sizeof(_buf[0]), ARRAY_SIZE(_buf));
+}
+
+static void set_up_mpsc(void)
+{
+    memset(_seq, 0, sizeof(_seq));
+    lfqueue_init(&_q, _buf, _seq, sizeof(_buf[0]), ARRAY_SIZE(_buf));
+}
+
+static void _fill(elem_t *elems, unsigned n, uint16_t first)
+{
+    for (unsigned i = 0; i < n; i++) {
+        elems[i].seq = first + i;
+        memset(elems[i].data, (uint8_t)(first + i), sizeof(elems[i].data));
+    }
+}
+
+static void _check(const elem_t *elems, unsigned n, uint16_t first)
+{
+    for (unsigned i = 0; i < n; i++) {
+        TEST_ASSERT_EQUAL_INT(first + i, elems[i].seq);
+        TEST_ASSERT_EQUAL_INT((uint8_t)(first + i), elems[i].data[4]);
+    }
+}
+
+static void test_lfqueue_static_init(void)
+{
+    static elem_t buf[4];
+    static uint32_t seq[4];
+    lfqueue_t spsc = LFQUEUE_INIT(buf);
+    lfqueue_t mpsc = LFQUEUE_MP_INIT(buf, seq);
+
+    TEST_ASSERT_EQUAL_INT(sizeof(elem_t), spsc.elem_size);
+    TEST_ASSERT_EQUAL_INT(4, lfqueue_capacity(&spsc));
+    TEST_ASSERT_NULL(spsc.seq);
+    TEST_ASSERT(mpsc.seq == seq);
+    TEST_ASSERT_EQUAL_INT(0, lfqueue_avail(&mpsc));
+}
+
+static void test_lfqueue_full_empty(void)
+{
+    elem_t elems[QUEUE_SIZE + 1];
+
+    _fill(elems, ARRAY_SIZE(elems), 0);
+    TEST_ASSERT_EQUAL_INT(0, lfqueue_get(&_q, elems, 1));
+    /* only QUEUE_SIZE elements fit */
+    TEST_ASSERT_EQUAL_INT(QUEUE_SIZE, lfqueue_put(&_q, elems, ARRAY_SIZE(elems)));
+    TEST_ASSERT_EQUAL_INT(QUEUE_SIZE, lfqueue_avail(&_q));
+    TEST_ASSERT_EQUAL_INT(0, lfqueue_put(&_q, elems, 1));
+
+    memset(elems, 0, sizeof(elems));
+    TEST_ASSERT_EQUAL_INT(QUEUE_SIZE, lfqueue_get(&_q, elems, ARRAY_SIZE(elems)));
+    _check(elems, QUEUE_SIZE, 0);
+    TEST_ASSERT_EQUAL_INT(0, lfqueue_avail(&_q));
+    TEST_ASSERT_EQUAL_INT(0, lfqueue_get(&_q, elems, 1));
+}
+
+static void test_lfqueue_wrap_around(void)
+{
+    elem_t in[3];
+    elem_t out[3];
+    uint16_t next_in = 0;
+    uint16_t next_out = 0;
+
+    /* batches of three do not divide the queue size, so batches are split
+     * across the end of the buffer */
+    for (unsigned round = 0; round < 4 * QUEUE_SIZE; round++) {
+        _fill(in, ARRAY_SIZE(in), next_in);
+        TEST_ASSERT_EQUAL_INT(3, lfqueue_put(&_q, in, ARRAY_SIZE(in)));
+        next_in += 3;
+
+        TEST_ASSERT_EQUAL_INT(2, lfqueue_get(&_q, out, 2));
+        _check(out, 2, next_out);
+        next_out += 2;
+
+        if (lfqueue_avail(&_q) > QUEUE_SIZE - 3) {
+            unsigned n = lfqueue_get(&_q, out, ARRAY_SIZE(out));
+            _check(out, n, next_out);
+            next_out += n;
+        }
+    }
+}
+
+static void test_lfqueue_wrap_around_counter(void)
+{
+    elem_t elems[QUEUE_SIZE];
+
+    /* positions are free running, check overflow of the 32 bit counters */
+    _q.head = UINT32_MAX - 2;
+    _q.tail = UINT32_MAX - 2;
+    if (_q.seq) {
+        for (unsigned i = 0; i < QUEUE_SIZE; i++) {
+            _q.seq[i] = 0;
+        }
+    }
+
+    _fill(elems, QUEUE_SIZE, 100);
+    TEST_ASSERT_EQUAL_INT(QUEUE_SIZE, lfqueue_put(&_q, elems, QUEUE_SIZE));
+    TEST_ASSERT_EQUAL_INT(0, lfqueue_put(&_q, elems, 1));
+    memset(elems, 0, sizeof(elems));
+    TEST_ASSERT_EQUAL_INT(QUEUE_SIZE, lfqueue_get(&_q, elems, QUEUE_SIZE));
+    _check(elems, QUEUE_SIZE, 100);
+}
+
+static void test_lfqueue_mpsc_unpublished(void)
+{
+    elem_t elems[2];
+
+    /* emulate a producer that was preempted after reserving a slot */
+    _q.head++;
+
+    _fill(elems, 2, 7);
+    TEST_ASSERT_EQUAL_INT(2, lfqueue_put(&_q, elems, 2));
+    TEST_ASSERT_EQUAL_INT(3, lfqueue_avail(&_q));
+    /* the consumer must not skip the reserved slot */
+    TEST_ASSERT_EQUAL_INT(0, lfqueue_get(&_q, elems, 2));
+
+    /* the preempted producer publishes its slot */
+    _fill(&_buf[0], 1, 6);
+    _q.seq[0] = 1;
+
+    elem_t out[3];
+    TEST_ASSERT_EQUAL_INT(3, lfqueue_get(&_q, out, 3));
+    _check(out, 3, 6);
+}
+
+Test *tests_core_lfqueue_spsc_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_lfqueue_static_init),
+        new_TestFixture(test_lfqueue_full_empty),
+        new_TestFixture(test_lfqueue_wrap_around),
+        new_TestFixture(test_lfqueue_wrap_around_counter),
+    };
+
+    EMB_UNIT_TESTCALLER(lfqueue_spsc_tests, set_up_spsc, NULL, fixtures);
+
+    return (Test *)&lfqueue_spsc_tests;
+}
+
+Test *tests_core_lfqueue_mpsc_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_lfqueue_full_empty),
+        new_TestFixture(test_lfqueue_wrap_around),
+        new_TestFixture(test_lfqueue_wrap_around_counter),
+        new_TestFixture(test_lfqueue_mpsc_unpublished),
+    };
+
+    EMB_UNIT_TESTCALLER(lfqueue_mpsc_tests, set_up_mpsc, NULL, fixtures);
+
+    return (Test *)&lfqueue_mpsc_tests;
+}
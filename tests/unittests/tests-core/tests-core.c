@@ -14,6 +14,8 @@ void tests_core(void)
     TESTS_RUN(tests_core_bitarithm_tests());
     TESTS_RUN(tests_core_cib_tests());
     TESTS_RUN(tests_core_clist_tests());
+    TESTS_RUN(tests_core_lfqueue_spsc_tests());
+    TESTS_RUN(tests_core_lfqueue_mpsc_tests());
     TESTS_RUN(tests_core_list_tests());
     TESTS_RUN(tests_core_mbox_tests());
     TESTS_RUN(tests_core_priority_queue_tests());
@@ -57,6 +57,20 @@ Test *tests_core_cib_tests(void);
  */
 Test *tests_core_clist_tests(void);
 
+/**
+ * @brief   Generates tests for lfqueue.h in single producer mode
+ *
+ * @return  embUnit tests if successful, NULL if not.
+ */
+Test *tests_core_lfqueue_spsc_tests(void);
+
+/**
+ * @brief   Generates tests for lfqueue.h in multi producer mode
+ *
+ * @return  embUnit tests if successful, NULL if not.
+ */
+Test *tests_core_lfqueue_mpsc_tests(void);
+
 /**
  * @brief   Generates tests for list.h
  *
@@ -13,7 +13,7 @@
 #include <errno.h>
 #include "embUnit.h"
 #include "tests-fib.h"
-#include "xtimer.h"
+#include "ztimer64.h"
 
 #include "thread.h"
 #include "net/fib.h"
@@ -611,7 +611,7 @@ static void test_fib_15_get_lifetime(void)
                                                     add_buf_size - 1));
 
     /* assuming some ms passed during these operations... */
-    now = xtimer_now_usec64();
+    now = ztimer64_now(ZTIMER64_USEC);
     uint64_t cmp_lifetime = now + 900000lU;
     uint64_t cmp_max_lifetime = now + 1100000lU;
 
@@ -983,6 +983,105 @@ static void test_fib_20_replace_prefix(void)
     fib_deinit(&test_fib_table);
 }
 
+/*
+* @brief testing that the longest matching prefix is used regardless of the
+*        order the entries were added in
+*/
+static void test_fib_21_longest_prefix_match(void)
+{
+    size_t add_buf_size = 16;
+    uint8_t addr_dst[add_buf_size];
+    uint8_t addr_nxt[add_buf_size];
+    uint8_t addr_nxt_hop[add_buf_size];
+    uint8_t addr_lookup[add_buf_size];
+    kernel_pid_t iface_id = KERNEL_PID_UNDEF;
+    uint32_t next_hop_flags = 0;
+
+    /* default route via ::1 */
+    memset(addr_dst, 0, add_buf_size);
+    memset(addr_nxt, 0, add_buf_size);
+    addr_nxt[15] = 1;
+    TEST_ASSERT_EQUAL_INT(0, fib_add_entry(&test_fib_table, 42, addr_dst,
+                                           add_buf_size, 0x0, addr_nxt,
+                                           add_buf_size, 0x0,
+                                           (uint32_t)FIB_LIFETIME_NO_EXPIRE));
+
+    /* 2000::/8 via ::2 */
+    addr_dst[0] = 0x20;
+    addr_nxt[15] = 2;
+    TEST_ASSERT_EQUAL_INT(0, fib_add_entry(&test_fib_table, 42, addr_dst,
+                                           add_buf_size,
+                                           (8 << FIB_FLAG_NET_PREFIX_SHIFT),
+                                           addr_nxt, add_buf_size, 0x0,
+                                           (uint32_t)FIB_LIFETIME_NO_EXPIRE));
+
+    /* 2001:db8:0:1::/64 via ::3 */
+    addr_dst[1] = 0x01;
+    addr_dst[2] = 0x0d;
+    addr_dst[3] = 0xb8;
+    addr_dst[7] = 0x01;
+    addr_nxt[15] = 3;
+    TEST_ASSERT_EQUAL_INT(0, fib_add_entry(&test_fib_table, 42, addr_dst,
+                                           add_buf_size,
+                                           (64 << FIB_FLAG_NET_PREFIX_SHIFT),
+                                           addr_nxt, add_buf_size, 0x0,
+                                           (uint32_t)FIB_LIFETIME_NO_EXPIRE));
+
+    /* 2001:db8::/32 via ::4, added after the longer prefix */
+    addr_dst[7] = 0x00;
+    addr_nxt[15] = 4;
+    TEST_ASSERT_EQUAL_INT(0, fib_add_entry(&test_fib_table, 42, addr_dst,
+                                           add_buf_size,
+                                           (32 << FIB_FLAG_NET_PREFIX_SHIFT),
+                                           addr_nxt, add_buf_size, 0x0,
+                                           (uint32_t)FIB_LIFETIME_NO_EXPIRE));
+
+    /* 2001:db8:0:1::1 matches all entries, the /64 prefix is the longest */
+    memcpy(addr_lookup, addr_dst, add_buf_size);
+    addr_lookup[7] = 0x01;
+    addr_lookup[15] = 0x01;
+    TEST_ASSERT_EQUAL_INT(0, fib_get_next_hop(&test_fib_table, &iface_id,
+                                              addr_nxt_hop, &add_buf_size,
+                                              &next_hop_flags, addr_lookup,
+                                              add_buf_size, 0x0));
+    TEST_ASSERT_EQUAL_INT(3, addr_nxt_hop[15]);
+
+    /* 2001:db8:0:2::1 is outside of 2001:db8:0:1::/64 */
+    addr_lookup[7] = 0x02;
+    add_buf_size = 16;
+    TEST_ASSERT_EQUAL_INT(0, fib_get_next_hop(&test_fib_table, &iface_id,
+                                              addr_nxt_hop, &add_buf_size,
+                                              &next_hop_flags, addr_lookup,
+                                              add_buf_size, 0x0));
+    TEST_ASSERT_EQUAL_INT(4, addr_nxt_hop[15]);
+
+    /* 2001:db9:0:2::1 is outside of 2001:db8::/32 */
+    addr_lookup[3] = 0xb9;
+    add_buf_size = 16;
+    TEST_ASSERT_EQUAL_INT(0, fib_get_next_hop(&test_fib_table, &iface_id,
+                                              addr_nxt_hop, &add_buf_size,
+                                              &next_hop_flags, addr_lookup,
+                                              add_buf_size, 0x0));
+    TEST_ASSERT_EQUAL_INT(2, addr_nxt_hop[15]);
+
+    /* 3001:db9:0:2::1 is only covered by the default route */
+    addr_lookup[0] = 0x30;
+    add_buf_size = 16;
+    TEST_ASSERT_EQUAL_INT(0, fib_get_next_hop(&test_fib_table, &iface_id,
+                                              addr_nxt_hop, &add_buf_size,
+                                              &next_hop_flags, addr_lookup,
+                                              add_buf_size, 0x0));
+    TEST_ASSERT_EQUAL_INT(1, addr_nxt_hop[15]);
+
+#if (TEST_FIB_SHOW_OUTPUT == 1)
+    fib_print_fib_table(&test_fib_table);
+    puts("");
+    universal_address_print_table();
+    puts("");
+#endif
+    fib_deinit(&test_fib_table);
+}
+
 Test *tests_fib_tests(void)
 {
     fib_init(&test_fib_table);
@@ -1007,6 +1106,7 @@ Test *tests_fib_tests(void)
                         new_TestFixture(test_fib_18_get_next_hop_invalid_parameters),
                         new_TestFixture(test_fib_19_default_gateway),
                         new_TestFixture(test_fib_20_replace_prefix),
+                        new_TestFixture(test_fib_21_longest_prefix_match),
     };
 
     EMB_UNIT_TESTCALLER(fib_tests, NULL, NULL, fixtures);
@@ -29,12 +29,10 @@
 
 static void set_up(void)
 {
-    evtimer_event_t *tmp;
+    evtimer_event_t *ptr;
 
-    for (evtimer_event_t *ptr = _nib_evtimer.events;
-         (ptr != NULL) && (tmp = (ptr->next), 1);
-         ptr = tmp) {
-        evtimer_del((evtimer_t *)(&_nib_evtimer), ptr);
+    while ((ptr = evtimer_iter(&_nib_evtimer, NULL))) {
+        evtimer_del(&_nib_evtimer, ptr);
     }
     _nib_init();
 }
@@ -220,7 +220,7 @@ static void test_nib_nc_mark_reachable__not_in_neighbor_cache(void)
     TEST_ASSERT_EQUAL_INT(GNRC_IPV6_NIB_NC_INFO_NUD_STATE_UNREACHABLE,
                           gnrc_ipv6_nib_nc_get_nud_state(&nce));
     TEST_ASSERT(!gnrc_ipv6_nib_nc_iter(0, &iter_state, &nce));
-    TEST_ASSERT_NULL(_nib_evtimer.events);
+    TEST_ASSERT_NULL(evtimer_iter(&_nib_evtimer, NULL));
 
     addr.u64[1].u64++;
     gnrc_ipv6_nib_nc_mark_reachable(&addr);
@@ -228,7 +228,7 @@ static void test_nib_nc_mark_reachable__not_in_neighbor_cache(void)
     TEST_ASSERT_EQUAL_INT(GNRC_IPV6_NIB_NC_INFO_NUD_STATE_UNREACHABLE,
                           gnrc_ipv6_nib_nc_get_nud_state(&nce));
     /* check if there are still no events */
-    TEST_ASSERT_NULL(_nib_evtimer.events);
+    TEST_ASSERT_NULL(evtimer_iter(&_nib_evtimer, NULL));
     /* check if still the only entry */
     iter_state = NULL;
     TEST_ASSERT(gnrc_ipv6_nib_nc_iter(0, &iter_state, &nce));
@@ -254,13 +254,13 @@ static void test_nib_nc_mark_reachable__unmanaged(void)
     TEST_ASSERT_EQUAL_INT(GNRC_IPV6_NIB_NC_INFO_NUD_STATE_UNMANAGED,
                           gnrc_ipv6_nib_nc_get_nud_state(&nce));
     TEST_ASSERT(!gnrc_ipv6_nib_nc_iter(0, &iter_state, &nce));
-    TEST_ASSERT_NULL(_nib_evtimer.events);
+    TEST_ASSERT_NULL(evtimer_iter(&_nib_evtimer, NULL));
     gnrc_ipv6_nib_nc_mark_reachable(&addr);
     /* check if entry is still unmanaged */
     TEST_ASSERT_EQUAL_INT(GNRC_IPV6_NIB_NC_INFO_NUD_STATE_UNMANAGED,
                           gnrc_ipv6_nib_nc_get_nud_state(&nce));
     /* check if there are still no events */
-    TEST_ASSERT_NULL(_nib_evtimer.events);
+    TEST_ASSERT_NULL(evtimer_iter(&_nib_evtimer, NULL));
     /* check if still the only entry */
     iter_state = NULL;
     TEST_ASSERT(gnrc_ipv6_nib_nc_iter(0, &iter_state, &nce));
@@ -289,7 +289,7 @@ static void test_nib_nc_mark_reachable__success(void)
     TEST_ASSERT_EQUAL_INT(GNRC_IPV6_NIB_NC_INFO_NUD_STATE_UNREACHABLE,
                           gnrc_ipv6_nib_nc_get_nud_state(&nce));
     TEST_ASSERT(!gnrc_ipv6_nib_nc_iter(0, &iter_state, &nce));
-    TEST_ASSERT_NULL(_nib_evtimer.events);
+    TEST_ASSERT_NULL(evtimer_iter(&_nib_evtimer, NULL));
 
     gnrc_ipv6_nib_nc_mark_reachable(&addr);
 
@@ -132,6 +132,22 @@ static void test_pktq_empty(void)
     TEST_ASSERT(gnrc_netif_pktq_empty(&_netif));
 }
 
+static void test_pktq_len(void)
+{
+    gnrc_pktsnip_t pkt_in[2];
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_len(&_netif));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, &pkt_in[0]));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_push_back(&_netif, &pkt_in[1]));
+    TEST_ASSERT_EQUAL_INT(2, gnrc_netif_pktq_len(&_netif));
+    TEST_ASSERT_NOT_NULL(gnrc_netif_pktq_get(&_netif));
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netif_pktq_len(&_netif));
+    TEST_ASSERT_NOT_NULL(gnrc_netif_pktq_get(&_netif));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_len(&_netif));
+    TEST_ASSERT_NULL(gnrc_netif_pktq_get(&_netif));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_len(&_netif));
+}
+
 static Test *test_gnrc_netif_pktq(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -144,6 +160,7 @@ static Test *test_gnrc_netif_pktq(void)
         new_TestFixture(test_pktq_push_back_get1),
         new_TestFixture(test_pktq_push_back_get3),
         new_TestFixture(test_pktq_empty),
+        new_TestFixture(test_pktq_len),
     };
 
     EMB_UNIT_TESTCALLER(pktq_tests, set_up, NULL, fixtures);
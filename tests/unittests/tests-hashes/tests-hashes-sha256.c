@@ -27,6 +27,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#include "container.h"
 #include "embUnit/embUnit.h"
 
 #include "hashes/sha256.h"
@@ -267,6 +268,48 @@ static void test_hashes_sha256_hash_sequence_abc_long(void)
     TEST_ASSERT(calc_and_compare_hash_wrapper(teststring, h_fips_multiblock));
 }
 
+/* compares every lane of the multi-buffer variant with sha256(), for lengths
+ * around the block and padding boundaries and updates split across blocks */
+static void test_hashes_sha256_multi(void)
+{
+    static const size_t lengths[] = { 0, 1, 55, 56, 63, 64, 65, 119, 120, 200 };
+    uint8_t msgs[SHA2XX_MULTI_LANES_MAX][200];
+    uint8_t digests[SHA2XX_MULTI_LANES_MAX][SHA256_DIGEST_LENGTH];
+    uint8_t expected[SHA256_DIGEST_LENGTH];
+    const void *data[SHA2XX_MULTI_LANES_MAX];
+    void *digest[SHA2XX_MULTI_LANES_MAX];
+
+    for (unsigned l = 0; l < SHA2XX_MULTI_LANES_MAX; l++) {
+        for (unsigned i = 0; i < sizeof(msgs[l]); i++) {
+            msgs[l][i] = i * (l + 3);
+        }
+        digest[l] = digests[l];
+    }
+
+    for (unsigned lanes = 1; lanes <= SHA2XX_MULTI_LANES_MAX; lanes++) {
+        for (unsigned i = 0; i < ARRAY_SIZE(lengths); i++) {
+            sha256_multi_context_t ctx;
+            size_t first = lengths[i] / 3;
+
+            sha256_multi_init(&ctx, lanes);
+            for (unsigned l = 0; l < lanes; l++) {
+                data[l] = msgs[l];
+            }
+            sha256_multi_update(&ctx, data, first);
+            for (unsigned l = 0; l < lanes; l++) {
+                data[l] = &msgs[l][first];
+            }
+            sha256_multi_update(&ctx, data, lengths[i] - first);
+            sha256_multi_final(&ctx, digest);
+
+            for (unsigned l = 0; l < lanes; l++) {
+                sha256(msgs[l], lengths[i], expected);
+                TEST_ASSERT_EQUAL_INT(0, memcmp(digests[l], expected, sizeof(expected)));
+            }
+        }
+    }
+}
+
 Test *tests_hashes_sha256_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -285,6 +328,8 @@ Test *tests_hashes_sha256_tests(void)
 
         new_TestFixture(test_hashes_sha256_hash_sequence_abc),
         new_TestFixture(test_hashes_sha256_hash_sequence_abc_long),
+
+        new_TestFixture(test_hashes_sha256_multi),
     };
 
     EMB_UNIT_TESTCALLER(hashes_sha256_tests, NULL, NULL,
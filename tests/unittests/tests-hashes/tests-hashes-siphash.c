@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2024 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     unittests
+ * @{
+ *
+ * @file
+ * @brief       Test cases for the SipHash implementation
+ *
+ * @author      RIOT developers <devel@riot-os.org>
+ *
+ * @}
+ */
+
+#include <stdint.h>
+
+#include "embUnit/embUnit.h"
+
+#include "hashes/siphash.h"
+
+static uint8_t _key[SIPHASH_KEY_LENGTH];
+static uint8_t _msg[64];
+
+static void set_up(void)
+{
+    for (unsigned i = 0; i < sizeof(_key); i++) {
+        _key[i] = i;
+    }
+    for (unsigned i = 0; i < sizeof(_msg); i++) {
+        _msg[i] = i;
+    }
+}
+
+/* test vectors from the reference implementation and appendix A of the paper,
+ * see https://cr.yp.to/siphash/siphash-20120918.pdf */
+static void test_hashes_siphash(void)
+{
+    TEST_ASSERT(siphash(_key, _msg, 0) == 0x726fdb47dd0e0e31ULL);
+    TEST_ASSERT(siphash(_key, _msg, 15) == 0xa129ca6149be45e5ULL);
+}
+
+static void test_hashes_siphash_update(void)
+{
+    for (unsigned len = 0; len <= sizeof(_msg); len++) {
+        for (unsigned split = 0; split <= len; split++) {
+            siphash_context_t ctx;
+
+            siphash_init(&ctx, _key);
+            siphash_update(&ctx, _msg, split);
+            siphash_update(&ctx, &_msg[split], len - split);
+            TEST_ASSERT(siphash_final(&ctx) == siphash(_key, _msg, len));
+        }
+    }
+}
+
+Test *tests_hashes_siphash_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_hashes_siphash),
+        new_TestFixture(test_hashes_siphash_update),
+    };
+
+    EMB_UNIT_TESTCALLER(test_hashes_siphash, set_up, NULL, fixtures);
+
+    return (Test *)&test_hashes_siphash;
+}
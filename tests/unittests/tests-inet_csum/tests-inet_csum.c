@@ -13,6 +13,7 @@
  */
 #include <errno.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "embUnit.h"
 
@@ -165,6 +166,58 @@ static void test_inet_csum__empty_app_buffer(void)
     TEST_ASSERT_EQUAL_INT(hdr_expected, pyld_sum);
 }
 
+/* plain 16-bit word loop the optimized implementation is compared against */
+static uint16_t _ref_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len,
+                                size_t accum_len)
+{
+    uint32_t csum = sum;
+
+    if (len == 0) {
+        return csum;
+    }
+    if (accum_len & 1) {
+        csum += *buf;
+        buf++;
+        len--;
+        accum_len++;
+    }
+    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
+        csum += (uint16_t)(*buf << 8) + *(buf + 1);
+    }
+    if ((accum_len + len) & 1) {
+        csum += (uint16_t)(*buf << 8);
+    }
+    while (csum >> 16) {
+        csum = (csum & 0xffff) + (csum >> 16);
+    }
+    return csum;
+}
+
+static void test_inet_csum__matches_reference(void)
+{
+    static uint8_t data[300 + 8];
+    uint32_t state = 0x12345678;
+
+    /* 0xff bytes provoke the most carries */
+    memset(data, 0xff, sizeof(data) / 2);
+    for (unsigned i = sizeof(data) / 2; i < sizeof(data); i++) {
+        state = state * 1103515245 + 12345;
+        data[i] = state >> 24;
+    }
+    for (unsigned offset = 0; offset < 8; offset++) {
+        for (unsigned len = 0; len <= 300; len++) {
+            for (unsigned accum_len = 0; accum_len < 2; accum_len++) {
+                /* start in the 0xff bytes for short buffers */
+                const uint8_t *buf = &data[offset + ((len < 100) ? 50 : 0)];
+                uint16_t sum = (len & 2) ? 0xfffe : len;
+
+                TEST_ASSERT_EQUAL_INT(_ref_csum_slice(sum, buf, len, accum_len),
+                                      inet_csum_slice(sum, buf, len, accum_len));
+            }
+        }
+    }
+}
+
 Test *tests_inet_csum_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -176,6 +229,7 @@ Test *tests_inet_csum_tests(void)
         new_TestFixture(test_inet_csum__odd_len),
         new_TestFixture(test_inet_csum__two_app_snips),
         new_TestFixture(test_inet_csum__empty_app_buffer),
+        new_TestFixture(test_inet_csum__matches_reference),
     };
 
     EMB_UNIT_TESTCALLER(inet_csum_tests, NULL, NULL, fixtures);
@@ -17,6 +17,7 @@
 #include <string.h>
 #include <stdio.h>
 
+#include "container.h"
 #include "embUnit.h"
 
 #include "net/nanocoap.h"
@@ -953,6 +954,87 @@ static void test_nanocoap__options_get_opaque(void)
     TEST_ASSERT_EQUAL_INT(-ENOENT, optlen);
 }
 
+/*
+ * Tests coap_find_option() for options before, between and after the options
+ * of a parsed packet.
+ */
+static void test_nanocoap__find_option(void)
+{
+    coap_pkt_t pkt;
+    int res = _read_rd_post_req(&pkt, false);
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    uint8_t *hdr = (uint8_t *)pkt.hdr;
+
+    TEST_ASSERT_NULL(coap_find_option(&pkt, COAP_OPT_OBSERVE));
+    TEST_ASSERT(coap_find_option(&pkt, COAP_OPT_URI_PATH) == hdr + 6);
+    TEST_ASSERT(coap_find_option(&pkt, COAP_OPT_CONTENT_FORMAT) == hdr + 25);
+    TEST_ASSERT_NULL(coap_find_option(&pkt, COAP_OPT_MAX_AGE));
+    TEST_ASSERT(coap_find_option(&pkt, COAP_OPT_URI_QUERY) == hdr + 27);
+    TEST_ASSERT_NULL(coap_find_option(&pkt, COAP_OPT_ACCEPT));
+    TEST_ASSERT_NULL(coap_find_option(&pkt, COAP_OPT_BLOCK2));
+    TEST_ASSERT_EQUAL_INT(COAP_FORMAT_LINK, coap_get_content_type(&pkt));
+    TEST_ASSERT_EQUAL_INT(COAP_FORMAT_NONE, coap_get_accept(&pkt));
+}
+
+/*
+ * Builds a POST from a template with pre-encoded options and compares it to
+ * the same request built at runtime.
+ */
+static void test_nanocoap__build_from_template(void)
+{
+    static const struct {
+        COAP_OPT_ENC_STR_T("sensor") path0;
+        COAP_OPT_ENC_STR_T("telemetry") path1;
+        COAP_OPT_ENC_UINT8_T format;
+        COAP_OPT_ENC_UINT16_T accept;
+    } opts = {
+        COAP_OPT_ENC_STR(COAP_OPT_URI_PATH, "sensor"),
+        COAP_OPT_ENC_STR(0, "telemetry"),
+        COAP_OPT_ENC_UINT8(COAP_OPT_CONTENT_FORMAT - COAP_OPT_URI_PATH,
+                           COAP_FORMAT_CBOR),
+        COAP_OPT_ENC_UINT16(COAP_OPT_ACCEPT - COAP_OPT_CONTENT_FORMAT,
+                            COAP_FORMAT_PROBLEM_DETAILS_CBOR),
+    };
+    static const coap_template_t tpl = {
+        .opts = &opts,
+        .opts_len = sizeof(opts),
+        .type = COAP_TYPE_NON,
+        .code = COAP_METHOD_POST,
+        .payload = true,
+    };
+    uint8_t token[2] = { 0xDA, 0xEC };
+    uint8_t buf[_BUF_SIZE];
+    uint8_t ref[_BUF_SIZE];
+    coap_pkt_t pkt;
+
+    ssize_t ref_len = coap_build_hdr((coap_hdr_t *)ref, COAP_TYPE_NON, token,
+                                     sizeof(token), COAP_METHOD_POST, 0xABCD);
+    coap_pkt_init(&pkt, ref, sizeof(ref), ref_len);
+    coap_opt_add_uri_path(&pkt, "/sensor/telemetry");
+    coap_opt_add_format(&pkt, COAP_FORMAT_CBOR);
+    coap_opt_add_accept(&pkt, COAP_FORMAT_PROBLEM_DETAILS_CBOR);
+    ref_len = coap_opt_finish(&pkt, COAP_OPT_FINISH_PAYLOAD);
+
+    ssize_t len = coap_build_from_template(&pkt, buf, sizeof(buf), &tpl,
+                                           token, sizeof(token), 0xABCD);
+    TEST_ASSERT_EQUAL_INT(ref_len, len);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(ref, buf, len));
+    TEST_ASSERT(pkt.payload == buf + len);
+    TEST_ASSERT_EQUAL_INT(sizeof(buf) - len, pkt.payload_len);
+
+    /* the result parses as the request it should be */
+    pkt.payload[0] = 0xa0;
+    TEST_ASSERT_EQUAL_INT(0, coap_parse(&pkt, buf, len + 1));
+    TEST_ASSERT_EQUAL_INT(COAP_FORMAT_CBOR, coap_get_content_type(&pkt));
+    TEST_ASSERT_EQUAL_INT(COAP_FORMAT_PROBLEM_DETAILS_CBOR, coap_get_accept(&pkt));
+    TEST_ASSERT_EQUAL_INT(1, pkt.payload_len);
+
+    TEST_ASSERT_EQUAL_INT(-ENOSPC,
+                          coap_build_from_template(&pkt, buf, len - 1, &tpl,
+                                                   token, sizeof(token), 0));
+}
+
 /*
  * Validates empty message parsing.
  */
@@ -1129,6 +1211,59 @@ static void test_nanocoap__token_length_ext_269(void)
     TEST_ASSERT_EQUAL_INT(14, hdr->ver_t_tkl & 0xf);
 }
 
+/*
+ * Verifies that coap_find_resource_sorted() finds the same resource as
+ * checking all resources in order
+ */
+static void test_nanocoap__find_resource_sorted(void)
+{
+    static const coap_resource_t resources[] = {
+        { "/a", COAP_GET | COAP_MATCH_SUBTREE, NULL, NULL },
+        { "/a/b", COAP_GET, NULL, NULL },
+        { "/a/b", COAP_POST, NULL, NULL },
+        { "/abc", COAP_GET, NULL, NULL },
+        { "/b", COAP_PUT, NULL, NULL },
+        { "/b/c", COAP_GET | COAP_PUT, NULL, NULL },
+        { "/c/d", COAP_POST | COAP_MATCH_SUBTREE, NULL, NULL },
+    };
+    static const char *uris[] = {
+        "/", "/a", "/a/b", "/a/bc", "/ab", "/abc", "/abcd", "/b", "/b/c",
+        "/b/cd", "/c", "/c/d", "/c/d/e", "/d",
+    };
+    static const coap_method_flags_t methods[] = {
+        COAP_GET, COAP_POST, COAP_PUT,
+    };
+
+    for (unsigned i = 0; i < ARRAY_SIZE(uris); i++) {
+        for (unsigned j = 0; j < ARRAY_SIZE(methods); j++) {
+            const uint8_t *uri = (const uint8_t *)uris[i];
+            const coap_resource_t *expected = NULL;
+            const coap_resource_t *found = NULL;
+            int expected_res = -ENOENT;
+
+            for (unsigned k = 0; k < ARRAY_SIZE(resources); k++) {
+                if (coap_match_path(&resources[k], uri) != 0) {
+                    continue;
+                }
+                if (resources[k].methods & methods[j]) {
+                    expected = &resources[k];
+                    expected_res = 0;
+                    break;
+                }
+                expected_res = -EPERM;
+            }
+            TEST_ASSERT_EQUAL_INT(expected_res,
+                                  coap_find_resource_sorted(resources,
+                                                            ARRAY_SIZE(resources),
+                                                            uri, methods[j],
+                                                            &found));
+            if (expected) {
+                TEST_ASSERT(expected == found);
+            }
+        }
+    }
+}
+
 Test *tests_nanocoap_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -1167,6 +1302,9 @@ Test *tests_nanocoap_tests(void)
         new_TestFixture(test_nanocoap__token_length_over_limit),
         new_TestFixture(test_nanocoap__token_length_ext_16),
         new_TestFixture(test_nanocoap__token_length_ext_269),
+        new_TestFixture(test_nanocoap__find_resource_sorted),
+        new_TestFixture(test_nanocoap__find_option),
+        new_TestFixture(test_nanocoap__build_from_template),
     };
 
     EMB_UNIT_TESTCALLER(nanocoap_tests, NULL, NULL, fixtures);
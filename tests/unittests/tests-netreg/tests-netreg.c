@@ -17,6 +17,7 @@
 
 #include "net/gnrc/netreg.h"
 #include "net/gnrc/nettype.h"
+#include "container.h"
 
 #include "unittests-constants.h"
 #include "tests-netreg.h"
@@ -185,6 +186,44 @@ void test_netreg_getnext__2_entries(void)
     gnrc_netreg_release_shared();
 }
 
+void test_netreg_hash__udp(void)
+{
+    /* two ports in the same bucket, one in another */
+    static gnrc_netreg_entry_t udp[] = {
+        GNRC_NETREG_ENTRY_INIT_PID(5683, TEST_UINT8),
+        GNRC_NETREG_ENTRY_INIT_PID(5683 + CONFIG_GNRC_NETREG_HASH_BUCKETS, TEST_UINT8),
+        GNRC_NETREG_ENTRY_INIT_PID(5683, TEST_UINT8 + 1),
+        GNRC_NETREG_ENTRY_INIT_PID(5684, TEST_UINT8),
+    };
+    gnrc_netreg_entry_t *res;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(udp); i++) {
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_UDP, &udp[i]));
+    }
+    TEST_ASSERT_EQUAL_INT(2, gnrc_netreg_num(GNRC_NETTYPE_UDP, 5683));
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netreg_num(GNRC_NETTYPE_UDP,
+                                             5683 + CONFIG_GNRC_NETREG_HASH_BUCKETS));
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netreg_num(GNRC_NETTYPE_UDP, 5684));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_num(GNRC_NETTYPE_UDP, 5685));
+    gnrc_netreg_acquire_shared();
+    TEST_ASSERT_NOT_NULL((res = gnrc_netreg_lookup(GNRC_NETTYPE_UDP, 5683)));
+    TEST_ASSERT_EQUAL_INT(5683, res->demux_ctx);
+    TEST_ASSERT_NOT_NULL((res = gnrc_netreg_getnext(res)));
+    TEST_ASSERT_EQUAL_INT(5683, res->demux_ctx);
+    TEST_ASSERT_NULL(gnrc_netreg_getnext(res));
+    gnrc_netreg_release_shared();
+
+    gnrc_netreg_unregister(GNRC_NETTYPE_UDP, &udp[0]);
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netreg_num(GNRC_NETTYPE_UDP, 5683));
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netreg_num(GNRC_NETTYPE_UDP,
+                                             5683 + CONFIG_GNRC_NETREG_HASH_BUCKETS));
+    for (unsigned i = 1; i < ARRAY_SIZE(udp); i++) {
+        gnrc_netreg_unregister(GNRC_NETTYPE_UDP, &udp[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_num(GNRC_NETTYPE_UDP, 5683));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_num(GNRC_NETTYPE_UDP, 5684));
+}
+
 Test *tests_netreg_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -201,6 +240,7 @@ Test *tests_netreg_tests(void)
         new_TestFixture(test_netreg_num__2_entries),
         new_TestFixture(test_netreg_getnext__NULL),
         new_TestFixture(test_netreg_getnext__2_entries),
+        new_TestFixture(test_netreg_hash__udp),
     };
 
     EMB_UNIT_TESTCALLER(netreg_tests, set_up, NULL, fixtures);
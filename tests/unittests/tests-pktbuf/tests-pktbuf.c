@@ -26,6 +26,9 @@
 #include "tests-pktbuf.h"
 
 #define ALIGNMENT_SIZE (2 * sizeof(uintptr_t))
+/* space a packet snip descriptor takes in gnrc_pktbuf_static */
+#define SNIP_SIZE      (((sizeof(gnrc_pktsnip_t) + ALIGNMENT_SIZE - 1) / \
+                         ALIGNMENT_SIZE) * ALIGNMENT_SIZE)
 
 typedef struct __attribute__((packed)) {
     uint8_t u8;
@@ -205,6 +208,8 @@ static void test_pktbuf_add__memfull(void)
 }
 #endif
 
+/* the pool blocks are smaller than CONFIG_GNRC_PKTBUF_SIZE / 10 */
+#ifndef MODULE_GNRC_PKTBUF_POOL
 static void test_pktbuf_add__success(void)
 {
     gnrc_pktsnip_t *pkt, *pkt_prev = NULL;
@@ -228,6 +233,7 @@ static void test_pktbuf_add__success(void)
     }
     TEST_ASSERT(gnrc_pktbuf_is_sane());
 }
+#endif
 
 static void test_pktbuf_add__packed_struct(void)
 {
@@ -249,7 +255,9 @@ static void test_pktbuf_add__packed_struct(void)
     TEST_ASSERT_EQUAL_INT(data.s64, data_cpy->s64);
 }
 
-#ifndef MODULE_GNRC_PKTBUF_MALLOC   /* alignment-handling left to malloc, so no certainty here */
+/* alignment-handling left to malloc, and blocks of gnrc_pktbuf_pool do not
+ * depend on alignment, so no certainty here */
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_POOL)
 static void test_pktbuf_add__unaligned_in_aligned_hole(void)
 {
     gnrc_pktsnip_t *pkt1 = gnrc_pktbuf_add(NULL, NULL, ALIGNMENT_SIZE, GNRC_NETTYPE_TEST);
@@ -325,7 +333,8 @@ static void test_pktbuf_mark__pkt_NOT_NULL__size_greater_than_pkt_size(void)
 
 static void test_pktbuf_mark__pkt_NOT_NULL__pkt_data_NULL(void)
 {
-    gnrc_pktsnip_t pkt = { NULL, NULL, sizeof(TEST_STRING16), 1, GNRC_NETTYPE_TEST };
+    gnrc_pktsnip_t pkt = { .size = sizeof(TEST_STRING16), .users = 1,
+                           .type = GNRC_NETTYPE_TEST };
 
     TEST_ASSERT_NULL(gnrc_pktbuf_mark(&pkt, sizeof(TEST_STRING16) - 1,
                                       GNRC_NETTYPE_TEST));
@@ -658,7 +667,7 @@ static void test_pktbuf_realloc_data__success3(void)
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
 
-#ifndef MODULE_GNRC_PKTBUF_MALLOC
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_POOL)
 static void test_pktbuf_merge_data__memfull(void)
 {
     gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, (CONFIG_GNRC_PKTBUF_SIZE / 4),
@@ -670,7 +679,7 @@ static void test_pktbuf_merge_data__memfull(void)
     gnrc_pktbuf_release(pkt);
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
-#endif /* MODULE_GNRC_PKTBUF_MALLOC */
+#endif
 
 static void test_pktbuf_merge_data__success1(void)
 {
@@ -714,7 +723,8 @@ static void test_pktbuf_hold__pkt_null(void)
 
 static void test_pktbuf_hold__pkt_external(void)
 {
-    gnrc_pktsnip_t pkt = { NULL, (void *)TEST_STRING8, sizeof(TEST_STRING8), 1, GNRC_NETTYPE_TEST };
+    gnrc_pktsnip_t pkt = { .data = (void *)TEST_STRING8, .size = sizeof(TEST_STRING8),
+                           .users = 1, .type = GNRC_NETTYPE_TEST };
 
     gnrc_pktbuf_hold(&pkt, 1);
     TEST_ASSERT(gnrc_pktbuf_is_empty());
@@ -818,12 +828,12 @@ static void test_pktbuf_start_write__pkt_users_2(void)
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
 
-#ifndef MODULE_GNRC_PKTBUF_MALLOC
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_POOL)
 static void test_pktbuf_reverse_snips__too_full(void)
 {
     gnrc_pktsnip_t *pkt, *pkt_next, *pkt_huge;
     const size_t pkt_huge_size = CONFIG_GNRC_PKTBUF_SIZE - (3 * ALIGNMENT_SIZE) -
-                                 (3 * sizeof(gnrc_pktsnip_t)) - 4;
+                                 (3 * SNIP_SIZE) - 4;
 
     pkt_next = gnrc_pktbuf_add(NULL, TEST_STRING16, ALIGNMENT_SIZE, GNRC_NETTYPE_TEST);
     TEST_ASSERT_NOT_NULL(pkt_next);
@@ -840,7 +850,7 @@ static void test_pktbuf_reverse_snips__too_full(void)
     gnrc_pktbuf_release(pkt_next);
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
-#endif /* MODULE_GNRC_PKTBUF_MALLOC */
+#endif
 
 static void test_pktbuf_reverse_snips__success(void)
 {
@@ -857,6 +867,372 @@ static void test_pktbuf_reverse_snips__success(void)
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
 
+static void test_pktbuf_pull__size_greater_than_pkt_size(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, TEST_STRING8, 8, GNRC_NETTYPE_TEST);
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_EQUAL_INT(-EINVAL, gnrc_pktbuf_pull(pkt, 9));
+    TEST_ASSERT_EQUAL_INT(8, pkt->size);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_pull__success(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, TEST_STRING16, sizeof(TEST_STRING16),
+                                          GNRC_NETTYPE_TEST);
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_pull(pkt, 0));
+    TEST_ASSERT_EQUAL_INT(sizeof(TEST_STRING16), pkt->size);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_pull(pkt, 3));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT_NULL(pkt->next);
+    TEST_ASSERT_EQUAL_INT(sizeof(TEST_STRING16) - 3, pkt->size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(&TEST_STRING16[3], pkt->data, pkt->size));
+    TEST_ASSERT_EQUAL_INT(GNRC_NETTYPE_TEST, pkt->type);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_pull__all(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, TEST_STRING8, 8, GNRC_NETTYPE_TEST);
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_pull(pkt, 8));
+    TEST_ASSERT_NULL(pkt->data);
+    TEST_ASSERT_EQUAL_INT(0, pkt->size);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_headroom(pkt));
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_push__no_headroom(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, TEST_STRING8, 8, GNRC_NETTYPE_TEST);
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_headroom(pkt));
+    TEST_ASSERT_EQUAL_INT(-ENOSPC, gnrc_pktbuf_push(pkt, 1));
+    TEST_ASSERT_EQUAL_INT(8, pkt->size);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+#ifdef MODULE_GNRC_PKT_HEADROOM
+static void test_pktbuf_push__success(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, TEST_STRING16, sizeof(TEST_STRING16),
+                                          GNRC_NETTYPE_TEST);
+    uint8_t *data = pkt->data;
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_pull(pkt, 5));
+    TEST_ASSERT(data + 5 == pkt->data);
+    TEST_ASSERT_EQUAL_INT(5, gnrc_pktbuf_headroom(pkt));
+    TEST_ASSERT_EQUAL_INT(-ENOSPC, gnrc_pktbuf_push(pkt, 6));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_push(pkt, 2));
+    TEST_ASSERT(data + 3 == pkt->data);
+    TEST_ASSERT_EQUAL_INT(3, gnrc_pktbuf_headroom(pkt));
+    TEST_ASSERT_EQUAL_INT(sizeof(TEST_STRING16) - 3, pkt->size);
+    memcpy(pkt->data, "ab", 2);
+    TEST_ASSERT_EQUAL_INT(0, memcmp("ab", pkt->data, 2));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(&TEST_STRING16[5], (uint8_t *)pkt->data + 2,
+                                    sizeof(TEST_STRING16) - 5));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_mark__headroom(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, TEST_STRING64, sizeof(TEST_STRING64),
+                                          GNRC_NETTYPE_TEST);
+    gnrc_pktsnip_t *hdr;
+    uint8_t *data = pkt->data;
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_pull(pkt, 3));
+    /* odd sizes: a split buffer could not be freed by gnrc_pktbuf_static */
+    TEST_ASSERT_NOT_NULL((hdr = gnrc_pktbuf_mark(pkt, 5, GNRC_NETTYPE_UNDEF)));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(pkt->next == hdr);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(&TEST_STRING64[3], hdr->data, 5));
+    /* the payload is never copied */
+    TEST_ASSERT(data + 8 == pkt->data);
+    TEST_ASSERT_EQUAL_INT(sizeof(TEST_STRING64) - 8, pkt->size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(&TEST_STRING64[8], pkt->data, pkt->size));
+    pkt = gnrc_pktbuf_remove_snip(pkt, hdr);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt, 7));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT_EQUAL_INT(0, memcmp(&TEST_STRING64[8], pkt->data, 7));
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_realloc_data__headroom(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, TEST_STRING16, sizeof(TEST_STRING16),
+                                          GNRC_NETTYPE_TEST);
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_pull(pkt, 4));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt, sizeof(TEST_STRING64)));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT_EQUAL_INT(0, memcmp(&TEST_STRING16[4], pkt->data,
+                                    sizeof(TEST_STRING16) - 4));
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+#ifndef MODULE_GNRC_PKTBUF_MALLOC
+static void test_pktbuf_add__headroom(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, 64 + sizeof(TEST_STRING16),
+                                          GNRC_NETTYPE_TEST);
+    gnrc_pktsnip_t *hdr1, *hdr2, *hdr3;
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_pull(pkt, 64));
+    /* headers taking an aligned part of the headroom share the buffer */
+    TEST_ASSERT_NOT_NULL((hdr1 = gnrc_pktbuf_add(pkt, TEST_STRING16, 16,
+                                                 GNRC_NETTYPE_UNDEF)));
+    TEST_ASSERT((uint8_t *)hdr1->data + 16 == pkt->data);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(TEST_STRING16, hdr1->data, 16));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_headroom(pkt));
+    TEST_ASSERT_EQUAL_INT(48, gnrc_pktbuf_headroom(hdr1));
+    TEST_ASSERT_NOT_NULL((hdr2 = gnrc_pktbuf_add(hdr1, NULL, 32,
+                                                 GNRC_NETTYPE_UNDEF)));
+    TEST_ASSERT((uint8_t *)hdr2->data + 32 == hdr1->data);
+    TEST_ASSERT_EQUAL_INT(16, gnrc_pktbuf_headroom(hdr2));
+    /* too large for the headroom left */
+    TEST_ASSERT_NOT_NULL((hdr3 = gnrc_pktbuf_add(hdr2, NULL, 32,
+                                                 GNRC_NETTYPE_UNDEF)));
+    TEST_ASSERT((uint8_t *)hdr3->data + 32 != hdr2->data);
+    TEST_ASSERT_EQUAL_INT(16, gnrc_pktbuf_headroom(hdr2));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    /* the parts of the buffer can be released separately */
+    hdr2 = gnrc_pktbuf_remove_snip(hdr3, hdr2);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(hdr2);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+#endif
+#endif
+
+#ifdef MODULE_GNRC_PKTBUF_POOL
+/* payload filling a small block, the test strings are too short */
+static uint8_t _small_data[CONFIG_GNRC_PKTBUF_POOL_SMALL_SIZE];
+
+static void _init_small_data(void)
+{
+    for (unsigned i = 0; i < sizeof(_small_data); i++) {
+        _small_data[i] = i;
+    }
+}
+
+static void test_pktbuf_pool__too_large(void)
+{
+    gnrc_pktsnip_t *pkt;
+
+    TEST_ASSERT_NULL(gnrc_pktbuf_add(NULL, NULL, CONFIG_GNRC_PKTBUF_POOL_LARGE_SIZE + 1,
+                                     GNRC_NETTYPE_TEST));
+    pkt = gnrc_pktbuf_add(NULL, NULL, CONFIG_GNRC_PKTBUF_POOL_LARGE_SIZE,
+                          GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_pool__merge_memfull(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL,
+                                          (CONFIG_GNRC_PKTBUF_POOL_LARGE_SIZE / 2) + 1,
+                                          GNRC_NETTYPE_TEST);
+
+    pkt = gnrc_pktbuf_add(pkt, NULL, (CONFIG_GNRC_PKTBUF_POOL_LARGE_SIZE / 2) + 1,
+                          GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_EQUAL_INT(ENOMEM, gnrc_pktbuf_merge(pkt));
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_pool__fallback(void)
+{
+    gnrc_pktsnip_t *pkt = NULL;
+
+    _init_small_data();
+    /* exhaust the small blocks, the next small header takes a large one */
+    for (unsigned i = 0; i <= CONFIG_GNRC_PKTBUF_POOL_SMALL_NUMOF; i++) {
+        pkt = gnrc_pktbuf_add(pkt, _small_data, CONFIG_GNRC_PKTBUF_POOL_SMALL_SIZE,
+                              GNRC_NETTYPE_TEST);
+        TEST_ASSERT_NOT_NULL(pkt);
+    }
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_small_data, pkt->data,
+                                    CONFIG_GNRC_PKTBUF_POOL_SMALL_SIZE));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_pool__mark_shares_block(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, TEST_STRING16, sizeof(TEST_STRING16),
+                                          GNRC_NETTYPE_TEST);
+    gnrc_pktsnip_t *hdr = gnrc_pktbuf_mark(pkt, 8, GNRC_NETTYPE_UNDEF);
+
+    TEST_ASSERT_NOT_NULL(hdr);
+    TEST_ASSERT(((uint8_t *)hdr->data) + 8 == pkt->data);
+    /* the payload must survive the header */
+    pkt = gnrc_pktbuf_remove_snip(pkt, hdr);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT_EQUAL_INT(0, memcmp(&TEST_STRING16[8], pkt->data, pkt->size));
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_pool__realloc_in_place(void)
+{
+    _init_small_data();
+    /* too large for a snip block, so it is in a small block */
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, _small_data,
+                                          CONFIG_GNRC_PKTBUF_POOL_SMALL_SIZE - 1,
+                                          GNRC_NETTYPE_TEST);
+    void *data = pkt->data;
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt, CONFIG_GNRC_PKTBUF_POOL_SMALL_SIZE));
+    TEST_ASSERT(data == pkt->data);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt, CONFIG_GNRC_PKTBUF_POOL_SMALL_SIZE + 1));
+    TEST_ASSERT(data != pkt->data);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_small_data, pkt->data,
+                                    CONFIG_GNRC_PKTBUF_POOL_SMALL_SIZE - 1));
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+#endif
+
+#ifdef MODULE_GNRC_PKT_EXT
+static const char _ext_data16[] = TEST_STRING16;
+static const char _ext_data8[] = TEST_STRING8;
+static unsigned _ext_released;
+
+static void _ext_cb(gnrc_pktbuf_ext_t *ext)
+{
+    (void)ext;
+    _ext_released++;
+}
+
+static void test_pktbuf_add_ext__release(void)
+{
+    gnrc_pktbuf_ext_t ext = { .cb = _ext_cb };
+    gnrc_pktsnip_t *pkt;
+
+    _ext_released = 0;
+    pkt = gnrc_pktbuf_add_ext(NULL, _ext_data16, sizeof(_ext_data16),
+                              GNRC_NETTYPE_TEST, &ext);
+    TEST_ASSERT_NOT_NULL(pkt);
+    pkt = gnrc_pktbuf_add_ext(pkt, _ext_data8, sizeof(_ext_data8),
+                              GNRC_NETTYPE_TEST, &ext);
+    TEST_ASSERT_NOT_NULL(pkt);
+    pkt = gnrc_pktbuf_add(pkt, TEST_STRING4, sizeof(TEST_STRING4),
+                          GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt);
+    /* the data are referenced, not copied */
+    TEST_ASSERT(pkt->next->data == _ext_data8);
+    TEST_ASSERT(pkt->next->next->data == _ext_data16);
+    TEST_ASSERT_EQUAL_INT(2, ext.snips);
+
+    gnrc_pktbuf_hold(pkt, 1);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT_EQUAL_INT(0, _ext_released);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT_EQUAL_INT(1, _ext_released);
+    TEST_ASSERT_EQUAL_INT(0, ext.snips);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_add_ext__start_write(void)
+{
+    gnrc_pktbuf_ext_t ext = { .cb = _ext_cb };
+    gnrc_pktsnip_t *pkt, *copy;
+
+    _ext_released = 0;
+    pkt = gnrc_pktbuf_add_ext(NULL, _ext_data16, sizeof(_ext_data16),
+                              GNRC_NETTYPE_TEST, &ext);
+    TEST_ASSERT_NOT_NULL(pkt);
+    gnrc_pktbuf_hold(pkt, 1);
+    copy = gnrc_pktbuf_start_write(pkt);
+    TEST_ASSERT_NOT_NULL(copy);
+    TEST_ASSERT(copy != pkt);
+    /* the duplicate lives in the packet buffer */
+    TEST_ASSERT(copy->data != _ext_data16);
+    TEST_ASSERT_EQUAL_STRING(TEST_STRING16, copy->data);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT_EQUAL_INT(1, _ext_released);
+    gnrc_pktbuf_release(copy);
+    TEST_ASSERT_EQUAL_INT(1, _ext_released);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+#endif
+
+#ifdef MODULE_GNRC_PKT_QUOTA
+static gnrc_pktbuf_quota_t _quota;
+
+static void test_pktbuf_quota__exceeded(void)
+{
+    gnrc_pktbuf_quota_init(&_quota, KERNEL_PID_UNDEF, sizeof(TEST_STRING16));
+
+    gnrc_pktsnip_t *pkt1 = gnrc_pktbuf_add(NULL, TEST_STRING8,
+                                           sizeof(TEST_STRING8),
+                                           GNRC_NETTYPE_TEST);
+    gnrc_pktsnip_t *pkt2 = gnrc_pktbuf_add(NULL, TEST_STRING16,
+                                           sizeof(TEST_STRING16),
+                                           GNRC_NETTYPE_TEST);
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_quota_charge(&_quota, pkt1));
+    TEST_ASSERT_EQUAL_INT(sizeof(TEST_STRING8), _quota.used);
+    TEST_ASSERT_EQUAL_INT(-ENOBUFS, gnrc_pktbuf_quota_charge(&_quota, pkt2));
+    TEST_ASSERT_EQUAL_INT(1, _quota.fails);
+
+    gnrc_pktbuf_release(pkt1);
+    TEST_ASSERT_EQUAL_INT(0, _quota.used);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_quota_charge(&_quota, pkt2));
+    TEST_ASSERT_EQUAL_INT(sizeof(TEST_STRING16), _quota.used_max);
+    gnrc_pktbuf_release(pkt2);
+    TEST_ASSERT_EQUAL_INT(0, _quota.used);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_quota__split_pkt(void)
+{
+    gnrc_pktbuf_quota_init(&_quota, KERNEL_PID_UNDEF, 0);
+
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, TEST_STRING16,
+                                          sizeof(TEST_STRING16),
+                                          GNRC_NETTYPE_TEST);
+    pkt = gnrc_pktbuf_add(pkt, TEST_STRING4, sizeof(TEST_STRING4),
+                          GNRC_NETTYPE_TEST);
+    gnrc_pktsnip_t *payload = pkt->next;
+
+    /* snips are charged in total, to the first snip */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_quota_charge(&_quota, payload));
+    TEST_ASSERT_EQUAL_INT(sizeof(TEST_STRING16), _quota.used);
+
+    /* headers marked and removed don't credit the quota ... */
+    gnrc_pktsnip_t *hdr = gnrc_pktbuf_mark(payload, 8, GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL(hdr);
+    TEST_ASSERT(payload == gnrc_pktbuf_remove_snip(payload, hdr));
+    gnrc_pktbuf_hold(payload, 1);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT_EQUAL_INT(sizeof(TEST_STRING16), _quota.used);
+
+    /* ... releasing the snip charged does */
+    gnrc_pktbuf_release(payload);
+    TEST_ASSERT_EQUAL_INT(0, _quota.used);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+#endif
+
 Test *tests_pktbuf_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -871,9 +1247,11 @@ Test *tests_pktbuf_tests(void)
 #ifndef MODULE_GNRC_PKTBUF_MALLOC
         new_TestFixture(test_pktbuf_add__memfull),
 #endif
+#ifndef MODULE_GNRC_PKTBUF_POOL
         new_TestFixture(test_pktbuf_add__success),
+#endif
         new_TestFixture(test_pktbuf_add__packed_struct),
-#ifndef MODULE_GNRC_PKTBUF_MALLOC
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_POOL)
         new_TestFixture(test_pktbuf_add__unaligned_in_aligned_hole),
 #endif
         new_TestFixture(test_pktbuf_add__0_sized_release),
@@ -897,9 +1275,9 @@ Test *tests_pktbuf_tests(void)
         new_TestFixture(test_pktbuf_realloc_data__success),
         new_TestFixture(test_pktbuf_realloc_data__success2),
         new_TestFixture(test_pktbuf_realloc_data__success3),
-#ifndef MODULE_GNRC_PKTBUF_MALLOC
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_POOL)
         new_TestFixture(test_pktbuf_merge_data__memfull),
-#endif /* MODULE_GNRC_PKTBUF_MALLOC */
+#endif
         new_TestFixture(test_pktbuf_merge_data__success1),
         new_TestFixture(test_pktbuf_merge_data__success2),
         new_TestFixture(test_pktbuf_hold__pkt_null),
@@ -911,10 +1289,37 @@ Test *tests_pktbuf_tests(void)
         new_TestFixture(test_pktbuf_start_write__NULL),
         new_TestFixture(test_pktbuf_start_write__pkt_users_1),
         new_TestFixture(test_pktbuf_start_write__pkt_users_2),
-#ifndef MODULE_GNRC_PKTBUF_MALLOC
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_POOL)
         new_TestFixture(test_pktbuf_reverse_snips__too_full),
-#endif /* MODULE_GNRC_PKTBUF_MALLOC */
+#endif
         new_TestFixture(test_pktbuf_reverse_snips__success),
+        new_TestFixture(test_pktbuf_pull__size_greater_than_pkt_size),
+        new_TestFixture(test_pktbuf_pull__success),
+        new_TestFixture(test_pktbuf_pull__all),
+        new_TestFixture(test_pktbuf_push__no_headroom),
+#ifdef MODULE_GNRC_PKT_HEADROOM
+        new_TestFixture(test_pktbuf_push__success),
+        new_TestFixture(test_pktbuf_mark__headroom),
+        new_TestFixture(test_pktbuf_realloc_data__headroom),
+#ifndef MODULE_GNRC_PKTBUF_MALLOC
+        new_TestFixture(test_pktbuf_add__headroom),
+#endif
+#endif
+#ifdef MODULE_GNRC_PKTBUF_POOL
+        new_TestFixture(test_pktbuf_pool__too_large),
+        new_TestFixture(test_pktbuf_pool__merge_memfull),
+        new_TestFixture(test_pktbuf_pool__fallback),
+        new_TestFixture(test_pktbuf_pool__mark_shares_block),
+        new_TestFixture(test_pktbuf_pool__realloc_in_place),
+#endif
+#ifdef MODULE_GNRC_PKT_QUOTA
+        new_TestFixture(test_pktbuf_quota__exceeded),
+        new_TestFixture(test_pktbuf_quota__split_pkt),
+#endif
+#ifdef MODULE_GNRC_PKT_EXT
+        new_TestFixture(test_pktbuf_add_ext__release),
+        new_TestFixture(test_pktbuf_add_ext__start_write),
+#endif
     };
 
     EMB_UNIT_TESTCALLER(gnrc_pktbuf_tests, set_up, NULL, fixtures);
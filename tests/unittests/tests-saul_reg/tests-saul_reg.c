@@ -25,11 +25,11 @@
 #include "saul_reg.h"
 #include "tests-saul_reg.h"
 
-static const saul_driver_t s0_dri = { NULL, NULL, SAUL_ACT_SERVO };
-static const saul_driver_t s1_dri = { NULL, NULL, SAUL_SENSE_TEMP };
-static const saul_driver_t s2_dri = { NULL, NULL, SAUL_SENSE_LIGHT };
-static const saul_driver_t s3a_dri = { NULL, NULL, SAUL_ACT_LED_RGB };
-static const saul_driver_t s3b_dri = { NULL, NULL, SAUL_ACT_SWITCH };
+static const saul_driver_t s0_dri = { NULL, NULL, SAUL_ACT_SERVO, NULL };
+static const saul_driver_t s1_dri = { NULL, NULL, SAUL_SENSE_TEMP, NULL };
+static const saul_driver_t s2_dri = { NULL, NULL, SAUL_SENSE_LIGHT, NULL };
+static const saul_driver_t s3a_dri = { NULL, NULL, SAUL_ACT_LED_RGB, NULL };
+static const saul_driver_t s3b_dri = { NULL, NULL, SAUL_ACT_SWITCH, NULL };
 
 static saul_reg_t s0 = { NULL, NULL, "S0", &s0_dri };
 static saul_reg_t s1 = { NULL, NULL, "S1", &s1_dri };
@@ -38,6 +38,31 @@ static saul_reg_t s2 = { NULL, NULL, "S2", &s2_dri };
 static saul_reg_t s3a = { NULL, NULL, "S3", &s3a_dri };
 static saul_reg_t s3b = { NULL, NULL, "S3", &s3b_dri };
 
+static int _read(const void *dev, phydat_t *res)
+{
+    (void)dev;
+    res->val[0] = 42;
+    return 1;
+}
+
+static int _read_batch(const void *dev, phydat_t *res, size_t count,
+                       uint32_t *period_us)
+{
+    (void)dev;
+    for (size_t i = 0; i < count; i++) {
+        res[i].val[0] = i;
+    }
+    *period_us = 1000;
+    return count;
+}
+
+static const saul_driver_t s4_dri = { _read, NULL, SAUL_SENSE_TEMP, NULL };
+static const saul_driver_t s5_dri = { _read, NULL, SAUL_SENSE_ACCEL,
+                                      _read_batch };
+
+static saul_reg_t s4 = { NULL, NULL, "S4", &s4_dri };
+static saul_reg_t s5 = { NULL, NULL, "S5", &s5_dri };
+
 static int count(void)
 {
     int i = 0;
@@ -166,6 +191,23 @@ static void test_reg_find_type_and_name(void)
     TEST_ASSERT_NULL(dev);
 }
 
+static void test_reg_read_batch(void)
+{
+    phydat_t res[4];
+    uint32_t period = 1;
+
+    TEST_ASSERT_EQUAL_INT(-ENODEV, saul_reg_read_batch(NULL, res, 4, &period));
+
+    /* drivers without batch support return a single sample */
+    TEST_ASSERT_EQUAL_INT(1, saul_reg_read_batch(&s4, res, 4, &period));
+    TEST_ASSERT_EQUAL_INT(42, res[0].val[0]);
+    TEST_ASSERT_EQUAL_INT(0, period);
+
+    TEST_ASSERT_EQUAL_INT(4, saul_reg_read_batch(&s5, res, 4, &period));
+    TEST_ASSERT_EQUAL_INT(3, res[3].val[0]);
+    TEST_ASSERT_EQUAL_INT(1000, period);
+}
+
 Test *tests_saul_reg_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -175,6 +217,7 @@ Test *tests_saul_reg_tests(void)
         new_TestFixture(test_reg_find_type),
         new_TestFixture(test_reg_find_name),
         new_TestFixture(test_reg_find_type_and_name),
+        new_TestFixture(test_reg_read_batch),
     };
 
     EMB_UNIT_TESTCALLER(pkt_tests, NULL, NULL, fixtures);
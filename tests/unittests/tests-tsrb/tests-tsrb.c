@@ -213,6 +213,82 @@ static void test_add(void)
     }
 }
 
+static void test_add_get_wrap(void)
+{
+    const int offset = BUFFER_SIZE - 3;
+
+    for (int i = 0; i < (int)sizeof(_io_buffer); i++) {
+        _io_buffer[i] = TEST_INPUT + i;
+    }
+    /* move the read and write positions close to the end of the buffer */
+    TEST_ASSERT_EQUAL_INT(offset, tsrb_add(&_tsrb, _io_buffer, offset));
+    TEST_ASSERT_EQUAL_INT(offset, tsrb_drop(&_tsrb, offset));
+
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_add(&_tsrb, _io_buffer,
+                                                sizeof(_io_buffer)));
+    memset(_io_buffer, IO_BUFFER_CANARY, sizeof(_io_buffer));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_get(&_tsrb, _io_buffer,
+                                                sizeof(_io_buffer)));
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT((uint8_t)(TEST_INPUT + i), _io_buffer[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(IO_BUFFER_CANARY, _io_buffer[BUFFER_SIZE]);
+}
+
+static void test_peek_linear(void)
+{
+    const int offset = BUFFER_SIZE - 3;
+    uint8_t *data;
+
+    TEST_ASSERT_EQUAL_INT(0, tsrb_peek_linear(&_tsrb, &data));
+
+    TEST_ASSERT_EQUAL_INT(offset, tsrb_add(&_tsrb, _io_buffer, offset));
+    TEST_ASSERT_EQUAL_INT(offset, tsrb_drop(&_tsrb, offset));
+    for (int i = 0; i < 8; i++) {
+        TEST_ASSERT_EQUAL_INT(0, tsrb_add_one(&_tsrb, TEST_INPUT + i));
+    }
+
+    /* only the bytes up to the end of the buffer are contiguous */
+    TEST_ASSERT_EQUAL_INT(3, tsrb_peek_linear(&_tsrb, &data));
+    TEST_ASSERT(data == &_tsrb_buffer[offset]);
+    for (int i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL_INT(TEST_INPUT + i, data[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(3, tsrb_drop(&_tsrb, 3));
+
+    TEST_ASSERT_EQUAL_INT(5, tsrb_peek_linear(&_tsrb, &data));
+    TEST_ASSERT(data == _tsrb_buffer);
+    TEST_ASSERT_EQUAL_INT(TEST_INPUT + 3, data[0]);
+}
+
+static void test_reserve_commit(void)
+{
+    const int offset = BUFFER_SIZE - 3;
+    uint8_t *data;
+
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_reserve_linear(&_tsrb, &data));
+    TEST_ASSERT(data == _tsrb_buffer);
+
+    TEST_ASSERT_EQUAL_INT(offset, tsrb_add(&_tsrb, _io_buffer, offset));
+    TEST_ASSERT_EQUAL_INT(3, tsrb_reserve_linear(&_tsrb, &data));
+    TEST_ASSERT_EQUAL_INT(2, tsrb_drop(&_tsrb, 2));
+    /* free space at the start of the buffer is not contiguous to the end */
+    TEST_ASSERT_EQUAL_INT(3, tsrb_reserve_linear(&_tsrb, &data));
+    TEST_ASSERT(data == &_tsrb_buffer[offset]);
+    memset(data, TEST_INPUT, 3);
+    tsrb_commit(&_tsrb, 3);
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - 2, tsrb_avail(&_tsrb));
+
+    TEST_ASSERT_EQUAL_INT(2, tsrb_reserve_linear(&_tsrb, &data));
+    TEST_ASSERT(data == _tsrb_buffer);
+    tsrb_commit(&_tsrb, 2);
+    TEST_ASSERT_EQUAL_INT(1, tsrb_full(&_tsrb));
+    TEST_ASSERT_EQUAL_INT(0, tsrb_reserve_linear(&_tsrb, &data));
+
+    TEST_ASSERT_EQUAL_INT(offset - 2, tsrb_drop(&_tsrb, offset - 2));
+    TEST_ASSERT_EQUAL_INT(TEST_INPUT, tsrb_get_one(&_tsrb));
+}
+
 static Test *tests_tsrb_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -228,6 +304,9 @@ static Test *tests_tsrb_tests(void)
         new_TestFixture(test_drop),
         new_TestFixture(test_add_one),
         new_TestFixture(test_add),
+        new_TestFixture(test_add_get_wrap),
+        new_TestFixture(test_peek_linear),
+        new_TestFixture(test_reserve_commit),
     };
 
     EMB_UNIT_TESTCALLER(tsrb_tests, NULL, tear_down, fixtures);
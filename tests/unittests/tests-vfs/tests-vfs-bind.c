@@ -124,12 +124,34 @@ static void test_vfs_bind__allocate_invalid_fd(void)
     TEST_ASSERT_EQUAL_INT(-ENFILE, fd);
 }
 
+static void test_vfs_bind__explicit_and_any_fd(void)
+{
+    /* explicitly bound fds must not be handed out by VFS_ANY_FD and vice versa */
+    int fd = vfs_bind(VFS_ANY_FD, O_RDONLY, &_test_bind_ops, NULL);
+    TEST_ASSERT(fd > STDERR_FILENO);
+    TEST_ASSERT_EQUAL_INT(-EEXIST, vfs_bind(fd, O_RDONLY, &_test_bind_ops, NULL));
+
+    int fd_fixed = vfs_bind(fd + 1, O_RDONLY, &_test_bind_ops, NULL);
+    TEST_ASSERT_EQUAL_INT(fd + 1, fd_fixed);
+    int fd_any = vfs_bind(VFS_ANY_FD, O_RDONLY, &_test_bind_ops, NULL);
+    TEST_ASSERT(fd_any > fd_fixed);
+
+    /* the lowest free fd is reused */
+    TEST_ASSERT_EQUAL_INT(0, vfs_close(fd));
+    TEST_ASSERT_EQUAL_INT(fd, vfs_bind(VFS_ANY_FD, O_RDONLY, &_test_bind_ops, NULL));
+
+    TEST_ASSERT_EQUAL_INT(0, vfs_close(fd));
+    TEST_ASSERT_EQUAL_INT(0, vfs_close(fd_fixed));
+    TEST_ASSERT_EQUAL_INT(0, vfs_close(fd_any));
+}
+
 Test *tests_vfs_bind_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_vfs_bind),
         new_TestFixture(test_vfs_bind__leak_fds),
         new_TestFixture(test_vfs_bind__allocate_invalid_fd),
+        new_TestFixture(test_vfs_bind__explicit_and_any_fd),
     };
 
     EMB_UNIT_TESTCALLER(vfs_bind_tests, NULL, NULL, fixtures);
@@ -173,6 +173,105 @@ static void test_vfs_constfs_read_lseek(void)
     TEST_ASSERT_EQUAL_INT(0, res);
 }
 
+static void test_vfs_constfs_mmap(void)
+{
+    int res;
+    res = vfs_mount(&_test_vfs_mount);
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    int fd = vfs_open("/test/test.txt", O_RDONLY, 0);
+    TEST_ASSERT(fd >= 0);
+
+    const void *addr = NULL;
+    res = vfs_mmap(fd, 0, sizeof(str_data), &addr);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    /* the file data is mapped as is, without a copy */
+    TEST_ASSERT(addr == str_data);
+
+    res = vfs_munmap(fd, addr, sizeof(str_data));
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    res = vfs_mmap(fd, sizeof(str_data) / 2, sizeof(str_data) / 2, &addr);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    TEST_ASSERT(addr == &str_data[sizeof(str_data) / 2]);
+
+    res = vfs_mmap(fd, 1, sizeof(str_data), &addr);
+    TEST_ASSERT_EQUAL_INT(-ENXIO, res);
+    res = vfs_mmap(fd, -1, 1, &addr);
+    TEST_ASSERT_EQUAL_INT(-EINVAL, res);
+
+    res = vfs_close(fd);
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    res = vfs_umount(&_test_vfs_mount, false);
+    TEST_ASSERT_EQUAL_INT(0, res);
+}
+
+static void test_vfs_constfs_readdir_batch(void)
+{
+    int res;
+    res = vfs_mount(&_test_vfs_mount);
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    vfs_DIR dir;
+    vfs_dirent_t entries[4];
+    struct stat stats[4];
+    res = vfs_opendir(&dir, "/test");
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    res = vfs_readdir_batch(&dir, entries, stats, 1);
+    TEST_ASSERT_EQUAL_INT(1, res);
+    TEST_ASSERT_EQUAL_STRING("test.txt", entries[0].d_name);
+    TEST_ASSERT_EQUAL_INT(S_IFREG, stats[0].st_mode & S_IFMT);
+    TEST_ASSERT_EQUAL_INT(sizeof(str_data), stats[0].st_size);
+
+    res = vfs_readdir_batch(&dir, entries, stats, ARRAY_SIZE(entries));
+    TEST_ASSERT_EQUAL_INT(1, res);
+    TEST_ASSERT_EQUAL_STRING("data.bin", entries[0].d_name);
+    TEST_ASSERT_EQUAL_INT(sizeof(bin_data), stats[0].st_size);
+
+    res = vfs_readdir_batch(&dir, entries, stats, ARRAY_SIZE(entries));
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    res = vfs_closedir(&dir);
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    res = vfs_opendir(&dir, "/test");
+    TEST_ASSERT_EQUAL_INT(0, res);
+    res = vfs_readdir_batch(&dir, entries, NULL, ARRAY_SIZE(entries));
+    TEST_ASSERT_EQUAL_INT(2, res);
+    TEST_ASSERT_EQUAL_STRING("test.txt", entries[0].d_name);
+    TEST_ASSERT_EQUAL_STRING("data.bin", entries[1].d_name);
+    res = vfs_closedir(&dir);
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    res = vfs_umount(&_test_vfs_mount, false);
+    TEST_ASSERT_EQUAL_INT(0, res);
+}
+
+static void test_vfs_constfs_stat__umount(void)
+{
+    struct stat buf;
+    int res;
+    res = vfs_mount(&_test_vfs_mount);
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    for (unsigned i = 0; i < 2; i++) {
+        res = vfs_stat("/test/test.txt", &buf);
+        TEST_ASSERT_EQUAL_INT(0, res);
+        TEST_ASSERT_EQUAL_INT(sizeof(str_data), buf.st_size);
+        res = vfs_stat("/test/notfound", &buf);
+        TEST_ASSERT_EQUAL_INT(-ENOENT, res);
+    }
+
+    res = vfs_umount(&_test_vfs_mount, false);
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    /* a cached result must not outlive the mount */
+    res = vfs_stat("/test/test.txt", &buf);
+    TEST_ASSERT(res < 0);
+}
+
 #if MODULE_NEWLIB || MODULE_PICOLIBC || defined(CPU_NATIVE)
 static void test_vfs_constfs__posix(void)
 {
@@ -212,6 +311,9 @@ Test *tests_vfs_mount_constfs_tests(void)
         new_TestFixture(test_vfs_umount__invalid_mount),
         new_TestFixture(test_vfs_constfs_open),
         new_TestFixture(test_vfs_constfs_read_lseek),
+        new_TestFixture(test_vfs_constfs_mmap),
+        new_TestFixture(test_vfs_constfs_readdir_batch),
+        new_TestFixture(test_vfs_constfs_stat__umount),
 #if MODULE_NEWLIB || MODULE_PICOLIBC || defined(CPU_NATIVE)
         new_TestFixture(test_vfs_constfs__posix),
 #endif
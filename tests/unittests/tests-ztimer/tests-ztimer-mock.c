@@ -288,6 +288,212 @@ static void test_ztimer_mock_is_set(void)
     TEST_ASSERT(!ztimer_is_set(z, &alarm2));
 }
 
+/**
+ * @brief   Testing ztimer_until_next()
+ */
+static void test_ztimer_mock_until_next(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+
+    ztimer_mock_init(&zmock, 16);
+
+    uint32_t count = 0;
+    ztimer_t alarm = { .callback = cb_incr, .arg = &count, };
+    ztimer_t alarm2 = { .callback = cb_incr, .arg = &count, };
+
+    TEST_ASSERT_EQUAL_INT(UINT32_MAX, ztimer_until_next(z));
+
+    ztimer_set(z, &alarm2, 100000);
+    TEST_ASSERT_EQUAL_INT(100000, ztimer_until_next(z));
+    ztimer_set(z, &alarm, 1000);
+    TEST_ASSERT_EQUAL_INT(1000, ztimer_until_next(z));
+
+    ztimer_mock_advance(&zmock, 400);
+    TEST_ASSERT_EQUAL_INT(600, ztimer_until_next(z));
+
+    ztimer_mock_advance(&zmock, 600);
+    TEST_ASSERT_EQUAL_INT(1, count);
+    TEST_ASSERT_EQUAL_INT(99000, ztimer_until_next(z));
+
+    /* crosses multiple wrap arounds of the 16 bit counter */
+    ztimer_mock_advance(&zmock, 70000);
+    TEST_ASSERT_EQUAL_INT(29000, ztimer_until_next(z));
+
+    ztimer_remove(z, &alarm2);
+    TEST_ASSERT_EQUAL_INT(UINT32_MAX, ztimer_until_next(z));
+}
+
+/**
+ * @brief   Records the order in which the alarms of test_ztimer_mock_many fire
+ */
+static struct {
+    unsigned fired[64];
+    unsigned numof;
+} _many;
+
+static void cb_record(void *arg)
+{
+    _many.fired[_many.numof++] = (uintptr_t)arg;
+}
+
+/* distinct targets, set in a scrambled order */
+static uint32_t _many_target(unsigned i)
+{
+    return 100 + ((i * 37) % ARRAY_SIZE(_many.fired)) * 10;
+}
+
+/*
+ * Testing that many timers set in arbitrary order trigger in target order,
+ * across a wrap around of the clock
+ */
+static void test_ztimer_mock_many(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    static ztimer_t alarms[ARRAY_SIZE(_many.fired)];
+    unsigned expected = 0;
+
+    ztimer_mock_init(&zmock, 32);
+    ztimer_mock_jump(&zmock, UINT32_MAX - 300);
+    _many.numof = 0;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(alarms); i++) {
+        alarms[i].callback = cb_record;
+        alarms[i].arg = (void *)(uintptr_t)i;
+        ztimer_set(z, &alarms[i], _many_target(i));
+    }
+    TEST_ASSERT_EQUAL_INT(100, zmock.target);
+
+    /* remove every third timer and re-set every fifth one */
+    for (unsigned i = 0; i < ARRAY_SIZE(alarms); i++) {
+        if ((i % 3) == 0) {
+            ztimer_remove(z, &alarms[i]);
+            TEST_ASSERT(!ztimer_is_set(z, &alarms[i]));
+        }
+        else {
+            if ((i % 5) == 0) {
+                ztimer_set(z, &alarms[i], _many_target(i));
+            }
+            expected++;
+        }
+    }
+
+    /* trigger in steps smaller and larger than the distance of targets */
+    ztimer_mock_advance(&zmock, 95);
+    TEST_ASSERT_EQUAL_INT(0, _many.numof);
+    for (unsigned i = 0; i < 50; i++) {
+        ztimer_mock_advance(&zmock, (i & 1) ? 3 : 21);
+    }
+    ztimer_mock_advance(&zmock, 1000);
+
+    TEST_ASSERT_EQUAL_INT(expected, _many.numof);
+    for (unsigned i = 0; i < _many.numof; i++) {
+        TEST_ASSERT((_many.fired[i] % 3) != 0);
+        TEST_ASSERT(!ztimer_is_set(z, &alarms[_many.fired[i]]));
+        if (i > 0) {
+            TEST_ASSERT(_many_target(_many.fired[i - 1])
+                        < _many_target(_many.fired[i]));
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(UINT32_MAX, ztimer_until_next(z));
+}
+
+#if MODULE_ZTIMER_SLACK && !MODULE_ZTIMER_HEAP
+/*
+ * Testing that timers set with slack are coalesced into one interrupt, but
+ * never trigger later than their slack allows
+ */
+static void test_ztimer_mock_slack(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    uint32_t count = 0;
+    ztimer_t alarms[] = {
+        { .callback = cb_incr, .arg = &count },
+        { .callback = cb_incr, .arg = &count },
+        { .callback = cb_incr, .arg = &count },
+        { .callback = cb_incr, .arg = &count },
+    };
+
+    ztimer_mock_init(&zmock, 32);
+
+    /* the window of alarms[0] is narrowed down by alarms[2], alarms[3] is
+     * outside of it */
+    ztimer_set_slack(z, &alarms[0], 1000, 500);
+    TEST_ASSERT_EQUAL_INT(1500, zmock.target);
+    TEST_ASSERT_EQUAL_INT(1500, ztimer_until_next(z));
+    ztimer_set_slack(z, &alarms[1], 1200, 1000);
+    TEST_ASSERT_EQUAL_INT(1500, zmock.target);
+    ztimer_set(z, &alarms[2], 1400);
+    TEST_ASSERT_EQUAL_INT(1400, zmock.target);
+    ztimer_set(z, &alarms[3], 1600);
+    TEST_ASSERT_EQUAL_INT(1400, zmock.target);
+
+    ztimer_mock_advance(&zmock, 1399);
+    TEST_ASSERT_EQUAL_INT(0, count);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(3, count);
+    TEST_ASSERT_EQUAL_INT(2, ztimer_coalesced(z));
+    TEST_ASSERT_EQUAL_INT(200, zmock.target);
+
+    ztimer_mock_advance(&zmock, 200);
+    TEST_ASSERT_EQUAL_INT(4, count);
+    TEST_ASSERT_EQUAL_INT(2, ztimer_coalesced(z));
+
+    /* removing the timer narrowing the window widens it again */
+    ztimer_set_slack(z, &alarms[0], 100, 300);
+    ztimer_set(z, &alarms[1], 200);
+    TEST_ASSERT_EQUAL_INT(200, zmock.target);
+    ztimer_remove(z, &alarms[1]);
+    TEST_ASSERT_EQUAL_INT(400, zmock.target);
+    ztimer_remove(z, &alarms[0]);
+    TEST_ASSERT_EQUAL_INT(UINT32_MAX, ztimer_until_next(z));
+}
+#endif /* MODULE_ZTIMER_SLACK && !MODULE_ZTIMER_HEAP */
+
+#if MODULE_ZTIMER_STATS
+/**
+ * @brief   Check that handler invocations and triggered timers are counted
+ */
+static void test_ztimer_mock_stats(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    ztimer_stats_t stats;
+    uint32_t count = 0;
+    ztimer_t alarms[] = {
+        { .callback = cb_incr, .arg = &count },
+        { .callback = cb_incr, .arg = &count },
+        { .callback = cb_incr, .arg = &count },
+    };
+
+    ztimer_mock_init(&zmock, 32);
+    ztimer_set(z, &alarms[0], 100);
+    ztimer_set(z, &alarms[1], 200);
+    ztimer_set(z, &alarms[2], 200);
+
+    ztimer_mock_advance(&zmock, 100);
+    ztimer_stats_get(z, &stats);
+    TEST_ASSERT_EQUAL_INT(1, stats.isr_count);
+    TEST_ASSERT_EQUAL_INT(1, stats.triggered);
+
+    ztimer_mock_advance(&zmock, 100);
+    ztimer_stats_get(z, &stats);
+    TEST_ASSERT_EQUAL_INT(3, count);
+    TEST_ASSERT_EQUAL_INT(2, stats.isr_count);
+    TEST_ASSERT_EQUAL_INT(3, stats.triggered);
+    /* the mock clock does not advance during the handler */
+    TEST_ASSERT_EQUAL_INT(0, stats.handler_max);
+
+    ztimer_stats_reset(z);
+    ztimer_stats_get(z, &stats);
+    TEST_ASSERT_EQUAL_INT(0, stats.isr_count);
+    TEST_ASSERT_EQUAL_INT(0, stats.triggered);
+}
+#endif /* MODULE_ZTIMER_STATS */
+
+#if !MODULE_ZTIMER_HEAP
 static uint32_t calc_target_time(ztimer_mock_t *mock, ztimer_t *t)
 {
     ztimer_base_t *target = &t->base;
@@ -379,6 +585,7 @@ static void test_ztimer_mock_remove(void)
     ztimer_mock_advance(&zmock, 3 * offset);
     TEST_ASSERT_EQUAL_INT(2, count);
 }
+#endif /* !MODULE_ZTIMER_HEAP */
 
 Test *tests_ztimer_mock_tests(void)
 {
@@ -390,7 +597,18 @@ Test *tests_ztimer_mock_tests(void)
         new_TestFixture(test_ztimer_mock_set32),
         new_TestFixture(test_ztimer_mock_set16),
         new_TestFixture(test_ztimer_mock_is_set),
+        new_TestFixture(test_ztimer_mock_until_next),
+        new_TestFixture(test_ztimer_mock_many),
+#if MODULE_ZTIMER_SLACK && !MODULE_ZTIMER_HEAP
+        new_TestFixture(test_ztimer_mock_slack),
+#endif
+#if MODULE_ZTIMER_STATS
+        new_TestFixture(test_ztimer_mock_stats),
+#endif
+#if !MODULE_ZTIMER_HEAP
+        /* inspects the sorted list, not available with ztimer_heap */
         new_TestFixture(test_ztimer_mock_remove),
+#endif
     };
 
     EMB_UNIT_TESTCALLER(ztimer_tests, NULL, NULL, fixtures);
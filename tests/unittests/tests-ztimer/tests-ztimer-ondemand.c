@@ -37,7 +37,8 @@ static void test_ztimer_ondemand_acquire_release(void)
 
     ztimer_acquire(z);
     TEST_ASSERT_EQUAL_INT(1, zmock.running);
-    TEST_ASSERT_EQUAL_INT(0, zmock.armed);
+    /* with ztimer_now64, ztimer checkpoints 32 bit clocks as well */
+    TEST_ASSERT_EQUAL_INT(IS_USED(MODULE_ZTIMER_NOW64), zmock.armed);
     TEST_ASSERT_EQUAL_INT(1, zmock.calls.start);
 
     ztimer_acquire(z);